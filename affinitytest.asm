@@ -0,0 +1,1857 @@
+
+_affinitytest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         pin ? "pinned" : "unpinned", n, total);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 10             	sub    $0x10,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int ncpu, n;
+
+  if((ncpu = cpustat(st, NCPU)) < 1)
+  19:	6a 08                	push   $0x8
+  1b:	68 80 12 00 00       	push   $0x1280
+  20:	e8 41 08 00 00       	call   866 <cpustat>
+  25:	83 c4 10             	add    $0x10,%esp
+  28:	85 c0                	test   %eax,%eax
+  2a:	7e 63                	jle    8f <main+0x8f>
+  2c:	89 c3                	mov    %eax,%ebx
+    fail("cpustat");
+  n = ncpu + 1;
+  if(argc > 1)
+  2e:	83 fe 01             	cmp    $0x1,%esi
+  31:	7f 41                	jg     74 <main+0x74>
+  n = ncpu + 1;
+  33:	8d 70 01             	lea    0x1(%eax),%esi
+    n = atoi(argv[1]);
+  if(n < 1)
+    n = 1;
+  if(n > NCHILD)
+    n = NCHILD;
+  36:	b8 08 00 00 00       	mov    $0x8,%eax
+  3b:	39 c6                	cmp    %eax,%esi
+  3d:	0f 4f f0             	cmovg  %eax,%esi
+
+  pinning(ncpu);
+  40:	83 ec 0c             	sub    $0xc,%esp
+  43:	53                   	push   %ebx
+  44:	e8 77 00 00 00       	call   c0 <pinning>
+  spin(ncpu, n, 0);
+  49:	83 c4 0c             	add    $0xc,%esp
+  4c:	6a 00                	push   $0x0
+  4e:	56                   	push   %esi
+  4f:	53                   	push   %ebx
+  50:	e8 8b 01 00 00       	call   1e0 <spin>
+  spin(ncpu, n, 1);
+  55:	83 c4 0c             	add    $0xc,%esp
+  58:	6a 01                	push   $0x1
+  5a:	56                   	push   %esi
+  5b:	53                   	push   %ebx
+  5c:	e8 7f 01 00 00       	call   1e0 <spin>
+  printf(1, "affinitytest ok\n");
+  61:	58                   	pop    %eax
+  62:	5a                   	pop    %edx
+  63:	68 57 0d 00 00       	push   $0xd57
+  68:	6a 01                	push   $0x1
+  6a:	e8 31 09 00 00       	call   9a0 <printf>
+  exit();
+  6f:	e8 a8 06 00 00       	call   71c <exit>
+    n = atoi(argv[1]);
+  74:	83 ec 0c             	sub    $0xc,%esp
+  77:	ff 77 04             	push   0x4(%edi)
+  7a:	e8 51 04 00 00       	call   4d0 <atoi>
+  if(n < 1)
+  7f:	83 c4 10             	add    $0x10,%esp
+    n = atoi(argv[1]);
+  82:	89 c6                	mov    %eax,%esi
+  if(n < 1)
+  84:	85 c0                	test   %eax,%eax
+  86:	7f ae                	jg     36 <main+0x36>
+    n = 1;
+  88:	be 01 00 00 00       	mov    $0x1,%esi
+  8d:	eb b1                	jmp    40 <main+0x40>
+    fail("cpustat");
+  8f:	83 ec 0c             	sub    $0xc,%esp
+  92:	68 4f 0d 00 00       	push   $0xd4f
+  97:	e8 04 00 00 00       	call   a0 <fail>
+  9c:	66 90                	xchg   %ax,%ax
+  9e:	66 90                	xchg   %ax,%ax
+
+000000a0 <fail>:
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "affinitytest: %s\n", msg);
+  a6:	ff 75 08             	push   0x8(%ebp)
+  a9:	68 c8 0c 00 00       	push   $0xcc8
+  ae:	6a 01                	push   $0x1
+  b0:	e8 eb 08 00 00       	call   9a0 <printf>
+  exit();
+  b5:	e8 62 06 00 00       	call   71c <exit>
+  ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000000c0 <pinning>:
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	57                   	push   %edi
+  c4:	56                   	push   %esi
+  c5:	53                   	push   %ebx
+  c6:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < ncpu; i++){
+  c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  cc:	85 c0                	test   %eax,%eax
+  ce:	0f 8e 87 00 00 00    	jle    15b <pinning+0x9b>
+  d4:	31 db                	xor    %ebx,%ebx
+    if(sched_setaffinity(0, 1 << i) < 0)
+  d6:	bf 01 00 00 00       	mov    $0x1,%edi
+  db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  df:	90                   	nop
+  e0:	89 d9                	mov    %ebx,%ecx
+  e2:	89 fe                	mov    %edi,%esi
+  e4:	83 ec 08             	sub    $0x8,%esp
+  e7:	d3 e6                	shl    %cl,%esi
+  e9:	56                   	push   %esi
+  ea:	6a 00                	push   $0x0
+  ec:	e8 ac 07 00 00       	call   89d <sched_setaffinity>
+  f1:	83 c4 10             	add    $0x10,%esp
+  f4:	85 c0                	test   %eax,%eax
+  f6:	0f 88 d1 00 00 00    	js     1cd <pinning+0x10d>
+    if(sched_getaffinity(0) != 1 << i)
+  fc:	83 ec 0c             	sub    $0xc,%esp
+  ff:	6a 00                	push   $0x0
+ 101:	e8 a2 07 00 00       	call   8a8 <sched_getaffinity>
+ 106:	83 c4 10             	add    $0x10,%esp
+ 109:	39 c6                	cmp    %eax,%esi
+ 10b:	0f 85 af 00 00 00    	jne    1c0 <pinning+0x100>
+    for(j = 0; j < 200; j++){
+ 111:	31 f6                	xor    %esi,%esi
+ 113:	eb 0e                	jmp    123 <pinning+0x63>
+ 115:	8d 76 00             	lea    0x0(%esi),%esi
+ 118:	83 c6 01             	add    $0x1,%esi
+ 11b:	81 fe c8 00 00 00    	cmp    $0xc8,%esi
+ 121:	74 30                	je     153 <pinning+0x93>
+      if(getcpu() != i)
+ 123:	e8 8b 07 00 00       	call   8b3 <getcpu>
+ 128:	39 d8                	cmp    %ebx,%eax
+ 12a:	75 6b                	jne    197 <pinning+0xd7>
+        fail("ran on a CPU outside the mask");
+ 12c:	69 c6 29 5c 8f c2    	imul   $0xc28f5c29,%esi,%eax
+ 132:	d1 c8                	ror    %eax
+      if(j % 50 == 0)
+ 134:	3d 51 b8 1e 05       	cmp    $0x51eb851,%eax
+ 139:	77 dd                	ja     118 <pinning+0x58>
+        sleep(1);
+ 13b:	83 ec 0c             	sub    $0xc,%esp
+    for(j = 0; j < 200; j++){
+ 13e:	83 c6 01             	add    $0x1,%esi
+        sleep(1);
+ 141:	6a 01                	push   $0x1
+ 143:	e8 9a 06 00 00       	call   7e2 <sleep>
+ 148:	83 c4 10             	add    $0x10,%esp
+    for(j = 0; j < 200; j++){
+ 14b:	81 fe c8 00 00 00    	cmp    $0xc8,%esi
+ 151:	75 d0                	jne    123 <pinning+0x63>
+  for(i = 0; i < ncpu; i++){
+ 153:	83 c3 01             	add    $0x1,%ebx
+ 156:	39 5d 08             	cmp    %ebx,0x8(%ebp)
+ 159:	75 85                	jne    e0 <pinning+0x20>
+  if(sched_setaffinity(0, 0) != -1)
+ 15b:	83 ec 08             	sub    $0x8,%esp
+ 15e:	6a 00                	push   $0x0
+ 160:	6a 00                	push   $0x0
+ 162:	e8 36 07 00 00       	call   89d <sched_setaffinity>
+ 167:	83 c4 10             	add    $0x10,%esp
+ 16a:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 16d:	75 35                	jne    1a4 <pinning+0xe4>
+  if(sched_setaffinity(0, (1 << ncpu) - 1) < 0)
+ 16f:	0f b6 4d 08          	movzbl 0x8(%ebp),%ecx
+ 173:	b8 01 00 00 00       	mov    $0x1,%eax
+ 178:	83 ec 08             	sub    $0x8,%esp
+ 17b:	d3 e0                	shl    %cl,%eax
+ 17d:	83 e8 01             	sub    $0x1,%eax
+ 180:	50                   	push   %eax
+ 181:	6a 00                	push   $0x0
+ 183:	e8 15 07 00 00       	call   89d <sched_setaffinity>
+ 188:	83 c4 10             	add    $0x10,%esp
+ 18b:	85 c0                	test   %eax,%eax
+ 18d:	78 22                	js     1b1 <pinning+0xf1>
+}
+ 18f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 192:	5b                   	pop    %ebx
+ 193:	5e                   	pop    %esi
+ 194:	5f                   	pop    %edi
+ 195:	5d                   	pop    %ebp
+ 196:	c3                   	ret
+        fail("ran on a CPU outside the mask");
+ 197:	83 ec 0c             	sub    $0xc,%esp
+ 19a:	68 fe 0c 00 00       	push   $0xcfe
+ 19f:	e8 fc fe ff ff       	call   a0 <fail>
+    fail("empty mask accepted");
+ 1a4:	83 ec 0c             	sub    $0xc,%esp
+ 1a7:	68 1c 0d 00 00       	push   $0xd1c
+ 1ac:	e8 ef fe ff ff       	call   a0 <fail>
+    fail("sched_setaffinity all");
+ 1b1:	83 ec 0c             	sub    $0xc,%esp
+ 1b4:	68 30 0d 00 00       	push   $0xd30
+ 1b9:	e8 e2 fe ff ff       	call   a0 <fail>
+ 1be:	66 90                	xchg   %ax,%ax
+      fail("sched_getaffinity");
+ 1c0:	83 ec 0c             	sub    $0xc,%esp
+ 1c3:	68 ec 0c 00 00       	push   $0xcec
+ 1c8:	e8 d3 fe ff ff       	call   a0 <fail>
+      fail("sched_setaffinity");
+ 1cd:	83 ec 0c             	sub    $0xc,%esp
+ 1d0:	68 da 0c 00 00       	push   $0xcda
+ 1d5:	e8 c6 fe ff ff       	call   a0 <fail>
+ 1da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000001e0 <spin>:
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	56                   	push   %esi
+ 1e5:	53                   	push   %ebx
+ 1e6:	83 ec 3c             	sub    $0x3c,%esp
+  for(i = 0; i < n; i++){
+ 1e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 1ec:	85 c9                	test   %ecx,%ecx
+ 1ee:	0f 8e f0 00 00 00    	jle    2e4 <spin+0x104>
+ 1f4:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 1f7:	31 db                	xor    %ebx,%ebx
+ 1f9:	eb 0c                	jmp    207 <spin+0x27>
+ 1fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1ff:	90                   	nop
+ 200:	83 c3 01             	add    $0x1,%ebx
+ 203:	39 de                	cmp    %ebx,%esi
+ 205:	74 21                	je     228 <spin+0x48>
+    if((pids[i] = fork()) == 0){
+ 207:	e8 05 05 00 00       	call   711 <fork>
+ 20c:	89 44 9d c8          	mov    %eax,-0x38(%ebp,%ebx,4)
+ 210:	85 c0                	test   %eax,%eax
+ 212:	75 ec                	jne    200 <spin+0x20>
+      if(pin)
+ 214:	8b 55 10             	mov    0x10(%ebp),%edx
+ 217:	85 d2                	test   %edx,%edx
+ 219:	0f 85 a3 00 00 00    	jne    2c2 <spin+0xe2>
+      for(;;)
+ 21f:	eb fe                	jmp    21f <spin+0x3f>
+ 221:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sleep(100);
+ 228:	83 ec 0c             	sub    $0xc,%esp
+ 22b:	8d 5d c8             	lea    -0x38(%ebp),%ebx
+  total = 0;
+ 22e:	31 f6                	xor    %esi,%esi
+  sleep(100);
+ 230:	6a 64                	push   $0x64
+ 232:	89 df                	mov    %ebx,%edi
+ 234:	e8 a9 05 00 00       	call   7e2 <sleep>
+  for(i = 0; i < n; i++)
+ 239:	8b 45 0c             	mov    0xc(%ebp),%eax
+  total = 0;
+ 23c:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+ 23f:	83 c4 10             	add    $0x10,%esp
+ 242:	8d 04 83             	lea    (%ebx,%eax,4),%eax
+ 245:	89 f3                	mov    %esi,%ebx
+ 247:	89 fe                	mov    %edi,%esi
+ 249:	89 c7                	mov    %eax,%edi
+ 24b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 24f:	90                   	nop
+    if((m = migrations(pids[i])) > 0)
+ 250:	83 ec 0c             	sub    $0xc,%esp
+ 253:	ff 36                	push   (%esi)
+ 255:	e8 64 06 00 00       	call   8be <migrations>
+ 25a:	83 c4 10             	add    $0x10,%esp
+      total += m;
+ 25d:	8d 0c 03             	lea    (%ebx,%eax,1),%ecx
+ 260:	85 c0                	test   %eax,%eax
+ 262:	0f 4f d9             	cmovg  %ecx,%ebx
+  for(i = 0; i < n; i++)
+ 265:	83 c6 04             	add    $0x4,%esi
+ 268:	39 fe                	cmp    %edi,%esi
+ 26a:	75 e4                	jne    250 <spin+0x70>
+ 26c:	89 de                	mov    %ebx,%esi
+ 26e:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+ 271:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    kill(pids[i]);
+ 278:	83 ec 0c             	sub    $0xc,%esp
+ 27b:	ff 33                	push   (%ebx)
+  for(i = 0; i < n; i++){
+ 27d:	83 c3 04             	add    $0x4,%ebx
+    kill(pids[i]);
+ 280:	e8 d9 04 00 00       	call   75e <kill>
+    wait();
+ 285:	e8 9d 04 00 00       	call   727 <wait>
+  for(i = 0; i < n; i++){
+ 28a:	83 c4 10             	add    $0x10,%esp
+ 28d:	39 fb                	cmp    %edi,%ebx
+ 28f:	75 e7                	jne    278 <spin+0x98>
+  printf(1, "%s: %d children, %d migrations in 1s\n",
+ 291:	8b 45 10             	mov    0x10(%ebp),%eax
+ 294:	b9 48 0d 00 00       	mov    $0xd48,%ecx
+ 299:	85 c0                	test   %eax,%eax
+ 29b:	b8 46 0d 00 00       	mov    $0xd46,%eax
+ 2a0:	0f 45 c1             	cmovne %ecx,%eax
+ 2a3:	83 ec 0c             	sub    $0xc,%esp
+ 2a6:	56                   	push   %esi
+ 2a7:	ff 75 0c             	push   0xc(%ebp)
+ 2aa:	50                   	push   %eax
+ 2ab:	68 68 0d 00 00       	push   $0xd68
+ 2b0:	6a 01                	push   $0x1
+ 2b2:	e8 e9 06 00 00       	call   9a0 <printf>
+}
+ 2b7:	83 c4 20             	add    $0x20,%esp
+ 2ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2bd:	5b                   	pop    %ebx
+ 2be:	5e                   	pop    %esi
+ 2bf:	5f                   	pop    %edi
+ 2c0:	5d                   	pop    %ebp
+ 2c1:	c3                   	ret
+        sched_setaffinity(0, 1 << (i % ncpu));
+ 2c2:	89 d8                	mov    %ebx,%eax
+ 2c4:	83 ec 08             	sub    $0x8,%esp
+ 2c7:	99                   	cltd
+ 2c8:	f7 7d 08             	idivl  0x8(%ebp)
+ 2cb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2d0:	89 d1                	mov    %edx,%ecx
+ 2d2:	d3 e0                	shl    %cl,%eax
+ 2d4:	50                   	push   %eax
+ 2d5:	6a 00                	push   $0x0
+ 2d7:	e8 c1 05 00 00       	call   89d <sched_setaffinity>
+ 2dc:	83 c4 10             	add    $0x10,%esp
+ 2df:	e9 3b ff ff ff       	jmp    21f <spin+0x3f>
+  sleep(100);
+ 2e4:	83 ec 0c             	sub    $0xc,%esp
+  total = 0;
+ 2e7:	31 f6                	xor    %esi,%esi
+  sleep(100);
+ 2e9:	6a 64                	push   $0x64
+ 2eb:	e8 f2 04 00 00       	call   7e2 <sleep>
+ 2f0:	83 c4 10             	add    $0x10,%esp
+ 2f3:	eb 9c                	jmp    291 <spin+0xb1>
+ 2f5:	66 90                	xchg   %ax,%ax
+ 2f7:	66 90                	xchg   %ax,%ax
+ 2f9:	66 90                	xchg   %ax,%ax
+ 2fb:	66 90                	xchg   %ax,%ax
+ 2fd:	66 90                	xchg   %ax,%ax
+ 2ff:	90                   	nop
+
+00000300 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 300:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 301:	31 c0                	xor    %eax,%eax
+{
+ 303:	89 e5                	mov    %esp,%ebp
+ 305:	53                   	push   %ebx
+ 306:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 309:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 310:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 314:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 317:	83 c0 01             	add    $0x1,%eax
+ 31a:	84 d2                	test   %dl,%dl
+ 31c:	75 f2                	jne    310 <strcpy+0x10>
+    ;
+  return os;
+}
+ 31e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 321:	89 c8                	mov    %ecx,%eax
+ 323:	c9                   	leave
+ 324:	c3                   	ret
+ 325:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	53                   	push   %ebx
+ 334:	8b 55 08             	mov    0x8(%ebp),%edx
+ 337:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 33a:	0f b6 02             	movzbl (%edx),%eax
+ 33d:	84 c0                	test   %al,%al
+ 33f:	75 17                	jne    358 <strcmp+0x28>
+ 341:	eb 3a                	jmp    37d <strcmp+0x4d>
+ 343:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 347:	90                   	nop
+ 348:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 34c:	83 c2 01             	add    $0x1,%edx
+ 34f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 352:	84 c0                	test   %al,%al
+ 354:	74 1a                	je     370 <strcmp+0x40>
+    p++, q++;
+ 356:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 358:	0f b6 19             	movzbl (%ecx),%ebx
+ 35b:	38 c3                	cmp    %al,%bl
+ 35d:	74 e9                	je     348 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 35f:	29 d8                	sub    %ebx,%eax
+}
+ 361:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 364:	c9                   	leave
+ 365:	c3                   	ret
+ 366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 370:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 374:	31 c0                	xor    %eax,%eax
+ 376:	29 d8                	sub    %ebx,%eax
+}
+ 378:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 37b:	c9                   	leave
+ 37c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 37d:	0f b6 19             	movzbl (%ecx),%ebx
+ 380:	31 c0                	xor    %eax,%eax
+ 382:	eb db                	jmp    35f <strcmp+0x2f>
+ 384:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 38f:	90                   	nop
+
+00000390 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 396:	80 3a 00             	cmpb   $0x0,(%edx)
+ 399:	74 15                	je     3b0 <strlen+0x20>
+ 39b:	31 c0                	xor    %eax,%eax
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+ 3a0:	83 c0 01             	add    $0x1,%eax
+ 3a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3a7:	89 c1                	mov    %eax,%ecx
+ 3a9:	75 f5                	jne    3a0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3ab:	89 c8                	mov    %ecx,%eax
+ 3ad:	5d                   	pop    %ebp
+ 3ae:	c3                   	ret
+ 3af:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3b0:	31 c9                	xor    %ecx,%ecx
+}
+ 3b2:	5d                   	pop    %ebp
+ 3b3:	89 c8                	mov    %ecx,%eax
+ 3b5:	c3                   	ret
+ 3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	57                   	push   %edi
+ 3c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 3c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3cd:	89 d7                	mov    %edx,%edi
+ 3cf:	fc                   	cld
+ 3d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3d5:	89 d0                	mov    %edx,%eax
+ 3d7:	c9                   	leave
+ 3d8:	c3                   	ret
+ 3d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3ea:	0f b6 10             	movzbl (%eax),%edx
+ 3ed:	84 d2                	test   %dl,%dl
+ 3ef:	75 12                	jne    403 <strchr+0x23>
+ 3f1:	eb 1d                	jmp    410 <strchr+0x30>
+ 3f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3f7:	90                   	nop
+ 3f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3fc:	83 c0 01             	add    $0x1,%eax
+ 3ff:	84 d2                	test   %dl,%dl
+ 401:	74 0d                	je     410 <strchr+0x30>
+    if(*s == c)
+ 403:	38 d1                	cmp    %dl,%cl
+ 405:	75 f1                	jne    3f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 407:	5d                   	pop    %ebp
+ 408:	c3                   	ret
+ 409:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 410:	31 c0                	xor    %eax,%eax
+}
+ 412:	5d                   	pop    %ebp
+ 413:	c3                   	ret
+ 414:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 41f:	90                   	nop
+
+00000420 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	57                   	push   %edi
+ 424:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 425:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 428:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 429:	31 db                	xor    %ebx,%ebx
+{
+ 42b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 42e:	eb 27                	jmp    457 <gets+0x37>
+    cc = read(0, &c, 1);
+ 430:	83 ec 04             	sub    $0x4,%esp
+ 433:	6a 01                	push   $0x1
+ 435:	56                   	push   %esi
+ 436:	6a 00                	push   $0x0
+ 438:	e8 00 03 00 00       	call   73d <read>
+    if(cc < 1)
+ 43d:	83 c4 10             	add    $0x10,%esp
+ 440:	85 c0                	test   %eax,%eax
+ 442:	7e 1d                	jle    461 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 444:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 448:	8b 55 08             	mov    0x8(%ebp),%edx
+ 44b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 44f:	3c 0a                	cmp    $0xa,%al
+ 451:	74 10                	je     463 <gets+0x43>
+ 453:	3c 0d                	cmp    $0xd,%al
+ 455:	74 0c                	je     463 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 457:	89 df                	mov    %ebx,%edi
+ 459:	83 c3 01             	add    $0x1,%ebx
+ 45c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 45f:	7c cf                	jl     430 <gets+0x10>
+ 461:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 463:	8b 45 08             	mov    0x8(%ebp),%eax
+ 466:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 46a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 46d:	5b                   	pop    %ebx
+ 46e:	5e                   	pop    %esi
+ 46f:	5f                   	pop    %edi
+ 470:	5d                   	pop    %ebp
+ 471:	c3                   	ret
+ 472:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	56                   	push   %esi
+ 484:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 485:	83 ec 08             	sub    $0x8,%esp
+ 488:	6a 00                	push   $0x0
+ 48a:	ff 75 08             	push   0x8(%ebp)
+ 48d:	e8 e2 02 00 00       	call   774 <open>
+  if(fd < 0)
+ 492:	83 c4 10             	add    $0x10,%esp
+ 495:	85 c0                	test   %eax,%eax
+ 497:	78 27                	js     4c0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 499:	83 ec 08             	sub    $0x8,%esp
+ 49c:	ff 75 0c             	push   0xc(%ebp)
+ 49f:	89 c3                	mov    %eax,%ebx
+ 4a1:	50                   	push   %eax
+ 4a2:	e8 ee 02 00 00       	call   795 <fstat>
+  close(fd);
+ 4a7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4aa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4ac:	e8 a2 02 00 00       	call   753 <close>
+  return r;
+ 4b1:	83 c4 10             	add    $0x10,%esp
+}
+ 4b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4b7:	89 f0                	mov    %esi,%eax
+ 4b9:	5b                   	pop    %ebx
+ 4ba:	5e                   	pop    %esi
+ 4bb:	5d                   	pop    %ebp
+ 4bc:	c3                   	ret
+ 4bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 4c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 4c5:	eb ed                	jmp    4b4 <stat+0x34>
+ 4c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ce:	66 90                	xchg   %ax,%ax
+
+000004d0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	53                   	push   %ebx
+ 4d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 4d7:	0f be 02             	movsbl (%edx),%eax
+ 4da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 4dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 4e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 4e5:	77 1e                	ja     505 <atoi+0x35>
+ 4e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4f0:	83 c2 01             	add    $0x1,%edx
+ 4f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 4f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 4fa:	0f be 02             	movsbl (%edx),%eax
+ 4fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 500:	80 fb 09             	cmp    $0x9,%bl
+ 503:	76 eb                	jbe    4f0 <atoi+0x20>
+  return n;
+}
+ 505:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 508:	89 c8                	mov    %ecx,%eax
+ 50a:	c9                   	leave
+ 50b:	c3                   	ret
+ 50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000510 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+ 514:	56                   	push   %esi
+ 515:	8b 45 10             	mov    0x10(%ebp),%eax
+ 518:	8b 55 08             	mov    0x8(%ebp),%edx
+ 51b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 51e:	85 c0                	test   %eax,%eax
+ 520:	7e 13                	jle    535 <memmove+0x25>
+ 522:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 524:	89 d7                	mov    %edx,%edi
+ 526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 530:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 531:	39 f8                	cmp    %edi,%eax
+ 533:	75 fb                	jne    530 <memmove+0x20>
+  return vdst;
+}
+ 535:	5e                   	pop    %esi
+ 536:	89 d0                	mov    %edx,%eax
+ 538:	5f                   	pop    %edi
+ 539:	5d                   	pop    %ebp
+ 53a:	c3                   	ret
+ 53b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 53f:	90                   	nop
+
+00000540 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 540:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 545:	85 c0                	test   %eax,%eax
+ 547:	74 07                	je     550 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 549:	c3                   	ret
+ 54a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 550:	e9 77 02 00 00       	jmp    7cc <sysgetpid>
+ 555:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000560 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 560:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 565:	c3                   	ret
+ 566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000570 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 570:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 571:	31 d2                	xor    %edx,%edx
+ 573:	89 e5                	mov    %esp,%ebp
+ 575:	53                   	push   %ebx
+ 576:	83 ec 04             	sub    $0x4,%esp
+ 579:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 57c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 57f:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 582:	85 c9                	test   %ecx,%ecx
+ 584:	7e 08                	jle    58e <cyclereport+0x1e>
+ 586:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 588:	89 d8                	mov    %ebx,%eax
+ 58a:	f7 f1                	div    %ecx
+ 58c:	89 c2                	mov    %eax,%edx
+ 58e:	83 ec 08             	sub    $0x8,%esp
+ 591:	52                   	push   %edx
+ 592:	ff 75 0c             	push   0xc(%ebp)
+ 595:	51                   	push   %ecx
+ 596:	ff 75 08             	push   0x8(%ebp)
+ 599:	68 8e 0d 00 00       	push   $0xd8e
+ 59e:	6a 01                	push   $0x1
+ 5a0:	e8 fb 03 00 00       	call   9a0 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 5a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5a8:	83 c4 20             	add    $0x20,%esp
+ 5ab:	c9                   	leave
+ 5ac:	c3                   	ret
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005b0 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 5b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 5bc:	5d                   	pop    %ebp
+ 5bd:	c3                   	ret
+ 5be:	66 90                	xchg   %ax,%ax
+
+000005c0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 5c0:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 5c1:	31 c0                	xor    %eax,%eax
+ 5c3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 5c8:	89 e5                	mov    %esp,%ebp
+ 5ca:	56                   	push   %esi
+ 5cb:	53                   	push   %ebx
+ 5cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 5cf:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 5d3:	85 c0                	test   %eax,%eax
+ 5d5:	74 30                	je     607 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 5d7:	83 f8 02             	cmp    $0x2,%eax
+ 5da:	74 0c                	je     5e8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 5dc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5e1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 5e4:	85 c0                	test   %eax,%eax
+ 5e6:	74 1f                	je     607 <mutex_lock+0x47>
+ 5e8:	be 02 00 00 00       	mov    $0x2,%esi
+ 5ed:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 5f0:	83 ec 08             	sub    $0x8,%esp
+ 5f3:	6a 02                	push   $0x2
+ 5f5:	53                   	push   %ebx
+ 5f6:	e8 8c 02 00 00       	call   887 <futex_wait>
+ 5fb:	89 f0                	mov    %esi,%eax
+ 5fd:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 600:	83 c4 10             	add    $0x10,%esp
+ 603:	85 c0                	test   %eax,%eax
+ 605:	75 e9                	jne    5f0 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 607:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 60a:	5b                   	pop    %ebx
+ 60b:	5e                   	pop    %esi
+ 60c:	5d                   	pop    %ebp
+ 60d:	c3                   	ret
+ 60e:	66 90                	xchg   %ax,%ax
+
+00000610 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	83 ec 08             	sub    $0x8,%esp
+ 616:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 619:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 61d:	75 09                	jne    628 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 61f:	c9                   	leave
+ 620:	c3                   	ret
+ 621:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 628:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 62b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 631:	6a 01                	push   $0x1
+ 633:	50                   	push   %eax
+ 634:	e8 59 02 00 00       	call   892 <futex_wake>
+ 639:	83 c4 10             	add    $0x10,%esp
+}
+ 63c:	c9                   	leave
+ 63d:	c3                   	ret
+ 63e:	66 90                	xchg   %ax,%ax
+
+00000640 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 643:	8b 45 08             	mov    0x8(%ebp),%eax
+ 646:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 64c:	5d                   	pop    %ebp
+ 64d:	c3                   	ret
+ 64e:	66 90                	xchg   %ax,%ax
+
+00000650 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	57                   	push   %edi
+ 654:	56                   	push   %esi
+ 655:	53                   	push   %ebx
+ 656:	83 ec 0c             	sub    $0xc,%esp
+ 659:	8b 75 08             	mov    0x8(%ebp),%esi
+ 65c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 65f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 661:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 665:	75 21                	jne    688 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 667:	83 ec 08             	sub    $0x8,%esp
+ 66a:	57                   	push   %edi
+ 66b:	56                   	push   %esi
+ 66c:	e8 16 02 00 00       	call   887 <futex_wait>
+  mutex_lock(m);
+ 671:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 674:	83 c4 10             	add    $0x10,%esp
+}
+ 677:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 67a:	5b                   	pop    %ebx
+ 67b:	5e                   	pop    %esi
+ 67c:	5f                   	pop    %edi
+ 67d:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 67e:	e9 3d ff ff ff       	jmp    5c0 <mutex_lock>
+ 683:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 687:	90                   	nop
+    futex_wake(&m->v, 1);
+ 688:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 68b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 691:	6a 01                	push   $0x1
+ 693:	53                   	push   %ebx
+ 694:	e8 f9 01 00 00       	call   892 <futex_wake>
+ 699:	83 c4 10             	add    $0x10,%esp
+ 69c:	eb c9                	jmp    667 <cond_wait+0x17>
+ 69e:	66 90                	xchg   %ax,%ax
+
+000006a0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	83 ec 10             	sub    $0x10,%esp
+ 6a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 6a9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 6ad:	6a 01                	push   $0x1
+ 6af:	50                   	push   %eax
+ 6b0:	e8 dd 01 00 00       	call   892 <futex_wake>
+}
+ 6b5:	83 c4 10             	add    $0x10,%esp
+ 6b8:	c9                   	leave
+ 6b9:	c3                   	ret
+ 6ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000006c0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 e5                	mov    %esp,%ebp
+ 6c3:	83 ec 10             	sub    $0x10,%esp
+ 6c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 6c9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 6cd:	68 ff ff ff 7f       	push   $0x7fffffff
+ 6d2:	50                   	push   %eax
+ 6d3:	e8 ba 01 00 00       	call   892 <futex_wake>
+}
+ 6d8:	83 c4 10             	add    $0x10,%esp
+ 6db:	c9                   	leave
+ 6dc:	c3                   	ret
+
+000006dd <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 6dd:	50                   	push   %eax
+  pushl %ebx
+ 6de:	53                   	push   %ebx
+  movl $1, %eax
+ 6df:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 6e4:	0f a2                	cpuid
+  popl %ebx
+ 6e6:	5b                   	pop    %ebx
+  popl %eax
+ 6e7:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 6e8:	c7 05 78 12 00 00 0e 	movl   $0x70e,0x1278
+ 6ef:	07 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 6f2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 6f8:	74 14                	je     70e <sysint>
+  movl $sysfast, syscallvec
+ 6fa:	c7 05 78 12 00 00 04 	movl   $0x704,0x1278
+ 701:	07 00 00 
+
+00000704 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 704:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 706:	ba 0d 07 00 00       	mov    $0x70d,%edx
+  sysenter
+ 70b:	0f 34                	sysenter
+1:
+  ret
+ 70d:	c3                   	ret
+
+0000070e <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 70e:	cd 40                	int    $0x40
+  ret
+ 710:	c3                   	ret
+
+00000711 <fork>:
+
+SYSCALL(fork)
+ 711:	b8 01 00 00 00       	mov    $0x1,%eax
+ 716:	ff 25 78 12 00 00    	jmp    *0x1278
+
+0000071c <exit>:
+SYSCALL(exit)
+ 71c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 721:	ff 25 78 12 00 00    	jmp    *0x1278
+
+00000727 <wait>:
+SYSCALL(wait)
+ 727:	b8 03 00 00 00       	mov    $0x3,%eax
+ 72c:	ff 25 78 12 00 00    	jmp    *0x1278
+
+00000732 <pipe>:
+SYSCALL(pipe)
+ 732:	b8 04 00 00 00       	mov    $0x4,%eax
+ 737:	ff 25 78 12 00 00    	jmp    *0x1278
+
+0000073d <read>:
+SYSCALL(read)
+ 73d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 742:	ff 25 78 12 00 00    	jmp    *0x1278
+
+00000748 <write>:
+SYSCALL(write)
+ 748:	b8 10 00 00 00       	mov    $0x10,%eax
+ 74d:	ff 25 78 12 00 00    	jmp    *0x1278
+
+00000753 <close>:
+SYSCALL(close)
+ 753:	b8 15 00 00 00       	mov    $0x15,%eax
+ 758:	ff 25 78 12 00 00    	jmp    *0x1278
+
+0000075e <kill>:
+SYSCALL(kill)
+ 75e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 763:	ff 25 78 12 00 00    	jmp    *0x1278
+
+00000769 <exec>:
+SYSCALL(exec)
+ 769:	b8 07 00 00 00       	mov    $0x7,%eax
+ 76e:	ff 25 78 12 00 00    	jmp    *0x1278
+
+00000774 <open>:
+SYSCALL(open)
+ 774:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 779:	ff 25 78 12 00 00    	jmp    *0x1278
+
+0000077f <mknod>:
+SYSCALL(mknod)
+ 77f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 784:	ff 25 78 12 00 00    	jmp    *0x1278
+
+0000078a <unlink>:
+SYSCALL(unlink)
+ 78a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 78f:	ff 25 78 12 00 00    	jmp    *0x1278
+
+00000795 <fstat>:
+SYSCALL(fstat)
+ 795:	b8 08 00 00 00       	mov    $0x8,%eax
+ 79a:	ff 25 78 12 00 00    	jmp    *0x1278
+
+000007a0 <link>:
+SYSCALL(link)
+ 7a0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7a5:	ff 25 78 12 00 00    	jmp    *0x1278
+
+000007ab <mkdir>:
+SYSCALL(mkdir)
+ 7ab:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7b0:	ff 25 78 12 00 00    	jmp    *0x1278
+
+000007b6 <chdir>:
+SYSCALL(chdir)
+ 7b6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7bb:	ff 25 78 12 00 00    	jmp    *0x1278
+
+000007c1 <dup>:
+SYSCALL(dup)
+ 7c1:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7c6:	ff 25 78 12 00 00    	jmp    *0x1278
+
+000007cc <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 7cc:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7d1:	ff 25 78 12 00 00    	jmp    *0x1278
+
+000007d7 <sbrk>:
+SYSCALL(sbrk)
+ 7d7:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7dc:	ff 25 78 12 00 00    	jmp    *0x1278
+
+000007e2 <sleep>:
+SYSCALL(sleep)
+ 7e2:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7e7:	ff 25 78 12 00 00    	jmp    *0x1278
+
+000007ed <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 7ed:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7f2:	ff 25 78 12 00 00    	jmp    *0x1278
+
+000007f8 <swapread>:
+SYSCALL(swapread)
+ 7f8:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7fd:	ff 25 78 12 00 00    	jmp    *0x1278
+
+00000803 <swapwrite>:
+SYSCALL(swapwrite)
+ 803:	b8 17 00 00 00       	mov    $0x17,%eax
+ 808:	ff 25 78 12 00 00    	jmp    *0x1278
+
+0000080e <swapstat>:
+SYSCALL(swapstat)
+ 80e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 813:	ff 25 78 12 00 00    	jmp    *0x1278
+
+00000819 <madvise>:
+SYSCALL(madvise)
+ 819:	b8 19 00 00 00       	mov    $0x19,%eax
+ 81e:	ff 25 78 12 00 00    	jmp    *0x1278
+
+00000824 <mlock>:
+SYSCALL(mlock)
+ 824:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 829:	ff 25 78 12 00 00    	jmp    *0x1278
+
+0000082f <munlock>:
+SYSCALL(munlock)
+ 82f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 834:	ff 25 78 12 00 00    	jmp    *0x1278
+
+0000083a <membench>:
+SYSCALL(membench)
+ 83a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 83f:	ff 25 78 12 00 00    	jmp    *0x1278
+
+00000845 <nice>:
+SYSCALL(nice)
+ 845:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 84a:	ff 25 78 12 00 00    	jmp    *0x1278
+
+00000850 <setpriority>:
+SYSCALL(setpriority)
+ 850:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 855:	ff 25 78 12 00 00    	jmp    *0x1278
+
+0000085b <usleep>:
+SYSCALL(usleep)
+ 85b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 860:	ff 25 78 12 00 00    	jmp    *0x1278
+
+00000866 <cpustat>:
+SYSCALL(cpustat)
+ 866:	b8 20 00 00 00       	mov    $0x20,%eax
+ 86b:	ff 25 78 12 00 00    	jmp    *0x1278
+
+00000871 <clone>:
+SYSCALL(clone)
+ 871:	b8 21 00 00 00       	mov    $0x21,%eax
+ 876:	ff 25 78 12 00 00    	jmp    *0x1278
+
+0000087c <join>:
+SYSCALL(join)
+ 87c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 881:	ff 25 78 12 00 00    	jmp    *0x1278
+
+00000887 <futex_wait>:
+SYSCALL(futex_wait)
+ 887:	b8 23 00 00 00       	mov    $0x23,%eax
+ 88c:	ff 25 78 12 00 00    	jmp    *0x1278
+
+00000892 <futex_wake>:
+SYSCALL(futex_wake)
+ 892:	b8 24 00 00 00       	mov    $0x24,%eax
+ 897:	ff 25 78 12 00 00    	jmp    *0x1278
+
+0000089d <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 89d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 8a2:	ff 25 78 12 00 00    	jmp    *0x1278
+
+000008a8 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 8a8:	b8 26 00 00 00       	mov    $0x26,%eax
+ 8ad:	ff 25 78 12 00 00    	jmp    *0x1278
+
+000008b3 <getcpu>:
+SYSCALL(getcpu)
+ 8b3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 8b8:	ff 25 78 12 00 00    	jmp    *0x1278
+
+000008be <migrations>:
+SYSCALL(migrations)
+ 8be:	b8 28 00 00 00       	mov    $0x28,%eax
+ 8c3:	ff 25 78 12 00 00    	jmp    *0x1278
+
+000008c9 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 8c9:	b8 29 00 00 00       	mov    $0x29,%eax
+ 8ce:	ff 25 78 12 00 00    	jmp    *0x1278
+
+000008d4 <lockstat>:
+SYSCALL(lockstat)
+ 8d4:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 8d9:	ff 25 78 12 00 00    	jmp    *0x1278
+
+000008df <lockprof>:
+SYSCALL(lockprof)
+ 8df:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 8e4:	ff 25 78 12 00 00    	jmp    *0x1278
+
+000008ea <bcachestat>:
+SYSCALL(bcachestat)
+ 8ea:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 8ef:	ff 25 78 12 00 00    	jmp    *0x1278
+ 8f5:	66 90                	xchg   %ax,%ax
+ 8f7:	66 90                	xchg   %ax,%ax
+ 8f9:	66 90                	xchg   %ax,%ax
+ 8fb:	66 90                	xchg   %ax,%ax
+ 8fd:	66 90                	xchg   %ax,%ax
+ 8ff:	90                   	nop
+
+00000900 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 900:	55                   	push   %ebp
+ 901:	89 e5                	mov    %esp,%ebp
+ 903:	57                   	push   %edi
+ 904:	56                   	push   %esi
+ 905:	53                   	push   %ebx
+ 906:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 908:	89 d1                	mov    %edx,%ecx
+{
+ 90a:	83 ec 3c             	sub    $0x3c,%esp
+ 90d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 910:	85 d2                	test   %edx,%edx
+ 912:	0f 89 80 00 00 00    	jns    998 <printint+0x98>
+ 918:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 91c:	74 7a                	je     998 <printint+0x98>
+    x = -xx;
+ 91e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 920:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 925:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 928:	31 f6                	xor    %esi,%esi
+ 92a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 930:	89 c8                	mov    %ecx,%eax
+ 932:	31 d2                	xor    %edx,%edx
+ 934:	89 f7                	mov    %esi,%edi
+ 936:	f7 f3                	div    %ebx
+ 938:	8d 76 01             	lea    0x1(%esi),%esi
+ 93b:	0f b6 92 08 0e 00 00 	movzbl 0xe08(%edx),%edx
+ 942:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 946:	89 ca                	mov    %ecx,%edx
+ 948:	89 c1                	mov    %eax,%ecx
+ 94a:	39 da                	cmp    %ebx,%edx
+ 94c:	73 e2                	jae    930 <printint+0x30>
+  if(neg)
+ 94e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 951:	85 c0                	test   %eax,%eax
+ 953:	74 07                	je     95c <printint+0x5c>
+    buf[i++] = '-';
+ 955:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 95a:	89 f7                	mov    %esi,%edi
+ 95c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 95f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 962:	01 df                	add    %ebx,%edi
+ 964:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 968:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 96b:	83 ec 04             	sub    $0x4,%esp
+ 96e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 971:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 974:	6a 01                	push   $0x1
+ 976:	50                   	push   %eax
+ 977:	56                   	push   %esi
+ 978:	e8 cb fd ff ff       	call   748 <write>
+  while(--i >= 0)
+ 97d:	89 f8                	mov    %edi,%eax
+ 97f:	83 c4 10             	add    $0x10,%esp
+ 982:	83 ef 01             	sub    $0x1,%edi
+ 985:	39 d8                	cmp    %ebx,%eax
+ 987:	75 df                	jne    968 <printint+0x68>
+}
+ 989:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 98c:	5b                   	pop    %ebx
+ 98d:	5e                   	pop    %esi
+ 98e:	5f                   	pop    %edi
+ 98f:	5d                   	pop    %ebp
+ 990:	c3                   	ret
+ 991:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 998:	31 c0                	xor    %eax,%eax
+ 99a:	eb 89                	jmp    925 <printint+0x25>
+ 99c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000009a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 9a0:	55                   	push   %ebp
+ 9a1:	89 e5                	mov    %esp,%ebp
+ 9a3:	57                   	push   %edi
+ 9a4:	56                   	push   %esi
+ 9a5:	53                   	push   %ebx
+ 9a6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 9a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 9ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 9af:	0f b6 1e             	movzbl (%esi),%ebx
+ 9b2:	83 c6 01             	add    $0x1,%esi
+ 9b5:	84 db                	test   %bl,%bl
+ 9b7:	74 67                	je     a20 <printf+0x80>
+ 9b9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 9bc:	31 d2                	xor    %edx,%edx
+ 9be:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 9c1:	eb 34                	jmp    9f7 <printf+0x57>
+ 9c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9c7:	90                   	nop
+ 9c8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 9cb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 9d0:	83 f8 25             	cmp    $0x25,%eax
+ 9d3:	74 18                	je     9ed <printf+0x4d>
+  write(fd, &c, 1);
+ 9d5:	83 ec 04             	sub    $0x4,%esp
+ 9d8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 9db:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9de:	6a 01                	push   $0x1
+ 9e0:	50                   	push   %eax
+ 9e1:	57                   	push   %edi
+ 9e2:	e8 61 fd ff ff       	call   748 <write>
+ 9e7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 9ea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 9ed:	0f b6 1e             	movzbl (%esi),%ebx
+ 9f0:	83 c6 01             	add    $0x1,%esi
+ 9f3:	84 db                	test   %bl,%bl
+ 9f5:	74 29                	je     a20 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 9f7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 9fa:	85 d2                	test   %edx,%edx
+ 9fc:	74 ca                	je     9c8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 9fe:	83 fa 25             	cmp    $0x25,%edx
+ a01:	75 ea                	jne    9ed <printf+0x4d>
+      if(c == 'd'){
+ a03:	83 f8 25             	cmp    $0x25,%eax
+ a06:	0f 84 24 01 00 00    	je     b30 <printf+0x190>
+ a0c:	83 e8 63             	sub    $0x63,%eax
+ a0f:	83 f8 15             	cmp    $0x15,%eax
+ a12:	77 1c                	ja     a30 <printf+0x90>
+ a14:	ff 24 85 b0 0d 00 00 	jmp    *0xdb0(,%eax,4)
+ a1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a1f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ a20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a23:	5b                   	pop    %ebx
+ a24:	5e                   	pop    %esi
+ a25:	5f                   	pop    %edi
+ a26:	5d                   	pop    %ebp
+ a27:	c3                   	ret
+ a28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2f:	90                   	nop
+  write(fd, &c, 1);
+ a30:	83 ec 04             	sub    $0x4,%esp
+ a33:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a36:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ a3a:	6a 01                	push   $0x1
+ a3c:	52                   	push   %edx
+ a3d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ a40:	57                   	push   %edi
+ a41:	e8 02 fd ff ff       	call   748 <write>
+ a46:	83 c4 0c             	add    $0xc,%esp
+ a49:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a4c:	6a 01                	push   $0x1
+ a4e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ a51:	52                   	push   %edx
+ a52:	57                   	push   %edi
+ a53:	e8 f0 fc ff ff       	call   748 <write>
+        putc(fd, c);
+ a58:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a5b:	31 d2                	xor    %edx,%edx
+ a5d:	eb 8e                	jmp    9ed <printf+0x4d>
+ a5f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ a60:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a63:	83 ec 0c             	sub    $0xc,%esp
+ a66:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a6b:	8b 13                	mov    (%ebx),%edx
+ a6d:	6a 00                	push   $0x0
+ a6f:	89 f8                	mov    %edi,%eax
+        ap++;
+ a71:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ a74:	e8 87 fe ff ff       	call   900 <printint>
+        ap++;
+ a79:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a7c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a7f:	31 d2                	xor    %edx,%edx
+ a81:	e9 67 ff ff ff       	jmp    9ed <printf+0x4d>
+ a86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a90:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a93:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a95:	83 c0 04             	add    $0x4,%eax
+ a98:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a9b:	85 db                	test   %ebx,%ebx
+ a9d:	0f 84 9d 00 00 00    	je     b40 <printf+0x1a0>
+        while(*s != 0){
+ aa3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ aa6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ aa8:	84 c0                	test   %al,%al
+ aaa:	0f 84 3d ff ff ff    	je     9ed <printf+0x4d>
+ ab0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ab3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ ab6:	89 de                	mov    %ebx,%esi
+ ab8:	89 d3                	mov    %edx,%ebx
+ aba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ ac0:	83 ec 04             	sub    $0x4,%esp
+ ac3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ ac6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ ac9:	6a 01                	push   $0x1
+ acb:	53                   	push   %ebx
+ acc:	57                   	push   %edi
+ acd:	e8 76 fc ff ff       	call   748 <write>
+        while(*s != 0){
+ ad2:	0f b6 06             	movzbl (%esi),%eax
+ ad5:	83 c4 10             	add    $0x10,%esp
+ ad8:	84 c0                	test   %al,%al
+ ada:	75 e4                	jne    ac0 <printf+0x120>
+      state = 0;
+ adc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ adf:	31 d2                	xor    %edx,%edx
+ ae1:	e9 07 ff ff ff       	jmp    9ed <printf+0x4d>
+ ae6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aed:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ af0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ af3:	83 ec 0c             	sub    $0xc,%esp
+ af6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ afb:	8b 13                	mov    (%ebx),%edx
+ afd:	6a 01                	push   $0x1
+ aff:	e9 6b ff ff ff       	jmp    a6f <printf+0xcf>
+ b04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ b08:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ b0b:	83 ec 04             	sub    $0x4,%esp
+ b0e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ b11:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ b13:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ b16:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ b19:	6a 01                	push   $0x1
+ b1b:	52                   	push   %edx
+ b1c:	57                   	push   %edi
+ b1d:	e8 26 fc ff ff       	call   748 <write>
+        ap++;
+ b22:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b25:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b28:	31 d2                	xor    %edx,%edx
+ b2a:	e9 be fe ff ff       	jmp    9ed <printf+0x4d>
+ b2f:	90                   	nop
+  write(fd, &c, 1);
+ b30:	83 ec 04             	sub    $0x4,%esp
+ b33:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b36:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b39:	6a 01                	push   $0x1
+ b3b:	e9 11 ff ff ff       	jmp    a51 <printf+0xb1>
+ b40:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ b45:	bb a9 0d 00 00       	mov    $0xda9,%ebx
+ b4a:	e9 61 ff ff ff       	jmp    ab0 <printf+0x110>
+ b4f:	90                   	nop
+
+00000b50 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b50:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b51:	a1 80 13 00 00       	mov    0x1380,%eax
+{
+ b56:	89 e5                	mov    %esp,%ebp
+ b58:	57                   	push   %edi
+ b59:	56                   	push   %esi
+ b5a:	53                   	push   %ebx
+ b5b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ b5e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b68:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b6a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b6c:	39 ca                	cmp    %ecx,%edx
+ b6e:	73 30                	jae    ba0 <free+0x50>
+ b70:	39 c1                	cmp    %eax,%ecx
+ b72:	72 04                	jb     b78 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b74:	39 c2                	cmp    %eax,%edx
+ b76:	72 f0                	jb     b68 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b78:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ b7b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ b7e:	39 f8                	cmp    %edi,%eax
+ b80:	74 2e                	je     bb0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b82:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ b85:	8b 42 04             	mov    0x4(%edx),%eax
+ b88:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b8b:	39 f1                	cmp    %esi,%ecx
+ b8d:	74 38                	je     bc7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b8f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b91:	5b                   	pop    %ebx
+  freep = p;
+ b92:	89 15 80 13 00 00    	mov    %edx,0x1380
+}
+ b98:	5e                   	pop    %esi
+ b99:	5f                   	pop    %edi
+ b9a:	5d                   	pop    %ebp
+ b9b:	c3                   	ret
+ b9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ba0:	39 c1                	cmp    %eax,%ecx
+ ba2:	72 d0                	jb     b74 <free+0x24>
+ ba4:	eb c2                	jmp    b68 <free+0x18>
+ ba6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ bb0:	03 70 04             	add    0x4(%eax),%esi
+ bb3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ bb6:	8b 02                	mov    (%edx),%eax
+ bb8:	8b 00                	mov    (%eax),%eax
+ bba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ bbd:	8b 42 04             	mov    0x4(%edx),%eax
+ bc0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ bc3:	39 f1                	cmp    %esi,%ecx
+ bc5:	75 c8                	jne    b8f <free+0x3f>
+    p->s.size += bp->s.size;
+ bc7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ bca:	89 15 80 13 00 00    	mov    %edx,0x1380
+    p->s.size += bp->s.size;
+ bd0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ bd3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ bd6:	89 0a                	mov    %ecx,(%edx)
+}
+ bd8:	5b                   	pop    %ebx
+ bd9:	5e                   	pop    %esi
+ bda:	5f                   	pop    %edi
+ bdb:	5d                   	pop    %ebp
+ bdc:	c3                   	ret
+ bdd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000be0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ be0:	55                   	push   %ebp
+ be1:	89 e5                	mov    %esp,%ebp
+ be3:	57                   	push   %edi
+ be4:	56                   	push   %esi
+ be5:	53                   	push   %ebx
+ be6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ be9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ bec:	8b 15 80 13 00 00    	mov    0x1380,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bf2:	8d 78 07             	lea    0x7(%eax),%edi
+ bf5:	c1 ef 03             	shr    $0x3,%edi
+ bf8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ bfb:	85 d2                	test   %edx,%edx
+ bfd:	0f 84 8d 00 00 00    	je     c90 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c03:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c05:	8b 48 04             	mov    0x4(%eax),%ecx
+ c08:	39 f9                	cmp    %edi,%ecx
+ c0a:	73 64                	jae    c70 <malloc+0x90>
+  if(nu < 4096)
+ c0c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ c11:	39 df                	cmp    %ebx,%edi
+ c13:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ c16:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ c1d:	eb 0a                	jmp    c29 <malloc+0x49>
+ c1f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c20:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c22:	8b 48 04             	mov    0x4(%eax),%ecx
+ c25:	39 f9                	cmp    %edi,%ecx
+ c27:	73 47                	jae    c70 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ c29:	89 c2                	mov    %eax,%edx
+ c2b:	39 05 80 13 00 00    	cmp    %eax,0x1380
+ c31:	75 ed                	jne    c20 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ c33:	83 ec 0c             	sub    $0xc,%esp
+ c36:	56                   	push   %esi
+ c37:	e8 9b fb ff ff       	call   7d7 <sbrk>
+  if(p == (char*)-1)
+ c3c:	83 c4 10             	add    $0x10,%esp
+ c3f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c42:	74 1c                	je     c60 <malloc+0x80>
+  hp->s.size = nu;
+ c44:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ c47:	83 ec 0c             	sub    $0xc,%esp
+ c4a:	83 c0 08             	add    $0x8,%eax
+ c4d:	50                   	push   %eax
+ c4e:	e8 fd fe ff ff       	call   b50 <free>
+  return freep;
+ c53:	8b 15 80 13 00 00    	mov    0x1380,%edx
+      if((p = morecore(nunits)) == 0)
+ c59:	83 c4 10             	add    $0x10,%esp
+ c5c:	85 d2                	test   %edx,%edx
+ c5e:	75 c0                	jne    c20 <malloc+0x40>
+        return 0;
+  }
+}
+ c60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ c63:	31 c0                	xor    %eax,%eax
+}
+ c65:	5b                   	pop    %ebx
+ c66:	5e                   	pop    %esi
+ c67:	5f                   	pop    %edi
+ c68:	5d                   	pop    %ebp
+ c69:	c3                   	ret
+ c6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ c70:	39 cf                	cmp    %ecx,%edi
+ c72:	74 4c                	je     cc0 <malloc+0xe0>
+        p->s.size -= nunits;
+ c74:	29 f9                	sub    %edi,%ecx
+ c76:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ c79:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ c7c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ c7f:	89 15 80 13 00 00    	mov    %edx,0x1380
+}
+ c85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ c88:	83 c0 08             	add    $0x8,%eax
+}
+ c8b:	5b                   	pop    %ebx
+ c8c:	5e                   	pop    %esi
+ c8d:	5f                   	pop    %edi
+ c8e:	5d                   	pop    %ebp
+ c8f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ c90:	c7 05 80 13 00 00 84 	movl   $0x1384,0x1380
+ c97:	13 00 00 
+    base.s.size = 0;
+ c9a:	b8 84 13 00 00       	mov    $0x1384,%eax
+    base.s.ptr = freep = prevp = &base;
+ c9f:	c7 05 84 13 00 00 84 	movl   $0x1384,0x1384
+ ca6:	13 00 00 
+    base.s.size = 0;
+ ca9:	c7 05 88 13 00 00 00 	movl   $0x0,0x1388
+ cb0:	00 00 00 
+    if(p->s.size >= nunits){
+ cb3:	e9 54 ff ff ff       	jmp    c0c <malloc+0x2c>
+ cb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cbf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ cc0:	8b 08                	mov    (%eax),%ecx
+ cc2:	89 0a                	mov    %ecx,(%edx)
+ cc4:	eb b9                	jmp    c7f <malloc+0x9f>
@@ -0,0 +1,95 @@
+// Test sched_setaffinity(): a pinned process stays on its CPU,
+// and compare how often CPU-bound children migrate with and
+// without pinning.
+// usage: affinitytest [nchildren]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "cpustat.h"
+
+#define NCHILD 8
+
+struct cpustat st[NCPU];
+
+void
+fail(char *msg)
+{
+  printf(1, "affinitytest: %s\n", msg);
+  exit();
+}
+
+// Run on each CPU in turn, checking that we stay there.
+void
+pinning(int ncpu)
+{
+  int i, j;
+
+  for(i = 0; i < ncpu; i++){
+    if(sched_setaffinity(0, 1 << i) < 0)
+      fail("sched_setaffinity");
+    if(sched_getaffinity(0) != 1 << i)
+      fail("sched_getaffinity");
+    for(j = 0; j < 200; j++){
+      if(getcpu() != i)
+        fail("ran on a CPU outside the mask");
+      if(j % 50 == 0)
+        sleep(1);
+    }
+  }
+  if(sched_setaffinity(0, 0) != -1)
+    fail("empty mask accepted");
+  if(sched_setaffinity(0, (1 << ncpu) - 1) < 0)
+    fail("sched_setaffinity all");
+}
+
+// n CPU-bound children, each pinned to one CPU if pin is set;
+// print how often they changed CPUs in total.
+void
+spin(int ncpu, int n, int pin)
+{
+  int pids[NCHILD], i, total, m;
+
+  for(i = 0; i < n; i++){
+    if((pids[i] = fork()) == 0){
+      if(pin)
+        sched_setaffinity(0, 1 << (i % ncpu));
+      for(;;)
+        ;
+    }
+  }
+  sleep(100);
+  total = 0;
+  for(i = 0; i < n; i++)
+    if((m = migrations(pids[i])) > 0)
+      total += m;
+  for(i = 0; i < n; i++){
+    kill(pids[i]);
+    wait();
+  }
+  printf(1, "%s: %d children, %d migrations in 1s\n",
+         pin ? "pinned" : "unpinned", n, total);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int ncpu, n;
+
+  if((ncpu = cpustat(st, NCPU)) < 1)
+    fail("cpustat");
+  n = ncpu + 1;
+  if(argc > 1)
+    n = atoi(argv[1]);
+  if(n < 1)
+    n = 1;
+  if(n > NCHILD)
+    n = NCHILD;
+
+  pinning(ncpu);
+  spin(ncpu, n, 0);
+  spin(ncpu, n, 1);
+  printf(1, "affinitytest ok\n");
+  exit();
+}
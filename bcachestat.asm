@@ -0,0 +1,1670 @@
+
+_bcachestat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "bcachestat.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  struct bcachestat st0, st1;
+  uint hit, miss;
+  int pid;
+
+  memset(&st0, 0, sizeof(st0));
+  10:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+{
+  13:	51                   	push   %ecx
+  14:	83 ec 3c             	sub    $0x3c,%esp
+  17:	8b 31                	mov    (%ecx),%esi
+  19:	8b 79 04             	mov    0x4(%ecx),%edi
+  memset(&st0, 0, sizeof(st0));
+  1c:	6a 14                	push   $0x14
+  1e:	6a 00                	push   $0x0
+  20:	53                   	push   %ebx
+  21:	e8 ca 01 00 00       	call   1f0 <memset>
+  if(argc > 1){
+  26:	83 c4 10             	add    $0x10,%esp
+  29:	83 fe 01             	cmp    $0x1,%esi
+  2c:	7e 1f                	jle    4d <main+0x4d>
+    bcachestat(&st0);
+  2e:	83 ec 0c             	sub    $0xc,%esp
+  31:	53                   	push   %ebx
+  32:	e8 e3 06 00 00       	call   71a <bcachestat>
+    if((pid = fork()) == 0){
+  37:	e8 05 05 00 00       	call   541 <fork>
+  3c:	83 c4 10             	add    $0x10,%esp
+  3f:	85 c0                	test   %eax,%eax
+  41:	0f 84 87 00 00 00    	je     ce <main+0xce>
+      exec(argv[1], argv+1);
+      printf(2, "bcachestat: exec %s failed\n", argv[1]);
+      exit();
+    }
+    if(pid > 0)
+  47:	0f 8f a6 00 00 00    	jg     f3 <main+0xf3>
+      wait();
+  }
+  if(bcachestat(&st1) < 0){
+  4d:	83 ec 0c             	sub    $0xc,%esp
+  50:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  53:	50                   	push   %eax
+  54:	e8 c1 06 00 00       	call   71a <bcachestat>
+  59:	83 c4 10             	add    $0x10,%esp
+  5c:	85 c0                	test   %eax,%eax
+  5e:	78 5b                	js     bb <main+0xbb>
+  }
+
+  hit = st1.nhit - st0.nhit;
+  miss = st1.nmiss - st0.nmiss;
+  printf(1, "%d buffers (%d KB), %d hits, %d misses", st1.nbuf,
+         st1.nbuf * BSIZE / 1024, hit, miss);
+  60:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  hit = st1.nhit - st0.nhit;
+  63:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  miss = st1.nmiss - st0.nmiss;
+  66:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  hit = st1.nhit - st0.nhit;
+  69:	2b 75 c4             	sub    -0x3c(%ebp),%esi
+         st1.nbuf * BSIZE / 1024, hit, miss);
+  6c:	89 d0                	mov    %edx,%eax
+  miss = st1.nmiss - st0.nmiss;
+  6e:	2b 5d c8             	sub    -0x38(%ebp),%ebx
+  printf(1, "%d buffers (%d KB), %d hits, %d misses", st1.nbuf,
+  71:	51                   	push   %ecx
+         st1.nbuf * BSIZE / 1024, hit, miss);
+  72:	c1 e0 09             	shl    $0x9,%eax
+  printf(1, "%d buffers (%d KB), %d hits, %d misses", st1.nbuf,
+  75:	51                   	push   %ecx
+  76:	c1 e8 0a             	shr    $0xa,%eax
+  79:	53                   	push   %ebx
+  7a:	56                   	push   %esi
+  7b:	50                   	push   %eax
+  7c:	52                   	push   %edx
+  7d:	68 34 0b 00 00       	push   $0xb34
+  82:	6a 01                	push   $0x1
+  84:	e8 47 07 00 00       	call   7d0 <printf>
+  // Without 64-bit division, and without overflowing 32 bits.
+  if(hit + miss >= 100)
+  89:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  8c:	83 c4 20             	add    $0x20,%esp
+  8f:	83 f9 63             	cmp    $0x63,%ecx
+  92:	77 69                	ja     fd <main+0xfd>
+    printf(1, " (%d%% hit)", hit / ((hit + miss + 99) / 100));
+  else if(hit + miss > 0)
+  94:	85 c9                	test   %ecx,%ecx
+  96:	0f 85 8d 00 00 00    	jne    129 <main+0x129>
+    printf(1, " (%d%% hit)", hit * 100 / (hit + miss));
+  printf(1, ", %d pages added, %d given back\n",
+  9c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  9f:	2b 45 d0             	sub    -0x30(%ebp),%eax
+  a2:	50                   	push   %eax
+  a3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  a6:	2b 45 cc             	sub    -0x34(%ebp),%eax
+  a9:	50                   	push   %eax
+  aa:	68 5c 0b 00 00       	push   $0xb5c
+  af:	6a 01                	push   $0x1
+  b1:	e8 1a 07 00 00       	call   7d0 <printf>
+         st1.ngrow - st0.ngrow, st1.nshrink - st0.nshrink);
+  exit();
+  b6:	e8 91 04 00 00       	call   54c <exit>
+    printf(2, "bcachestat: failed\n");
+  bb:	53                   	push   %ebx
+  bc:	53                   	push   %ebx
+  bd:	68 14 0b 00 00       	push   $0xb14
+  c2:	6a 02                	push   $0x2
+  c4:	e8 07 07 00 00       	call   7d0 <printf>
+    exit();
+  c9:	e8 7e 04 00 00       	call   54c <exit>
+      exec(argv[1], argv+1);
+  ce:	8d 47 04             	lea    0x4(%edi),%eax
+  d1:	56                   	push   %esi
+  d2:	56                   	push   %esi
+  d3:	50                   	push   %eax
+  d4:	ff 77 04             	push   0x4(%edi)
+  d7:	e8 bd 04 00 00       	call   599 <exec>
+      printf(2, "bcachestat: exec %s failed\n", argv[1]);
+  dc:	83 c4 0c             	add    $0xc,%esp
+  df:	ff 77 04             	push   0x4(%edi)
+  e2:	68 f8 0a 00 00       	push   $0xaf8
+  e7:	6a 02                	push   $0x2
+  e9:	e8 e2 06 00 00       	call   7d0 <printf>
+      exit();
+  ee:	e8 59 04 00 00       	call   54c <exit>
+      wait();
+  f3:	e8 5f 04 00 00       	call   557 <wait>
+  f8:	e9 50 ff ff ff       	jmp    4d <main+0x4d>
+    printf(1, " (%d%% hit)", hit / ((hit + miss + 99) / 100));
+  fd:	83 c1 63             	add    $0x63,%ecx
+ 100:	bb 64 00 00 00       	mov    $0x64,%ebx
+ 105:	52                   	push   %edx
+ 106:	31 d2                	xor    %edx,%edx
+ 108:	89 c8                	mov    %ecx,%eax
+ 10a:	f7 f3                	div    %ebx
+ 10c:	89 c1                	mov    %eax,%ecx
+ 10e:	89 f0                	mov    %esi,%eax
+    printf(1, " (%d%% hit)", hit * 100 / (hit + miss));
+ 110:	31 d2                	xor    %edx,%edx
+ 112:	f7 f1                	div    %ecx
+ 114:	50                   	push   %eax
+ 115:	68 28 0b 00 00       	push   $0xb28
+ 11a:	6a 01                	push   $0x1
+ 11c:	e8 af 06 00 00       	call   7d0 <printf>
+ 121:	83 c4 10             	add    $0x10,%esp
+ 124:	e9 73 ff ff ff       	jmp    9c <main+0x9c>
+ 129:	50                   	push   %eax
+ 12a:	6b c6 64             	imul   $0x64,%esi,%eax
+ 12d:	eb e1                	jmp    110 <main+0x110>
+ 12f:	90                   	nop
+
+00000130 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 130:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 131:	31 c0                	xor    %eax,%eax
+{
+ 133:	89 e5                	mov    %esp,%ebp
+ 135:	53                   	push   %ebx
+ 136:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 139:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 140:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 144:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 147:	83 c0 01             	add    $0x1,%eax
+ 14a:	84 d2                	test   %dl,%dl
+ 14c:	75 f2                	jne    140 <strcpy+0x10>
+    ;
+  return os;
+}
+ 14e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 151:	89 c8                	mov    %ecx,%eax
+ 153:	c9                   	leave
+ 154:	c3                   	ret
+ 155:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000160 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	53                   	push   %ebx
+ 164:	8b 55 08             	mov    0x8(%ebp),%edx
+ 167:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 16a:	0f b6 02             	movzbl (%edx),%eax
+ 16d:	84 c0                	test   %al,%al
+ 16f:	75 17                	jne    188 <strcmp+0x28>
+ 171:	eb 3a                	jmp    1ad <strcmp+0x4d>
+ 173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 177:	90                   	nop
+ 178:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 17c:	83 c2 01             	add    $0x1,%edx
+ 17f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 182:	84 c0                	test   %al,%al
+ 184:	74 1a                	je     1a0 <strcmp+0x40>
+    p++, q++;
+ 186:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 188:	0f b6 19             	movzbl (%ecx),%ebx
+ 18b:	38 c3                	cmp    %al,%bl
+ 18d:	74 e9                	je     178 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 18f:	29 d8                	sub    %ebx,%eax
+}
+ 191:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 194:	c9                   	leave
+ 195:	c3                   	ret
+ 196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1a4:	31 c0                	xor    %eax,%eax
+ 1a6:	29 d8                	sub    %ebx,%eax
+}
+ 1a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1ab:	c9                   	leave
+ 1ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1ad:	0f b6 19             	movzbl (%ecx),%ebx
+ 1b0:	31 c0                	xor    %eax,%eax
+ 1b2:	eb db                	jmp    18f <strcmp+0x2f>
+ 1b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1bf:	90                   	nop
+
+000001c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1c6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1c9:	74 15                	je     1e0 <strlen+0x20>
+ 1cb:	31 c0                	xor    %eax,%eax
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1d0:	83 c0 01             	add    $0x1,%eax
+ 1d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1d7:	89 c1                	mov    %eax,%ecx
+ 1d9:	75 f5                	jne    1d0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1db:	89 c8                	mov    %ecx,%eax
+ 1dd:	5d                   	pop    %ebp
+ 1de:	c3                   	ret
+ 1df:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1e0:	31 c9                	xor    %ecx,%ecx
+}
+ 1e2:	5d                   	pop    %ebp
+ 1e3:	89 c8                	mov    %ecx,%eax
+ 1e5:	c3                   	ret
+ 1e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+ 1f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1fd:	89 d7                	mov    %edx,%edi
+ 1ff:	fc                   	cld
+ 200:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 202:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 205:	89 d0                	mov    %edx,%eax
+ 207:	c9                   	leave
+ 208:	c3                   	ret
+ 209:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000210 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	8b 45 08             	mov    0x8(%ebp),%eax
+ 216:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 21a:	0f b6 10             	movzbl (%eax),%edx
+ 21d:	84 d2                	test   %dl,%dl
+ 21f:	75 12                	jne    233 <strchr+0x23>
+ 221:	eb 1d                	jmp    240 <strchr+0x30>
+ 223:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 227:	90                   	nop
+ 228:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 22c:	83 c0 01             	add    $0x1,%eax
+ 22f:	84 d2                	test   %dl,%dl
+ 231:	74 0d                	je     240 <strchr+0x30>
+    if(*s == c)
+ 233:	38 d1                	cmp    %dl,%cl
+ 235:	75 f1                	jne    228 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 237:	5d                   	pop    %ebp
+ 238:	c3                   	ret
+ 239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 240:	31 c0                	xor    %eax,%eax
+}
+ 242:	5d                   	pop    %ebp
+ 243:	c3                   	ret
+ 244:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 24f:	90                   	nop
+
+00000250 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	57                   	push   %edi
+ 254:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 255:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 258:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 259:	31 db                	xor    %ebx,%ebx
+{
+ 25b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 25e:	eb 27                	jmp    287 <gets+0x37>
+    cc = read(0, &c, 1);
+ 260:	83 ec 04             	sub    $0x4,%esp
+ 263:	6a 01                	push   $0x1
+ 265:	56                   	push   %esi
+ 266:	6a 00                	push   $0x0
+ 268:	e8 00 03 00 00       	call   56d <read>
+    if(cc < 1)
+ 26d:	83 c4 10             	add    $0x10,%esp
+ 270:	85 c0                	test   %eax,%eax
+ 272:	7e 1d                	jle    291 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 274:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 278:	8b 55 08             	mov    0x8(%ebp),%edx
+ 27b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 27f:	3c 0a                	cmp    $0xa,%al
+ 281:	74 10                	je     293 <gets+0x43>
+ 283:	3c 0d                	cmp    $0xd,%al
+ 285:	74 0c                	je     293 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 287:	89 df                	mov    %ebx,%edi
+ 289:	83 c3 01             	add    $0x1,%ebx
+ 28c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 28f:	7c cf                	jl     260 <gets+0x10>
+ 291:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 293:	8b 45 08             	mov    0x8(%ebp),%eax
+ 296:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 29a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 29d:	5b                   	pop    %ebx
+ 29e:	5e                   	pop    %esi
+ 29f:	5f                   	pop    %edi
+ 2a0:	5d                   	pop    %ebp
+ 2a1:	c3                   	ret
+ 2a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	56                   	push   %esi
+ 2b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2b5:	83 ec 08             	sub    $0x8,%esp
+ 2b8:	6a 00                	push   $0x0
+ 2ba:	ff 75 08             	push   0x8(%ebp)
+ 2bd:	e8 e2 02 00 00       	call   5a4 <open>
+  if(fd < 0)
+ 2c2:	83 c4 10             	add    $0x10,%esp
+ 2c5:	85 c0                	test   %eax,%eax
+ 2c7:	78 27                	js     2f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2c9:	83 ec 08             	sub    $0x8,%esp
+ 2cc:	ff 75 0c             	push   0xc(%ebp)
+ 2cf:	89 c3                	mov    %eax,%ebx
+ 2d1:	50                   	push   %eax
+ 2d2:	e8 ee 02 00 00       	call   5c5 <fstat>
+  close(fd);
+ 2d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2dc:	e8 a2 02 00 00       	call   583 <close>
+  return r;
+ 2e1:	83 c4 10             	add    $0x10,%esp
+}
+ 2e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2e7:	89 f0                	mov    %esi,%eax
+ 2e9:	5b                   	pop    %ebx
+ 2ea:	5e                   	pop    %esi
+ 2eb:	5d                   	pop    %ebp
+ 2ec:	c3                   	ret
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2f5:	eb ed                	jmp    2e4 <stat+0x34>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+
+00000300 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	53                   	push   %ebx
+ 304:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 307:	0f be 02             	movsbl (%edx),%eax
+ 30a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 30d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 310:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 315:	77 1e                	ja     335 <atoi+0x35>
+ 317:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 320:	83 c2 01             	add    $0x1,%edx
+ 323:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 326:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 32a:	0f be 02             	movsbl (%edx),%eax
+ 32d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 330:	80 fb 09             	cmp    $0x9,%bl
+ 333:	76 eb                	jbe    320 <atoi+0x20>
+  return n;
+}
+ 335:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 338:	89 c8                	mov    %ecx,%eax
+ 33a:	c9                   	leave
+ 33b:	c3                   	ret
+ 33c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000340 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+ 345:	8b 45 10             	mov    0x10(%ebp),%eax
+ 348:	8b 55 08             	mov    0x8(%ebp),%edx
+ 34b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 34e:	85 c0                	test   %eax,%eax
+ 350:	7e 13                	jle    365 <memmove+0x25>
+ 352:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 354:	89 d7                	mov    %edx,%edi
+ 356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 360:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 361:	39 f8                	cmp    %edi,%eax
+ 363:	75 fb                	jne    360 <memmove+0x20>
+  return vdst;
+}
+ 365:	5e                   	pop    %esi
+ 366:	89 d0                	mov    %edx,%eax
+ 368:	5f                   	pop    %edi
+ 369:	5d                   	pop    %ebp
+ 36a:	c3                   	ret
+ 36b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 36f:	90                   	nop
+
+00000370 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 370:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 375:	85 c0                	test   %eax,%eax
+ 377:	74 07                	je     380 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 379:	c3                   	ret
+ 37a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 380:	e9 77 02 00 00       	jmp    5fc <sysgetpid>
+ 385:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 390:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 395:	c3                   	ret
+ 396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003a0 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 3a0:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 3a1:	31 d2                	xor    %edx,%edx
+ 3a3:	89 e5                	mov    %esp,%ebp
+ 3a5:	53                   	push   %ebx
+ 3a6:	83 ec 04             	sub    $0x4,%esp
+ 3a9:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 3ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 3af:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 3b2:	85 c9                	test   %ecx,%ecx
+ 3b4:	7e 08                	jle    3be <cyclereport+0x1e>
+ 3b6:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 3b8:	89 d8                	mov    %ebx,%eax
+ 3ba:	f7 f1                	div    %ecx
+ 3bc:	89 c2                	mov    %eax,%edx
+ 3be:	83 ec 08             	sub    $0x8,%esp
+ 3c1:	52                   	push   %edx
+ 3c2:	ff 75 0c             	push   0xc(%ebp)
+ 3c5:	51                   	push   %ecx
+ 3c6:	ff 75 08             	push   0x8(%ebp)
+ 3c9:	68 7d 0b 00 00       	push   $0xb7d
+ 3ce:	6a 01                	push   $0x1
+ 3d0:	e8 fb 03 00 00       	call   7d0 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 3d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3d8:	83 c4 20             	add    $0x20,%esp
+ 3db:	c9                   	leave
+ 3dc:	c3                   	ret
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003e0 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 3e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3ec:	5d                   	pop    %ebp
+ 3ed:	c3                   	ret
+ 3ee:	66 90                	xchg   %ax,%ax
+
+000003f0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 3f0:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 3f1:	31 c0                	xor    %eax,%eax
+ 3f3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 3f8:	89 e5                	mov    %esp,%ebp
+ 3fa:	56                   	push   %esi
+ 3fb:	53                   	push   %ebx
+ 3fc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 3ff:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 403:	85 c0                	test   %eax,%eax
+ 405:	74 30                	je     437 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 407:	83 f8 02             	cmp    $0x2,%eax
+ 40a:	74 0c                	je     418 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 40c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 411:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 414:	85 c0                	test   %eax,%eax
+ 416:	74 1f                	je     437 <mutex_lock+0x47>
+ 418:	be 02 00 00 00       	mov    $0x2,%esi
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 420:	83 ec 08             	sub    $0x8,%esp
+ 423:	6a 02                	push   $0x2
+ 425:	53                   	push   %ebx
+ 426:	e8 8c 02 00 00       	call   6b7 <futex_wait>
+ 42b:	89 f0                	mov    %esi,%eax
+ 42d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 430:	83 c4 10             	add    $0x10,%esp
+ 433:	85 c0                	test   %eax,%eax
+ 435:	75 e9                	jne    420 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 437:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 43a:	5b                   	pop    %ebx
+ 43b:	5e                   	pop    %esi
+ 43c:	5d                   	pop    %ebp
+ 43d:	c3                   	ret
+ 43e:	66 90                	xchg   %ax,%ax
+
+00000440 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	83 ec 08             	sub    $0x8,%esp
+ 446:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 449:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 44d:	75 09                	jne    458 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 44f:	c9                   	leave
+ 450:	c3                   	ret
+ 451:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 458:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 45b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 461:	6a 01                	push   $0x1
+ 463:	50                   	push   %eax
+ 464:	e8 59 02 00 00       	call   6c2 <futex_wake>
+ 469:	83 c4 10             	add    $0x10,%esp
+}
+ 46c:	c9                   	leave
+ 46d:	c3                   	ret
+ 46e:	66 90                	xchg   %ax,%ax
+
+00000470 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 473:	8b 45 08             	mov    0x8(%ebp),%eax
+ 476:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 47c:	5d                   	pop    %ebp
+ 47d:	c3                   	ret
+ 47e:	66 90                	xchg   %ax,%ax
+
+00000480 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	56                   	push   %esi
+ 485:	53                   	push   %ebx
+ 486:	83 ec 0c             	sub    $0xc,%esp
+ 489:	8b 75 08             	mov    0x8(%ebp),%esi
+ 48c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 48f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 491:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 495:	75 21                	jne    4b8 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 497:	83 ec 08             	sub    $0x8,%esp
+ 49a:	57                   	push   %edi
+ 49b:	56                   	push   %esi
+ 49c:	e8 16 02 00 00       	call   6b7 <futex_wait>
+  mutex_lock(m);
+ 4a1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 4a4:	83 c4 10             	add    $0x10,%esp
+}
+ 4a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4aa:	5b                   	pop    %ebx
+ 4ab:	5e                   	pop    %esi
+ 4ac:	5f                   	pop    %edi
+ 4ad:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 4ae:	e9 3d ff ff ff       	jmp    3f0 <mutex_lock>
+ 4b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4b7:	90                   	nop
+    futex_wake(&m->v, 1);
+ 4b8:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 4bb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 4c1:	6a 01                	push   $0x1
+ 4c3:	53                   	push   %ebx
+ 4c4:	e8 f9 01 00 00       	call   6c2 <futex_wake>
+ 4c9:	83 c4 10             	add    $0x10,%esp
+ 4cc:	eb c9                	jmp    497 <cond_wait+0x17>
+ 4ce:	66 90                	xchg   %ax,%ax
+
+000004d0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	83 ec 10             	sub    $0x10,%esp
+ 4d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 4d9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 4dd:	6a 01                	push   $0x1
+ 4df:	50                   	push   %eax
+ 4e0:	e8 dd 01 00 00       	call   6c2 <futex_wake>
+}
+ 4e5:	83 c4 10             	add    $0x10,%esp
+ 4e8:	c9                   	leave
+ 4e9:	c3                   	ret
+ 4ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004f0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	83 ec 10             	sub    $0x10,%esp
+ 4f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 4f9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 4fd:	68 ff ff ff 7f       	push   $0x7fffffff
+ 502:	50                   	push   %eax
+ 503:	e8 ba 01 00 00       	call   6c2 <futex_wake>
+}
+ 508:	83 c4 10             	add    $0x10,%esp
+ 50b:	c9                   	leave
+ 50c:	c3                   	ret
+
+0000050d <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 50d:	50                   	push   %eax
+  pushl %ebx
+ 50e:	53                   	push   %ebx
+  movl $1, %eax
+ 50f:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 514:	0f a2                	cpuid
+  popl %ebx
+ 516:	5b                   	pop    %ebx
+  popl %eax
+ 517:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 518:	c7 05 f0 0f 00 00 3e 	movl   $0x53e,0xff0
+ 51f:	05 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 522:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 528:	74 14                	je     53e <sysint>
+  movl $sysfast, syscallvec
+ 52a:	c7 05 f0 0f 00 00 34 	movl   $0x534,0xff0
+ 531:	05 00 00 
+
+00000534 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 534:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 536:	ba 3d 05 00 00       	mov    $0x53d,%edx
+  sysenter
+ 53b:	0f 34                	sysenter
+1:
+  ret
+ 53d:	c3                   	ret
+
+0000053e <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 53e:	cd 40                	int    $0x40
+  ret
+ 540:	c3                   	ret
+
+00000541 <fork>:
+
+SYSCALL(fork)
+ 541:	b8 01 00 00 00       	mov    $0x1,%eax
+ 546:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+0000054c <exit>:
+SYSCALL(exit)
+ 54c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 551:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+00000557 <wait>:
+SYSCALL(wait)
+ 557:	b8 03 00 00 00       	mov    $0x3,%eax
+ 55c:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+00000562 <pipe>:
+SYSCALL(pipe)
+ 562:	b8 04 00 00 00       	mov    $0x4,%eax
+ 567:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+0000056d <read>:
+SYSCALL(read)
+ 56d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 572:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+00000578 <write>:
+SYSCALL(write)
+ 578:	b8 10 00 00 00       	mov    $0x10,%eax
+ 57d:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+00000583 <close>:
+SYSCALL(close)
+ 583:	b8 15 00 00 00       	mov    $0x15,%eax
+ 588:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+0000058e <kill>:
+SYSCALL(kill)
+ 58e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 593:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+00000599 <exec>:
+SYSCALL(exec)
+ 599:	b8 07 00 00 00       	mov    $0x7,%eax
+ 59e:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+000005a4 <open>:
+SYSCALL(open)
+ 5a4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5a9:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+000005af <mknod>:
+SYSCALL(mknod)
+ 5af:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5b4:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+000005ba <unlink>:
+SYSCALL(unlink)
+ 5ba:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5bf:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+000005c5 <fstat>:
+SYSCALL(fstat)
+ 5c5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5ca:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+000005d0 <link>:
+SYSCALL(link)
+ 5d0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5d5:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+000005db <mkdir>:
+SYSCALL(mkdir)
+ 5db:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5e0:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+000005e6 <chdir>:
+SYSCALL(chdir)
+ 5e6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5eb:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+000005f1 <dup>:
+SYSCALL(dup)
+ 5f1:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5f6:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+000005fc <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 5fc:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 601:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+00000607 <sbrk>:
+SYSCALL(sbrk)
+ 607:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 60c:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+00000612 <sleep>:
+SYSCALL(sleep)
+ 612:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 617:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+0000061d <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 61d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 622:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+00000628 <swapread>:
+SYSCALL(swapread)
+ 628:	b8 16 00 00 00       	mov    $0x16,%eax
+ 62d:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+00000633 <swapwrite>:
+SYSCALL(swapwrite)
+ 633:	b8 17 00 00 00       	mov    $0x17,%eax
+ 638:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+0000063e <swapstat>:
+SYSCALL(swapstat)
+ 63e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 643:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+00000649 <madvise>:
+SYSCALL(madvise)
+ 649:	b8 19 00 00 00       	mov    $0x19,%eax
+ 64e:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+00000654 <mlock>:
+SYSCALL(mlock)
+ 654:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 659:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+0000065f <munlock>:
+SYSCALL(munlock)
+ 65f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 664:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+0000066a <membench>:
+SYSCALL(membench)
+ 66a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 66f:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+00000675 <nice>:
+SYSCALL(nice)
+ 675:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 67a:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+00000680 <setpriority>:
+SYSCALL(setpriority)
+ 680:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 685:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+0000068b <usleep>:
+SYSCALL(usleep)
+ 68b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 690:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+00000696 <cpustat>:
+SYSCALL(cpustat)
+ 696:	b8 20 00 00 00       	mov    $0x20,%eax
+ 69b:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+000006a1 <clone>:
+SYSCALL(clone)
+ 6a1:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6a6:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+000006ac <join>:
+SYSCALL(join)
+ 6ac:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6b1:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+000006b7 <futex_wait>:
+SYSCALL(futex_wait)
+ 6b7:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6bc:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+000006c2 <futex_wake>:
+SYSCALL(futex_wake)
+ 6c2:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6c7:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+000006cd <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 6cd:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6d2:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+000006d8 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 6d8:	b8 26 00 00 00       	mov    $0x26,%eax
+ 6dd:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+000006e3 <getcpu>:
+SYSCALL(getcpu)
+ 6e3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 6e8:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+000006ee <migrations>:
+SYSCALL(migrations)
+ 6ee:	b8 28 00 00 00       	mov    $0x28,%eax
+ 6f3:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+000006f9 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 6f9:	b8 29 00 00 00       	mov    $0x29,%eax
+ 6fe:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+00000704 <lockstat>:
+SYSCALL(lockstat)
+ 704:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 709:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+0000070f <lockprof>:
+SYSCALL(lockprof)
+ 70f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 714:	ff 25 f0 0f 00 00    	jmp    *0xff0
+
+0000071a <bcachestat>:
+SYSCALL(bcachestat)
+ 71a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 71f:	ff 25 f0 0f 00 00    	jmp    *0xff0
+ 725:	66 90                	xchg   %ax,%ax
+ 727:	66 90                	xchg   %ax,%ax
+ 729:	66 90                	xchg   %ax,%ax
+ 72b:	66 90                	xchg   %ax,%ax
+ 72d:	66 90                	xchg   %ax,%ax
+ 72f:	90                   	nop
+
+00000730 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 730:	55                   	push   %ebp
+ 731:	89 e5                	mov    %esp,%ebp
+ 733:	57                   	push   %edi
+ 734:	56                   	push   %esi
+ 735:	53                   	push   %ebx
+ 736:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 738:	89 d1                	mov    %edx,%ecx
+{
+ 73a:	83 ec 3c             	sub    $0x3c,%esp
+ 73d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 740:	85 d2                	test   %edx,%edx
+ 742:	0f 89 80 00 00 00    	jns    7c8 <printint+0x98>
+ 748:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 74c:	74 7a                	je     7c8 <printint+0x98>
+    x = -xx;
+ 74e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 750:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 755:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 758:	31 f6                	xor    %esi,%esi
+ 75a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 760:	89 c8                	mov    %ecx,%eax
+ 762:	31 d2                	xor    %edx,%edx
+ 764:	89 f7                	mov    %esi,%edi
+ 766:	f7 f3                	div    %ebx
+ 768:	8d 76 01             	lea    0x1(%esi),%esi
+ 76b:	0f b6 92 f8 0b 00 00 	movzbl 0xbf8(%edx),%edx
+ 772:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 776:	89 ca                	mov    %ecx,%edx
+ 778:	89 c1                	mov    %eax,%ecx
+ 77a:	39 da                	cmp    %ebx,%edx
+ 77c:	73 e2                	jae    760 <printint+0x30>
+  if(neg)
+ 77e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 781:	85 c0                	test   %eax,%eax
+ 783:	74 07                	je     78c <printint+0x5c>
+    buf[i++] = '-';
+ 785:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 78a:	89 f7                	mov    %esi,%edi
+ 78c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 78f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 792:	01 df                	add    %ebx,%edi
+ 794:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 798:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 79b:	83 ec 04             	sub    $0x4,%esp
+ 79e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 7a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 7a4:	6a 01                	push   $0x1
+ 7a6:	50                   	push   %eax
+ 7a7:	56                   	push   %esi
+ 7a8:	e8 cb fd ff ff       	call   578 <write>
+  while(--i >= 0)
+ 7ad:	89 f8                	mov    %edi,%eax
+ 7af:	83 c4 10             	add    $0x10,%esp
+ 7b2:	83 ef 01             	sub    $0x1,%edi
+ 7b5:	39 d8                	cmp    %ebx,%eax
+ 7b7:	75 df                	jne    798 <printint+0x68>
+}
+ 7b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7bc:	5b                   	pop    %ebx
+ 7bd:	5e                   	pop    %esi
+ 7be:	5f                   	pop    %edi
+ 7bf:	5d                   	pop    %ebp
+ 7c0:	c3                   	ret
+ 7c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7c8:	31 c0                	xor    %eax,%eax
+ 7ca:	eb 89                	jmp    755 <printint+0x25>
+ 7cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7d0:	55                   	push   %ebp
+ 7d1:	89 e5                	mov    %esp,%ebp
+ 7d3:	57                   	push   %edi
+ 7d4:	56                   	push   %esi
+ 7d5:	53                   	push   %ebx
+ 7d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7df:	0f b6 1e             	movzbl (%esi),%ebx
+ 7e2:	83 c6 01             	add    $0x1,%esi
+ 7e5:	84 db                	test   %bl,%bl
+ 7e7:	74 67                	je     850 <printf+0x80>
+ 7e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7ec:	31 d2                	xor    %edx,%edx
+ 7ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 7f1:	eb 34                	jmp    827 <printf+0x57>
+ 7f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7f7:	90                   	nop
+ 7f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 7fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 800:	83 f8 25             	cmp    $0x25,%eax
+ 803:	74 18                	je     81d <printf+0x4d>
+  write(fd, &c, 1);
+ 805:	83 ec 04             	sub    $0x4,%esp
+ 808:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 80b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 80e:	6a 01                	push   $0x1
+ 810:	50                   	push   %eax
+ 811:	57                   	push   %edi
+ 812:	e8 61 fd ff ff       	call   578 <write>
+ 817:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 81a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 81d:	0f b6 1e             	movzbl (%esi),%ebx
+ 820:	83 c6 01             	add    $0x1,%esi
+ 823:	84 db                	test   %bl,%bl
+ 825:	74 29                	je     850 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 827:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 82a:	85 d2                	test   %edx,%edx
+ 82c:	74 ca                	je     7f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 82e:	83 fa 25             	cmp    $0x25,%edx
+ 831:	75 ea                	jne    81d <printf+0x4d>
+      if(c == 'd'){
+ 833:	83 f8 25             	cmp    $0x25,%eax
+ 836:	0f 84 24 01 00 00    	je     960 <printf+0x190>
+ 83c:	83 e8 63             	sub    $0x63,%eax
+ 83f:	83 f8 15             	cmp    $0x15,%eax
+ 842:	77 1c                	ja     860 <printf+0x90>
+ 844:	ff 24 85 a0 0b 00 00 	jmp    *0xba0(,%eax,4)
+ 84b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 84f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 850:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 853:	5b                   	pop    %ebx
+ 854:	5e                   	pop    %esi
+ 855:	5f                   	pop    %edi
+ 856:	5d                   	pop    %ebp
+ 857:	c3                   	ret
+ 858:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85f:	90                   	nop
+  write(fd, &c, 1);
+ 860:	83 ec 04             	sub    $0x4,%esp
+ 863:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 866:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 86a:	6a 01                	push   $0x1
+ 86c:	52                   	push   %edx
+ 86d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 870:	57                   	push   %edi
+ 871:	e8 02 fd ff ff       	call   578 <write>
+ 876:	83 c4 0c             	add    $0xc,%esp
+ 879:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 87c:	6a 01                	push   $0x1
+ 87e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 881:	52                   	push   %edx
+ 882:	57                   	push   %edi
+ 883:	e8 f0 fc ff ff       	call   578 <write>
+        putc(fd, c);
+ 888:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 88b:	31 d2                	xor    %edx,%edx
+ 88d:	eb 8e                	jmp    81d <printf+0x4d>
+ 88f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 890:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 893:	83 ec 0c             	sub    $0xc,%esp
+ 896:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 89b:	8b 13                	mov    (%ebx),%edx
+ 89d:	6a 00                	push   $0x0
+ 89f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 8a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 8a4:	e8 87 fe ff ff       	call   730 <printint>
+        ap++;
+ 8a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8af:	31 d2                	xor    %edx,%edx
+ 8b1:	e9 67 ff ff ff       	jmp    81d <printf+0x4d>
+ 8b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8c5:	83 c0 04             	add    $0x4,%eax
+ 8c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8cb:	85 db                	test   %ebx,%ebx
+ 8cd:	0f 84 9d 00 00 00    	je     970 <printf+0x1a0>
+        while(*s != 0){
+ 8d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8d8:	84 c0                	test   %al,%al
+ 8da:	0f 84 3d ff ff ff    	je     81d <printf+0x4d>
+ 8e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 8e6:	89 de                	mov    %ebx,%esi
+ 8e8:	89 d3                	mov    %edx,%ebx
+ 8ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 8f0:	83 ec 04             	sub    $0x4,%esp
+ 8f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 8f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 8f9:	6a 01                	push   $0x1
+ 8fb:	53                   	push   %ebx
+ 8fc:	57                   	push   %edi
+ 8fd:	e8 76 fc ff ff       	call   578 <write>
+        while(*s != 0){
+ 902:	0f b6 06             	movzbl (%esi),%eax
+ 905:	83 c4 10             	add    $0x10,%esp
+ 908:	84 c0                	test   %al,%al
+ 90a:	75 e4                	jne    8f0 <printf+0x120>
+      state = 0;
+ 90c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 90f:	31 d2                	xor    %edx,%edx
+ 911:	e9 07 ff ff ff       	jmp    81d <printf+0x4d>
+ 916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 920:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 923:	83 ec 0c             	sub    $0xc,%esp
+ 926:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 92b:	8b 13                	mov    (%ebx),%edx
+ 92d:	6a 01                	push   $0x1
+ 92f:	e9 6b ff ff ff       	jmp    89f <printf+0xcf>
+ 934:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 938:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 93b:	83 ec 04             	sub    $0x4,%esp
+ 93e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 941:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 943:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 946:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 949:	6a 01                	push   $0x1
+ 94b:	52                   	push   %edx
+ 94c:	57                   	push   %edi
+ 94d:	e8 26 fc ff ff       	call   578 <write>
+        ap++;
+ 952:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 955:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 958:	31 d2                	xor    %edx,%edx
+ 95a:	e9 be fe ff ff       	jmp    81d <printf+0x4d>
+ 95f:	90                   	nop
+  write(fd, &c, 1);
+ 960:	83 ec 04             	sub    $0x4,%esp
+ 963:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 966:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 969:	6a 01                	push   $0x1
+ 96b:	e9 11 ff ff ff       	jmp    881 <printf+0xb1>
+ 970:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 975:	bb 98 0b 00 00       	mov    $0xb98,%ebx
+ 97a:	e9 61 ff ff ff       	jmp    8e0 <printf+0x110>
+ 97f:	90                   	nop
+
+00000980 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 980:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 981:	a1 f4 0f 00 00       	mov    0xff4,%eax
+{
+ 986:	89 e5                	mov    %esp,%ebp
+ 988:	57                   	push   %edi
+ 989:	56                   	push   %esi
+ 98a:	53                   	push   %ebx
+ 98b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 98e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 991:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 998:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 99a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 99c:	39 ca                	cmp    %ecx,%edx
+ 99e:	73 30                	jae    9d0 <free+0x50>
+ 9a0:	39 c1                	cmp    %eax,%ecx
+ 9a2:	72 04                	jb     9a8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9a4:	39 c2                	cmp    %eax,%edx
+ 9a6:	72 f0                	jb     998 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9a8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 9ab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 9ae:	39 f8                	cmp    %edi,%eax
+ 9b0:	74 2e                	je     9e0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9b2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 9b5:	8b 42 04             	mov    0x4(%edx),%eax
+ 9b8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9bb:	39 f1                	cmp    %esi,%ecx
+ 9bd:	74 38                	je     9f7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 9bf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 9c1:	5b                   	pop    %ebx
+  freep = p;
+ 9c2:	89 15 f4 0f 00 00    	mov    %edx,0xff4
+}
+ 9c8:	5e                   	pop    %esi
+ 9c9:	5f                   	pop    %edi
+ 9ca:	5d                   	pop    %ebp
+ 9cb:	c3                   	ret
+ 9cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9d0:	39 c1                	cmp    %eax,%ecx
+ 9d2:	72 d0                	jb     9a4 <free+0x24>
+ 9d4:	eb c2                	jmp    998 <free+0x18>
+ 9d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 9e0:	03 70 04             	add    0x4(%eax),%esi
+ 9e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9e6:	8b 02                	mov    (%edx),%eax
+ 9e8:	8b 00                	mov    (%eax),%eax
+ 9ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 9ed:	8b 42 04             	mov    0x4(%edx),%eax
+ 9f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9f3:	39 f1                	cmp    %esi,%ecx
+ 9f5:	75 c8                	jne    9bf <free+0x3f>
+    p->s.size += bp->s.size;
+ 9f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 9fa:	89 15 f4 0f 00 00    	mov    %edx,0xff4
+    p->s.size += bp->s.size;
+ a00:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a03:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a06:	89 0a                	mov    %ecx,(%edx)
+}
+ a08:	5b                   	pop    %ebx
+ a09:	5e                   	pop    %esi
+ a0a:	5f                   	pop    %edi
+ a0b:	5d                   	pop    %ebp
+ a0c:	c3                   	ret
+ a0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a10 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a10:	55                   	push   %ebp
+ a11:	89 e5                	mov    %esp,%ebp
+ a13:	57                   	push   %edi
+ a14:	56                   	push   %esi
+ a15:	53                   	push   %ebx
+ a16:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a19:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a1c:	8b 15 f4 0f 00 00    	mov    0xff4,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a22:	8d 78 07             	lea    0x7(%eax),%edi
+ a25:	c1 ef 03             	shr    $0x3,%edi
+ a28:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a2b:	85 d2                	test   %edx,%edx
+ a2d:	0f 84 8d 00 00 00    	je     ac0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a33:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a35:	8b 48 04             	mov    0x4(%eax),%ecx
+ a38:	39 f9                	cmp    %edi,%ecx
+ a3a:	73 64                	jae    aa0 <malloc+0x90>
+  if(nu < 4096)
+ a3c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a41:	39 df                	cmp    %ebx,%edi
+ a43:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a46:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a4d:	eb 0a                	jmp    a59 <malloc+0x49>
+ a4f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a50:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a52:	8b 48 04             	mov    0x4(%eax),%ecx
+ a55:	39 f9                	cmp    %edi,%ecx
+ a57:	73 47                	jae    aa0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a59:	89 c2                	mov    %eax,%edx
+ a5b:	39 05 f4 0f 00 00    	cmp    %eax,0xff4
+ a61:	75 ed                	jne    a50 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a63:	83 ec 0c             	sub    $0xc,%esp
+ a66:	56                   	push   %esi
+ a67:	e8 9b fb ff ff       	call   607 <sbrk>
+  if(p == (char*)-1)
+ a6c:	83 c4 10             	add    $0x10,%esp
+ a6f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a72:	74 1c                	je     a90 <malloc+0x80>
+  hp->s.size = nu;
+ a74:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a77:	83 ec 0c             	sub    $0xc,%esp
+ a7a:	83 c0 08             	add    $0x8,%eax
+ a7d:	50                   	push   %eax
+ a7e:	e8 fd fe ff ff       	call   980 <free>
+  return freep;
+ a83:	8b 15 f4 0f 00 00    	mov    0xff4,%edx
+      if((p = morecore(nunits)) == 0)
+ a89:	83 c4 10             	add    $0x10,%esp
+ a8c:	85 d2                	test   %edx,%edx
+ a8e:	75 c0                	jne    a50 <malloc+0x40>
+        return 0;
+  }
+}
+ a90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a93:	31 c0                	xor    %eax,%eax
+}
+ a95:	5b                   	pop    %ebx
+ a96:	5e                   	pop    %esi
+ a97:	5f                   	pop    %edi
+ a98:	5d                   	pop    %ebp
+ a99:	c3                   	ret
+ a9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ aa0:	39 cf                	cmp    %ecx,%edi
+ aa2:	74 4c                	je     af0 <malloc+0xe0>
+        p->s.size -= nunits;
+ aa4:	29 f9                	sub    %edi,%ecx
+ aa6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ aa9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ aac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ aaf:	89 15 f4 0f 00 00    	mov    %edx,0xff4
+}
+ ab5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ ab8:	83 c0 08             	add    $0x8,%eax
+}
+ abb:	5b                   	pop    %ebx
+ abc:	5e                   	pop    %esi
+ abd:	5f                   	pop    %edi
+ abe:	5d                   	pop    %ebp
+ abf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ ac0:	c7 05 f4 0f 00 00 f8 	movl   $0xff8,0xff4
+ ac7:	0f 00 00 
+    base.s.size = 0;
+ aca:	b8 f8 0f 00 00       	mov    $0xff8,%eax
+    base.s.ptr = freep = prevp = &base;
+ acf:	c7 05 f8 0f 00 00 f8 	movl   $0xff8,0xff8
+ ad6:	0f 00 00 
+    base.s.size = 0;
+ ad9:	c7 05 fc 0f 00 00 00 	movl   $0x0,0xffc
+ ae0:	00 00 00 
+    if(p->s.size >= nunits){
+ ae3:	e9 54 ff ff ff       	jmp    a3c <malloc+0x2c>
+ ae8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ af0:	8b 08                	mov    (%eax),%ecx
+ af2:	89 0a                	mov    %ecx,(%edx)
+ af4:	eb b9                	jmp    aaf <malloc+0x9f>
@@ -0,0 +1,46 @@
+// Print buffer cache size and hit rate: since boot or, given
+// a command, while it ran.
+// usage: bcachestat [command [args...]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fs.h"
+#include "bcachestat.h"
+
+int
+main(int argc, char *argv[])
+{
+  struct bcachestat st0, st1;
+  uint hit, miss;
+  int pid;
+
+  memset(&st0, 0, sizeof(st0));
+  if(argc > 1){
+    bcachestat(&st0);
+    if((pid = fork()) == 0){
+      exec(argv[1], argv+1);
+      printf(2, "bcachestat: exec %s failed\n", argv[1]);
+      exit();
+    }
+    if(pid > 0)
+      wait();
+  }
+  if(bcachestat(&st1) < 0){
+    printf(2, "bcachestat: failed\n");
+    exit();
+  }
+
+  hit = st1.nhit - st0.nhit;
+  miss = st1.nmiss - st0.nmiss;
+  printf(1, "%d buffers (%d KB), %d hits, %d misses", st1.nbuf,
+         st1.nbuf * BSIZE / 1024, hit, miss);
+  // Without 64-bit division, and without overflowing 32 bits.
+  if(hit + miss >= 100)
+    printf(1, " (%d%% hit)", hit / ((hit + miss + 99) / 100));
+  else if(hit + miss > 0)
+    printf(1, " (%d%% hit)", hit * 100 / (hit + miss));
+  printf(1, ", %d pages added, %d given back\n",
+         st1.ngrow - st0.ngrow, st1.nshrink - st0.nshrink);
+  exit();
+}
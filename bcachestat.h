@@ -0,0 +1,8 @@
+// Buffer cache statistics, as returned by bcachestat().
+struct bcachestat {
+  uint nbuf;     // buffers in the cache now
+  uint nhit;     // lookups that found the block cached
+  uint nmiss;    // ... that did not
+  uint ngrow;    // pages added to the cache
+  uint nshrink;  // pages given back to reclaim
+};
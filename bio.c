@@ -1,6 +1,6 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
@@ -17,6 +17,23 @@
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+//
+// Buffers are hashed by dev and blockno, and each hash bucket
+// has its own lock, which protects the chain and the refcnt of
+// the buffers on it; so lookups of different blocks from
+// different CPUs seldom touch the same lock.  A buffer to
+// recycle is picked by a clock over all buffers, which skips
+// buffers used since the hand last passed them.  bcache.lock
+// serializes recycling, and only its holder takes two bucket
+// locks at once, so the bucket locks need no order.
+//
+// The cache is elastic.  Besides the NBUF static buffers, which
+// are always there for the log, it takes whole pages from
+// kalloc() and carves them into buffers whenever it would
+// otherwise recycle one and more than BCACHEFREE pages are free,
+// up to NBUFMAX buffers.  When memory runs out, reclaim() asks
+// bshrink() for a page of clean unused buffers before it swaps
+// out user pages.
 
 #include "types.h"
 #include "defs.h"
@@ -25,71 +42,289 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "mmu.h"
+#include "proc.h"
+#include "bcachestat.h"
 
-struct {
+#define BHASH(dev, blockno) (((dev) * 31 + (blockno)) % NBHASH)
+
+#define BPERPAGE ((PGSIZE - sizeof(struct bufpage*)) / sizeof(struct buf))
+
+struct bucket {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  struct buf *head;             // through hnext
+};
 
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
-  struct buf head;
+// A page of buffers taken from kalloc().
+struct bufpage {
+  struct bufpage *next;
+  struct buf buf[BPERPAGE];
+};
+
+struct {
+  struct spinlock lock;         // held while recycling a buffer,
+  struct buf buf[NBUF];         // and protects what follows bucket[]
+  struct bucket bucket[NBHASH];
+
+  // Ring of all buffers, through cnext and cprev, and the clock hand.
+  struct buf *hand;
+  struct buf *free;             // unhashed buffers, through hnext
+  struct bufpage *pages;
+  int nbuf;
+  uint ngrow;
+  uint nshrink;
 } bcache;
 
+// Hits and misses, per CPU, counted under a bucket lock.
+static struct {
+  uint nhit;
+  uint nmiss;
+} bcount[NCPU];
+
+// Put b in the clock ring, just behind the hand, and on the
+// free list.  Caller holds bcache.lock, or is binit().
+static void
+baddbuf(struct buf *b)
+{
+  initsleeplock(&b->lock, "buffer");
+  b->refcnt = 0;
+  b->used = 0;
+  b->bucket = 0;
+  if(bcache.hand == 0){
+    b->cnext = b->cprev = b;
+    bcache.hand = b;
+  } else {
+    b->cnext = bcache.hand;
+    b->cprev = bcache.hand->cprev;
+    b->cprev->cnext = b;
+    bcache.hand->cprev = b;
+  }
+  b->hnext = bcache.free;
+  bcache.free = b;
+  bcache.nbuf++;
+}
+
 void
 binit(void)
 {
   struct buf *b;
+  int i;
 
   initlock(&bcache.lock, "bcache");
+  for(i = 0; i < NBHASH; i++)
+    initlock(&bcache.bucket[i].lock, "bcache.bucket");
 
 //PAGEBREAK!
-  // Create linked list of buffers
-  bcache.head.prev = &bcache.head;
-  bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+  // Create the clock ring of buffers, none of them hashed.
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++)
+    baddbuf(b);
+}
+
+// Add a page of buffers, if memory is plentiful.
+// Caller holds bcache.lock.
+static void
+bgrow(void)
+{
+  struct bufpage *pg;
+  int i;
+
+  if(bcache.nbuf + BPERPAGE > NBUFMAX)
+    return;
+  if((pg = (struct bufpage*)kallocspare()) == 0)
+    return;
+  for(i = 0; i < BPERPAGE; i++)
+    baddbuf(&pg->buf[i]);
+  pg->next = bcache.pages;
+  bcache.pages = pg;
+  bcache.ngrow++;
+}
+
+// Take b, unreferenced, out of its hash bucket.  Caller holds
+// the bucket's lock.
+static void
+bunhash(struct buf *b)
+{
+  struct buf **pp;
+
+  for(pp = &b->bucket->head; *pp != b; pp = &(*pp)->hnext)
+    ;
+  *pp = b->hnext;
+  b->bucket = 0;
+}
+
+// Give one page of buffers back to the page allocator, if
+// some page has no buffer in use or dirty, preferring pages
+// with no buffer used since the clock last passed.
+// Returns 1 if a page was freed, 0 if not.
+int
+bshrink(void)
+{
+  struct bufpage *pg, **pgp;
+  struct buf *b, **bp;
+  struct bucket *bk;
+  int pass, i, ok;
+
+  acquire(&bcache.lock);
+  for(pass = 0; pass < 2; pass++){
+    for(pgp = &bcache.pages; (pg = *pgp) != 0; pgp = &pg->next){
+      if(pass == 0){
+        for(i = 0; i < BPERPAGE && !pg->buf[i].used; i++)
+          ;
+        if(i < BPERPAGE)
+          continue;
+      }
+
+      // Take the page's buffers off the free list, then out of
+      // their buckets, unless one of them is in use.
+      for(bp = &bcache.free; (b = *bp) != 0; ){
+        if(b >= pg->buf && b < pg->buf+BPERPAGE)
+          *bp = b->hnext;
+        else
+          bp = &b->hnext;
+      }
+      ok = 1;
+      for(i = 0; i < BPERPAGE && ok; i++){
+        b = &pg->buf[i];
+        if((bk = b->bucket) == 0)
+          continue;
+        acquire(&bk->lock);
+        if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0)
+          bunhash(b);
+        else
+          ok = 0;
+        release(&bk->lock);
+      }
+      if(!ok){
+        for(i = 0; i < BPERPAGE; i++){
+          b = &pg->buf[i];
+          if(b->bucket == 0){
+            b->hnext = bcache.free;
+            bcache.free = b;
+          }
+        }
+        continue;
+      }
+
+      for(i = 0; i < BPERPAGE; i++){
+        b = &pg->buf[i];
+        if(bcache.hand == b)
+          bcache.hand = b->cnext;
+        b->cprev->cnext = b->cnext;
+        b->cnext->cprev = b->cprev;
+      }
+      *pgp = pg->next;
+      bcache.nbuf -= BPERPAGE;
+      bcache.nshrink++;
+      release(&bcache.lock);
+      kfree((char*)pg);
+      return 1;
+    }
   }
+  release(&bcache.lock);
+  return 0;
 }
 
-// Look through buffer cache for block on device dev.
-// If not found, allocate a buffer.
-// In either case, return locked buffer.
+// Take a reference to the cached buffer for the block.
+// Caller holds bk->lock.  Returns 0 if it is not cached.
 static struct buf*
-bget(uint dev, uint blockno)
+blookup(struct bucket *bk, uint dev, uint blockno)
 {
   struct buf *b;
 
-  acquire(&bcache.lock);
-
-  // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+  for(b = bk->head; b; b = b->hnext){
     if(b->dev == dev && b->blockno == blockno){
       b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
+      b->used = 1;
+      bcount[cpuid()].nhit++;
       return b;
     }
   }
+  return 0;
+}
 
-  // Not cached; recycle an unused buffer.
-  // Even if refcnt==0, B_DIRTY indicates a buffer is in use
-  // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
+// Find an unused buffer and move it to bucket bk, for the block:
+// a free one, one from a new page, or the one the clock stops
+// at.  Caller holds bcache.lock and bk->lock.
+static struct buf*
+brecycle(struct bucket *bk, uint dev, uint blockno)
+{
+  struct buf *b;
+  struct bucket *vb;
+  int n;
+
+  if(bcache.free == 0)
+    bgrow();
+  if((b = bcache.free) != 0){
+    bcache.free = b->hnext;
+    goto found;
+  }
+
+  // Twice round: the first pass may only clear used bits.
+  for(n = 0; n < 2*bcache.nbuf; n++){
+    b = bcache.hand;
+    bcache.hand = b->cnext;
+    vb = b->bucket;
+    if(vb != bk)
+      acquire(&vb->lock);
+    // Even if refcnt==0, B_DIRTY indicates a buffer is in use
+    // because log.c has modified it but not yet committed it.
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0){
+      if(!b->used){
+        bunhash(b);
+        if(vb != bk)
+          release(&vb->lock);
+        goto found;
+      }
+      b->used = 0;
     }
+    if(vb != bk)
+      release(&vb->lock);
   }
   panic("bget: no buffers");
+
+found:
+  b->dev = dev;
+  b->blockno = blockno;
+  b->flags = 0;
+  b->refcnt = 1;
+  b->used = 1;
+  b->bucket = bk;
+  b->hnext = bk->head;
+  bk->head = b;
+  bcount[cpuid()].nmiss++;
+  return b;
+}
+
+// Look through buffer cache for block on device dev.
+// If not found, allocate a buffer.
+// In either case, return locked buffer.
+static struct buf*
+bget(uint dev, uint blockno)
+{
+  struct bucket *bk;
+  struct buf *b;
+
+  bk = &bcache.bucket[BHASH(dev, blockno)];
+
+  // Is the block already cached?
+  acquire(&bk->lock);
+  b = blookup(bk, dev, blockno);
+  release(&bk->lock);
+  if(b){
+    acquiresleep(&b->lock);
+    return b;
+  }
+
+  // Not cached; recycle an unused buffer, unless someone
+  // else read the block in meanwhile.
+  acquire(&bcache.lock);
+  acquire(&bk->lock);
+  if((b = blookup(bk, dev, blockno)) == 0)
+    b = brecycle(bk, dev, blockno);
+  release(&bk->lock);
+  release(&bcache.lock);
+  acquiresleep(&b->lock);
+  return b;
 }
 
 // Return a locked buf with the contents of the indicated block.
@@ -116,28 +351,40 @@ bwrite(struct buf *b)
 }
 
 // Release a locked buffer.
-// Move to the head of the MRU list.
+// It stays cached, and the clock will pass it over once.
 void
 brelse(struct buf *b)
 {
+  struct bucket *bk;
+
   if(!holdingsleep(&b->lock))
     panic("brelse");
 
   releasesleep(&b->lock);
 
-  acquire(&bcache.lock);
+  // b->bucket cannot change while we hold a reference.
+  bk = b->bucket;
+  acquire(&bk->lock);
   b->refcnt--;
-  if (b->refcnt == 0) {
-    // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
-  }
-  
+  release(&bk->lock);
+}
+
+// Fill in *st.
+void
+bcachestat(struct bcachestat *st)
+{
+  int i;
+
+  acquire(&bcache.lock);
+  st->nbuf = bcache.nbuf;
+  st->ngrow = bcache.ngrow;
+  st->nshrink = bcache.nshrink;
   release(&bcache.lock);
+  st->nhit = st->nmiss = 0;
+  for(i = 0; i < ncpu; i++){
+    st->nhit += bcount[i].nhit;
+    st->nmiss += bcount[i].nmiss;
+  }
 }
 //PAGEBREAK!
 // Blank page.
@@ -4,8 +4,11 @@ struct buf {
   uint blockno;
   struct sleeplock lock;
   uint refcnt;
-  struct buf *prev; // LRU cache list
-  struct buf *next;
+  uint used;        // used since the clock hand last passed it
+  struct bucket *bucket; // hash bucket it is on, 0 if none
+  struct buf *hnext; // hash chain
+  struct buf *cnext; // clock ring
+  struct buf *cprev;
   struct buf *qnext; // disk queue
   uchar data[BSIZE];
 };
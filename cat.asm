@@ -0,0 +1,1645 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 26                	jg     4f <main+0x4f>
+  29:	eb 52                	jmp    7d <main+0x7d>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+  30:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 1; i < argc; i++){
+  33:	83 c6 01             	add    $0x1,%esi
+  36:	83 c3 04             	add    $0x4,%ebx
+    cat(fd);
+  39:	50                   	push   %eax
+  3a:	e8 51 00 00 00       	call   90 <cat>
+    close(fd);
+  3f:	89 3c 24             	mov    %edi,(%esp)
+  42:	e8 1c 05 00 00       	call   563 <close>
+  for(i = 1; i < argc; i++){
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4d:	74 29                	je     78 <main+0x78>
+    if((fd = open(argv[i], 0)) < 0){
+  4f:	83 ec 08             	sub    $0x8,%esp
+  52:	6a 00                	push   $0x0
+  54:	ff 33                	push   (%ebx)
+  56:	e8 29 05 00 00       	call   584 <open>
+  5b:	83 c4 10             	add    $0x10,%esp
+  5e:	89 c7                	mov    %eax,%edi
+  60:	85 c0                	test   %eax,%eax
+  62:	79 cc                	jns    30 <main+0x30>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  64:	50                   	push   %eax
+  65:	ff 33                	push   (%ebx)
+  67:	68 fb 0a 00 00       	push   $0xafb
+  6c:	6a 01                	push   $0x1
+  6e:	e8 3d 07 00 00       	call   7b0 <printf>
+      exit();
+  73:	e8 b4 04 00 00       	call   52c <exit>
+  }
+  exit();
+  78:	e8 af 04 00 00       	call   52c <exit>
+    cat(0);
+  7d:	83 ec 0c             	sub    $0xc,%esp
+  80:	6a 00                	push   $0x0
+  82:	e8 09 00 00 00       	call   90 <cat>
+    exit();
+  87:	e8 a0 04 00 00       	call   52c <exit>
+  8c:	66 90                	xchg   %ax,%ax
+  8e:	66 90                	xchg   %ax,%ax
+
+00000090 <cat>:
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	56                   	push   %esi
+  94:	53                   	push   %ebx
+  95:	8b 75 08             	mov    0x8(%ebp),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  98:	eb 1d                	jmp    b7 <cat+0x27>
+  9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if (write(1, buf, n) != n) {
+  a0:	83 ec 04             	sub    $0x4,%esp
+  a3:	53                   	push   %ebx
+  a4:	68 c0 0f 00 00       	push   $0xfc0
+  a9:	6a 01                	push   $0x1
+  ab:	e8 a8 04 00 00       	call   558 <write>
+  b0:	83 c4 10             	add    $0x10,%esp
+  b3:	39 d8                	cmp    %ebx,%eax
+  b5:	75 25                	jne    dc <cat+0x4c>
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  b7:	83 ec 04             	sub    $0x4,%esp
+  ba:	68 00 02 00 00       	push   $0x200
+  bf:	68 c0 0f 00 00       	push   $0xfc0
+  c4:	56                   	push   %esi
+  c5:	e8 83 04 00 00       	call   54d <read>
+  ca:	83 c4 10             	add    $0x10,%esp
+  cd:	89 c3                	mov    %eax,%ebx
+  cf:	85 c0                	test   %eax,%eax
+  d1:	7f cd                	jg     a0 <cat+0x10>
+  if(n < 0){
+  d3:	75 1b                	jne    f0 <cat+0x60>
+}
+  d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  d8:	5b                   	pop    %ebx
+  d9:	5e                   	pop    %esi
+  da:	5d                   	pop    %ebp
+  db:	c3                   	ret
+      printf(1, "cat: write error\n");
+  dc:	83 ec 08             	sub    $0x8,%esp
+  df:	68 d8 0a 00 00       	push   $0xad8
+  e4:	6a 01                	push   $0x1
+  e6:	e8 c5 06 00 00       	call   7b0 <printf>
+      exit();
+  eb:	e8 3c 04 00 00       	call   52c <exit>
+    printf(1, "cat: read error\n");
+  f0:	50                   	push   %eax
+  f1:	50                   	push   %eax
+  f2:	68 ea 0a 00 00       	push   $0xaea
+  f7:	6a 01                	push   $0x1
+  f9:	e8 b2 06 00 00       	call   7b0 <printf>
+    exit();
+  fe:	e8 29 04 00 00       	call   52c <exit>
+ 103:	66 90                	xchg   %ax,%ax
+ 105:	66 90                	xchg   %ax,%ax
+ 107:	66 90                	xchg   %ax,%ax
+ 109:	66 90                	xchg   %ax,%ax
+ 10b:	66 90                	xchg   %ax,%ax
+ 10d:	66 90                	xchg   %ax,%ax
+ 10f:	90                   	nop
+
+00000110 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 110:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 111:	31 c0                	xor    %eax,%eax
+{
+ 113:	89 e5                	mov    %esp,%ebp
+ 115:	53                   	push   %ebx
+ 116:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 119:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 120:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 124:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 127:	83 c0 01             	add    $0x1,%eax
+ 12a:	84 d2                	test   %dl,%dl
+ 12c:	75 f2                	jne    120 <strcpy+0x10>
+    ;
+  return os;
+}
+ 12e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 131:	89 c8                	mov    %ecx,%eax
+ 133:	c9                   	leave
+ 134:	c3                   	ret
+ 135:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	53                   	push   %ebx
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+ 147:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 14a:	0f b6 02             	movzbl (%edx),%eax
+ 14d:	84 c0                	test   %al,%al
+ 14f:	75 17                	jne    168 <strcmp+0x28>
+ 151:	eb 3a                	jmp    18d <strcmp+0x4d>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 15c:	83 c2 01             	add    $0x1,%edx
+ 15f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 162:	84 c0                	test   %al,%al
+ 164:	74 1a                	je     180 <strcmp+0x40>
+    p++, q++;
+ 166:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 168:	0f b6 19             	movzbl (%ecx),%ebx
+ 16b:	38 c3                	cmp    %al,%bl
+ 16d:	74 e9                	je     158 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 16f:	29 d8                	sub    %ebx,%eax
+}
+ 171:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 174:	c9                   	leave
+ 175:	c3                   	ret
+ 176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 180:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 184:	31 c0                	xor    %eax,%eax
+ 186:	29 d8                	sub    %ebx,%eax
+}
+ 188:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 18b:	c9                   	leave
+ 18c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 18d:	0f b6 19             	movzbl (%ecx),%ebx
+ 190:	31 c0                	xor    %eax,%eax
+ 192:	eb db                	jmp    16f <strcmp+0x2f>
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1a6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1a9:	74 15                	je     1c0 <strlen+0x20>
+ 1ab:	31 c0                	xor    %eax,%eax
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 1b0:	83 c0 01             	add    $0x1,%eax
+ 1b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1b7:	89 c1                	mov    %eax,%ecx
+ 1b9:	75 f5                	jne    1b0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1bb:	89 c8                	mov    %ecx,%eax
+ 1bd:	5d                   	pop    %ebp
+ 1be:	c3                   	ret
+ 1bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1c0:	31 c9                	xor    %ecx,%ecx
+}
+ 1c2:	5d                   	pop    %ebp
+ 1c3:	89 c8                	mov    %ecx,%eax
+ 1c5:	c3                   	ret
+ 1c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	57                   	push   %edi
+ 1d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1dd:	89 d7                	mov    %edx,%edi
+ 1df:	fc                   	cld
+ 1e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1e5:	89 d0                	mov    %edx,%eax
+ 1e7:	c9                   	leave
+ 1e8:	c3                   	ret
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1fa:	0f b6 10             	movzbl (%eax),%edx
+ 1fd:	84 d2                	test   %dl,%dl
+ 1ff:	75 12                	jne    213 <strchr+0x23>
+ 201:	eb 1d                	jmp    220 <strchr+0x30>
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+ 208:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 20c:	83 c0 01             	add    $0x1,%eax
+ 20f:	84 d2                	test   %dl,%dl
+ 211:	74 0d                	je     220 <strchr+0x30>
+    if(*s == c)
+ 213:	38 d1                	cmp    %dl,%cl
+ 215:	75 f1                	jne    208 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 217:	5d                   	pop    %ebp
+ 218:	c3                   	ret
+ 219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 220:	31 c0                	xor    %eax,%eax
+}
+ 222:	5d                   	pop    %ebp
+ 223:	c3                   	ret
+ 224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 22f:	90                   	nop
+
+00000230 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	57                   	push   %edi
+ 234:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 235:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 238:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 239:	31 db                	xor    %ebx,%ebx
+{
+ 23b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 23e:	eb 27                	jmp    267 <gets+0x37>
+    cc = read(0, &c, 1);
+ 240:	83 ec 04             	sub    $0x4,%esp
+ 243:	6a 01                	push   $0x1
+ 245:	56                   	push   %esi
+ 246:	6a 00                	push   $0x0
+ 248:	e8 00 03 00 00       	call   54d <read>
+    if(cc < 1)
+ 24d:	83 c4 10             	add    $0x10,%esp
+ 250:	85 c0                	test   %eax,%eax
+ 252:	7e 1d                	jle    271 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 254:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 258:	8b 55 08             	mov    0x8(%ebp),%edx
+ 25b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 25f:	3c 0a                	cmp    $0xa,%al
+ 261:	74 10                	je     273 <gets+0x43>
+ 263:	3c 0d                	cmp    $0xd,%al
+ 265:	74 0c                	je     273 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 267:	89 df                	mov    %ebx,%edi
+ 269:	83 c3 01             	add    $0x1,%ebx
+ 26c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 26f:	7c cf                	jl     240 <gets+0x10>
+ 271:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 273:	8b 45 08             	mov    0x8(%ebp),%eax
+ 276:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 27a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 27d:	5b                   	pop    %ebx
+ 27e:	5e                   	pop    %esi
+ 27f:	5f                   	pop    %edi
+ 280:	5d                   	pop    %ebp
+ 281:	c3                   	ret
+ 282:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	56                   	push   %esi
+ 294:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 295:	83 ec 08             	sub    $0x8,%esp
+ 298:	6a 00                	push   $0x0
+ 29a:	ff 75 08             	push   0x8(%ebp)
+ 29d:	e8 e2 02 00 00       	call   584 <open>
+  if(fd < 0)
+ 2a2:	83 c4 10             	add    $0x10,%esp
+ 2a5:	85 c0                	test   %eax,%eax
+ 2a7:	78 27                	js     2d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2a9:	83 ec 08             	sub    $0x8,%esp
+ 2ac:	ff 75 0c             	push   0xc(%ebp)
+ 2af:	89 c3                	mov    %eax,%ebx
+ 2b1:	50                   	push   %eax
+ 2b2:	e8 ee 02 00 00       	call   5a5 <fstat>
+  close(fd);
+ 2b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2bc:	e8 a2 02 00 00       	call   563 <close>
+  return r;
+ 2c1:	83 c4 10             	add    $0x10,%esp
+}
+ 2c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2c7:	89 f0                	mov    %esi,%eax
+ 2c9:	5b                   	pop    %ebx
+ 2ca:	5e                   	pop    %esi
+ 2cb:	5d                   	pop    %ebp
+ 2cc:	c3                   	ret
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2d5:	eb ed                	jmp    2c4 <stat+0x34>
+ 2d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2de:	66 90                	xchg   %ax,%ax
+
+000002e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	53                   	push   %ebx
+ 2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2e7:	0f be 02             	movsbl (%edx),%eax
+ 2ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2f5:	77 1e                	ja     315 <atoi+0x35>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 300:	83 c2 01             	add    $0x1,%edx
+ 303:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 306:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 30a:	0f be 02             	movsbl (%edx),%eax
+ 30d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 310:	80 fb 09             	cmp    $0x9,%bl
+ 313:	76 eb                	jbe    300 <atoi+0x20>
+  return n;
+}
+ 315:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 318:	89 c8                	mov    %ecx,%eax
+ 31a:	c9                   	leave
+ 31b:	c3                   	ret
+ 31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	56                   	push   %esi
+ 325:	8b 45 10             	mov    0x10(%ebp),%eax
+ 328:	8b 55 08             	mov    0x8(%ebp),%edx
+ 32b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 32e:	85 c0                	test   %eax,%eax
+ 330:	7e 13                	jle    345 <memmove+0x25>
+ 332:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 334:	89 d7                	mov    %edx,%edi
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 340:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 341:	39 f8                	cmp    %edi,%eax
+ 343:	75 fb                	jne    340 <memmove+0x20>
+  return vdst;
+}
+ 345:	5e                   	pop    %esi
+ 346:	89 d0                	mov    %edx,%eax
+ 348:	5f                   	pop    %edi
+ 349:	5d                   	pop    %ebp
+ 34a:	c3                   	ret
+ 34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+
+00000350 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 350:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 355:	85 c0                	test   %eax,%eax
+ 357:	74 07                	je     360 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 359:	c3                   	ret
+ 35a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 360:	e9 77 02 00 00       	jmp    5dc <sysgetpid>
+ 365:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 370:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 375:	c3                   	ret
+ 376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000380 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 380:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 381:	31 d2                	xor    %edx,%edx
+ 383:	89 e5                	mov    %esp,%ebp
+ 385:	53                   	push   %ebx
+ 386:	83 ec 04             	sub    $0x4,%esp
+ 389:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 38c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 38f:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 392:	85 c9                	test   %ecx,%ecx
+ 394:	7e 08                	jle    39e <cyclereport+0x1e>
+ 396:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 398:	89 d8                	mov    %ebx,%eax
+ 39a:	f7 f1                	div    %ecx
+ 39c:	89 c2                	mov    %eax,%edx
+ 39e:	83 ec 08             	sub    $0x8,%esp
+ 3a1:	52                   	push   %edx
+ 3a2:	ff 75 0c             	push   0xc(%ebp)
+ 3a5:	51                   	push   %ecx
+ 3a6:	ff 75 08             	push   0x8(%ebp)
+ 3a9:	68 10 0b 00 00       	push   $0xb10
+ 3ae:	6a 01                	push   $0x1
+ 3b0:	e8 fb 03 00 00       	call   7b0 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 3b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3b8:	83 c4 20             	add    $0x20,%esp
+ 3bb:	c9                   	leave
+ 3bc:	c3                   	ret
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003c0 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 3c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3cc:	5d                   	pop    %ebp
+ 3cd:	c3                   	ret
+ 3ce:	66 90                	xchg   %ax,%ax
+
+000003d0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 3d0:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 3d1:	31 c0                	xor    %eax,%eax
+ 3d3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 3d8:	89 e5                	mov    %esp,%ebp
+ 3da:	56                   	push   %esi
+ 3db:	53                   	push   %ebx
+ 3dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 3df:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 3e3:	85 c0                	test   %eax,%eax
+ 3e5:	74 30                	je     417 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 3e7:	83 f8 02             	cmp    $0x2,%eax
+ 3ea:	74 0c                	je     3f8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 3ec:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3f1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 3f4:	85 c0                	test   %eax,%eax
+ 3f6:	74 1f                	je     417 <mutex_lock+0x47>
+ 3f8:	be 02 00 00 00       	mov    $0x2,%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 400:	83 ec 08             	sub    $0x8,%esp
+ 403:	6a 02                	push   $0x2
+ 405:	53                   	push   %ebx
+ 406:	e8 8c 02 00 00       	call   697 <futex_wait>
+ 40b:	89 f0                	mov    %esi,%eax
+ 40d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 410:	83 c4 10             	add    $0x10,%esp
+ 413:	85 c0                	test   %eax,%eax
+ 415:	75 e9                	jne    400 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 417:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 41a:	5b                   	pop    %ebx
+ 41b:	5e                   	pop    %esi
+ 41c:	5d                   	pop    %ebp
+ 41d:	c3                   	ret
+ 41e:	66 90                	xchg   %ax,%ax
+
+00000420 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	83 ec 08             	sub    $0x8,%esp
+ 426:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 429:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 42d:	75 09                	jne    438 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 42f:	c9                   	leave
+ 430:	c3                   	ret
+ 431:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 438:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 43b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 441:	6a 01                	push   $0x1
+ 443:	50                   	push   %eax
+ 444:	e8 59 02 00 00       	call   6a2 <futex_wake>
+ 449:	83 c4 10             	add    $0x10,%esp
+}
+ 44c:	c9                   	leave
+ 44d:	c3                   	ret
+ 44e:	66 90                	xchg   %ax,%ax
+
+00000450 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 453:	8b 45 08             	mov    0x8(%ebp),%eax
+ 456:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 45c:	5d                   	pop    %ebp
+ 45d:	c3                   	ret
+ 45e:	66 90                	xchg   %ax,%ax
+
+00000460 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+ 465:	53                   	push   %ebx
+ 466:	83 ec 0c             	sub    $0xc,%esp
+ 469:	8b 75 08             	mov    0x8(%ebp),%esi
+ 46c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 46f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 471:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 475:	75 21                	jne    498 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 477:	83 ec 08             	sub    $0x8,%esp
+ 47a:	57                   	push   %edi
+ 47b:	56                   	push   %esi
+ 47c:	e8 16 02 00 00       	call   697 <futex_wait>
+  mutex_lock(m);
+ 481:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 484:	83 c4 10             	add    $0x10,%esp
+}
+ 487:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 48a:	5b                   	pop    %ebx
+ 48b:	5e                   	pop    %esi
+ 48c:	5f                   	pop    %edi
+ 48d:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 48e:	e9 3d ff ff ff       	jmp    3d0 <mutex_lock>
+ 493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 497:	90                   	nop
+    futex_wake(&m->v, 1);
+ 498:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 49b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 4a1:	6a 01                	push   $0x1
+ 4a3:	53                   	push   %ebx
+ 4a4:	e8 f9 01 00 00       	call   6a2 <futex_wake>
+ 4a9:	83 c4 10             	add    $0x10,%esp
+ 4ac:	eb c9                	jmp    477 <cond_wait+0x17>
+ 4ae:	66 90                	xchg   %ax,%ax
+
+000004b0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	83 ec 10             	sub    $0x10,%esp
+ 4b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 4b9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 4bd:	6a 01                	push   $0x1
+ 4bf:	50                   	push   %eax
+ 4c0:	e8 dd 01 00 00       	call   6a2 <futex_wake>
+}
+ 4c5:	83 c4 10             	add    $0x10,%esp
+ 4c8:	c9                   	leave
+ 4c9:	c3                   	ret
+ 4ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004d0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	83 ec 10             	sub    $0x10,%esp
+ 4d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 4d9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 4dd:	68 ff ff ff 7f       	push   $0x7fffffff
+ 4e2:	50                   	push   %eax
+ 4e3:	e8 ba 01 00 00       	call   6a2 <futex_wake>
+}
+ 4e8:	83 c4 10             	add    $0x10,%esp
+ 4eb:	c9                   	leave
+ 4ec:	c3                   	ret
+
+000004ed <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 4ed:	50                   	push   %eax
+  pushl %ebx
+ 4ee:	53                   	push   %ebx
+  movl $1, %eax
+ 4ef:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 4f4:	0f a2                	cpuid
+  popl %ebx
+ 4f6:	5b                   	pop    %ebx
+  popl %eax
+ 4f7:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 4f8:	c7 05 b0 0f 00 00 1e 	movl   $0x51e,0xfb0
+ 4ff:	05 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 502:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 508:	74 14                	je     51e <sysint>
+  movl $sysfast, syscallvec
+ 50a:	c7 05 b0 0f 00 00 14 	movl   $0x514,0xfb0
+ 511:	05 00 00 
+
+00000514 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 514:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 516:	ba 1d 05 00 00       	mov    $0x51d,%edx
+  sysenter
+ 51b:	0f 34                	sysenter
+1:
+  ret
+ 51d:	c3                   	ret
+
+0000051e <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 51e:	cd 40                	int    $0x40
+  ret
+ 520:	c3                   	ret
+
+00000521 <fork>:
+
+SYSCALL(fork)
+ 521:	b8 01 00 00 00       	mov    $0x1,%eax
+ 526:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+0000052c <exit>:
+SYSCALL(exit)
+ 52c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 531:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+00000537 <wait>:
+SYSCALL(wait)
+ 537:	b8 03 00 00 00       	mov    $0x3,%eax
+ 53c:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+00000542 <pipe>:
+SYSCALL(pipe)
+ 542:	b8 04 00 00 00       	mov    $0x4,%eax
+ 547:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+0000054d <read>:
+SYSCALL(read)
+ 54d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 552:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+00000558 <write>:
+SYSCALL(write)
+ 558:	b8 10 00 00 00       	mov    $0x10,%eax
+ 55d:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+00000563 <close>:
+SYSCALL(close)
+ 563:	b8 15 00 00 00       	mov    $0x15,%eax
+ 568:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+0000056e <kill>:
+SYSCALL(kill)
+ 56e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 573:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+00000579 <exec>:
+SYSCALL(exec)
+ 579:	b8 07 00 00 00       	mov    $0x7,%eax
+ 57e:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+00000584 <open>:
+SYSCALL(open)
+ 584:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 589:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+0000058f <mknod>:
+SYSCALL(mknod)
+ 58f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 594:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+0000059a <unlink>:
+SYSCALL(unlink)
+ 59a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 59f:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+000005a5 <fstat>:
+SYSCALL(fstat)
+ 5a5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5aa:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+000005b0 <link>:
+SYSCALL(link)
+ 5b0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5b5:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+000005bb <mkdir>:
+SYSCALL(mkdir)
+ 5bb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5c0:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+000005c6 <chdir>:
+SYSCALL(chdir)
+ 5c6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5cb:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+000005d1 <dup>:
+SYSCALL(dup)
+ 5d1:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5d6:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+000005dc <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 5dc:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5e1:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+000005e7 <sbrk>:
+SYSCALL(sbrk)
+ 5e7:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5ec:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+000005f2 <sleep>:
+SYSCALL(sleep)
+ 5f2:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5f7:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+000005fd <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 5fd:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 602:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+00000608 <swapread>:
+SYSCALL(swapread)
+ 608:	b8 16 00 00 00       	mov    $0x16,%eax
+ 60d:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+00000613 <swapwrite>:
+SYSCALL(swapwrite)
+ 613:	b8 17 00 00 00       	mov    $0x17,%eax
+ 618:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+0000061e <swapstat>:
+SYSCALL(swapstat)
+ 61e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 623:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+00000629 <madvise>:
+SYSCALL(madvise)
+ 629:	b8 19 00 00 00       	mov    $0x19,%eax
+ 62e:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+00000634 <mlock>:
+SYSCALL(mlock)
+ 634:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 639:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+0000063f <munlock>:
+SYSCALL(munlock)
+ 63f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 644:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+0000064a <membench>:
+SYSCALL(membench)
+ 64a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 64f:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+00000655 <nice>:
+SYSCALL(nice)
+ 655:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 65a:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+00000660 <setpriority>:
+SYSCALL(setpriority)
+ 660:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 665:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+0000066b <usleep>:
+SYSCALL(usleep)
+ 66b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 670:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+00000676 <cpustat>:
+SYSCALL(cpustat)
+ 676:	b8 20 00 00 00       	mov    $0x20,%eax
+ 67b:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+00000681 <clone>:
+SYSCALL(clone)
+ 681:	b8 21 00 00 00       	mov    $0x21,%eax
+ 686:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+0000068c <join>:
+SYSCALL(join)
+ 68c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 691:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+00000697 <futex_wait>:
+SYSCALL(futex_wait)
+ 697:	b8 23 00 00 00       	mov    $0x23,%eax
+ 69c:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+000006a2 <futex_wake>:
+SYSCALL(futex_wake)
+ 6a2:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6a7:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+000006ad <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 6ad:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6b2:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+000006b8 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 6b8:	b8 26 00 00 00       	mov    $0x26,%eax
+ 6bd:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+000006c3 <getcpu>:
+SYSCALL(getcpu)
+ 6c3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 6c8:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+000006ce <migrations>:
+SYSCALL(migrations)
+ 6ce:	b8 28 00 00 00       	mov    $0x28,%eax
+ 6d3:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+000006d9 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 6d9:	b8 29 00 00 00       	mov    $0x29,%eax
+ 6de:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+000006e4 <lockstat>:
+SYSCALL(lockstat)
+ 6e4:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 6e9:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+000006ef <lockprof>:
+SYSCALL(lockprof)
+ 6ef:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 6f4:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+
+000006fa <bcachestat>:
+SYSCALL(bcachestat)
+ 6fa:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 6ff:	ff 25 b0 0f 00 00    	jmp    *0xfb0
+ 705:	66 90                	xchg   %ax,%ax
+ 707:	66 90                	xchg   %ax,%ax
+ 709:	66 90                	xchg   %ax,%ax
+ 70b:	66 90                	xchg   %ax,%ax
+ 70d:	66 90                	xchg   %ax,%ax
+ 70f:	90                   	nop
+
+00000710 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	57                   	push   %edi
+ 714:	56                   	push   %esi
+ 715:	53                   	push   %ebx
+ 716:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 718:	89 d1                	mov    %edx,%ecx
+{
+ 71a:	83 ec 3c             	sub    $0x3c,%esp
+ 71d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 720:	85 d2                	test   %edx,%edx
+ 722:	0f 89 80 00 00 00    	jns    7a8 <printint+0x98>
+ 728:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 72c:	74 7a                	je     7a8 <printint+0x98>
+    x = -xx;
+ 72e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 730:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 735:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 738:	31 f6                	xor    %esi,%esi
+ 73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 740:	89 c8                	mov    %ecx,%eax
+ 742:	31 d2                	xor    %edx,%edx
+ 744:	89 f7                	mov    %esi,%edi
+ 746:	f7 f3                	div    %ebx
+ 748:	8d 76 01             	lea    0x1(%esi),%esi
+ 74b:	0f b6 92 8c 0b 00 00 	movzbl 0xb8c(%edx),%edx
+ 752:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 756:	89 ca                	mov    %ecx,%edx
+ 758:	89 c1                	mov    %eax,%ecx
+ 75a:	39 da                	cmp    %ebx,%edx
+ 75c:	73 e2                	jae    740 <printint+0x30>
+  if(neg)
+ 75e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 761:	85 c0                	test   %eax,%eax
+ 763:	74 07                	je     76c <printint+0x5c>
+    buf[i++] = '-';
+ 765:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 76a:	89 f7                	mov    %esi,%edi
+ 76c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 76f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 772:	01 df                	add    %ebx,%edi
+ 774:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 778:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 77b:	83 ec 04             	sub    $0x4,%esp
+ 77e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 781:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 784:	6a 01                	push   $0x1
+ 786:	50                   	push   %eax
+ 787:	56                   	push   %esi
+ 788:	e8 cb fd ff ff       	call   558 <write>
+  while(--i >= 0)
+ 78d:	89 f8                	mov    %edi,%eax
+ 78f:	83 c4 10             	add    $0x10,%esp
+ 792:	83 ef 01             	sub    $0x1,%edi
+ 795:	39 d8                	cmp    %ebx,%eax
+ 797:	75 df                	jne    778 <printint+0x68>
+}
+ 799:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 79c:	5b                   	pop    %ebx
+ 79d:	5e                   	pop    %esi
+ 79e:	5f                   	pop    %edi
+ 79f:	5d                   	pop    %ebp
+ 7a0:	c3                   	ret
+ 7a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7a8:	31 c0                	xor    %eax,%eax
+ 7aa:	eb 89                	jmp    735 <printint+0x25>
+ 7ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 e5                	mov    %esp,%ebp
+ 7b3:	57                   	push   %edi
+ 7b4:	56                   	push   %esi
+ 7b5:	53                   	push   %ebx
+ 7b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 7c2:	83 c6 01             	add    $0x1,%esi
+ 7c5:	84 db                	test   %bl,%bl
+ 7c7:	74 67                	je     830 <printf+0x80>
+ 7c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7cc:	31 d2                	xor    %edx,%edx
+ 7ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 7d1:	eb 34                	jmp    807 <printf+0x57>
+ 7d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7d7:	90                   	nop
+ 7d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 7db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 7e0:	83 f8 25             	cmp    $0x25,%eax
+ 7e3:	74 18                	je     7fd <printf+0x4d>
+  write(fd, &c, 1);
+ 7e5:	83 ec 04             	sub    $0x4,%esp
+ 7e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7ee:	6a 01                	push   $0x1
+ 7f0:	50                   	push   %eax
+ 7f1:	57                   	push   %edi
+ 7f2:	e8 61 fd ff ff       	call   558 <write>
+ 7f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 7fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 7fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 800:	83 c6 01             	add    $0x1,%esi
+ 803:	84 db                	test   %bl,%bl
+ 805:	74 29                	je     830 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 807:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 80a:	85 d2                	test   %edx,%edx
+ 80c:	74 ca                	je     7d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 80e:	83 fa 25             	cmp    $0x25,%edx
+ 811:	75 ea                	jne    7fd <printf+0x4d>
+      if(c == 'd'){
+ 813:	83 f8 25             	cmp    $0x25,%eax
+ 816:	0f 84 24 01 00 00    	je     940 <printf+0x190>
+ 81c:	83 e8 63             	sub    $0x63,%eax
+ 81f:	83 f8 15             	cmp    $0x15,%eax
+ 822:	77 1c                	ja     840 <printf+0x90>
+ 824:	ff 24 85 34 0b 00 00 	jmp    *0xb34(,%eax,4)
+ 82b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 82f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 830:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 833:	5b                   	pop    %ebx
+ 834:	5e                   	pop    %esi
+ 835:	5f                   	pop    %edi
+ 836:	5d                   	pop    %ebp
+ 837:	c3                   	ret
+ 838:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 83f:	90                   	nop
+  write(fd, &c, 1);
+ 840:	83 ec 04             	sub    $0x4,%esp
+ 843:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 846:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 84a:	6a 01                	push   $0x1
+ 84c:	52                   	push   %edx
+ 84d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 850:	57                   	push   %edi
+ 851:	e8 02 fd ff ff       	call   558 <write>
+ 856:	83 c4 0c             	add    $0xc,%esp
+ 859:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 85c:	6a 01                	push   $0x1
+ 85e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 861:	52                   	push   %edx
+ 862:	57                   	push   %edi
+ 863:	e8 f0 fc ff ff       	call   558 <write>
+        putc(fd, c);
+ 868:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 86b:	31 d2                	xor    %edx,%edx
+ 86d:	eb 8e                	jmp    7fd <printf+0x4d>
+ 86f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 870:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 873:	83 ec 0c             	sub    $0xc,%esp
+ 876:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 87b:	8b 13                	mov    (%ebx),%edx
+ 87d:	6a 00                	push   $0x0
+ 87f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 881:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 884:	e8 87 fe ff ff       	call   710 <printint>
+        ap++;
+ 889:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 88c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 88f:	31 d2                	xor    %edx,%edx
+ 891:	e9 67 ff ff ff       	jmp    7fd <printf+0x4d>
+ 896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8a5:	83 c0 04             	add    $0x4,%eax
+ 8a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8ab:	85 db                	test   %ebx,%ebx
+ 8ad:	0f 84 9d 00 00 00    	je     950 <printf+0x1a0>
+        while(*s != 0){
+ 8b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8b8:	84 c0                	test   %al,%al
+ 8ba:	0f 84 3d ff ff ff    	je     7fd <printf+0x4d>
+ 8c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 8c6:	89 de                	mov    %ebx,%esi
+ 8c8:	89 d3                	mov    %edx,%ebx
+ 8ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 8d0:	83 ec 04             	sub    $0x4,%esp
+ 8d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 8d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 8d9:	6a 01                	push   $0x1
+ 8db:	53                   	push   %ebx
+ 8dc:	57                   	push   %edi
+ 8dd:	e8 76 fc ff ff       	call   558 <write>
+        while(*s != 0){
+ 8e2:	0f b6 06             	movzbl (%esi),%eax
+ 8e5:	83 c4 10             	add    $0x10,%esp
+ 8e8:	84 c0                	test   %al,%al
+ 8ea:	75 e4                	jne    8d0 <printf+0x120>
+      state = 0;
+ 8ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 8ef:	31 d2                	xor    %edx,%edx
+ 8f1:	e9 07 ff ff ff       	jmp    7fd <printf+0x4d>
+ 8f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 900:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 903:	83 ec 0c             	sub    $0xc,%esp
+ 906:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 90b:	8b 13                	mov    (%ebx),%edx
+ 90d:	6a 01                	push   $0x1
+ 90f:	e9 6b ff ff ff       	jmp    87f <printf+0xcf>
+ 914:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 918:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 91b:	83 ec 04             	sub    $0x4,%esp
+ 91e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 921:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 923:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 926:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 929:	6a 01                	push   $0x1
+ 92b:	52                   	push   %edx
+ 92c:	57                   	push   %edi
+ 92d:	e8 26 fc ff ff       	call   558 <write>
+        ap++;
+ 932:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 935:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 938:	31 d2                	xor    %edx,%edx
+ 93a:	e9 be fe ff ff       	jmp    7fd <printf+0x4d>
+ 93f:	90                   	nop
+  write(fd, &c, 1);
+ 940:	83 ec 04             	sub    $0x4,%esp
+ 943:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 946:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 949:	6a 01                	push   $0x1
+ 94b:	e9 11 ff ff ff       	jmp    861 <printf+0xb1>
+ 950:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 955:	bb 2b 0b 00 00       	mov    $0xb2b,%ebx
+ 95a:	e9 61 ff ff ff       	jmp    8c0 <printf+0x110>
+ 95f:	90                   	nop
+
+00000960 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 960:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 961:	a1 c0 11 00 00       	mov    0x11c0,%eax
+{
+ 966:	89 e5                	mov    %esp,%ebp
+ 968:	57                   	push   %edi
+ 969:	56                   	push   %esi
+ 96a:	53                   	push   %ebx
+ 96b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 96e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 971:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 978:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 97a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 97c:	39 ca                	cmp    %ecx,%edx
+ 97e:	73 30                	jae    9b0 <free+0x50>
+ 980:	39 c1                	cmp    %eax,%ecx
+ 982:	72 04                	jb     988 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 984:	39 c2                	cmp    %eax,%edx
+ 986:	72 f0                	jb     978 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 988:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 98b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 98e:	39 f8                	cmp    %edi,%eax
+ 990:	74 2e                	je     9c0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 992:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 995:	8b 42 04             	mov    0x4(%edx),%eax
+ 998:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 99b:	39 f1                	cmp    %esi,%ecx
+ 99d:	74 38                	je     9d7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 99f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 9a1:	5b                   	pop    %ebx
+  freep = p;
+ 9a2:	89 15 c0 11 00 00    	mov    %edx,0x11c0
+}
+ 9a8:	5e                   	pop    %esi
+ 9a9:	5f                   	pop    %edi
+ 9aa:	5d                   	pop    %ebp
+ 9ab:	c3                   	ret
+ 9ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9b0:	39 c1                	cmp    %eax,%ecx
+ 9b2:	72 d0                	jb     984 <free+0x24>
+ 9b4:	eb c2                	jmp    978 <free+0x18>
+ 9b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9bd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 9c0:	03 70 04             	add    0x4(%eax),%esi
+ 9c3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9c6:	8b 02                	mov    (%edx),%eax
+ 9c8:	8b 00                	mov    (%eax),%eax
+ 9ca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 9cd:	8b 42 04             	mov    0x4(%edx),%eax
+ 9d0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9d3:	39 f1                	cmp    %esi,%ecx
+ 9d5:	75 c8                	jne    99f <free+0x3f>
+    p->s.size += bp->s.size;
+ 9d7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 9da:	89 15 c0 11 00 00    	mov    %edx,0x11c0
+    p->s.size += bp->s.size;
+ 9e0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 9e3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 9e6:	89 0a                	mov    %ecx,(%edx)
+}
+ 9e8:	5b                   	pop    %ebx
+ 9e9:	5e                   	pop    %esi
+ 9ea:	5f                   	pop    %edi
+ 9eb:	5d                   	pop    %ebp
+ 9ec:	c3                   	ret
+ 9ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009f0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 9f0:	55                   	push   %ebp
+ 9f1:	89 e5                	mov    %esp,%ebp
+ 9f3:	57                   	push   %edi
+ 9f4:	56                   	push   %esi
+ 9f5:	53                   	push   %ebx
+ 9f6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 9fc:	8b 15 c0 11 00 00    	mov    0x11c0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a02:	8d 78 07             	lea    0x7(%eax),%edi
+ a05:	c1 ef 03             	shr    $0x3,%edi
+ a08:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a0b:	85 d2                	test   %edx,%edx
+ a0d:	0f 84 8d 00 00 00    	je     aa0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a13:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a15:	8b 48 04             	mov    0x4(%eax),%ecx
+ a18:	39 f9                	cmp    %edi,%ecx
+ a1a:	73 64                	jae    a80 <malloc+0x90>
+  if(nu < 4096)
+ a1c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a21:	39 df                	cmp    %ebx,%edi
+ a23:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a26:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a2d:	eb 0a                	jmp    a39 <malloc+0x49>
+ a2f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a30:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a32:	8b 48 04             	mov    0x4(%eax),%ecx
+ a35:	39 f9                	cmp    %edi,%ecx
+ a37:	73 47                	jae    a80 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a39:	89 c2                	mov    %eax,%edx
+ a3b:	39 05 c0 11 00 00    	cmp    %eax,0x11c0
+ a41:	75 ed                	jne    a30 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a43:	83 ec 0c             	sub    $0xc,%esp
+ a46:	56                   	push   %esi
+ a47:	e8 9b fb ff ff       	call   5e7 <sbrk>
+  if(p == (char*)-1)
+ a4c:	83 c4 10             	add    $0x10,%esp
+ a4f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a52:	74 1c                	je     a70 <malloc+0x80>
+  hp->s.size = nu;
+ a54:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a57:	83 ec 0c             	sub    $0xc,%esp
+ a5a:	83 c0 08             	add    $0x8,%eax
+ a5d:	50                   	push   %eax
+ a5e:	e8 fd fe ff ff       	call   960 <free>
+  return freep;
+ a63:	8b 15 c0 11 00 00    	mov    0x11c0,%edx
+      if((p = morecore(nunits)) == 0)
+ a69:	83 c4 10             	add    $0x10,%esp
+ a6c:	85 d2                	test   %edx,%edx
+ a6e:	75 c0                	jne    a30 <malloc+0x40>
+        return 0;
+  }
+}
+ a70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a73:	31 c0                	xor    %eax,%eax
+}
+ a75:	5b                   	pop    %ebx
+ a76:	5e                   	pop    %esi
+ a77:	5f                   	pop    %edi
+ a78:	5d                   	pop    %ebp
+ a79:	c3                   	ret
+ a7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a80:	39 cf                	cmp    %ecx,%edi
+ a82:	74 4c                	je     ad0 <malloc+0xe0>
+        p->s.size -= nunits;
+ a84:	29 f9                	sub    %edi,%ecx
+ a86:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a89:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a8c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a8f:	89 15 c0 11 00 00    	mov    %edx,0x11c0
+}
+ a95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a98:	83 c0 08             	add    $0x8,%eax
+}
+ a9b:	5b                   	pop    %ebx
+ a9c:	5e                   	pop    %esi
+ a9d:	5f                   	pop    %edi
+ a9e:	5d                   	pop    %ebp
+ a9f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ aa0:	c7 05 c0 11 00 00 c4 	movl   $0x11c4,0x11c0
+ aa7:	11 00 00 
+    base.s.size = 0;
+ aaa:	b8 c4 11 00 00       	mov    $0x11c4,%eax
+    base.s.ptr = freep = prevp = &base;
+ aaf:	c7 05 c4 11 00 00 c4 	movl   $0x11c4,0x11c4
+ ab6:	11 00 00 
+    base.s.size = 0;
+ ab9:	c7 05 c8 11 00 00 00 	movl   $0x0,0x11c8
+ ac0:	00 00 00 
+    if(p->s.size >= nunits){
+ ac3:	e9 54 ff ff ff       	jmp    a1c <malloc+0x2c>
+ ac8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ acf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ad0:	8b 08                	mov    (%eax),%ecx
+ ad2:	89 0a                	mov    %ecx,(%edx)
+ ad4:	eb b9                	jmp    a8f <malloc+0x9f>
@@ -0,0 +1,43 @@
+// Print how each CPU split its time between running and idling,
+// since boot or, given a number of ticks, over that interval.
+// usage: cpustat [ticks]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "cpustat.h"
+
+struct cpustat st0[NCPU], st1[NCPU];
+
+int
+main(int argc, char *argv[])
+{
+  int i, n;
+  uint busy, idle;
+
+  memset(st0, 0, sizeof(st0));
+  if((n = cpustat(st1, NCPU)) < 0){
+    printf(2, "cpustat: failed\n");
+    exit();
+  }
+  if(argc > 1){
+    memmove(st0, st1, sizeof(st0));
+    sleep(atoi(argv[1]));
+    cpustat(st1, NCPU);
+  }
+  for(i = 0; i < n; i++){
+    // In units of 2^20 cycles, to stay within 32 bits.
+    busy = (st1[i].busy - st0[i].busy) >> 20;
+    idle = (st1[i].idle - st0[i].idle) >> 20;
+    if(busy + idle == 0)
+      idle = 1;
+    printf(1, "cpu%d: busy %d%% idle %d%% of %d Mcycles, "
+           "%d timer irqs, %d ipis, %d steals, %d fpu loads\n",
+           i, busy * 100 / (busy + idle), idle * 100 / (busy + idle),
+           busy + idle, st1[i].ntimer - st0[i].ntimer,
+           st1[i].nipi - st0[i].nipi, st1[i].nsteal - st0[i].nsteal,
+           st1[i].nfpu - st0[i].nfpu);
+  }
+  exit();
+}
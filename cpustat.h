@@ -0,0 +1,9 @@
+// Per-CPU time split, as returned by cpustat().
+struct cpustat {
+  uint64 busy;   // TSC cycles not halted since the CPU started
+  uint64 idle;   // TSC cycles halted in the idle loop
+  uint nipi;     // reschedule IPIs received
+  uint nsteal;   // processes stolen from other CPUs
+  uint ntimer;   // timer interrupts taken
+  uint nfpu;     // FPU state loads
+};
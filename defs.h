@@ -1,7 +1,12 @@
+struct bcachestat;
 struct buf;
 struct context;
+struct cpu;
+struct fdtable;
 struct file;
 struct inode;
+struct lockprof;
+struct lockstat;
 struct pipe;
 struct proc;
 struct rtcdate;
@@ -9,11 +14,15 @@ struct spinlock;
 struct sleeplock;
 struct stat;
 struct superblock;
+struct sysinfo;
+struct timer;
 
 // bio.c
+void            bcachestat(struct bcachestat*);
 void            binit(void);
 struct buf*     bread(uint, uint);
 void            brelse(struct buf*);
+int             bshrink(void);
 void            bwrite(struct buf*);
 
 // console.c
@@ -33,6 +42,19 @@ void            fileinit(void);
 int             fileread(struct file*, char*, int n);
 int             filestat(struct file*, struct stat*);
 int             filewrite(struct file*, char*, int n);
+struct fdtable* fdtalloc(void);
+struct fdtable* fdtcopy(struct fdtable*);
+struct fdtable* fdtdup(struct fdtable*);
+void            fdtput(struct fdtable*);
+struct inode*   fdtcwd(struct fdtable*);
+
+// fpu.c
+void            fpuenter(struct proc*);
+void            fpufork(struct proc*);
+void            fpuinit(void);
+void            fpuleave(struct proc*);
+void            fpureset(void);
+int             fputrap(void);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
@@ -55,6 +77,14 @@ int             writei(struct inode*, char*, uint, uint);
 void swapread(char* ptr, int blkno);
 void swapwrite(char* ptr, int blkno);
 
+// fwcfg.c
+int             fwcfgint(char*, int);
+
+// futex.c
+int             futexwait(uint, int);
+int             futexwake(uint, int);
+void            futexinit(void);
+
 // ide.c
 void            ideinit(void);
 void            ideintr(void);
@@ -66,10 +96,25 @@ extern uchar    ioapicid;
 void            ioapicinit(void);
 
 // kalloc.c
+uint            copy_user_page(pde_t*, char*, char*);
 char*           kalloc(void);
+char*           kallocspare(void);
 void            kfree(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+void            lru_add(pde_t*, char*, char*);
+void            lru_addvm(pde_t*, uint);
+int             madvise(pde_t*, uint, uint, int);
+int             mlock(pde_t*, uint, uint, uint);
+int             munlock(pde_t*, uint, uint);
+char*           pinpage(pde_t*, uint);
+void            unpinpage(char*);
+int             pinuvm(pde_t*, uint, uint);
+int             revokeuvm(pde_t*, uint, uint);
+void            unpinuvm(pde_t*, uint, uint);
+int             swap_fault(pde_t*, uint);
+char*           unmap_user_page(pte_t*);
+int             swap_in_page(pde_t*, char*, int);
 
 // kbd.c
 void            kbdintr(void);
@@ -80,7 +125,11 @@ int             lapicid(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
+void            lapicipi(int, int);
+extern uint     lapicjiffy;
+uint            lapiccount(void);
 void            lapicstartap(uchar, uint);
+void            lapictimer(uint);
 void            microdelay(int);
 
 // log.c
@@ -105,10 +154,13 @@ int             pipewrite(struct pipe*, char*, int);
 
 //PAGEBREAK: 16
 // proc.c
+int             clone(void (*)(void*, void*), void*, void*, void*);
 int             cpuid(void);
 void            exit(void);
 int             fork(void);
+int             getaffinity(int, uint*);
 int             growproc(int);
+int             join(void**);
 int             kill(int);
 struct cpu*     mycpu(void);
 struct proc*    myproc();
@@ -116,13 +168,25 @@ void            pinit(void);
 void            procdump(void);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
+int             schednext(uint);
+int             schedtick(void);
+int             setaffinity(int, uint);
+int             setpriority(int, int);
 void            setproc(struct proc*);
 void            sleep(void*, struct spinlock*);
 void            userinit(void);
+pde_t*          vmreplace(pde_t*);
 int             wait(void);
 void            wakeup(void*);
+int             wakeupn(void*, int);
 void            yield(void);
 
+// rcu.c
+void            rcuquiesce(struct cpu*);
+void            rcureadlock(void);
+void            rcureadunlock(void);
+void            rcusync(void);
+
 // swtch.S
 void            swtch(struct context**, struct context*);
 
@@ -131,9 +195,14 @@ void            acquire(struct spinlock*);
 void            getcallerpcs(void*, uint*);
 int             holding(struct spinlock*);
 void            initlock(struct spinlock*, char*);
+int             lockclass(char*);
+int             lockprofile(int, struct lockprof*, int);
+int             lockstat(struct lockstat*, int);
 void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
+void            sleeplockstat(int, int);
+int             tryacquire(struct spinlock*);
 
 // sleeplock.c
 void            acquiresleep(struct sleeplock*);
@@ -142,6 +211,9 @@ int             holdingsleep(struct sleeplock*);
 void            initsleeplock(struct sleeplock*, char*);
 
 // string.c
+void            clear_page(void*);
+void            copy_page(void*, const void*);
+int             membench(void);
 int             memcmp(const void*, const void*, uint);
 void*           memmove(void*, const void*, uint);
 void*           memset(void*, int, uint);
@@ -149,6 +221,7 @@ char*           safestrcpy(char*, const char*, int);
 int             strlen(const char*);
 int             strncmp(const char*, const char*, uint);
 char*           strncpy(char*, const char*, int);
+void            stringinit(void);
 
 // syscall.c
 int             argint(int, int*);
@@ -156,10 +229,22 @@ int             argptr(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
+int             fetchptr(uint, char**, int);
 void            syscall(void);
+void            unpinargs(int);
 
 // timer.c
+void            addtimer(struct timer*, uint);
+void            deltimer(struct timer*);
+extern uint     jiffies;
+uint            jiffynow(void);
+extern struct sysinfo *sysinfo;
+int             jsleep(uint);
+void            timerarm(void);
 void            timerinit(void);
+void            timerupdate(void);
+extern uint     tscperus;
+int             usleep(uint);
 
 // trap.c
 void            idtinit(void);
@@ -187,6 +272,11 @@ void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+void            tlbpoll(void);
+void            tlbshootdown(pde_t*);
+pte_t*          walkpgdir(pde_t*, const void*, int);
+int             mapinfo(pde_t*, int);
+void            setinfopid(pde_t*, int);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
@@ -0,0 +1,1559 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+  19:	83 fe 01             	cmp    $0x1,%esi
+  1c:	7e 47                	jle    65 <main+0x65>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1e:	8b 47 04             	mov    0x4(%edi),%eax
+  21:	83 fe 02             	cmp    $0x2,%esi
+  24:	74 2a                	je     50 <main+0x50>
+  26:	bb 02 00 00 00       	mov    $0x2,%ebx
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  30:	68 38 0a 00 00       	push   $0xa38
+  35:	83 c3 01             	add    $0x1,%ebx
+  38:	50                   	push   %eax
+  39:	68 3a 0a 00 00       	push   $0xa3a
+  3e:	6a 01                	push   $0x1
+  40:	e8 cb 06 00 00       	call   710 <printf>
+  45:	8b 44 9f fc          	mov    -0x4(%edi,%ebx,4),%eax
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 f3                	cmp    %esi,%ebx
+  4e:	75 e0                	jne    30 <main+0x30>
+  50:	68 58 0a 00 00       	push   $0xa58
+  55:	50                   	push   %eax
+  56:	68 3a 0a 00 00       	push   $0xa3a
+  5b:	6a 01                	push   $0x1
+  5d:	e8 ae 06 00 00       	call   710 <printf>
+  62:	83 c4 10             	add    $0x10,%esp
+  exit();
+  65:	e8 22 04 00 00       	call   48c <exit>
+  6a:	66 90                	xchg   %ax,%ax
+  6c:	66 90                	xchg   %ax,%ax
+  6e:	66 90                	xchg   %ax,%ax
+
+00000070 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  70:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  71:	31 c0                	xor    %eax,%eax
+{
+  73:	89 e5                	mov    %esp,%ebp
+  75:	53                   	push   %ebx
+  76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  80:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  84:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  87:	83 c0 01             	add    $0x1,%eax
+  8a:	84 d2                	test   %dl,%dl
+  8c:	75 f2                	jne    80 <strcpy+0x10>
+    ;
+  return os;
+}
+  8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  91:	89 c8                	mov    %ecx,%eax
+  93:	c9                   	leave
+  94:	c3                   	ret
+  95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	53                   	push   %ebx
+  a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  aa:	0f b6 02             	movzbl (%edx),%eax
+  ad:	84 c0                	test   %al,%al
+  af:	75 17                	jne    c8 <strcmp+0x28>
+  b1:	eb 3a                	jmp    ed <strcmp+0x4d>
+  b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  b7:	90                   	nop
+  b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  bc:	83 c2 01             	add    $0x1,%edx
+  bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  c2:	84 c0                	test   %al,%al
+  c4:	74 1a                	je     e0 <strcmp+0x40>
+    p++, q++;
+  c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  c8:	0f b6 19             	movzbl (%ecx),%ebx
+  cb:	38 c3                	cmp    %al,%bl
+  cd:	74 e9                	je     b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  cf:	29 d8                	sub    %ebx,%eax
+}
+  d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  d4:	c9                   	leave
+  d5:	c3                   	ret
+  d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  e4:	31 c0                	xor    %eax,%eax
+  e6:	29 d8                	sub    %ebx,%eax
+}
+  e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  eb:	c9                   	leave
+  ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ed:	0f b6 19             	movzbl (%ecx),%ebx
+  f0:	31 c0                	xor    %eax,%eax
+  f2:	eb db                	jmp    cf <strcmp+0x2f>
+  f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ff:	90                   	nop
+
+00000100 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 106:	80 3a 00             	cmpb   $0x0,(%edx)
+ 109:	74 15                	je     120 <strlen+0x20>
+ 10b:	31 c0                	xor    %eax,%eax
+ 10d:	8d 76 00             	lea    0x0(%esi),%esi
+ 110:	83 c0 01             	add    $0x1,%eax
+ 113:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 117:	89 c1                	mov    %eax,%ecx
+ 119:	75 f5                	jne    110 <strlen+0x10>
+    ;
+  return n;
+}
+ 11b:	89 c8                	mov    %ecx,%eax
+ 11d:	5d                   	pop    %ebp
+ 11e:	c3                   	ret
+ 11f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 120:	31 c9                	xor    %ecx,%ecx
+}
+ 122:	5d                   	pop    %ebp
+ 123:	89 c8                	mov    %ecx,%eax
+ 125:	c3                   	ret
+ 126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000130 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	57                   	push   %edi
+ 134:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 137:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 13a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 13d:	89 d7                	mov    %edx,%edi
+ 13f:	fc                   	cld
+ 140:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 142:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 145:	89 d0                	mov    %edx,%eax
+ 147:	c9                   	leave
+ 148:	c3                   	ret
+ 149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	8b 45 08             	mov    0x8(%ebp),%eax
+ 156:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 15a:	0f b6 10             	movzbl (%eax),%edx
+ 15d:	84 d2                	test   %dl,%dl
+ 15f:	75 12                	jne    173 <strchr+0x23>
+ 161:	eb 1d                	jmp    180 <strchr+0x30>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 16c:	83 c0 01             	add    $0x1,%eax
+ 16f:	84 d2                	test   %dl,%dl
+ 171:	74 0d                	je     180 <strchr+0x30>
+    if(*s == c)
+ 173:	38 d1                	cmp    %dl,%cl
+ 175:	75 f1                	jne    168 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 177:	5d                   	pop    %ebp
+ 178:	c3                   	ret
+ 179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 180:	31 c0                	xor    %eax,%eax
+}
+ 182:	5d                   	pop    %ebp
+ 183:	c3                   	ret
+ 184:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 18f:	90                   	nop
+
+00000190 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	57                   	push   %edi
+ 194:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 195:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 198:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 199:	31 db                	xor    %ebx,%ebx
+{
+ 19b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 19e:	eb 27                	jmp    1c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1a0:	83 ec 04             	sub    $0x4,%esp
+ 1a3:	6a 01                	push   $0x1
+ 1a5:	56                   	push   %esi
+ 1a6:	6a 00                	push   $0x0
+ 1a8:	e8 00 03 00 00       	call   4ad <read>
+    if(cc < 1)
+ 1ad:	83 c4 10             	add    $0x10,%esp
+ 1b0:	85 c0                	test   %eax,%eax
+ 1b2:	7e 1d                	jle    1d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1bf:	3c 0a                	cmp    $0xa,%al
+ 1c1:	74 10                	je     1d3 <gets+0x43>
+ 1c3:	3c 0d                	cmp    $0xd,%al
+ 1c5:	74 0c                	je     1d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1c7:	89 df                	mov    %ebx,%edi
+ 1c9:	83 c3 01             	add    $0x1,%ebx
+ 1cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1cf:	7c cf                	jl     1a0 <gets+0x10>
+ 1d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1dd:	5b                   	pop    %ebx
+ 1de:	5e                   	pop    %esi
+ 1df:	5f                   	pop    %edi
+ 1e0:	5d                   	pop    %ebp
+ 1e1:	c3                   	ret
+ 1e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	56                   	push   %esi
+ 1f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f5:	83 ec 08             	sub    $0x8,%esp
+ 1f8:	6a 00                	push   $0x0
+ 1fa:	ff 75 08             	push   0x8(%ebp)
+ 1fd:	e8 e2 02 00 00       	call   4e4 <open>
+  if(fd < 0)
+ 202:	83 c4 10             	add    $0x10,%esp
+ 205:	85 c0                	test   %eax,%eax
+ 207:	78 27                	js     230 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 209:	83 ec 08             	sub    $0x8,%esp
+ 20c:	ff 75 0c             	push   0xc(%ebp)
+ 20f:	89 c3                	mov    %eax,%ebx
+ 211:	50                   	push   %eax
+ 212:	e8 ee 02 00 00       	call   505 <fstat>
+  close(fd);
+ 217:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 21a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 21c:	e8 a2 02 00 00       	call   4c3 <close>
+  return r;
+ 221:	83 c4 10             	add    $0x10,%esp
+}
+ 224:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 227:	89 f0                	mov    %esi,%eax
+ 229:	5b                   	pop    %ebx
+ 22a:	5e                   	pop    %esi
+ 22b:	5d                   	pop    %ebp
+ 22c:	c3                   	ret
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 230:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 235:	eb ed                	jmp    224 <stat+0x34>
+ 237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23e:	66 90                	xchg   %ax,%ax
+
+00000240 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	53                   	push   %ebx
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 247:	0f be 02             	movsbl (%edx),%eax
+ 24a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 24d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 250:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 255:	77 1e                	ja     275 <atoi+0x35>
+ 257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 260:	83 c2 01             	add    $0x1,%edx
+ 263:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 266:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 26a:	0f be 02             	movsbl (%edx),%eax
+ 26d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 270:	80 fb 09             	cmp    $0x9,%bl
+ 273:	76 eb                	jbe    260 <atoi+0x20>
+  return n;
+}
+ 275:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 278:	89 c8                	mov    %ecx,%eax
+ 27a:	c9                   	leave
+ 27b:	c3                   	ret
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	56                   	push   %esi
+ 285:	8b 45 10             	mov    0x10(%ebp),%eax
+ 288:	8b 55 08             	mov    0x8(%ebp),%edx
+ 28b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 28e:	85 c0                	test   %eax,%eax
+ 290:	7e 13                	jle    2a5 <memmove+0x25>
+ 292:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 294:	89 d7                	mov    %edx,%edi
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2a1:	39 f8                	cmp    %edi,%eax
+ 2a3:	75 fb                	jne    2a0 <memmove+0x20>
+  return vdst;
+}
+ 2a5:	5e                   	pop    %esi
+ 2a6:	89 d0                	mov    %edx,%eax
+ 2a8:	5f                   	pop    %edi
+ 2a9:	5d                   	pop    %ebp
+ 2aa:	c3                   	ret
+ 2ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2af:	90                   	nop
+
+000002b0 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 2b0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 2b5:	85 c0                	test   %eax,%eax
+ 2b7:	74 07                	je     2c0 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 2b9:	c3                   	ret
+ 2ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 2c0:	e9 77 02 00 00       	jmp    53c <sysgetpid>
+ 2c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 2d0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 2d5:	c3                   	ret
+ 2d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002e0 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 2e0:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 2e1:	31 d2                	xor    %edx,%edx
+ 2e3:	89 e5                	mov    %esp,%ebp
+ 2e5:	53                   	push   %ebx
+ 2e6:	83 ec 04             	sub    $0x4,%esp
+ 2e9:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 2ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 2ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 2f2:	85 c9                	test   %ecx,%ecx
+ 2f4:	7e 08                	jle    2fe <cyclereport+0x1e>
+ 2f6:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 2f8:	89 d8                	mov    %ebx,%eax
+ 2fa:	f7 f1                	div    %ecx
+ 2fc:	89 c2                	mov    %eax,%edx
+ 2fe:	83 ec 08             	sub    $0x8,%esp
+ 301:	52                   	push   %edx
+ 302:	ff 75 0c             	push   0xc(%ebp)
+ 305:	51                   	push   %ecx
+ 306:	ff 75 08             	push   0x8(%ebp)
+ 309:	68 3f 0a 00 00       	push   $0xa3f
+ 30e:	6a 01                	push   $0x1
+ 310:	e8 fb 03 00 00       	call   710 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 315:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 318:	83 c4 20             	add    $0x20,%esp
+ 31b:	c9                   	leave
+ 31c:	c3                   	ret
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000320 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 323:	8b 45 08             	mov    0x8(%ebp),%eax
+ 326:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 32c:	5d                   	pop    %ebp
+ 32d:	c3                   	ret
+ 32e:	66 90                	xchg   %ax,%ax
+
+00000330 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 330:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 331:	31 c0                	xor    %eax,%eax
+ 333:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 338:	89 e5                	mov    %esp,%ebp
+ 33a:	56                   	push   %esi
+ 33b:	53                   	push   %ebx
+ 33c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 33f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 343:	85 c0                	test   %eax,%eax
+ 345:	74 30                	je     377 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 347:	83 f8 02             	cmp    $0x2,%eax
+ 34a:	74 0c                	je     358 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 34c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 351:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 354:	85 c0                	test   %eax,%eax
+ 356:	74 1f                	je     377 <mutex_lock+0x47>
+ 358:	be 02 00 00 00       	mov    $0x2,%esi
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 360:	83 ec 08             	sub    $0x8,%esp
+ 363:	6a 02                	push   $0x2
+ 365:	53                   	push   %ebx
+ 366:	e8 8c 02 00 00       	call   5f7 <futex_wait>
+ 36b:	89 f0                	mov    %esi,%eax
+ 36d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 370:	83 c4 10             	add    $0x10,%esp
+ 373:	85 c0                	test   %eax,%eax
+ 375:	75 e9                	jne    360 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 377:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 37a:	5b                   	pop    %ebx
+ 37b:	5e                   	pop    %esi
+ 37c:	5d                   	pop    %ebp
+ 37d:	c3                   	ret
+ 37e:	66 90                	xchg   %ax,%ax
+
+00000380 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	83 ec 08             	sub    $0x8,%esp
+ 386:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 389:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 38d:	75 09                	jne    398 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 38f:	c9                   	leave
+ 390:	c3                   	ret
+ 391:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 398:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 39b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 3a1:	6a 01                	push   $0x1
+ 3a3:	50                   	push   %eax
+ 3a4:	e8 59 02 00 00       	call   602 <futex_wake>
+ 3a9:	83 c4 10             	add    $0x10,%esp
+}
+ 3ac:	c9                   	leave
+ 3ad:	c3                   	ret
+ 3ae:	66 90                	xchg   %ax,%ax
+
+000003b0 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 3b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3bc:	5d                   	pop    %ebp
+ 3bd:	c3                   	ret
+ 3be:	66 90                	xchg   %ax,%ax
+
+000003c0 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	57                   	push   %edi
+ 3c4:	56                   	push   %esi
+ 3c5:	53                   	push   %ebx
+ 3c6:	83 ec 0c             	sub    $0xc,%esp
+ 3c9:	8b 75 08             	mov    0x8(%ebp),%esi
+ 3cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 3cf:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 3d1:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 3d5:	75 21                	jne    3f8 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 3d7:	83 ec 08             	sub    $0x8,%esp
+ 3da:	57                   	push   %edi
+ 3db:	56                   	push   %esi
+ 3dc:	e8 16 02 00 00       	call   5f7 <futex_wait>
+  mutex_lock(m);
+ 3e1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 3e4:	83 c4 10             	add    $0x10,%esp
+}
+ 3e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3ea:	5b                   	pop    %ebx
+ 3eb:	5e                   	pop    %esi
+ 3ec:	5f                   	pop    %edi
+ 3ed:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 3ee:	e9 3d ff ff ff       	jmp    330 <mutex_lock>
+ 3f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3f7:	90                   	nop
+    futex_wake(&m->v, 1);
+ 3f8:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 3fb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 401:	6a 01                	push   $0x1
+ 403:	53                   	push   %ebx
+ 404:	e8 f9 01 00 00       	call   602 <futex_wake>
+ 409:	83 c4 10             	add    $0x10,%esp
+ 40c:	eb c9                	jmp    3d7 <cond_wait+0x17>
+ 40e:	66 90                	xchg   %ax,%ax
+
+00000410 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	83 ec 10             	sub    $0x10,%esp
+ 416:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 419:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 41d:	6a 01                	push   $0x1
+ 41f:	50                   	push   %eax
+ 420:	e8 dd 01 00 00       	call   602 <futex_wake>
+}
+ 425:	83 c4 10             	add    $0x10,%esp
+ 428:	c9                   	leave
+ 429:	c3                   	ret
+ 42a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000430 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	83 ec 10             	sub    $0x10,%esp
+ 436:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 439:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 43d:	68 ff ff ff 7f       	push   $0x7fffffff
+ 442:	50                   	push   %eax
+ 443:	e8 ba 01 00 00       	call   602 <futex_wake>
+}
+ 448:	83 c4 10             	add    $0x10,%esp
+ 44b:	c9                   	leave
+ 44c:	c3                   	ret
+
+0000044d <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 44d:	50                   	push   %eax
+  pushl %ebx
+ 44e:	53                   	push   %ebx
+  movl $1, %eax
+ 44f:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 454:	0f a2                	cpuid
+  popl %ebx
+ 456:	5b                   	pop    %ebx
+  popl %eax
+ 457:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 458:	c7 05 b0 0e 00 00 7e 	movl   $0x47e,0xeb0
+ 45f:	04 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 462:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 468:	74 14                	je     47e <sysint>
+  movl $sysfast, syscallvec
+ 46a:	c7 05 b0 0e 00 00 74 	movl   $0x474,0xeb0
+ 471:	04 00 00 
+
+00000474 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 474:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 476:	ba 7d 04 00 00       	mov    $0x47d,%edx
+  sysenter
+ 47b:	0f 34                	sysenter
+1:
+  ret
+ 47d:	c3                   	ret
+
+0000047e <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 47e:	cd 40                	int    $0x40
+  ret
+ 480:	c3                   	ret
+
+00000481 <fork>:
+
+SYSCALL(fork)
+ 481:	b8 01 00 00 00       	mov    $0x1,%eax
+ 486:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+0000048c <exit>:
+SYSCALL(exit)
+ 48c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 491:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+00000497 <wait>:
+SYSCALL(wait)
+ 497:	b8 03 00 00 00       	mov    $0x3,%eax
+ 49c:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+000004a2 <pipe>:
+SYSCALL(pipe)
+ 4a2:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4a7:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+000004ad <read>:
+SYSCALL(read)
+ 4ad:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4b2:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+000004b8 <write>:
+SYSCALL(write)
+ 4b8:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4bd:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+000004c3 <close>:
+SYSCALL(close)
+ 4c3:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4c8:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+000004ce <kill>:
+SYSCALL(kill)
+ 4ce:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4d3:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+000004d9 <exec>:
+SYSCALL(exec)
+ 4d9:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4de:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+000004e4 <open>:
+SYSCALL(open)
+ 4e4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4e9:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+000004ef <mknod>:
+SYSCALL(mknod)
+ 4ef:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4f4:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+000004fa <unlink>:
+SYSCALL(unlink)
+ 4fa:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4ff:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+00000505 <fstat>:
+SYSCALL(fstat)
+ 505:	b8 08 00 00 00       	mov    $0x8,%eax
+ 50a:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+00000510 <link>:
+SYSCALL(link)
+ 510:	b8 13 00 00 00       	mov    $0x13,%eax
+ 515:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+0000051b <mkdir>:
+SYSCALL(mkdir)
+ 51b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 520:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+00000526 <chdir>:
+SYSCALL(chdir)
+ 526:	b8 09 00 00 00       	mov    $0x9,%eax
+ 52b:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+00000531 <dup>:
+SYSCALL(dup)
+ 531:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 536:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+0000053c <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 53c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 541:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+00000547 <sbrk>:
+SYSCALL(sbrk)
+ 547:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 54c:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+00000552 <sleep>:
+SYSCALL(sleep)
+ 552:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 557:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+0000055d <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 55d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 562:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+00000568 <swapread>:
+SYSCALL(swapread)
+ 568:	b8 16 00 00 00       	mov    $0x16,%eax
+ 56d:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+00000573 <swapwrite>:
+SYSCALL(swapwrite)
+ 573:	b8 17 00 00 00       	mov    $0x17,%eax
+ 578:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+0000057e <swapstat>:
+SYSCALL(swapstat)
+ 57e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 583:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+00000589 <madvise>:
+SYSCALL(madvise)
+ 589:	b8 19 00 00 00       	mov    $0x19,%eax
+ 58e:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+00000594 <mlock>:
+SYSCALL(mlock)
+ 594:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 599:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+0000059f <munlock>:
+SYSCALL(munlock)
+ 59f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5a4:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+000005aa <membench>:
+SYSCALL(membench)
+ 5aa:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5af:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+000005b5 <nice>:
+SYSCALL(nice)
+ 5b5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5ba:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+000005c0 <setpriority>:
+SYSCALL(setpriority)
+ 5c0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5c5:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+000005cb <usleep>:
+SYSCALL(usleep)
+ 5cb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5d0:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+000005d6 <cpustat>:
+SYSCALL(cpustat)
+ 5d6:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5db:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+000005e1 <clone>:
+SYSCALL(clone)
+ 5e1:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5e6:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+000005ec <join>:
+SYSCALL(join)
+ 5ec:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5f1:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+000005f7 <futex_wait>:
+SYSCALL(futex_wait)
+ 5f7:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5fc:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+00000602 <futex_wake>:
+SYSCALL(futex_wake)
+ 602:	b8 24 00 00 00       	mov    $0x24,%eax
+ 607:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+0000060d <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 60d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 612:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+00000618 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 618:	b8 26 00 00 00       	mov    $0x26,%eax
+ 61d:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+00000623 <getcpu>:
+SYSCALL(getcpu)
+ 623:	b8 27 00 00 00       	mov    $0x27,%eax
+ 628:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+0000062e <migrations>:
+SYSCALL(migrations)
+ 62e:	b8 28 00 00 00       	mov    $0x28,%eax
+ 633:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+00000639 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 639:	b8 29 00 00 00       	mov    $0x29,%eax
+ 63e:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+00000644 <lockstat>:
+SYSCALL(lockstat)
+ 644:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 649:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+0000064f <lockprof>:
+SYSCALL(lockprof)
+ 64f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 654:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+
+0000065a <bcachestat>:
+SYSCALL(bcachestat)
+ 65a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 65f:	ff 25 b0 0e 00 00    	jmp    *0xeb0
+ 665:	66 90                	xchg   %ax,%ax
+ 667:	66 90                	xchg   %ax,%ax
+ 669:	66 90                	xchg   %ax,%ax
+ 66b:	66 90                	xchg   %ax,%ax
+ 66d:	66 90                	xchg   %ax,%ax
+ 66f:	90                   	nop
+
+00000670 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 670:	55                   	push   %ebp
+ 671:	89 e5                	mov    %esp,%ebp
+ 673:	57                   	push   %edi
+ 674:	56                   	push   %esi
+ 675:	53                   	push   %ebx
+ 676:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 678:	89 d1                	mov    %edx,%ecx
+{
+ 67a:	83 ec 3c             	sub    $0x3c,%esp
+ 67d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 680:	85 d2                	test   %edx,%edx
+ 682:	0f 89 80 00 00 00    	jns    708 <printint+0x98>
+ 688:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 68c:	74 7a                	je     708 <printint+0x98>
+    x = -xx;
+ 68e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 690:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 695:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 698:	31 f6                	xor    %esi,%esi
+ 69a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 6a0:	89 c8                	mov    %ecx,%eax
+ 6a2:	31 d2                	xor    %edx,%edx
+ 6a4:	89 f7                	mov    %esi,%edi
+ 6a6:	f7 f3                	div    %ebx
+ 6a8:	8d 76 01             	lea    0x1(%esi),%esi
+ 6ab:	0f b6 92 bc 0a 00 00 	movzbl 0xabc(%edx),%edx
+ 6b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 6b6:	89 ca                	mov    %ecx,%edx
+ 6b8:	89 c1                	mov    %eax,%ecx
+ 6ba:	39 da                	cmp    %ebx,%edx
+ 6bc:	73 e2                	jae    6a0 <printint+0x30>
+  if(neg)
+ 6be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 6c1:	85 c0                	test   %eax,%eax
+ 6c3:	74 07                	je     6cc <printint+0x5c>
+    buf[i++] = '-';
+ 6c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 6ca:	89 f7                	mov    %esi,%edi
+ 6cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 6cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 6d2:	01 df                	add    %ebx,%edi
+ 6d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 6d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 6db:	83 ec 04             	sub    $0x4,%esp
+ 6de:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 6e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 6e4:	6a 01                	push   $0x1
+ 6e6:	50                   	push   %eax
+ 6e7:	56                   	push   %esi
+ 6e8:	e8 cb fd ff ff       	call   4b8 <write>
+  while(--i >= 0)
+ 6ed:	89 f8                	mov    %edi,%eax
+ 6ef:	83 c4 10             	add    $0x10,%esp
+ 6f2:	83 ef 01             	sub    $0x1,%edi
+ 6f5:	39 d8                	cmp    %ebx,%eax
+ 6f7:	75 df                	jne    6d8 <printint+0x68>
+}
+ 6f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6fc:	5b                   	pop    %ebx
+ 6fd:	5e                   	pop    %esi
+ 6fe:	5f                   	pop    %edi
+ 6ff:	5d                   	pop    %ebp
+ 700:	c3                   	ret
+ 701:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 708:	31 c0                	xor    %eax,%eax
+ 70a:	eb 89                	jmp    695 <printint+0x25>
+ 70c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000710 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	57                   	push   %edi
+ 714:	56                   	push   %esi
+ 715:	53                   	push   %ebx
+ 716:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 719:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 71c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 71f:	0f b6 1e             	movzbl (%esi),%ebx
+ 722:	83 c6 01             	add    $0x1,%esi
+ 725:	84 db                	test   %bl,%bl
+ 727:	74 67                	je     790 <printf+0x80>
+ 729:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 72c:	31 d2                	xor    %edx,%edx
+ 72e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 731:	eb 34                	jmp    767 <printf+0x57>
+ 733:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 737:	90                   	nop
+ 738:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 73b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 740:	83 f8 25             	cmp    $0x25,%eax
+ 743:	74 18                	je     75d <printf+0x4d>
+  write(fd, &c, 1);
+ 745:	83 ec 04             	sub    $0x4,%esp
+ 748:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 74b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 74e:	6a 01                	push   $0x1
+ 750:	50                   	push   %eax
+ 751:	57                   	push   %edi
+ 752:	e8 61 fd ff ff       	call   4b8 <write>
+ 757:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 75a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 75d:	0f b6 1e             	movzbl (%esi),%ebx
+ 760:	83 c6 01             	add    $0x1,%esi
+ 763:	84 db                	test   %bl,%bl
+ 765:	74 29                	je     790 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 767:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 76a:	85 d2                	test   %edx,%edx
+ 76c:	74 ca                	je     738 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 76e:	83 fa 25             	cmp    $0x25,%edx
+ 771:	75 ea                	jne    75d <printf+0x4d>
+      if(c == 'd'){
+ 773:	83 f8 25             	cmp    $0x25,%eax
+ 776:	0f 84 24 01 00 00    	je     8a0 <printf+0x190>
+ 77c:	83 e8 63             	sub    $0x63,%eax
+ 77f:	83 f8 15             	cmp    $0x15,%eax
+ 782:	77 1c                	ja     7a0 <printf+0x90>
+ 784:	ff 24 85 64 0a 00 00 	jmp    *0xa64(,%eax,4)
+ 78b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 78f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 790:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 793:	5b                   	pop    %ebx
+ 794:	5e                   	pop    %esi
+ 795:	5f                   	pop    %edi
+ 796:	5d                   	pop    %ebp
+ 797:	c3                   	ret
+ 798:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79f:	90                   	nop
+  write(fd, &c, 1);
+ 7a0:	83 ec 04             	sub    $0x4,%esp
+ 7a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 7aa:	6a 01                	push   $0x1
+ 7ac:	52                   	push   %edx
+ 7ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 7b0:	57                   	push   %edi
+ 7b1:	e8 02 fd ff ff       	call   4b8 <write>
+ 7b6:	83 c4 0c             	add    $0xc,%esp
+ 7b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7bc:	6a 01                	push   $0x1
+ 7be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 7c1:	52                   	push   %edx
+ 7c2:	57                   	push   %edi
+ 7c3:	e8 f0 fc ff ff       	call   4b8 <write>
+        putc(fd, c);
+ 7c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7cb:	31 d2                	xor    %edx,%edx
+ 7cd:	eb 8e                	jmp    75d <printf+0x4d>
+ 7cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 7d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7d3:	83 ec 0c             	sub    $0xc,%esp
+ 7d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7db:	8b 13                	mov    (%ebx),%edx
+ 7dd:	6a 00                	push   $0x0
+ 7df:	89 f8                	mov    %edi,%eax
+        ap++;
+ 7e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 7e4:	e8 87 fe ff ff       	call   670 <printint>
+        ap++;
+ 7e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7ef:	31 d2                	xor    %edx,%edx
+ 7f1:	e9 67 ff ff ff       	jmp    75d <printf+0x4d>
+ 7f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 800:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 803:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 805:	83 c0 04             	add    $0x4,%eax
+ 808:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 80b:	85 db                	test   %ebx,%ebx
+ 80d:	0f 84 9d 00 00 00    	je     8b0 <printf+0x1a0>
+        while(*s != 0){
+ 813:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 816:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 818:	84 c0                	test   %al,%al
+ 81a:	0f 84 3d ff ff ff    	je     75d <printf+0x4d>
+ 820:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 823:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 826:	89 de                	mov    %ebx,%esi
+ 828:	89 d3                	mov    %edx,%ebx
+ 82a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 830:	83 ec 04             	sub    $0x4,%esp
+ 833:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 836:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 839:	6a 01                	push   $0x1
+ 83b:	53                   	push   %ebx
+ 83c:	57                   	push   %edi
+ 83d:	e8 76 fc ff ff       	call   4b8 <write>
+        while(*s != 0){
+ 842:	0f b6 06             	movzbl (%esi),%eax
+ 845:	83 c4 10             	add    $0x10,%esp
+ 848:	84 c0                	test   %al,%al
+ 84a:	75 e4                	jne    830 <printf+0x120>
+      state = 0;
+ 84c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 84f:	31 d2                	xor    %edx,%edx
+ 851:	e9 07 ff ff ff       	jmp    75d <printf+0x4d>
+ 856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 860:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 863:	83 ec 0c             	sub    $0xc,%esp
+ 866:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 86b:	8b 13                	mov    (%ebx),%edx
+ 86d:	6a 01                	push   $0x1
+ 86f:	e9 6b ff ff ff       	jmp    7df <printf+0xcf>
+ 874:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 878:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 87b:	83 ec 04             	sub    $0x4,%esp
+ 87e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 881:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 883:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 886:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 889:	6a 01                	push   $0x1
+ 88b:	52                   	push   %edx
+ 88c:	57                   	push   %edi
+ 88d:	e8 26 fc ff ff       	call   4b8 <write>
+        ap++;
+ 892:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 895:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 898:	31 d2                	xor    %edx,%edx
+ 89a:	e9 be fe ff ff       	jmp    75d <printf+0x4d>
+ 89f:	90                   	nop
+  write(fd, &c, 1);
+ 8a0:	83 ec 04             	sub    $0x4,%esp
+ 8a3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8a6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8a9:	6a 01                	push   $0x1
+ 8ab:	e9 11 ff ff ff       	jmp    7c1 <printf+0xb1>
+ 8b0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 8b5:	bb 5a 0a 00 00       	mov    $0xa5a,%ebx
+ 8ba:	e9 61 ff ff ff       	jmp    820 <printf+0x110>
+ 8bf:	90                   	nop
+
+000008c0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8c0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8c1:	a1 b4 0e 00 00       	mov    0xeb4,%eax
+{
+ 8c6:	89 e5                	mov    %esp,%ebp
+ 8c8:	57                   	push   %edi
+ 8c9:	56                   	push   %esi
+ 8ca:	53                   	push   %ebx
+ 8cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 8ce:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8d8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8da:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8dc:	39 ca                	cmp    %ecx,%edx
+ 8de:	73 30                	jae    910 <free+0x50>
+ 8e0:	39 c1                	cmp    %eax,%ecx
+ 8e2:	72 04                	jb     8e8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8e4:	39 c2                	cmp    %eax,%edx
+ 8e6:	72 f0                	jb     8d8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8e8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 8eb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 8ee:	39 f8                	cmp    %edi,%eax
+ 8f0:	74 2e                	je     920 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8f2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8f5:	8b 42 04             	mov    0x4(%edx),%eax
+ 8f8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8fb:	39 f1                	cmp    %esi,%ecx
+ 8fd:	74 38                	je     937 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8ff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 901:	5b                   	pop    %ebx
+  freep = p;
+ 902:	89 15 b4 0e 00 00    	mov    %edx,0xeb4
+}
+ 908:	5e                   	pop    %esi
+ 909:	5f                   	pop    %edi
+ 90a:	5d                   	pop    %ebp
+ 90b:	c3                   	ret
+ 90c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 910:	39 c1                	cmp    %eax,%ecx
+ 912:	72 d0                	jb     8e4 <free+0x24>
+ 914:	eb c2                	jmp    8d8 <free+0x18>
+ 916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 920:	03 70 04             	add    0x4(%eax),%esi
+ 923:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 926:	8b 02                	mov    (%edx),%eax
+ 928:	8b 00                	mov    (%eax),%eax
+ 92a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 92d:	8b 42 04             	mov    0x4(%edx),%eax
+ 930:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 933:	39 f1                	cmp    %esi,%ecx
+ 935:	75 c8                	jne    8ff <free+0x3f>
+    p->s.size += bp->s.size;
+ 937:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 93a:	89 15 b4 0e 00 00    	mov    %edx,0xeb4
+    p->s.size += bp->s.size;
+ 940:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 943:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 946:	89 0a                	mov    %ecx,(%edx)
+}
+ 948:	5b                   	pop    %ebx
+ 949:	5e                   	pop    %esi
+ 94a:	5f                   	pop    %edi
+ 94b:	5d                   	pop    %ebp
+ 94c:	c3                   	ret
+ 94d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000950 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 950:	55                   	push   %ebp
+ 951:	89 e5                	mov    %esp,%ebp
+ 953:	57                   	push   %edi
+ 954:	56                   	push   %esi
+ 955:	53                   	push   %ebx
+ 956:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 959:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 95c:	8b 15 b4 0e 00 00    	mov    0xeb4,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 962:	8d 78 07             	lea    0x7(%eax),%edi
+ 965:	c1 ef 03             	shr    $0x3,%edi
+ 968:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 96b:	85 d2                	test   %edx,%edx
+ 96d:	0f 84 8d 00 00 00    	je     a00 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 973:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 975:	8b 48 04             	mov    0x4(%eax),%ecx
+ 978:	39 f9                	cmp    %edi,%ecx
+ 97a:	73 64                	jae    9e0 <malloc+0x90>
+  if(nu < 4096)
+ 97c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 981:	39 df                	cmp    %ebx,%edi
+ 983:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 986:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 98d:	eb 0a                	jmp    999 <malloc+0x49>
+ 98f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 990:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 992:	8b 48 04             	mov    0x4(%eax),%ecx
+ 995:	39 f9                	cmp    %edi,%ecx
+ 997:	73 47                	jae    9e0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 999:	89 c2                	mov    %eax,%edx
+ 99b:	39 05 b4 0e 00 00    	cmp    %eax,0xeb4
+ 9a1:	75 ed                	jne    990 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 9a3:	83 ec 0c             	sub    $0xc,%esp
+ 9a6:	56                   	push   %esi
+ 9a7:	e8 9b fb ff ff       	call   547 <sbrk>
+  if(p == (char*)-1)
+ 9ac:	83 c4 10             	add    $0x10,%esp
+ 9af:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9b2:	74 1c                	je     9d0 <malloc+0x80>
+  hp->s.size = nu;
+ 9b4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9b7:	83 ec 0c             	sub    $0xc,%esp
+ 9ba:	83 c0 08             	add    $0x8,%eax
+ 9bd:	50                   	push   %eax
+ 9be:	e8 fd fe ff ff       	call   8c0 <free>
+  return freep;
+ 9c3:	8b 15 b4 0e 00 00    	mov    0xeb4,%edx
+      if((p = morecore(nunits)) == 0)
+ 9c9:	83 c4 10             	add    $0x10,%esp
+ 9cc:	85 d2                	test   %edx,%edx
+ 9ce:	75 c0                	jne    990 <malloc+0x40>
+        return 0;
+  }
+}
+ 9d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 9d3:	31 c0                	xor    %eax,%eax
+}
+ 9d5:	5b                   	pop    %ebx
+ 9d6:	5e                   	pop    %esi
+ 9d7:	5f                   	pop    %edi
+ 9d8:	5d                   	pop    %ebp
+ 9d9:	c3                   	ret
+ 9da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 9e0:	39 cf                	cmp    %ecx,%edi
+ 9e2:	74 4c                	je     a30 <malloc+0xe0>
+        p->s.size -= nunits;
+ 9e4:	29 f9                	sub    %edi,%ecx
+ 9e6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 9e9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 9ec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 9ef:	89 15 b4 0e 00 00    	mov    %edx,0xeb4
+}
+ 9f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 9f8:	83 c0 08             	add    $0x8,%eax
+}
+ 9fb:	5b                   	pop    %ebx
+ 9fc:	5e                   	pop    %esi
+ 9fd:	5f                   	pop    %edi
+ 9fe:	5d                   	pop    %ebp
+ 9ff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a00:	c7 05 b4 0e 00 00 b8 	movl   $0xeb8,0xeb4
+ a07:	0e 00 00 
+    base.s.size = 0;
+ a0a:	b8 b8 0e 00 00       	mov    $0xeb8,%eax
+    base.s.ptr = freep = prevp = &base;
+ a0f:	c7 05 b8 0e 00 00 b8 	movl   $0xeb8,0xeb8
+ a16:	0e 00 00 
+    base.s.size = 0;
+ a19:	c7 05 bc 0e 00 00 00 	movl   $0x0,0xebc
+ a20:	00 00 00 
+    if(p->s.size >= nunits){
+ a23:	e9 54 ff ff ff       	jmp    97c <malloc+0x2c>
+ a28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a30:	8b 08                	mov    (%eax),%ecx
+ a32:	89 0a                	mov    %ecx,(%edx)
+ a34:	eb b9                	jmp    9ef <malloc+0x9f>
@@ -2,6 +2,7 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "defs.h"
 #include "x86.h"
@@ -37,6 +38,8 @@ exec(char *path, char **argv)
 
   if((pgdir = setupkvm()) == 0)
     goto bad;
+  if(mapinfo(pgdir, curproc->pid) < 0)
+    goto bad;
 
   // Load program into memory.
   sz = 0;
@@ -93,14 +96,18 @@ exec(char *path, char **argv)
       last = s+1;
   safestrcpy(curproc->name, last, sizeof(curproc->name));
 
-  // Commit to the user image.
-  oldpgdir = curproc->pgdir;
-  curproc->pgdir = pgdir;
+  // Commit to the user image.  The arguments, pinned in the
+  // old one, have been copied out.
+  unpinargs(0);
+  oldpgdir = vmreplace(pgdir);
   curproc->sz = sz;
   curproc->tf->eip = elf.entry;  // main
   curproc->tf->esp = sp;
   switchuvm(curproc);
-  freevm(oldpgdir);
+  fpureset();
+  lru_addvm(pgdir, sz);
+  if(oldpgdir)
+    freevm(oldpgdir);
   return 0;
 
  bad:
@@ -5,6 +5,7 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "fs.h"
 #include "spinlock.h"
 #include "sleeplock.h"
@@ -14,6 +15,7 @@ struct devsw devsw[NDEV];
 struct {
   struct spinlock lock;
   struct file file[NFILE];
+  struct fdtable *fdtfree;
 } ftable;
 
 void
@@ -79,6 +81,116 @@ fileclose(struct file *f)
   }
 }
 
+// Allocate an empty file table.  Like procs, tables are
+// carved from whole pages and never freed.
+struct fdtable*
+fdtalloc(void)
+{
+  struct fdtable *t;
+  char *mem;
+  int i;
+
+  acquire(&ftable.lock);
+  while(ftable.fdtfree == 0){
+    release(&ftable.lock);
+    if((mem = kalloc()) == 0)
+      return 0;
+    memset(mem, 0, PGSIZE);
+    acquire(&ftable.lock);
+    for(i = 0; i + sizeof(*t) <= PGSIZE; i += sizeof(*t)){
+      t = (struct fdtable*)(mem + i);
+      initlock(&t->lock, "fdtable");
+      t->next = ftable.fdtfree;
+      ftable.fdtfree = t;
+    }
+  }
+  t = ftable.fdtfree;
+  ftable.fdtfree = t->next;
+  t->ref = 1;
+  release(&ftable.lock);
+  return t;
+}
+
+// Allocate a copy of t, with its own references to t's
+// open files and current directory, for fork().
+struct fdtable*
+fdtcopy(struct fdtable *t)
+{
+  struct fdtable *nt;
+  int i;
+
+  if((nt = fdtalloc()) == 0)
+    return 0;
+  acquire(&t->lock);
+  for(i = 0; i < NOFILE; i++)
+    if(t->ofile[i])
+      nt->ofile[i] = filedup(t->ofile[i]);
+  nt->cwd = idup(t->cwd);
+  release(&t->lock);
+  return nt;
+}
+
+// Increment ref count for file table t, for clone().
+struct fdtable*
+fdtdup(struct fdtable *t)
+{
+  acquire(&ftable.lock);
+  if(t->ref < 1)
+    panic("fdtdup");
+  t->ref++;
+  release(&ftable.lock);
+  return t;
+}
+
+// Drop a reference to file table t.  The last one
+// closes its files and releases its directory.
+void
+fdtput(struct fdtable *t)
+{
+  int fd;
+
+  acquire(&ftable.lock);
+  if(t->ref < 1)
+    panic("fdtput");
+  if(t->ref > 1){
+    t->ref--;
+    release(&ftable.lock);
+    return;
+  }
+  release(&ftable.lock);
+
+  // Nobody else can reach t now.
+  for(fd = 0; fd < NOFILE; fd++){
+    if(t->ofile[fd]){
+      fileclose(t->ofile[fd]);
+      t->ofile[fd] = 0;
+    }
+  }
+  begin_op();
+  iput(t->cwd);
+  end_op();
+  t->cwd = 0;
+
+  acquire(&ftable.lock);
+  t->ref = 0;
+  t->next = ftable.fdtfree;
+  ftable.fdtfree = t;
+  release(&ftable.lock);
+}
+
+// Return a new reference to t's current directory,
+// which another thread may be changing.
+struct inode*
+fdtcwd(struct fdtable *t)
+{
+  struct inode *ip;
+
+  acquire(&t->lock);
+  ip = idup(t->cwd);
+  release(&t->lock);
+  return ip;
+}
+
 // Get metadata about file f.
 int
 filestat(struct file *f, struct stat *st)
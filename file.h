@@ -8,12 +8,25 @@ struct file {
   uint off;
 };
 
+// A process's open files and current directory, shared by
+// the threads clone() makes.  lock guards ofile and cwd;
+// ftable.lock guards ref and next.
+struct fdtable {
+  struct spinlock lock;
+  int ref;                     // Processes using it
+  struct file *ofile[NOFILE];  // Open files
+  struct inode *cwd;           // Current directory
+  struct fdtable *next;        // Next on the free list
+};
+
 
 // in-memory copy of an inode
 struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
-  int ref;            // Reference count
+  int ref;            // Reference count, -1 while being evicted
+  struct inode *hashnext; // Next in icache hash bucket or free list
+  struct inode *evictnext; // Next evicted, waiting for rcusync()
   struct sleeplock lock; // protects everything below here
   int valid;          // inode has been read from disk?
 
@@ -0,0 +1,1777 @@
+
+_forkbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  cyclereport(what, "children", t, n);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 19                	mov    (%ecx),%ebx
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i, n, nidle;
+  uint64 t;
+
+  n = 2000;
+  nidle = 256;
+  if(argc > 1)
+  19:	83 fb 01             	cmp    $0x1,%ebx
+  1c:	0f 8f cf 00 00 00    	jg     f1 <main+0xf1>
+  if(n < 1)
+    n = 1;
+  if(nidle < 1 || nidle > NIDLE)
+    nidle = 256;
+
+  forks("fork+exit+wait", n);
+  22:	56                   	push   %esi
+  nidle = 256;
+  23:	bb 00 01 00 00       	mov    $0x100,%ebx
+  forks("fork+exit+wait", n);
+  28:	56                   	push   %esi
+  if(n < 1)
+  29:	be d0 07 00 00       	mov    $0x7d0,%esi
+  forks("fork+exit+wait", n);
+  2e:	68 d0 07 00 00       	push   $0x7d0
+  33:	68 f9 0b 00 00       	push   $0xbf9
+  38:	e8 43 01 00 00       	call   180 <forks>
+  3d:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < nidle; i++){
+  40:	31 ff                	xor    %edi,%edi
+  42:	eb 11                	jmp    55 <main+0x55>
+  44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((idle[i] = fork()) < 0){
+      printf(1, "forkbench: only %d idle processes\n", i);
+      break;
+    }
+    if(idle[i] == 0){
+  48:	0f 84 dc 00 00 00    	je     12a <main+0x12a>
+  for(i = 0; i < nidle; i++){
+  4e:	83 c7 01             	add    $0x1,%edi
+  51:	39 df                	cmp    %ebx,%edi
+  53:	74 23                	je     78 <main+0x78>
+    if((idle[i] = fork()) < 0){
+  55:	e8 c7 05 00 00       	call   621 <fork>
+  5a:	89 04 bd 40 11 00 00 	mov    %eax,0x1140(,%edi,4)
+  61:	85 c0                	test   %eax,%eax
+  63:	79 e3                	jns    48 <main+0x48>
+      printf(1, "forkbench: only %d idle processes\n", i);
+  65:	52                   	push   %edx
+      break;
+  66:	89 fb                	mov    %edi,%ebx
+      printf(1, "forkbench: only %d idle processes\n", i);
+  68:	57                   	push   %edi
+  69:	68 44 0c 00 00       	push   $0xc44
+  6e:	6a 01                	push   $0x1
+  70:	e8 3b 08 00 00       	call   8b0 <printf>
+      break;
+  75:	83 c4 10             	add    $0x10,%esp
+      sleep(1000000);
+      exit();
+    }
+  }
+  nidle = i;
+  forks("fork+exit+wait, with idle processes", n);
+  78:	50                   	push   %eax
+  79:	50                   	push   %eax
+  7a:	56                   	push   %esi
+  7b:	68 68 0c 00 00       	push   $0xc68
+  80:	e8 fb 00 00 00       	call   180 <forks>
+
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+  85:	0f 31                	rdtsc
+  87:	89 45 e0             	mov    %eax,-0x20(%ebp)
+
+  t = rdtsc();
+  for(i = nidle-1; i >= 0; i--)
+  8a:	8d 73 ff             	lea    -0x1(%ebx),%esi
+  8d:	83 c4 10             	add    $0x10,%esp
+  90:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  93:	85 db                	test   %ebx,%ebx
+  95:	74 23                	je     ba <main+0xba>
+  97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9e:	66 90                	xchg   %ax,%ax
+    kill(idle[i]);
+  a0:	83 ec 0c             	sub    $0xc,%esp
+  a3:	ff 34 b5 40 11 00 00 	push   0x1140(,%esi,4)
+  for(i = nidle-1; i >= 0; i--)
+  aa:	83 ee 01             	sub    $0x1,%esi
+    kill(idle[i]);
+  ad:	e8 bc 05 00 00       	call   66e <kill>
+  for(i = nidle-1; i >= 0; i--)
+  b2:	83 c4 10             	add    $0x10,%esp
+  b5:	83 fe ff             	cmp    $0xffffffff,%esi
+  b8:	75 e6                	jne    a0 <main+0xa0>
+  ba:	0f 31                	rdtsc
+  t = rdtsc() - t;
+  cyclereport("kill", "processes", t, nidle);
+  bc:	83 ec 0c             	sub    $0xc,%esp
+  bf:	53                   	push   %ebx
+  t = rdtsc() - t;
+  c0:	2b 45 e0             	sub    -0x20(%ebp),%eax
+  c3:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+  cyclereport("kill", "processes", t, nidle);
+  c6:	52                   	push   %edx
+  c7:	50                   	push   %eax
+  c8:	68 08 0c 00 00       	push   $0xc08
+  cd:	68 12 0c 00 00       	push   $0xc12
+  d2:	e8 a9 03 00 00       	call   480 <cyclereport>
+  for(i = 0; i < nidle; i++)
+  d7:	83 c4 20             	add    $0x20,%esp
+  da:	85 db                	test   %ebx,%ebx
+  dc:	74 0e                	je     ec <main+0xec>
+  de:	31 f6                	xor    %esi,%esi
+    wait();
+  e0:	e8 52 05 00 00       	call   637 <wait>
+  for(i = 0; i < nidle; i++)
+  e5:	83 c6 01             	add    $0x1,%esi
+  e8:	39 de                	cmp    %ebx,%esi
+  ea:	75 f4                	jne    e0 <main+0xe0>
+  exit();
+  ec:	e8 3b 05 00 00       	call   62c <exit>
+    n = atoi(argv[1]);
+  f1:	83 ec 0c             	sub    $0xc,%esp
+  f4:	ff 77 04             	push   0x4(%edi)
+  f7:	e8 e4 02 00 00       	call   3e0 <atoi>
+  if(argc > 2)
+  fc:	83 c4 10             	add    $0x10,%esp
+    n = atoi(argv[1]);
+  ff:	89 c6                	mov    %eax,%esi
+  if(argc > 2)
+ 101:	83 fb 02             	cmp    $0x2,%ebx
+ 104:	75 36                	jne    13c <main+0x13c>
+  if(n < 1)
+ 106:	85 c0                	test   %eax,%eax
+ 108:	b8 01 00 00 00       	mov    $0x1,%eax
+ 10d:	0f 4e f0             	cmovle %eax,%esi
+  forks("fork+exit+wait", n);
+ 110:	53                   	push   %ebx
+ 111:	53                   	push   %ebx
+    nidle = 256;
+ 112:	bb 00 01 00 00       	mov    $0x100,%ebx
+  forks("fork+exit+wait", n);
+ 117:	56                   	push   %esi
+ 118:	68 f9 0b 00 00       	push   $0xbf9
+ 11d:	e8 5e 00 00 00       	call   180 <forks>
+ 122:	83 c4 10             	add    $0x10,%esp
+ 125:	e9 16 ff ff ff       	jmp    40 <main+0x40>
+      sleep(1000000);
+ 12a:	83 ec 0c             	sub    $0xc,%esp
+ 12d:	68 40 42 0f 00       	push   $0xf4240
+ 132:	e8 bb 05 00 00       	call   6f2 <sleep>
+      exit();
+ 137:	e8 f0 04 00 00       	call   62c <exit>
+    nidle = atoi(argv[2]);
+ 13c:	83 ec 0c             	sub    $0xc,%esp
+ 13f:	ff 77 08             	push   0x8(%edi)
+ 142:	e8 99 02 00 00       	call   3e0 <atoi>
+  if(n < 1)
+ 147:	85 f6                	test   %esi,%esi
+    nidle = atoi(argv[2]);
+ 149:	89 c3                	mov    %eax,%ebx
+  if(n < 1)
+ 14b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 150:	0f 4e f0             	cmovle %eax,%esi
+  if(nidle < 1 || nidle > NIDLE)
+ 153:	8d 43 ff             	lea    -0x1(%ebx),%eax
+ 156:	83 c4 10             	add    $0x10,%esp
+ 159:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+ 15e:	77 b0                	ja     110 <main+0x110>
+  forks("fork+exit+wait", n);
+ 160:	51                   	push   %ecx
+ 161:	51                   	push   %ecx
+ 162:	56                   	push   %esi
+ 163:	68 f9 0b 00 00       	push   $0xbf9
+ 168:	e8 13 00 00 00       	call   180 <forks>
+ 16d:	83 c4 10             	add    $0x10,%esp
+ 170:	e9 cb fe ff ff       	jmp    40 <main+0x40>
+ 175:	66 90                	xchg   %ax,%ax
+ 177:	66 90                	xchg   %ax,%ax
+ 179:	66 90                	xchg   %ax,%ax
+ 17b:	66 90                	xchg   %ax,%ax
+ 17d:	66 90                	xchg   %ax,%ax
+ 17f:	90                   	nop
+
+00000180 <forks>:
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	56                   	push   %esi
+ 185:	53                   	push   %ebx
+ 186:	83 ec 1c             	sub    $0x1c,%esp
+ 189:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 18c:	0f 31                	rdtsc
+ 18e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 191:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  for(i = 0; i < n; i++){
+ 194:	85 f6                	test   %esi,%esi
+ 196:	7e 25                	jle    1bd <forks+0x3d>
+ 198:	31 db                	xor    %ebx,%ebx
+ 19a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if((pid = fork()) < 0){
+ 1a0:	e8 7c 04 00 00       	call   621 <fork>
+ 1a5:	89 c7                	mov    %eax,%edi
+ 1a7:	85 c0                	test   %eax,%eax
+ 1a9:	78 38                	js     1e3 <forks+0x63>
+    if(pid == 0)
+ 1ab:	74 5e                	je     20b <forks+0x8b>
+    if(wait() != pid){
+ 1ad:	e8 85 04 00 00       	call   637 <wait>
+ 1b2:	39 f8                	cmp    %edi,%eax
+ 1b4:	75 41                	jne    1f7 <forks+0x77>
+  for(i = 0; i < n; i++){
+ 1b6:	83 c3 01             	add    $0x1,%ebx
+ 1b9:	39 de                	cmp    %ebx,%esi
+ 1bb:	75 e3                	jne    1a0 <forks+0x20>
+ 1bd:	0f 31                	rdtsc
+  cyclereport(what, "children", t, n);
+ 1bf:	83 ec 0c             	sub    $0xc,%esp
+ 1c2:	56                   	push   %esi
+  t = rdtsc() - t;
+ 1c3:	2b 45 e0             	sub    -0x20(%ebp),%eax
+ 1c6:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+  cyclereport(what, "children", t, n);
+ 1c9:	52                   	push   %edx
+ 1ca:	50                   	push   %eax
+ 1cb:	68 f0 0b 00 00       	push   $0xbf0
+ 1d0:	ff 75 08             	push   0x8(%ebp)
+ 1d3:	e8 a8 02 00 00       	call   480 <cyclereport>
+}
+ 1d8:	83 c4 20             	add    $0x20,%esp
+ 1db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1de:	5b                   	pop    %ebx
+ 1df:	5e                   	pop    %esi
+ 1e0:	5f                   	pop    %edi
+ 1e1:	5d                   	pop    %ebp
+ 1e2:	c3                   	ret
+      printf(1, "forkbench: fork failed\n");
+ 1e3:	83 ec 08             	sub    $0x8,%esp
+ 1e6:	68 d8 0b 00 00       	push   $0xbd8
+ 1eb:	6a 01                	push   $0x1
+ 1ed:	e8 be 06 00 00       	call   8b0 <printf>
+      exit();
+ 1f2:	e8 35 04 00 00       	call   62c <exit>
+      printf(1, "forkbench: wait returned the wrong child\n");
+ 1f7:	83 ec 08             	sub    $0x8,%esp
+ 1fa:	68 18 0c 00 00       	push   $0xc18
+ 1ff:	6a 01                	push   $0x1
+ 201:	e8 aa 06 00 00       	call   8b0 <printf>
+      exit();
+ 206:	e8 21 04 00 00       	call   62c <exit>
+      exit();
+ 20b:	e8 1c 04 00 00       	call   62c <exit>
+
+00000210 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 210:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 211:	31 c0                	xor    %eax,%eax
+{
+ 213:	89 e5                	mov    %esp,%ebp
+ 215:	53                   	push   %ebx
+ 216:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 219:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 21c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 220:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 224:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 227:	83 c0 01             	add    $0x1,%eax
+ 22a:	84 d2                	test   %dl,%dl
+ 22c:	75 f2                	jne    220 <strcpy+0x10>
+    ;
+  return os;
+}
+ 22e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 231:	89 c8                	mov    %ecx,%eax
+ 233:	c9                   	leave
+ 234:	c3                   	ret
+ 235:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	53                   	push   %ebx
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+ 247:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 24a:	0f b6 02             	movzbl (%edx),%eax
+ 24d:	84 c0                	test   %al,%al
+ 24f:	75 17                	jne    268 <strcmp+0x28>
+ 251:	eb 3a                	jmp    28d <strcmp+0x4d>
+ 253:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 257:	90                   	nop
+ 258:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 25c:	83 c2 01             	add    $0x1,%edx
+ 25f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 262:	84 c0                	test   %al,%al
+ 264:	74 1a                	je     280 <strcmp+0x40>
+    p++, q++;
+ 266:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 268:	0f b6 19             	movzbl (%ecx),%ebx
+ 26b:	38 c3                	cmp    %al,%bl
+ 26d:	74 e9                	je     258 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 26f:	29 d8                	sub    %ebx,%eax
+}
+ 271:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 274:	c9                   	leave
+ 275:	c3                   	ret
+ 276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 280:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 284:	31 c0                	xor    %eax,%eax
+ 286:	29 d8                	sub    %ebx,%eax
+}
+ 288:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 28b:	c9                   	leave
+ 28c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 28d:	0f b6 19             	movzbl (%ecx),%ebx
+ 290:	31 c0                	xor    %eax,%eax
+ 292:	eb db                	jmp    26f <strcmp+0x2f>
+ 294:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+
+000002a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2a6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2a9:	74 15                	je     2c0 <strlen+0x20>
+ 2ab:	31 c0                	xor    %eax,%eax
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 2b0:	83 c0 01             	add    $0x1,%eax
+ 2b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2b7:	89 c1                	mov    %eax,%ecx
+ 2b9:	75 f5                	jne    2b0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2bb:	89 c8                	mov    %ecx,%eax
+ 2bd:	5d                   	pop    %ebp
+ 2be:	c3                   	ret
+ 2bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2c0:	31 c9                	xor    %ecx,%ecx
+}
+ 2c2:	5d                   	pop    %ebp
+ 2c3:	89 c8                	mov    %ecx,%eax
+ 2c5:	c3                   	ret
+ 2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	57                   	push   %edi
+ 2d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("cld; rep stosb" :
+ 2d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2dd:	89 d7                	mov    %edx,%edi
+ 2df:	fc                   	cld
+ 2e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2e5:	89 d0                	mov    %edx,%eax
+ 2e7:	c9                   	leave
+ 2e8:	c3                   	ret
+ 2e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2fa:	0f b6 10             	movzbl (%eax),%edx
+ 2fd:	84 d2                	test   %dl,%dl
+ 2ff:	75 12                	jne    313 <strchr+0x23>
+ 301:	eb 1d                	jmp    320 <strchr+0x30>
+ 303:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 307:	90                   	nop
+ 308:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 30c:	83 c0 01             	add    $0x1,%eax
+ 30f:	84 d2                	test   %dl,%dl
+ 311:	74 0d                	je     320 <strchr+0x30>
+    if(*s == c)
+ 313:	38 d1                	cmp    %dl,%cl
+ 315:	75 f1                	jne    308 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 317:	5d                   	pop    %ebp
+ 318:	c3                   	ret
+ 319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 320:	31 c0                	xor    %eax,%eax
+}
+ 322:	5d                   	pop    %ebp
+ 323:	c3                   	ret
+ 324:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 32f:	90                   	nop
+
+00000330 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 335:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 338:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 339:	31 db                	xor    %ebx,%ebx
+{
+ 33b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 33e:	eb 27                	jmp    367 <gets+0x37>
+    cc = read(0, &c, 1);
+ 340:	83 ec 04             	sub    $0x4,%esp
+ 343:	6a 01                	push   $0x1
+ 345:	56                   	push   %esi
+ 346:	6a 00                	push   $0x0
+ 348:	e8 00 03 00 00       	call   64d <read>
+    if(cc < 1)
+ 34d:	83 c4 10             	add    $0x10,%esp
+ 350:	85 c0                	test   %eax,%eax
+ 352:	7e 1d                	jle    371 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 354:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 358:	8b 55 08             	mov    0x8(%ebp),%edx
+ 35b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 35f:	3c 0a                	cmp    $0xa,%al
+ 361:	74 10                	je     373 <gets+0x43>
+ 363:	3c 0d                	cmp    $0xd,%al
+ 365:	74 0c                	je     373 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 367:	89 df                	mov    %ebx,%edi
+ 369:	83 c3 01             	add    $0x1,%ebx
+ 36c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 36f:	7c cf                	jl     340 <gets+0x10>
+ 371:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 373:	8b 45 08             	mov    0x8(%ebp),%eax
+ 376:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 37a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 37d:	5b                   	pop    %ebx
+ 37e:	5e                   	pop    %esi
+ 37f:	5f                   	pop    %edi
+ 380:	5d                   	pop    %ebp
+ 381:	c3                   	ret
+ 382:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	56                   	push   %esi
+ 394:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 395:	83 ec 08             	sub    $0x8,%esp
+ 398:	6a 00                	push   $0x0
+ 39a:	ff 75 08             	push   0x8(%ebp)
+ 39d:	e8 e2 02 00 00       	call   684 <open>
+  if(fd < 0)
+ 3a2:	83 c4 10             	add    $0x10,%esp
+ 3a5:	85 c0                	test   %eax,%eax
+ 3a7:	78 27                	js     3d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3a9:	83 ec 08             	sub    $0x8,%esp
+ 3ac:	ff 75 0c             	push   0xc(%ebp)
+ 3af:	89 c3                	mov    %eax,%ebx
+ 3b1:	50                   	push   %eax
+ 3b2:	e8 ee 02 00 00       	call   6a5 <fstat>
+  close(fd);
+ 3b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3bc:	e8 a2 02 00 00       	call   663 <close>
+  return r;
+ 3c1:	83 c4 10             	add    $0x10,%esp
+}
+ 3c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3c7:	89 f0                	mov    %esi,%eax
+ 3c9:	5b                   	pop    %ebx
+ 3ca:	5e                   	pop    %esi
+ 3cb:	5d                   	pop    %ebp
+ 3cc:	c3                   	ret
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3d5:	eb ed                	jmp    3c4 <stat+0x34>
+ 3d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3de:	66 90                	xchg   %ax,%ax
+
+000003e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	53                   	push   %ebx
+ 3e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3e7:	0f be 02             	movsbl (%edx),%eax
+ 3ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3f5:	77 1e                	ja     415 <atoi+0x35>
+ 3f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 400:	83 c2 01             	add    $0x1,%edx
+ 403:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 406:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 40a:	0f be 02             	movsbl (%edx),%eax
+ 40d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 410:	80 fb 09             	cmp    $0x9,%bl
+ 413:	76 eb                	jbe    400 <atoi+0x20>
+  return n;
+}
+ 415:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 418:	89 c8                	mov    %ecx,%eax
+ 41a:	c9                   	leave
+ 41b:	c3                   	ret
+ 41c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	57                   	push   %edi
+ 424:	56                   	push   %esi
+ 425:	8b 45 10             	mov    0x10(%ebp),%eax
+ 428:	8b 55 08             	mov    0x8(%ebp),%edx
+ 42b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 42e:	85 c0                	test   %eax,%eax
+ 430:	7e 13                	jle    445 <memmove+0x25>
+ 432:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 434:	89 d7                	mov    %edx,%edi
+ 436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 440:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 441:	39 f8                	cmp    %edi,%eax
+ 443:	75 fb                	jne    440 <memmove+0x20>
+  return vdst;
+}
+ 445:	5e                   	pop    %esi
+ 446:	89 d0                	mov    %edx,%eax
+ 448:	5f                   	pop    %edi
+ 449:	5d                   	pop    %ebp
+ 44a:	c3                   	ret
+ 44b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 44f:	90                   	nop
+
+00000450 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 450:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 455:	85 c0                	test   %eax,%eax
+ 457:	74 07                	je     460 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 459:	c3                   	ret
+ 45a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 460:	e9 77 02 00 00       	jmp    6dc <sysgetpid>
+ 465:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000470 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 470:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 475:	c3                   	ret
+ 476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000480 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 480:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 481:	31 d2                	xor    %edx,%edx
+ 483:	89 e5                	mov    %esp,%ebp
+ 485:	53                   	push   %ebx
+ 486:	83 ec 04             	sub    $0x4,%esp
+ 489:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 48c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 48f:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 492:	85 c9                	test   %ecx,%ecx
+ 494:	7e 08                	jle    49e <cyclereport+0x1e>
+ 496:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 498:	89 d8                	mov    %ebx,%eax
+ 49a:	f7 f1                	div    %ecx
+ 49c:	89 c2                	mov    %eax,%edx
+ 49e:	83 ec 08             	sub    $0x8,%esp
+ 4a1:	52                   	push   %edx
+ 4a2:	ff 75 0c             	push   0xc(%ebp)
+ 4a5:	51                   	push   %ecx
+ 4a6:	ff 75 08             	push   0x8(%ebp)
+ 4a9:	68 8c 0c 00 00       	push   $0xc8c
+ 4ae:	6a 01                	push   $0x1
+ 4b0:	e8 fb 03 00 00       	call   8b0 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 4b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4b8:	83 c4 20             	add    $0x20,%esp
+ 4bb:	c9                   	leave
+ 4bc:	c3                   	ret
+ 4bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004c0 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 4c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 4cc:	5d                   	pop    %ebp
+ 4cd:	c3                   	ret
+ 4ce:	66 90                	xchg   %ax,%ax
+
+000004d0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 4d0:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 4d1:	31 c0                	xor    %eax,%eax
+ 4d3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 4d8:	89 e5                	mov    %esp,%ebp
+ 4da:	56                   	push   %esi
+ 4db:	53                   	push   %ebx
+ 4dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 4df:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 4e3:	85 c0                	test   %eax,%eax
+ 4e5:	74 30                	je     517 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 4e7:	83 f8 02             	cmp    $0x2,%eax
+ 4ea:	74 0c                	je     4f8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 4ec:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4f1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 4f4:	85 c0                	test   %eax,%eax
+ 4f6:	74 1f                	je     517 <mutex_lock+0x47>
+ 4f8:	be 02 00 00 00       	mov    $0x2,%esi
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 500:	83 ec 08             	sub    $0x8,%esp
+ 503:	6a 02                	push   $0x2
+ 505:	53                   	push   %ebx
+ 506:	e8 8c 02 00 00       	call   797 <futex_wait>
+ 50b:	89 f0                	mov    %esi,%eax
+ 50d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 510:	83 c4 10             	add    $0x10,%esp
+ 513:	85 c0                	test   %eax,%eax
+ 515:	75 e9                	jne    500 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 517:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 51a:	5b                   	pop    %ebx
+ 51b:	5e                   	pop    %esi
+ 51c:	5d                   	pop    %ebp
+ 51d:	c3                   	ret
+ 51e:	66 90                	xchg   %ax,%ax
+
+00000520 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	83 ec 08             	sub    $0x8,%esp
+ 526:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 529:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 52d:	75 09                	jne    538 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 52f:	c9                   	leave
+ 530:	c3                   	ret
+ 531:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 538:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 53b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 541:	6a 01                	push   $0x1
+ 543:	50                   	push   %eax
+ 544:	e8 59 02 00 00       	call   7a2 <futex_wake>
+ 549:	83 c4 10             	add    $0x10,%esp
+}
+ 54c:	c9                   	leave
+ 54d:	c3                   	ret
+ 54e:	66 90                	xchg   %ax,%ax
+
+00000550 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 553:	8b 45 08             	mov    0x8(%ebp),%eax
+ 556:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 55c:	5d                   	pop    %ebp
+ 55d:	c3                   	ret
+ 55e:	66 90                	xchg   %ax,%ax
+
+00000560 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	57                   	push   %edi
+ 564:	56                   	push   %esi
+ 565:	53                   	push   %ebx
+ 566:	83 ec 0c             	sub    $0xc,%esp
+ 569:	8b 75 08             	mov    0x8(%ebp),%esi
+ 56c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 56f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 571:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 575:	75 21                	jne    598 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 577:	83 ec 08             	sub    $0x8,%esp
+ 57a:	57                   	push   %edi
+ 57b:	56                   	push   %esi
+ 57c:	e8 16 02 00 00       	call   797 <futex_wait>
+  mutex_lock(m);
+ 581:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 584:	83 c4 10             	add    $0x10,%esp
+}
+ 587:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 58a:	5b                   	pop    %ebx
+ 58b:	5e                   	pop    %esi
+ 58c:	5f                   	pop    %edi
+ 58d:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 58e:	e9 3d ff ff ff       	jmp    4d0 <mutex_lock>
+ 593:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 597:	90                   	nop
+    futex_wake(&m->v, 1);
+ 598:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 59b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 5a1:	6a 01                	push   $0x1
+ 5a3:	53                   	push   %ebx
+ 5a4:	e8 f9 01 00 00       	call   7a2 <futex_wake>
+ 5a9:	83 c4 10             	add    $0x10,%esp
+ 5ac:	eb c9                	jmp    577 <cond_wait+0x17>
+ 5ae:	66 90                	xchg   %ax,%ax
+
+000005b0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	83 ec 10             	sub    $0x10,%esp
+ 5b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 5b9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 5bd:	6a 01                	push   $0x1
+ 5bf:	50                   	push   %eax
+ 5c0:	e8 dd 01 00 00       	call   7a2 <futex_wake>
+}
+ 5c5:	83 c4 10             	add    $0x10,%esp
+ 5c8:	c9                   	leave
+ 5c9:	c3                   	ret
+ 5ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000005d0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	83 ec 10             	sub    $0x10,%esp
+ 5d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 5d9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 5dd:	68 ff ff ff 7f       	push   $0x7fffffff
+ 5e2:	50                   	push   %eax
+ 5e3:	e8 ba 01 00 00       	call   7a2 <futex_wake>
+}
+ 5e8:	83 c4 10             	add    $0x10,%esp
+ 5eb:	c9                   	leave
+ 5ec:	c3                   	ret
+
+000005ed <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 5ed:	50                   	push   %eax
+  pushl %ebx
+ 5ee:	53                   	push   %ebx
+  movl $1, %eax
+ 5ef:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 5f4:	0f a2                	cpuid
+  popl %ebx
+ 5f6:	5b                   	pop    %ebx
+  popl %eax
+ 5f7:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 5f8:	c7 05 2c 11 00 00 1e 	movl   $0x61e,0x112c
+ 5ff:	06 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 602:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 608:	74 14                	je     61e <sysint>
+  movl $sysfast, syscallvec
+ 60a:	c7 05 2c 11 00 00 14 	movl   $0x614,0x112c
+ 611:	06 00 00 
+
+00000614 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 614:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 616:	ba 1d 06 00 00       	mov    $0x61d,%edx
+  sysenter
+ 61b:	0f 34                	sysenter
+1:
+  ret
+ 61d:	c3                   	ret
+
+0000061e <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 61e:	cd 40                	int    $0x40
+  ret
+ 620:	c3                   	ret
+
+00000621 <fork>:
+
+SYSCALL(fork)
+ 621:	b8 01 00 00 00       	mov    $0x1,%eax
+ 626:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+0000062c <exit>:
+SYSCALL(exit)
+ 62c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 631:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+00000637 <wait>:
+SYSCALL(wait)
+ 637:	b8 03 00 00 00       	mov    $0x3,%eax
+ 63c:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+00000642 <pipe>:
+SYSCALL(pipe)
+ 642:	b8 04 00 00 00       	mov    $0x4,%eax
+ 647:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+0000064d <read>:
+SYSCALL(read)
+ 64d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 652:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+00000658 <write>:
+SYSCALL(write)
+ 658:	b8 10 00 00 00       	mov    $0x10,%eax
+ 65d:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+00000663 <close>:
+SYSCALL(close)
+ 663:	b8 15 00 00 00       	mov    $0x15,%eax
+ 668:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+0000066e <kill>:
+SYSCALL(kill)
+ 66e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 673:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+00000679 <exec>:
+SYSCALL(exec)
+ 679:	b8 07 00 00 00       	mov    $0x7,%eax
+ 67e:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+00000684 <open>:
+SYSCALL(open)
+ 684:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 689:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+0000068f <mknod>:
+SYSCALL(mknod)
+ 68f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 694:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+0000069a <unlink>:
+SYSCALL(unlink)
+ 69a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 69f:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+000006a5 <fstat>:
+SYSCALL(fstat)
+ 6a5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6aa:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+000006b0 <link>:
+SYSCALL(link)
+ 6b0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6b5:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+000006bb <mkdir>:
+SYSCALL(mkdir)
+ 6bb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6c0:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+000006c6 <chdir>:
+SYSCALL(chdir)
+ 6c6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6cb:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+000006d1 <dup>:
+SYSCALL(dup)
+ 6d1:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6d6:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+000006dc <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 6dc:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6e1:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+000006e7 <sbrk>:
+SYSCALL(sbrk)
+ 6e7:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6ec:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+000006f2 <sleep>:
+SYSCALL(sleep)
+ 6f2:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6f7:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+000006fd <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 6fd:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 702:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+00000708 <swapread>:
+SYSCALL(swapread)
+ 708:	b8 16 00 00 00       	mov    $0x16,%eax
+ 70d:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+00000713 <swapwrite>:
+SYSCALL(swapwrite)
+ 713:	b8 17 00 00 00       	mov    $0x17,%eax
+ 718:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+0000071e <swapstat>:
+SYSCALL(swapstat)
+ 71e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 723:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+00000729 <madvise>:
+SYSCALL(madvise)
+ 729:	b8 19 00 00 00       	mov    $0x19,%eax
+ 72e:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+00000734 <mlock>:
+SYSCALL(mlock)
+ 734:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 739:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+0000073f <munlock>:
+SYSCALL(munlock)
+ 73f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 744:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+0000074a <membench>:
+SYSCALL(membench)
+ 74a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 74f:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+00000755 <nice>:
+SYSCALL(nice)
+ 755:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 75a:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+00000760 <setpriority>:
+SYSCALL(setpriority)
+ 760:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 765:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+0000076b <usleep>:
+SYSCALL(usleep)
+ 76b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 770:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+00000776 <cpustat>:
+SYSCALL(cpustat)
+ 776:	b8 20 00 00 00       	mov    $0x20,%eax
+ 77b:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+00000781 <clone>:
+SYSCALL(clone)
+ 781:	b8 21 00 00 00       	mov    $0x21,%eax
+ 786:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+0000078c <join>:
+SYSCALL(join)
+ 78c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 791:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+00000797 <futex_wait>:
+SYSCALL(futex_wait)
+ 797:	b8 23 00 00 00       	mov    $0x23,%eax
+ 79c:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+000007a2 <futex_wake>:
+SYSCALL(futex_wake)
+ 7a2:	b8 24 00 00 00       	mov    $0x24,%eax
+ 7a7:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+000007ad <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 7ad:	b8 25 00 00 00       	mov    $0x25,%eax
+ 7b2:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+000007b8 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 7b8:	b8 26 00 00 00       	mov    $0x26,%eax
+ 7bd:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+000007c3 <getcpu>:
+SYSCALL(getcpu)
+ 7c3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 7c8:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+000007ce <migrations>:
+SYSCALL(migrations)
+ 7ce:	b8 28 00 00 00       	mov    $0x28,%eax
+ 7d3:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+000007d9 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 7d9:	b8 29 00 00 00       	mov    $0x29,%eax
+ 7de:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+000007e4 <lockstat>:
+SYSCALL(lockstat)
+ 7e4:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 7e9:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+000007ef <lockprof>:
+SYSCALL(lockprof)
+ 7ef:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 7f4:	ff 25 2c 11 00 00    	jmp    *0x112c
+
+000007fa <bcachestat>:
+SYSCALL(bcachestat)
+ 7fa:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 7ff:	ff 25 2c 11 00 00    	jmp    *0x112c
+ 805:	66 90                	xchg   %ax,%ax
+ 807:	66 90                	xchg   %ax,%ax
+ 809:	66 90                	xchg   %ax,%ax
+ 80b:	66 90                	xchg   %ax,%ax
+ 80d:	66 90                	xchg   %ax,%ax
+ 80f:	90                   	nop
+
+00000810 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 810:	55                   	push   %ebp
+ 811:	89 e5                	mov    %esp,%ebp
+ 813:	57                   	push   %edi
+ 814:	56                   	push   %esi
+ 815:	53                   	push   %ebx
+ 816:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 818:	89 d1                	mov    %edx,%ecx
+{
+ 81a:	83 ec 3c             	sub    $0x3c,%esp
+ 81d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 820:	85 d2                	test   %edx,%edx
+ 822:	0f 89 80 00 00 00    	jns    8a8 <printint+0x98>
+ 828:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 82c:	74 7a                	je     8a8 <printint+0x98>
+    x = -xx;
+ 82e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 830:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 835:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 838:	31 f6                	xor    %esi,%esi
+ 83a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 840:	89 c8                	mov    %ecx,%eax
+ 842:	31 d2                	xor    %edx,%edx
+ 844:	89 f7                	mov    %esi,%edi
+ 846:	f7 f3                	div    %ebx
+ 848:	8d 76 01             	lea    0x1(%esi),%esi
+ 84b:	0f b6 92 08 0d 00 00 	movzbl 0xd08(%edx),%edx
+ 852:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 856:	89 ca                	mov    %ecx,%edx
+ 858:	89 c1                	mov    %eax,%ecx
+ 85a:	39 da                	cmp    %ebx,%edx
+ 85c:	73 e2                	jae    840 <printint+0x30>
+  if(neg)
+ 85e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 861:	85 c0                	test   %eax,%eax
+ 863:	74 07                	je     86c <printint+0x5c>
+    buf[i++] = '-';
+ 865:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 86a:	89 f7                	mov    %esi,%edi
+ 86c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 86f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 872:	01 df                	add    %ebx,%edi
+ 874:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 878:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 87b:	83 ec 04             	sub    $0x4,%esp
+ 87e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 881:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 884:	6a 01                	push   $0x1
+ 886:	50                   	push   %eax
+ 887:	56                   	push   %esi
+ 888:	e8 cb fd ff ff       	call   658 <write>
+  while(--i >= 0)
+ 88d:	89 f8                	mov    %edi,%eax
+ 88f:	83 c4 10             	add    $0x10,%esp
+ 892:	83 ef 01             	sub    $0x1,%edi
+ 895:	39 d8                	cmp    %ebx,%eax
+ 897:	75 df                	jne    878 <printint+0x68>
+}
+ 899:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 89c:	5b                   	pop    %ebx
+ 89d:	5e                   	pop    %esi
+ 89e:	5f                   	pop    %edi
+ 89f:	5d                   	pop    %ebp
+ 8a0:	c3                   	ret
+ 8a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 8a8:	31 c0                	xor    %eax,%eax
+ 8aa:	eb 89                	jmp    835 <printint+0x25>
+ 8ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	57                   	push   %edi
+ 8b4:	56                   	push   %esi
+ 8b5:	53                   	push   %ebx
+ 8b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 8b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 8bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 8bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 8c2:	83 c6 01             	add    $0x1,%esi
+ 8c5:	84 db                	test   %bl,%bl
+ 8c7:	74 67                	je     930 <printf+0x80>
+ 8c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 8cc:	31 d2                	xor    %edx,%edx
+ 8ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 8d1:	eb 34                	jmp    907 <printf+0x57>
+ 8d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8d7:	90                   	nop
+ 8d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 8db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 8e0:	83 f8 25             	cmp    $0x25,%eax
+ 8e3:	74 18                	je     8fd <printf+0x4d>
+  write(fd, &c, 1);
+ 8e5:	83 ec 04             	sub    $0x4,%esp
+ 8e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 8eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8ee:	6a 01                	push   $0x1
+ 8f0:	50                   	push   %eax
+ 8f1:	57                   	push   %edi
+ 8f2:	e8 61 fd ff ff       	call   658 <write>
+ 8f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 8fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 8fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 900:	83 c6 01             	add    $0x1,%esi
+ 903:	84 db                	test   %bl,%bl
+ 905:	74 29                	je     930 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 907:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 90a:	85 d2                	test   %edx,%edx
+ 90c:	74 ca                	je     8d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 90e:	83 fa 25             	cmp    $0x25,%edx
+ 911:	75 ea                	jne    8fd <printf+0x4d>
+      if(c == 'd'){
+ 913:	83 f8 25             	cmp    $0x25,%eax
+ 916:	0f 84 24 01 00 00    	je     a40 <printf+0x190>
+ 91c:	83 e8 63             	sub    $0x63,%eax
+ 91f:	83 f8 15             	cmp    $0x15,%eax
+ 922:	77 1c                	ja     940 <printf+0x90>
+ 924:	ff 24 85 b0 0c 00 00 	jmp    *0xcb0(,%eax,4)
+ 92b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 92f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 930:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 933:	5b                   	pop    %ebx
+ 934:	5e                   	pop    %esi
+ 935:	5f                   	pop    %edi
+ 936:	5d                   	pop    %ebp
+ 937:	c3                   	ret
+ 938:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93f:	90                   	nop
+  write(fd, &c, 1);
+ 940:	83 ec 04             	sub    $0x4,%esp
+ 943:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 946:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 94a:	6a 01                	push   $0x1
+ 94c:	52                   	push   %edx
+ 94d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 950:	57                   	push   %edi
+ 951:	e8 02 fd ff ff       	call   658 <write>
+ 956:	83 c4 0c             	add    $0xc,%esp
+ 959:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 95c:	6a 01                	push   $0x1
+ 95e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 961:	52                   	push   %edx
+ 962:	57                   	push   %edi
+ 963:	e8 f0 fc ff ff       	call   658 <write>
+        putc(fd, c);
+ 968:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 96b:	31 d2                	xor    %edx,%edx
+ 96d:	eb 8e                	jmp    8fd <printf+0x4d>
+ 96f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 970:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 973:	83 ec 0c             	sub    $0xc,%esp
+ 976:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 97b:	8b 13                	mov    (%ebx),%edx
+ 97d:	6a 00                	push   $0x0
+ 97f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 981:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 984:	e8 87 fe ff ff       	call   810 <printint>
+        ap++;
+ 989:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 98c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 98f:	31 d2                	xor    %edx,%edx
+ 991:	e9 67 ff ff ff       	jmp    8fd <printf+0x4d>
+ 996:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 99d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 9a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 9a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 9a5:	83 c0 04             	add    $0x4,%eax
+ 9a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 9ab:	85 db                	test   %ebx,%ebx
+ 9ad:	0f 84 9d 00 00 00    	je     a50 <printf+0x1a0>
+        while(*s != 0){
+ 9b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 9b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 9b8:	84 c0                	test   %al,%al
+ 9ba:	0f 84 3d ff ff ff    	je     8fd <printf+0x4d>
+ 9c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 9c6:	89 de                	mov    %ebx,%esi
+ 9c8:	89 d3                	mov    %edx,%ebx
+ 9ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 9d0:	83 ec 04             	sub    $0x4,%esp
+ 9d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 9d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 9d9:	6a 01                	push   $0x1
+ 9db:	53                   	push   %ebx
+ 9dc:	57                   	push   %edi
+ 9dd:	e8 76 fc ff ff       	call   658 <write>
+        while(*s != 0){
+ 9e2:	0f b6 06             	movzbl (%esi),%eax
+ 9e5:	83 c4 10             	add    $0x10,%esp
+ 9e8:	84 c0                	test   %al,%al
+ 9ea:	75 e4                	jne    9d0 <printf+0x120>
+      state = 0;
+ 9ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 9ef:	31 d2                	xor    %edx,%edx
+ 9f1:	e9 07 ff ff ff       	jmp    8fd <printf+0x4d>
+ 9f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a00:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a03:	83 ec 0c             	sub    $0xc,%esp
+ a06:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a0b:	8b 13                	mov    (%ebx),%edx
+ a0d:	6a 01                	push   $0x1
+ a0f:	e9 6b ff ff ff       	jmp    97f <printf+0xcf>
+ a14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a18:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a1b:	83 ec 04             	sub    $0x4,%esp
+ a1e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a21:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a23:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a26:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a29:	6a 01                	push   $0x1
+ a2b:	52                   	push   %edx
+ a2c:	57                   	push   %edi
+ a2d:	e8 26 fc ff ff       	call   658 <write>
+        ap++;
+ a32:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a35:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a38:	31 d2                	xor    %edx,%edx
+ a3a:	e9 be fe ff ff       	jmp    8fd <printf+0x4d>
+ a3f:	90                   	nop
+  write(fd, &c, 1);
+ a40:	83 ec 04             	sub    $0x4,%esp
+ a43:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a46:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a49:	6a 01                	push   $0x1
+ a4b:	e9 11 ff ff ff       	jmp    961 <printf+0xb1>
+ a50:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ a55:	bb a7 0c 00 00       	mov    $0xca7,%ebx
+ a5a:	e9 61 ff ff ff       	jmp    9c0 <printf+0x110>
+ a5f:	90                   	nop
+
+00000a60 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a60:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a61:	a1 40 19 00 00       	mov    0x1940,%eax
+{
+ a66:	89 e5                	mov    %esp,%ebp
+ a68:	57                   	push   %edi
+ a69:	56                   	push   %esi
+ a6a:	53                   	push   %ebx
+ a6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ a6e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a78:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a7a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a7c:	39 ca                	cmp    %ecx,%edx
+ a7e:	73 30                	jae    ab0 <free+0x50>
+ a80:	39 c1                	cmp    %eax,%ecx
+ a82:	72 04                	jb     a88 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a84:	39 c2                	cmp    %eax,%edx
+ a86:	72 f0                	jb     a78 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a88:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a8b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a8e:	39 f8                	cmp    %edi,%eax
+ a90:	74 2e                	je     ac0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a92:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a95:	8b 42 04             	mov    0x4(%edx),%eax
+ a98:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a9b:	39 f1                	cmp    %esi,%ecx
+ a9d:	74 38                	je     ad7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a9f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ aa1:	5b                   	pop    %ebx
+  freep = p;
+ aa2:	89 15 40 19 00 00    	mov    %edx,0x1940
+}
+ aa8:	5e                   	pop    %esi
+ aa9:	5f                   	pop    %edi
+ aaa:	5d                   	pop    %ebp
+ aab:	c3                   	ret
+ aac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ab0:	39 c1                	cmp    %eax,%ecx
+ ab2:	72 d0                	jb     a84 <free+0x24>
+ ab4:	eb c2                	jmp    a78 <free+0x18>
+ ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ ac0:	03 70 04             	add    0x4(%eax),%esi
+ ac3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ac6:	8b 02                	mov    (%edx),%eax
+ ac8:	8b 00                	mov    (%eax),%eax
+ aca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ acd:	8b 42 04             	mov    0x4(%edx),%eax
+ ad0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ad3:	39 f1                	cmp    %esi,%ecx
+ ad5:	75 c8                	jne    a9f <free+0x3f>
+    p->s.size += bp->s.size;
+ ad7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ ada:	89 15 40 19 00 00    	mov    %edx,0x1940
+    p->s.size += bp->s.size;
+ ae0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ae3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ ae6:	89 0a                	mov    %ecx,(%edx)
+}
+ ae8:	5b                   	pop    %ebx
+ ae9:	5e                   	pop    %esi
+ aea:	5f                   	pop    %edi
+ aeb:	5d                   	pop    %ebp
+ aec:	c3                   	ret
+ aed:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000af0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ af0:	55                   	push   %ebp
+ af1:	89 e5                	mov    %esp,%ebp
+ af3:	57                   	push   %edi
+ af4:	56                   	push   %esi
+ af5:	53                   	push   %ebx
+ af6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ af9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ afc:	8b 15 40 19 00 00    	mov    0x1940,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b02:	8d 78 07             	lea    0x7(%eax),%edi
+ b05:	c1 ef 03             	shr    $0x3,%edi
+ b08:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ b0b:	85 d2                	test   %edx,%edx
+ b0d:	0f 84 8d 00 00 00    	je     ba0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b13:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b15:	8b 48 04             	mov    0x4(%eax),%ecx
+ b18:	39 f9                	cmp    %edi,%ecx
+ b1a:	73 64                	jae    b80 <malloc+0x90>
+  if(nu < 4096)
+ b1c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b21:	39 df                	cmp    %ebx,%edi
+ b23:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b26:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b2d:	eb 0a                	jmp    b39 <malloc+0x49>
+ b2f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b30:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b32:	8b 48 04             	mov    0x4(%eax),%ecx
+ b35:	39 f9                	cmp    %edi,%ecx
+ b37:	73 47                	jae    b80 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ b39:	89 c2                	mov    %eax,%edx
+ b3b:	39 05 40 19 00 00    	cmp    %eax,0x1940
+ b41:	75 ed                	jne    b30 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ b43:	83 ec 0c             	sub    $0xc,%esp
+ b46:	56                   	push   %esi
+ b47:	e8 9b fb ff ff       	call   6e7 <sbrk>
+  if(p == (char*)-1)
+ b4c:	83 c4 10             	add    $0x10,%esp
+ b4f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b52:	74 1c                	je     b70 <malloc+0x80>
+  hp->s.size = nu;
+ b54:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ b57:	83 ec 0c             	sub    $0xc,%esp
+ b5a:	83 c0 08             	add    $0x8,%eax
+ b5d:	50                   	push   %eax
+ b5e:	e8 fd fe ff ff       	call   a60 <free>
+  return freep;
+ b63:	8b 15 40 19 00 00    	mov    0x1940,%edx
+      if((p = morecore(nunits)) == 0)
+ b69:	83 c4 10             	add    $0x10,%esp
+ b6c:	85 d2                	test   %edx,%edx
+ b6e:	75 c0                	jne    b30 <malloc+0x40>
+        return 0;
+  }
+}
+ b70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b73:	31 c0                	xor    %eax,%eax
+}
+ b75:	5b                   	pop    %ebx
+ b76:	5e                   	pop    %esi
+ b77:	5f                   	pop    %edi
+ b78:	5d                   	pop    %ebp
+ b79:	c3                   	ret
+ b7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b80:	39 cf                	cmp    %ecx,%edi
+ b82:	74 4c                	je     bd0 <malloc+0xe0>
+        p->s.size -= nunits;
+ b84:	29 f9                	sub    %edi,%ecx
+ b86:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ b89:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ b8c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ b8f:	89 15 40 19 00 00    	mov    %edx,0x1940
+}
+ b95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b98:	83 c0 08             	add    $0x8,%eax
+}
+ b9b:	5b                   	pop    %ebx
+ b9c:	5e                   	pop    %esi
+ b9d:	5f                   	pop    %edi
+ b9e:	5d                   	pop    %ebp
+ b9f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ ba0:	c7 05 40 19 00 00 44 	movl   $0x1944,0x1940
+ ba7:	19 00 00 
+    base.s.size = 0;
+ baa:	b8 44 19 00 00       	mov    $0x1944,%eax
+    base.s.ptr = freep = prevp = &base;
+ baf:	c7 05 44 19 00 00 44 	movl   $0x1944,0x1944
+ bb6:	19 00 00 
+    base.s.size = 0;
+ bb9:	c7 05 48 19 00 00 00 	movl   $0x0,0x1948
+ bc0:	00 00 00 
+    if(p->s.size >= nunits){
+ bc3:	e9 54 ff ff ff       	jmp    b1c <malloc+0x2c>
+ bc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bcf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ bd0:	8b 08                	mov    (%eax),%ecx
+ bd2:	89 0a                	mov    %ecx,(%edx)
+ bd4:	eb b9                	jmp    b8f <malloc+0x9f>
@@ -0,0 +1,80 @@
+// Process creation and lookup with many processes around.
+// Times fork+exit+wait of n short-lived children, first alone
+// and then with nidle other processes asleep; then times
+// killing and reaping the sleeping ones by pid.  None of this
+// should get slower as the number of processes grows.
+// usage: forkbench [n [nidle]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "x86.h"
+
+#define NIDLE 512
+
+int idle[NIDLE];
+
+void
+forks(char *what, int n)
+{
+  uint64 t;
+  int i, pid;
+
+  t = rdtsc();
+  for(i = 0; i < n; i++){
+    if((pid = fork()) < 0){
+      printf(1, "forkbench: fork failed\n");
+      exit();
+    }
+    if(pid == 0)
+      exit();
+    if(wait() != pid){
+      printf(1, "forkbench: wait returned the wrong child\n");
+      exit();
+    }
+  }
+  t = rdtsc() - t;
+  cyclereport(what, "children", t, n);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, n, nidle;
+  uint64 t;
+
+  n = 2000;
+  nidle = 256;
+  if(argc > 1)
+    n = atoi(argv[1]);
+  if(argc > 2)
+    nidle = atoi(argv[2]);
+  if(n < 1)
+    n = 1;
+  if(nidle < 1 || nidle > NIDLE)
+    nidle = 256;
+
+  forks("fork+exit+wait", n);
+
+  for(i = 0; i < nidle; i++){
+    if((idle[i] = fork()) < 0){
+      printf(1, "forkbench: only %d idle processes\n", i);
+      break;
+    }
+    if(idle[i] == 0){
+      sleep(1000000);
+      exit();
+    }
+  }
+  nidle = i;
+  forks("fork+exit+wait, with idle processes", n);
+
+  t = rdtsc();
+  for(i = nidle-1; i >= 0; i--)
+    kill(idle[i]);
+  t = rdtsc() - t;
+  cyclereport("kill", "processes", t, nidle);
+  for(i = 0; i < nidle; i++)
+    wait();
+  exit();
+}
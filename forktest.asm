@@ -0,0 +1,1081 @@
+
+_forktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "fork test OK\n");
+}
+
+int
+main(void)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 e4 f0             	and    $0xfffffff0,%esp
+  forktest();
+   6:	e8 35 00 00 00       	call   40 <forktest>
+  exit();
+   b:	e8 2c 05 00 00       	call   53c <exit>
+
+00000010 <printf>:
+{
+  10:	55                   	push   %ebp
+  11:	89 e5                	mov    %esp,%ebp
+  13:	53                   	push   %ebx
+  14:	83 ec 10             	sub    $0x10,%esp
+  17:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  write(fd, s, strlen(s));
+  1a:	53                   	push   %ebx
+  1b:	e8 90 01 00 00       	call   1b0 <strlen>
+  20:	83 c4 0c             	add    $0xc,%esp
+  23:	50                   	push   %eax
+  24:	53                   	push   %ebx
+  25:	ff 75 08             	push   0x8(%ebp)
+  28:	e8 3b 05 00 00       	call   568 <write>
+}
+  2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  30:	83 c4 10             	add    $0x10,%esp
+  33:	c9                   	leave
+  34:	c3                   	ret
+  35:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000040 <forktest>:
+{
+  40:	55                   	push   %ebp
+  41:	89 e5                	mov    %esp,%ebp
+  43:	53                   	push   %ebx
+  for(n=0; n<N; n++){
+  44:	31 db                	xor    %ebx,%ebx
+{
+  46:	83 ec 10             	sub    $0x10,%esp
+  write(fd, s, strlen(s));
+  49:	68 18 07 00 00       	push   $0x718
+  4e:	e8 5d 01 00 00       	call   1b0 <strlen>
+  53:	83 c4 0c             	add    $0xc,%esp
+  56:	50                   	push   %eax
+  57:	68 18 07 00 00       	push   $0x718
+  5c:	6a 01                	push   $0x1
+  5e:	e8 05 05 00 00       	call   568 <write>
+  63:	83 c4 10             	add    $0x10,%esp
+  66:	eb 19                	jmp    81 <forktest+0x41>
+  68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6f:	90                   	nop
+    if(pid == 0)
+  70:	74 5b                	je     cd <forktest+0x8d>
+  for(n=0; n<N; n++){
+  72:	83 c3 01             	add    $0x1,%ebx
+  75:	81 fb d0 07 00 00    	cmp    $0x7d0,%ebx
+  7b:	0f 84 86 00 00 00    	je     107 <forktest+0xc7>
+    pid = fork();
+  81:	e8 ab 04 00 00       	call   531 <fork>
+    if(pid < 0)
+  86:	85 c0                	test   %eax,%eax
+  88:	79 e6                	jns    70 <forktest+0x30>
+  for(; n > 0; n--){
+  8a:	85 db                	test   %ebx,%ebx
+  8c:	74 10                	je     9e <forktest+0x5e>
+  8e:	66 90                	xchg   %ax,%ax
+    if(wait() < 0){
+  90:	e8 b2 04 00 00       	call   547 <wait>
+  95:	85 c0                	test   %eax,%eax
+  97:	78 39                	js     d2 <forktest+0x92>
+  for(; n > 0; n--){
+  99:	83 eb 01             	sub    $0x1,%ebx
+  9c:	75 f2                	jne    90 <forktest+0x50>
+  if(wait() != -1){
+  9e:	e8 a4 04 00 00       	call   547 <wait>
+  a3:	83 f8 ff             	cmp    $0xffffffff,%eax
+  a6:	75 4c                	jne    f4 <forktest+0xb4>
+  write(fd, s, strlen(s));
+  a8:	83 ec 0c             	sub    $0xc,%esp
+  ab:	68 4a 07 00 00       	push   $0x74a
+  b0:	e8 fb 00 00 00       	call   1b0 <strlen>
+  b5:	83 c4 0c             	add    $0xc,%esp
+  b8:	50                   	push   %eax
+  b9:	68 4a 07 00 00       	push   $0x74a
+  be:	6a 01                	push   $0x1
+  c0:	e8 a3 04 00 00       	call   568 <write>
+}
+  c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c8:	83 c4 10             	add    $0x10,%esp
+  cb:	c9                   	leave
+  cc:	c3                   	ret
+      exit();
+  cd:	e8 6a 04 00 00       	call   53c <exit>
+  write(fd, s, strlen(s));
+  d2:	83 ec 0c             	sub    $0xc,%esp
+  d5:	68 23 07 00 00       	push   $0x723
+  da:	e8 d1 00 00 00       	call   1b0 <strlen>
+  df:	83 c4 0c             	add    $0xc,%esp
+  e2:	50                   	push   %eax
+  e3:	68 23 07 00 00       	push   $0x723
+  e8:	6a 01                	push   $0x1
+  ea:	e8 79 04 00 00       	call   568 <write>
+      exit();
+  ef:	e8 48 04 00 00       	call   53c <exit>
+    printf(1, "wait got too many\n");
+  f4:	50                   	push   %eax
+  f5:	50                   	push   %eax
+  f6:	68 37 07 00 00       	push   $0x737
+  fb:	6a 01                	push   $0x1
+  fd:	e8 0e ff ff ff       	call   10 <printf>
+    exit();
+ 102:	e8 35 04 00 00       	call   53c <exit>
+    printf(1, "fork claimed to work N times!\n", N);
+ 107:	52                   	push   %edx
+ 108:	68 d0 07 00 00       	push   $0x7d0
+ 10d:	68 58 07 00 00       	push   $0x758
+ 112:	6a 01                	push   $0x1
+ 114:	e8 f7 fe ff ff       	call   10 <printf>
+    exit();
+ 119:	e8 1e 04 00 00       	call   53c <exit>
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 120:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 121:	31 c0                	xor    %eax,%eax
+{
+ 123:	89 e5                	mov    %esp,%ebp
+ 125:	53                   	push   %ebx
+ 126:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 129:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 130:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 134:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 137:	83 c0 01             	add    $0x1,%eax
+ 13a:	84 d2                	test   %dl,%dl
+ 13c:	75 f2                	jne    130 <strcpy+0x10>
+    ;
+  return os;
+}
+ 13e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 141:	89 c8                	mov    %ecx,%eax
+ 143:	c9                   	leave
+ 144:	c3                   	ret
+ 145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	53                   	push   %ebx
+ 154:	8b 55 08             	mov    0x8(%ebp),%edx
+ 157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 15a:	0f b6 02             	movzbl (%edx),%eax
+ 15d:	84 c0                	test   %al,%al
+ 15f:	75 17                	jne    178 <strcmp+0x28>
+ 161:	eb 3a                	jmp    19d <strcmp+0x4d>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 16c:	83 c2 01             	add    $0x1,%edx
+ 16f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 172:	84 c0                	test   %al,%al
+ 174:	74 1a                	je     190 <strcmp+0x40>
+    p++, q++;
+ 176:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 178:	0f b6 19             	movzbl (%ecx),%ebx
+ 17b:	38 c3                	cmp    %al,%bl
+ 17d:	74 e9                	je     168 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 17f:	29 d8                	sub    %ebx,%eax
+}
+ 181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 184:	c9                   	leave
+ 185:	c3                   	ret
+ 186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 190:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 194:	31 c0                	xor    %eax,%eax
+ 196:	29 d8                	sub    %ebx,%eax
+}
+ 198:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 19b:	c9                   	leave
+ 19c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 19d:	0f b6 19             	movzbl (%ecx),%ebx
+ 1a0:	31 c0                	xor    %eax,%eax
+ 1a2:	eb db                	jmp    17f <strcmp+0x2f>
+ 1a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1af:	90                   	nop
+
+000001b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1b9:	74 15                	je     1d0 <strlen+0x20>
+ 1bb:	31 c0                	xor    %eax,%eax
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1c0:	83 c0 01             	add    $0x1,%eax
+ 1c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1c7:	89 c1                	mov    %eax,%ecx
+ 1c9:	75 f5                	jne    1c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1cb:	89 c8                	mov    %ecx,%eax
+ 1cd:	5d                   	pop    %ebp
+ 1ce:	c3                   	ret
+ 1cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1d0:	31 c9                	xor    %ecx,%ecx
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	89 c8                	mov    %ecx,%eax
+ 1d5:	c3                   	ret
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ed:	89 d7                	mov    %edx,%edi
+ 1ef:	fc                   	cld
+ 1f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1f5:	89 d0                	mov    %edx,%eax
+ 1f7:	c9                   	leave
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+ 206:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 20a:	0f b6 10             	movzbl (%eax),%edx
+ 20d:	84 d2                	test   %dl,%dl
+ 20f:	75 12                	jne    223 <strchr+0x23>
+ 211:	eb 1d                	jmp    230 <strchr+0x30>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 21c:	83 c0 01             	add    $0x1,%eax
+ 21f:	84 d2                	test   %dl,%dl
+ 221:	74 0d                	je     230 <strchr+0x30>
+    if(*s == c)
+ 223:	38 d1                	cmp    %dl,%cl
+ 225:	75 f1                	jne    218 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 227:	5d                   	pop    %ebp
+ 228:	c3                   	ret
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 230:	31 c0                	xor    %eax,%eax
+}
+ 232:	5d                   	pop    %ebp
+ 233:	c3                   	ret
+ 234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+
+00000240 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 245:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 248:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 249:	31 db                	xor    %ebx,%ebx
+{
+ 24b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 24e:	eb 27                	jmp    277 <gets+0x37>
+    cc = read(0, &c, 1);
+ 250:	83 ec 04             	sub    $0x4,%esp
+ 253:	6a 01                	push   $0x1
+ 255:	56                   	push   %esi
+ 256:	6a 00                	push   $0x0
+ 258:	e8 00 03 00 00       	call   55d <read>
+    if(cc < 1)
+ 25d:	83 c4 10             	add    $0x10,%esp
+ 260:	85 c0                	test   %eax,%eax
+ 262:	7e 1d                	jle    281 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 264:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 268:	8b 55 08             	mov    0x8(%ebp),%edx
+ 26b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 26f:	3c 0a                	cmp    $0xa,%al
+ 271:	74 10                	je     283 <gets+0x43>
+ 273:	3c 0d                	cmp    $0xd,%al
+ 275:	74 0c                	je     283 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 277:	89 df                	mov    %ebx,%edi
+ 279:	83 c3 01             	add    $0x1,%ebx
+ 27c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 27f:	7c cf                	jl     250 <gets+0x10>
+ 281:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 283:	8b 45 08             	mov    0x8(%ebp),%eax
+ 286:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 28a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 28d:	5b                   	pop    %ebx
+ 28e:	5e                   	pop    %esi
+ 28f:	5f                   	pop    %edi
+ 290:	5d                   	pop    %ebp
+ 291:	c3                   	ret
+ 292:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	56                   	push   %esi
+ 2a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2a5:	83 ec 08             	sub    $0x8,%esp
+ 2a8:	6a 00                	push   $0x0
+ 2aa:	ff 75 08             	push   0x8(%ebp)
+ 2ad:	e8 e2 02 00 00       	call   594 <open>
+  if(fd < 0)
+ 2b2:	83 c4 10             	add    $0x10,%esp
+ 2b5:	85 c0                	test   %eax,%eax
+ 2b7:	78 27                	js     2e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2b9:	83 ec 08             	sub    $0x8,%esp
+ 2bc:	ff 75 0c             	push   0xc(%ebp)
+ 2bf:	89 c3                	mov    %eax,%ebx
+ 2c1:	50                   	push   %eax
+ 2c2:	e8 ee 02 00 00       	call   5b5 <fstat>
+  close(fd);
+ 2c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2cc:	e8 a2 02 00 00       	call   573 <close>
+  return r;
+ 2d1:	83 c4 10             	add    $0x10,%esp
+}
+ 2d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2d7:	89 f0                	mov    %esi,%eax
+ 2d9:	5b                   	pop    %ebx
+ 2da:	5e                   	pop    %esi
+ 2db:	5d                   	pop    %ebp
+ 2dc:	c3                   	ret
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2e5:	eb ed                	jmp    2d4 <stat+0x34>
+ 2e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ee:	66 90                	xchg   %ax,%ax
+
+000002f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	53                   	push   %ebx
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2f7:	0f be 02             	movsbl (%edx),%eax
+ 2fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 300:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 305:	77 1e                	ja     325 <atoi+0x35>
+ 307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 310:	83 c2 01             	add    $0x1,%edx
+ 313:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 316:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 31a:	0f be 02             	movsbl (%edx),%eax
+ 31d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 320:	80 fb 09             	cmp    $0x9,%bl
+ 323:	76 eb                	jbe    310 <atoi+0x20>
+  return n;
+}
+ 325:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 328:	89 c8                	mov    %ecx,%eax
+ 32a:	c9                   	leave
+ 32b:	c3                   	ret
+ 32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	56                   	push   %esi
+ 335:	8b 45 10             	mov    0x10(%ebp),%eax
+ 338:	8b 55 08             	mov    0x8(%ebp),%edx
+ 33b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 33e:	85 c0                	test   %eax,%eax
+ 340:	7e 13                	jle    355 <memmove+0x25>
+ 342:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 344:	89 d7                	mov    %edx,%edi
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 350:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 351:	39 f8                	cmp    %edi,%eax
+ 353:	75 fb                	jne    350 <memmove+0x20>
+  return vdst;
+}
+ 355:	5e                   	pop    %esi
+ 356:	89 d0                	mov    %edx,%eax
+ 358:	5f                   	pop    %edi
+ 359:	5d                   	pop    %ebp
+ 35a:	c3                   	ret
+ 35b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 35f:	90                   	nop
+
+00000360 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 360:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 365:	85 c0                	test   %eax,%eax
+ 367:	74 07                	je     370 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 369:	c3                   	ret
+ 36a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 370:	e9 77 02 00 00       	jmp    5ec <sysgetpid>
+ 375:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000380 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 380:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 385:	c3                   	ret
+ 386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000390 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 390:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 391:	31 d2                	xor    %edx,%edx
+ 393:	89 e5                	mov    %esp,%ebp
+ 395:	53                   	push   %ebx
+ 396:	83 ec 04             	sub    $0x4,%esp
+ 399:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 39c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 39f:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 3a2:	85 c9                	test   %ecx,%ecx
+ 3a4:	7e 08                	jle    3ae <cyclereport+0x1e>
+ 3a6:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 3a8:	89 d8                	mov    %ebx,%eax
+ 3aa:	f7 f1                	div    %ecx
+ 3ac:	89 c2                	mov    %eax,%edx
+ 3ae:	83 ec 08             	sub    $0x8,%esp
+ 3b1:	52                   	push   %edx
+ 3b2:	ff 75 0c             	push   0xc(%ebp)
+ 3b5:	51                   	push   %ecx
+ 3b6:	ff 75 08             	push   0x8(%ebp)
+ 3b9:	68 77 07 00 00       	push   $0x777
+ 3be:	6a 01                	push   $0x1
+ 3c0:	e8 4b fc ff ff       	call   10 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 3c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c8:	83 c4 20             	add    $0x20,%esp
+ 3cb:	c9                   	leave
+ 3cc:	c3                   	ret
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003d0 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 3d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3dc:	5d                   	pop    %ebp
+ 3dd:	c3                   	ret
+ 3de:	66 90                	xchg   %ax,%ax
+
+000003e0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 3e0:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 3e1:	31 c0                	xor    %eax,%eax
+ 3e3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 3e8:	89 e5                	mov    %esp,%ebp
+ 3ea:	56                   	push   %esi
+ 3eb:	53                   	push   %ebx
+ 3ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 3ef:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 3f3:	85 c0                	test   %eax,%eax
+ 3f5:	74 30                	je     427 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 3f7:	83 f8 02             	cmp    $0x2,%eax
+ 3fa:	74 0c                	je     408 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 3fc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 401:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 404:	85 c0                	test   %eax,%eax
+ 406:	74 1f                	je     427 <mutex_lock+0x47>
+ 408:	be 02 00 00 00       	mov    $0x2,%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 410:	83 ec 08             	sub    $0x8,%esp
+ 413:	6a 02                	push   $0x2
+ 415:	53                   	push   %ebx
+ 416:	e8 8c 02 00 00       	call   6a7 <futex_wait>
+ 41b:	89 f0                	mov    %esi,%eax
+ 41d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 420:	83 c4 10             	add    $0x10,%esp
+ 423:	85 c0                	test   %eax,%eax
+ 425:	75 e9                	jne    410 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 427:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 42a:	5b                   	pop    %ebx
+ 42b:	5e                   	pop    %esi
+ 42c:	5d                   	pop    %ebp
+ 42d:	c3                   	ret
+ 42e:	66 90                	xchg   %ax,%ax
+
+00000430 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	83 ec 08             	sub    $0x8,%esp
+ 436:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 439:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 43d:	75 09                	jne    448 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 43f:	c9                   	leave
+ 440:	c3                   	ret
+ 441:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 448:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 44b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 451:	6a 01                	push   $0x1
+ 453:	50                   	push   %eax
+ 454:	e8 59 02 00 00       	call   6b2 <futex_wake>
+ 459:	83 c4 10             	add    $0x10,%esp
+}
+ 45c:	c9                   	leave
+ 45d:	c3                   	ret
+ 45e:	66 90                	xchg   %ax,%ax
+
+00000460 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 463:	8b 45 08             	mov    0x8(%ebp),%eax
+ 466:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 46c:	5d                   	pop    %ebp
+ 46d:	c3                   	ret
+ 46e:	66 90                	xchg   %ax,%ax
+
+00000470 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	56                   	push   %esi
+ 475:	53                   	push   %ebx
+ 476:	83 ec 0c             	sub    $0xc,%esp
+ 479:	8b 75 08             	mov    0x8(%ebp),%esi
+ 47c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 47f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 481:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 485:	75 21                	jne    4a8 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 487:	83 ec 08             	sub    $0x8,%esp
+ 48a:	57                   	push   %edi
+ 48b:	56                   	push   %esi
+ 48c:	e8 16 02 00 00       	call   6a7 <futex_wait>
+  mutex_lock(m);
+ 491:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 494:	83 c4 10             	add    $0x10,%esp
+}
+ 497:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 49a:	5b                   	pop    %ebx
+ 49b:	5e                   	pop    %esi
+ 49c:	5f                   	pop    %edi
+ 49d:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 49e:	e9 3d ff ff ff       	jmp    3e0 <mutex_lock>
+ 4a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4a7:	90                   	nop
+    futex_wake(&m->v, 1);
+ 4a8:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 4ab:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 4b1:	6a 01                	push   $0x1
+ 4b3:	53                   	push   %ebx
+ 4b4:	e8 f9 01 00 00       	call   6b2 <futex_wake>
+ 4b9:	83 c4 10             	add    $0x10,%esp
+ 4bc:	eb c9                	jmp    487 <cond_wait+0x17>
+ 4be:	66 90                	xchg   %ax,%ax
+
+000004c0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	83 ec 10             	sub    $0x10,%esp
+ 4c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 4c9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 4cd:	6a 01                	push   $0x1
+ 4cf:	50                   	push   %eax
+ 4d0:	e8 dd 01 00 00       	call   6b2 <futex_wake>
+}
+ 4d5:	83 c4 10             	add    $0x10,%esp
+ 4d8:	c9                   	leave
+ 4d9:	c3                   	ret
+ 4da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004e0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	83 ec 10             	sub    $0x10,%esp
+ 4e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 4e9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 4ed:	68 ff ff ff 7f       	push   $0x7fffffff
+ 4f2:	50                   	push   %eax
+ 4f3:	e8 ba 01 00 00       	call   6b2 <futex_wake>
+}
+ 4f8:	83 c4 10             	add    $0x10,%esp
+ 4fb:	c9                   	leave
+ 4fc:	c3                   	ret
+
+000004fd <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 4fd:	50                   	push   %eax
+  pushl %ebx
+ 4fe:	53                   	push   %ebx
+  movl $1, %eax
+ 4ff:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 504:	0f a2                	cpuid
+  popl %ebx
+ 506:	5b                   	pop    %ebx
+  popl %eax
+ 507:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 508:	c7 05 d0 0a 00 00 2e 	movl   $0x52e,0xad0
+ 50f:	05 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 512:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 518:	74 14                	je     52e <sysint>
+  movl $sysfast, syscallvec
+ 51a:	c7 05 d0 0a 00 00 24 	movl   $0x524,0xad0
+ 521:	05 00 00 
+
+00000524 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 524:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 526:	ba 2d 05 00 00       	mov    $0x52d,%edx
+  sysenter
+ 52b:	0f 34                	sysenter
+1:
+  ret
+ 52d:	c3                   	ret
+
+0000052e <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 52e:	cd 40                	int    $0x40
+  ret
+ 530:	c3                   	ret
+
+00000531 <fork>:
+
+SYSCALL(fork)
+ 531:	b8 01 00 00 00       	mov    $0x1,%eax
+ 536:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+0000053c <exit>:
+SYSCALL(exit)
+ 53c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 541:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+00000547 <wait>:
+SYSCALL(wait)
+ 547:	b8 03 00 00 00       	mov    $0x3,%eax
+ 54c:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+00000552 <pipe>:
+SYSCALL(pipe)
+ 552:	b8 04 00 00 00       	mov    $0x4,%eax
+ 557:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+0000055d <read>:
+SYSCALL(read)
+ 55d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 562:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+00000568 <write>:
+SYSCALL(write)
+ 568:	b8 10 00 00 00       	mov    $0x10,%eax
+ 56d:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+00000573 <close>:
+SYSCALL(close)
+ 573:	b8 15 00 00 00       	mov    $0x15,%eax
+ 578:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+0000057e <kill>:
+SYSCALL(kill)
+ 57e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 583:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+00000589 <exec>:
+SYSCALL(exec)
+ 589:	b8 07 00 00 00       	mov    $0x7,%eax
+ 58e:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+00000594 <open>:
+SYSCALL(open)
+ 594:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 599:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+0000059f <mknod>:
+SYSCALL(mknod)
+ 59f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5a4:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+000005aa <unlink>:
+SYSCALL(unlink)
+ 5aa:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5af:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+000005b5 <fstat>:
+SYSCALL(fstat)
+ 5b5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5ba:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+000005c0 <link>:
+SYSCALL(link)
+ 5c0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5c5:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+000005cb <mkdir>:
+SYSCALL(mkdir)
+ 5cb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5d0:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+000005d6 <chdir>:
+SYSCALL(chdir)
+ 5d6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5db:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+000005e1 <dup>:
+SYSCALL(dup)
+ 5e1:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5e6:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+000005ec <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 5ec:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5f1:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+000005f7 <sbrk>:
+SYSCALL(sbrk)
+ 5f7:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5fc:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+00000602 <sleep>:
+SYSCALL(sleep)
+ 602:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 607:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+0000060d <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 60d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 612:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+00000618 <swapread>:
+SYSCALL(swapread)
+ 618:	b8 16 00 00 00       	mov    $0x16,%eax
+ 61d:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+00000623 <swapwrite>:
+SYSCALL(swapwrite)
+ 623:	b8 17 00 00 00       	mov    $0x17,%eax
+ 628:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+0000062e <swapstat>:
+SYSCALL(swapstat)
+ 62e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 633:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+00000639 <madvise>:
+SYSCALL(madvise)
+ 639:	b8 19 00 00 00       	mov    $0x19,%eax
+ 63e:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+00000644 <mlock>:
+SYSCALL(mlock)
+ 644:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 649:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+0000064f <munlock>:
+SYSCALL(munlock)
+ 64f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 654:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+0000065a <membench>:
+SYSCALL(membench)
+ 65a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 65f:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+00000665 <nice>:
+SYSCALL(nice)
+ 665:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 66a:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+00000670 <setpriority>:
+SYSCALL(setpriority)
+ 670:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 675:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+0000067b <usleep>:
+SYSCALL(usleep)
+ 67b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 680:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+00000686 <cpustat>:
+SYSCALL(cpustat)
+ 686:	b8 20 00 00 00       	mov    $0x20,%eax
+ 68b:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+00000691 <clone>:
+SYSCALL(clone)
+ 691:	b8 21 00 00 00       	mov    $0x21,%eax
+ 696:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+0000069c <join>:
+SYSCALL(join)
+ 69c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6a1:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+000006a7 <futex_wait>:
+SYSCALL(futex_wait)
+ 6a7:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6ac:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+000006b2 <futex_wake>:
+SYSCALL(futex_wake)
+ 6b2:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6b7:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+000006bd <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 6bd:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6c2:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+000006c8 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 6c8:	b8 26 00 00 00       	mov    $0x26,%eax
+ 6cd:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+000006d3 <getcpu>:
+SYSCALL(getcpu)
+ 6d3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 6d8:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+000006de <migrations>:
+SYSCALL(migrations)
+ 6de:	b8 28 00 00 00       	mov    $0x28,%eax
+ 6e3:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+000006e9 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 6e9:	b8 29 00 00 00       	mov    $0x29,%eax
+ 6ee:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+000006f4 <lockstat>:
+SYSCALL(lockstat)
+ 6f4:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 6f9:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+000006ff <lockprof>:
+SYSCALL(lockprof)
+ 6ff:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 704:	ff 25 d0 0a 00 00    	jmp    *0xad0
+
+0000070a <bcachestat>:
+SYSCALL(bcachestat)
+ 70a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 70f:	ff 25 d0 0a 00 00    	jmp    *0xad0
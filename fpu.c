@@ -0,0 +1,130 @@
+// FPU and SSE state, switched lazily.
+//
+// The kernel never uses the FPU, so a process's FPU and SSE
+// registers only need saving if it touched them since it was
+// switched in.  Every CPU runs with CR0.TS set except while
+// the running process's state is in its registers: the first
+// FPU or SSE instruction a process executes after being
+// switched in traps with #NM, and fputrap() loads its state
+// then.  A process that never uses the FPU costs nothing.
+//
+// A process leaving the CPU with TS clear has its registers
+// saved to p->fpu right away, so that it may run anywhere
+// next.  Its registers also stay in the CPU, though, and if
+// it comes back to the same CPU before anyone else there used
+// the FPU, TS is cleared again without reloading anything.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "proc.h"
+
+#define MXCSR_DEFAULT 0x1F80    // all SIMD exceptions masked
+
+static int havefxsr;
+
+// Enable fxsave and SSE on this CPU, and start with TS set.
+void
+fpuinit(void)
+{
+  uint edx;
+
+  getcpuid(1, 0, 0, 0, &edx);
+  if((edx & (CPUID_FXSR|CPUID_SSE)) != (CPUID_FXSR|CPUID_SSE)){
+    // No fxsave: leave the FPU off, and let #NM kill
+    // any process that tries to use it.
+    lcr0(rcr0() | CR0_EM | CR0_TS);
+    return;
+  }
+  havefxsr = 1;
+  lcr4(rcr4() | CR4_OSFXSR | CR4_OSXMMEXCPT);
+  lcr0((rcr0() & ~CR0_EM) | CR0_MP | CR0_NE | CR0_TS);
+  mycpu()->fpuowner = 0;
+}
+
+// p is leaving this CPU: save its registers if it used them.
+// Interrupts must be off.
+void
+fpuleave(struct proc *p)
+{
+  uint cr0;
+
+  cr0 = rcr0();
+  if(cr0 & CR0_TS)
+    return;
+  fxsave(p->fpu);
+  lcr0(cr0 | CR0_TS);
+}
+
+// p is about to run on this CPU: if its registers are still
+// here, let it use them without a trap.  Interrupts must be off.
+void
+fpuenter(struct proc *p)
+{
+  struct cpu *c;
+
+  c = mycpu();
+  if(c->fpuowner == p && p->fpucpu == c - cpus)
+    clts();
+}
+
+// #NM from user space: the running process wants the FPU.
+// Returns -1 if there is none.
+int
+fputrap(void)
+{
+  struct cpu *c;
+  struct proc *p;
+
+  if(!havefxsr)
+    return -1;
+  c = mycpu();
+  p = myproc();
+  clts();
+  if(p->fpuused)
+    fxrstor(p->fpu);
+  else {
+    fninit();
+    ldmxcsr(MXCSR_DEFAULT);
+    p->fpuused = 1;
+  }
+  c->fpuowner = p;
+  p->fpucpu = c - cpus;
+  c->nfpu++;
+  return 0;
+}
+
+// Give np, a new child of the current process, a copy of its
+// FPU state.
+void
+fpufork(struct proc *np)
+{
+  struct proc *p;
+
+  p = myproc();
+  pushcli();
+  if((rcr0() & CR0_TS) == 0)
+    fxsave(p->fpu);
+  popcli();
+  np->fpuused = p->fpuused;
+  if(p->fpuused)
+    memmove(np->fpu, p->fpu, sizeof(np->fpu));
+}
+
+// Start the current process over with fresh FPU state, as
+// after exec.
+void
+fpureset(void)
+{
+  struct proc *p;
+
+  p = myproc();
+  pushcli();
+  p->fpuused = 0;
+  p->fpucpu = -1;
+  lcr0(rcr0() | CR0_TS);
+  popcli();
+}
@@ -14,8 +14,8 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
-#include "proc.h"
 #include "spinlock.h"
+#include "proc.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
@@ -160,18 +160,30 @@ bfree(int dev, uint b)
 // have locked the inodes involved; this lets callers create
 // multi-step atomic operations.
 //
-// The icache.lock spin-lock protects the allocation of icache
-// entries. Since ip->ref indicates whether an entry is free,
-// and ip->dev and ip->inum indicate which i-node an entry
-// holds, one must hold icache.lock while using any of those fields.
+// Cached inodes are on hash chains by dev and inum, and stay
+// there, still valid, after their last reference is dropped,
+// until iget() needs the entry for another inode.  iget()
+// looks the chains up without locks, under rcureadlock():
+// ip->dev and ip->inum never change while ip is on a chain,
+// and ip->ref is only changed atomically.  The icache.lock
+// spin-lock serializes changes to the chains and the free
+// list.  To evict an unreferenced entry, iget() sets its ref
+// to -1, which stops lookups from taking a reference to it,
+// and unhashes it; the entry is only reused after rcusync(),
+// when no lookup can still be looking at it.
 //
 // An ip->lock sleep-lock protects all ip-> fields other than ref,
 // dev, and inum.  One must hold ip->lock in order to
 // read or write that inode's ip->valid, ip->size, ip->type, &c.
 
+#define IHASH(dev, inum) (((dev) * 31 + (inum)) % NIHASH)
+#define NEVICT (NINODE/8 + 1)   // entries evicted per rcusync()
+
 struct {
   struct spinlock lock;
   struct inode inode[NINODE];
+  struct inode *hash[NIHASH];
+  struct inode *free;           // unhashed entries
 } icache;
 
 void
@@ -182,6 +194,8 @@ iinit(int dev)
   initlock(&icache.lock, "icache");
   for(i = 0; i < NINODE; i++) {
     initsleeplock(&icache.inode[i].lock, "inode");
+    icache.inode[i].hashnext = icache.free;
+    icache.free = &icache.inode[i];
   }
 
   readsb(dev, &sb);
@@ -241,37 +255,96 @@ iupdate(struct inode *ip)
   brelse(bp);
 }
 
+// Look for the cached inode inum on device dev and take a
+// reference to it.  Caller holds icache.lock or is in a read
+// section.  Returns 0 if it is not cached, or being evicted.
+static struct inode*
+ilookup(uint dev, uint inum)
+{
+  struct inode *ip;
+  int r;
+
+  for(ip = icache.hash[IHASH(dev, inum)]; ip; ip = ip->hashnext){
+    if(ip->dev == dev && ip->inum == inum){
+      do {
+        if((r = ip->ref) < 0)
+          return 0;
+      } while(!__sync_bool_compare_and_swap(&ip->ref, r, r+1));
+      return ip;
+    }
+  }
+  return 0;
+}
+
+// Evict up to NEVICT unreferenced inodes to the free list.
+// Caller holds icache.lock, which is dropped while waiting
+// for lookups that may have found them.
+static void
+ievict(void)
+{
+  struct inode *ip, **pp, *evicted;
+  int i, n;
+
+  evicted = 0;
+  n = 0;
+  for(i = 0; i < NIHASH && n < NEVICT; i++){
+    for(pp = &icache.hash[i]; (ip = *pp) != 0 && n < NEVICT; ){
+      if(ip->ref == 0 && __sync_bool_compare_and_swap(&ip->ref, 0, -1)){
+        // Leave ip->hashnext alone: lookups may be on ip.
+        *pp = ip->hashnext;
+        ip->evictnext = evicted;
+        evicted = ip;
+        n++;
+      } else
+        pp = &ip->hashnext;
+    }
+  }
+  if(n == 0)
+    panic("iget: no inodes");
+
+  release(&icache.lock);
+  rcusync();
+  acquire(&icache.lock);
+  for(; (ip = evicted) != 0; evicted = ip->evictnext){
+    ip->ref = 0;
+    ip->hashnext = icache.free;
+    icache.free = ip;
+  }
+}
+
 // Find the inode with number inum on device dev
 // and return the in-memory copy. Does not lock
 // the inode and does not read it from disk.
 static struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
-
-  acquire(&icache.lock);
+  struct inode *ip, **hp;
 
   // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
-      release(&icache.lock);
-      return ip;
+  rcureadlock();
+  ip = ilookup(dev, inum);
+  rcureadunlock();
+  if(ip)
+    return ip;
+
+  acquire(&icache.lock);
+  while((ip = ilookup(dev, inum)) == 0){
+    if((ip = icache.free) == 0){
+      ievict();
+      continue;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
+    // Recycle an inode cache entry.
+    icache.free = ip->hashnext;
+    ip->dev = dev;
+    ip->inum = inum;
+    ip->ref = 1;
+    ip->valid = 0;
+    hp = &icache.hash[IHASH(dev, inum)];
+    ip->hashnext = *hp;
+    __sync_synchronize();   // publish ip only once it is set up
+    *hp = ip;
+    break;
   }
-
-  // Recycle an inode cache entry.
-  if(empty == 0)
-    panic("iget: no inodes");
-
-  ip = empty;
-  ip->dev = dev;
-  ip->inum = inum;
-  ip->ref = 1;
-  ip->valid = 0;
   release(&icache.lock);
 
   return ip;
@@ -282,9 +355,7 @@ iget(uint dev, uint inum)
 struct inode*
 idup(struct inode *ip)
 {
-  acquire(&icache.lock);
-  ip->ref++;
-  release(&icache.lock);
+  __sync_fetch_and_add(&ip->ref, 1);
   return ip;
 }
 
@@ -339,10 +410,7 @@ iput(struct inode *ip)
 {
   acquiresleep(&ip->lock);
   if(ip->valid && ip->nlink == 0){
-    acquire(&icache.lock);
-    int r = ip->ref;
-    release(&icache.lock);
-    if(r == 1){
+    if(ip->ref == 1){
       // inode has no links and no other references: truncate and free.
       itrunc(ip);
       ip->type = 0;
@@ -352,9 +420,7 @@ iput(struct inode *ip)
   }
   releasesleep(&ip->lock);
 
-  acquire(&icache.lock);
-  ip->ref--;
-  release(&icache.lock);
+  __sync_fetch_and_sub(&ip->ref, 1);
 }
 
 // Common idiom: unlock, then put.
@@ -635,7 +701,7 @@ namex(char *path, int nameiparent, char *name)
   if(*path == '/')
     ip = iget(ROOTDEV, ROOTINO);
   else
-    ip = idup(myproc()->cwd);
+    ip = fdtcwd(myproc()->fdt);
 
   while((path = skipelem(path, name)) != 0){
     ilock(ip);
@@ -0,0 +1,82 @@
+// Futexes: let user code sleep until a word in memory changes.
+//
+// A waiter is keyed by the physical address of the word, so
+// processes and threads that map the same page all find each
+// other, wherever they map it.  The page is pinned in memory
+// while anyone waits on it, so that the key stays put.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+
+#define NFUTEXLOCK 16
+
+// Checking the word and going to sleep are atomic with respect
+// to wakers, who take the same lock.
+static struct spinlock futexlock[NFUTEXLOCK];
+
+static struct spinlock*
+lockof(int *key)
+{
+  return &futexlock[((uint)key >> 2) % NFUTEXLOCK];
+}
+
+void
+futexinit(void)
+{
+  int i;
+
+  for(i = 0; i < NFUTEXLOCK; i++)
+    initlock(&futexlock[i], "futex");
+}
+
+// Sleep on the word at user address addr if it still holds val.
+// Returns 0 once woken, which may be spuriously, and -1 if addr
+// is bad, the word does not hold val, or the process is killed.
+int
+futexwait(uint addr, int val)
+{
+  struct proc *curproc = myproc();
+  struct spinlock *lk;
+  int *key, r;
+
+  if(addr % 4 != 0 || addr >= curproc->sz || addr + 4 > curproc->sz)
+    return -1;
+  if((key = (int*)pinpage(curproc->pgdir, addr)) == 0)
+    return -1;
+  lk = lockof(key);
+  acquire(lk);
+  r = -1;
+  if(*key == val && !curproc->killed){
+    sleep(key, lk);
+    r = 0;
+  }
+  release(lk);
+  unpinpage((char*)key);
+  return r;
+}
+
+// Wake up at most n processes waiting on the word at user
+// address addr.  Returns the number woken, or -1 if addr is bad.
+int
+futexwake(uint addr, int n)
+{
+  struct proc *curproc = myproc();
+  struct spinlock *lk;
+  int *key, r;
+
+  if(addr % 4 != 0 || addr >= curproc->sz || addr + 4 > curproc->sz)
+    return -1;
+  if((key = (int*)pinpage(curproc->pgdir, addr)) == 0)
+    return -1;
+  lk = lockof(key);
+  acquire(lk);
+  r = wakeupn(key, n);
+  release(lk);
+  unpinpage((char*)key);
+  return r;
+}
@@ -0,0 +1,1972 @@
+
+_futexbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 04 00 00 00       	mov    $0x4,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 58             	sub    $0x58,%esp
+  19:	8b 19                	mov    (%ecx),%ebx
+  1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  void *stacks[NTHREAD], *stack;
+  uint64 t;
+  int i, n;
+
+  n = 4;
+  nops = 20000;
+  1e:	c7 05 bc 13 00 00 20 	movl   $0x4e20,0x13bc
+  25:	4e 00 00 
+  if(argc > 1)
+  28:	83 fb 01             	cmp    $0x1,%ebx
+  2b:	0f 8f 06 01 00 00    	jg     137 <main+0x137>
+  31:	8d 7d a8             	lea    -0x58(%ebp),%edi
+  34:	8d 5d e8             	lea    -0x18(%ebp),%ebx
+  37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3e:	66 90                	xchg   %ax,%ax
+  p = (uint)sbrk(2*PGSIZE);
+  40:	83 ec 0c             	sub    $0xc,%esp
+  43:	68 00 20 00 00       	push   $0x2000
+  48:	e8 da 08 00 00       	call   927 <sbrk>
+  if(p == 0xffffffff){
+  4d:	83 c4 10             	add    $0x10,%esp
+  50:	83 f8 ff             	cmp    $0xffffffff,%eax
+  53:	0f 84 49 01 00 00    	je     1a2 <main+0x1a2>
+  return (void*)((p + PGSIZE-1) & ~(PGSIZE-1));
+  59:	05 ff 0f 00 00       	add    $0xfff,%eax
+    n = 1;
+  if(n > NTHREAD)
+    n = NTHREAD;
+  if(nops < 1)
+    nops = 1;
+  for(i = 0; i < NTHREAD; i++)
+  5e:	83 c7 04             	add    $0x4,%edi
+  return (void*)((p + PGSIZE-1) & ~(PGSIZE-1));
+  61:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  66:	89 47 fc             	mov    %eax,-0x4(%edi)
+  for(i = 0; i < NTHREAD; i++)
+  69:	39 df                	cmp    %ebx,%edi
+  6b:	75 d3                	jne    40 <main+0x40>
+    stacks[i] = stackalloc();
+
+  mutex_init(&m);
+  6d:	83 ec 0c             	sub    $0xc,%esp
+  70:	68 c8 13 00 00       	push   $0x13c8
+  75:	e8 86 06 00 00       	call   700 <mutex_init>
+  run("futex mutex", withmutex, stacks, n);
+  7a:	8d 45 a8             	lea    -0x58(%ebp),%eax
+  7d:	56                   	push   %esi
+  7e:	50                   	push   %eax
+  7f:	68 20 02 00 00       	push   $0x220
+  84:	68 6c 0e 00 00       	push   $0xe6c
+  89:	e8 d2 02 00 00       	call   360 <run>
+  run("spinlock", withspin, stacks, n);
+  8e:	83 c4 20             	add    $0x20,%esp
+  91:	8d 45 a8             	lea    -0x58(%ebp),%eax
+  94:	56                   	push   %esi
+  95:	50                   	push   %eax
+  96:	68 c0 01 00 00       	push   $0x1c0
+  9b:	68 78 0e 00 00       	push   $0xe78
+  a0:	e8 bb 02 00 00       	call   360 <run>
+
+  cond_init(&cv);
+  a5:	c7 04 24 b8 13 00 00 	movl   $0x13b8,(%esp)
+  ac:	e8 df 06 00 00       	call   790 <cond_init>
+  turn = 0;
+  b1:	c7 05 b4 13 00 00 00 	movl   $0x0,0x13b4
+  b8:	00 00 00 
+
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+  bb:	0f 31                	rdtsc
+  t = rdtsc();
+  for(i = 0; i < 2; i++)
+    if(clone(pingpong, (void*)i, 0, stacks[i]) < 0){
+  bd:	ff 75 a8             	push   -0x58(%ebp)
+  c0:	89 c6                	mov    %eax,%esi
+  c2:	89 d7                	mov    %edx,%edi
+  c4:	6a 00                	push   $0x0
+  c6:	6a 00                	push   $0x0
+  c8:	68 80 02 00 00       	push   $0x280
+  cd:	e8 ef 08 00 00       	call   9c1 <clone>
+  d2:	83 c4 20             	add    $0x20,%esp
+  d5:	85 c0                	test   %eax,%eax
+  d7:	0f 88 b2 00 00 00    	js     18f <main+0x18f>
+  dd:	ff 75 ac             	push   -0x54(%ebp)
+  e0:	6a 00                	push   $0x0
+  e2:	6a 01                	push   $0x1
+  e4:	68 80 02 00 00       	push   $0x280
+  e9:	e8 d3 08 00 00       	call   9c1 <clone>
+  ee:	83 c4 10             	add    $0x10,%esp
+  f1:	85 c0                	test   %eax,%eax
+  f3:	0f 88 96 00 00 00    	js     18f <main+0x18f>
+      printf(1, "futexbench: clone failed\n");
+      exit();
+    }
+  for(i = 0; i < 2; i++)
+    join(&stack);
+  f9:	83 ec 0c             	sub    $0xc,%esp
+  fc:	8d 5d a4             	lea    -0x5c(%ebp),%ebx
+  ff:	53                   	push   %ebx
+ 100:	e8 c7 08 00 00       	call   9cc <join>
+ 105:	89 1c 24             	mov    %ebx,(%esp)
+ 108:	e8 bf 08 00 00       	call   9cc <join>
+ 10d:	0f 31                	rdtsc
+  cyclereport("condvar handoff", "ops", rdtsc() - t, 2 * nops);
+ 10f:	8b 0d bc 13 00 00    	mov    0x13bc,%ecx
+ 115:	01 c9                	add    %ecx,%ecx
+ 117:	29 f0                	sub    %esi,%eax
+ 119:	19 fa                	sbb    %edi,%edx
+ 11b:	89 0c 24             	mov    %ecx,(%esp)
+ 11e:	52                   	push   %edx
+ 11f:	50                   	push   %eax
+ 120:	68 68 0e 00 00       	push   $0xe68
+ 125:	68 81 0e 00 00       	push   $0xe81
+ 12a:	e8 91 05 00 00       	call   6c0 <cyclereport>
+  exit();
+ 12f:	83 c4 20             	add    $0x20,%esp
+ 132:	e8 35 07 00 00       	call   86c <exit>
+    n = atoi(argv[1]);
+ 137:	83 ec 0c             	sub    $0xc,%esp
+ 13a:	ff 77 04             	push   0x4(%edi)
+ 13d:	e8 de 04 00 00       	call   620 <atoi>
+  if(argc > 2)
+ 142:	83 c4 10             	add    $0x10,%esp
+    n = atoi(argv[1]);
+ 145:	89 c6                	mov    %eax,%esi
+  if(argc > 2)
+ 147:	83 fb 02             	cmp    $0x2,%ebx
+ 14a:	74 13                	je     15f <main+0x15f>
+    nops = atoi(argv[2]);
+ 14c:	83 ec 0c             	sub    $0xc,%esp
+ 14f:	ff 77 08             	push   0x8(%edi)
+ 152:	e8 c9 04 00 00       	call   620 <atoi>
+ 157:	83 c4 10             	add    $0x10,%esp
+ 15a:	a3 bc 13 00 00       	mov    %eax,0x13bc
+  if(n > NTHREAD)
+ 15f:	b8 10 00 00 00       	mov    $0x10,%eax
+ 164:	39 c6                	cmp    %eax,%esi
+ 166:	0f 4f f0             	cmovg  %eax,%esi
+ 169:	b8 01 00 00 00       	mov    $0x1,%eax
+ 16e:	85 f6                	test   %esi,%esi
+ 170:	0f 4e f0             	cmovle %eax,%esi
+  if(nops < 1)
+ 173:	83 3d bc 13 00 00 00 	cmpl   $0x0,0x13bc
+ 17a:	0f 8f b1 fe ff ff    	jg     31 <main+0x31>
+    nops = 1;
+ 180:	c7 05 bc 13 00 00 01 	movl   $0x1,0x13bc
+ 187:	00 00 00 
+  for(i = 0; i < NTHREAD; i++)
+ 18a:	e9 a2 fe ff ff       	jmp    31 <main+0x31>
+      printf(1, "futexbench: clone failed\n");
+ 18f:	50                   	push   %eax
+ 190:	50                   	push   %eax
+ 191:	68 31 0e 00 00       	push   $0xe31
+ 196:	6a 01                	push   $0x1
+ 198:	e8 53 09 00 00       	call   af0 <printf>
+      exit();
+ 19d:	e8 ca 06 00 00       	call   86c <exit>
+    printf(1, "futexbench: sbrk failed\n");
+ 1a2:	52                   	push   %edx
+ 1a3:	52                   	push   %edx
+ 1a4:	68 18 0e 00 00       	push   $0xe18
+ 1a9:	6a 01                	push   $0x1
+ 1ab:	e8 40 09 00 00       	call   af0 <printf>
+    exit();
+ 1b0:	e8 b7 06 00 00       	call   86c <exit>
+ 1b5:	66 90                	xchg   %ax,%ax
+ 1b7:	66 90                	xchg   %ax,%ax
+ 1b9:	66 90                	xchg   %ax,%ax
+ 1bb:	66 90                	xchg   %ax,%ax
+ 1bd:	66 90                	xchg   %ax,%ax
+ 1bf:	90                   	nop
+
+000001c0 <withspin>:
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < nops; i++){
+ 1c6:	a1 bc 13 00 00       	mov    0x13bc,%eax
+ 1cb:	85 c0                	test   %eax,%eax
+ 1cd:	7e 40                	jle    20f <withspin+0x4f>
+ 1cf:	31 c9                	xor    %ecx,%ecx
+  asm volatile("lock; xchgl %0, %1" :
+ 1d1:	ba 01 00 00 00       	mov    $0x1,%edx
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1e0:	89 d0                	mov    %edx,%eax
+ 1e2:	f0 87 05 c4 13 00 00 	lock xchg %eax,0x13c4
+    while(xchg(&spin, 1) != 0)
+ 1e9:	85 c0                	test   %eax,%eax
+ 1eb:	75 f3                	jne    1e0 <withspin+0x20>
+    counter++;
+ 1ed:	a1 c0 13 00 00       	mov    0x13c0,%eax
+  for(i = 0; i < nops; i++){
+ 1f2:	83 c1 01             	add    $0x1,%ecx
+    counter++;
+ 1f5:	83 c0 01             	add    $0x1,%eax
+ 1f8:	a3 c0 13 00 00       	mov    %eax,0x13c0
+    spin = 0;
+ 1fd:	c7 05 c4 13 00 00 00 	movl   $0x0,0x13c4
+ 204:	00 00 00 
+  for(i = 0; i < nops; i++){
+ 207:	39 0d bc 13 00 00    	cmp    %ecx,0x13bc
+ 20d:	7f d1                	jg     1e0 <withspin+0x20>
+  exit();
+ 20f:	e8 58 06 00 00       	call   86c <exit>
+ 214:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 21f:	90                   	nop
+
+00000220 <withmutex>:
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	53                   	push   %ebx
+ 224:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < nops; i++){
+ 227:	a1 bc 13 00 00       	mov    0x13bc,%eax
+ 22c:	85 c0                	test   %eax,%eax
+ 22e:	7e 3c                	jle    26c <withmutex+0x4c>
+ 230:	31 db                	xor    %ebx,%ebx
+ 232:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&m);
+ 238:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < nops; i++){
+ 23b:	83 c3 01             	add    $0x1,%ebx
+    mutex_lock(&m);
+ 23e:	68 c8 13 00 00       	push   $0x13c8
+ 243:	e8 c8 04 00 00       	call   710 <mutex_lock>
+    counter++;
+ 248:	a1 c0 13 00 00       	mov    0x13c0,%eax
+    mutex_unlock(&m);
+ 24d:	c7 04 24 c8 13 00 00 	movl   $0x13c8,(%esp)
+    counter++;
+ 254:	83 c0 01             	add    $0x1,%eax
+ 257:	a3 c0 13 00 00       	mov    %eax,0x13c0
+    mutex_unlock(&m);
+ 25c:	e8 ff 04 00 00       	call   760 <mutex_unlock>
+  for(i = 0; i < nops; i++){
+ 261:	83 c4 10             	add    $0x10,%esp
+ 264:	39 1d bc 13 00 00    	cmp    %ebx,0x13bc
+ 26a:	7f cc                	jg     238 <withmutex+0x18>
+  exit();
+ 26c:	e8 fb 05 00 00       	call   86c <exit>
+ 271:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 278:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27f:	90                   	nop
+
+00000280 <pingpong>:
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	56                   	push   %esi
+ 285:	53                   	push   %ebx
+ 286:	83 ec 18             	sub    $0x18,%esp
+ 289:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  mutex_lock(&m);
+ 28c:	68 c8 13 00 00       	push   $0x13c8
+ 291:	e8 7a 04 00 00       	call   710 <mutex_lock>
+  for(i = 0; i < nops; i++){
+ 296:	a1 bc 13 00 00       	mov    0x13bc,%eax
+ 29b:	83 c4 10             	add    $0x10,%esp
+ 29e:	85 c0                	test   %eax,%eax
+ 2a0:	7e 5d                	jle    2ff <pingpong+0x7f>
+    turn = !me;
+ 2a2:	31 c0                	xor    %eax,%eax
+ 2a4:	85 db                	test   %ebx,%ebx
+ 2a6:	0f 94 c0             	sete   %al
+  for(i = 0; i < nops; i++){
+ 2a9:	31 f6                	xor    %esi,%esi
+    turn = !me;
+ 2ab:	89 c7                	mov    %eax,%edi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    while(turn != me)
+ 2b0:	a1 b4 13 00 00       	mov    0x13b4,%eax
+ 2b5:	39 c3                	cmp    %eax,%ebx
+ 2b7:	74 25                	je     2de <pingpong+0x5e>
+ 2b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      cond_wait(&cv, &m);
+ 2c0:	83 ec 08             	sub    $0x8,%esp
+ 2c3:	68 c8 13 00 00       	push   $0x13c8
+ 2c8:	68 b8 13 00 00       	push   $0x13b8
+ 2cd:	e8 ce 04 00 00       	call   7a0 <cond_wait>
+    while(turn != me)
+ 2d2:	a1 b4 13 00 00       	mov    0x13b4,%eax
+ 2d7:	83 c4 10             	add    $0x10,%esp
+ 2da:	39 d8                	cmp    %ebx,%eax
+ 2dc:	75 e2                	jne    2c0 <pingpong+0x40>
+    cond_signal(&cv);
+ 2de:	83 ec 0c             	sub    $0xc,%esp
+    turn = !me;
+ 2e1:	89 3d b4 13 00 00    	mov    %edi,0x13b4
+  for(i = 0; i < nops; i++){
+ 2e7:	83 c6 01             	add    $0x1,%esi
+    cond_signal(&cv);
+ 2ea:	68 b8 13 00 00       	push   $0x13b8
+ 2ef:	e8 fc 04 00 00       	call   7f0 <cond_signal>
+  for(i = 0; i < nops; i++){
+ 2f4:	83 c4 10             	add    $0x10,%esp
+ 2f7:	39 35 bc 13 00 00    	cmp    %esi,0x13bc
+ 2fd:	7f b1                	jg     2b0 <pingpong+0x30>
+  mutex_unlock(&m);
+ 2ff:	83 ec 0c             	sub    $0xc,%esp
+ 302:	68 c8 13 00 00       	push   $0x13c8
+ 307:	e8 54 04 00 00       	call   760 <mutex_unlock>
+  exit();
+ 30c:	e8 5b 05 00 00       	call   86c <exit>
+ 311:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 318:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31f:	90                   	nop
+
+00000320 <stackalloc>:
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	83 ec 14             	sub    $0x14,%esp
+  p = (uint)sbrk(2*PGSIZE);
+ 326:	68 00 20 00 00       	push   $0x2000
+ 32b:	e8 f7 05 00 00       	call   927 <sbrk>
+  if(p == 0xffffffff){
+ 330:	83 c4 10             	add    $0x10,%esp
+ 333:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 336:	74 0c                	je     344 <stackalloc+0x24>
+}
+ 338:	c9                   	leave
+  return (void*)((p + PGSIZE-1) & ~(PGSIZE-1));
+ 339:	05 ff 0f 00 00       	add    $0xfff,%eax
+ 33e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+}
+ 343:	c3                   	ret
+    printf(1, "futexbench: sbrk failed\n");
+ 344:	50                   	push   %eax
+ 345:	50                   	push   %eax
+ 346:	68 18 0e 00 00       	push   $0xe18
+ 34b:	6a 01                	push   $0x1
+ 34d:	e8 9e 07 00 00       	call   af0 <printf>
+    exit();
+ 352:	e8 15 05 00 00       	call   86c <exit>
+ 357:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35e:	66 90                	xchg   %ax,%ax
+
+00000360 <run>:
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	57                   	push   %edi
+ 364:	56                   	push   %esi
+ 365:	53                   	push   %ebx
+ 366:	83 ec 2c             	sub    $0x2c,%esp
+ 369:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 36c:	8b 75 10             	mov    0x10(%ebp),%esi
+  counter = 0;
+ 36f:	c7 05 c0 13 00 00 00 	movl   $0x0,0x13c0
+ 376:	00 00 00 
+  asm volatile("rdtsc" : "=A" (tsc));
+ 379:	0f 31                	rdtsc
+ 37b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  for(i = 0; i < n; i++)
+ 37e:	8b 45 14             	mov    0x14(%ebp),%eax
+ 381:	31 db                	xor    %ebx,%ebx
+ 383:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 386:	85 c0                	test   %eax,%eax
+ 388:	7f 08                	jg     392 <run+0x32>
+ 38a:	eb 49                	jmp    3d5 <run+0x75>
+ 38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 390:	89 c3                	mov    %eax,%ebx
+    if(clone(fn, 0, 0, stacks[i]) < 0){
+ 392:	ff 34 9e             	push   (%esi,%ebx,4)
+ 395:	6a 00                	push   $0x0
+ 397:	6a 00                	push   $0x0
+ 399:	57                   	push   %edi
+ 39a:	e8 22 06 00 00       	call   9c1 <clone>
+ 39f:	83 c4 10             	add    $0x10,%esp
+ 3a2:	85 c0                	test   %eax,%eax
+ 3a4:	0f 88 87 00 00 00    	js     431 <run+0xd1>
+  for(i = 0; i < n; i++)
+ 3aa:	8d 43 01             	lea    0x1(%ebx),%eax
+ 3ad:	39 45 14             	cmp    %eax,0x14(%ebp)
+ 3b0:	75 de                	jne    390 <run+0x30>
+  for(i = 0; i < n; i++)
+ 3b2:	31 ff                	xor    %edi,%edi
+ 3b4:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+ 3b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3be:	66 90                	xchg   %ax,%ax
+    join(&stack);
+ 3c0:	83 ec 0c             	sub    $0xc,%esp
+ 3c3:	56                   	push   %esi
+ 3c4:	e8 03 06 00 00       	call   9cc <join>
+  for(i = 0; i < n; i++)
+ 3c9:	89 f8                	mov    %edi,%eax
+ 3cb:	83 c4 10             	add    $0x10,%esp
+ 3ce:	83 c7 01             	add    $0x1,%edi
+ 3d1:	39 c3                	cmp    %eax,%ebx
+ 3d3:	75 eb                	jne    3c0 <run+0x60>
+ 3d5:	0f 31                	rdtsc
+  t = rdtsc() - t;
+ 3d7:	2b 45 d0             	sub    -0x30(%ebp),%eax
+ 3da:	1b 55 d4             	sbb    -0x2c(%ebp),%edx
+ 3dd:	89 d7                	mov    %edx,%edi
+  if(counter != n * nops)
+ 3df:	8b 55 14             	mov    0x14(%ebp),%edx
+ 3e2:	0f af 15 bc 13 00 00 	imul   0x13bc,%edx
+  t = rdtsc() - t;
+ 3e9:	89 c6                	mov    %eax,%esi
+  if(counter != n * nops)
+ 3eb:	a1 c0 13 00 00       	mov    0x13c0,%eax
+ 3f0:	39 c2                	cmp    %eax,%edx
+ 3f2:	74 1f                	je     413 <run+0xb3>
+    printf(1, "futexbench: %s lost updates\n", what);
+ 3f4:	83 ec 04             	sub    $0x4,%esp
+ 3f7:	ff 75 08             	push   0x8(%ebp)
+ 3fa:	68 4b 0e 00 00       	push   $0xe4b
+ 3ff:	6a 01                	push   $0x1
+ 401:	e8 ea 06 00 00       	call   af0 <printf>
+  cyclereport(what, "ops", t, n * nops);
+ 406:	8b 45 14             	mov    0x14(%ebp),%eax
+ 409:	0f af 05 bc 13 00 00 	imul   0x13bc,%eax
+ 410:	83 c4 10             	add    $0x10,%esp
+ 413:	83 ec 0c             	sub    $0xc,%esp
+ 416:	50                   	push   %eax
+ 417:	57                   	push   %edi
+ 418:	56                   	push   %esi
+ 419:	68 68 0e 00 00       	push   $0xe68
+ 41e:	ff 75 08             	push   0x8(%ebp)
+ 421:	e8 9a 02 00 00       	call   6c0 <cyclereport>
+}
+ 426:	83 c4 20             	add    $0x20,%esp
+ 429:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 42c:	5b                   	pop    %ebx
+ 42d:	5e                   	pop    %esi
+ 42e:	5f                   	pop    %edi
+ 42f:	5d                   	pop    %ebp
+ 430:	c3                   	ret
+      printf(1, "futexbench: clone failed\n");
+ 431:	83 ec 08             	sub    $0x8,%esp
+ 434:	68 31 0e 00 00       	push   $0xe31
+ 439:	6a 01                	push   $0x1
+ 43b:	e8 b0 06 00 00       	call   af0 <printf>
+      exit();
+ 440:	e8 27 04 00 00       	call   86c <exit>
+ 445:	66 90                	xchg   %ax,%ax
+ 447:	66 90                	xchg   %ax,%ax
+ 449:	66 90                	xchg   %ax,%ax
+ 44b:	66 90                	xchg   %ax,%ax
+ 44d:	66 90                	xchg   %ax,%ax
+ 44f:	90                   	nop
+
+00000450 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 450:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 451:	31 c0                	xor    %eax,%eax
+{
+ 453:	89 e5                	mov    %esp,%ebp
+ 455:	53                   	push   %ebx
+ 456:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 459:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 460:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 464:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 467:	83 c0 01             	add    $0x1,%eax
+ 46a:	84 d2                	test   %dl,%dl
+ 46c:	75 f2                	jne    460 <strcpy+0x10>
+    ;
+  return os;
+}
+ 46e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 471:	89 c8                	mov    %ecx,%eax
+ 473:	c9                   	leave
+ 474:	c3                   	ret
+ 475:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	53                   	push   %ebx
+ 484:	8b 55 08             	mov    0x8(%ebp),%edx
+ 487:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 48a:	0f b6 02             	movzbl (%edx),%eax
+ 48d:	84 c0                	test   %al,%al
+ 48f:	75 17                	jne    4a8 <strcmp+0x28>
+ 491:	eb 3a                	jmp    4cd <strcmp+0x4d>
+ 493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 497:	90                   	nop
+ 498:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 49c:	83 c2 01             	add    $0x1,%edx
+ 49f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 4a2:	84 c0                	test   %al,%al
+ 4a4:	74 1a                	je     4c0 <strcmp+0x40>
+    p++, q++;
+ 4a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 4a8:	0f b6 19             	movzbl (%ecx),%ebx
+ 4ab:	38 c3                	cmp    %al,%bl
+ 4ad:	74 e9                	je     498 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 4af:	29 d8                	sub    %ebx,%eax
+}
+ 4b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4b4:	c9                   	leave
+ 4b5:	c3                   	ret
+ 4b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 4c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 4c4:	31 c0                	xor    %eax,%eax
+ 4c6:	29 d8                	sub    %ebx,%eax
+}
+ 4c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4cb:	c9                   	leave
+ 4cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 4cd:	0f b6 19             	movzbl (%ecx),%ebx
+ 4d0:	31 c0                	xor    %eax,%eax
+ 4d2:	eb db                	jmp    4af <strcmp+0x2f>
+ 4d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4df:	90                   	nop
+
+000004e0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 4e6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 4e9:	74 15                	je     500 <strlen+0x20>
+ 4eb:	31 c0                	xor    %eax,%eax
+ 4ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 4f0:	83 c0 01             	add    $0x1,%eax
+ 4f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 4f7:	89 c1                	mov    %eax,%ecx
+ 4f9:	75 f5                	jne    4f0 <strlen+0x10>
+    ;
+  return n;
+}
+ 4fb:	89 c8                	mov    %ecx,%eax
+ 4fd:	5d                   	pop    %ebp
+ 4fe:	c3                   	ret
+ 4ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 500:	31 c9                	xor    %ecx,%ecx
+}
+ 502:	5d                   	pop    %ebp
+ 503:	89 c8                	mov    %ecx,%eax
+ 505:	c3                   	ret
+ 506:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000510 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+ 514:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("cld; rep stosb" :
+ 517:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 51a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 51d:	89 d7                	mov    %edx,%edi
+ 51f:	fc                   	cld
+ 520:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 522:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 525:	89 d0                	mov    %edx,%eax
+ 527:	c9                   	leave
+ 528:	c3                   	ret
+ 529:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000530 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	8b 45 08             	mov    0x8(%ebp),%eax
+ 536:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 53a:	0f b6 10             	movzbl (%eax),%edx
+ 53d:	84 d2                	test   %dl,%dl
+ 53f:	75 12                	jne    553 <strchr+0x23>
+ 541:	eb 1d                	jmp    560 <strchr+0x30>
+ 543:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 547:	90                   	nop
+ 548:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 54c:	83 c0 01             	add    $0x1,%eax
+ 54f:	84 d2                	test   %dl,%dl
+ 551:	74 0d                	je     560 <strchr+0x30>
+    if(*s == c)
+ 553:	38 d1                	cmp    %dl,%cl
+ 555:	75 f1                	jne    548 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 557:	5d                   	pop    %ebp
+ 558:	c3                   	ret
+ 559:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 560:	31 c0                	xor    %eax,%eax
+}
+ 562:	5d                   	pop    %ebp
+ 563:	c3                   	ret
+ 564:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 56f:	90                   	nop
+
+00000570 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	57                   	push   %edi
+ 574:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 575:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 578:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 579:	31 db                	xor    %ebx,%ebx
+{
+ 57b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 57e:	eb 27                	jmp    5a7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 580:	83 ec 04             	sub    $0x4,%esp
+ 583:	6a 01                	push   $0x1
+ 585:	56                   	push   %esi
+ 586:	6a 00                	push   $0x0
+ 588:	e8 00 03 00 00       	call   88d <read>
+    if(cc < 1)
+ 58d:	83 c4 10             	add    $0x10,%esp
+ 590:	85 c0                	test   %eax,%eax
+ 592:	7e 1d                	jle    5b1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 594:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 598:	8b 55 08             	mov    0x8(%ebp),%edx
+ 59b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 59f:	3c 0a                	cmp    $0xa,%al
+ 5a1:	74 10                	je     5b3 <gets+0x43>
+ 5a3:	3c 0d                	cmp    $0xd,%al
+ 5a5:	74 0c                	je     5b3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 5a7:	89 df                	mov    %ebx,%edi
+ 5a9:	83 c3 01             	add    $0x1,%ebx
+ 5ac:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 5af:	7c cf                	jl     580 <gets+0x10>
+ 5b1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 5b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 5ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5bd:	5b                   	pop    %ebx
+ 5be:	5e                   	pop    %esi
+ 5bf:	5f                   	pop    %edi
+ 5c0:	5d                   	pop    %ebp
+ 5c1:	c3                   	ret
+ 5c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	56                   	push   %esi
+ 5d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 5d5:	83 ec 08             	sub    $0x8,%esp
+ 5d8:	6a 00                	push   $0x0
+ 5da:	ff 75 08             	push   0x8(%ebp)
+ 5dd:	e8 e2 02 00 00       	call   8c4 <open>
+  if(fd < 0)
+ 5e2:	83 c4 10             	add    $0x10,%esp
+ 5e5:	85 c0                	test   %eax,%eax
+ 5e7:	78 27                	js     610 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 5e9:	83 ec 08             	sub    $0x8,%esp
+ 5ec:	ff 75 0c             	push   0xc(%ebp)
+ 5ef:	89 c3                	mov    %eax,%ebx
+ 5f1:	50                   	push   %eax
+ 5f2:	e8 ee 02 00 00       	call   8e5 <fstat>
+  close(fd);
+ 5f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 5fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 5fc:	e8 a2 02 00 00       	call   8a3 <close>
+  return r;
+ 601:	83 c4 10             	add    $0x10,%esp
+}
+ 604:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 607:	89 f0                	mov    %esi,%eax
+ 609:	5b                   	pop    %ebx
+ 60a:	5e                   	pop    %esi
+ 60b:	5d                   	pop    %ebp
+ 60c:	c3                   	ret
+ 60d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 610:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 615:	eb ed                	jmp    604 <stat+0x34>
+ 617:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61e:	66 90                	xchg   %ax,%ax
+
+00000620 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	53                   	push   %ebx
+ 624:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 627:	0f be 02             	movsbl (%edx),%eax
+ 62a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 62d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 630:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 635:	77 1e                	ja     655 <atoi+0x35>
+ 637:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 63e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 640:	83 c2 01             	add    $0x1,%edx
+ 643:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 646:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 64a:	0f be 02             	movsbl (%edx),%eax
+ 64d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 650:	80 fb 09             	cmp    $0x9,%bl
+ 653:	76 eb                	jbe    640 <atoi+0x20>
+  return n;
+}
+ 655:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 658:	89 c8                	mov    %ecx,%eax
+ 65a:	c9                   	leave
+ 65b:	c3                   	ret
+ 65c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000660 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	57                   	push   %edi
+ 664:	56                   	push   %esi
+ 665:	8b 45 10             	mov    0x10(%ebp),%eax
+ 668:	8b 55 08             	mov    0x8(%ebp),%edx
+ 66b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 66e:	85 c0                	test   %eax,%eax
+ 670:	7e 13                	jle    685 <memmove+0x25>
+ 672:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 674:	89 d7                	mov    %edx,%edi
+ 676:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 680:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 681:	39 f8                	cmp    %edi,%eax
+ 683:	75 fb                	jne    680 <memmove+0x20>
+  return vdst;
+}
+ 685:	5e                   	pop    %esi
+ 686:	89 d0                	mov    %edx,%eax
+ 688:	5f                   	pop    %edi
+ 689:	5d                   	pop    %ebp
+ 68a:	c3                   	ret
+ 68b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 68f:	90                   	nop
+
+00000690 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 690:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 695:	85 c0                	test   %eax,%eax
+ 697:	74 07                	je     6a0 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 699:	c3                   	ret
+ 69a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 6a0:	e9 77 02 00 00       	jmp    91c <sysgetpid>
+ 6a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006b0 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 6b0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 6b5:	c3                   	ret
+ 6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006c0 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 6c0:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 6c1:	31 d2                	xor    %edx,%edx
+ 6c3:	89 e5                	mov    %esp,%ebp
+ 6c5:	53                   	push   %ebx
+ 6c6:	83 ec 04             	sub    $0x4,%esp
+ 6c9:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 6cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 6cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 6d2:	85 c9                	test   %ecx,%ecx
+ 6d4:	7e 08                	jle    6de <cyclereport+0x1e>
+ 6d6:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 6d8:	89 d8                	mov    %ebx,%eax
+ 6da:	f7 f1                	div    %ecx
+ 6dc:	89 c2                	mov    %eax,%edx
+ 6de:	83 ec 08             	sub    $0x8,%esp
+ 6e1:	52                   	push   %edx
+ 6e2:	ff 75 0c             	push   0xc(%ebp)
+ 6e5:	51                   	push   %ecx
+ 6e6:	ff 75 08             	push   0x8(%ebp)
+ 6e9:	68 91 0e 00 00       	push   $0xe91
+ 6ee:	6a 01                	push   $0x1
+ 6f0:	e8 fb 03 00 00       	call   af0 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 6f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6f8:	83 c4 20             	add    $0x20,%esp
+ 6fb:	c9                   	leave
+ 6fc:	c3                   	ret
+ 6fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000700 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 700:	55                   	push   %ebp
+ 701:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 703:	8b 45 08             	mov    0x8(%ebp),%eax
+ 706:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 70c:	5d                   	pop    %ebp
+ 70d:	c3                   	ret
+ 70e:	66 90                	xchg   %ax,%ax
+
+00000710 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 710:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 711:	31 c0                	xor    %eax,%eax
+ 713:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 718:	89 e5                	mov    %esp,%ebp
+ 71a:	56                   	push   %esi
+ 71b:	53                   	push   %ebx
+ 71c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 71f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 723:	85 c0                	test   %eax,%eax
+ 725:	74 30                	je     757 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 727:	83 f8 02             	cmp    $0x2,%eax
+ 72a:	74 0c                	je     738 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 72c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 731:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 734:	85 c0                	test   %eax,%eax
+ 736:	74 1f                	je     757 <mutex_lock+0x47>
+ 738:	be 02 00 00 00       	mov    $0x2,%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 740:	83 ec 08             	sub    $0x8,%esp
+ 743:	6a 02                	push   $0x2
+ 745:	53                   	push   %ebx
+ 746:	e8 8c 02 00 00       	call   9d7 <futex_wait>
+ 74b:	89 f0                	mov    %esi,%eax
+ 74d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 750:	83 c4 10             	add    $0x10,%esp
+ 753:	85 c0                	test   %eax,%eax
+ 755:	75 e9                	jne    740 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 757:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 75a:	5b                   	pop    %ebx
+ 75b:	5e                   	pop    %esi
+ 75c:	5d                   	pop    %ebp
+ 75d:	c3                   	ret
+ 75e:	66 90                	xchg   %ax,%ax
+
+00000760 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 760:	55                   	push   %ebp
+ 761:	89 e5                	mov    %esp,%ebp
+ 763:	83 ec 08             	sub    $0x8,%esp
+ 766:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 769:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 76d:	75 09                	jne    778 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 76f:	c9                   	leave
+ 770:	c3                   	ret
+ 771:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 778:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 77b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 781:	6a 01                	push   $0x1
+ 783:	50                   	push   %eax
+ 784:	e8 59 02 00 00       	call   9e2 <futex_wake>
+ 789:	83 c4 10             	add    $0x10,%esp
+}
+ 78c:	c9                   	leave
+ 78d:	c3                   	ret
+ 78e:	66 90                	xchg   %ax,%ax
+
+00000790 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 790:	55                   	push   %ebp
+ 791:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 793:	8b 45 08             	mov    0x8(%ebp),%eax
+ 796:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 79c:	5d                   	pop    %ebp
+ 79d:	c3                   	ret
+ 79e:	66 90                	xchg   %ax,%ax
+
+000007a0 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 7a0:	55                   	push   %ebp
+ 7a1:	89 e5                	mov    %esp,%ebp
+ 7a3:	57                   	push   %edi
+ 7a4:	56                   	push   %esi
+ 7a5:	53                   	push   %ebx
+ 7a6:	83 ec 0c             	sub    $0xc,%esp
+ 7a9:	8b 75 08             	mov    0x8(%ebp),%esi
+ 7ac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 7af:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 7b1:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 7b5:	75 21                	jne    7d8 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 7b7:	83 ec 08             	sub    $0x8,%esp
+ 7ba:	57                   	push   %edi
+ 7bb:	56                   	push   %esi
+ 7bc:	e8 16 02 00 00       	call   9d7 <futex_wait>
+  mutex_lock(m);
+ 7c1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 7c4:	83 c4 10             	add    $0x10,%esp
+}
+ 7c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7ca:	5b                   	pop    %ebx
+ 7cb:	5e                   	pop    %esi
+ 7cc:	5f                   	pop    %edi
+ 7cd:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 7ce:	e9 3d ff ff ff       	jmp    710 <mutex_lock>
+ 7d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7d7:	90                   	nop
+    futex_wake(&m->v, 1);
+ 7d8:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 7db:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 7e1:	6a 01                	push   $0x1
+ 7e3:	53                   	push   %ebx
+ 7e4:	e8 f9 01 00 00       	call   9e2 <futex_wake>
+ 7e9:	83 c4 10             	add    $0x10,%esp
+ 7ec:	eb c9                	jmp    7b7 <cond_wait+0x17>
+ 7ee:	66 90                	xchg   %ax,%ax
+
+000007f0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 7f0:	55                   	push   %ebp
+ 7f1:	89 e5                	mov    %esp,%ebp
+ 7f3:	83 ec 10             	sub    $0x10,%esp
+ 7f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 7f9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 7fd:	6a 01                	push   $0x1
+ 7ff:	50                   	push   %eax
+ 800:	e8 dd 01 00 00       	call   9e2 <futex_wake>
+}
+ 805:	83 c4 10             	add    $0x10,%esp
+ 808:	c9                   	leave
+ 809:	c3                   	ret
+ 80a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000810 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 810:	55                   	push   %ebp
+ 811:	89 e5                	mov    %esp,%ebp
+ 813:	83 ec 10             	sub    $0x10,%esp
+ 816:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 819:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 81d:	68 ff ff ff 7f       	push   $0x7fffffff
+ 822:	50                   	push   %eax
+ 823:	e8 ba 01 00 00       	call   9e2 <futex_wake>
+}
+ 828:	83 c4 10             	add    $0x10,%esp
+ 82b:	c9                   	leave
+ 82c:	c3                   	ret
+
+0000082d <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 82d:	50                   	push   %eax
+  pushl %ebx
+ 82e:	53                   	push   %ebx
+  movl $1, %eax
+ 82f:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 834:	0f a2                	cpuid
+  popl %ebx
+ 836:	5b                   	pop    %ebx
+  popl %eax
+ 837:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 838:	c7 05 b0 13 00 00 5e 	movl   $0x85e,0x13b0
+ 83f:	08 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 842:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 848:	74 14                	je     85e <sysint>
+  movl $sysfast, syscallvec
+ 84a:	c7 05 b0 13 00 00 54 	movl   $0x854,0x13b0
+ 851:	08 00 00 
+
+00000854 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 854:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 856:	ba 5d 08 00 00       	mov    $0x85d,%edx
+  sysenter
+ 85b:	0f 34                	sysenter
+1:
+  ret
+ 85d:	c3                   	ret
+
+0000085e <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 85e:	cd 40                	int    $0x40
+  ret
+ 860:	c3                   	ret
+
+00000861 <fork>:
+
+SYSCALL(fork)
+ 861:	b8 01 00 00 00       	mov    $0x1,%eax
+ 866:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+0000086c <exit>:
+SYSCALL(exit)
+ 86c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 871:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+00000877 <wait>:
+SYSCALL(wait)
+ 877:	b8 03 00 00 00       	mov    $0x3,%eax
+ 87c:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+00000882 <pipe>:
+SYSCALL(pipe)
+ 882:	b8 04 00 00 00       	mov    $0x4,%eax
+ 887:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+0000088d <read>:
+SYSCALL(read)
+ 88d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 892:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+00000898 <write>:
+SYSCALL(write)
+ 898:	b8 10 00 00 00       	mov    $0x10,%eax
+ 89d:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+000008a3 <close>:
+SYSCALL(close)
+ 8a3:	b8 15 00 00 00       	mov    $0x15,%eax
+ 8a8:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+000008ae <kill>:
+SYSCALL(kill)
+ 8ae:	b8 06 00 00 00       	mov    $0x6,%eax
+ 8b3:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+000008b9 <exec>:
+SYSCALL(exec)
+ 8b9:	b8 07 00 00 00       	mov    $0x7,%eax
+ 8be:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+000008c4 <open>:
+SYSCALL(open)
+ 8c4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 8c9:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+000008cf <mknod>:
+SYSCALL(mknod)
+ 8cf:	b8 11 00 00 00       	mov    $0x11,%eax
+ 8d4:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+000008da <unlink>:
+SYSCALL(unlink)
+ 8da:	b8 12 00 00 00       	mov    $0x12,%eax
+ 8df:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+000008e5 <fstat>:
+SYSCALL(fstat)
+ 8e5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 8ea:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+000008f0 <link>:
+SYSCALL(link)
+ 8f0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 8f5:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+000008fb <mkdir>:
+SYSCALL(mkdir)
+ 8fb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 900:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+00000906 <chdir>:
+SYSCALL(chdir)
+ 906:	b8 09 00 00 00       	mov    $0x9,%eax
+ 90b:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+00000911 <dup>:
+SYSCALL(dup)
+ 911:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 916:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+0000091c <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 91c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 921:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+00000927 <sbrk>:
+SYSCALL(sbrk)
+ 927:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 92c:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+00000932 <sleep>:
+SYSCALL(sleep)
+ 932:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 937:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+0000093d <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 93d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 942:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+00000948 <swapread>:
+SYSCALL(swapread)
+ 948:	b8 16 00 00 00       	mov    $0x16,%eax
+ 94d:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+00000953 <swapwrite>:
+SYSCALL(swapwrite)
+ 953:	b8 17 00 00 00       	mov    $0x17,%eax
+ 958:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+0000095e <swapstat>:
+SYSCALL(swapstat)
+ 95e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 963:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+00000969 <madvise>:
+SYSCALL(madvise)
+ 969:	b8 19 00 00 00       	mov    $0x19,%eax
+ 96e:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+00000974 <mlock>:
+SYSCALL(mlock)
+ 974:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 979:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+0000097f <munlock>:
+SYSCALL(munlock)
+ 97f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 984:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+0000098a <membench>:
+SYSCALL(membench)
+ 98a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 98f:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+00000995 <nice>:
+SYSCALL(nice)
+ 995:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 99a:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+000009a0 <setpriority>:
+SYSCALL(setpriority)
+ 9a0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 9a5:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+000009ab <usleep>:
+SYSCALL(usleep)
+ 9ab:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 9b0:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+000009b6 <cpustat>:
+SYSCALL(cpustat)
+ 9b6:	b8 20 00 00 00       	mov    $0x20,%eax
+ 9bb:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+000009c1 <clone>:
+SYSCALL(clone)
+ 9c1:	b8 21 00 00 00       	mov    $0x21,%eax
+ 9c6:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+000009cc <join>:
+SYSCALL(join)
+ 9cc:	b8 22 00 00 00       	mov    $0x22,%eax
+ 9d1:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+000009d7 <futex_wait>:
+SYSCALL(futex_wait)
+ 9d7:	b8 23 00 00 00       	mov    $0x23,%eax
+ 9dc:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+000009e2 <futex_wake>:
+SYSCALL(futex_wake)
+ 9e2:	b8 24 00 00 00       	mov    $0x24,%eax
+ 9e7:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+000009ed <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 9ed:	b8 25 00 00 00       	mov    $0x25,%eax
+ 9f2:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+000009f8 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 9f8:	b8 26 00 00 00       	mov    $0x26,%eax
+ 9fd:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+00000a03 <getcpu>:
+SYSCALL(getcpu)
+ a03:	b8 27 00 00 00       	mov    $0x27,%eax
+ a08:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+00000a0e <migrations>:
+SYSCALL(migrations)
+ a0e:	b8 28 00 00 00       	mov    $0x28,%eax
+ a13:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+00000a19 <ioring_enter>:
+SYSCALL(ioring_enter)
+ a19:	b8 29 00 00 00       	mov    $0x29,%eax
+ a1e:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+00000a24 <lockstat>:
+SYSCALL(lockstat)
+ a24:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ a29:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+00000a2f <lockprof>:
+SYSCALL(lockprof)
+ a2f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ a34:	ff 25 b0 13 00 00    	jmp    *0x13b0
+
+00000a3a <bcachestat>:
+SYSCALL(bcachestat)
+ a3a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ a3f:	ff 25 b0 13 00 00    	jmp    *0x13b0
+ a45:	66 90                	xchg   %ax,%ax
+ a47:	66 90                	xchg   %ax,%ax
+ a49:	66 90                	xchg   %ax,%ax
+ a4b:	66 90                	xchg   %ax,%ax
+ a4d:	66 90                	xchg   %ax,%ax
+ a4f:	90                   	nop
+
+00000a50 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a50:	55                   	push   %ebp
+ a51:	89 e5                	mov    %esp,%ebp
+ a53:	57                   	push   %edi
+ a54:	56                   	push   %esi
+ a55:	53                   	push   %ebx
+ a56:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ a58:	89 d1                	mov    %edx,%ecx
+{
+ a5a:	83 ec 3c             	sub    $0x3c,%esp
+ a5d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ a60:	85 d2                	test   %edx,%edx
+ a62:	0f 89 80 00 00 00    	jns    ae8 <printint+0x98>
+ a68:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ a6c:	74 7a                	je     ae8 <printint+0x98>
+    x = -xx;
+ a6e:	f7 d9                	neg    %ecx
+    neg = 1;
+ a70:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ a75:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ a78:	31 f6                	xor    %esi,%esi
+ a7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ a80:	89 c8                	mov    %ecx,%eax
+ a82:	31 d2                	xor    %edx,%edx
+ a84:	89 f7                	mov    %esi,%edi
+ a86:	f7 f3                	div    %ebx
+ a88:	8d 76 01             	lea    0x1(%esi),%esi
+ a8b:	0f b6 92 0c 0f 00 00 	movzbl 0xf0c(%edx),%edx
+ a92:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ a96:	89 ca                	mov    %ecx,%edx
+ a98:	89 c1                	mov    %eax,%ecx
+ a9a:	39 da                	cmp    %ebx,%edx
+ a9c:	73 e2                	jae    a80 <printint+0x30>
+  if(neg)
+ a9e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ aa1:	85 c0                	test   %eax,%eax
+ aa3:	74 07                	je     aac <printint+0x5c>
+    buf[i++] = '-';
+ aa5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ aaa:	89 f7                	mov    %esi,%edi
+ aac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ aaf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ ab2:	01 df                	add    %ebx,%edi
+ ab4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ ab8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ abb:	83 ec 04             	sub    $0x4,%esp
+ abe:	88 45 d7             	mov    %al,-0x29(%ebp)
+ ac1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ ac4:	6a 01                	push   $0x1
+ ac6:	50                   	push   %eax
+ ac7:	56                   	push   %esi
+ ac8:	e8 cb fd ff ff       	call   898 <write>
+  while(--i >= 0)
+ acd:	89 f8                	mov    %edi,%eax
+ acf:	83 c4 10             	add    $0x10,%esp
+ ad2:	83 ef 01             	sub    $0x1,%edi
+ ad5:	39 d8                	cmp    %ebx,%eax
+ ad7:	75 df                	jne    ab8 <printint+0x68>
+}
+ ad9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ adc:	5b                   	pop    %ebx
+ add:	5e                   	pop    %esi
+ ade:	5f                   	pop    %edi
+ adf:	5d                   	pop    %ebp
+ ae0:	c3                   	ret
+ ae1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ ae8:	31 c0                	xor    %eax,%eax
+ aea:	eb 89                	jmp    a75 <printint+0x25>
+ aec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000af0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ af0:	55                   	push   %ebp
+ af1:	89 e5                	mov    %esp,%ebp
+ af3:	57                   	push   %edi
+ af4:	56                   	push   %esi
+ af5:	53                   	push   %ebx
+ af6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ af9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ afc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ aff:	0f b6 1e             	movzbl (%esi),%ebx
+ b02:	83 c6 01             	add    $0x1,%esi
+ b05:	84 db                	test   %bl,%bl
+ b07:	74 67                	je     b70 <printf+0x80>
+ b09:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ b0c:	31 d2                	xor    %edx,%edx
+ b0e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ b11:	eb 34                	jmp    b47 <printf+0x57>
+ b13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b17:	90                   	nop
+ b18:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ b1b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ b20:	83 f8 25             	cmp    $0x25,%eax
+ b23:	74 18                	je     b3d <printf+0x4d>
+  write(fd, &c, 1);
+ b25:	83 ec 04             	sub    $0x4,%esp
+ b28:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ b2b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b2e:	6a 01                	push   $0x1
+ b30:	50                   	push   %eax
+ b31:	57                   	push   %edi
+ b32:	e8 61 fd ff ff       	call   898 <write>
+ b37:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ b3a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ b3d:	0f b6 1e             	movzbl (%esi),%ebx
+ b40:	83 c6 01             	add    $0x1,%esi
+ b43:	84 db                	test   %bl,%bl
+ b45:	74 29                	je     b70 <printf+0x80>
+    c = fmt[i] & 0xff;
+ b47:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ b4a:	85 d2                	test   %edx,%edx
+ b4c:	74 ca                	je     b18 <printf+0x28>
+      }
+    } else if(state == '%'){
+ b4e:	83 fa 25             	cmp    $0x25,%edx
+ b51:	75 ea                	jne    b3d <printf+0x4d>
+      if(c == 'd'){
+ b53:	83 f8 25             	cmp    $0x25,%eax
+ b56:	0f 84 24 01 00 00    	je     c80 <printf+0x190>
+ b5c:	83 e8 63             	sub    $0x63,%eax
+ b5f:	83 f8 15             	cmp    $0x15,%eax
+ b62:	77 1c                	ja     b80 <printf+0x90>
+ b64:	ff 24 85 b4 0e 00 00 	jmp    *0xeb4(,%eax,4)
+ b6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b6f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ b70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b73:	5b                   	pop    %ebx
+ b74:	5e                   	pop    %esi
+ b75:	5f                   	pop    %edi
+ b76:	5d                   	pop    %ebp
+ b77:	c3                   	ret
+ b78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b7f:	90                   	nop
+  write(fd, &c, 1);
+ b80:	83 ec 04             	sub    $0x4,%esp
+ b83:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b86:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ b8a:	6a 01                	push   $0x1
+ b8c:	52                   	push   %edx
+ b8d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ b90:	57                   	push   %edi
+ b91:	e8 02 fd ff ff       	call   898 <write>
+ b96:	83 c4 0c             	add    $0xc,%esp
+ b99:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b9c:	6a 01                	push   $0x1
+ b9e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ ba1:	52                   	push   %edx
+ ba2:	57                   	push   %edi
+ ba3:	e8 f0 fc ff ff       	call   898 <write>
+        putc(fd, c);
+ ba8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ bab:	31 d2                	xor    %edx,%edx
+ bad:	eb 8e                	jmp    b3d <printf+0x4d>
+ baf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ bb0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ bb3:	83 ec 0c             	sub    $0xc,%esp
+ bb6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ bbb:	8b 13                	mov    (%ebx),%edx
+ bbd:	6a 00                	push   $0x0
+ bbf:	89 f8                	mov    %edi,%eax
+        ap++;
+ bc1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ bc4:	e8 87 fe ff ff       	call   a50 <printint>
+        ap++;
+ bc9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ bcc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ bcf:	31 d2                	xor    %edx,%edx
+ bd1:	e9 67 ff ff ff       	jmp    b3d <printf+0x4d>
+ bd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bdd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ be0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ be3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ be5:	83 c0 04             	add    $0x4,%eax
+ be8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ beb:	85 db                	test   %ebx,%ebx
+ bed:	0f 84 9d 00 00 00    	je     c90 <printf+0x1a0>
+        while(*s != 0){
+ bf3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ bf6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ bf8:	84 c0                	test   %al,%al
+ bfa:	0f 84 3d ff ff ff    	je     b3d <printf+0x4d>
+ c00:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c03:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ c06:	89 de                	mov    %ebx,%esi
+ c08:	89 d3                	mov    %edx,%ebx
+ c0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ c10:	83 ec 04             	sub    $0x4,%esp
+ c13:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ c16:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ c19:	6a 01                	push   $0x1
+ c1b:	53                   	push   %ebx
+ c1c:	57                   	push   %edi
+ c1d:	e8 76 fc ff ff       	call   898 <write>
+        while(*s != 0){
+ c22:	0f b6 06             	movzbl (%esi),%eax
+ c25:	83 c4 10             	add    $0x10,%esp
+ c28:	84 c0                	test   %al,%al
+ c2a:	75 e4                	jne    c10 <printf+0x120>
+      state = 0;
+ c2c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ c2f:	31 d2                	xor    %edx,%edx
+ c31:	e9 07 ff ff ff       	jmp    b3d <printf+0x4d>
+ c36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c3d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ c40:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ c43:	83 ec 0c             	sub    $0xc,%esp
+ c46:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ c4b:	8b 13                	mov    (%ebx),%edx
+ c4d:	6a 01                	push   $0x1
+ c4f:	e9 6b ff ff ff       	jmp    bbf <printf+0xcf>
+ c54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ c58:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ c5b:	83 ec 04             	sub    $0x4,%esp
+ c5e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ c61:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ c63:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ c66:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ c69:	6a 01                	push   $0x1
+ c6b:	52                   	push   %edx
+ c6c:	57                   	push   %edi
+ c6d:	e8 26 fc ff ff       	call   898 <write>
+        ap++;
+ c72:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ c75:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c78:	31 d2                	xor    %edx,%edx
+ c7a:	e9 be fe ff ff       	jmp    b3d <printf+0x4d>
+ c7f:	90                   	nop
+  write(fd, &c, 1);
+ c80:	83 ec 04             	sub    $0x4,%esp
+ c83:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ c86:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c89:	6a 01                	push   $0x1
+ c8b:	e9 11 ff ff ff       	jmp    ba1 <printf+0xb1>
+ c90:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ c95:	bb ac 0e 00 00       	mov    $0xeac,%ebx
+ c9a:	e9 61 ff ff ff       	jmp    c00 <printf+0x110>
+ c9f:	90                   	nop
+
+00000ca0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ ca0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ca1:	a1 cc 13 00 00       	mov    0x13cc,%eax
+{
+ ca6:	89 e5                	mov    %esp,%ebp
+ ca8:	57                   	push   %edi
+ ca9:	56                   	push   %esi
+ caa:	53                   	push   %ebx
+ cab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ cae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cb8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cbc:	39 ca                	cmp    %ecx,%edx
+ cbe:	73 30                	jae    cf0 <free+0x50>
+ cc0:	39 c1                	cmp    %eax,%ecx
+ cc2:	72 04                	jb     cc8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cc4:	39 c2                	cmp    %eax,%edx
+ cc6:	72 f0                	jb     cb8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ cc8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ ccb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ cce:	39 f8                	cmp    %edi,%eax
+ cd0:	74 2e                	je     d00 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ cd2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ cd5:	8b 42 04             	mov    0x4(%edx),%eax
+ cd8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ cdb:	39 f1                	cmp    %esi,%ecx
+ cdd:	74 38                	je     d17 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ cdf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ ce1:	5b                   	pop    %ebx
+  freep = p;
+ ce2:	89 15 cc 13 00 00    	mov    %edx,0x13cc
+}
+ ce8:	5e                   	pop    %esi
+ ce9:	5f                   	pop    %edi
+ cea:	5d                   	pop    %ebp
+ ceb:	c3                   	ret
+ cec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cf0:	39 c1                	cmp    %eax,%ecx
+ cf2:	72 d0                	jb     cc4 <free+0x24>
+ cf4:	eb c2                	jmp    cb8 <free+0x18>
+ cf6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cfd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ d00:	03 70 04             	add    0x4(%eax),%esi
+ d03:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d06:	8b 02                	mov    (%edx),%eax
+ d08:	8b 00                	mov    (%eax),%eax
+ d0a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ d0d:	8b 42 04             	mov    0x4(%edx),%eax
+ d10:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d13:	39 f1                	cmp    %esi,%ecx
+ d15:	75 c8                	jne    cdf <free+0x3f>
+    p->s.size += bp->s.size;
+ d17:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ d1a:	89 15 cc 13 00 00    	mov    %edx,0x13cc
+    p->s.size += bp->s.size;
+ d20:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ d23:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ d26:	89 0a                	mov    %ecx,(%edx)
+}
+ d28:	5b                   	pop    %ebx
+ d29:	5e                   	pop    %esi
+ d2a:	5f                   	pop    %edi
+ d2b:	5d                   	pop    %ebp
+ d2c:	c3                   	ret
+ d2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d30 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d30:	55                   	push   %ebp
+ d31:	89 e5                	mov    %esp,%ebp
+ d33:	57                   	push   %edi
+ d34:	56                   	push   %esi
+ d35:	53                   	push   %ebx
+ d36:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d39:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ d3c:	8b 15 cc 13 00 00    	mov    0x13cc,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d42:	8d 78 07             	lea    0x7(%eax),%edi
+ d45:	c1 ef 03             	shr    $0x3,%edi
+ d48:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ d4b:	85 d2                	test   %edx,%edx
+ d4d:	0f 84 8d 00 00 00    	je     de0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d53:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d55:	8b 48 04             	mov    0x4(%eax),%ecx
+ d58:	39 f9                	cmp    %edi,%ecx
+ d5a:	73 64                	jae    dc0 <malloc+0x90>
+  if(nu < 4096)
+ d5c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ d61:	39 df                	cmp    %ebx,%edi
+ d63:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ d66:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ d6d:	eb 0a                	jmp    d79 <malloc+0x49>
+ d6f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d70:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d72:	8b 48 04             	mov    0x4(%eax),%ecx
+ d75:	39 f9                	cmp    %edi,%ecx
+ d77:	73 47                	jae    dc0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ d79:	89 c2                	mov    %eax,%edx
+ d7b:	39 05 cc 13 00 00    	cmp    %eax,0x13cc
+ d81:	75 ed                	jne    d70 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ d83:	83 ec 0c             	sub    $0xc,%esp
+ d86:	56                   	push   %esi
+ d87:	e8 9b fb ff ff       	call   927 <sbrk>
+  if(p == (char*)-1)
+ d8c:	83 c4 10             	add    $0x10,%esp
+ d8f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ d92:	74 1c                	je     db0 <malloc+0x80>
+  hp->s.size = nu;
+ d94:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ d97:	83 ec 0c             	sub    $0xc,%esp
+ d9a:	83 c0 08             	add    $0x8,%eax
+ d9d:	50                   	push   %eax
+ d9e:	e8 fd fe ff ff       	call   ca0 <free>
+  return freep;
+ da3:	8b 15 cc 13 00 00    	mov    0x13cc,%edx
+      if((p = morecore(nunits)) == 0)
+ da9:	83 c4 10             	add    $0x10,%esp
+ dac:	85 d2                	test   %edx,%edx
+ dae:	75 c0                	jne    d70 <malloc+0x40>
+        return 0;
+  }
+}
+ db0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ db3:	31 c0                	xor    %eax,%eax
+}
+ db5:	5b                   	pop    %ebx
+ db6:	5e                   	pop    %esi
+ db7:	5f                   	pop    %edi
+ db8:	5d                   	pop    %ebp
+ db9:	c3                   	ret
+ dba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ dc0:	39 cf                	cmp    %ecx,%edi
+ dc2:	74 4c                	je     e10 <malloc+0xe0>
+        p->s.size -= nunits;
+ dc4:	29 f9                	sub    %edi,%ecx
+ dc6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ dc9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ dcc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ dcf:	89 15 cc 13 00 00    	mov    %edx,0x13cc
+}
+ dd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ dd8:	83 c0 08             	add    $0x8,%eax
+}
+ ddb:	5b                   	pop    %ebx
+ ddc:	5e                   	pop    %esi
+ ddd:	5f                   	pop    %edi
+ dde:	5d                   	pop    %ebp
+ ddf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ de0:	c7 05 cc 13 00 00 d0 	movl   $0x13d0,0x13cc
+ de7:	13 00 00 
+    base.s.size = 0;
+ dea:	b8 d0 13 00 00       	mov    $0x13d0,%eax
+    base.s.ptr = freep = prevp = &base;
+ def:	c7 05 d0 13 00 00 d0 	movl   $0x13d0,0x13d0
+ df6:	13 00 00 
+    base.s.size = 0;
+ df9:	c7 05 d4 13 00 00 00 	movl   $0x0,0x13d4
+ e00:	00 00 00 
+    if(p->s.size >= nunits){
+ e03:	e9 54 ff ff ff       	jmp    d5c <malloc+0x2c>
+ e08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e0f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ e10:	8b 08                	mov    (%eax),%ecx
+ e12:	89 0a                	mov    %ecx,(%edx)
+ e14:	eb b9                	jmp    dcf <malloc+0x9f>
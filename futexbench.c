@@ -0,0 +1,142 @@
+// Lock contention with threads: nthreads threads each take a
+// lock nops times to bump a shared counter, with the futex
+// mutex from ulib.c and with a plain xchg spinlock, which
+// burns its whole time slice when the holder is preempted.
+// Then a condition variable ping-pong between two threads.
+// usage: futexbench [nthreads [nops]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "x86.h"
+
+#define PGSIZE   4096
+#define NTHREAD  16
+
+struct mutex m;
+volatile uint spin;
+volatile int counter;
+int nops;
+
+struct cond cv;
+volatile int turn;
+
+void*
+stackalloc(void)
+{
+  uint p;
+
+  p = (uint)sbrk(2*PGSIZE);
+  if(p == 0xffffffff){
+    printf(1, "futexbench: sbrk failed\n");
+    exit();
+  }
+  return (void*)((p + PGSIZE-1) & ~(PGSIZE-1));
+}
+
+void
+withmutex(void *a, void *b)
+{
+  int i;
+
+  for(i = 0; i < nops; i++){
+    mutex_lock(&m);
+    counter++;
+    mutex_unlock(&m);
+  }
+  exit();
+}
+
+void
+withspin(void *a, void *b)
+{
+  int i;
+
+  for(i = 0; i < nops; i++){
+    while(xchg(&spin, 1) != 0)
+      ;
+    counter++;
+    spin = 0;
+  }
+  exit();
+}
+
+void
+run(char *what, void (*fn)(void*, void*), void **stacks, int n)
+{
+  uint64 t;
+  void *stack;
+  int i;
+
+  counter = 0;
+  t = rdtsc();
+  for(i = 0; i < n; i++)
+    if(clone(fn, 0, 0, stacks[i]) < 0){
+      printf(1, "futexbench: clone failed\n");
+      exit();
+    }
+  for(i = 0; i < n; i++)
+    join(&stack);
+  t = rdtsc() - t;
+  if(counter != n * nops)
+    printf(1, "futexbench: %s lost updates\n", what);
+  cyclereport(what, "ops", t, n * nops);
+}
+
+// Two threads take turns, handing over with cond_signal().
+void
+pingpong(void *a, void *b)
+{
+  int i, me;
+
+  me = (int)a;
+  mutex_lock(&m);
+  for(i = 0; i < nops; i++){
+    while(turn != me)
+      cond_wait(&cv, &m);
+    turn = !me;
+    cond_signal(&cv);
+  }
+  mutex_unlock(&m);
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  void *stacks[NTHREAD], *stack;
+  uint64 t;
+  int i, n;
+
+  n = 4;
+  nops = 20000;
+  if(argc > 1)
+    n = atoi(argv[1]);
+  if(argc > 2)
+    nops = atoi(argv[2]);
+  if(n < 1)
+    n = 1;
+  if(n > NTHREAD)
+    n = NTHREAD;
+  if(nops < 1)
+    nops = 1;
+  for(i = 0; i < NTHREAD; i++)
+    stacks[i] = stackalloc();
+
+  mutex_init(&m);
+  run("futex mutex", withmutex, stacks, n);
+  run("spinlock", withspin, stacks, n);
+
+  cond_init(&cv);
+  turn = 0;
+  t = rdtsc();
+  for(i = 0; i < 2; i++)
+    if(clone(pingpong, (void*)i, 0, stacks[i]) < 0){
+      printf(1, "futexbench: clone failed\n");
+      exit();
+    }
+  for(i = 0; i < 2; i++)
+    join(&stack);
+  cyclereport("condvar handoff", "ops", rdtsc() - t, 2 * nops);
+  exit();
+}
@@ -0,0 +1,70 @@
+// QEMU firmware configuration device, for boot-time tunables
+// passed with -fw_cfg name=opt/xv6/...,string=....
+// See docs/specs/fw_cfg.txt in the QEMU sources.
+
+#include "types.h"
+#include "x86.h"
+#include "defs.h"
+
+#define FW_CFG_CTL        0x510   // selector, 16 bits
+#define FW_CFG_DATA       0x511   // data, read a byte at a time
+#define FW_CFG_SIGNATURE  0x0000
+#define FW_CFG_FILE_DIR   0x0019
+
+static void
+fwread(void *dst, int n)
+{
+  uchar *p;
+
+  for(p = dst; p < (uchar*)dst + n; p++)
+    *p = inb(FW_CFG_DATA);
+}
+
+// Big-endian fields in the file directory.
+static uint
+be(uchar *p, int n)
+{
+  uint x;
+
+  for(x = 0; n > 0; n--)
+    x = (x << 8) | *p++;
+  return x;
+}
+
+// Return the decimal number in fw_cfg file name, or def if
+// there is no such file or not running under QEMU.
+int
+fwcfgint(char *name, int def)
+{
+  // File directory entry: size, selector, reserved, name.
+  uchar hdr[8];
+  char fname[56], buf[16];
+  uint n, size, sel;
+  int i, x;
+
+  outw(FW_CFG_CTL, FW_CFG_SIGNATURE);
+  fwread(buf, 4);
+  if(strncmp(buf, "QEMU", 4) != 0)
+    return def;
+
+  outw(FW_CFG_CTL, FW_CFG_FILE_DIR);
+  fwread(hdr, 4);
+  n = be(hdr, 4);
+  while(n-- > 0){
+    fwread(hdr, 8);
+    fwread(fname, sizeof(fname));
+    if(strncmp(fname, name, sizeof(fname)) != 0)
+      continue;
+    size = be(hdr, 4);
+    sel = be(hdr+4, 2);
+    if(size > sizeof(buf))
+      size = sizeof(buf);
+    outw(FW_CFG_CTL, sel);
+    fwread(buf, size);
+    x = 0;
+    for(i = 0; i < size && buf[i] >= '0' && buf[i] <= '9'; i++)
+      x = x*10 + buf[i] - '0';
+    return i > 0 ? x : def;
+  }
+  return def;
+}
@@ -0,0 +1,1993 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 01                	mov    (%ecx),%eax
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+  1c:	83 f8 01             	cmp    $0x1,%eax
+  1f:	7e 6f                	jle    90 <main+0x90>
+    printf(2, "usage: grep pattern [file ...]\n");
+    exit();
+  }
+  pattern = argv[1];
+  21:	8b 43 04             	mov    0x4(%ebx),%eax
+  24:	83 c3 08             	add    $0x8,%ebx
+
+  if(argc <= 2){
+  27:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+    grep(pattern, 0);
+    exit();
+  }
+
+  for(i = 2; i < argc; i++){
+  2b:	be 02 00 00 00       	mov    $0x2,%esi
+  pattern = argv[1];
+  30:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc <= 2){
+  33:	75 2d                	jne    62 <main+0x62>
+  35:	eb 6c                	jmp    a3 <main+0xa3>
+  37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3e:	66 90                	xchg   %ax,%ax
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      exit();
+    }
+    grep(pattern, fd);
+  40:	83 ec 08             	sub    $0x8,%esp
+  for(i = 2; i < argc; i++){
+  43:	83 c6 01             	add    $0x1,%esi
+  46:	83 c3 04             	add    $0x4,%ebx
+    grep(pattern, fd);
+  49:	50                   	push   %eax
+  4a:	ff 75 e0             	push   -0x20(%ebp)
+  4d:	e8 9e 01 00 00       	call   1f0 <grep>
+    close(fd);
+  52:	89 3c 24             	mov    %edi,(%esp)
+  55:	e8 99 07 00 00       	call   7f3 <close>
+  for(i = 2; i < argc; i++){
+  5a:	83 c4 10             	add    $0x10,%esp
+  5d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  60:	7e 29                	jle    8b <main+0x8b>
+    if((fd = open(argv[i], 0)) < 0){
+  62:	83 ec 08             	sub    $0x8,%esp
+  65:	6a 00                	push   $0x0
+  67:	ff 33                	push   (%ebx)
+  69:	e8 a6 07 00 00       	call   814 <open>
+  6e:	83 c4 10             	add    $0x10,%esp
+  71:	89 c7                	mov    %eax,%edi
+  73:	85 c0                	test   %eax,%eax
+  75:	79 c9                	jns    40 <main+0x40>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+  77:	50                   	push   %eax
+  78:	ff 33                	push   (%ebx)
+  7a:	68 88 0d 00 00       	push   $0xd88
+  7f:	6a 01                	push   $0x1
+  81:	e8 ba 09 00 00       	call   a40 <printf>
+      exit();
+  86:	e8 31 07 00 00       	call   7bc <exit>
+  }
+  exit();
+  8b:	e8 2c 07 00 00       	call   7bc <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+  90:	51                   	push   %ecx
+  91:	51                   	push   %ecx
+  92:	68 68 0d 00 00       	push   $0xd68
+  97:	6a 02                	push   $0x2
+  99:	e8 a2 09 00 00       	call   a40 <printf>
+    exit();
+  9e:	e8 19 07 00 00       	call   7bc <exit>
+    grep(pattern, 0);
+  a3:	52                   	push   %edx
+  a4:	52                   	push   %edx
+  a5:	6a 00                	push   $0x0
+  a7:	50                   	push   %eax
+  a8:	e8 43 01 00 00       	call   1f0 <grep>
+    exit();
+  ad:	e8 0a 07 00 00       	call   7bc <exit>
+  b2:	66 90                	xchg   %ax,%ax
+  b4:	66 90                	xchg   %ax,%ax
+  b6:	66 90                	xchg   %ax,%ax
+  b8:	66 90                	xchg   %ax,%ax
+  ba:	66 90                	xchg   %ax,%ax
+  bc:	66 90                	xchg   %ax,%ax
+  be:	66 90                	xchg   %ax,%ax
+
+000000c0 <matchhere>:
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	57                   	push   %edi
+  c4:	56                   	push   %esi
+  c5:	53                   	push   %ebx
+  c6:	83 ec 0c             	sub    $0xc,%esp
+  c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '\0')
+  cf:	0f b6 0f             	movzbl (%edi),%ecx
+  d2:	84 c9                	test   %cl,%cl
+  d4:	0f 84 96 00 00 00    	je     170 <matchhere+0xb0>
+    return 1;
+  if(re[1] == '*')
+  da:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+  de:	3c 2a                	cmp    $0x2a,%al
+  e0:	74 2d                	je     10f <matchhere+0x4f>
+  e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+    return *text == '\0';
+  e8:	0f b6 33             	movzbl (%ebx),%esi
+  if(re[0] == '$' && re[1] == '\0')
+  eb:	80 f9 24             	cmp    $0x24,%cl
+  ee:	74 50                	je     140 <matchhere+0x80>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+  f0:	89 f2                	mov    %esi,%edx
+  f2:	84 d2                	test   %dl,%dl
+  f4:	74 6e                	je     164 <matchhere+0xa4>
+  f6:	80 f9 2e             	cmp    $0x2e,%cl
+  f9:	75 65                	jne    160 <matchhere+0xa0>
+    return matchhere(re+1, text+1);
+  fb:	83 c3 01             	add    $0x1,%ebx
+  fe:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 101:	84 c0                	test   %al,%al
+ 103:	74 6b                	je     170 <matchhere+0xb0>
+ 105:	89 c1                	mov    %eax,%ecx
+  if(re[1] == '*')
+ 107:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+ 10b:	3c 2a                	cmp    $0x2a,%al
+ 10d:	75 d9                	jne    e8 <matchhere+0x28>
+    return matchstar(re[0], re+2, text);
+ 10f:	8d 77 02             	lea    0x2(%edi),%esi
+ 112:	0f be f9             	movsbl %cl,%edi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+ 115:	8d 76 00             	lea    0x0(%esi),%esi
+{
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+ 118:	83 ec 08             	sub    $0x8,%esp
+ 11b:	53                   	push   %ebx
+ 11c:	56                   	push   %esi
+ 11d:	e8 9e ff ff ff       	call   c0 <matchhere>
+ 122:	83 c4 10             	add    $0x10,%esp
+ 125:	85 c0                	test   %eax,%eax
+ 127:	75 47                	jne    170 <matchhere+0xb0>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 129:	0f be 13             	movsbl (%ebx),%edx
+ 12c:	84 d2                	test   %dl,%dl
+ 12e:	74 45                	je     175 <matchhere+0xb5>
+ 130:	83 c3 01             	add    $0x1,%ebx
+ 133:	39 fa                	cmp    %edi,%edx
+ 135:	74 e1                	je     118 <matchhere+0x58>
+ 137:	83 ff 2e             	cmp    $0x2e,%edi
+ 13a:	74 dc                	je     118 <matchhere+0x58>
+ 13c:	eb 37                	jmp    175 <matchhere+0xb5>
+ 13e:	66 90                	xchg   %ax,%ax
+  if(re[0] == '$' && re[1] == '\0')
+ 140:	84 c0                	test   %al,%al
+ 142:	74 39                	je     17d <matchhere+0xbd>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 144:	89 f2                	mov    %esi,%edx
+ 146:	84 d2                	test   %dl,%dl
+ 148:	74 1a                	je     164 <matchhere+0xa4>
+ 14a:	80 fa 24             	cmp    $0x24,%dl
+ 14d:	75 15                	jne    164 <matchhere+0xa4>
+    return matchhere(re+1, text+1);
+ 14f:	83 c3 01             	add    $0x1,%ebx
+ 152:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 155:	89 c1                	mov    %eax,%ecx
+ 157:	eb ae                	jmp    107 <matchhere+0x47>
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 160:	38 ca                	cmp    %cl,%dl
+ 162:	74 97                	je     fb <matchhere+0x3b>
+}
+ 164:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+ 167:	31 c0                	xor    %eax,%eax
+}
+ 169:	5b                   	pop    %ebx
+ 16a:	5e                   	pop    %esi
+ 16b:	5f                   	pop    %edi
+ 16c:	5d                   	pop    %ebp
+ 16d:	c3                   	ret
+ 16e:	66 90                	xchg   %ax,%ax
+    return 1;
+ 170:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 178:	5b                   	pop    %ebx
+ 179:	5e                   	pop    %esi
+ 17a:	5f                   	pop    %edi
+ 17b:	5d                   	pop    %ebp
+ 17c:	c3                   	ret
+    return *text == '\0';
+ 17d:	89 f0                	mov    %esi,%eax
+ 17f:	84 c0                	test   %al,%al
+ 181:	0f 94 c0             	sete   %al
+ 184:	0f b6 c0             	movzbl %al,%eax
+ 187:	eb ec                	jmp    175 <matchhere+0xb5>
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <match>:
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	56                   	push   %esi
+ 194:	53                   	push   %ebx
+ 195:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 198:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+ 19b:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+ 19e:	75 11                	jne    1b1 <match+0x21>
+ 1a0:	eb 2e                	jmp    1d0 <match+0x40>
+ 1a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+ 1a8:	83 c6 01             	add    $0x1,%esi
+ 1ab:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+ 1af:	74 16                	je     1c7 <match+0x37>
+    if(matchhere(re, text))
+ 1b1:	83 ec 08             	sub    $0x8,%esp
+ 1b4:	56                   	push   %esi
+ 1b5:	53                   	push   %ebx
+ 1b6:	e8 05 ff ff ff       	call   c0 <matchhere>
+ 1bb:	83 c4 10             	add    $0x10,%esp
+ 1be:	85 c0                	test   %eax,%eax
+ 1c0:	74 e6                	je     1a8 <match+0x18>
+      return 1;
+ 1c2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 1c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1ca:	5b                   	pop    %ebx
+ 1cb:	5e                   	pop    %esi
+ 1cc:	5d                   	pop    %ebp
+ 1cd:	c3                   	ret
+ 1ce:	66 90                	xchg   %ax,%ax
+    return matchhere(re+1, text);
+ 1d0:	83 c3 01             	add    $0x1,%ebx
+ 1d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 1d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1d9:	5b                   	pop    %ebx
+ 1da:	5e                   	pop    %esi
+ 1db:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+ 1dc:	e9 df fe ff ff       	jmp    c0 <matchhere>
+ 1e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ef:	90                   	nop
+
+000001f0 <grep>:
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+  m = 0;
+ 1f4:	31 ff                	xor    %edi,%edi
+{
+ 1f6:	56                   	push   %esi
+ 1f7:	53                   	push   %ebx
+ 1f8:	83 ec 1c             	sub    $0x1c,%esp
+ 1fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 1fe:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    return matchhere(re+1, text);
+ 201:	8d 43 01             	lea    0x1(%ebx),%eax
+ 204:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 210:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 213:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+ 218:	83 ec 04             	sub    $0x4,%esp
+ 21b:	29 c8                	sub    %ecx,%eax
+ 21d:	50                   	push   %eax
+ 21e:	8d 81 00 13 00 00    	lea    0x1300(%ecx),%eax
+ 224:	50                   	push   %eax
+ 225:	ff 75 0c             	push   0xc(%ebp)
+ 228:	e8 b0 05 00 00       	call   7dd <read>
+ 22d:	83 c4 10             	add    $0x10,%esp
+ 230:	85 c0                	test   %eax,%eax
+ 232:	0f 8e fd 00 00 00    	jle    335 <grep+0x145>
+    m += n;
+ 238:	01 45 e0             	add    %eax,-0x20(%ebp)
+ 23b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    buf[m] = '\0';
+ 23e:	bf 00 13 00 00       	mov    $0x1300,%edi
+ 243:	89 de                	mov    %ebx,%esi
+ 245:	c6 81 00 13 00 00 00 	movb   $0x0,0x1300(%ecx)
+    while((q = strchr(p, '\n')) != 0){
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 250:	83 ec 08             	sub    $0x8,%esp
+ 253:	6a 0a                	push   $0xa
+ 255:	57                   	push   %edi
+ 256:	e8 25 02 00 00       	call   480 <strchr>
+ 25b:	83 c4 10             	add    $0x10,%esp
+ 25e:	89 c2                	mov    %eax,%edx
+ 260:	85 c0                	test   %eax,%eax
+ 262:	0f 84 88 00 00 00    	je     2f0 <grep+0x100>
+      *q = 0;
+ 268:	c6 02 00             	movb   $0x0,(%edx)
+  if(re[0] == '^')
+ 26b:	80 3e 5e             	cmpb   $0x5e,(%esi)
+ 26e:	74 58                	je     2c8 <grep+0xd8>
+ 270:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 273:	89 d3                	mov    %edx,%ebx
+ 275:	eb 12                	jmp    289 <grep+0x99>
+ 277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27e:	66 90                	xchg   %ax,%ax
+  }while(*text++ != '\0');
+ 280:	83 c7 01             	add    $0x1,%edi
+ 283:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+ 287:	74 37                	je     2c0 <grep+0xd0>
+    if(matchhere(re, text))
+ 289:	83 ec 08             	sub    $0x8,%esp
+ 28c:	57                   	push   %edi
+ 28d:	56                   	push   %esi
+ 28e:	e8 2d fe ff ff       	call   c0 <matchhere>
+ 293:	83 c4 10             	add    $0x10,%esp
+ 296:	85 c0                	test   %eax,%eax
+ 298:	74 e6                	je     280 <grep+0x90>
+        write(1, p, q+1 - p);
+ 29a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 29d:	89 da                	mov    %ebx,%edx
+ 29f:	8d 5b 01             	lea    0x1(%ebx),%ebx
+ 2a2:	89 d8                	mov    %ebx,%eax
+ 2a4:	83 ec 04             	sub    $0x4,%esp
+        *q = '\n';
+ 2a7:	c6 02 0a             	movb   $0xa,(%edx)
+        write(1, p, q+1 - p);
+ 2aa:	29 f8                	sub    %edi,%eax
+ 2ac:	50                   	push   %eax
+ 2ad:	57                   	push   %edi
+ 2ae:	89 df                	mov    %ebx,%edi
+ 2b0:	6a 01                	push   $0x1
+ 2b2:	e8 31 05 00 00       	call   7e8 <write>
+ 2b7:	83 c4 10             	add    $0x10,%esp
+ 2ba:	eb 94                	jmp    250 <grep+0x60>
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c0:	8d 7b 01             	lea    0x1(%ebx),%edi
+      p = q+1;
+ 2c3:	eb 8b                	jmp    250 <grep+0x60>
+ 2c5:	8d 76 00             	lea    0x0(%esi),%esi
+    return matchhere(re+1, text);
+ 2c8:	83 ec 08             	sub    $0x8,%esp
+ 2cb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 2ce:	57                   	push   %edi
+ 2cf:	ff 75 dc             	push   -0x24(%ebp)
+ 2d2:	e8 e9 fd ff ff       	call   c0 <matchhere>
+        write(1, p, q+1 - p);
+ 2d7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    return matchhere(re+1, text);
+ 2da:	83 c4 10             	add    $0x10,%esp
+        write(1, p, q+1 - p);
+ 2dd:	8d 5a 01             	lea    0x1(%edx),%ebx
+      if(match(pattern, p)){
+ 2e0:	85 c0                	test   %eax,%eax
+ 2e2:	75 be                	jne    2a2 <grep+0xb2>
+        write(1, p, q+1 - p);
+ 2e4:	89 df                	mov    %ebx,%edi
+ 2e6:	e9 65 ff ff ff       	jmp    250 <grep+0x60>
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+    if(p == buf)
+ 2f0:	89 f3                	mov    %esi,%ebx
+ 2f2:	81 ff 00 13 00 00    	cmp    $0x1300,%edi
+ 2f8:	74 2f                	je     329 <grep+0x139>
+    if(m > 0){
+ 2fa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 2fd:	85 c0                	test   %eax,%eax
+ 2ff:	0f 8e 0b ff ff ff    	jle    210 <grep+0x20>
+      m -= p - buf;
+ 305:	89 f8                	mov    %edi,%eax
+      memmove(buf, p, m);
+ 307:	83 ec 04             	sub    $0x4,%esp
+      m -= p - buf;
+ 30a:	2d 00 13 00 00       	sub    $0x1300,%eax
+ 30f:	29 45 e0             	sub    %eax,-0x20(%ebp)
+ 312:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      memmove(buf, p, m);
+ 315:	51                   	push   %ecx
+ 316:	57                   	push   %edi
+ 317:	68 00 13 00 00       	push   $0x1300
+ 31c:	e8 8f 02 00 00       	call   5b0 <memmove>
+ 321:	83 c4 10             	add    $0x10,%esp
+ 324:	e9 e7 fe ff ff       	jmp    210 <grep+0x20>
+      m = 0;
+ 329:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 330:	e9 db fe ff ff       	jmp    210 <grep+0x20>
+}
+ 335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 338:	5b                   	pop    %ebx
+ 339:	5e                   	pop    %esi
+ 33a:	5f                   	pop    %edi
+ 33b:	5d                   	pop    %ebp
+ 33c:	c3                   	ret
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <matchstar>:
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+ 345:	53                   	push   %ebx
+ 346:	83 ec 0c             	sub    $0xc,%esp
+ 349:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 34c:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 34f:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 352:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(matchhere(re, text))
+ 358:	83 ec 08             	sub    $0x8,%esp
+ 35b:	57                   	push   %edi
+ 35c:	56                   	push   %esi
+ 35d:	e8 5e fd ff ff       	call   c0 <matchhere>
+ 362:	83 c4 10             	add    $0x10,%esp
+ 365:	85 c0                	test   %eax,%eax
+ 367:	75 1f                	jne    388 <matchstar+0x48>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 369:	0f be 17             	movsbl (%edi),%edx
+ 36c:	84 d2                	test   %dl,%dl
+ 36e:	74 0c                	je     37c <matchstar+0x3c>
+ 370:	83 c7 01             	add    $0x1,%edi
+ 373:	39 da                	cmp    %ebx,%edx
+ 375:	74 e1                	je     358 <matchstar+0x18>
+ 377:	83 fb 2e             	cmp    $0x2e,%ebx
+ 37a:	74 dc                	je     358 <matchstar+0x18>
+}
+ 37c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 37f:	5b                   	pop    %ebx
+ 380:	5e                   	pop    %esi
+ 381:	5f                   	pop    %edi
+ 382:	5d                   	pop    %ebp
+ 383:	c3                   	ret
+ 384:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 1;
+ 38b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 390:	5b                   	pop    %ebx
+ 391:	5e                   	pop    %esi
+ 392:	5f                   	pop    %edi
+ 393:	5d                   	pop    %ebp
+ 394:	c3                   	ret
+ 395:	66 90                	xchg   %ax,%ax
+ 397:	66 90                	xchg   %ax,%ax
+ 399:	66 90                	xchg   %ax,%ax
+ 39b:	66 90                	xchg   %ax,%ax
+ 39d:	66 90                	xchg   %ax,%ax
+ 39f:	90                   	nop
+
+000003a0 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 3a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3a1:	31 c0                	xor    %eax,%eax
+{
+ 3a3:	89 e5                	mov    %esp,%ebp
+ 3a5:	53                   	push   %ebx
+ 3a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3b7:	83 c0 01             	add    $0x1,%eax
+ 3ba:	84 d2                	test   %dl,%dl
+ 3bc:	75 f2                	jne    3b0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 3be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c1:	89 c8                	mov    %ecx,%eax
+ 3c3:	c9                   	leave
+ 3c4:	c3                   	ret
+ 3c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	53                   	push   %ebx
+ 3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3da:	0f b6 02             	movzbl (%edx),%eax
+ 3dd:	84 c0                	test   %al,%al
+ 3df:	75 17                	jne    3f8 <strcmp+0x28>
+ 3e1:	eb 3a                	jmp    41d <strcmp+0x4d>
+ 3e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3e7:	90                   	nop
+ 3e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3ec:	83 c2 01             	add    $0x1,%edx
+ 3ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3f2:	84 c0                	test   %al,%al
+ 3f4:	74 1a                	je     410 <strcmp+0x40>
+    p++, q++;
+ 3f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3f8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3fb:	38 c3                	cmp    %al,%bl
+ 3fd:	74 e9                	je     3e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3ff:	29 d8                	sub    %ebx,%eax
+}
+ 401:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 404:	c9                   	leave
+ 405:	c3                   	ret
+ 406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 410:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 414:	31 c0                	xor    %eax,%eax
+ 416:	29 d8                	sub    %ebx,%eax
+}
+ 418:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 41b:	c9                   	leave
+ 41c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 41d:	0f b6 19             	movzbl (%ecx),%ebx
+ 420:	31 c0                	xor    %eax,%eax
+ 422:	eb db                	jmp    3ff <strcmp+0x2f>
+ 424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 42f:	90                   	nop
+
+00000430 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 436:	80 3a 00             	cmpb   $0x0,(%edx)
+ 439:	74 15                	je     450 <strlen+0x20>
+ 43b:	31 c0                	xor    %eax,%eax
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+ 440:	83 c0 01             	add    $0x1,%eax
+ 443:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 447:	89 c1                	mov    %eax,%ecx
+ 449:	75 f5                	jne    440 <strlen+0x10>
+    ;
+  return n;
+}
+ 44b:	89 c8                	mov    %ecx,%eax
+ 44d:	5d                   	pop    %ebp
+ 44e:	c3                   	ret
+ 44f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 450:	31 c9                	xor    %ecx,%ecx
+}
+ 452:	5d                   	pop    %ebp
+ 453:	89 c8                	mov    %ecx,%eax
+ 455:	c3                   	ret
+ 456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000460 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 467:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 46a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 46d:	89 d7                	mov    %edx,%edi
+ 46f:	fc                   	cld
+ 470:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 472:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 475:	89 d0                	mov    %edx,%eax
+ 477:	c9                   	leave
+ 478:	c3                   	ret
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	8b 45 08             	mov    0x8(%ebp),%eax
+ 486:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 48a:	0f b6 10             	movzbl (%eax),%edx
+ 48d:	84 d2                	test   %dl,%dl
+ 48f:	75 12                	jne    4a3 <strchr+0x23>
+ 491:	eb 1d                	jmp    4b0 <strchr+0x30>
+ 493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 497:	90                   	nop
+ 498:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 49c:	83 c0 01             	add    $0x1,%eax
+ 49f:	84 d2                	test   %dl,%dl
+ 4a1:	74 0d                	je     4b0 <strchr+0x30>
+    if(*s == c)
+ 4a3:	38 d1                	cmp    %dl,%cl
+ 4a5:	75 f1                	jne    498 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 4a7:	5d                   	pop    %ebp
+ 4a8:	c3                   	ret
+ 4a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 4b0:	31 c0                	xor    %eax,%eax
+}
+ 4b2:	5d                   	pop    %ebp
+ 4b3:	c3                   	ret
+ 4b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4bf:	90                   	nop
+
+000004c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 4c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 4c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 4c9:	31 db                	xor    %ebx,%ebx
+{
+ 4cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 4ce:	eb 27                	jmp    4f7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 4d0:	83 ec 04             	sub    $0x4,%esp
+ 4d3:	6a 01                	push   $0x1
+ 4d5:	56                   	push   %esi
+ 4d6:	6a 00                	push   $0x0
+ 4d8:	e8 00 03 00 00       	call   7dd <read>
+    if(cc < 1)
+ 4dd:	83 c4 10             	add    $0x10,%esp
+ 4e0:	85 c0                	test   %eax,%eax
+ 4e2:	7e 1d                	jle    501 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 4e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 4ef:	3c 0a                	cmp    $0xa,%al
+ 4f1:	74 10                	je     503 <gets+0x43>
+ 4f3:	3c 0d                	cmp    $0xd,%al
+ 4f5:	74 0c                	je     503 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 4f7:	89 df                	mov    %ebx,%edi
+ 4f9:	83 c3 01             	add    $0x1,%ebx
+ 4fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 4ff:	7c cf                	jl     4d0 <gets+0x10>
+ 501:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 503:	8b 45 08             	mov    0x8(%ebp),%eax
+ 506:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 50a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 50d:	5b                   	pop    %ebx
+ 50e:	5e                   	pop    %esi
+ 50f:	5f                   	pop    %edi
+ 510:	5d                   	pop    %ebp
+ 511:	c3                   	ret
+ 512:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 519:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	56                   	push   %esi
+ 524:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 525:	83 ec 08             	sub    $0x8,%esp
+ 528:	6a 00                	push   $0x0
+ 52a:	ff 75 08             	push   0x8(%ebp)
+ 52d:	e8 e2 02 00 00       	call   814 <open>
+  if(fd < 0)
+ 532:	83 c4 10             	add    $0x10,%esp
+ 535:	85 c0                	test   %eax,%eax
+ 537:	78 27                	js     560 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 539:	83 ec 08             	sub    $0x8,%esp
+ 53c:	ff 75 0c             	push   0xc(%ebp)
+ 53f:	89 c3                	mov    %eax,%ebx
+ 541:	50                   	push   %eax
+ 542:	e8 ee 02 00 00       	call   835 <fstat>
+  close(fd);
+ 547:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 54a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 54c:	e8 a2 02 00 00       	call   7f3 <close>
+  return r;
+ 551:	83 c4 10             	add    $0x10,%esp
+}
+ 554:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 557:	89 f0                	mov    %esi,%eax
+ 559:	5b                   	pop    %ebx
+ 55a:	5e                   	pop    %esi
+ 55b:	5d                   	pop    %ebp
+ 55c:	c3                   	ret
+ 55d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 560:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 565:	eb ed                	jmp    554 <stat+0x34>
+ 567:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56e:	66 90                	xchg   %ax,%ax
+
+00000570 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	53                   	push   %ebx
+ 574:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 577:	0f be 02             	movsbl (%edx),%eax
+ 57a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 57d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 580:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 585:	77 1e                	ja     5a5 <atoi+0x35>
+ 587:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 590:	83 c2 01             	add    $0x1,%edx
+ 593:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 596:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 59a:	0f be 02             	movsbl (%edx),%eax
+ 59d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 5a0:	80 fb 09             	cmp    $0x9,%bl
+ 5a3:	76 eb                	jbe    590 <atoi+0x20>
+  return n;
+}
+ 5a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5a8:	89 c8                	mov    %ecx,%eax
+ 5aa:	c9                   	leave
+ 5ab:	c3                   	ret
+ 5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 5be:	85 c0                	test   %eax,%eax
+ 5c0:	7e 13                	jle    5d5 <memmove+0x25>
+ 5c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 5c4:	89 d7                	mov    %edx,%edi
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 5d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 5d1:	39 f8                	cmp    %edi,%eax
+ 5d3:	75 fb                	jne    5d0 <memmove+0x20>
+  return vdst;
+}
+ 5d5:	5e                   	pop    %esi
+ 5d6:	89 d0                	mov    %edx,%eax
+ 5d8:	5f                   	pop    %edi
+ 5d9:	5d                   	pop    %ebp
+ 5da:	c3                   	ret
+ 5db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5df:	90                   	nop
+
+000005e0 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 5e0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 5e5:	85 c0                	test   %eax,%eax
+ 5e7:	74 07                	je     5f0 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 5e9:	c3                   	ret
+ 5ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 5f0:	e9 77 02 00 00       	jmp    86c <sysgetpid>
+ 5f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000600 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 600:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 605:	c3                   	ret
+ 606:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000610 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 610:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 611:	31 d2                	xor    %edx,%edx
+ 613:	89 e5                	mov    %esp,%ebp
+ 615:	53                   	push   %ebx
+ 616:	83 ec 04             	sub    $0x4,%esp
+ 619:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 61c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 61f:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 622:	85 c9                	test   %ecx,%ecx
+ 624:	7e 08                	jle    62e <cyclereport+0x1e>
+ 626:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 628:	89 d8                	mov    %ebx,%eax
+ 62a:	f7 f1                	div    %ecx
+ 62c:	89 c2                	mov    %eax,%edx
+ 62e:	83 ec 08             	sub    $0x8,%esp
+ 631:	52                   	push   %edx
+ 632:	ff 75 0c             	push   0xc(%ebp)
+ 635:	51                   	push   %ecx
+ 636:	ff 75 08             	push   0x8(%ebp)
+ 639:	68 9e 0d 00 00       	push   $0xd9e
+ 63e:	6a 01                	push   $0x1
+ 640:	e8 fb 03 00 00       	call   a40 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 645:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 648:	83 c4 20             	add    $0x20,%esp
+ 64b:	c9                   	leave
+ 64c:	c3                   	ret
+ 64d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000650 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 653:	8b 45 08             	mov    0x8(%ebp),%eax
+ 656:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 65c:	5d                   	pop    %ebp
+ 65d:	c3                   	ret
+ 65e:	66 90                	xchg   %ax,%ax
+
+00000660 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 660:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 661:	31 c0                	xor    %eax,%eax
+ 663:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 668:	89 e5                	mov    %esp,%ebp
+ 66a:	56                   	push   %esi
+ 66b:	53                   	push   %ebx
+ 66c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 66f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 673:	85 c0                	test   %eax,%eax
+ 675:	74 30                	je     6a7 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 677:	83 f8 02             	cmp    $0x2,%eax
+ 67a:	74 0c                	je     688 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 67c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 681:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 684:	85 c0                	test   %eax,%eax
+ 686:	74 1f                	je     6a7 <mutex_lock+0x47>
+ 688:	be 02 00 00 00       	mov    $0x2,%esi
+ 68d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 690:	83 ec 08             	sub    $0x8,%esp
+ 693:	6a 02                	push   $0x2
+ 695:	53                   	push   %ebx
+ 696:	e8 8c 02 00 00       	call   927 <futex_wait>
+ 69b:	89 f0                	mov    %esi,%eax
+ 69d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 6a0:	83 c4 10             	add    $0x10,%esp
+ 6a3:	85 c0                	test   %eax,%eax
+ 6a5:	75 e9                	jne    690 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 6a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 6aa:	5b                   	pop    %ebx
+ 6ab:	5e                   	pop    %esi
+ 6ac:	5d                   	pop    %ebp
+ 6ad:	c3                   	ret
+ 6ae:	66 90                	xchg   %ax,%ax
+
+000006b0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 6b0:	55                   	push   %ebp
+ 6b1:	89 e5                	mov    %esp,%ebp
+ 6b3:	83 ec 08             	sub    $0x8,%esp
+ 6b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 6b9:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 6bd:	75 09                	jne    6c8 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 6bf:	c9                   	leave
+ 6c0:	c3                   	ret
+ 6c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 6c8:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 6cb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 6d1:	6a 01                	push   $0x1
+ 6d3:	50                   	push   %eax
+ 6d4:	e8 59 02 00 00       	call   932 <futex_wake>
+ 6d9:	83 c4 10             	add    $0x10,%esp
+}
+ 6dc:	c9                   	leave
+ 6dd:	c3                   	ret
+ 6de:	66 90                	xchg   %ax,%ax
+
+000006e0 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 6e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 6ec:	5d                   	pop    %ebp
+ 6ed:	c3                   	ret
+ 6ee:	66 90                	xchg   %ax,%ax
+
+000006f0 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 6f0:	55                   	push   %ebp
+ 6f1:	89 e5                	mov    %esp,%ebp
+ 6f3:	57                   	push   %edi
+ 6f4:	56                   	push   %esi
+ 6f5:	53                   	push   %ebx
+ 6f6:	83 ec 0c             	sub    $0xc,%esp
+ 6f9:	8b 75 08             	mov    0x8(%ebp),%esi
+ 6fc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 6ff:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 701:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 705:	75 21                	jne    728 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 707:	83 ec 08             	sub    $0x8,%esp
+ 70a:	57                   	push   %edi
+ 70b:	56                   	push   %esi
+ 70c:	e8 16 02 00 00       	call   927 <futex_wait>
+  mutex_lock(m);
+ 711:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 714:	83 c4 10             	add    $0x10,%esp
+}
+ 717:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 71a:	5b                   	pop    %ebx
+ 71b:	5e                   	pop    %esi
+ 71c:	5f                   	pop    %edi
+ 71d:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 71e:	e9 3d ff ff ff       	jmp    660 <mutex_lock>
+ 723:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 727:	90                   	nop
+    futex_wake(&m->v, 1);
+ 728:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 72b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 731:	6a 01                	push   $0x1
+ 733:	53                   	push   %ebx
+ 734:	e8 f9 01 00 00       	call   932 <futex_wake>
+ 739:	83 c4 10             	add    $0x10,%esp
+ 73c:	eb c9                	jmp    707 <cond_wait+0x17>
+ 73e:	66 90                	xchg   %ax,%ax
+
+00000740 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 740:	55                   	push   %ebp
+ 741:	89 e5                	mov    %esp,%ebp
+ 743:	83 ec 10             	sub    $0x10,%esp
+ 746:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 749:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 74d:	6a 01                	push   $0x1
+ 74f:	50                   	push   %eax
+ 750:	e8 dd 01 00 00       	call   932 <futex_wake>
+}
+ 755:	83 c4 10             	add    $0x10,%esp
+ 758:	c9                   	leave
+ 759:	c3                   	ret
+ 75a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000760 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 760:	55                   	push   %ebp
+ 761:	89 e5                	mov    %esp,%ebp
+ 763:	83 ec 10             	sub    $0x10,%esp
+ 766:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 769:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 76d:	68 ff ff ff 7f       	push   $0x7fffffff
+ 772:	50                   	push   %eax
+ 773:	e8 ba 01 00 00       	call   932 <futex_wake>
+}
+ 778:	83 c4 10             	add    $0x10,%esp
+ 77b:	c9                   	leave
+ 77c:	c3                   	ret
+
+0000077d <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 77d:	50                   	push   %eax
+  pushl %ebx
+ 77e:	53                   	push   %ebx
+  movl $1, %eax
+ 77f:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 784:	0f a2                	cpuid
+  popl %ebx
+ 786:	5b                   	pop    %ebx
+  popl %eax
+ 787:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 788:	c7 05 ec 12 00 00 ae 	movl   $0x7ae,0x12ec
+ 78f:	07 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 792:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 798:	74 14                	je     7ae <sysint>
+  movl $sysfast, syscallvec
+ 79a:	c7 05 ec 12 00 00 a4 	movl   $0x7a4,0x12ec
+ 7a1:	07 00 00 
+
+000007a4 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 7a4:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 7a6:	ba ad 07 00 00       	mov    $0x7ad,%edx
+  sysenter
+ 7ab:	0f 34                	sysenter
+1:
+  ret
+ 7ad:	c3                   	ret
+
+000007ae <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 7ae:	cd 40                	int    $0x40
+  ret
+ 7b0:	c3                   	ret
+
+000007b1 <fork>:
+
+SYSCALL(fork)
+ 7b1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7b6:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+000007bc <exit>:
+SYSCALL(exit)
+ 7bc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7c1:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+000007c7 <wait>:
+SYSCALL(wait)
+ 7c7:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7cc:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+000007d2 <pipe>:
+SYSCALL(pipe)
+ 7d2:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7d7:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+000007dd <read>:
+SYSCALL(read)
+ 7dd:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7e2:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+000007e8 <write>:
+SYSCALL(write)
+ 7e8:	b8 10 00 00 00       	mov    $0x10,%eax
+ 7ed:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+000007f3 <close>:
+SYSCALL(close)
+ 7f3:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7f8:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+000007fe <kill>:
+SYSCALL(kill)
+ 7fe:	b8 06 00 00 00       	mov    $0x6,%eax
+ 803:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+00000809 <exec>:
+SYSCALL(exec)
+ 809:	b8 07 00 00 00       	mov    $0x7,%eax
+ 80e:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+00000814 <open>:
+SYSCALL(open)
+ 814:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 819:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+0000081f <mknod>:
+SYSCALL(mknod)
+ 81f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 824:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+0000082a <unlink>:
+SYSCALL(unlink)
+ 82a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 82f:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+00000835 <fstat>:
+SYSCALL(fstat)
+ 835:	b8 08 00 00 00       	mov    $0x8,%eax
+ 83a:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+00000840 <link>:
+SYSCALL(link)
+ 840:	b8 13 00 00 00       	mov    $0x13,%eax
+ 845:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+0000084b <mkdir>:
+SYSCALL(mkdir)
+ 84b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 850:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+00000856 <chdir>:
+SYSCALL(chdir)
+ 856:	b8 09 00 00 00       	mov    $0x9,%eax
+ 85b:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+00000861 <dup>:
+SYSCALL(dup)
+ 861:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 866:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+0000086c <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 86c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 871:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+00000877 <sbrk>:
+SYSCALL(sbrk)
+ 877:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 87c:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+00000882 <sleep>:
+SYSCALL(sleep)
+ 882:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 887:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+0000088d <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 88d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 892:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+00000898 <swapread>:
+SYSCALL(swapread)
+ 898:	b8 16 00 00 00       	mov    $0x16,%eax
+ 89d:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+000008a3 <swapwrite>:
+SYSCALL(swapwrite)
+ 8a3:	b8 17 00 00 00       	mov    $0x17,%eax
+ 8a8:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+000008ae <swapstat>:
+SYSCALL(swapstat)
+ 8ae:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8b3:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+000008b9 <madvise>:
+SYSCALL(madvise)
+ 8b9:	b8 19 00 00 00       	mov    $0x19,%eax
+ 8be:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+000008c4 <mlock>:
+SYSCALL(mlock)
+ 8c4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 8c9:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+000008cf <munlock>:
+SYSCALL(munlock)
+ 8cf:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 8d4:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+000008da <membench>:
+SYSCALL(membench)
+ 8da:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 8df:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+000008e5 <nice>:
+SYSCALL(nice)
+ 8e5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 8ea:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+000008f0 <setpriority>:
+SYSCALL(setpriority)
+ 8f0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 8f5:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+000008fb <usleep>:
+SYSCALL(usleep)
+ 8fb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 900:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+00000906 <cpustat>:
+SYSCALL(cpustat)
+ 906:	b8 20 00 00 00       	mov    $0x20,%eax
+ 90b:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+00000911 <clone>:
+SYSCALL(clone)
+ 911:	b8 21 00 00 00       	mov    $0x21,%eax
+ 916:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+0000091c <join>:
+SYSCALL(join)
+ 91c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 921:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+00000927 <futex_wait>:
+SYSCALL(futex_wait)
+ 927:	b8 23 00 00 00       	mov    $0x23,%eax
+ 92c:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+00000932 <futex_wake>:
+SYSCALL(futex_wake)
+ 932:	b8 24 00 00 00       	mov    $0x24,%eax
+ 937:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+0000093d <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 93d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 942:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+00000948 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 948:	b8 26 00 00 00       	mov    $0x26,%eax
+ 94d:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+00000953 <getcpu>:
+SYSCALL(getcpu)
+ 953:	b8 27 00 00 00       	mov    $0x27,%eax
+ 958:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+0000095e <migrations>:
+SYSCALL(migrations)
+ 95e:	b8 28 00 00 00       	mov    $0x28,%eax
+ 963:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+00000969 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 969:	b8 29 00 00 00       	mov    $0x29,%eax
+ 96e:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+00000974 <lockstat>:
+SYSCALL(lockstat)
+ 974:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 979:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+0000097f <lockprof>:
+SYSCALL(lockprof)
+ 97f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 984:	ff 25 ec 12 00 00    	jmp    *0x12ec
+
+0000098a <bcachestat>:
+SYSCALL(bcachestat)
+ 98a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 98f:	ff 25 ec 12 00 00    	jmp    *0x12ec
+ 995:	66 90                	xchg   %ax,%ax
+ 997:	66 90                	xchg   %ax,%ax
+ 999:	66 90                	xchg   %ax,%ax
+ 99b:	66 90                	xchg   %ax,%ax
+ 99d:	66 90                	xchg   %ax,%ax
+ 99f:	90                   	nop
+
+000009a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 9a0:	55                   	push   %ebp
+ 9a1:	89 e5                	mov    %esp,%ebp
+ 9a3:	57                   	push   %edi
+ 9a4:	56                   	push   %esi
+ 9a5:	53                   	push   %ebx
+ 9a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 9a8:	89 d1                	mov    %edx,%ecx
+{
+ 9aa:	83 ec 3c             	sub    $0x3c,%esp
+ 9ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 9b0:	85 d2                	test   %edx,%edx
+ 9b2:	0f 89 80 00 00 00    	jns    a38 <printint+0x98>
+ 9b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 9bc:	74 7a                	je     a38 <printint+0x98>
+    x = -xx;
+ 9be:	f7 d9                	neg    %ecx
+    neg = 1;
+ 9c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 9c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 9c8:	31 f6                	xor    %esi,%esi
+ 9ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 9d0:	89 c8                	mov    %ecx,%eax
+ 9d2:	31 d2                	xor    %edx,%edx
+ 9d4:	89 f7                	mov    %esi,%edi
+ 9d6:	f7 f3                	div    %ebx
+ 9d8:	8d 76 01             	lea    0x1(%esi),%esi
+ 9db:	0f b6 92 18 0e 00 00 	movzbl 0xe18(%edx),%edx
+ 9e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 9e6:	89 ca                	mov    %ecx,%edx
+ 9e8:	89 c1                	mov    %eax,%ecx
+ 9ea:	39 da                	cmp    %ebx,%edx
+ 9ec:	73 e2                	jae    9d0 <printint+0x30>
+  if(neg)
+ 9ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 9f1:	85 c0                	test   %eax,%eax
+ 9f3:	74 07                	je     9fc <printint+0x5c>
+    buf[i++] = '-';
+ 9f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 9fa:	89 f7                	mov    %esi,%edi
+ 9fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 9ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ a02:	01 df                	add    %ebx,%edi
+ a04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ a08:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ a0b:	83 ec 04             	sub    $0x4,%esp
+ a0e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ a11:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ a14:	6a 01                	push   $0x1
+ a16:	50                   	push   %eax
+ a17:	56                   	push   %esi
+ a18:	e8 cb fd ff ff       	call   7e8 <write>
+  while(--i >= 0)
+ a1d:	89 f8                	mov    %edi,%eax
+ a1f:	83 c4 10             	add    $0x10,%esp
+ a22:	83 ef 01             	sub    $0x1,%edi
+ a25:	39 d8                	cmp    %ebx,%eax
+ a27:	75 df                	jne    a08 <printint+0x68>
+}
+ a29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a2c:	5b                   	pop    %ebx
+ a2d:	5e                   	pop    %esi
+ a2e:	5f                   	pop    %edi
+ a2f:	5d                   	pop    %ebp
+ a30:	c3                   	ret
+ a31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ a38:	31 c0                	xor    %eax,%eax
+ a3a:	eb 89                	jmp    9c5 <printint+0x25>
+ a3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a40 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ a40:	55                   	push   %ebp
+ a41:	89 e5                	mov    %esp,%ebp
+ a43:	57                   	push   %edi
+ a44:	56                   	push   %esi
+ a45:	53                   	push   %ebx
+ a46:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ a49:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ a4c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ a4f:	0f b6 1e             	movzbl (%esi),%ebx
+ a52:	83 c6 01             	add    $0x1,%esi
+ a55:	84 db                	test   %bl,%bl
+ a57:	74 67                	je     ac0 <printf+0x80>
+ a59:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ a5c:	31 d2                	xor    %edx,%edx
+ a5e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ a61:	eb 34                	jmp    a97 <printf+0x57>
+ a63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a67:	90                   	nop
+ a68:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ a6b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ a70:	83 f8 25             	cmp    $0x25,%eax
+ a73:	74 18                	je     a8d <printf+0x4d>
+  write(fd, &c, 1);
+ a75:	83 ec 04             	sub    $0x4,%esp
+ a78:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ a7b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a7e:	6a 01                	push   $0x1
+ a80:	50                   	push   %eax
+ a81:	57                   	push   %edi
+ a82:	e8 61 fd ff ff       	call   7e8 <write>
+ a87:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ a8a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ a8d:	0f b6 1e             	movzbl (%esi),%ebx
+ a90:	83 c6 01             	add    $0x1,%esi
+ a93:	84 db                	test   %bl,%bl
+ a95:	74 29                	je     ac0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ a97:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ a9a:	85 d2                	test   %edx,%edx
+ a9c:	74 ca                	je     a68 <printf+0x28>
+      }
+    } else if(state == '%'){
+ a9e:	83 fa 25             	cmp    $0x25,%edx
+ aa1:	75 ea                	jne    a8d <printf+0x4d>
+      if(c == 'd'){
+ aa3:	83 f8 25             	cmp    $0x25,%eax
+ aa6:	0f 84 24 01 00 00    	je     bd0 <printf+0x190>
+ aac:	83 e8 63             	sub    $0x63,%eax
+ aaf:	83 f8 15             	cmp    $0x15,%eax
+ ab2:	77 1c                	ja     ad0 <printf+0x90>
+ ab4:	ff 24 85 c0 0d 00 00 	jmp    *0xdc0(,%eax,4)
+ abb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ abf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ ac0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ac3:	5b                   	pop    %ebx
+ ac4:	5e                   	pop    %esi
+ ac5:	5f                   	pop    %edi
+ ac6:	5d                   	pop    %ebp
+ ac7:	c3                   	ret
+ ac8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ acf:	90                   	nop
+  write(fd, &c, 1);
+ ad0:	83 ec 04             	sub    $0x4,%esp
+ ad3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ad6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ ada:	6a 01                	push   $0x1
+ adc:	52                   	push   %edx
+ add:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ ae0:	57                   	push   %edi
+ ae1:	e8 02 fd ff ff       	call   7e8 <write>
+ ae6:	83 c4 0c             	add    $0xc,%esp
+ ae9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ aec:	6a 01                	push   $0x1
+ aee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ af1:	52                   	push   %edx
+ af2:	57                   	push   %edi
+ af3:	e8 f0 fc ff ff       	call   7e8 <write>
+        putc(fd, c);
+ af8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ afb:	31 d2                	xor    %edx,%edx
+ afd:	eb 8e                	jmp    a8d <printf+0x4d>
+ aff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ b00:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b03:	83 ec 0c             	sub    $0xc,%esp
+ b06:	b9 10 00 00 00       	mov    $0x10,%ecx
+ b0b:	8b 13                	mov    (%ebx),%edx
+ b0d:	6a 00                	push   $0x0
+ b0f:	89 f8                	mov    %edi,%eax
+        ap++;
+ b11:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ b14:	e8 87 fe ff ff       	call   9a0 <printint>
+        ap++;
+ b19:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b1c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b1f:	31 d2                	xor    %edx,%edx
+ b21:	e9 67 ff ff ff       	jmp    a8d <printf+0x4d>
+ b26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b2d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ b30:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ b33:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ b35:	83 c0 04             	add    $0x4,%eax
+ b38:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ b3b:	85 db                	test   %ebx,%ebx
+ b3d:	0f 84 9d 00 00 00    	je     be0 <printf+0x1a0>
+        while(*s != 0){
+ b43:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ b46:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ b48:	84 c0                	test   %al,%al
+ b4a:	0f 84 3d ff ff ff    	je     a8d <printf+0x4d>
+ b50:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b53:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ b56:	89 de                	mov    %ebx,%esi
+ b58:	89 d3                	mov    %edx,%ebx
+ b5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ b60:	83 ec 04             	sub    $0x4,%esp
+ b63:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ b66:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ b69:	6a 01                	push   $0x1
+ b6b:	53                   	push   %ebx
+ b6c:	57                   	push   %edi
+ b6d:	e8 76 fc ff ff       	call   7e8 <write>
+        while(*s != 0){
+ b72:	0f b6 06             	movzbl (%esi),%eax
+ b75:	83 c4 10             	add    $0x10,%esp
+ b78:	84 c0                	test   %al,%al
+ b7a:	75 e4                	jne    b60 <printf+0x120>
+      state = 0;
+ b7c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ b7f:	31 d2                	xor    %edx,%edx
+ b81:	e9 07 ff ff ff       	jmp    a8d <printf+0x4d>
+ b86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b8d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ b90:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b93:	83 ec 0c             	sub    $0xc,%esp
+ b96:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ b9b:	8b 13                	mov    (%ebx),%edx
+ b9d:	6a 01                	push   $0x1
+ b9f:	e9 6b ff ff ff       	jmp    b0f <printf+0xcf>
+ ba4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ ba8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ bab:	83 ec 04             	sub    $0x4,%esp
+ bae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ bb1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ bb3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ bb6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ bb9:	6a 01                	push   $0x1
+ bbb:	52                   	push   %edx
+ bbc:	57                   	push   %edi
+ bbd:	e8 26 fc ff ff       	call   7e8 <write>
+        ap++;
+ bc2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ bc5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ bc8:	31 d2                	xor    %edx,%edx
+ bca:	e9 be fe ff ff       	jmp    a8d <printf+0x4d>
+ bcf:	90                   	nop
+  write(fd, &c, 1);
+ bd0:	83 ec 04             	sub    $0x4,%esp
+ bd3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ bd6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ bd9:	6a 01                	push   $0x1
+ bdb:	e9 11 ff ff ff       	jmp    af1 <printf+0xb1>
+ be0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ be5:	bb b9 0d 00 00       	mov    $0xdb9,%ebx
+ bea:	e9 61 ff ff ff       	jmp    b50 <printf+0x110>
+ bef:	90                   	nop
+
+00000bf0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ bf0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bf1:	a1 00 17 00 00       	mov    0x1700,%eax
+{
+ bf6:	89 e5                	mov    %esp,%ebp
+ bf8:	57                   	push   %edi
+ bf9:	56                   	push   %esi
+ bfa:	53                   	push   %ebx
+ bfb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ bfe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c08:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c0a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c0c:	39 ca                	cmp    %ecx,%edx
+ c0e:	73 30                	jae    c40 <free+0x50>
+ c10:	39 c1                	cmp    %eax,%ecx
+ c12:	72 04                	jb     c18 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c14:	39 c2                	cmp    %eax,%edx
+ c16:	72 f0                	jb     c08 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ c18:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ c1b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ c1e:	39 f8                	cmp    %edi,%eax
+ c20:	74 2e                	je     c50 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c22:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ c25:	8b 42 04             	mov    0x4(%edx),%eax
+ c28:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c2b:	39 f1                	cmp    %esi,%ecx
+ c2d:	74 38                	je     c67 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ c2f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ c31:	5b                   	pop    %ebx
+  freep = p;
+ c32:	89 15 00 17 00 00    	mov    %edx,0x1700
+}
+ c38:	5e                   	pop    %esi
+ c39:	5f                   	pop    %edi
+ c3a:	5d                   	pop    %ebp
+ c3b:	c3                   	ret
+ c3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c40:	39 c1                	cmp    %eax,%ecx
+ c42:	72 d0                	jb     c14 <free+0x24>
+ c44:	eb c2                	jmp    c08 <free+0x18>
+ c46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c4d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ c50:	03 70 04             	add    0x4(%eax),%esi
+ c53:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c56:	8b 02                	mov    (%edx),%eax
+ c58:	8b 00                	mov    (%eax),%eax
+ c5a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ c5d:	8b 42 04             	mov    0x4(%edx),%eax
+ c60:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c63:	39 f1                	cmp    %esi,%ecx
+ c65:	75 c8                	jne    c2f <free+0x3f>
+    p->s.size += bp->s.size;
+ c67:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ c6a:	89 15 00 17 00 00    	mov    %edx,0x1700
+    p->s.size += bp->s.size;
+ c70:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ c73:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ c76:	89 0a                	mov    %ecx,(%edx)
+}
+ c78:	5b                   	pop    %ebx
+ c79:	5e                   	pop    %esi
+ c7a:	5f                   	pop    %edi
+ c7b:	5d                   	pop    %ebp
+ c7c:	c3                   	ret
+ c7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c80 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ c80:	55                   	push   %ebp
+ c81:	89 e5                	mov    %esp,%ebp
+ c83:	57                   	push   %edi
+ c84:	56                   	push   %esi
+ c85:	53                   	push   %ebx
+ c86:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c89:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ c8c:	8b 15 00 17 00 00    	mov    0x1700,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c92:	8d 78 07             	lea    0x7(%eax),%edi
+ c95:	c1 ef 03             	shr    $0x3,%edi
+ c98:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ c9b:	85 d2                	test   %edx,%edx
+ c9d:	0f 84 8d 00 00 00    	je     d30 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ca3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ca5:	8b 48 04             	mov    0x4(%eax),%ecx
+ ca8:	39 f9                	cmp    %edi,%ecx
+ caa:	73 64                	jae    d10 <malloc+0x90>
+  if(nu < 4096)
+ cac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ cb1:	39 df                	cmp    %ebx,%edi
+ cb3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ cb6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ cbd:	eb 0a                	jmp    cc9 <malloc+0x49>
+ cbf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cc0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ cc2:	8b 48 04             	mov    0x4(%eax),%ecx
+ cc5:	39 f9                	cmp    %edi,%ecx
+ cc7:	73 47                	jae    d10 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ cc9:	89 c2                	mov    %eax,%edx
+ ccb:	39 05 00 17 00 00    	cmp    %eax,0x1700
+ cd1:	75 ed                	jne    cc0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ cd3:	83 ec 0c             	sub    $0xc,%esp
+ cd6:	56                   	push   %esi
+ cd7:	e8 9b fb ff ff       	call   877 <sbrk>
+  if(p == (char*)-1)
+ cdc:	83 c4 10             	add    $0x10,%esp
+ cdf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ce2:	74 1c                	je     d00 <malloc+0x80>
+  hp->s.size = nu;
+ ce4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ ce7:	83 ec 0c             	sub    $0xc,%esp
+ cea:	83 c0 08             	add    $0x8,%eax
+ ced:	50                   	push   %eax
+ cee:	e8 fd fe ff ff       	call   bf0 <free>
+  return freep;
+ cf3:	8b 15 00 17 00 00    	mov    0x1700,%edx
+      if((p = morecore(nunits)) == 0)
+ cf9:	83 c4 10             	add    $0x10,%esp
+ cfc:	85 d2                	test   %edx,%edx
+ cfe:	75 c0                	jne    cc0 <malloc+0x40>
+        return 0;
+  }
+}
+ d00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ d03:	31 c0                	xor    %eax,%eax
+}
+ d05:	5b                   	pop    %ebx
+ d06:	5e                   	pop    %esi
+ d07:	5f                   	pop    %edi
+ d08:	5d                   	pop    %ebp
+ d09:	c3                   	ret
+ d0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ d10:	39 cf                	cmp    %ecx,%edi
+ d12:	74 4c                	je     d60 <malloc+0xe0>
+        p->s.size -= nunits;
+ d14:	29 f9                	sub    %edi,%ecx
+ d16:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ d19:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ d1c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ d1f:	89 15 00 17 00 00    	mov    %edx,0x1700
+}
+ d25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ d28:	83 c0 08             	add    $0x8,%eax
+}
+ d2b:	5b                   	pop    %ebx
+ d2c:	5e                   	pop    %esi
+ d2d:	5f                   	pop    %edi
+ d2e:	5d                   	pop    %ebp
+ d2f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ d30:	c7 05 00 17 00 00 04 	movl   $0x1704,0x1700
+ d37:	17 00 00 
+    base.s.size = 0;
+ d3a:	b8 04 17 00 00       	mov    $0x1704,%eax
+    base.s.ptr = freep = prevp = &base;
+ d3f:	c7 05 04 17 00 00 04 	movl   $0x1704,0x1704
+ d46:	17 00 00 
+    base.s.size = 0;
+ d49:	c7 05 08 17 00 00 00 	movl   $0x0,0x1708
+ d50:	00 00 00 
+    if(p->s.size >= nunits){
+ d53:	e9 54 ff ff ff       	jmp    cac <malloc+0x2c>
+ d58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d5f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ d60:	8b 08                	mov    (%eax),%ecx
+ d62:	89 0a                	mov    %ecx,(%edx)
+ d64:	eb b9                	jmp    d1f <malloc+0x9f>
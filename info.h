@@ -0,0 +1,18 @@
+// Kernel info pages, mapped read-only into every process just
+// below KERNBASE, so that ulib can answer uptime() and getpid()
+// without a system call.
+
+#define SYSINFO   0x7FFFE000   // struct sysinfo, one for all
+#define PROCINFO  0x7FFFF000   // struct procinfo, per address space
+
+struct sysinfo {
+  volatile uint ticks;         // as returned by uptime()
+  volatile uint jiffies;       // 1 ms jiffies, as of the last timer irq
+  uint tscperus;               // TSC cycles per microsecond
+  uint tickjiffies;            // jiffies per tick
+  uint64 boottsc;              // TSC at jiffy 0
+};
+
+struct procinfo {
+  volatile int pid;            // getpid(), or 0 to ask the kernel
+};
@@ -0,0 +1,37 @@
+// Batched system calls.  A process queues operations on a
+// struct ioring in its own memory, and one ioring_enter()
+// carries out all the queued ones, in order, posting a
+// completion for each.  The process advances sqtail and
+// cqhead, the kernel sqhead and cqtail; all four count up
+// forever and are taken modulo IORING_SIZE.
+
+#define IORING_SIZE   64       // entries in each ring, a power of 2
+
+// Operations, and the system call each is.
+#define IORING_READ   1        // read(fd, addr, n)
+#define IORING_WRITE  2        // write(fd, addr, n)
+#define IORING_OPEN   3        // open(addr, n)
+#define IORING_CLOSE  4        // close(fd)
+#define IORING_FSTAT  5        // fstat(fd, addr)
+
+struct iosqe {                 // submission queue entry
+  int op;
+  int fd;
+  uint addr;                   // buffer, path or struct stat
+  int n;                       // byte count or open mode
+  uint data;                   // passed through to the completion
+};
+
+struct iocqe {                 // completion queue entry
+  uint data;
+  int res;                     // what the system call returned
+};
+
+struct ioring {
+  volatile uint sqhead;        // next submission the kernel takes
+  volatile uint sqtail;        // next submission slot to fill
+  volatile uint cqhead;        // next completion to read
+  volatile uint cqtail;        // next completion slot to fill
+  struct iosqe sq[IORING_SIZE];
+  struct iocqe cq[IORING_SIZE];
+};
@@ -7,7 +7,10 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "x86.h"
 #include "spinlock.h"
+#include "sleeplock.h"
+#include "mman.h"
 #include <stddef.h>
 #include "proc.h"
 
@@ -18,20 +21,24 @@ extern char end[]; // first address after kernel loaded from ELF file
 
 void
 add_to_lru_list(struct page *new_page);
-
-pte_t *
-walkpgdir(pde_t *pgdir, const void *va, int alloc);
+void
+remove_from_lru_list(struct page *target_page);
 
 struct run {
   struct run *next;
 };
 
+// kmem.lock also protects the LRU list, pages[] and the swap bitmap.
 struct {
   struct spinlock lock;
   int use_lock;
   struct run *freelist;
 } kmem;
 
+// Swap I/O is serialized so that a slot being written out
+// is never read back in before the write has finished.
+struct sleeplock swaplock;
+
 
 //pa4 bitmap..
 
@@ -40,22 +47,24 @@ struct {
 
 // Ʈ  Լ
 // PTE  ƿ ó Լ
+// The permission and madvise bits are kept so that swap-in
+// can restore them.
 void SET_out(pte_t *pte, int swap_index) {
-    *pte = (swap_index << 10) | PTE_SWAP; //  ε ϰ PTE_SWAP Ʈ 
-    *pte &= ~PTE_P; // PTE_P Ʈ 
+    *pte = (swap_index << PTXSHIFT) | PTE_FLAGS(*pte) | PTE_SWAP; //  ε ϰ PTE_SWAP Ʈ 
+    *pte &= ~(PTE_P | PTE_A); // PTE_P Ʈ 
 }
 
 // PTE   ó Լ
-int SET_in(pte_t *pte) {
-    int swap_index = (*pte >> 10) & 0x3FFFFF; // PTE  ε  ( 22Ʈ )
-    *pte &= ~PTE_SWAP; // PTE_SWAP Ʈ 
+int SET_in(pte_t *pte, char *mem) {
+    int swap_index = PTE_SWAPIDX(*pte); // PTE  ε 
+    *pte = V2P(mem) | (PTE_FLAGS(*pte) & ~PTE_SWAP); // PTE_SWAP Ʈ 
     *pte |= PTE_P; // PTE_P Ʈ 
     return swap_index; //   ε ȯ
 }
 
 
 //   ϱ  Ʈ 迭
-char swap_space_bitmap[MAX_SWAP_PAGES / 8] = {0}; // 1Ʈ ϳ  
+char swap_space_bitmap[(MAX_SWAP_PAGES + 7) / 8] = {0}; // 1Ʈ ϳ  
 
 // Ʈʿ     ã Լ
 int find_free_swap_block() {
@@ -77,53 +86,6 @@ void free_swap_block(int blockno) {
     swap_space_bitmap[byte_index] &= ~(1 << bit_index); // ش Ʈ 0 Ͽ  
 }
 
-//  ƿ Լ
-void swap_out_page(struct page *page) {
-    int swap_index = find_free_swap_block(); //     ã
-    if (swap_index == -1) { //     
-        panic("OOM : Out of memory\nSwap space is full\n"); // д ߻
-    }
-
-    pte_t *pte = walkpgdir(page->pgdir, page->vaddr, 0); //  PTE 
-    if (!pte) { // PTE ã   
-        panic("PTE not found"); // д ߻
-    }
-
-    //    
-    swapwrite(page->vaddr, swap_index); // swapwrite Լ ȣ
-
-    // PTE  ε ϰ  Ʈ , PTE_P Ʈ Ŭ
-    SET_out(pte, swap_index); // SET_out Լ ȣ
-
-    //  freelist ߰
-    kfree(page->vaddr); //  ƿ  free list ߰
-    
-}
-
-
-//   Լ
-void swap_in_page(struct page *page) {
-    pte_t *pte = walkpgdir(page->pgdir, page->vaddr, 0); //  PTE 
-    if (!pte || !(*pte & PTE_SWAP)) { //  ҵ ° ƴ 
-        panic("Page not swapped out"); // д ߻
-    }
-
-    char *new_page = kalloc(); // ο   Ҵ
-    if (!new_page) { //  Ҵ翡  
-        panic("OOM: Out of memory during swap-in"); // д ߻
-    }
-
-    int swap_index = SET_in(pte); // SET_in Լ ȣ  ε 
-    swapread(new_page, swap_index); //    о
-    *pte = V2P(new_page) | PTE_P | PTE_W | PTE_U; // PTE ƮϿ ο   ּҸ ϰ PTE_P Ʈ 
-
-    free_swap_block(swap_index); //   
-    add_to_lru_list(page); // ο  LRU Ʈ ߰
-}
-
-
-
-
 //pa4 bitmap..
 
 
@@ -138,55 +100,13 @@ int num_lru_pages;
 //pa4 skel
 
 
-//pa4 bitmap  ߰
-
-// 1) Ʈ ʱȭ Լ.
-// Q : LRU  ʱȭ ʿ䰡 ..?
-
-//pa4 bitmap  ߰.
-
-//
-
-//
-
 //pa4 ߰
 
-int start_LRU = 0;
-
-
-int 
-exist_in_lru(struct page *page) {
-    struct page *current = page_lru_head; // LRU Ʈ Ӹ 带   
-    if (!current) { // LRU Ʈ  ִ 
-        return 0; //  LRU Ʈ   ȯ
-    }
-
-    do {
-        if (current == page) { //  尡 ã ϴ  
-            return 1; //  LRU Ʈ  ȯ
-        }
-        current = current->next; //   ̵
-    } while (current != page_lru_head); // ٽ Ӹ  ƿ  ݺ
-
-    return 0; //  LRU Ʈ   ȯ
-}
-
-
-
-
-int
-is_user_page(pde_t *pgdir, char *va)
-{
-  pte_t *pte = walkpgdir(pgdir, va, 0); // va   ̺ Ʈ 
-  if (pte && (*pte & PTE_U)) // pte ϰ PTE_U Ʈ   (user page Ȯ)
-    return 1;
-  return 0;
-}
-
 void
 add_to_lru_list(struct page *new_page)
 {
     num_lru_pages++;
+    new_page->flags |= PG_LRU;
     if (page_lru_head == 0) { // LRU Ʈ ִ 
         page_lru_head = new_page; // new_page LRU Ʈ Ӹ  
         new_page->next = new_page->prev = new_page; // new_page next prev ڱ ڽ  (ȯ Ʈ)
@@ -202,6 +122,7 @@ void
 remove_from_lru_list(struct page *target_page)
 {
   num_lru_pages--;
+  target_page->flags &= ~PG_LRU;
   if (target_page->next != target_page) {
     target_page->next->prev = target_page->prev;
     target_page->prev->next = target_page->next;
@@ -213,39 +134,509 @@ remove_from_lru_list(struct page *target_page)
   }
 }
 
-struct page* find_victim_lru(void)
+// Clear a user PTE.  A resident page is taken off the LRU list
+// and returned for the caller to kfree(); a swapped-out one has
+// its swap slot released.  Done under kmem.lock, so that reclaim
+// cannot swap the page out from under us.
+char*
+unmap_user_page(pte_t *pte)
+{
+  struct page *page;
+  char *mem;
+
+  mem = 0;
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  if(*pte & PTE_P){
+    if(PTE_ADDR(*pte) == 0)
+      panic("kfree");
+    mem = P2V(PTE_ADDR(*pte));
+    page = &pages[PTE_ADDR(*pte) / PGSIZE];
+    if(page->flags & PG_LRU)
+      remove_from_lru_list(page);
+  } else if((*pte & PTE_SWAP) && PTE_SWAPIDX(*pte) != SWAP_ZERO)
+    free_swap_block(PTE_SWAPIDX(*pte));
+  *pte = 0;
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  return mem;
+}
+
+// Make user page va of pgdir, backed by physical page mem,
+// a candidate for reclaim.  The caller must not keep using
+// mem through a kernel pointer afterwards, since the page
+// may be swapped out at any time.
+void
+lru_add(pde_t *pgdir, char *va, char *mem)
+{
+  struct page *page = &pages[V2P(mem) / PGSIZE];
+
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  page->pgdir = pgdir;
+  page->vaddr = va;
+  page->flags = 0;
+  add_to_lru_list(page);
+  if(kmem.use_lock)
+    release(&kmem.lock);
+}
+
+// Put every present user page below sz on the LRU list.
+// Used by exec() once the new image is committed.
+void
+lru_addvm(pde_t *pgdir, uint sz)
 {
-  struct page *victim = page_lru_head; // LRU Ʈ Ӹ 带 victim 
   pte_t *pte;
+  uint a;
 
-  if (!victim) {
-    return 0;  // LRU Ʈ  NULL ȯ
+  for(a = 0; a < sz; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(pte && (*pte & PTE_P) && (*pte & PTE_U))
+      lru_add(pgdir, (char*)a, P2V(PTE_ADDR(*pte)));
   }
+}
 
-  // Clock ˰ 
-  while (1) {
+// Clock algorithm over the LRU list.  The hand is page_lru_head:
+// advancing it moves the page it passes to the tail.  Referenced
+// pages get a second chance unless madvise() said the range is
+// scanned sequentially, in which case pages behind the scan go first.
+// mlock()ed pages and pages with futex waiters are passed over.
+struct page* find_victim_lru(void)
+{
+  struct page *victim;
+  pte_t *pte;
+  int n;
+
+  for(n = 0; page_lru_head && n < 2*num_lru_pages; n++){
+    victim = page_lru_head;
+    page_lru_head = victim->next;
     pte = walkpgdir(victim->pgdir, victim->vaddr, 0); //  ̺ Ʈ 
-    if (pte && (*pte & PTE_A)) { //  ֱٿ ٵǾ Ȯ
+    if(pte == 0 || (*pte & PTE_P) == 0)
+      panic("find_victim_lru");
+    if((victim->flags & PG_MLOCK) || victim->npin)
+      continue;
+    if((*pte & PTE_A) && (*pte & PTE_SEQ) == 0){ //  ֱٿ ٵǾ Ȯ
       *pte &= ~PTE_A;  // PTE_A Ʈ ŬϿ ٵ  ǥ
-
-      // LRU Ʈ  ̵
-      victim->next->prev = victim->prev; // victim    带 
-      victim->prev->next = victim->next; // victim Ʈ 
-      victim->next = page_lru_head; // victim Ʈ Ӹ ̵
-      victim->prev = page_lru_head->prev;
-      page_lru_head->prev->next = victim;
-      page_lru_head->prev = victim;
-      page_lru_head = victim->next;  // head   ̵
-    } else if (pte) {
-      return victim; // victim  ȯ
+      continue;
     }
-    victim = victim->next;  //   ̵
+    return victim; // victim  ȯ
   }
 
   return 0;  // ü   NULL ȯ
 }
 
+//  ƿ Լ
+// Unmap page and point its PTE at a fresh swap slot.
+// Returns the slot, or -1 if the page cannot be evicted now.
+// Caller holds kmem.lock and swaplock, and after releasing
+// kmem.lock shoots down the TLBs and writes the page out.
+int swap_out_page(struct page *page) {
+    pte_t *pte;
+    int swap_index = find_free_swap_block(); //     ã
+    if (swap_index == -1) //     
+        return -1;
+
+    pte = walkpgdir(page->pgdir, page->vaddr, 0); //  PTE 
+    if (!pte) { // PTE ã   
+        panic("PTE not found"); // д ߻
+    }
+
+    SET_out(pte, swap_index); // SET_out Լ ȣ
+    if(myproc() && myproc()->pgdir == page->pgdir)
+      invlpg(page->vaddr);
+
+    remove_from_lru_list(page);
+    return swap_index;
+}
+
+//   Լ
+// Bring user page va of pgdir back from swap.  A page marked
+// referenced is the one that faulted; read-ahead pages are not.
+// Returns 0 on success (or if someone else already did it),
+// -1 if there is no memory.
+int swap_in_page(pde_t *pgdir, char *va, int referenced) {
+    pte_t *pte;
+    char *new_page;
+    int swap_index;
+
+    pte = walkpgdir(pgdir, va, 0);
+    if (!pte || !(*pte & PTE_SWAP))
+        return 0;
+
+    new_page = kalloc(); // ο   Ҵ
+    if (!new_page) //  Ҵ翡  
+        return -1;
+
+    acquiresleep(&swaplock);
+    pte = walkpgdir(pgdir, va, 0); //  PTE 
+    if (!pte || !(*pte & PTE_SWAP)) { //  ҵ ° ƴ 
+        releasesleep(&swaplock);
+        kfree(new_page);
+        return 0;
+    }
+
+    swap_index = PTE_SWAPIDX(*pte);
+    if (swap_index == SWAP_ZERO)
+        clear_page(new_page);
+    else
+        swapread(new_page, swap_index); //    о
+
+    acquire(&kmem.lock);
+    if (!(*pte & PTE_SWAP) || PTE_SWAPIDX(*pte) != swap_index) {
+        // Unmapped meanwhile (sbrk(-n) in another thread).
+        release(&kmem.lock);
+        releasesleep(&swaplock);
+        kfree(new_page);
+        return 0;
+    }
+    SET_in(pte, new_page); // PTE ƮϿ ο   ּҸ 
+    if (referenced)
+        *pte |= PTE_A;
+    if (swap_index != SWAP_ZERO)
+        free_swap_block(swap_index); //   
+    struct page *page = &pages[V2P(new_page) / PGSIZE];
+    page->pgdir = pgdir;
+    page->vaddr = va;
+    page->flags = 0;
+    add_to_lru_list(page); // ο  LRU Ʈ ߰
+    release(&kmem.lock);
+    releasesleep(&swaplock);
+    return 0;
+}
+
+// Handle a page fault at va by bringing the page back from swap,
+// then read ahead the pages after it according to the madvise()
+// hint on the faulting page.  Returns -1 if va is not swapped out.
+int
+swap_fault(pde_t *pgdir, uint va)
+{
+  pte_t *pte;
+  int ra;
+
+  va = PGROUNDDOWN(va);
+  if(va >= KERNBASE)
+    return -1;
+  pte = walkpgdir(pgdir, (char*)va, 0);
+  if(pte == 0 || (*pte & PTE_SWAP) == 0)
+    return -1;
+
+  if(*pte & PTE_SEQ)
+    ra = SWAPRA_SEQ;
+  else if(*pte & PTE_RAND)
+    ra = 0;
+  else
+    ra = SWAPRA;
+
+  if(swap_in_page(pgdir, (char*)va, 1) < 0)
+    return -1;
+
+  for(va += PGSIZE; ra > 0 && va < KERNBASE; va += PGSIZE, ra--){
+    pte = walkpgdir(pgdir, (char*)va, 0);
+    if(pte == 0 || (*pte & PTE_SWAP) == 0 || PTE_SWAPIDX(*pte) == SWAP_ZERO)
+      break;
+    if(swap_in_page(pgdir, (char*)va, 0) < 0)
+      break;
+  }
+  return 0;
+}
+
+// Copy the contents of user page va of pgdir into mem, reading
+// it from swap if it is not resident.  Returns the PTE permission
+// and advice bits the copy should be mapped with.
+uint
+copy_user_page(pde_t *pgdir, char *va, char *mem)
+{
+  pte_t *pte;
+  uint flags;
+
+  if((pte = walkpgdir(pgdir, va, 0)) == 0)
+    panic("copy_user_page: pte should exist");
+  if(*pte & PTE_P){
+    copy_page(mem, (char*)P2V(PTE_ADDR(*pte)));
+    return PTE_FLAGS(*pte) & (PTE_W|PTE_U|PTE_SEQ|PTE_RAND);
+  }
+  if((*pte & PTE_SWAP) == 0)
+    panic("copy_user_page: page not present");
+
+  // Wait for a write of this slot that may be in progress.
+  acquiresleep(&swaplock);
+  if(*pte & PTE_P)
+    copy_page(mem, (char*)P2V(PTE_ADDR(*pte)));
+  else if(PTE_SWAPIDX(*pte) == SWAP_ZERO)
+    clear_page(mem);
+  else
+    swapread(mem, PTE_SWAPIDX(*pte));
+  flags = PTE_FLAGS(*pte) & (PTE_W|PTE_U|PTE_SEQ|PTE_RAND);
+  releasesleep(&swaplock);
+  return flags;
+}
+
+// Apply madvise() advice to the pages of [addr, addr+len) in pgdir,
+// which must be the current process's page table.
+int
+madvise(pde_t *pgdir, uint addr, uint len, int advice)
+{
+  pte_t *pte;
+  char *mem;
+  uint a, last;
+
+  last = PGROUNDUP(addr + len);
+  for(a = addr; a < last; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(pte == 0 || (*pte & (PTE_P|PTE_SWAP)) == 0 || (*pte & PTE_U) == 0)
+      continue;
+
+    if(advice == MADV_WILLNEED){
+      if(swap_in_page(pgdir, (char*)a, 0) < 0)
+        return -1;
+      continue;
+    }
+
+    mem = 0;
+    acquire(&kmem.lock);
+    switch(advice){
+    case MADV_NORMAL:
+      *pte &= ~(PTE_SEQ|PTE_RAND);
+      break;
+    case MADV_SEQUENTIAL:
+      *pte = (*pte & ~PTE_RAND) | PTE_SEQ;
+      break;
+    case MADV_RANDOM:
+      *pte = (*pte & ~PTE_SEQ) | PTE_RAND;
+      break;
+    case MADV_DONTNEED:
+      if((*pte & PTE_P) && ((pages[PTE_ADDR(*pte) / PGSIZE].flags & PG_MLOCK) ||
+                            pages[PTE_ADDR(*pte) / PGSIZE].npin)){
+        release(&kmem.lock);
+        return -1;
+      }
+      if(*pte & PTE_P){
+        // Off the LRU list now, not in kfree(): reclaim must
+        // not find the page once its PTE is not present.
+        mem = P2V(PTE_ADDR(*pte));
+        if(pages[V2P(mem) / PGSIZE].flags & PG_LRU)
+          remove_from_lru_list(&pages[V2P(mem) / PGSIZE]);
+        *pte = (SWAP_ZERO << PTXSHIFT) | PTE_FLAGS(*pte) | PTE_SWAP;
+        *pte &= ~(PTE_P|PTE_A);
+      } else if(PTE_SWAPIDX(*pte) != SWAP_ZERO){
+        free_swap_block(PTE_SWAPIDX(*pte));
+        *pte = (SWAP_ZERO << PTXSHIFT) | PTE_FLAGS(*pte);
+      }
+      break;
+    }
+    release(&kmem.lock);
+    if(mem){
+      invlpg((char*)a);
+      tlbshootdown(pgdir);
+      kfree(mem);
+    }
+  }
+  return 0;
+}
+
+
+// Count the mlock()ed pages below sz in pgdir.
+static int
+mlocked(pde_t *pgdir, uint sz)
+{
+  pte_t *pte;
+  uint a;
+  int n;
+
+  n = 0;
+  for(a = 0; a < sz; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(pte && (*pte & PTE_P) && (pages[PTE_ADDR(*pte) / PGSIZE].flags & PG_MLOCK))
+      n++;
+  }
+  return n;
+}
+
+// Pin the pages of [addr, addr+len) in memory: bring them in
+// and keep reclaim away from them.  An address space (of size
+// sz) may have at most MLOCKMAX pages pinned.  Threads share
+// one, so the pages are counted and marked together under
+// kmem.lock, and counted again each time one more has to be
+// brought in.  If another thread's mlock() uses up the limit
+// meanwhile, the pages already marked stay pinned.
+int
+mlock(pde_t *pgdir, uint sz, uint addr, uint len)
+{
+  pte_t *pte;
+  uint a, last, swapped;
+  int n;
+
+  last = PGROUNDUP(addr + len);
+  for(;;){
+    acquire(&kmem.lock);
+    n = mlocked(pgdir, sz);
+    for(a = PGROUNDDOWN(addr); a < last; a += PGSIZE){
+      pte = walkpgdir(pgdir, (char*)a, 0);
+      if(pte && (*pte & PTE_U) && ((*pte & PTE_P) == 0 ||
+         (pages[PTE_ADDR(*pte) / PGSIZE].flags & PG_MLOCK) == 0))
+        n++;
+    }
+    if(n > MLOCKMAX){
+      release(&kmem.lock);
+      return -1;
+    }
+    // Mark the resident pages, and find one that isn't.
+    swapped = last;
+    for(a = PGROUNDDOWN(addr); a < last; a += PGSIZE){
+      pte = walkpgdir(pgdir, (char*)a, 0);
+      if(pte == 0 || (*pte & PTE_U) == 0)
+        continue;
+      if(*pte & PTE_P)
+        pages[PTE_ADDR(*pte) / PGSIZE].flags |= PG_MLOCK;
+      else if((*pte & PTE_SWAP) && swapped == last)
+        swapped = a;
+    }
+    release(&kmem.lock);
+    if(swapped == last)
+      return 0;
+    // Marked as soon as it is in, before the next swap-in's
+    // kalloc() can pick it as a victim.
+    if(swap_in_page(pgdir, (char*)swapped, 1) < 0)
+      return -1;
+  }
+}
+
+// Make the pages of [addr, addr+len) reclaimable again.
+int
+munlock(pde_t *pgdir, uint addr, uint len)
+{
+  pte_t *pte;
+  uint a, last;
+
+  last = PGROUNDUP(addr + len);
+  acquire(&kmem.lock);
+  for(a = PGROUNDDOWN(addr); a < last; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(pte && (*pte & PTE_P))
+      pages[PTE_ADDR(*pte) / PGSIZE].flags &= ~PG_MLOCK;
+  }
+  release(&kmem.lock);
+  return 0;
+}
 
+// Keep the page holding user address va of pgdir resident, for a
+// futex waiter keyed by its physical address: bring it in from
+// swap, and keep reclaim away from it until unpinpage().
+// Returns the kernel address of va, or 0.
+char*
+pinpage(pde_t *pgdir, uint va)
+{
+  pte_t *pte;
+  char *mem;
+
+  for(;;){
+    pte = walkpgdir(pgdir, (char*)va, 0);
+    if(pte == 0)
+      return 0;
+    acquire(&kmem.lock);
+    // Checked under the lock; see revokeuvm().
+    if((*pte & PTE_U) == 0){
+      release(&kmem.lock);
+      return 0;
+    }
+    if(*pte & PTE_P){
+      mem = P2V(PTE_ADDR(*pte));
+      pages[V2P(mem) / PGSIZE].npin++;
+      release(&kmem.lock);
+      return mem + va % PGSIZE;
+    }
+    release(&kmem.lock);
+    // Evicted again before we could pin it: try again.
+    if((*pte & PTE_SWAP) == 0 ||
+       swap_in_page(pgdir, (char*)PGROUNDDOWN(va), 1) < 0)
+      return 0;
+  }
+}
+
+// Undo pinpage(); kva is the address it returned.
+void
+unpinpage(char *kva)
+{
+  struct page *page;
+
+  page = &pages[V2P(kva) / PGSIZE];
+  acquire(&kmem.lock);
+  if(page->npin > 0)
+    page->npin--;
+  release(&kmem.lock);
+}
+
+// Get [newsz, oldsz) of pgdir ready for sbrk(-n) to unmap.  Fails
+// if a futex waiter or a system call (maybe in another thread) has
+// any of it pinned; otherwise takes away PTE_U, so that nobody can
+// pin it from now on.  Both under kmem.lock, so that no pin slips
+// in between.
+int
+revokeuvm(pde_t *pgdir, uint oldsz, uint newsz)
+{
+  pte_t *pte;
+  uint a;
+
+  acquire(&kmem.lock);
+  for(a = PGROUNDUP(newsz); a < oldsz; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(pte == 0)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+    else if((*pte & PTE_P) && pages[PTE_ADDR(*pte) / PGSIZE].npin){
+      release(&kmem.lock);
+      return -1;
+    }
+  }
+  for(a = PGROUNDUP(newsz); a < oldsz; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(pte == 0)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+    else
+      *pte &= ~PTE_U;
+  }
+  release(&kmem.lock);
+  return 0;
+}
+
+// Pin the pages of [addr, addr+len) in pgdir as pinpage() does,
+// for a system call to use them through their user addresses.
+// Returns -1, with nothing pinned, if any of them is not mapped.
+int
+pinuvm(pde_t *pgdir, uint addr, uint len)
+{
+  uint a;
+
+  if(len == 0)
+    return 0;
+  for(a = PGROUNDDOWN(addr); a < addr + len; a += PGSIZE){
+    if(pinpage(pgdir, a) == 0){
+      unpinuvm(pgdir, PGROUNDDOWN(addr), a - PGROUNDDOWN(addr));
+      return -1;
+    }
+  }
+  return 0;
+}
+
+// Undo pinuvm().  Pinned pages stay mapped, so the PTEs still
+// lead to them.
+void
+unpinuvm(pde_t *pgdir, uint addr, uint len)
+{
+  pte_t *pte;
+  uint a;
+
+  if(len == 0)
+    return;
+  acquire(&kmem.lock);
+  for(a = PGROUNDDOWN(addr); a < addr + len; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(pte == 0 || (*pte & PTE_P) == 0 ||
+       pages[PTE_ADDR(*pte) / PGSIZE].npin < 1)
+      panic("unpinuvm");
+    pages[PTE_ADDR(*pte) / PGSIZE].npin--;
+  }
+  release(&kmem.lock);
+}
 
 
 void print_num_lru_pages()
@@ -265,6 +656,7 @@ void
 kinit1(void *vstart, void *vend)
 {
   initlock(&kmem.lock, "kmem");
+  initsleeplock(&swaplock, "swap");
   kmem.use_lock = 0;
   freerange(vstart, vend);
 }
@@ -274,7 +666,6 @@ kinit2(void *vstart, void *vend)
 {
   freerange(vstart, vend);
   kmem.use_lock = 1;
-  start_LRU = 1;
 }
 
 void
@@ -295,36 +686,39 @@ kfree(char *v)
 {
   struct run *r;
 
-  // v  ũ(PGSIZE)  ƴϰų, 
-  // v Ŀ  ּ(end) ۰ų, 
+  // v  ũ(PGSIZE)  ƴϰų,
+  // v Ŀ  ּ(end) ۰ų,
   // v  ּҰ PHYSTOP ̻  д
   if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
     panic("kfree");
 
-  //  1 ä ޸ ġ   
+  //  1 ä ޸ ġ   
   memset(v, 1, PGSIZE);
 
   // kmem ü      ȹ
   if(kmem.use_lock)
     acquire(&kmem.lock);
 
-  
+
   // LRU Ʈ ϴ  Ȯ
   struct page *page_to_remove = &pages[V2P(v) / PGSIZE]; //   
 
   //  LRU Ʈ ϴ 
-  if (exist_in_lru(page_to_remove)) {
+  if (page_to_remove->flags & PG_LRU)
     remove_from_lru_list(page_to_remove); // LRU Ʈ  
-    num_lru_pages--; // LRU Ʈ  ŵ  num_lru_pages 
-  }
+  page_to_remove->flags = 0;
+  // A futex waiter may still have it pinned (the range was freed
+  // under it); the next owner must not inherit that pin.
+  page_to_remove->npin = 0;
 
-  
-  // run ü  r v 
+
+  // run ü  r v 
   r = (struct run*)v;
-  
-  // r  freelist տ 
+
+  // r  freelist տ 
   r->next = kmem.freelist;
   kmem.freelist = r;
+  num_free_pages++;
 
   // kmem ü      
   if(kmem.use_lock)
@@ -332,85 +726,110 @@ kfree(char *v)
 }
 
 
-// Allocate one 4096-byte page of physical memory.
-// Returns a pointer that the kernel can use.
-// Returns 0 if the memory cannot be allocated.
+// Reclaim may sleep on swap I/O, which is only allowed
+// in a process that holds no spinlocks.
+static int
+cansleep(void)
+{
+  int ok;
 
+  pushcli();
+  ok = myproc() != 0 && mycpu()->ncli == 1;
+  popcli();
+  return ok;
+}
+
+// Free one page: a page of the buffer cache if it can spare
+// one, since that needs no I/O, or else a user page evicted
+// to the swap area.
+// Returns 1 if a page was freed, -1 if nothing could be evicted.
 int reclaim(void)
 {
-   struct page *victim = find_victim_lru(); // LRU Ʈ victim  ã
-    if (!victim) { // victim  .
-        return -1; // reclaim , -1 ȯ   -> kalloc OOM  ˾Ƽ  ٰ.
+    struct page *victim;
+    int swap_index = -1, n;
+    char *mem;
+    pde_t *pgdir;
+
+    if(bshrink())
+      return 1;
+
+    acquiresleep(&swaplock);
+    acquire(&kmem.lock);
+    for(n = 0; n < 8; n++){
+      victim = find_victim_lru(); // LRU Ʈ victim  ã
+      if (!victim) // victim  .
+        break;
+      if((swap_index = swap_out_page(victim)) >= 0) // victim   ƿ
+        break;
     }
+    pgdir = victim ? victim->pgdir : 0;
+    release(&kmem.lock);
 
-    pte_t *pte = walkpgdir(victim->pgdir, victim->vaddr, 0); // victim  PTE 
-    if (!pte) { // PTE ã   
-        panic("reclaim: PTE not found"); // д ߻
+    if(swap_index < 0){ // reclaim , -1 ȯ   -> kalloc OOM  ˾Ƽ  .
+      releasesleep(&swaplock);
+      return -1;
     }
 
-    swap_out_page(victim); // victim   ƿ
+    // The page is unmapped and off the LRU list, so nobody else
+    // can reach it.  Once other CPUs running in its pgdir (threads
+    // may run in it on several) have flushed their TLBs, nobody
+    // writes it either: write it out and give it back.
+    tlbshootdown(pgdir);
+    mem = P2V((victim - pages) * PGSIZE);
+    swapwrite(mem, swap_index);
+    releasesleep(&swaplock);
+    kfree(mem);
 
     return 1; // reclaim , 1 ȯ
 }
 
+// Allocate one 4096-byte page of physical memory.
+// Returns a pointer that the kernel can use.
+// Returns 0 if the memory cannot be allocated.
 char*
 kalloc(void)
 {
   struct run *r;
 
-try_again:
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
-  r = kmem.freelist;
-  
-  if(!r)  // freelist ִ -> ޸𸮿 ڸ ٸ.
-  {
-    int a = reclaim();
-    if(a==1)    // reclaim 1 ȯߴٸ ==  reclaim.
-    {
-      goto try_again;
-
-    }
-    if(a==-1)   // reclaim -1 ȯߴٸ == reclaim Ͽ. == OOM
-    {
-      cprintf("ERROR : OOM - Out of memory\n");
-      
-      if(kmem.use_lock)
-        release(&kmem.lock);
-
-      return 0; // ̶ kalloc 0 .
-    }
-  }  
-
-  if(r)
-  {         // ׳ freelist   . -> lru  ó ʿ.
-    kmem.freelist = r->next;
-    if(start_LRU)
-    {
-      // lru ߰ϴ 
-      struct page *new_page = &pages[V2P((char*)r) / PGSIZE]; // ο  
-      struct proc *p = myproc(); //  μ 
-
-      //  μ ִ 쿡 LRU Ʈ ߰
-      if (p != NULL) {  
-        new_page->pgdir = p->pgdir; //  μ  丮 
-        new_page->vaddr = (char*)r; // ο   ּ 
-
-        // user page Ȯ
-        if (is_user_page(new_page->pgdir, new_page->vaddr)) { 
-          add_to_lru_list(new_page); // LRU Ʈ  ߰
-          num_lru_pages++;  // LRU Ʈ  ߰  count_LRU 
-        }
-      }
-
-      // lru ߰ϴ ڵ 
+  for(;;){
+    if(kmem.use_lock)
+      acquire(&kmem.lock);
+    r = kmem.freelist;
+    if(r){
+      kmem.freelist = r->next;
+      num_free_pages--;
     }
-
+    if(kmem.use_lock)
+      release(&kmem.lock);
+
+    // freelist ִ -> ޸𸮿 ڸ ٸ.
+    if(r || !kmem.use_lock || !cansleep())
+      break;
+    if(reclaim() < 0)   // reclaim -1 ȯߴٸ == reclaim Ͽ. == OOM
+      break;
   }
 
-  if(kmem.use_lock)
-    release(&kmem.lock);
+  if(r == 0)
+    cprintf("ERROR : OOM - Out of memory\n");
   return (char*)r;
 }
 
+// Allocate a page for a cache that can do without: only if
+// more than BCACHEFREE pages would be left free, and never by
+// reclaiming.  Returns 0 if memory is not that plentiful.
+char*
+kallocspare(void)
+{
+  struct run *r;
 
+  if(!kmem.use_lock)
+    return 0;
+  acquire(&kmem.lock);
+  r = 0;
+  if(num_free_pages > BCACHEFREE && (r = kmem.freelist) != 0){
+    kmem.freelist = r->next;
+    num_free_pages--;
+  }
+  release(&kmem.lock);
+  return (char*)r;
+}
@@ -42,6 +42,7 @@
 #define TDCR    (0x03E0/4)   // Timer Divide Configuration
 
 volatile uint *lapic;  // Initialized in mp.c
+uint lapicjiffy = 1000000;  // Timer counts per jiffy; see timerinit()
 
 //PAGEBREAK!
 static void
@@ -60,13 +61,13 @@ lapicinit(void)
   // Enable local APIC; set spurious interrupt vector.
   lapicw(SVR, ENABLE | (T_IRQ0 + IRQ_SPURIOUS));
 
-  // The timer repeatedly counts down at bus frequency
-  // from lapic[TICR] and then issues an interrupt.
-  // If xv6 cared more about precise timekeeping,
-  // TICR would be calibrated using an external time source.
+  // The timer counts down once at bus frequency from
+  // lapic[TICR] and then issues an interrupt; timerarm()
+  // sets it going again for the next event.  timerinit()
+  // calibrates the counts per jiffy against the PIT.
   lapicw(TDCR, X1);
-  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-  lapicw(TICR, 10000000);
+  lapicw(TIMER, T_IRQ0 + IRQ_TIMER);
+  lapicw(TICR, lapicjiffy);
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
@@ -105,6 +106,24 @@ lapicid(void)
   return lapic[ID] >> 24;
 }
 
+// Restart the timer counting down from count;
+// 0 stops it.
+void
+lapictimer(uint count)
+{
+  if(lapic)
+    lapicw(TICR, count);
+}
+
+// Current count of the timer.
+uint
+lapiccount(void)
+{
+  if(!lapic)
+    return 0;
+  return lapic[TCCR];
+}
+
 // Acknowledge interrupt.
 void
 lapiceoi(void)
@@ -120,6 +139,18 @@ microdelay(int us)
 {
 }
 
+// Send interrupt vector to the CPU with the given APIC ID.
+// Interrupts must be off, so that nothing else on this CPU
+// uses the ICR meanwhile.
+void
+lapicipi(int apicid, int vector)
+{
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | ASSERT | vector);
+  while(lapic[ICRLO] & DELIVS)
+    ;
+}
+
 #define CMOS_PORT    0x70
 #define CMOS_RETURN  0x71
 
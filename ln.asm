@@ -0,0 +1,1559 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  if(argc != 3){
+   f:	83 39 03             	cmpl   $0x3,(%ecx)
+{
+  12:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc != 3){
+  15:	74 13                	je     2a <main+0x2a>
+    printf(2, "Usage: ln old new\n");
+  17:	52                   	push   %edx
+  18:	52                   	push   %edx
+  19:	68 28 0a 00 00       	push   $0xa28
+  1e:	6a 02                	push   $0x2
+  20:	e8 db 06 00 00       	call   700 <printf>
+    exit();
+  25:	e8 52 04 00 00       	call   47c <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  2a:	50                   	push   %eax
+  2b:	50                   	push   %eax
+  2c:	ff 73 08             	push   0x8(%ebx)
+  2f:	ff 73 04             	push   0x4(%ebx)
+  32:	e8 c9 04 00 00       	call   500 <link>
+  37:	83 c4 10             	add    $0x10,%esp
+  3a:	85 c0                	test   %eax,%eax
+  3c:	78 05                	js     43 <main+0x43>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  exit();
+  3e:	e8 39 04 00 00       	call   47c <exit>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  43:	ff 73 08             	push   0x8(%ebx)
+  46:	ff 73 04             	push   0x4(%ebx)
+  49:	68 3b 0a 00 00       	push   $0xa3b
+  4e:	6a 02                	push   $0x2
+  50:	e8 ab 06 00 00       	call   700 <printf>
+  55:	83 c4 10             	add    $0x10,%esp
+  58:	eb e4                	jmp    3e <main+0x3e>
+  5a:	66 90                	xchg   %ax,%ax
+  5c:	66 90                	xchg   %ax,%ax
+  5e:	66 90                	xchg   %ax,%ax
+
+00000060 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  60:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  61:	31 c0                	xor    %eax,%eax
+{
+  63:	89 e5                	mov    %esp,%ebp
+  65:	53                   	push   %ebx
+  66:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  70:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  74:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  77:	83 c0 01             	add    $0x1,%eax
+  7a:	84 d2                	test   %dl,%dl
+  7c:	75 f2                	jne    70 <strcpy+0x10>
+    ;
+  return os;
+}
+  7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  81:	89 c8                	mov    %ecx,%eax
+  83:	c9                   	leave
+  84:	c3                   	ret
+  85:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000090 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	53                   	push   %ebx
+  94:	8b 55 08             	mov    0x8(%ebp),%edx
+  97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  9a:	0f b6 02             	movzbl (%edx),%eax
+  9d:	84 c0                	test   %al,%al
+  9f:	75 17                	jne    b8 <strcmp+0x28>
+  a1:	eb 3a                	jmp    dd <strcmp+0x4d>
+  a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  a7:	90                   	nop
+  a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  ac:	83 c2 01             	add    $0x1,%edx
+  af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  b2:	84 c0                	test   %al,%al
+  b4:	74 1a                	je     d0 <strcmp+0x40>
+    p++, q++;
+  b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  b8:	0f b6 19             	movzbl (%ecx),%ebx
+  bb:	38 c3                	cmp    %al,%bl
+  bd:	74 e9                	je     a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  bf:	29 d8                	sub    %ebx,%eax
+}
+  c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c4:	c9                   	leave
+  c5:	c3                   	ret
+  c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  d4:	31 c0                	xor    %eax,%eax
+  d6:	29 d8                	sub    %ebx,%eax
+}
+  d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  db:	c9                   	leave
+  dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  dd:	0f b6 19             	movzbl (%ecx),%ebx
+  e0:	31 c0                	xor    %eax,%eax
+  e2:	eb db                	jmp    bf <strcmp+0x2f>
+  e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ef:	90                   	nop
+
+000000f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  f6:	80 3a 00             	cmpb   $0x0,(%edx)
+  f9:	74 15                	je     110 <strlen+0x20>
+  fb:	31 c0                	xor    %eax,%eax
+  fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 100:	83 c0 01             	add    $0x1,%eax
+ 103:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 107:	89 c1                	mov    %eax,%ecx
+ 109:	75 f5                	jne    100 <strlen+0x10>
+    ;
+  return n;
+}
+ 10b:	89 c8                	mov    %ecx,%eax
+ 10d:	5d                   	pop    %ebp
+ 10e:	c3                   	ret
+ 10f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 110:	31 c9                	xor    %ecx,%ecx
+}
+ 112:	5d                   	pop    %ebp
+ 113:	89 c8                	mov    %ecx,%eax
+ 115:	c3                   	ret
+ 116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000120 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	57                   	push   %edi
+ 124:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 127:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 12a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 12d:	89 d7                	mov    %edx,%edi
+ 12f:	fc                   	cld
+ 130:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 132:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 135:	89 d0                	mov    %edx,%eax
+ 137:	c9                   	leave
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	8b 45 08             	mov    0x8(%ebp),%eax
+ 146:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 14a:	0f b6 10             	movzbl (%eax),%edx
+ 14d:	84 d2                	test   %dl,%dl
+ 14f:	75 12                	jne    163 <strchr+0x23>
+ 151:	eb 1d                	jmp    170 <strchr+0x30>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 15c:	83 c0 01             	add    $0x1,%eax
+ 15f:	84 d2                	test   %dl,%dl
+ 161:	74 0d                	je     170 <strchr+0x30>
+    if(*s == c)
+ 163:	38 d1                	cmp    %dl,%cl
+ 165:	75 f1                	jne    158 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 167:	5d                   	pop    %ebp
+ 168:	c3                   	ret
+ 169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 170:	31 c0                	xor    %eax,%eax
+}
+ 172:	5d                   	pop    %ebp
+ 173:	c3                   	ret
+ 174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+
+00000180 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 185:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 188:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 189:	31 db                	xor    %ebx,%ebx
+{
+ 18b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 18e:	eb 27                	jmp    1b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 190:	83 ec 04             	sub    $0x4,%esp
+ 193:	6a 01                	push   $0x1
+ 195:	56                   	push   %esi
+ 196:	6a 00                	push   $0x0
+ 198:	e8 00 03 00 00       	call   49d <read>
+    if(cc < 1)
+ 19d:	83 c4 10             	add    $0x10,%esp
+ 1a0:	85 c0                	test   %eax,%eax
+ 1a2:	7e 1d                	jle    1c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1af:	3c 0a                	cmp    $0xa,%al
+ 1b1:	74 10                	je     1c3 <gets+0x43>
+ 1b3:	3c 0d                	cmp    $0xd,%al
+ 1b5:	74 0c                	je     1c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1b7:	89 df                	mov    %ebx,%edi
+ 1b9:	83 c3 01             	add    $0x1,%ebx
+ 1bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1bf:	7c cf                	jl     190 <gets+0x10>
+ 1c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1cd:	5b                   	pop    %ebx
+ 1ce:	5e                   	pop    %esi
+ 1cf:	5f                   	pop    %edi
+ 1d0:	5d                   	pop    %ebp
+ 1d1:	c3                   	ret
+ 1d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	56                   	push   %esi
+ 1e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1e5:	83 ec 08             	sub    $0x8,%esp
+ 1e8:	6a 00                	push   $0x0
+ 1ea:	ff 75 08             	push   0x8(%ebp)
+ 1ed:	e8 e2 02 00 00       	call   4d4 <open>
+  if(fd < 0)
+ 1f2:	83 c4 10             	add    $0x10,%esp
+ 1f5:	85 c0                	test   %eax,%eax
+ 1f7:	78 27                	js     220 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1f9:	83 ec 08             	sub    $0x8,%esp
+ 1fc:	ff 75 0c             	push   0xc(%ebp)
+ 1ff:	89 c3                	mov    %eax,%ebx
+ 201:	50                   	push   %eax
+ 202:	e8 ee 02 00 00       	call   4f5 <fstat>
+  close(fd);
+ 207:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 20a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 20c:	e8 a2 02 00 00       	call   4b3 <close>
+  return r;
+ 211:	83 c4 10             	add    $0x10,%esp
+}
+ 214:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 217:	89 f0                	mov    %esi,%eax
+ 219:	5b                   	pop    %ebx
+ 21a:	5e                   	pop    %esi
+ 21b:	5d                   	pop    %ebp
+ 21c:	c3                   	ret
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 220:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 225:	eb ed                	jmp    214 <stat+0x34>
+ 227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22e:	66 90                	xchg   %ax,%ax
+
+00000230 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	53                   	push   %ebx
+ 234:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 237:	0f be 02             	movsbl (%edx),%eax
+ 23a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 23d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 240:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 245:	77 1e                	ja     265 <atoi+0x35>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 250:	83 c2 01             	add    $0x1,%edx
+ 253:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 256:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 25a:	0f be 02             	movsbl (%edx),%eax
+ 25d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 260:	80 fb 09             	cmp    $0x9,%bl
+ 263:	76 eb                	jbe    250 <atoi+0x20>
+  return n;
+}
+ 265:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 268:	89 c8                	mov    %ecx,%eax
+ 26a:	c9                   	leave
+ 26b:	c3                   	ret
+ 26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	57                   	push   %edi
+ 274:	56                   	push   %esi
+ 275:	8b 45 10             	mov    0x10(%ebp),%eax
+ 278:	8b 55 08             	mov    0x8(%ebp),%edx
+ 27b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 27e:	85 c0                	test   %eax,%eax
+ 280:	7e 13                	jle    295 <memmove+0x25>
+ 282:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 284:	89 d7                	mov    %edx,%edi
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 290:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 291:	39 f8                	cmp    %edi,%eax
+ 293:	75 fb                	jne    290 <memmove+0x20>
+  return vdst;
+}
+ 295:	5e                   	pop    %esi
+ 296:	89 d0                	mov    %edx,%eax
+ 298:	5f                   	pop    %edi
+ 299:	5d                   	pop    %ebp
+ 29a:	c3                   	ret
+ 29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+
+000002a0 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 2a0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 2a5:	85 c0                	test   %eax,%eax
+ 2a7:	74 07                	je     2b0 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 2a9:	c3                   	ret
+ 2aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 2b0:	e9 77 02 00 00       	jmp    52c <sysgetpid>
+ 2b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002c0 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 2c0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 2c5:	c3                   	ret
+ 2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002d0 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 2d0:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 2d1:	31 d2                	xor    %edx,%edx
+ 2d3:	89 e5                	mov    %esp,%ebp
+ 2d5:	53                   	push   %ebx
+ 2d6:	83 ec 04             	sub    $0x4,%esp
+ 2d9:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 2dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 2df:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 2e2:	85 c9                	test   %ecx,%ecx
+ 2e4:	7e 08                	jle    2ee <cyclereport+0x1e>
+ 2e6:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 2e8:	89 d8                	mov    %ebx,%eax
+ 2ea:	f7 f1                	div    %ecx
+ 2ec:	89 c2                	mov    %eax,%edx
+ 2ee:	83 ec 08             	sub    $0x8,%esp
+ 2f1:	52                   	push   %edx
+ 2f2:	ff 75 0c             	push   0xc(%ebp)
+ 2f5:	51                   	push   %ecx
+ 2f6:	ff 75 08             	push   0x8(%ebp)
+ 2f9:	68 4f 0a 00 00       	push   $0xa4f
+ 2fe:	6a 01                	push   $0x1
+ 300:	e8 fb 03 00 00       	call   700 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 305:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 308:	83 c4 20             	add    $0x20,%esp
+ 30b:	c9                   	leave
+ 30c:	c3                   	ret
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000310 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 313:	8b 45 08             	mov    0x8(%ebp),%eax
+ 316:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 31c:	5d                   	pop    %ebp
+ 31d:	c3                   	ret
+ 31e:	66 90                	xchg   %ax,%ax
+
+00000320 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 320:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 321:	31 c0                	xor    %eax,%eax
+ 323:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 328:	89 e5                	mov    %esp,%ebp
+ 32a:	56                   	push   %esi
+ 32b:	53                   	push   %ebx
+ 32c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 32f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 333:	85 c0                	test   %eax,%eax
+ 335:	74 30                	je     367 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 337:	83 f8 02             	cmp    $0x2,%eax
+ 33a:	74 0c                	je     348 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 33c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 341:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 344:	85 c0                	test   %eax,%eax
+ 346:	74 1f                	je     367 <mutex_lock+0x47>
+ 348:	be 02 00 00 00       	mov    $0x2,%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 350:	83 ec 08             	sub    $0x8,%esp
+ 353:	6a 02                	push   $0x2
+ 355:	53                   	push   %ebx
+ 356:	e8 8c 02 00 00       	call   5e7 <futex_wait>
+ 35b:	89 f0                	mov    %esi,%eax
+ 35d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 360:	83 c4 10             	add    $0x10,%esp
+ 363:	85 c0                	test   %eax,%eax
+ 365:	75 e9                	jne    350 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 367:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 36a:	5b                   	pop    %ebx
+ 36b:	5e                   	pop    %esi
+ 36c:	5d                   	pop    %ebp
+ 36d:	c3                   	ret
+ 36e:	66 90                	xchg   %ax,%ax
+
+00000370 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	83 ec 08             	sub    $0x8,%esp
+ 376:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 379:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 37d:	75 09                	jne    388 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 37f:	c9                   	leave
+ 380:	c3                   	ret
+ 381:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 388:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 38b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 391:	6a 01                	push   $0x1
+ 393:	50                   	push   %eax
+ 394:	e8 59 02 00 00       	call   5f2 <futex_wake>
+ 399:	83 c4 10             	add    $0x10,%esp
+}
+ 39c:	c9                   	leave
+ 39d:	c3                   	ret
+ 39e:	66 90                	xchg   %ax,%ax
+
+000003a0 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 3a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3ac:	5d                   	pop    %ebp
+ 3ad:	c3                   	ret
+ 3ae:	66 90                	xchg   %ax,%ax
+
+000003b0 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	57                   	push   %edi
+ 3b4:	56                   	push   %esi
+ 3b5:	53                   	push   %ebx
+ 3b6:	83 ec 0c             	sub    $0xc,%esp
+ 3b9:	8b 75 08             	mov    0x8(%ebp),%esi
+ 3bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 3bf:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 3c1:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 3c5:	75 21                	jne    3e8 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 3c7:	83 ec 08             	sub    $0x8,%esp
+ 3ca:	57                   	push   %edi
+ 3cb:	56                   	push   %esi
+ 3cc:	e8 16 02 00 00       	call   5e7 <futex_wait>
+  mutex_lock(m);
+ 3d1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 3d4:	83 c4 10             	add    $0x10,%esp
+}
+ 3d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3da:	5b                   	pop    %ebx
+ 3db:	5e                   	pop    %esi
+ 3dc:	5f                   	pop    %edi
+ 3dd:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 3de:	e9 3d ff ff ff       	jmp    320 <mutex_lock>
+ 3e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3e7:	90                   	nop
+    futex_wake(&m->v, 1);
+ 3e8:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 3eb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 3f1:	6a 01                	push   $0x1
+ 3f3:	53                   	push   %ebx
+ 3f4:	e8 f9 01 00 00       	call   5f2 <futex_wake>
+ 3f9:	83 c4 10             	add    $0x10,%esp
+ 3fc:	eb c9                	jmp    3c7 <cond_wait+0x17>
+ 3fe:	66 90                	xchg   %ax,%ax
+
+00000400 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	83 ec 10             	sub    $0x10,%esp
+ 406:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 409:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 40d:	6a 01                	push   $0x1
+ 40f:	50                   	push   %eax
+ 410:	e8 dd 01 00 00       	call   5f2 <futex_wake>
+}
+ 415:	83 c4 10             	add    $0x10,%esp
+ 418:	c9                   	leave
+ 419:	c3                   	ret
+ 41a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000420 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	83 ec 10             	sub    $0x10,%esp
+ 426:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 429:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 42d:	68 ff ff ff 7f       	push   $0x7fffffff
+ 432:	50                   	push   %eax
+ 433:	e8 ba 01 00 00       	call   5f2 <futex_wake>
+}
+ 438:	83 c4 10             	add    $0x10,%esp
+ 43b:	c9                   	leave
+ 43c:	c3                   	ret
+
+0000043d <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 43d:	50                   	push   %eax
+  pushl %ebx
+ 43e:	53                   	push   %ebx
+  movl $1, %eax
+ 43f:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 444:	0f a2                	cpuid
+  popl %ebx
+ 446:	5b                   	pop    %ebx
+  popl %eax
+ 447:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 448:	c7 05 b8 0e 00 00 6e 	movl   $0x46e,0xeb8
+ 44f:	04 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 452:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 458:	74 14                	je     46e <sysint>
+  movl $sysfast, syscallvec
+ 45a:	c7 05 b8 0e 00 00 64 	movl   $0x464,0xeb8
+ 461:	04 00 00 
+
+00000464 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 464:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 466:	ba 6d 04 00 00       	mov    $0x46d,%edx
+  sysenter
+ 46b:	0f 34                	sysenter
+1:
+  ret
+ 46d:	c3                   	ret
+
+0000046e <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 46e:	cd 40                	int    $0x40
+  ret
+ 470:	c3                   	ret
+
+00000471 <fork>:
+
+SYSCALL(fork)
+ 471:	b8 01 00 00 00       	mov    $0x1,%eax
+ 476:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+0000047c <exit>:
+SYSCALL(exit)
+ 47c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 481:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+00000487 <wait>:
+SYSCALL(wait)
+ 487:	b8 03 00 00 00       	mov    $0x3,%eax
+ 48c:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+00000492 <pipe>:
+SYSCALL(pipe)
+ 492:	b8 04 00 00 00       	mov    $0x4,%eax
+ 497:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+0000049d <read>:
+SYSCALL(read)
+ 49d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4a2:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+000004a8 <write>:
+SYSCALL(write)
+ 4a8:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4ad:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+000004b3 <close>:
+SYSCALL(close)
+ 4b3:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4b8:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+000004be <kill>:
+SYSCALL(kill)
+ 4be:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4c3:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+000004c9 <exec>:
+SYSCALL(exec)
+ 4c9:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4ce:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+000004d4 <open>:
+SYSCALL(open)
+ 4d4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4d9:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+000004df <mknod>:
+SYSCALL(mknod)
+ 4df:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4e4:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+000004ea <unlink>:
+SYSCALL(unlink)
+ 4ea:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4ef:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+000004f5 <fstat>:
+SYSCALL(fstat)
+ 4f5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4fa:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+00000500 <link>:
+SYSCALL(link)
+ 500:	b8 13 00 00 00       	mov    $0x13,%eax
+ 505:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+0000050b <mkdir>:
+SYSCALL(mkdir)
+ 50b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 510:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+00000516 <chdir>:
+SYSCALL(chdir)
+ 516:	b8 09 00 00 00       	mov    $0x9,%eax
+ 51b:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+00000521 <dup>:
+SYSCALL(dup)
+ 521:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 526:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+0000052c <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 52c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 531:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+00000537 <sbrk>:
+SYSCALL(sbrk)
+ 537:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 53c:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+00000542 <sleep>:
+SYSCALL(sleep)
+ 542:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 547:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+0000054d <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 54d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 552:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+00000558 <swapread>:
+SYSCALL(swapread)
+ 558:	b8 16 00 00 00       	mov    $0x16,%eax
+ 55d:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+00000563 <swapwrite>:
+SYSCALL(swapwrite)
+ 563:	b8 17 00 00 00       	mov    $0x17,%eax
+ 568:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+0000056e <swapstat>:
+SYSCALL(swapstat)
+ 56e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 573:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+00000579 <madvise>:
+SYSCALL(madvise)
+ 579:	b8 19 00 00 00       	mov    $0x19,%eax
+ 57e:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+00000584 <mlock>:
+SYSCALL(mlock)
+ 584:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 589:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+0000058f <munlock>:
+SYSCALL(munlock)
+ 58f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 594:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+0000059a <membench>:
+SYSCALL(membench)
+ 59a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 59f:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+000005a5 <nice>:
+SYSCALL(nice)
+ 5a5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5aa:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+000005b0 <setpriority>:
+SYSCALL(setpriority)
+ 5b0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5b5:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+000005bb <usleep>:
+SYSCALL(usleep)
+ 5bb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5c0:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+000005c6 <cpustat>:
+SYSCALL(cpustat)
+ 5c6:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5cb:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+000005d1 <clone>:
+SYSCALL(clone)
+ 5d1:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5d6:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+000005dc <join>:
+SYSCALL(join)
+ 5dc:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5e1:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+000005e7 <futex_wait>:
+SYSCALL(futex_wait)
+ 5e7:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5ec:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+000005f2 <futex_wake>:
+SYSCALL(futex_wake)
+ 5f2:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5f7:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+000005fd <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 5fd:	b8 25 00 00 00       	mov    $0x25,%eax
+ 602:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+00000608 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 608:	b8 26 00 00 00       	mov    $0x26,%eax
+ 60d:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+00000613 <getcpu>:
+SYSCALL(getcpu)
+ 613:	b8 27 00 00 00       	mov    $0x27,%eax
+ 618:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+0000061e <migrations>:
+SYSCALL(migrations)
+ 61e:	b8 28 00 00 00       	mov    $0x28,%eax
+ 623:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+00000629 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 629:	b8 29 00 00 00       	mov    $0x29,%eax
+ 62e:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+00000634 <lockstat>:
+SYSCALL(lockstat)
+ 634:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 639:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+0000063f <lockprof>:
+SYSCALL(lockprof)
+ 63f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 644:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+
+0000064a <bcachestat>:
+SYSCALL(bcachestat)
+ 64a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 64f:	ff 25 b8 0e 00 00    	jmp    *0xeb8
+ 655:	66 90                	xchg   %ax,%ax
+ 657:	66 90                	xchg   %ax,%ax
+ 659:	66 90                	xchg   %ax,%ax
+ 65b:	66 90                	xchg   %ax,%ax
+ 65d:	66 90                	xchg   %ax,%ax
+ 65f:	90                   	nop
+
+00000660 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	57                   	push   %edi
+ 664:	56                   	push   %esi
+ 665:	53                   	push   %ebx
+ 666:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 668:	89 d1                	mov    %edx,%ecx
+{
+ 66a:	83 ec 3c             	sub    $0x3c,%esp
+ 66d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 670:	85 d2                	test   %edx,%edx
+ 672:	0f 89 80 00 00 00    	jns    6f8 <printint+0x98>
+ 678:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 67c:	74 7a                	je     6f8 <printint+0x98>
+    x = -xx;
+ 67e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 680:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 685:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 688:	31 f6                	xor    %esi,%esi
+ 68a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 690:	89 c8                	mov    %ecx,%eax
+ 692:	31 d2                	xor    %edx,%edx
+ 694:	89 f7                	mov    %esi,%edi
+ 696:	f7 f3                	div    %ebx
+ 698:	8d 76 01             	lea    0x1(%esi),%esi
+ 69b:	0f b6 92 cc 0a 00 00 	movzbl 0xacc(%edx),%edx
+ 6a2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 6a6:	89 ca                	mov    %ecx,%edx
+ 6a8:	89 c1                	mov    %eax,%ecx
+ 6aa:	39 da                	cmp    %ebx,%edx
+ 6ac:	73 e2                	jae    690 <printint+0x30>
+  if(neg)
+ 6ae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 6b1:	85 c0                	test   %eax,%eax
+ 6b3:	74 07                	je     6bc <printint+0x5c>
+    buf[i++] = '-';
+ 6b5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 6ba:	89 f7                	mov    %esi,%edi
+ 6bc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 6bf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 6c2:	01 df                	add    %ebx,%edi
+ 6c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 6c8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 6cb:	83 ec 04             	sub    $0x4,%esp
+ 6ce:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 6d1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 6d4:	6a 01                	push   $0x1
+ 6d6:	50                   	push   %eax
+ 6d7:	56                   	push   %esi
+ 6d8:	e8 cb fd ff ff       	call   4a8 <write>
+  while(--i >= 0)
+ 6dd:	89 f8                	mov    %edi,%eax
+ 6df:	83 c4 10             	add    $0x10,%esp
+ 6e2:	83 ef 01             	sub    $0x1,%edi
+ 6e5:	39 d8                	cmp    %ebx,%eax
+ 6e7:	75 df                	jne    6c8 <printint+0x68>
+}
+ 6e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6ec:	5b                   	pop    %ebx
+ 6ed:	5e                   	pop    %esi
+ 6ee:	5f                   	pop    %edi
+ 6ef:	5d                   	pop    %ebp
+ 6f0:	c3                   	ret
+ 6f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6f8:	31 c0                	xor    %eax,%eax
+ 6fa:	eb 89                	jmp    685 <printint+0x25>
+ 6fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000700 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 700:	55                   	push   %ebp
+ 701:	89 e5                	mov    %esp,%ebp
+ 703:	57                   	push   %edi
+ 704:	56                   	push   %esi
+ 705:	53                   	push   %ebx
+ 706:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 709:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 70c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 70f:	0f b6 1e             	movzbl (%esi),%ebx
+ 712:	83 c6 01             	add    $0x1,%esi
+ 715:	84 db                	test   %bl,%bl
+ 717:	74 67                	je     780 <printf+0x80>
+ 719:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 71c:	31 d2                	xor    %edx,%edx
+ 71e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 721:	eb 34                	jmp    757 <printf+0x57>
+ 723:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 727:	90                   	nop
+ 728:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 72b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 730:	83 f8 25             	cmp    $0x25,%eax
+ 733:	74 18                	je     74d <printf+0x4d>
+  write(fd, &c, 1);
+ 735:	83 ec 04             	sub    $0x4,%esp
+ 738:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 73b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 73e:	6a 01                	push   $0x1
+ 740:	50                   	push   %eax
+ 741:	57                   	push   %edi
+ 742:	e8 61 fd ff ff       	call   4a8 <write>
+ 747:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 74a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 74d:	0f b6 1e             	movzbl (%esi),%ebx
+ 750:	83 c6 01             	add    $0x1,%esi
+ 753:	84 db                	test   %bl,%bl
+ 755:	74 29                	je     780 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 757:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 75a:	85 d2                	test   %edx,%edx
+ 75c:	74 ca                	je     728 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 75e:	83 fa 25             	cmp    $0x25,%edx
+ 761:	75 ea                	jne    74d <printf+0x4d>
+      if(c == 'd'){
+ 763:	83 f8 25             	cmp    $0x25,%eax
+ 766:	0f 84 24 01 00 00    	je     890 <printf+0x190>
+ 76c:	83 e8 63             	sub    $0x63,%eax
+ 76f:	83 f8 15             	cmp    $0x15,%eax
+ 772:	77 1c                	ja     790 <printf+0x90>
+ 774:	ff 24 85 74 0a 00 00 	jmp    *0xa74(,%eax,4)
+ 77b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 77f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 780:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 783:	5b                   	pop    %ebx
+ 784:	5e                   	pop    %esi
+ 785:	5f                   	pop    %edi
+ 786:	5d                   	pop    %ebp
+ 787:	c3                   	ret
+ 788:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78f:	90                   	nop
+  write(fd, &c, 1);
+ 790:	83 ec 04             	sub    $0x4,%esp
+ 793:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 796:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 79a:	6a 01                	push   $0x1
+ 79c:	52                   	push   %edx
+ 79d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 7a0:	57                   	push   %edi
+ 7a1:	e8 02 fd ff ff       	call   4a8 <write>
+ 7a6:	83 c4 0c             	add    $0xc,%esp
+ 7a9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7ac:	6a 01                	push   $0x1
+ 7ae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 7b1:	52                   	push   %edx
+ 7b2:	57                   	push   %edi
+ 7b3:	e8 f0 fc ff ff       	call   4a8 <write>
+        putc(fd, c);
+ 7b8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7bb:	31 d2                	xor    %edx,%edx
+ 7bd:	eb 8e                	jmp    74d <printf+0x4d>
+ 7bf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 7c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7c3:	83 ec 0c             	sub    $0xc,%esp
+ 7c6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7cb:	8b 13                	mov    (%ebx),%edx
+ 7cd:	6a 00                	push   $0x0
+ 7cf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 7d1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 7d4:	e8 87 fe ff ff       	call   660 <printint>
+        ap++;
+ 7d9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7dc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7df:	31 d2                	xor    %edx,%edx
+ 7e1:	e9 67 ff ff ff       	jmp    74d <printf+0x4d>
+ 7e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7f0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7f3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7f5:	83 c0 04             	add    $0x4,%eax
+ 7f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7fb:	85 db                	test   %ebx,%ebx
+ 7fd:	0f 84 9d 00 00 00    	je     8a0 <printf+0x1a0>
+        while(*s != 0){
+ 803:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 806:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 808:	84 c0                	test   %al,%al
+ 80a:	0f 84 3d ff ff ff    	je     74d <printf+0x4d>
+ 810:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 813:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 816:	89 de                	mov    %ebx,%esi
+ 818:	89 d3                	mov    %edx,%ebx
+ 81a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 820:	83 ec 04             	sub    $0x4,%esp
+ 823:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 826:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 829:	6a 01                	push   $0x1
+ 82b:	53                   	push   %ebx
+ 82c:	57                   	push   %edi
+ 82d:	e8 76 fc ff ff       	call   4a8 <write>
+        while(*s != 0){
+ 832:	0f b6 06             	movzbl (%esi),%eax
+ 835:	83 c4 10             	add    $0x10,%esp
+ 838:	84 c0                	test   %al,%al
+ 83a:	75 e4                	jne    820 <printf+0x120>
+      state = 0;
+ 83c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 83f:	31 d2                	xor    %edx,%edx
+ 841:	e9 07 ff ff ff       	jmp    74d <printf+0x4d>
+ 846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 850:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 853:	83 ec 0c             	sub    $0xc,%esp
+ 856:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 85b:	8b 13                	mov    (%ebx),%edx
+ 85d:	6a 01                	push   $0x1
+ 85f:	e9 6b ff ff ff       	jmp    7cf <printf+0xcf>
+ 864:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 868:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 86b:	83 ec 04             	sub    $0x4,%esp
+ 86e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 871:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 873:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 876:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 879:	6a 01                	push   $0x1
+ 87b:	52                   	push   %edx
+ 87c:	57                   	push   %edi
+ 87d:	e8 26 fc ff ff       	call   4a8 <write>
+        ap++;
+ 882:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 885:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 888:	31 d2                	xor    %edx,%edx
+ 88a:	e9 be fe ff ff       	jmp    74d <printf+0x4d>
+ 88f:	90                   	nop
+  write(fd, &c, 1);
+ 890:	83 ec 04             	sub    $0x4,%esp
+ 893:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 896:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 899:	6a 01                	push   $0x1
+ 89b:	e9 11 ff ff ff       	jmp    7b1 <printf+0xb1>
+ 8a0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 8a5:	bb 6a 0a 00 00       	mov    $0xa6a,%ebx
+ 8aa:	e9 61 ff ff ff       	jmp    810 <printf+0x110>
+ 8af:	90                   	nop
+
+000008b0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8b0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8b1:	a1 bc 0e 00 00       	mov    0xebc,%eax
+{
+ 8b6:	89 e5                	mov    %esp,%ebp
+ 8b8:	57                   	push   %edi
+ 8b9:	56                   	push   %esi
+ 8ba:	53                   	push   %ebx
+ 8bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 8be:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8c8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8ca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8cc:	39 ca                	cmp    %ecx,%edx
+ 8ce:	73 30                	jae    900 <free+0x50>
+ 8d0:	39 c1                	cmp    %eax,%ecx
+ 8d2:	72 04                	jb     8d8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8d4:	39 c2                	cmp    %eax,%edx
+ 8d6:	72 f0                	jb     8c8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8d8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 8db:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 8de:	39 f8                	cmp    %edi,%eax
+ 8e0:	74 2e                	je     910 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8e2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8e5:	8b 42 04             	mov    0x4(%edx),%eax
+ 8e8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8eb:	39 f1                	cmp    %esi,%ecx
+ 8ed:	74 38                	je     927 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8ef:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8f1:	5b                   	pop    %ebx
+  freep = p;
+ 8f2:	89 15 bc 0e 00 00    	mov    %edx,0xebc
+}
+ 8f8:	5e                   	pop    %esi
+ 8f9:	5f                   	pop    %edi
+ 8fa:	5d                   	pop    %ebp
+ 8fb:	c3                   	ret
+ 8fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 900:	39 c1                	cmp    %eax,%ecx
+ 902:	72 d0                	jb     8d4 <free+0x24>
+ 904:	eb c2                	jmp    8c8 <free+0x18>
+ 906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 910:	03 70 04             	add    0x4(%eax),%esi
+ 913:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 916:	8b 02                	mov    (%edx),%eax
+ 918:	8b 00                	mov    (%eax),%eax
+ 91a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 91d:	8b 42 04             	mov    0x4(%edx),%eax
+ 920:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 923:	39 f1                	cmp    %esi,%ecx
+ 925:	75 c8                	jne    8ef <free+0x3f>
+    p->s.size += bp->s.size;
+ 927:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 92a:	89 15 bc 0e 00 00    	mov    %edx,0xebc
+    p->s.size += bp->s.size;
+ 930:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 933:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 936:	89 0a                	mov    %ecx,(%edx)
+}
+ 938:	5b                   	pop    %ebx
+ 939:	5e                   	pop    %esi
+ 93a:	5f                   	pop    %edi
+ 93b:	5d                   	pop    %ebp
+ 93c:	c3                   	ret
+ 93d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000940 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 940:	55                   	push   %ebp
+ 941:	89 e5                	mov    %esp,%ebp
+ 943:	57                   	push   %edi
+ 944:	56                   	push   %esi
+ 945:	53                   	push   %ebx
+ 946:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 949:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 94c:	8b 15 bc 0e 00 00    	mov    0xebc,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 952:	8d 78 07             	lea    0x7(%eax),%edi
+ 955:	c1 ef 03             	shr    $0x3,%edi
+ 958:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 95b:	85 d2                	test   %edx,%edx
+ 95d:	0f 84 8d 00 00 00    	je     9f0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 963:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 965:	8b 48 04             	mov    0x4(%eax),%ecx
+ 968:	39 f9                	cmp    %edi,%ecx
+ 96a:	73 64                	jae    9d0 <malloc+0x90>
+  if(nu < 4096)
+ 96c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 971:	39 df                	cmp    %ebx,%edi
+ 973:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 976:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 97d:	eb 0a                	jmp    989 <malloc+0x49>
+ 97f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 980:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 982:	8b 48 04             	mov    0x4(%eax),%ecx
+ 985:	39 f9                	cmp    %edi,%ecx
+ 987:	73 47                	jae    9d0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 989:	89 c2                	mov    %eax,%edx
+ 98b:	39 05 bc 0e 00 00    	cmp    %eax,0xebc
+ 991:	75 ed                	jne    980 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 993:	83 ec 0c             	sub    $0xc,%esp
+ 996:	56                   	push   %esi
+ 997:	e8 9b fb ff ff       	call   537 <sbrk>
+  if(p == (char*)-1)
+ 99c:	83 c4 10             	add    $0x10,%esp
+ 99f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9a2:	74 1c                	je     9c0 <malloc+0x80>
+  hp->s.size = nu;
+ 9a4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9a7:	83 ec 0c             	sub    $0xc,%esp
+ 9aa:	83 c0 08             	add    $0x8,%eax
+ 9ad:	50                   	push   %eax
+ 9ae:	e8 fd fe ff ff       	call   8b0 <free>
+  return freep;
+ 9b3:	8b 15 bc 0e 00 00    	mov    0xebc,%edx
+      if((p = morecore(nunits)) == 0)
+ 9b9:	83 c4 10             	add    $0x10,%esp
+ 9bc:	85 d2                	test   %edx,%edx
+ 9be:	75 c0                	jne    980 <malloc+0x40>
+        return 0;
+  }
+}
+ 9c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 9c3:	31 c0                	xor    %eax,%eax
+}
+ 9c5:	5b                   	pop    %ebx
+ 9c6:	5e                   	pop    %esi
+ 9c7:	5f                   	pop    %edi
+ 9c8:	5d                   	pop    %ebp
+ 9c9:	c3                   	ret
+ 9ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 9d0:	39 cf                	cmp    %ecx,%edi
+ 9d2:	74 4c                	je     a20 <malloc+0xe0>
+        p->s.size -= nunits;
+ 9d4:	29 f9                	sub    %edi,%ecx
+ 9d6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 9d9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 9dc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 9df:	89 15 bc 0e 00 00    	mov    %edx,0xebc
+}
+ 9e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 9e8:	83 c0 08             	add    $0x8,%eax
+}
+ 9eb:	5b                   	pop    %ebx
+ 9ec:	5e                   	pop    %esi
+ 9ed:	5f                   	pop    %edi
+ 9ee:	5d                   	pop    %ebp
+ 9ef:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 9f0:	c7 05 bc 0e 00 00 c0 	movl   $0xec0,0xebc
+ 9f7:	0e 00 00 
+    base.s.size = 0;
+ 9fa:	b8 c0 0e 00 00       	mov    $0xec0,%eax
+    base.s.ptr = freep = prevp = &base;
+ 9ff:	c7 05 c0 0e 00 00 c0 	movl   $0xec0,0xec0
+ a06:	0e 00 00 
+    base.s.size = 0;
+ a09:	c7 05 c4 0e 00 00 00 	movl   $0x0,0xec4
+ a10:	00 00 00 
+    if(p->s.size >= nunits){
+ a13:	e9 54 ff ff ff       	jmp    96c <malloc+0x2c>
+ a18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a1f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a20:	8b 08                	mov    (%eax),%ecx
+ a22:	89 0a                	mov    %ecx,(%edx)
+ a24:	eb b9                	jmp    9df <malloc+0x9f>
@@ -0,0 +1,1691 @@
+
+_lockprof:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+struct lockprof prof[NPROF];
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 28             	sub    $0x28,%esp
+  struct lockprof *p;
+  int i, n, pid;
+
+  if(argc < 2){
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  17:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc < 2){
+  1a:	0f 8e 0b 01 00 00    	jle    12b <main+0x12b>
+    printf(2, "usage: lockprof command [args...]\n");
+    exit();
+  }
+  if(lockprof(LOCKPROF_START, 0, 0) < 0){
+  20:	50                   	push   %eax
+  21:	6a 00                	push   $0x0
+  23:	6a 00                	push   $0x0
+  25:	6a 01                	push   $0x1
+  27:	e8 23 07 00 00       	call   74f <lockprof>
+  2c:	83 c4 10             	add    $0x10,%esp
+  2f:	85 c0                	test   %eax,%eax
+  31:	0f 88 e1 00 00 00    	js     118 <main+0x118>
+    printf(2, "lockprof: failed\n");
+    exit();
+  }
+  if((pid = fork()) == 0){
+  37:	e8 45 05 00 00       	call   581 <fork>
+  3c:	85 c0                	test   %eax,%eax
+  3e:	0f 84 04 01 00 00    	je     148 <main+0x148>
+    exec(argv[1], argv+1);
+    printf(2, "lockprof: exec %s failed\n", argv[1]);
+    exit();
+  }
+  if(pid > 0)
+  44:	0f 8f f4 00 00 00    	jg     13e <main+0x13e>
+    wait();
+  lockprof(LOCKPROF_STOP, 0, 0);
+  4a:	53                   	push   %ebx
+  4b:	6a 00                	push   $0x0
+  4d:	6a 00                	push   $0x0
+  4f:	6a 02                	push   $0x2
+  51:	e8 f9 06 00 00       	call   74f <lockprof>
+  if((n = lockprof(LOCKPROF_READ, prof, NPROF)) < 0){
+  56:	83 c4 0c             	add    $0xc,%esp
+  59:	68 00 02 00 00       	push   $0x200
+  5e:	68 60 10 00 00       	push   $0x1060
+  63:	6a 03                	push   $0x3
+  65:	e8 e5 06 00 00       	call   74f <lockprof>
+  6a:	83 c4 10             	add    $0x10,%esp
+  6d:	85 c0                	test   %eax,%eax
+  6f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  72:	0f 88 a0 00 00 00    	js     118 <main+0x118>
+    printf(2, "lockprof: failed\n");
+    exit();
+  }
+
+  printf(1, "pc\t\tlock\t\tacquires\twaited\tKcycles waiting\tKcycles held\n");
+  78:	51                   	push   %ecx
+  79:	51                   	push   %ecx
+  7a:	68 a4 0b 00 00       	push   $0xba4
+  7f:	6a 01                	push   $0x1
+  81:	e8 8a 07 00 00       	call   810 <printf>
+  for(i = 0; i < n; i++){
+  86:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  89:	83 c4 10             	add    $0x10,%esp
+  8c:	85 d2                	test   %edx,%edx
+  8e:	0f 84 7f 00 00 00    	je     113 <main+0x113>
+    p = &prof[i];
+    printf(1, "%x\t%s\t%s%d\t\t%d\t%d\t\t%d\n", p->pc, p->name,
+  94:	89 55 d0             	mov    %edx,-0x30(%ebp)
+  for(i = 0; i < n; i++){
+  97:	31 c9                	xor    %ecx,%ecx
+  99:	bb 60 10 00 00       	mov    $0x1060,%ebx
+    printf(1, "%x\t%s\t%s%d\t\t%d\t%d\t\t%d\n", p->pc, p->name,
+  9e:	89 ce                	mov    %ecx,%esi
+           strlen(p->name) < 8 ? "\t" : "", p->nacquire, p->ncontend,
+           (uint)(p->wait >> 10), (uint)(p->hold >> 10));
+  a0:	8b 53 28             	mov    0x28(%ebx),%edx
+  a3:	8b 43 24             	mov    0x24(%ebx),%eax
+           strlen(p->name) < 8 ? "\t" : "", p->nacquire, p->ncontend,
+  a6:	83 ec 0c             	sub    $0xc,%esp
+    printf(1, "%x\t%s\t%s%d\t\t%d\t%d\t\t%d\n", p->pc, p->name,
+  a9:	8b 7b 14             	mov    0x14(%ebx),%edi
+           (uint)(p->wait >> 10), (uint)(p->hold >> 10));
+  ac:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+  b0:	c1 ea 0a             	shr    $0xa,%edx
+  b3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  b6:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  b9:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  bc:	8b 53 20             	mov    0x20(%ebx),%edx
+  bf:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+  c3:	c1 ea 0a             	shr    $0xa,%edx
+  c6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    printf(1, "%x\t%s\t%s%d\t\t%d\t%d\t\t%d\n", p->pc, p->name,
+  c9:	8b 53 18             	mov    0x18(%ebx),%edx
+           (uint)(p->wait >> 10), (uint)(p->hold >> 10));
+  cc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    printf(1, "%x\t%s\t%s%d\t\t%d\t%d\t\t%d\n", p->pc, p->name,
+  cf:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+           strlen(p->name) < 8 ? "\t" : "", p->nacquire, p->ncontend,
+  d2:	53                   	push   %ebx
+  d3:	e8 28 01 00 00       	call   200 <strlen>
+    printf(1, "%x\t%s\t%s%d\t\t%d\t%d\t\t%d\n", p->pc, p->name,
+  d8:	5a                   	pop    %edx
+  d9:	b9 38 0b 00 00       	mov    $0xb38,%ecx
+  de:	ba 39 0b 00 00       	mov    $0xb39,%edx
+  e3:	83 f8 07             	cmp    $0x7,%eax
+  e6:	ff 75 e0             	push   -0x20(%ebp)
+  e9:	0f 47 ca             	cmova  %edx,%ecx
+  ec:	ff 75 d8             	push   -0x28(%ebp)
+  for(i = 0; i < n; i++){
+  ef:	83 c6 01             	add    $0x1,%esi
+    printf(1, "%x\t%s\t%s%d\t\t%d\t%d\t\t%d\n", p->pc, p->name,
+  f2:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  f5:	52                   	push   %edx
+  f6:	57                   	push   %edi
+  f7:	51                   	push   %ecx
+  f8:	53                   	push   %ebx
+  for(i = 0; i < n; i++){
+  f9:	83 c3 2c             	add    $0x2c,%ebx
+    printf(1, "%x\t%s\t%s%d\t\t%d\t%d\t\t%d\n", p->pc, p->name,
+  fc:	ff 73 e4             	push   -0x1c(%ebx)
+  ff:	68 66 0b 00 00       	push   $0xb66
+ 104:	6a 01                	push   $0x1
+ 106:	e8 05 07 00 00       	call   810 <printf>
+  for(i = 0; i < n; i++){
+ 10b:	83 c4 30             	add    $0x30,%esp
+ 10e:	39 75 d0             	cmp    %esi,-0x30(%ebp)
+ 111:	75 8d                	jne    a0 <main+0xa0>
+  }
+  exit();
+ 113:	e8 74 04 00 00       	call   58c <exit>
+    printf(2, "lockprof: failed\n");
+ 118:	57                   	push   %edi
+ 119:	57                   	push   %edi
+ 11a:	68 3a 0b 00 00       	push   $0xb3a
+ 11f:	6a 02                	push   $0x2
+ 121:	e8 ea 06 00 00       	call   810 <printf>
+    exit();
+ 126:	e8 61 04 00 00       	call   58c <exit>
+    printf(2, "usage: lockprof command [args...]\n");
+ 12b:	50                   	push   %eax
+ 12c:	50                   	push   %eax
+ 12d:	68 80 0b 00 00       	push   $0xb80
+ 132:	6a 02                	push   $0x2
+ 134:	e8 d7 06 00 00       	call   810 <printf>
+    exit();
+ 139:	e8 4e 04 00 00       	call   58c <exit>
+    wait();
+ 13e:	e8 54 04 00 00       	call   597 <wait>
+ 143:	e9 02 ff ff ff       	jmp    4a <main+0x4a>
+    exec(argv[1], argv+1);
+ 148:	8d 43 04             	lea    0x4(%ebx),%eax
+ 14b:	56                   	push   %esi
+ 14c:	56                   	push   %esi
+ 14d:	50                   	push   %eax
+ 14e:	ff 73 04             	push   0x4(%ebx)
+ 151:	e8 83 04 00 00       	call   5d9 <exec>
+    printf(2, "lockprof: exec %s failed\n", argv[1]);
+ 156:	83 c4 0c             	add    $0xc,%esp
+ 159:	ff 73 04             	push   0x4(%ebx)
+ 15c:	68 4c 0b 00 00       	push   $0xb4c
+ 161:	6a 02                	push   $0x2
+ 163:	e8 a8 06 00 00       	call   810 <printf>
+    exit();
+ 168:	e8 1f 04 00 00       	call   58c <exit>
+ 16d:	66 90                	xchg   %ax,%ax
+ 16f:	90                   	nop
+
+00000170 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 170:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 171:	31 c0                	xor    %eax,%eax
+{
+ 173:	89 e5                	mov    %esp,%ebp
+ 175:	53                   	push   %ebx
+ 176:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 179:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 17c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 180:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 184:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 187:	83 c0 01             	add    $0x1,%eax
+ 18a:	84 d2                	test   %dl,%dl
+ 18c:	75 f2                	jne    180 <strcpy+0x10>
+    ;
+  return os;
+}
+ 18e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 191:	89 c8                	mov    %ecx,%eax
+ 193:	c9                   	leave
+ 194:	c3                   	ret
+ 195:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	53                   	push   %ebx
+ 1a4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1aa:	0f b6 02             	movzbl (%edx),%eax
+ 1ad:	84 c0                	test   %al,%al
+ 1af:	75 17                	jne    1c8 <strcmp+0x28>
+ 1b1:	eb 3a                	jmp    1ed <strcmp+0x4d>
+ 1b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1b7:	90                   	nop
+ 1b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1bc:	83 c2 01             	add    $0x1,%edx
+ 1bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1c2:	84 c0                	test   %al,%al
+ 1c4:	74 1a                	je     1e0 <strcmp+0x40>
+    p++, q++;
+ 1c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1c8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1cb:	38 c3                	cmp    %al,%bl
+ 1cd:	74 e9                	je     1b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1cf:	29 d8                	sub    %ebx,%eax
+}
+ 1d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1d4:	c9                   	leave
+ 1d5:	c3                   	ret
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1e4:	31 c0                	xor    %eax,%eax
+ 1e6:	29 d8                	sub    %ebx,%eax
+}
+ 1e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1eb:	c9                   	leave
+ 1ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1ed:	0f b6 19             	movzbl (%ecx),%ebx
+ 1f0:	31 c0                	xor    %eax,%eax
+ 1f2:	eb db                	jmp    1cf <strcmp+0x2f>
+ 1f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1ff:	90                   	nop
+
+00000200 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 206:	80 3a 00             	cmpb   $0x0,(%edx)
+ 209:	74 15                	je     220 <strlen+0x20>
+ 20b:	31 c0                	xor    %eax,%eax
+ 20d:	8d 76 00             	lea    0x0(%esi),%esi
+ 210:	83 c0 01             	add    $0x1,%eax
+ 213:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 217:	89 c1                	mov    %eax,%ecx
+ 219:	75 f5                	jne    210 <strlen+0x10>
+    ;
+  return n;
+}
+ 21b:	89 c8                	mov    %ecx,%eax
+ 21d:	5d                   	pop    %ebp
+ 21e:	c3                   	ret
+ 21f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 220:	31 c9                	xor    %ecx,%ecx
+}
+ 222:	5d                   	pop    %ebp
+ 223:	89 c8                	mov    %ecx,%eax
+ 225:	c3                   	ret
+ 226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000230 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	57                   	push   %edi
+ 234:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 237:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 23a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 23d:	89 d7                	mov    %edx,%edi
+ 23f:	fc                   	cld
+ 240:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 242:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 245:	89 d0                	mov    %edx,%eax
+ 247:	c9                   	leave
+ 248:	c3                   	ret
+ 249:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000250 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	8b 45 08             	mov    0x8(%ebp),%eax
+ 256:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 25a:	0f b6 10             	movzbl (%eax),%edx
+ 25d:	84 d2                	test   %dl,%dl
+ 25f:	75 12                	jne    273 <strchr+0x23>
+ 261:	eb 1d                	jmp    280 <strchr+0x30>
+ 263:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 267:	90                   	nop
+ 268:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 26c:	83 c0 01             	add    $0x1,%eax
+ 26f:	84 d2                	test   %dl,%dl
+ 271:	74 0d                	je     280 <strchr+0x30>
+    if(*s == c)
+ 273:	38 d1                	cmp    %dl,%cl
+ 275:	75 f1                	jne    268 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 277:	5d                   	pop    %ebp
+ 278:	c3                   	ret
+ 279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 280:	31 c0                	xor    %eax,%eax
+}
+ 282:	5d                   	pop    %ebp
+ 283:	c3                   	ret
+ 284:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 28f:	90                   	nop
+
+00000290 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 295:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 298:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 299:	31 db                	xor    %ebx,%ebx
+{
+ 29b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 29e:	eb 27                	jmp    2c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2a0:	83 ec 04             	sub    $0x4,%esp
+ 2a3:	6a 01                	push   $0x1
+ 2a5:	56                   	push   %esi
+ 2a6:	6a 00                	push   $0x0
+ 2a8:	e8 00 03 00 00       	call   5ad <read>
+    if(cc < 1)
+ 2ad:	83 c4 10             	add    $0x10,%esp
+ 2b0:	85 c0                	test   %eax,%eax
+ 2b2:	7e 1d                	jle    2d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2bf:	3c 0a                	cmp    $0xa,%al
+ 2c1:	74 10                	je     2d3 <gets+0x43>
+ 2c3:	3c 0d                	cmp    $0xd,%al
+ 2c5:	74 0c                	je     2d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2c7:	89 df                	mov    %ebx,%edi
+ 2c9:	83 c3 01             	add    $0x1,%ebx
+ 2cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2cf:	7c cf                	jl     2a0 <gets+0x10>
+ 2d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2dd:	5b                   	pop    %ebx
+ 2de:	5e                   	pop    %esi
+ 2df:	5f                   	pop    %edi
+ 2e0:	5d                   	pop    %ebp
+ 2e1:	c3                   	ret
+ 2e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	56                   	push   %esi
+ 2f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2f5:	83 ec 08             	sub    $0x8,%esp
+ 2f8:	6a 00                	push   $0x0
+ 2fa:	ff 75 08             	push   0x8(%ebp)
+ 2fd:	e8 e2 02 00 00       	call   5e4 <open>
+  if(fd < 0)
+ 302:	83 c4 10             	add    $0x10,%esp
+ 305:	85 c0                	test   %eax,%eax
+ 307:	78 27                	js     330 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 309:	83 ec 08             	sub    $0x8,%esp
+ 30c:	ff 75 0c             	push   0xc(%ebp)
+ 30f:	89 c3                	mov    %eax,%ebx
+ 311:	50                   	push   %eax
+ 312:	e8 ee 02 00 00       	call   605 <fstat>
+  close(fd);
+ 317:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 31a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 31c:	e8 a2 02 00 00       	call   5c3 <close>
+  return r;
+ 321:	83 c4 10             	add    $0x10,%esp
+}
+ 324:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 327:	89 f0                	mov    %esi,%eax
+ 329:	5b                   	pop    %ebx
+ 32a:	5e                   	pop    %esi
+ 32b:	5d                   	pop    %ebp
+ 32c:	c3                   	ret
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 330:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 335:	eb ed                	jmp    324 <stat+0x34>
+ 337:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33e:	66 90                	xchg   %ax,%ax
+
+00000340 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	53                   	push   %ebx
+ 344:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 347:	0f be 02             	movsbl (%edx),%eax
+ 34a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 34d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 350:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 355:	77 1e                	ja     375 <atoi+0x35>
+ 357:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 360:	83 c2 01             	add    $0x1,%edx
+ 363:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 366:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 36a:	0f be 02             	movsbl (%edx),%eax
+ 36d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 370:	80 fb 09             	cmp    $0x9,%bl
+ 373:	76 eb                	jbe    360 <atoi+0x20>
+  return n;
+}
+ 375:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 378:	89 c8                	mov    %ecx,%eax
+ 37a:	c9                   	leave
+ 37b:	c3                   	ret
+ 37c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000380 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	57                   	push   %edi
+ 384:	56                   	push   %esi
+ 385:	8b 45 10             	mov    0x10(%ebp),%eax
+ 388:	8b 55 08             	mov    0x8(%ebp),%edx
+ 38b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 38e:	85 c0                	test   %eax,%eax
+ 390:	7e 13                	jle    3a5 <memmove+0x25>
+ 392:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 394:	89 d7                	mov    %edx,%edi
+ 396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3a1:	39 f8                	cmp    %edi,%eax
+ 3a3:	75 fb                	jne    3a0 <memmove+0x20>
+  return vdst;
+}
+ 3a5:	5e                   	pop    %esi
+ 3a6:	89 d0                	mov    %edx,%eax
+ 3a8:	5f                   	pop    %edi
+ 3a9:	5d                   	pop    %ebp
+ 3aa:	c3                   	ret
+ 3ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3af:	90                   	nop
+
+000003b0 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 3b0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 3b5:	85 c0                	test   %eax,%eax
+ 3b7:	74 07                	je     3c0 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 3b9:	c3                   	ret
+ 3ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 3c0:	e9 77 02 00 00       	jmp    63c <sysgetpid>
+ 3c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 3d0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 3d5:	c3                   	ret
+ 3d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003e0 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 3e0:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 3e1:	31 d2                	xor    %edx,%edx
+ 3e3:	89 e5                	mov    %esp,%ebp
+ 3e5:	53                   	push   %ebx
+ 3e6:	83 ec 04             	sub    $0x4,%esp
+ 3e9:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 3ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 3ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 3f2:	85 c9                	test   %ecx,%ecx
+ 3f4:	7e 08                	jle    3fe <cyclereport+0x1e>
+ 3f6:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 3f8:	89 d8                	mov    %ebx,%eax
+ 3fa:	f7 f1                	div    %ecx
+ 3fc:	89 c2                	mov    %eax,%edx
+ 3fe:	83 ec 08             	sub    $0x8,%esp
+ 401:	52                   	push   %edx
+ 402:	ff 75 0c             	push   0xc(%ebp)
+ 405:	51                   	push   %ecx
+ 406:	ff 75 08             	push   0x8(%ebp)
+ 409:	68 dc 0b 00 00       	push   $0xbdc
+ 40e:	6a 01                	push   $0x1
+ 410:	e8 fb 03 00 00       	call   810 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 415:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 418:	83 c4 20             	add    $0x20,%esp
+ 41b:	c9                   	leave
+ 41c:	c3                   	ret
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000420 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+ 426:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 42c:	5d                   	pop    %ebp
+ 42d:	c3                   	ret
+ 42e:	66 90                	xchg   %ax,%ax
+
+00000430 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 430:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 431:	31 c0                	xor    %eax,%eax
+ 433:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 438:	89 e5                	mov    %esp,%ebp
+ 43a:	56                   	push   %esi
+ 43b:	53                   	push   %ebx
+ 43c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 43f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 443:	85 c0                	test   %eax,%eax
+ 445:	74 30                	je     477 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 447:	83 f8 02             	cmp    $0x2,%eax
+ 44a:	74 0c                	je     458 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 44c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 451:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 454:	85 c0                	test   %eax,%eax
+ 456:	74 1f                	je     477 <mutex_lock+0x47>
+ 458:	be 02 00 00 00       	mov    $0x2,%esi
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 460:	83 ec 08             	sub    $0x8,%esp
+ 463:	6a 02                	push   $0x2
+ 465:	53                   	push   %ebx
+ 466:	e8 8c 02 00 00       	call   6f7 <futex_wait>
+ 46b:	89 f0                	mov    %esi,%eax
+ 46d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 470:	83 c4 10             	add    $0x10,%esp
+ 473:	85 c0                	test   %eax,%eax
+ 475:	75 e9                	jne    460 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 477:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 47a:	5b                   	pop    %ebx
+ 47b:	5e                   	pop    %esi
+ 47c:	5d                   	pop    %ebp
+ 47d:	c3                   	ret
+ 47e:	66 90                	xchg   %ax,%ax
+
+00000480 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	83 ec 08             	sub    $0x8,%esp
+ 486:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 489:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 48d:	75 09                	jne    498 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 48f:	c9                   	leave
+ 490:	c3                   	ret
+ 491:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 498:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 49b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 4a1:	6a 01                	push   $0x1
+ 4a3:	50                   	push   %eax
+ 4a4:	e8 59 02 00 00       	call   702 <futex_wake>
+ 4a9:	83 c4 10             	add    $0x10,%esp
+}
+ 4ac:	c9                   	leave
+ 4ad:	c3                   	ret
+ 4ae:	66 90                	xchg   %ax,%ax
+
+000004b0 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 4b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 4bc:	5d                   	pop    %ebp
+ 4bd:	c3                   	ret
+ 4be:	66 90                	xchg   %ax,%ax
+
+000004c0 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+ 4c5:	53                   	push   %ebx
+ 4c6:	83 ec 0c             	sub    $0xc,%esp
+ 4c9:	8b 75 08             	mov    0x8(%ebp),%esi
+ 4cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 4cf:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 4d1:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 4d5:	75 21                	jne    4f8 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 4d7:	83 ec 08             	sub    $0x8,%esp
+ 4da:	57                   	push   %edi
+ 4db:	56                   	push   %esi
+ 4dc:	e8 16 02 00 00       	call   6f7 <futex_wait>
+  mutex_lock(m);
+ 4e1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 4e4:	83 c4 10             	add    $0x10,%esp
+}
+ 4e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4ea:	5b                   	pop    %ebx
+ 4eb:	5e                   	pop    %esi
+ 4ec:	5f                   	pop    %edi
+ 4ed:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 4ee:	e9 3d ff ff ff       	jmp    430 <mutex_lock>
+ 4f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4f7:	90                   	nop
+    futex_wake(&m->v, 1);
+ 4f8:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 4fb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 501:	6a 01                	push   $0x1
+ 503:	53                   	push   %ebx
+ 504:	e8 f9 01 00 00       	call   702 <futex_wake>
+ 509:	83 c4 10             	add    $0x10,%esp
+ 50c:	eb c9                	jmp    4d7 <cond_wait+0x17>
+ 50e:	66 90                	xchg   %ax,%ax
+
+00000510 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	83 ec 10             	sub    $0x10,%esp
+ 516:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 519:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 51d:	6a 01                	push   $0x1
+ 51f:	50                   	push   %eax
+ 520:	e8 dd 01 00 00       	call   702 <futex_wake>
+}
+ 525:	83 c4 10             	add    $0x10,%esp
+ 528:	c9                   	leave
+ 529:	c3                   	ret
+ 52a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000530 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	83 ec 10             	sub    $0x10,%esp
+ 536:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 539:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 53d:	68 ff ff ff 7f       	push   $0x7fffffff
+ 542:	50                   	push   %eax
+ 543:	e8 ba 01 00 00       	call   702 <futex_wake>
+}
+ 548:	83 c4 10             	add    $0x10,%esp
+ 54b:	c9                   	leave
+ 54c:	c3                   	ret
+
+0000054d <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 54d:	50                   	push   %eax
+  pushl %ebx
+ 54e:	53                   	push   %ebx
+  movl $1, %eax
+ 54f:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 554:	0f a2                	cpuid
+  popl %ebx
+ 556:	5b                   	pop    %ebx
+  popl %eax
+ 557:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 558:	c7 05 4c 10 00 00 7e 	movl   $0x57e,0x104c
+ 55f:	05 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 562:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 568:	74 14                	je     57e <sysint>
+  movl $sysfast, syscallvec
+ 56a:	c7 05 4c 10 00 00 74 	movl   $0x574,0x104c
+ 571:	05 00 00 
+
+00000574 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 574:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 576:	ba 7d 05 00 00       	mov    $0x57d,%edx
+  sysenter
+ 57b:	0f 34                	sysenter
+1:
+  ret
+ 57d:	c3                   	ret
+
+0000057e <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 57e:	cd 40                	int    $0x40
+  ret
+ 580:	c3                   	ret
+
+00000581 <fork>:
+
+SYSCALL(fork)
+ 581:	b8 01 00 00 00       	mov    $0x1,%eax
+ 586:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+0000058c <exit>:
+SYSCALL(exit)
+ 58c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 591:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+00000597 <wait>:
+SYSCALL(wait)
+ 597:	b8 03 00 00 00       	mov    $0x3,%eax
+ 59c:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+000005a2 <pipe>:
+SYSCALL(pipe)
+ 5a2:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5a7:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+000005ad <read>:
+SYSCALL(read)
+ 5ad:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5b2:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+000005b8 <write>:
+SYSCALL(write)
+ 5b8:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5bd:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+000005c3 <close>:
+SYSCALL(close)
+ 5c3:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5c8:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+000005ce <kill>:
+SYSCALL(kill)
+ 5ce:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5d3:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+000005d9 <exec>:
+SYSCALL(exec)
+ 5d9:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5de:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+000005e4 <open>:
+SYSCALL(open)
+ 5e4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5e9:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+000005ef <mknod>:
+SYSCALL(mknod)
+ 5ef:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5f4:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+000005fa <unlink>:
+SYSCALL(unlink)
+ 5fa:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5ff:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+00000605 <fstat>:
+SYSCALL(fstat)
+ 605:	b8 08 00 00 00       	mov    $0x8,%eax
+ 60a:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+00000610 <link>:
+SYSCALL(link)
+ 610:	b8 13 00 00 00       	mov    $0x13,%eax
+ 615:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+0000061b <mkdir>:
+SYSCALL(mkdir)
+ 61b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 620:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+00000626 <chdir>:
+SYSCALL(chdir)
+ 626:	b8 09 00 00 00       	mov    $0x9,%eax
+ 62b:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+00000631 <dup>:
+SYSCALL(dup)
+ 631:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 636:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+0000063c <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 63c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 641:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+00000647 <sbrk>:
+SYSCALL(sbrk)
+ 647:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 64c:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+00000652 <sleep>:
+SYSCALL(sleep)
+ 652:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 657:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+0000065d <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 65d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 662:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+00000668 <swapread>:
+SYSCALL(swapread)
+ 668:	b8 16 00 00 00       	mov    $0x16,%eax
+ 66d:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+00000673 <swapwrite>:
+SYSCALL(swapwrite)
+ 673:	b8 17 00 00 00       	mov    $0x17,%eax
+ 678:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+0000067e <swapstat>:
+SYSCALL(swapstat)
+ 67e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 683:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+00000689 <madvise>:
+SYSCALL(madvise)
+ 689:	b8 19 00 00 00       	mov    $0x19,%eax
+ 68e:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+00000694 <mlock>:
+SYSCALL(mlock)
+ 694:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 699:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+0000069f <munlock>:
+SYSCALL(munlock)
+ 69f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6a4:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+000006aa <membench>:
+SYSCALL(membench)
+ 6aa:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6af:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+000006b5 <nice>:
+SYSCALL(nice)
+ 6b5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6ba:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+000006c0 <setpriority>:
+SYSCALL(setpriority)
+ 6c0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6c5:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+000006cb <usleep>:
+SYSCALL(usleep)
+ 6cb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6d0:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+000006d6 <cpustat>:
+SYSCALL(cpustat)
+ 6d6:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6db:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+000006e1 <clone>:
+SYSCALL(clone)
+ 6e1:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6e6:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+000006ec <join>:
+SYSCALL(join)
+ 6ec:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6f1:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+000006f7 <futex_wait>:
+SYSCALL(futex_wait)
+ 6f7:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6fc:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+00000702 <futex_wake>:
+SYSCALL(futex_wake)
+ 702:	b8 24 00 00 00       	mov    $0x24,%eax
+ 707:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+0000070d <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 70d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 712:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+00000718 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 718:	b8 26 00 00 00       	mov    $0x26,%eax
+ 71d:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+00000723 <getcpu>:
+SYSCALL(getcpu)
+ 723:	b8 27 00 00 00       	mov    $0x27,%eax
+ 728:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+0000072e <migrations>:
+SYSCALL(migrations)
+ 72e:	b8 28 00 00 00       	mov    $0x28,%eax
+ 733:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+00000739 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 739:	b8 29 00 00 00       	mov    $0x29,%eax
+ 73e:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+00000744 <lockstat>:
+SYSCALL(lockstat)
+ 744:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 749:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+0000074f <lockprof>:
+SYSCALL(lockprof)
+ 74f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 754:	ff 25 4c 10 00 00    	jmp    *0x104c
+
+0000075a <bcachestat>:
+SYSCALL(bcachestat)
+ 75a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 75f:	ff 25 4c 10 00 00    	jmp    *0x104c
+ 765:	66 90                	xchg   %ax,%ax
+ 767:	66 90                	xchg   %ax,%ax
+ 769:	66 90                	xchg   %ax,%ax
+ 76b:	66 90                	xchg   %ax,%ax
+ 76d:	66 90                	xchg   %ax,%ax
+ 76f:	90                   	nop
+
+00000770 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	57                   	push   %edi
+ 774:	56                   	push   %esi
+ 775:	53                   	push   %ebx
+ 776:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 778:	89 d1                	mov    %edx,%ecx
+{
+ 77a:	83 ec 3c             	sub    $0x3c,%esp
+ 77d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 780:	85 d2                	test   %edx,%edx
+ 782:	0f 89 80 00 00 00    	jns    808 <printint+0x98>
+ 788:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 78c:	74 7a                	je     808 <printint+0x98>
+    x = -xx;
+ 78e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 790:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 795:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 798:	31 f6                	xor    %esi,%esi
+ 79a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 7a0:	89 c8                	mov    %ecx,%eax
+ 7a2:	31 d2                	xor    %edx,%edx
+ 7a4:	89 f7                	mov    %esi,%edi
+ 7a6:	f7 f3                	div    %ebx
+ 7a8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7ab:	0f b6 92 58 0c 00 00 	movzbl 0xc58(%edx),%edx
+ 7b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7b6:	89 ca                	mov    %ecx,%edx
+ 7b8:	89 c1                	mov    %eax,%ecx
+ 7ba:	39 da                	cmp    %ebx,%edx
+ 7bc:	73 e2                	jae    7a0 <printint+0x30>
+  if(neg)
+ 7be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7c1:	85 c0                	test   %eax,%eax
+ 7c3:	74 07                	je     7cc <printint+0x5c>
+    buf[i++] = '-';
+ 7c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7ca:	89 f7                	mov    %esi,%edi
+ 7cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 7d2:	01 df                	add    %ebx,%edi
+ 7d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 7d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 7db:	83 ec 04             	sub    $0x4,%esp
+ 7de:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 7e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 7e4:	6a 01                	push   $0x1
+ 7e6:	50                   	push   %eax
+ 7e7:	56                   	push   %esi
+ 7e8:	e8 cb fd ff ff       	call   5b8 <write>
+  while(--i >= 0)
+ 7ed:	89 f8                	mov    %edi,%eax
+ 7ef:	83 c4 10             	add    $0x10,%esp
+ 7f2:	83 ef 01             	sub    $0x1,%edi
+ 7f5:	39 d8                	cmp    %ebx,%eax
+ 7f7:	75 df                	jne    7d8 <printint+0x68>
+}
+ 7f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7fc:	5b                   	pop    %ebx
+ 7fd:	5e                   	pop    %esi
+ 7fe:	5f                   	pop    %edi
+ 7ff:	5d                   	pop    %ebp
+ 800:	c3                   	ret
+ 801:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 808:	31 c0                	xor    %eax,%eax
+ 80a:	eb 89                	jmp    795 <printint+0x25>
+ 80c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000810 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 810:	55                   	push   %ebp
+ 811:	89 e5                	mov    %esp,%ebp
+ 813:	57                   	push   %edi
+ 814:	56                   	push   %esi
+ 815:	53                   	push   %ebx
+ 816:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 819:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 81c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 81f:	0f b6 1e             	movzbl (%esi),%ebx
+ 822:	83 c6 01             	add    $0x1,%esi
+ 825:	84 db                	test   %bl,%bl
+ 827:	74 67                	je     890 <printf+0x80>
+ 829:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 82c:	31 d2                	xor    %edx,%edx
+ 82e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 831:	eb 34                	jmp    867 <printf+0x57>
+ 833:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 837:	90                   	nop
+ 838:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 83b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 840:	83 f8 25             	cmp    $0x25,%eax
+ 843:	74 18                	je     85d <printf+0x4d>
+  write(fd, &c, 1);
+ 845:	83 ec 04             	sub    $0x4,%esp
+ 848:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 84b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 84e:	6a 01                	push   $0x1
+ 850:	50                   	push   %eax
+ 851:	57                   	push   %edi
+ 852:	e8 61 fd ff ff       	call   5b8 <write>
+ 857:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 85a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 85d:	0f b6 1e             	movzbl (%esi),%ebx
+ 860:	83 c6 01             	add    $0x1,%esi
+ 863:	84 db                	test   %bl,%bl
+ 865:	74 29                	je     890 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 867:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 86a:	85 d2                	test   %edx,%edx
+ 86c:	74 ca                	je     838 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 86e:	83 fa 25             	cmp    $0x25,%edx
+ 871:	75 ea                	jne    85d <printf+0x4d>
+      if(c == 'd'){
+ 873:	83 f8 25             	cmp    $0x25,%eax
+ 876:	0f 84 24 01 00 00    	je     9a0 <printf+0x190>
+ 87c:	83 e8 63             	sub    $0x63,%eax
+ 87f:	83 f8 15             	cmp    $0x15,%eax
+ 882:	77 1c                	ja     8a0 <printf+0x90>
+ 884:	ff 24 85 00 0c 00 00 	jmp    *0xc00(,%eax,4)
+ 88b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 88f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 890:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 893:	5b                   	pop    %ebx
+ 894:	5e                   	pop    %esi
+ 895:	5f                   	pop    %edi
+ 896:	5d                   	pop    %ebp
+ 897:	c3                   	ret
+ 898:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89f:	90                   	nop
+  write(fd, &c, 1);
+ 8a0:	83 ec 04             	sub    $0x4,%esp
+ 8a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 8aa:	6a 01                	push   $0x1
+ 8ac:	52                   	push   %edx
+ 8ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 8b0:	57                   	push   %edi
+ 8b1:	e8 02 fd ff ff       	call   5b8 <write>
+ 8b6:	83 c4 0c             	add    $0xc,%esp
+ 8b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8bc:	6a 01                	push   $0x1
+ 8be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8c1:	52                   	push   %edx
+ 8c2:	57                   	push   %edi
+ 8c3:	e8 f0 fc ff ff       	call   5b8 <write>
+        putc(fd, c);
+ 8c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8cb:	31 d2                	xor    %edx,%edx
+ 8cd:	eb 8e                	jmp    85d <printf+0x4d>
+ 8cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 8d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8d3:	83 ec 0c             	sub    $0xc,%esp
+ 8d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8db:	8b 13                	mov    (%ebx),%edx
+ 8dd:	6a 00                	push   $0x0
+ 8df:	89 f8                	mov    %edi,%eax
+        ap++;
+ 8e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 8e4:	e8 87 fe ff ff       	call   770 <printint>
+        ap++;
+ 8e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8ef:	31 d2                	xor    %edx,%edx
+ 8f1:	e9 67 ff ff ff       	jmp    85d <printf+0x4d>
+ 8f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 900:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 903:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 905:	83 c0 04             	add    $0x4,%eax
+ 908:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 90b:	85 db                	test   %ebx,%ebx
+ 90d:	0f 84 9d 00 00 00    	je     9b0 <printf+0x1a0>
+        while(*s != 0){
+ 913:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 916:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 918:	84 c0                	test   %al,%al
+ 91a:	0f 84 3d ff ff ff    	je     85d <printf+0x4d>
+ 920:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 923:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 926:	89 de                	mov    %ebx,%esi
+ 928:	89 d3                	mov    %edx,%ebx
+ 92a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 930:	83 ec 04             	sub    $0x4,%esp
+ 933:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 936:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 939:	6a 01                	push   $0x1
+ 93b:	53                   	push   %ebx
+ 93c:	57                   	push   %edi
+ 93d:	e8 76 fc ff ff       	call   5b8 <write>
+        while(*s != 0){
+ 942:	0f b6 06             	movzbl (%esi),%eax
+ 945:	83 c4 10             	add    $0x10,%esp
+ 948:	84 c0                	test   %al,%al
+ 94a:	75 e4                	jne    930 <printf+0x120>
+      state = 0;
+ 94c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 94f:	31 d2                	xor    %edx,%edx
+ 951:	e9 07 ff ff ff       	jmp    85d <printf+0x4d>
+ 956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 960:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 963:	83 ec 0c             	sub    $0xc,%esp
+ 966:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 96b:	8b 13                	mov    (%ebx),%edx
+ 96d:	6a 01                	push   $0x1
+ 96f:	e9 6b ff ff ff       	jmp    8df <printf+0xcf>
+ 974:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 978:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 97b:	83 ec 04             	sub    $0x4,%esp
+ 97e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 981:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 983:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 986:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 989:	6a 01                	push   $0x1
+ 98b:	52                   	push   %edx
+ 98c:	57                   	push   %edi
+ 98d:	e8 26 fc ff ff       	call   5b8 <write>
+        ap++;
+ 992:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 995:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 998:	31 d2                	xor    %edx,%edx
+ 99a:	e9 be fe ff ff       	jmp    85d <printf+0x4d>
+ 99f:	90                   	nop
+  write(fd, &c, 1);
+ 9a0:	83 ec 04             	sub    $0x4,%esp
+ 9a3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9a6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9a9:	6a 01                	push   $0x1
+ 9ab:	e9 11 ff ff ff       	jmp    8c1 <printf+0xb1>
+ 9b0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 9b5:	bb f7 0b 00 00       	mov    $0xbf7,%ebx
+ 9ba:	e9 61 ff ff ff       	jmp    920 <printf+0x110>
+ 9bf:	90                   	nop
+
+000009c0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9c0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9c1:	a1 60 68 00 00       	mov    0x6860,%eax
+{
+ 9c6:	89 e5                	mov    %esp,%ebp
+ 9c8:	57                   	push   %edi
+ 9c9:	56                   	push   %esi
+ 9ca:	53                   	push   %ebx
+ 9cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 9ce:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9d8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9da:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9dc:	39 ca                	cmp    %ecx,%edx
+ 9de:	73 30                	jae    a10 <free+0x50>
+ 9e0:	39 c1                	cmp    %eax,%ecx
+ 9e2:	72 04                	jb     9e8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9e4:	39 c2                	cmp    %eax,%edx
+ 9e6:	72 f0                	jb     9d8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9e8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 9eb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 9ee:	39 f8                	cmp    %edi,%eax
+ 9f0:	74 2e                	je     a20 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9f2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 9f5:	8b 42 04             	mov    0x4(%edx),%eax
+ 9f8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9fb:	39 f1                	cmp    %esi,%ecx
+ 9fd:	74 38                	je     a37 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 9ff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a01:	5b                   	pop    %ebx
+  freep = p;
+ a02:	89 15 60 68 00 00    	mov    %edx,0x6860
+}
+ a08:	5e                   	pop    %esi
+ a09:	5f                   	pop    %edi
+ a0a:	5d                   	pop    %ebp
+ a0b:	c3                   	ret
+ a0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a10:	39 c1                	cmp    %eax,%ecx
+ a12:	72 d0                	jb     9e4 <free+0x24>
+ a14:	eb c2                	jmp    9d8 <free+0x18>
+ a16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a1d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a20:	03 70 04             	add    0x4(%eax),%esi
+ a23:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a26:	8b 02                	mov    (%edx),%eax
+ a28:	8b 00                	mov    (%eax),%eax
+ a2a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a2d:	8b 42 04             	mov    0x4(%edx),%eax
+ a30:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a33:	39 f1                	cmp    %esi,%ecx
+ a35:	75 c8                	jne    9ff <free+0x3f>
+    p->s.size += bp->s.size;
+ a37:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a3a:	89 15 60 68 00 00    	mov    %edx,0x6860
+    p->s.size += bp->s.size;
+ a40:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a43:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a46:	89 0a                	mov    %ecx,(%edx)
+}
+ a48:	5b                   	pop    %ebx
+ a49:	5e                   	pop    %esi
+ a4a:	5f                   	pop    %edi
+ a4b:	5d                   	pop    %ebp
+ a4c:	c3                   	ret
+ a4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a50 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a50:	55                   	push   %ebp
+ a51:	89 e5                	mov    %esp,%ebp
+ a53:	57                   	push   %edi
+ a54:	56                   	push   %esi
+ a55:	53                   	push   %ebx
+ a56:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a59:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a5c:	8b 15 60 68 00 00    	mov    0x6860,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a62:	8d 78 07             	lea    0x7(%eax),%edi
+ a65:	c1 ef 03             	shr    $0x3,%edi
+ a68:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a6b:	85 d2                	test   %edx,%edx
+ a6d:	0f 84 8d 00 00 00    	je     b00 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a73:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a75:	8b 48 04             	mov    0x4(%eax),%ecx
+ a78:	39 f9                	cmp    %edi,%ecx
+ a7a:	73 64                	jae    ae0 <malloc+0x90>
+  if(nu < 4096)
+ a7c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a81:	39 df                	cmp    %ebx,%edi
+ a83:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a86:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a8d:	eb 0a                	jmp    a99 <malloc+0x49>
+ a8f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a90:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a92:	8b 48 04             	mov    0x4(%eax),%ecx
+ a95:	39 f9                	cmp    %edi,%ecx
+ a97:	73 47                	jae    ae0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a99:	89 c2                	mov    %eax,%edx
+ a9b:	39 05 60 68 00 00    	cmp    %eax,0x6860
+ aa1:	75 ed                	jne    a90 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ aa3:	83 ec 0c             	sub    $0xc,%esp
+ aa6:	56                   	push   %esi
+ aa7:	e8 9b fb ff ff       	call   647 <sbrk>
+  if(p == (char*)-1)
+ aac:	83 c4 10             	add    $0x10,%esp
+ aaf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ab2:	74 1c                	je     ad0 <malloc+0x80>
+  hp->s.size = nu;
+ ab4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ ab7:	83 ec 0c             	sub    $0xc,%esp
+ aba:	83 c0 08             	add    $0x8,%eax
+ abd:	50                   	push   %eax
+ abe:	e8 fd fe ff ff       	call   9c0 <free>
+  return freep;
+ ac3:	8b 15 60 68 00 00    	mov    0x6860,%edx
+      if((p = morecore(nunits)) == 0)
+ ac9:	83 c4 10             	add    $0x10,%esp
+ acc:	85 d2                	test   %edx,%edx
+ ace:	75 c0                	jne    a90 <malloc+0x40>
+        return 0;
+  }
+}
+ ad0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ ad3:	31 c0                	xor    %eax,%eax
+}
+ ad5:	5b                   	pop    %ebx
+ ad6:	5e                   	pop    %esi
+ ad7:	5f                   	pop    %edi
+ ad8:	5d                   	pop    %ebp
+ ad9:	c3                   	ret
+ ada:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ ae0:	39 cf                	cmp    %ecx,%edi
+ ae2:	74 4c                	je     b30 <malloc+0xe0>
+        p->s.size -= nunits;
+ ae4:	29 f9                	sub    %edi,%ecx
+ ae6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ ae9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ aec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ aef:	89 15 60 68 00 00    	mov    %edx,0x6860
+}
+ af5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ af8:	83 c0 08             	add    $0x8,%eax
+}
+ afb:	5b                   	pop    %ebx
+ afc:	5e                   	pop    %esi
+ afd:	5f                   	pop    %edi
+ afe:	5d                   	pop    %ebp
+ aff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b00:	c7 05 60 68 00 00 64 	movl   $0x6864,0x6860
+ b07:	68 00 00 
+    base.s.size = 0;
+ b0a:	b8 64 68 00 00       	mov    $0x6864,%eax
+    base.s.ptr = freep = prevp = &base;
+ b0f:	c7 05 64 68 00 00 64 	movl   $0x6864,0x6864
+ b16:	68 00 00 
+    base.s.size = 0;
+ b19:	c7 05 68 68 00 00 00 	movl   $0x0,0x6868
+ b20:	00 00 00 
+    if(p->s.size >= nunits){
+ b23:	e9 54 ff ff ff       	jmp    a7c <malloc+0x2c>
+ b28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b2f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b30:	8b 08                	mov    (%eax),%ecx
+ b32:	89 0a                	mov    %ecx,(%edx)
+ b34:	eb b9                	jmp    aef <malloc+0x9f>
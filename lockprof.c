@@ -0,0 +1,52 @@
+// Profile spinlocks by call site while a command runs: for
+// each lock name and PC that acquired it, the acquisitions,
+// how many waited, and the time spent waiting for and holding
+// it, most time waiting first.  Feed the output to lockprof.pl
+// with kernel.sym to turn the PCs into function names.
+// usage: lockprof command [args...]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "lockstat.h"
+
+#define NPROF 512
+
+struct lockprof prof[NPROF];
+
+int
+main(int argc, char *argv[])
+{
+  struct lockprof *p;
+  int i, n, pid;
+
+  if(argc < 2){
+    printf(2, "usage: lockprof command [args...]\n");
+    exit();
+  }
+  if(lockprof(LOCKPROF_START, 0, 0) < 0){
+    printf(2, "lockprof: failed\n");
+    exit();
+  }
+  if((pid = fork()) == 0){
+    exec(argv[1], argv+1);
+    printf(2, "lockprof: exec %s failed\n", argv[1]);
+    exit();
+  }
+  if(pid > 0)
+    wait();
+  lockprof(LOCKPROF_STOP, 0, 0);
+  if((n = lockprof(LOCKPROF_READ, prof, NPROF)) < 0){
+    printf(2, "lockprof: failed\n");
+    exit();
+  }
+
+  printf(1, "pc\t\tlock\t\tacquires\twaited\tKcycles waiting\tKcycles held\n");
+  for(i = 0; i < n; i++){
+    p = &prof[i];
+    printf(1, "%x\t%s\t%s%d\t\t%d\t%d\t\t%d\n", p->pc, p->name,
+           strlen(p->name) < 8 ? "\t" : "", p->nacquire, p->ncontend,
+           (uint)(p->wait >> 10), (uint)(p->hold >> 10));
+  }
+  exit();
+}
@@ -0,0 +1,39 @@
+#!/usr/bin/perl -w
+
+# Replace the kernel PCs at the start of lockprof output
+# lines with function+offset, using the kernel's symbol table.
+# usage: lockprof.pl kernel.sym < output
+
+use strict;
+
+my $symfile = shift or die "usage: lockprof.pl kernel.sym < output\n";
+open(my $fh, '<', $symfile) or die "lockprof.pl: $symfile: $!\n";
+my @syms;
+while(<$fh>){
+    # Address 0 marks a source file name, not a symbol.
+    next unless /^([0-9a-f]+)\s+(\S+)$/ && hex($1) != 0;
+    push @syms, [hex($1), $2];
+}
+close($fh);
+@syms = sort { $a->[0] <=> $b->[0] } @syms;
+
+# The symbol at or below $pc, as name+0xoffset.
+sub symbolize {
+    my ($pc) = @_;
+    my ($lo, $hi) = (0, scalar(@syms) - 1);
+    return sprintf("%x", $pc) if $hi < 0 || $pc < $syms[0][0];
+    while($lo < $hi){
+        my $mid = int(($lo + $hi + 1) / 2);
+        if($syms[$mid][0] <= $pc){
+            $lo = $mid;
+        } else {
+            $hi = $mid - 1;
+        }
+    }
+    return sprintf("%s+0x%x", $syms[$lo][1], $pc - $syms[$lo][0]);
+}
+
+while(<>){
+    s/^([0-9a-f]{8})\b/symbolize(hex($1))/e;
+    print;
+}
@@ -0,0 +1,1870 @@
+
+_lockstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+struct lockstat st0[NLOCKSTAT], st1[NLOCKSTAT];
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 78             	sub    $0x78,%esp
+  struct lockstat *s, t;
+  int i, j, n0, n1, pid;
+
+  n0 = 0;
+  if(argc > 1){
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  17:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc > 1){
+  1a:	0f 8e df 02 00 00    	jle    2ff <main+0x2ff>
+    n0 = lockstat(st0, NLOCKSTAT);
+  20:	50                   	push   %eax
+  21:	50                   	push   %eax
+  22:	6a 40                	push   $0x40
+  24:	68 60 1d 00 00       	push   $0x1d60
+  29:	e8 26 09 00 00       	call   954 <lockstat>
+  2e:	89 45 b0             	mov    %eax,-0x50(%ebp)
+    if((pid = fork()) == 0){
+  31:	e8 5b 07 00 00       	call   791 <fork>
+  36:	83 c4 10             	add    $0x10,%esp
+  39:	85 c0                	test   %eax,%eax
+  3b:	0f 84 db 02 00 00    	je     31c <main+0x31c>
+      exec(argv[1], argv+1);
+      printf(2, "lockstat: exec %s failed\n", argv[1]);
+      exit();
+    }
+    if(pid > 0)
+  41:	7e 05                	jle    48 <main+0x48>
+      wait();
+  43:	e8 5f 07 00 00       	call   7a7 <wait>
+  }
+  if((n1 = lockstat(st1, NLOCKSTAT)) < 0){
+  48:	83 ec 08             	sub    $0x8,%esp
+  4b:	6a 40                	push   $0x40
+  4d:	68 60 12 00 00       	push   $0x1260
+  52:	e8 fd 08 00 00       	call   954 <lockstat>
+  57:	83 c4 10             	add    $0x10,%esp
+  5a:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  5d:	85 c0                	test   %eax,%eax
+  5f:	0f 88 a4 02 00 00    	js     309 <main+0x309>
+    printf(2, "lockstat: failed\n");
+    exit();
+  }
+
+  // Subtract the counts from before the command.
+  for(i = 0; i < n1; i++){
+  65:	0f 84 d6 02 00 00    	je     341 <main+0x341>
+  6b:	c7 45 84 60 12 00 00 	movl   $0x1260,-0x7c(%ebp)
+  72:	bf 60 12 00 00       	mov    $0x1260,%edi
+  77:	31 c9                	xor    %ecx,%ecx
+  79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    s = &st1[i];
+    for(j = 0; j < n0; j++){
+  80:	8b 5d b0             	mov    -0x50(%ebp),%ebx
+  83:	85 db                	test   %ebx,%ebx
+  85:	7e 76                	jle    fd <main+0xfd>
+  87:	89 4d ac             	mov    %ecx,-0x54(%ebp)
+  8a:	be 60 1d 00 00       	mov    $0x1d60,%esi
+  8f:	31 db                	xor    %ebx,%ebx
+  91:	eb 14                	jmp    a7 <main+0xa7>
+  93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  97:	90                   	nop
+  98:	83 c3 01             	add    $0x1,%ebx
+  9b:	83 c6 2c             	add    $0x2c,%esi
+  9e:	39 5d b0             	cmp    %ebx,-0x50(%ebp)
+  a1:	0f 84 41 02 00 00    	je     2e8 <main+0x2e8>
+      if(strcmp(st0[j].name, s->name) == 0){
+  a7:	83 ec 08             	sub    $0x8,%esp
+  aa:	57                   	push   %edi
+  ab:	56                   	push   %esi
+  ac:	e8 ff 02 00 00       	call   3b0 <strcmp>
+  b1:	83 c4 10             	add    $0x10,%esp
+  b4:	85 c0                	test   %eax,%eax
+  b6:	75 e0                	jne    98 <main+0x98>
+        s->nacquire -= st0[j].nacquire;
+  b8:	6b db 2c             	imul   $0x2c,%ebx,%ebx
+  bb:	8b 4d ac             	mov    -0x54(%ebp),%ecx
+  be:	8b 83 70 1d 00 00    	mov    0x1d70(%ebx),%eax
+        s->ncontend -= st0[j].ncontend;
+        s->spin -= st0[j].spin;
+  c4:	8b 93 7c 1d 00 00    	mov    0x1d7c(%ebx),%edx
+        s->nacquire -= st0[j].nacquire;
+  ca:	29 47 10             	sub    %eax,0x10(%edi)
+        s->ncontend -= st0[j].ncontend;
+  cd:	8b 83 74 1d 00 00    	mov    0x1d74(%ebx),%eax
+  d3:	29 47 14             	sub    %eax,0x14(%edi)
+        s->spin -= st0[j].spin;
+  d6:	8b 83 78 1d 00 00    	mov    0x1d78(%ebx),%eax
+  dc:	29 47 18             	sub    %eax,0x18(%edi)
+        s->nspin -= st0[j].nspin;
+  df:	8b 83 80 1d 00 00    	mov    0x1d80(%ebx),%eax
+        s->spin -= st0[j].spin;
+  e5:	19 57 1c             	sbb    %edx,0x1c(%edi)
+        s->nspin -= st0[j].nspin;
+  e8:	29 47 20             	sub    %eax,0x20(%edi)
+        s->nsleep -= st0[j].nsleep;
+  eb:	8b 83 84 1d 00 00    	mov    0x1d84(%ebx),%eax
+  f1:	29 47 24             	sub    %eax,0x24(%edi)
+        s->nhandoff -= st0[j].nhandoff;
+  f4:	8b 83 88 1d 00 00    	mov    0x1d88(%ebx),%eax
+  fa:	29 47 28             	sub    %eax,0x28(%edi)
+  for(i = 0; i < n1; i++){
+  fd:	83 c1 01             	add    $0x1,%ecx
+ 100:	83 c7 2c             	add    $0x2c,%edi
+ 103:	39 4d b4             	cmp    %ecx,-0x4c(%ebp)
+ 106:	0f 85 74 ff ff ff    	jne    80 <main+0x80>
+    }
+  }
+
+  // Sort by time spent waiting.
+  for(i = 0; i < n1; i++){
+    for(j = i+1; j < n1; j++){
+ 10c:	83 7d b4 01          	cmpl   $0x1,-0x4c(%ebp)
+ 110:	0f 84 04 01 00 00    	je     21a <main+0x21a>
+ 116:	bf 8c 12 00 00       	mov    $0x128c,%edi
+ 11b:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 120:	89 f9                	mov    %edi,%ecx
+ 122:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 128:	89 5d 88             	mov    %ebx,-0x78(%ebp)
+ 12b:	89 cf                	mov    %ecx,%edi
+ 12d:	89 de                	mov    %ebx,%esi
+ 12f:	90                   	nop
+      if(st1[j].spin > st1[i].spin){
+ 130:	8b 41 f0             	mov    -0x10(%ecx),%eax
+ 133:	8b 57 18             	mov    0x18(%edi),%edx
+ 136:	39 51 ec             	cmp    %edx,-0x14(%ecx)
+ 139:	89 c2                	mov    %eax,%edx
+ 13b:	1b 57 1c             	sbb    0x1c(%edi),%edx
+ 13e:	0f 83 b5 00 00 00    	jae    1f9 <main+0x1f9>
+        t = st1[i];
+ 144:	8b 51 d8             	mov    -0x28(%ecx),%edx
+ 147:	8b 59 d4             	mov    -0x2c(%ecx),%ebx
+ 14a:	89 55 b0             	mov    %edx,-0x50(%ebp)
+ 14d:	8b 51 dc             	mov    -0x24(%ecx),%edx
+ 150:	89 55 ac             	mov    %edx,-0x54(%ebp)
+ 153:	8b 51 e0             	mov    -0x20(%ecx),%edx
+ 156:	89 55 a8             	mov    %edx,-0x58(%ebp)
+ 159:	8b 51 e4             	mov    -0x1c(%ecx),%edx
+ 15c:	89 55 a0             	mov    %edx,-0x60(%ebp)
+ 15f:	8b 51 e8             	mov    -0x18(%ecx),%edx
+ 162:	89 55 9c             	mov    %edx,-0x64(%ebp)
+ 165:	8b 51 ec             	mov    -0x14(%ecx),%edx
+ 168:	89 55 98             	mov    %edx,-0x68(%ebp)
+ 16b:	8b 51 f4             	mov    -0xc(%ecx),%edx
+ 16e:	89 55 94             	mov    %edx,-0x6c(%ebp)
+ 171:	8b 51 f8             	mov    -0x8(%ecx),%edx
+ 174:	89 55 90             	mov    %edx,-0x70(%ebp)
+ 177:	8b 51 fc             	mov    -0x4(%ecx),%edx
+ 17a:	89 55 8c             	mov    %edx,-0x74(%ebp)
+        st1[i] = st1[j];
+ 17d:	8b 17                	mov    (%edi),%edx
+ 17f:	89 51 d4             	mov    %edx,-0x2c(%ecx)
+ 182:	8b 57 04             	mov    0x4(%edi),%edx
+ 185:	89 51 d8             	mov    %edx,-0x28(%ecx)
+ 188:	8b 57 08             	mov    0x8(%edi),%edx
+ 18b:	89 51 dc             	mov    %edx,-0x24(%ecx)
+ 18e:	8b 57 0c             	mov    0xc(%edi),%edx
+ 191:	89 51 e0             	mov    %edx,-0x20(%ecx)
+ 194:	8b 57 10             	mov    0x10(%edi),%edx
+ 197:	89 51 e4             	mov    %edx,-0x1c(%ecx)
+ 19a:	8b 57 14             	mov    0x14(%edi),%edx
+ 19d:	89 51 e8             	mov    %edx,-0x18(%ecx)
+ 1a0:	8b 57 18             	mov    0x18(%edi),%edx
+ 1a3:	89 51 ec             	mov    %edx,-0x14(%ecx)
+ 1a6:	8b 57 1c             	mov    0x1c(%edi),%edx
+ 1a9:	89 51 f0             	mov    %edx,-0x10(%ecx)
+ 1ac:	8b 57 20             	mov    0x20(%edi),%edx
+ 1af:	89 51 f4             	mov    %edx,-0xc(%ecx)
+ 1b2:	8b 57 24             	mov    0x24(%edi),%edx
+ 1b5:	89 51 f8             	mov    %edx,-0x8(%ecx)
+ 1b8:	8b 57 28             	mov    0x28(%edi),%edx
+ 1bb:	89 51 fc             	mov    %edx,-0x4(%ecx)
+        st1[j] = t;
+ 1be:	8b 55 ac             	mov    -0x54(%ebp),%edx
+ 1c1:	89 1f                	mov    %ebx,(%edi)
+ 1c3:	8b 5d b0             	mov    -0x50(%ebp),%ebx
+ 1c6:	89 57 08             	mov    %edx,0x8(%edi)
+ 1c9:	8b 55 a8             	mov    -0x58(%ebp),%edx
+ 1cc:	89 5f 04             	mov    %ebx,0x4(%edi)
+ 1cf:	89 57 0c             	mov    %edx,0xc(%edi)
+ 1d2:	8b 55 a0             	mov    -0x60(%ebp),%edx
+ 1d5:	89 47 1c             	mov    %eax,0x1c(%edi)
+ 1d8:	89 57 10             	mov    %edx,0x10(%edi)
+ 1db:	8b 55 9c             	mov    -0x64(%ebp),%edx
+ 1de:	89 57 14             	mov    %edx,0x14(%edi)
+ 1e1:	8b 55 98             	mov    -0x68(%ebp),%edx
+ 1e4:	89 57 18             	mov    %edx,0x18(%edi)
+ 1e7:	8b 55 94             	mov    -0x6c(%ebp),%edx
+ 1ea:	89 57 20             	mov    %edx,0x20(%edi)
+ 1ed:	8b 55 90             	mov    -0x70(%ebp),%edx
+ 1f0:	89 57 24             	mov    %edx,0x24(%edi)
+ 1f3:	8b 55 8c             	mov    -0x74(%ebp),%edx
+ 1f6:	89 57 28             	mov    %edx,0x28(%edi)
+    for(j = i+1; j < n1; j++){
+ 1f9:	83 c6 01             	add    $0x1,%esi
+ 1fc:	83 c7 2c             	add    $0x2c,%edi
+ 1ff:	39 75 b4             	cmp    %esi,-0x4c(%ebp)
+ 202:	0f 8f 28 ff ff ff    	jg     130 <main+0x130>
+ 208:	8b 5d 88             	mov    -0x78(%ebp),%ebx
+ 20b:	83 c1 2c             	add    $0x2c,%ecx
+ 20e:	83 c3 01             	add    $0x1,%ebx
+ 211:	39 5d b4             	cmp    %ebx,-0x4c(%ebp)
+ 214:	0f 85 0e ff ff ff    	jne    128 <main+0x128>
+      }
+    }
+  }
+
+  printf(1, "%s\t\t%s\t%s\t%s\t%s\t%s\t%s\n", "lock", "acquires", "waited",
+ 21a:	83 ec 0c             	sub    $0xc,%esp
+ 21d:	68 76 0d 00 00       	push   $0xd76
+ 222:	68 7f 0d 00 00       	push   $0xd7f
+ 227:	68 85 0d 00 00       	push   $0xd85
+ 22c:	68 8a 0d 00 00       	push   $0xd8a
+ 231:	68 9a 0d 00 00       	push   $0xd9a
+ 236:	68 a1 0d 00 00       	push   $0xda1
+ 23b:	68 aa 0d 00 00       	push   $0xdaa
+ 240:	68 af 0d 00 00       	push   $0xdaf
+ 245:	6a 01                	push   $0x1
+ 247:	e8 d4 07 00 00       	call   a20 <printf>
+         "Kcycles waiting", "spun", "slept", "handoffs");
+  for(i = 0; i < n1; i++){
+ 24c:	31 d2                	xor    %edx,%edx
+    s = &st1[i];
+    if(s->nacquire == 0 && s->nspin + s->nsleep == 0)
+      continue;
+    printf(1, "%s\t%s%d\t\t%d\t%d\t\t%d\t%d\t%d\n", s->name,
+ 24e:	8b 5d 84             	mov    -0x7c(%ebp),%ebx
+  printf(1, "%s\t\t%s\t%s\t%s\t%s\t%s\t%s\n", "lock", "acquires", "waited",
+ 251:	83 c4 30             	add    $0x30,%esp
+    printf(1, "%s\t%s%d\t\t%d\t%d\t\t%d\t%d\t%d\n", s->name,
+ 254:	89 d1                	mov    %edx,%ecx
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(s->nacquire == 0 && s->nspin + s->nsleep == 0)
+ 260:	8b 73 20             	mov    0x20(%ebx),%esi
+ 263:	8b 7b 24             	mov    0x24(%ebx),%edi
+ 266:	8b 53 10             	mov    0x10(%ebx),%edx
+ 269:	8d 04 37             	lea    (%edi,%esi,1),%eax
+ 26c:	09 d0                	or     %edx,%eax
+ 26e:	89 55 b0             	mov    %edx,-0x50(%ebp)
+ 271:	74 60                	je     2d3 <main+0x2d3>
+    printf(1, "%s\t%s%d\t\t%d\t%d\t\t%d\t%d\t%d\n", s->name,
+ 273:	8b 43 28             	mov    0x28(%ebx),%eax
+           strlen(s->name) < 8 ? "\t" : "", s->nacquire, s->ncontend,
+           (uint)(s->spin >> 10), s->nspin, s->nsleep, s->nhandoff);
+ 276:	8b 53 1c             	mov    0x1c(%ebx),%edx
+ 279:	89 4d 9c             	mov    %ecx,-0x64(%ebp)
+           strlen(s->name) < 8 ? "\t" : "", s->nacquire, s->ncontend,
+ 27c:	83 ec 0c             	sub    $0xc,%esp
+    printf(1, "%s\t%s%d\t\t%d\t%d\t\t%d\t%d\t%d\n", s->name,
+ 27f:	8b 4b 14             	mov    0x14(%ebx),%ecx
+ 282:	89 45 ac             	mov    %eax,-0x54(%ebp)
+           (uint)(s->spin >> 10), s->nspin, s->nsleep, s->nhandoff);
+ 285:	8b 43 18             	mov    0x18(%ebx),%eax
+    printf(1, "%s\t%s%d\t\t%d\t%d\t\t%d\t%d\t%d\n", s->name,
+ 288:	89 4d a8             	mov    %ecx,-0x58(%ebp)
+           (uint)(s->spin >> 10), s->nspin, s->nsleep, s->nhandoff);
+ 28b:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+ 28f:	c1 ea 0a             	shr    $0xa,%edx
+ 292:	89 55 a4             	mov    %edx,-0x5c(%ebp)
+ 295:	89 45 a0             	mov    %eax,-0x60(%ebp)
+           strlen(s->name) < 8 ? "\t" : "", s->nacquire, s->ncontend,
+ 298:	53                   	push   %ebx
+ 299:	e8 72 01 00 00       	call   410 <strlen>
+    printf(1, "%s\t%s%d\t\t%d\t%d\t\t%d\t%d\t%d\n", s->name,
+ 29e:	5a                   	pop    %edx
+ 29f:	ba 49 0d 00 00       	mov    $0xd49,%edx
+ 2a4:	59                   	pop    %ecx
+ 2a5:	83 f8 07             	cmp    $0x7,%eax
+ 2a8:	b8 48 0d 00 00       	mov    $0xd48,%eax
+ 2ad:	ff 75 ac             	push   -0x54(%ebp)
+ 2b0:	0f 47 c2             	cmova  %edx,%eax
+ 2b3:	57                   	push   %edi
+ 2b4:	56                   	push   %esi
+ 2b5:	ff 75 a0             	push   -0x60(%ebp)
+ 2b8:	ff 75 a8             	push   -0x58(%ebp)
+ 2bb:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 2be:	52                   	push   %edx
+ 2bf:	50                   	push   %eax
+ 2c0:	53                   	push   %ebx
+ 2c1:	68 c6 0d 00 00       	push   $0xdc6
+ 2c6:	6a 01                	push   $0x1
+ 2c8:	e8 53 07 00 00       	call   a20 <printf>
+ 2cd:	8b 4d 9c             	mov    -0x64(%ebp),%ecx
+ 2d0:	83 c4 30             	add    $0x30,%esp
+  for(i = 0; i < n1; i++){
+ 2d3:	83 c1 01             	add    $0x1,%ecx
+ 2d6:	83 c3 2c             	add    $0x2c,%ebx
+ 2d9:	39 4d b4             	cmp    %ecx,-0x4c(%ebp)
+ 2dc:	75 82                	jne    260 <main+0x260>
+  }
+  exit();
+ 2de:	e8 b9 04 00 00       	call   79c <exit>
+ 2e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2e7:	90                   	nop
+  for(i = 0; i < n1; i++){
+ 2e8:	8b 4d ac             	mov    -0x54(%ebp),%ecx
+ 2eb:	83 c7 2c             	add    $0x2c,%edi
+ 2ee:	83 c1 01             	add    $0x1,%ecx
+ 2f1:	39 4d b4             	cmp    %ecx,-0x4c(%ebp)
+ 2f4:	0f 85 8d fd ff ff    	jne    87 <main+0x87>
+ 2fa:	e9 0d fe ff ff       	jmp    10c <main+0x10c>
+  n0 = 0;
+ 2ff:	31 ff                	xor    %edi,%edi
+ 301:	89 7d b0             	mov    %edi,-0x50(%ebp)
+ 304:	e9 3f fd ff ff       	jmp    48 <main+0x48>
+    printf(2, "lockstat: failed\n");
+ 309:	56                   	push   %esi
+ 30a:	56                   	push   %esi
+ 30b:	68 64 0d 00 00       	push   $0xd64
+ 310:	6a 02                	push   $0x2
+ 312:	e8 09 07 00 00       	call   a20 <printf>
+    exit();
+ 317:	e8 80 04 00 00       	call   79c <exit>
+      exec(argv[1], argv+1);
+ 31c:	50                   	push   %eax
+ 31d:	50                   	push   %eax
+ 31e:	8d 43 04             	lea    0x4(%ebx),%eax
+ 321:	50                   	push   %eax
+ 322:	ff 73 04             	push   0x4(%ebx)
+ 325:	e8 bf 04 00 00       	call   7e9 <exec>
+      printf(2, "lockstat: exec %s failed\n", argv[1]);
+ 32a:	83 c4 0c             	add    $0xc,%esp
+ 32d:	ff 73 04             	push   0x4(%ebx)
+ 330:	68 4a 0d 00 00       	push   $0xd4a
+ 335:	6a 02                	push   $0x2
+ 337:	e8 e4 06 00 00       	call   a20 <printf>
+      exit();
+ 33c:	e8 5b 04 00 00       	call   79c <exit>
+  printf(1, "%s\t\t%s\t%s\t%s\t%s\t%s\t%s\n", "lock", "acquires", "waited",
+ 341:	83 ec 0c             	sub    $0xc,%esp
+ 344:	68 76 0d 00 00       	push   $0xd76
+ 349:	68 7f 0d 00 00       	push   $0xd7f
+ 34e:	68 85 0d 00 00       	push   $0xd85
+ 353:	68 8a 0d 00 00       	push   $0xd8a
+ 358:	68 9a 0d 00 00       	push   $0xd9a
+ 35d:	68 a1 0d 00 00       	push   $0xda1
+ 362:	68 aa 0d 00 00       	push   $0xdaa
+ 367:	68 af 0d 00 00       	push   $0xdaf
+ 36c:	6a 01                	push   $0x1
+ 36e:	e8 ad 06 00 00       	call   a20 <printf>
+ 373:	83 c4 30             	add    $0x30,%esp
+ 376:	e9 63 ff ff ff       	jmp    2de <main+0x2de>
+ 37b:	66 90                	xchg   %ax,%ax
+ 37d:	66 90                	xchg   %ax,%ax
+ 37f:	90                   	nop
+
+00000380 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 380:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 381:	31 c0                	xor    %eax,%eax
+{
+ 383:	89 e5                	mov    %esp,%ebp
+ 385:	53                   	push   %ebx
+ 386:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 389:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 390:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 394:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 397:	83 c0 01             	add    $0x1,%eax
+ 39a:	84 d2                	test   %dl,%dl
+ 39c:	75 f2                	jne    390 <strcpy+0x10>
+    ;
+  return os;
+}
+ 39e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3a1:	89 c8                	mov    %ecx,%eax
+ 3a3:	c9                   	leave
+ 3a4:	c3                   	ret
+ 3a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	53                   	push   %ebx
+ 3b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3ba:	0f b6 02             	movzbl (%edx),%eax
+ 3bd:	84 c0                	test   %al,%al
+ 3bf:	75 17                	jne    3d8 <strcmp+0x28>
+ 3c1:	eb 3a                	jmp    3fd <strcmp+0x4d>
+ 3c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3c7:	90                   	nop
+ 3c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3cc:	83 c2 01             	add    $0x1,%edx
+ 3cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3d2:	84 c0                	test   %al,%al
+ 3d4:	74 1a                	je     3f0 <strcmp+0x40>
+    p++, q++;
+ 3d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3d8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3db:	38 c3                	cmp    %al,%bl
+ 3dd:	74 e9                	je     3c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3df:	29 d8                	sub    %ebx,%eax
+}
+ 3e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3e4:	c9                   	leave
+ 3e5:	c3                   	ret
+ 3e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3f4:	31 c0                	xor    %eax,%eax
+ 3f6:	29 d8                	sub    %ebx,%eax
+}
+ 3f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3fb:	c9                   	leave
+ 3fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 400:	31 c0                	xor    %eax,%eax
+ 402:	eb db                	jmp    3df <strcmp+0x2f>
+ 404:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 40f:	90                   	nop
+
+00000410 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 416:	80 3a 00             	cmpb   $0x0,(%edx)
+ 419:	74 15                	je     430 <strlen+0x20>
+ 41b:	31 c0                	xor    %eax,%eax
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+ 420:	83 c0 01             	add    $0x1,%eax
+ 423:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 427:	89 c1                	mov    %eax,%ecx
+ 429:	75 f5                	jne    420 <strlen+0x10>
+    ;
+  return n;
+}
+ 42b:	89 c8                	mov    %ecx,%eax
+ 42d:	5d                   	pop    %ebp
+ 42e:	c3                   	ret
+ 42f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 430:	31 c9                	xor    %ecx,%ecx
+}
+ 432:	5d                   	pop    %ebp
+ 433:	89 c8                	mov    %ecx,%eax
+ 435:	c3                   	ret
+ 436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000440 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	57                   	push   %edi
+ 444:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 447:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 44a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 44d:	89 d7                	mov    %edx,%edi
+ 44f:	fc                   	cld
+ 450:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 452:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 455:	89 d0                	mov    %edx,%eax
+ 457:	c9                   	leave
+ 458:	c3                   	ret
+ 459:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	8b 45 08             	mov    0x8(%ebp),%eax
+ 466:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 46a:	0f b6 10             	movzbl (%eax),%edx
+ 46d:	84 d2                	test   %dl,%dl
+ 46f:	75 12                	jne    483 <strchr+0x23>
+ 471:	eb 1d                	jmp    490 <strchr+0x30>
+ 473:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 477:	90                   	nop
+ 478:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 47c:	83 c0 01             	add    $0x1,%eax
+ 47f:	84 d2                	test   %dl,%dl
+ 481:	74 0d                	je     490 <strchr+0x30>
+    if(*s == c)
+ 483:	38 d1                	cmp    %dl,%cl
+ 485:	75 f1                	jne    478 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 487:	5d                   	pop    %ebp
+ 488:	c3                   	ret
+ 489:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 490:	31 c0                	xor    %eax,%eax
+}
+ 492:	5d                   	pop    %ebp
+ 493:	c3                   	ret
+ 494:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 49f:	90                   	nop
+
+000004a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	57                   	push   %edi
+ 4a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 4a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 4a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 4a9:	31 db                	xor    %ebx,%ebx
+{
+ 4ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 4ae:	eb 27                	jmp    4d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 4b0:	83 ec 04             	sub    $0x4,%esp
+ 4b3:	6a 01                	push   $0x1
+ 4b5:	56                   	push   %esi
+ 4b6:	6a 00                	push   $0x0
+ 4b8:	e8 00 03 00 00       	call   7bd <read>
+    if(cc < 1)
+ 4bd:	83 c4 10             	add    $0x10,%esp
+ 4c0:	85 c0                	test   %eax,%eax
+ 4c2:	7e 1d                	jle    4e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 4c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 4cf:	3c 0a                	cmp    $0xa,%al
+ 4d1:	74 10                	je     4e3 <gets+0x43>
+ 4d3:	3c 0d                	cmp    $0xd,%al
+ 4d5:	74 0c                	je     4e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 4d7:	89 df                	mov    %ebx,%edi
+ 4d9:	83 c3 01             	add    $0x1,%ebx
+ 4dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 4df:	7c cf                	jl     4b0 <gets+0x10>
+ 4e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4ed:	5b                   	pop    %ebx
+ 4ee:	5e                   	pop    %esi
+ 4ef:	5f                   	pop    %edi
+ 4f0:	5d                   	pop    %ebp
+ 4f1:	c3                   	ret
+ 4f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000500 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	56                   	push   %esi
+ 504:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 505:	83 ec 08             	sub    $0x8,%esp
+ 508:	6a 00                	push   $0x0
+ 50a:	ff 75 08             	push   0x8(%ebp)
+ 50d:	e8 e2 02 00 00       	call   7f4 <open>
+  if(fd < 0)
+ 512:	83 c4 10             	add    $0x10,%esp
+ 515:	85 c0                	test   %eax,%eax
+ 517:	78 27                	js     540 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 519:	83 ec 08             	sub    $0x8,%esp
+ 51c:	ff 75 0c             	push   0xc(%ebp)
+ 51f:	89 c3                	mov    %eax,%ebx
+ 521:	50                   	push   %eax
+ 522:	e8 ee 02 00 00       	call   815 <fstat>
+  close(fd);
+ 527:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 52a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 52c:	e8 a2 02 00 00       	call   7d3 <close>
+  return r;
+ 531:	83 c4 10             	add    $0x10,%esp
+}
+ 534:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 537:	89 f0                	mov    %esi,%eax
+ 539:	5b                   	pop    %ebx
+ 53a:	5e                   	pop    %esi
+ 53b:	5d                   	pop    %ebp
+ 53c:	c3                   	ret
+ 53d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 540:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 545:	eb ed                	jmp    534 <stat+0x34>
+ 547:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54e:	66 90                	xchg   %ax,%ax
+
+00000550 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	53                   	push   %ebx
+ 554:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 557:	0f be 02             	movsbl (%edx),%eax
+ 55a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 55d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 560:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 565:	77 1e                	ja     585 <atoi+0x35>
+ 567:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 570:	83 c2 01             	add    $0x1,%edx
+ 573:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 576:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 57a:	0f be 02             	movsbl (%edx),%eax
+ 57d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 580:	80 fb 09             	cmp    $0x9,%bl
+ 583:	76 eb                	jbe    570 <atoi+0x20>
+  return n;
+}
+ 585:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 588:	89 c8                	mov    %ecx,%eax
+ 58a:	c9                   	leave
+ 58b:	c3                   	ret
+ 58c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000590 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	57                   	push   %edi
+ 594:	56                   	push   %esi
+ 595:	8b 45 10             	mov    0x10(%ebp),%eax
+ 598:	8b 55 08             	mov    0x8(%ebp),%edx
+ 59b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 59e:	85 c0                	test   %eax,%eax
+ 5a0:	7e 13                	jle    5b5 <memmove+0x25>
+ 5a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 5a4:	89 d7                	mov    %edx,%edi
+ 5a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 5b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 5b1:	39 f8                	cmp    %edi,%eax
+ 5b3:	75 fb                	jne    5b0 <memmove+0x20>
+  return vdst;
+}
+ 5b5:	5e                   	pop    %esi
+ 5b6:	89 d0                	mov    %edx,%eax
+ 5b8:	5f                   	pop    %edi
+ 5b9:	5d                   	pop    %ebp
+ 5ba:	c3                   	ret
+ 5bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5bf:	90                   	nop
+
+000005c0 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 5c0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 5c5:	85 c0                	test   %eax,%eax
+ 5c7:	74 07                	je     5d0 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 5c9:	c3                   	ret
+ 5ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 5d0:	e9 77 02 00 00       	jmp    84c <sysgetpid>
+ 5d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005e0 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 5e0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 5e5:	c3                   	ret
+ 5e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005f0 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 5f0:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 5f1:	31 d2                	xor    %edx,%edx
+ 5f3:	89 e5                	mov    %esp,%ebp
+ 5f5:	53                   	push   %ebx
+ 5f6:	83 ec 04             	sub    $0x4,%esp
+ 5f9:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 5fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 5ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 602:	85 c9                	test   %ecx,%ecx
+ 604:	7e 08                	jle    60e <cyclereport+0x1e>
+ 606:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 608:	89 d8                	mov    %ebx,%eax
+ 60a:	f7 f1                	div    %ecx
+ 60c:	89 c2                	mov    %eax,%edx
+ 60e:	83 ec 08             	sub    $0x8,%esp
+ 611:	52                   	push   %edx
+ 612:	ff 75 0c             	push   0xc(%ebp)
+ 615:	51                   	push   %ecx
+ 616:	ff 75 08             	push   0x8(%ebp)
+ 619:	68 e0 0d 00 00       	push   $0xde0
+ 61e:	6a 01                	push   $0x1
+ 620:	e8 fb 03 00 00       	call   a20 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 625:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 628:	83 c4 20             	add    $0x20,%esp
+ 62b:	c9                   	leave
+ 62c:	c3                   	ret
+ 62d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000630 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 633:	8b 45 08             	mov    0x8(%ebp),%eax
+ 636:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 63c:	5d                   	pop    %ebp
+ 63d:	c3                   	ret
+ 63e:	66 90                	xchg   %ax,%ax
+
+00000640 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 640:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 641:	31 c0                	xor    %eax,%eax
+ 643:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 648:	89 e5                	mov    %esp,%ebp
+ 64a:	56                   	push   %esi
+ 64b:	53                   	push   %ebx
+ 64c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 64f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 653:	85 c0                	test   %eax,%eax
+ 655:	74 30                	je     687 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 657:	83 f8 02             	cmp    $0x2,%eax
+ 65a:	74 0c                	je     668 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 65c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 661:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 664:	85 c0                	test   %eax,%eax
+ 666:	74 1f                	je     687 <mutex_lock+0x47>
+ 668:	be 02 00 00 00       	mov    $0x2,%esi
+ 66d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 670:	83 ec 08             	sub    $0x8,%esp
+ 673:	6a 02                	push   $0x2
+ 675:	53                   	push   %ebx
+ 676:	e8 8c 02 00 00       	call   907 <futex_wait>
+ 67b:	89 f0                	mov    %esi,%eax
+ 67d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 680:	83 c4 10             	add    $0x10,%esp
+ 683:	85 c0                	test   %eax,%eax
+ 685:	75 e9                	jne    670 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 687:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 68a:	5b                   	pop    %ebx
+ 68b:	5e                   	pop    %esi
+ 68c:	5d                   	pop    %ebp
+ 68d:	c3                   	ret
+ 68e:	66 90                	xchg   %ax,%ax
+
+00000690 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 690:	55                   	push   %ebp
+ 691:	89 e5                	mov    %esp,%ebp
+ 693:	83 ec 08             	sub    $0x8,%esp
+ 696:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 699:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 69d:	75 09                	jne    6a8 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 69f:	c9                   	leave
+ 6a0:	c3                   	ret
+ 6a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 6a8:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 6ab:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 6b1:	6a 01                	push   $0x1
+ 6b3:	50                   	push   %eax
+ 6b4:	e8 59 02 00 00       	call   912 <futex_wake>
+ 6b9:	83 c4 10             	add    $0x10,%esp
+}
+ 6bc:	c9                   	leave
+ 6bd:	c3                   	ret
+ 6be:	66 90                	xchg   %ax,%ax
+
+000006c0 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 6c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 6cc:	5d                   	pop    %ebp
+ 6cd:	c3                   	ret
+ 6ce:	66 90                	xchg   %ax,%ax
+
+000006d0 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	57                   	push   %edi
+ 6d4:	56                   	push   %esi
+ 6d5:	53                   	push   %ebx
+ 6d6:	83 ec 0c             	sub    $0xc,%esp
+ 6d9:	8b 75 08             	mov    0x8(%ebp),%esi
+ 6dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 6df:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 6e1:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 6e5:	75 21                	jne    708 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 6e7:	83 ec 08             	sub    $0x8,%esp
+ 6ea:	57                   	push   %edi
+ 6eb:	56                   	push   %esi
+ 6ec:	e8 16 02 00 00       	call   907 <futex_wait>
+  mutex_lock(m);
+ 6f1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 6f4:	83 c4 10             	add    $0x10,%esp
+}
+ 6f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6fa:	5b                   	pop    %ebx
+ 6fb:	5e                   	pop    %esi
+ 6fc:	5f                   	pop    %edi
+ 6fd:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 6fe:	e9 3d ff ff ff       	jmp    640 <mutex_lock>
+ 703:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 707:	90                   	nop
+    futex_wake(&m->v, 1);
+ 708:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 70b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 711:	6a 01                	push   $0x1
+ 713:	53                   	push   %ebx
+ 714:	e8 f9 01 00 00       	call   912 <futex_wake>
+ 719:	83 c4 10             	add    $0x10,%esp
+ 71c:	eb c9                	jmp    6e7 <cond_wait+0x17>
+ 71e:	66 90                	xchg   %ax,%ax
+
+00000720 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 720:	55                   	push   %ebp
+ 721:	89 e5                	mov    %esp,%ebp
+ 723:	83 ec 10             	sub    $0x10,%esp
+ 726:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 729:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 72d:	6a 01                	push   $0x1
+ 72f:	50                   	push   %eax
+ 730:	e8 dd 01 00 00       	call   912 <futex_wake>
+}
+ 735:	83 c4 10             	add    $0x10,%esp
+ 738:	c9                   	leave
+ 739:	c3                   	ret
+ 73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000740 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 740:	55                   	push   %ebp
+ 741:	89 e5                	mov    %esp,%ebp
+ 743:	83 ec 10             	sub    $0x10,%esp
+ 746:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 749:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 74d:	68 ff ff ff 7f       	push   $0x7fffffff
+ 752:	50                   	push   %eax
+ 753:	e8 ba 01 00 00       	call   912 <futex_wake>
+}
+ 758:	83 c4 10             	add    $0x10,%esp
+ 75b:	c9                   	leave
+ 75c:	c3                   	ret
+
+0000075d <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 75d:	50                   	push   %eax
+  pushl %ebx
+ 75e:	53                   	push   %ebx
+  movl $1, %eax
+ 75f:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 764:	0f a2                	cpuid
+  popl %ebx
+ 766:	5b                   	pop    %ebx
+  popl %eax
+ 767:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 768:	c7 05 50 12 00 00 8e 	movl   $0x78e,0x1250
+ 76f:	07 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 772:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 778:	74 14                	je     78e <sysint>
+  movl $sysfast, syscallvec
+ 77a:	c7 05 50 12 00 00 84 	movl   $0x784,0x1250
+ 781:	07 00 00 
+
+00000784 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 784:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 786:	ba 8d 07 00 00       	mov    $0x78d,%edx
+  sysenter
+ 78b:	0f 34                	sysenter
+1:
+  ret
+ 78d:	c3                   	ret
+
+0000078e <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 78e:	cd 40                	int    $0x40
+  ret
+ 790:	c3                   	ret
+
+00000791 <fork>:
+
+SYSCALL(fork)
+ 791:	b8 01 00 00 00       	mov    $0x1,%eax
+ 796:	ff 25 50 12 00 00    	jmp    *0x1250
+
+0000079c <exit>:
+SYSCALL(exit)
+ 79c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7a1:	ff 25 50 12 00 00    	jmp    *0x1250
+
+000007a7 <wait>:
+SYSCALL(wait)
+ 7a7:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7ac:	ff 25 50 12 00 00    	jmp    *0x1250
+
+000007b2 <pipe>:
+SYSCALL(pipe)
+ 7b2:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7b7:	ff 25 50 12 00 00    	jmp    *0x1250
+
+000007bd <read>:
+SYSCALL(read)
+ 7bd:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7c2:	ff 25 50 12 00 00    	jmp    *0x1250
+
+000007c8 <write>:
+SYSCALL(write)
+ 7c8:	b8 10 00 00 00       	mov    $0x10,%eax
+ 7cd:	ff 25 50 12 00 00    	jmp    *0x1250
+
+000007d3 <close>:
+SYSCALL(close)
+ 7d3:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7d8:	ff 25 50 12 00 00    	jmp    *0x1250
+
+000007de <kill>:
+SYSCALL(kill)
+ 7de:	b8 06 00 00 00       	mov    $0x6,%eax
+ 7e3:	ff 25 50 12 00 00    	jmp    *0x1250
+
+000007e9 <exec>:
+SYSCALL(exec)
+ 7e9:	b8 07 00 00 00       	mov    $0x7,%eax
+ 7ee:	ff 25 50 12 00 00    	jmp    *0x1250
+
+000007f4 <open>:
+SYSCALL(open)
+ 7f4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 7f9:	ff 25 50 12 00 00    	jmp    *0x1250
+
+000007ff <mknod>:
+SYSCALL(mknod)
+ 7ff:	b8 11 00 00 00       	mov    $0x11,%eax
+ 804:	ff 25 50 12 00 00    	jmp    *0x1250
+
+0000080a <unlink>:
+SYSCALL(unlink)
+ 80a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 80f:	ff 25 50 12 00 00    	jmp    *0x1250
+
+00000815 <fstat>:
+SYSCALL(fstat)
+ 815:	b8 08 00 00 00       	mov    $0x8,%eax
+ 81a:	ff 25 50 12 00 00    	jmp    *0x1250
+
+00000820 <link>:
+SYSCALL(link)
+ 820:	b8 13 00 00 00       	mov    $0x13,%eax
+ 825:	ff 25 50 12 00 00    	jmp    *0x1250
+
+0000082b <mkdir>:
+SYSCALL(mkdir)
+ 82b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 830:	ff 25 50 12 00 00    	jmp    *0x1250
+
+00000836 <chdir>:
+SYSCALL(chdir)
+ 836:	b8 09 00 00 00       	mov    $0x9,%eax
+ 83b:	ff 25 50 12 00 00    	jmp    *0x1250
+
+00000841 <dup>:
+SYSCALL(dup)
+ 841:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 846:	ff 25 50 12 00 00    	jmp    *0x1250
+
+0000084c <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 84c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 851:	ff 25 50 12 00 00    	jmp    *0x1250
+
+00000857 <sbrk>:
+SYSCALL(sbrk)
+ 857:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 85c:	ff 25 50 12 00 00    	jmp    *0x1250
+
+00000862 <sleep>:
+SYSCALL(sleep)
+ 862:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 867:	ff 25 50 12 00 00    	jmp    *0x1250
+
+0000086d <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 86d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 872:	ff 25 50 12 00 00    	jmp    *0x1250
+
+00000878 <swapread>:
+SYSCALL(swapread)
+ 878:	b8 16 00 00 00       	mov    $0x16,%eax
+ 87d:	ff 25 50 12 00 00    	jmp    *0x1250
+
+00000883 <swapwrite>:
+SYSCALL(swapwrite)
+ 883:	b8 17 00 00 00       	mov    $0x17,%eax
+ 888:	ff 25 50 12 00 00    	jmp    *0x1250
+
+0000088e <swapstat>:
+SYSCALL(swapstat)
+ 88e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 893:	ff 25 50 12 00 00    	jmp    *0x1250
+
+00000899 <madvise>:
+SYSCALL(madvise)
+ 899:	b8 19 00 00 00       	mov    $0x19,%eax
+ 89e:	ff 25 50 12 00 00    	jmp    *0x1250
+
+000008a4 <mlock>:
+SYSCALL(mlock)
+ 8a4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 8a9:	ff 25 50 12 00 00    	jmp    *0x1250
+
+000008af <munlock>:
+SYSCALL(munlock)
+ 8af:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 8b4:	ff 25 50 12 00 00    	jmp    *0x1250
+
+000008ba <membench>:
+SYSCALL(membench)
+ 8ba:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 8bf:	ff 25 50 12 00 00    	jmp    *0x1250
+
+000008c5 <nice>:
+SYSCALL(nice)
+ 8c5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 8ca:	ff 25 50 12 00 00    	jmp    *0x1250
+
+000008d0 <setpriority>:
+SYSCALL(setpriority)
+ 8d0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 8d5:	ff 25 50 12 00 00    	jmp    *0x1250
+
+000008db <usleep>:
+SYSCALL(usleep)
+ 8db:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 8e0:	ff 25 50 12 00 00    	jmp    *0x1250
+
+000008e6 <cpustat>:
+SYSCALL(cpustat)
+ 8e6:	b8 20 00 00 00       	mov    $0x20,%eax
+ 8eb:	ff 25 50 12 00 00    	jmp    *0x1250
+
+000008f1 <clone>:
+SYSCALL(clone)
+ 8f1:	b8 21 00 00 00       	mov    $0x21,%eax
+ 8f6:	ff 25 50 12 00 00    	jmp    *0x1250
+
+000008fc <join>:
+SYSCALL(join)
+ 8fc:	b8 22 00 00 00       	mov    $0x22,%eax
+ 901:	ff 25 50 12 00 00    	jmp    *0x1250
+
+00000907 <futex_wait>:
+SYSCALL(futex_wait)
+ 907:	b8 23 00 00 00       	mov    $0x23,%eax
+ 90c:	ff 25 50 12 00 00    	jmp    *0x1250
+
+00000912 <futex_wake>:
+SYSCALL(futex_wake)
+ 912:	b8 24 00 00 00       	mov    $0x24,%eax
+ 917:	ff 25 50 12 00 00    	jmp    *0x1250
+
+0000091d <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 91d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 922:	ff 25 50 12 00 00    	jmp    *0x1250
+
+00000928 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 928:	b8 26 00 00 00       	mov    $0x26,%eax
+ 92d:	ff 25 50 12 00 00    	jmp    *0x1250
+
+00000933 <getcpu>:
+SYSCALL(getcpu)
+ 933:	b8 27 00 00 00       	mov    $0x27,%eax
+ 938:	ff 25 50 12 00 00    	jmp    *0x1250
+
+0000093e <migrations>:
+SYSCALL(migrations)
+ 93e:	b8 28 00 00 00       	mov    $0x28,%eax
+ 943:	ff 25 50 12 00 00    	jmp    *0x1250
+
+00000949 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 949:	b8 29 00 00 00       	mov    $0x29,%eax
+ 94e:	ff 25 50 12 00 00    	jmp    *0x1250
+
+00000954 <lockstat>:
+SYSCALL(lockstat)
+ 954:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 959:	ff 25 50 12 00 00    	jmp    *0x1250
+
+0000095f <lockprof>:
+SYSCALL(lockprof)
+ 95f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 964:	ff 25 50 12 00 00    	jmp    *0x1250
+
+0000096a <bcachestat>:
+SYSCALL(bcachestat)
+ 96a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 96f:	ff 25 50 12 00 00    	jmp    *0x1250
+ 975:	66 90                	xchg   %ax,%ax
+ 977:	66 90                	xchg   %ax,%ax
+ 979:	66 90                	xchg   %ax,%ax
+ 97b:	66 90                	xchg   %ax,%ax
+ 97d:	66 90                	xchg   %ax,%ax
+ 97f:	90                   	nop
+
+00000980 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 980:	55                   	push   %ebp
+ 981:	89 e5                	mov    %esp,%ebp
+ 983:	57                   	push   %edi
+ 984:	56                   	push   %esi
+ 985:	53                   	push   %ebx
+ 986:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 988:	89 d1                	mov    %edx,%ecx
+{
+ 98a:	83 ec 3c             	sub    $0x3c,%esp
+ 98d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 990:	85 d2                	test   %edx,%edx
+ 992:	0f 89 80 00 00 00    	jns    a18 <printint+0x98>
+ 998:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 99c:	74 7a                	je     a18 <printint+0x98>
+    x = -xx;
+ 99e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 9a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 9a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 9a8:	31 f6                	xor    %esi,%esi
+ 9aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 9b0:	89 c8                	mov    %ecx,%eax
+ 9b2:	31 d2                	xor    %edx,%edx
+ 9b4:	89 f7                	mov    %esi,%edi
+ 9b6:	f7 f3                	div    %ebx
+ 9b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 9bb:	0f b6 92 5c 0e 00 00 	movzbl 0xe5c(%edx),%edx
+ 9c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 9c6:	89 ca                	mov    %ecx,%edx
+ 9c8:	89 c1                	mov    %eax,%ecx
+ 9ca:	39 da                	cmp    %ebx,%edx
+ 9cc:	73 e2                	jae    9b0 <printint+0x30>
+  if(neg)
+ 9ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 9d1:	85 c0                	test   %eax,%eax
+ 9d3:	74 07                	je     9dc <printint+0x5c>
+    buf[i++] = '-';
+ 9d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 9da:	89 f7                	mov    %esi,%edi
+ 9dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 9df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 9e2:	01 df                	add    %ebx,%edi
+ 9e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 9e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 9eb:	83 ec 04             	sub    $0x4,%esp
+ 9ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 9f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 9f4:	6a 01                	push   $0x1
+ 9f6:	50                   	push   %eax
+ 9f7:	56                   	push   %esi
+ 9f8:	e8 cb fd ff ff       	call   7c8 <write>
+  while(--i >= 0)
+ 9fd:	89 f8                	mov    %edi,%eax
+ 9ff:	83 c4 10             	add    $0x10,%esp
+ a02:	83 ef 01             	sub    $0x1,%edi
+ a05:	39 d8                	cmp    %ebx,%eax
+ a07:	75 df                	jne    9e8 <printint+0x68>
+}
+ a09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a0c:	5b                   	pop    %ebx
+ a0d:	5e                   	pop    %esi
+ a0e:	5f                   	pop    %edi
+ a0f:	5d                   	pop    %ebp
+ a10:	c3                   	ret
+ a11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ a18:	31 c0                	xor    %eax,%eax
+ a1a:	eb 89                	jmp    9a5 <printint+0x25>
+ a1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a20 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ a20:	55                   	push   %ebp
+ a21:	89 e5                	mov    %esp,%ebp
+ a23:	57                   	push   %edi
+ a24:	56                   	push   %esi
+ a25:	53                   	push   %ebx
+ a26:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ a29:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ a2c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ a2f:	0f b6 1e             	movzbl (%esi),%ebx
+ a32:	83 c6 01             	add    $0x1,%esi
+ a35:	84 db                	test   %bl,%bl
+ a37:	74 67                	je     aa0 <printf+0x80>
+ a39:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ a3c:	31 d2                	xor    %edx,%edx
+ a3e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ a41:	eb 34                	jmp    a77 <printf+0x57>
+ a43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a47:	90                   	nop
+ a48:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ a4b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ a50:	83 f8 25             	cmp    $0x25,%eax
+ a53:	74 18                	je     a6d <printf+0x4d>
+  write(fd, &c, 1);
+ a55:	83 ec 04             	sub    $0x4,%esp
+ a58:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ a5b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a5e:	6a 01                	push   $0x1
+ a60:	50                   	push   %eax
+ a61:	57                   	push   %edi
+ a62:	e8 61 fd ff ff       	call   7c8 <write>
+ a67:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ a6a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ a6d:	0f b6 1e             	movzbl (%esi),%ebx
+ a70:	83 c6 01             	add    $0x1,%esi
+ a73:	84 db                	test   %bl,%bl
+ a75:	74 29                	je     aa0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ a77:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ a7a:	85 d2                	test   %edx,%edx
+ a7c:	74 ca                	je     a48 <printf+0x28>
+      }
+    } else if(state == '%'){
+ a7e:	83 fa 25             	cmp    $0x25,%edx
+ a81:	75 ea                	jne    a6d <printf+0x4d>
+      if(c == 'd'){
+ a83:	83 f8 25             	cmp    $0x25,%eax
+ a86:	0f 84 24 01 00 00    	je     bb0 <printf+0x190>
+ a8c:	83 e8 63             	sub    $0x63,%eax
+ a8f:	83 f8 15             	cmp    $0x15,%eax
+ a92:	77 1c                	ja     ab0 <printf+0x90>
+ a94:	ff 24 85 04 0e 00 00 	jmp    *0xe04(,%eax,4)
+ a9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a9f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ aa0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ aa3:	5b                   	pop    %ebx
+ aa4:	5e                   	pop    %esi
+ aa5:	5f                   	pop    %edi
+ aa6:	5d                   	pop    %ebp
+ aa7:	c3                   	ret
+ aa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aaf:	90                   	nop
+  write(fd, &c, 1);
+ ab0:	83 ec 04             	sub    $0x4,%esp
+ ab3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ab6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ aba:	6a 01                	push   $0x1
+ abc:	52                   	push   %edx
+ abd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ ac0:	57                   	push   %edi
+ ac1:	e8 02 fd ff ff       	call   7c8 <write>
+ ac6:	83 c4 0c             	add    $0xc,%esp
+ ac9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ acc:	6a 01                	push   $0x1
+ ace:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ ad1:	52                   	push   %edx
+ ad2:	57                   	push   %edi
+ ad3:	e8 f0 fc ff ff       	call   7c8 <write>
+        putc(fd, c);
+ ad8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ adb:	31 d2                	xor    %edx,%edx
+ add:	eb 8e                	jmp    a6d <printf+0x4d>
+ adf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ ae0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ ae3:	83 ec 0c             	sub    $0xc,%esp
+ ae6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ aeb:	8b 13                	mov    (%ebx),%edx
+ aed:	6a 00                	push   $0x0
+ aef:	89 f8                	mov    %edi,%eax
+        ap++;
+ af1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ af4:	e8 87 fe ff ff       	call   980 <printint>
+        ap++;
+ af9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ afc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ aff:	31 d2                	xor    %edx,%edx
+ b01:	e9 67 ff ff ff       	jmp    a6d <printf+0x4d>
+ b06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b0d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ b10:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ b13:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ b15:	83 c0 04             	add    $0x4,%eax
+ b18:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ b1b:	85 db                	test   %ebx,%ebx
+ b1d:	0f 84 9d 00 00 00    	je     bc0 <printf+0x1a0>
+        while(*s != 0){
+ b23:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ b26:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ b28:	84 c0                	test   %al,%al
+ b2a:	0f 84 3d ff ff ff    	je     a6d <printf+0x4d>
+ b30:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b33:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ b36:	89 de                	mov    %ebx,%esi
+ b38:	89 d3                	mov    %edx,%ebx
+ b3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ b40:	83 ec 04             	sub    $0x4,%esp
+ b43:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ b46:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ b49:	6a 01                	push   $0x1
+ b4b:	53                   	push   %ebx
+ b4c:	57                   	push   %edi
+ b4d:	e8 76 fc ff ff       	call   7c8 <write>
+        while(*s != 0){
+ b52:	0f b6 06             	movzbl (%esi),%eax
+ b55:	83 c4 10             	add    $0x10,%esp
+ b58:	84 c0                	test   %al,%al
+ b5a:	75 e4                	jne    b40 <printf+0x120>
+      state = 0;
+ b5c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ b5f:	31 d2                	xor    %edx,%edx
+ b61:	e9 07 ff ff ff       	jmp    a6d <printf+0x4d>
+ b66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b6d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ b70:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b73:	83 ec 0c             	sub    $0xc,%esp
+ b76:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ b7b:	8b 13                	mov    (%ebx),%edx
+ b7d:	6a 01                	push   $0x1
+ b7f:	e9 6b ff ff ff       	jmp    aef <printf+0xcf>
+ b84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ b88:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ b8b:	83 ec 04             	sub    $0x4,%esp
+ b8e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ b91:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ b93:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ b96:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ b99:	6a 01                	push   $0x1
+ b9b:	52                   	push   %edx
+ b9c:	57                   	push   %edi
+ b9d:	e8 26 fc ff ff       	call   7c8 <write>
+        ap++;
+ ba2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ ba5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ ba8:	31 d2                	xor    %edx,%edx
+ baa:	e9 be fe ff ff       	jmp    a6d <printf+0x4d>
+ baf:	90                   	nop
+  write(fd, &c, 1);
+ bb0:	83 ec 04             	sub    $0x4,%esp
+ bb3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ bb6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ bb9:	6a 01                	push   $0x1
+ bbb:	e9 11 ff ff ff       	jmp    ad1 <printf+0xb1>
+ bc0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ bc5:	bb fb 0d 00 00       	mov    $0xdfb,%ebx
+ bca:	e9 61 ff ff ff       	jmp    b30 <printf+0x110>
+ bcf:	90                   	nop
+
+00000bd0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ bd0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bd1:	a1 60 28 00 00       	mov    0x2860,%eax
+{
+ bd6:	89 e5                	mov    %esp,%ebp
+ bd8:	57                   	push   %edi
+ bd9:	56                   	push   %esi
+ bda:	53                   	push   %ebx
+ bdb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ bde:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ be1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ be8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bec:	39 ca                	cmp    %ecx,%edx
+ bee:	73 30                	jae    c20 <free+0x50>
+ bf0:	39 c1                	cmp    %eax,%ecx
+ bf2:	72 04                	jb     bf8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bf4:	39 c2                	cmp    %eax,%edx
+ bf6:	72 f0                	jb     be8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ bf8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ bfb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ bfe:	39 f8                	cmp    %edi,%eax
+ c00:	74 2e                	je     c30 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c02:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ c05:	8b 42 04             	mov    0x4(%edx),%eax
+ c08:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c0b:	39 f1                	cmp    %esi,%ecx
+ c0d:	74 38                	je     c47 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ c0f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ c11:	5b                   	pop    %ebx
+  freep = p;
+ c12:	89 15 60 28 00 00    	mov    %edx,0x2860
+}
+ c18:	5e                   	pop    %esi
+ c19:	5f                   	pop    %edi
+ c1a:	5d                   	pop    %ebp
+ c1b:	c3                   	ret
+ c1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c20:	39 c1                	cmp    %eax,%ecx
+ c22:	72 d0                	jb     bf4 <free+0x24>
+ c24:	eb c2                	jmp    be8 <free+0x18>
+ c26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c2d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ c30:	03 70 04             	add    0x4(%eax),%esi
+ c33:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c36:	8b 02                	mov    (%edx),%eax
+ c38:	8b 00                	mov    (%eax),%eax
+ c3a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ c3d:	8b 42 04             	mov    0x4(%edx),%eax
+ c40:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c43:	39 f1                	cmp    %esi,%ecx
+ c45:	75 c8                	jne    c0f <free+0x3f>
+    p->s.size += bp->s.size;
+ c47:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ c4a:	89 15 60 28 00 00    	mov    %edx,0x2860
+    p->s.size += bp->s.size;
+ c50:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ c53:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ c56:	89 0a                	mov    %ecx,(%edx)
+}
+ c58:	5b                   	pop    %ebx
+ c59:	5e                   	pop    %esi
+ c5a:	5f                   	pop    %edi
+ c5b:	5d                   	pop    %ebp
+ c5c:	c3                   	ret
+ c5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c60 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ c60:	55                   	push   %ebp
+ c61:	89 e5                	mov    %esp,%ebp
+ c63:	57                   	push   %edi
+ c64:	56                   	push   %esi
+ c65:	53                   	push   %ebx
+ c66:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c69:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ c6c:	8b 15 60 28 00 00    	mov    0x2860,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c72:	8d 78 07             	lea    0x7(%eax),%edi
+ c75:	c1 ef 03             	shr    $0x3,%edi
+ c78:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ c7b:	85 d2                	test   %edx,%edx
+ c7d:	0f 84 8d 00 00 00    	je     d10 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c83:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c85:	8b 48 04             	mov    0x4(%eax),%ecx
+ c88:	39 f9                	cmp    %edi,%ecx
+ c8a:	73 64                	jae    cf0 <malloc+0x90>
+  if(nu < 4096)
+ c8c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ c91:	39 df                	cmp    %ebx,%edi
+ c93:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ c96:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ c9d:	eb 0a                	jmp    ca9 <malloc+0x49>
+ c9f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ca0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ca2:	8b 48 04             	mov    0x4(%eax),%ecx
+ ca5:	39 f9                	cmp    %edi,%ecx
+ ca7:	73 47                	jae    cf0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ ca9:	89 c2                	mov    %eax,%edx
+ cab:	39 05 60 28 00 00    	cmp    %eax,0x2860
+ cb1:	75 ed                	jne    ca0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ cb3:	83 ec 0c             	sub    $0xc,%esp
+ cb6:	56                   	push   %esi
+ cb7:	e8 9b fb ff ff       	call   857 <sbrk>
+  if(p == (char*)-1)
+ cbc:	83 c4 10             	add    $0x10,%esp
+ cbf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ cc2:	74 1c                	je     ce0 <malloc+0x80>
+  hp->s.size = nu;
+ cc4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ cc7:	83 ec 0c             	sub    $0xc,%esp
+ cca:	83 c0 08             	add    $0x8,%eax
+ ccd:	50                   	push   %eax
+ cce:	e8 fd fe ff ff       	call   bd0 <free>
+  return freep;
+ cd3:	8b 15 60 28 00 00    	mov    0x2860,%edx
+      if((p = morecore(nunits)) == 0)
+ cd9:	83 c4 10             	add    $0x10,%esp
+ cdc:	85 d2                	test   %edx,%edx
+ cde:	75 c0                	jne    ca0 <malloc+0x40>
+        return 0;
+  }
+}
+ ce0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ ce3:	31 c0                	xor    %eax,%eax
+}
+ ce5:	5b                   	pop    %ebx
+ ce6:	5e                   	pop    %esi
+ ce7:	5f                   	pop    %edi
+ ce8:	5d                   	pop    %ebp
+ ce9:	c3                   	ret
+ cea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ cf0:	39 cf                	cmp    %ecx,%edi
+ cf2:	74 4c                	je     d40 <malloc+0xe0>
+        p->s.size -= nunits;
+ cf4:	29 f9                	sub    %edi,%ecx
+ cf6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ cf9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ cfc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ cff:	89 15 60 28 00 00    	mov    %edx,0x2860
+}
+ d05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ d08:	83 c0 08             	add    $0x8,%eax
+}
+ d0b:	5b                   	pop    %ebx
+ d0c:	5e                   	pop    %esi
+ d0d:	5f                   	pop    %edi
+ d0e:	5d                   	pop    %ebp
+ d0f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ d10:	c7 05 60 28 00 00 64 	movl   $0x2864,0x2860
+ d17:	28 00 00 
+    base.s.size = 0;
+ d1a:	b8 64 28 00 00       	mov    $0x2864,%eax
+    base.s.ptr = freep = prevp = &base;
+ d1f:	c7 05 64 28 00 00 64 	movl   $0x2864,0x2864
+ d26:	28 00 00 
+    base.s.size = 0;
+ d29:	c7 05 68 28 00 00 00 	movl   $0x0,0x2868
+ d30:	00 00 00 
+    if(p->s.size >= nunits){
+ d33:	e9 54 ff ff ff       	jmp    c8c <malloc+0x2c>
+ d38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d3f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ d40:	8b 08                	mov    (%eax),%ecx
+ d42:	89 0a                	mov    %ecx,(%edx)
+ d44:	eb b9                	jmp    cff <malloc+0x9f>
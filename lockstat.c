@@ -0,0 +1,76 @@
+// Print lock statistics per lock name, most time spent
+// waiting first: since boot or, given a command, while it ran.
+// Sleep locks also show how often a waiter got the lock by
+// spinning, how often one went to sleep, and how many
+// releases had to wake a sleeper.
+// usage: lockstat [command [args...]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "lockstat.h"
+
+struct lockstat st0[NLOCKSTAT], st1[NLOCKSTAT];
+
+int
+main(int argc, char *argv[])
+{
+  struct lockstat *s, t;
+  int i, j, n0, n1, pid;
+
+  n0 = 0;
+  if(argc > 1){
+    n0 = lockstat(st0, NLOCKSTAT);
+    if((pid = fork()) == 0){
+      exec(argv[1], argv+1);
+      printf(2, "lockstat: exec %s failed\n", argv[1]);
+      exit();
+    }
+    if(pid > 0)
+      wait();
+  }
+  if((n1 = lockstat(st1, NLOCKSTAT)) < 0){
+    printf(2, "lockstat: failed\n");
+    exit();
+  }
+
+  // Subtract the counts from before the command.
+  for(i = 0; i < n1; i++){
+    s = &st1[i];
+    for(j = 0; j < n0; j++){
+      if(strcmp(st0[j].name, s->name) == 0){
+        s->nacquire -= st0[j].nacquire;
+        s->ncontend -= st0[j].ncontend;
+        s->spin -= st0[j].spin;
+        s->nspin -= st0[j].nspin;
+        s->nsleep -= st0[j].nsleep;
+        s->nhandoff -= st0[j].nhandoff;
+        break;
+      }
+    }
+  }
+
+  // Sort by time spent waiting.
+  for(i = 0; i < n1; i++){
+    for(j = i+1; j < n1; j++){
+      if(st1[j].spin > st1[i].spin){
+        t = st1[i];
+        st1[i] = st1[j];
+        st1[j] = t;
+      }
+    }
+  }
+
+  printf(1, "%s\t\t%s\t%s\t%s\t%s\t%s\t%s\n", "lock", "acquires", "waited",
+         "Kcycles waiting", "spun", "slept", "handoffs");
+  for(i = 0; i < n1; i++){
+    s = &st1[i];
+    if(s->nacquire == 0 && s->nspin + s->nsleep == 0)
+      continue;
+    printf(1, "%s\t%s%d\t\t%d\t%d\t\t%d\t%d\t%d\n", s->name,
+           strlen(s->name) < 8 ? "\t" : "", s->nacquire, s->ncontend,
+           (uint)(s->spin >> 10), s->nspin, s->nsleep, s->nhandoff);
+  }
+  exit();
+}
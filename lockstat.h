@@ -0,0 +1,31 @@
+// Lock statistics, summed over all spinlocks with the same
+// name, as returned by lockstat().
+struct lockstat {
+  char name[16];
+  uint nacquire;   // acquisitions
+  uint ncontend;   // ... that had to wait for the lock
+  uint64 spin;     // TSC cycles spent waiting
+  uint nspin;      // sleep locks: waits that spun, not slept
+  uint nsleep;     // ... times a waiter went to sleep
+  uint nhandoff;   // ... releases that woke a sleeper
+};
+
+// Sleep lock events, for sleeplockstat().
+#define SL_SPIN     0
+#define SL_SLEEP    1
+#define SL_HANDOFF  2
+
+// Lock profile: acquisitions of locks with one name from one
+// call site, while the profiler was on.  See lockprofile().
+struct lockprof {
+  char name[16];
+  uint pc;         // return address of the call to acquire()
+  uint nacquire;
+  uint ncontend;
+  uint64 wait;     // TSC cycles spent waiting
+  uint64 hold;     // TSC cycles held
+};
+
+#define LOCKPROF_START  1   // clear the profile and start
+#define LOCKPROF_STOP   2
+#define LOCKPROF_READ   3
@@ -0,0 +1,1844 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	bb 01 00 00 00       	mov    $0x1,%ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 31                	mov    (%ecx),%esi
+  1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+  1e:	83 fe 01             	cmp    $0x1,%esi
+  21:	7e 1f                	jle    42 <main+0x42>
+  23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  27:	90                   	nop
+    ls(".");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    ls(argv[i]);
+  28:	83 ec 0c             	sub    $0xc,%esp
+  2b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+  2e:	83 c3 01             	add    $0x1,%ebx
+    ls(argv[i]);
+  31:	e8 ca 00 00 00       	call   100 <ls>
+  for(i=1; i<argc; i++)
+  36:	83 c4 10             	add    $0x10,%esp
+  39:	39 de                	cmp    %ebx,%esi
+  3b:	75 eb                	jne    28 <main+0x28>
+  exit();
+  3d:	e8 1a 07 00 00       	call   75c <exit>
+    ls(".");
+  42:	83 ec 0c             	sub    $0xc,%esp
+  45:	68 50 0d 00 00       	push   $0xd50
+  4a:	e8 b1 00 00 00       	call   100 <ls>
+    exit();
+  4f:	e8 08 07 00 00       	call   75c <exit>
+  54:	66 90                	xchg   %ax,%ax
+  56:	66 90                	xchg   %ax,%ax
+  58:	66 90                	xchg   %ax,%ax
+  5a:	66 90                	xchg   %ax,%ax
+  5c:	66 90                	xchg   %ax,%ax
+  5e:	66 90                	xchg   %ax,%ax
+
+00000060 <fmtname>:
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	56                   	push   %esi
+  64:	53                   	push   %ebx
+  65:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+  68:	83 ec 0c             	sub    $0xc,%esp
+  6b:	56                   	push   %esi
+  6c:	e8 5f 03 00 00       	call   3d0 <strlen>
+  71:	83 c4 10             	add    $0x10,%esp
+  74:	01 f0                	add    %esi,%eax
+  76:	89 c3                	mov    %eax,%ebx
+  78:	73 0f                	jae    89 <fmtname+0x29>
+  7a:	eb 12                	jmp    8e <fmtname+0x2e>
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  83:	39 f0                	cmp    %esi,%eax
+  85:	72 0a                	jb     91 <fmtname+0x31>
+  87:	89 c3                	mov    %eax,%ebx
+  89:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+  8c:	75 f2                	jne    80 <fmtname+0x20>
+  p++;
+  8e:	83 c3 01             	add    $0x1,%ebx
+  if(strlen(p) >= DIRSIZ)
+  91:	83 ec 0c             	sub    $0xc,%esp
+  94:	53                   	push   %ebx
+  95:	e8 36 03 00 00       	call   3d0 <strlen>
+  9a:	83 c4 10             	add    $0x10,%esp
+  9d:	83 f8 0d             	cmp    $0xd,%eax
+  a0:	77 4a                	ja     ec <fmtname+0x8c>
+  memmove(buf, p, strlen(p));
+  a2:	83 ec 0c             	sub    $0xc,%esp
+  a5:	53                   	push   %ebx
+  a6:	e8 25 03 00 00       	call   3d0 <strlen>
+  ab:	83 c4 0c             	add    $0xc,%esp
+  ae:	50                   	push   %eax
+  af:	53                   	push   %ebx
+  b0:	68 40 12 00 00       	push   $0x1240
+  b5:	e8 96 04 00 00       	call   550 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  ba:	89 1c 24             	mov    %ebx,(%esp)
+  bd:	e8 0e 03 00 00       	call   3d0 <strlen>
+  c2:	89 1c 24             	mov    %ebx,(%esp)
+  return buf;
+  c5:	bb 40 12 00 00       	mov    $0x1240,%ebx
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  ca:	89 c6                	mov    %eax,%esi
+  cc:	e8 ff 02 00 00       	call   3d0 <strlen>
+  d1:	ba 0e 00 00 00       	mov    $0xe,%edx
+  d6:	83 c4 0c             	add    $0xc,%esp
+  d9:	29 f2                	sub    %esi,%edx
+  db:	05 40 12 00 00       	add    $0x1240,%eax
+  e0:	52                   	push   %edx
+  e1:	6a 20                	push   $0x20
+  e3:	50                   	push   %eax
+  e4:	e8 17 03 00 00       	call   400 <memset>
+  return buf;
+  e9:	83 c4 10             	add    $0x10,%esp
+}
+  ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  ef:	89 d8                	mov    %ebx,%eax
+  f1:	5b                   	pop    %ebx
+  f2:	5e                   	pop    %esi
+  f3:	5d                   	pop    %ebp
+  f4:	c3                   	ret
+  f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000100 <ls>:
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	57                   	push   %edi
+ 104:	56                   	push   %esi
+ 105:	53                   	push   %ebx
+ 106:	81 ec 64 02 00 00    	sub    $0x264,%esp
+ 10c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if((fd = open(path, 0)) < 0){
+ 10f:	6a 00                	push   $0x0
+ 111:	57                   	push   %edi
+ 112:	e8 9d 06 00 00       	call   7b4 <open>
+ 117:	83 c4 10             	add    $0x10,%esp
+ 11a:	85 c0                	test   %eax,%eax
+ 11c:	0f 88 9e 01 00 00    	js     2c0 <ls+0x1c0>
+  if(fstat(fd, &st) < 0){
+ 122:	83 ec 08             	sub    $0x8,%esp
+ 125:	8d b5 d4 fd ff ff    	lea    -0x22c(%ebp),%esi
+ 12b:	89 c3                	mov    %eax,%ebx
+ 12d:	56                   	push   %esi
+ 12e:	50                   	push   %eax
+ 12f:	e8 a1 06 00 00       	call   7d5 <fstat>
+ 134:	83 c4 10             	add    $0x10,%esp
+ 137:	85 c0                	test   %eax,%eax
+ 139:	0f 88 c1 01 00 00    	js     300 <ls+0x200>
+  switch(st.type){
+ 13f:	0f b7 85 d4 fd ff ff 	movzwl -0x22c(%ebp),%eax
+ 146:	66 83 f8 01          	cmp    $0x1,%ax
+ 14a:	74 64                	je     1b0 <ls+0xb0>
+ 14c:	66 83 f8 02          	cmp    $0x2,%ax
+ 150:	74 1e                	je     170 <ls+0x70>
+  close(fd);
+ 152:	83 ec 0c             	sub    $0xc,%esp
+ 155:	53                   	push   %ebx
+ 156:	e8 38 06 00 00       	call   793 <close>
+ 15b:	83 c4 10             	add    $0x10,%esp
+}
+ 15e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 161:	5b                   	pop    %ebx
+ 162:	5e                   	pop    %esi
+ 163:	5f                   	pop    %edi
+ 164:	5d                   	pop    %ebp
+ 165:	c3                   	ret
+ 166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+ 170:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+ 176:	83 ec 0c             	sub    $0xc,%esp
+ 179:	8b b5 dc fd ff ff    	mov    -0x224(%ebp),%esi
+ 17f:	89 95 b4 fd ff ff    	mov    %edx,-0x24c(%ebp)
+ 185:	57                   	push   %edi
+ 186:	e8 d5 fe ff ff       	call   60 <fmtname>
+ 18b:	8b 95 b4 fd ff ff    	mov    -0x24c(%ebp),%edx
+ 191:	59                   	pop    %ecx
+ 192:	5f                   	pop    %edi
+ 193:	52                   	push   %edx
+ 194:	56                   	push   %esi
+ 195:	6a 02                	push   $0x2
+ 197:	50                   	push   %eax
+ 198:	68 30 0d 00 00       	push   $0xd30
+ 19d:	6a 01                	push   $0x1
+ 19f:	e8 3c 08 00 00       	call   9e0 <printf>
+    break;
+ 1a4:	83 c4 20             	add    $0x20,%esp
+ 1a7:	eb a9                	jmp    152 <ls+0x52>
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+ 1b0:	83 ec 0c             	sub    $0xc,%esp
+ 1b3:	57                   	push   %edi
+ 1b4:	e8 17 02 00 00       	call   3d0 <strlen>
+ 1b9:	83 c4 10             	add    $0x10,%esp
+ 1bc:	83 c0 10             	add    $0x10,%eax
+ 1bf:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 1c4:	0f 87 16 01 00 00    	ja     2e0 <ls+0x1e0>
+    strcpy(buf, path);
+ 1ca:	83 ec 08             	sub    $0x8,%esp
+ 1cd:	57                   	push   %edi
+ 1ce:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+ 1d4:	57                   	push   %edi
+ 1d5:	e8 66 01 00 00       	call   340 <strcpy>
+    p = buf+strlen(buf);
+ 1da:	89 3c 24             	mov    %edi,(%esp)
+ 1dd:	e8 ee 01 00 00       	call   3d0 <strlen>
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1e2:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+ 1e5:	01 f8                	add    %edi,%eax
+    *p++ = '/';
+ 1e7:	8d 48 01             	lea    0x1(%eax),%ecx
+    p = buf+strlen(buf);
+ 1ea:	89 85 a8 fd ff ff    	mov    %eax,-0x258(%ebp)
+    *p++ = '/';
+ 1f0:	89 8d a4 fd ff ff    	mov    %ecx,-0x25c(%ebp)
+ 1f6:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 200:	83 ec 04             	sub    $0x4,%esp
+ 203:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+ 209:	6a 10                	push   $0x10
+ 20b:	50                   	push   %eax
+ 20c:	53                   	push   %ebx
+ 20d:	e8 6b 05 00 00       	call   77d <read>
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	83 f8 10             	cmp    $0x10,%eax
+ 218:	0f 85 34 ff ff ff    	jne    152 <ls+0x52>
+      if(de.inum == 0)
+ 21e:	66 83 bd c4 fd ff ff 	cmpw   $0x0,-0x23c(%ebp)
+ 225:	00 
+ 226:	74 d8                	je     200 <ls+0x100>
+      memmove(p, de.name, DIRSIZ);
+ 228:	83 ec 04             	sub    $0x4,%esp
+ 22b:	8d 85 c6 fd ff ff    	lea    -0x23a(%ebp),%eax
+ 231:	6a 0e                	push   $0xe
+ 233:	50                   	push   %eax
+ 234:	ff b5 a4 fd ff ff    	push   -0x25c(%ebp)
+ 23a:	e8 11 03 00 00       	call   550 <memmove>
+      p[DIRSIZ] = 0;
+ 23f:	8b 85 a8 fd ff ff    	mov    -0x258(%ebp),%eax
+ 245:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+      if(stat(buf, &st) < 0){
+ 249:	58                   	pop    %eax
+ 24a:	5a                   	pop    %edx
+ 24b:	56                   	push   %esi
+ 24c:	57                   	push   %edi
+ 24d:	e8 6e 02 00 00       	call   4c0 <stat>
+ 252:	83 c4 10             	add    $0x10,%esp
+ 255:	85 c0                	test   %eax,%eax
+ 257:	0f 88 cb 00 00 00    	js     328 <ls+0x228>
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+ 25d:	8b 8d e4 fd ff ff    	mov    -0x21c(%ebp),%ecx
+ 263:	8b 95 dc fd ff ff    	mov    -0x224(%ebp),%edx
+ 269:	83 ec 0c             	sub    $0xc,%esp
+ 26c:	0f bf 85 d4 fd ff ff 	movswl -0x22c(%ebp),%eax
+ 273:	89 8d ac fd ff ff    	mov    %ecx,-0x254(%ebp)
+ 279:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+ 27f:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+ 285:	57                   	push   %edi
+ 286:	e8 d5 fd ff ff       	call   60 <fmtname>
+ 28b:	5a                   	pop    %edx
+ 28c:	59                   	pop    %ecx
+ 28d:	8b 8d ac fd ff ff    	mov    -0x254(%ebp),%ecx
+ 293:	51                   	push   %ecx
+ 294:	8b 95 b0 fd ff ff    	mov    -0x250(%ebp),%edx
+ 29a:	52                   	push   %edx
+ 29b:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+ 2a1:	50                   	push   %eax
+ 2a2:	68 30 0d 00 00       	push   $0xd30
+ 2a7:	6a 01                	push   $0x1
+ 2a9:	e8 32 07 00 00       	call   9e0 <printf>
+ 2ae:	83 c4 20             	add    $0x20,%esp
+ 2b1:	e9 4a ff ff ff       	jmp    200 <ls+0x100>
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "ls: cannot open %s\n", path);
+ 2c0:	83 ec 04             	sub    $0x4,%esp
+ 2c3:	57                   	push   %edi
+ 2c4:	68 08 0d 00 00       	push   $0xd08
+ 2c9:	6a 02                	push   $0x2
+ 2cb:	e8 10 07 00 00       	call   9e0 <printf>
+    return;
+ 2d0:	83 c4 10             	add    $0x10,%esp
+}
+ 2d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2d6:	5b                   	pop    %ebx
+ 2d7:	5e                   	pop    %esi
+ 2d8:	5f                   	pop    %edi
+ 2d9:	5d                   	pop    %ebp
+ 2da:	c3                   	ret
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+      printf(1, "ls: path too long\n");
+ 2e0:	83 ec 08             	sub    $0x8,%esp
+ 2e3:	68 3d 0d 00 00       	push   $0xd3d
+ 2e8:	6a 01                	push   $0x1
+ 2ea:	e8 f1 06 00 00       	call   9e0 <printf>
+      break;
+ 2ef:	83 c4 10             	add    $0x10,%esp
+ 2f2:	e9 5b fe ff ff       	jmp    152 <ls+0x52>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    printf(2, "ls: cannot stat %s\n", path);
+ 300:	83 ec 04             	sub    $0x4,%esp
+ 303:	57                   	push   %edi
+ 304:	68 1c 0d 00 00       	push   $0xd1c
+ 309:	6a 02                	push   $0x2
+ 30b:	e8 d0 06 00 00       	call   9e0 <printf>
+    close(fd);
+ 310:	89 1c 24             	mov    %ebx,(%esp)
+ 313:	e8 7b 04 00 00       	call   793 <close>
+    return;
+ 318:	83 c4 10             	add    $0x10,%esp
+}
+ 31b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 31e:	5b                   	pop    %ebx
+ 31f:	5e                   	pop    %esi
+ 320:	5f                   	pop    %edi
+ 321:	5d                   	pop    %ebp
+ 322:	c3                   	ret
+ 323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 327:	90                   	nop
+        printf(1, "ls: cannot stat %s\n", buf);
+ 328:	83 ec 04             	sub    $0x4,%esp
+ 32b:	57                   	push   %edi
+ 32c:	68 1c 0d 00 00       	push   $0xd1c
+ 331:	6a 01                	push   $0x1
+ 333:	e8 a8 06 00 00       	call   9e0 <printf>
+        continue;
+ 338:	83 c4 10             	add    $0x10,%esp
+ 33b:	e9 c0 fe ff ff       	jmp    200 <ls+0x100>
+
+00000340 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 340:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 341:	31 c0                	xor    %eax,%eax
+{
+ 343:	89 e5                	mov    %esp,%ebp
+ 345:	53                   	push   %ebx
+ 346:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 349:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 350:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 354:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 357:	83 c0 01             	add    $0x1,%eax
+ 35a:	84 d2                	test   %dl,%dl
+ 35c:	75 f2                	jne    350 <strcpy+0x10>
+    ;
+  return os;
+}
+ 35e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 361:	89 c8                	mov    %ecx,%eax
+ 363:	c9                   	leave
+ 364:	c3                   	ret
+ 365:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	53                   	push   %ebx
+ 374:	8b 55 08             	mov    0x8(%ebp),%edx
+ 377:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 37a:	0f b6 02             	movzbl (%edx),%eax
+ 37d:	84 c0                	test   %al,%al
+ 37f:	75 17                	jne    398 <strcmp+0x28>
+ 381:	eb 3a                	jmp    3bd <strcmp+0x4d>
+ 383:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 387:	90                   	nop
+ 388:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 38c:	83 c2 01             	add    $0x1,%edx
+ 38f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 392:	84 c0                	test   %al,%al
+ 394:	74 1a                	je     3b0 <strcmp+0x40>
+    p++, q++;
+ 396:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 398:	0f b6 19             	movzbl (%ecx),%ebx
+ 39b:	38 c3                	cmp    %al,%bl
+ 39d:	74 e9                	je     388 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 39f:	29 d8                	sub    %ebx,%eax
+}
+ 3a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3a4:	c9                   	leave
+ 3a5:	c3                   	ret
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3b4:	31 c0                	xor    %eax,%eax
+ 3b6:	29 d8                	sub    %ebx,%eax
+}
+ 3b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3bb:	c9                   	leave
+ 3bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3bd:	0f b6 19             	movzbl (%ecx),%ebx
+ 3c0:	31 c0                	xor    %eax,%eax
+ 3c2:	eb db                	jmp    39f <strcmp+0x2f>
+ 3c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3cf:	90                   	nop
+
+000003d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3d6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3d9:	74 15                	je     3f0 <strlen+0x20>
+ 3db:	31 c0                	xor    %eax,%eax
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 3e0:	83 c0 01             	add    $0x1,%eax
+ 3e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3e7:	89 c1                	mov    %eax,%ecx
+ 3e9:	75 f5                	jne    3e0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3eb:	89 c8                	mov    %ecx,%eax
+ 3ed:	5d                   	pop    %ebp
+ 3ee:	c3                   	ret
+ 3ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3f0:	31 c9                	xor    %ecx,%ecx
+}
+ 3f2:	5d                   	pop    %ebp
+ 3f3:	89 c8                	mov    %ecx,%eax
+ 3f5:	c3                   	ret
+ 3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000400 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 407:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 40a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 40d:	89 d7                	mov    %edx,%edi
+ 40f:	fc                   	cld
+ 410:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 412:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 415:	89 d0                	mov    %edx,%eax
+ 417:	c9                   	leave
+ 418:	c3                   	ret
+ 419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+ 426:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 42a:	0f b6 10             	movzbl (%eax),%edx
+ 42d:	84 d2                	test   %dl,%dl
+ 42f:	75 12                	jne    443 <strchr+0x23>
+ 431:	eb 1d                	jmp    450 <strchr+0x30>
+ 433:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 437:	90                   	nop
+ 438:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 43c:	83 c0 01             	add    $0x1,%eax
+ 43f:	84 d2                	test   %dl,%dl
+ 441:	74 0d                	je     450 <strchr+0x30>
+    if(*s == c)
+ 443:	38 d1                	cmp    %dl,%cl
+ 445:	75 f1                	jne    438 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 447:	5d                   	pop    %ebp
+ 448:	c3                   	ret
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 450:	31 c0                	xor    %eax,%eax
+}
+ 452:	5d                   	pop    %ebp
+ 453:	c3                   	ret
+ 454:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 45f:	90                   	nop
+
+00000460 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 465:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 468:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 469:	31 db                	xor    %ebx,%ebx
+{
+ 46b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 46e:	eb 27                	jmp    497 <gets+0x37>
+    cc = read(0, &c, 1);
+ 470:	83 ec 04             	sub    $0x4,%esp
+ 473:	6a 01                	push   $0x1
+ 475:	56                   	push   %esi
+ 476:	6a 00                	push   $0x0
+ 478:	e8 00 03 00 00       	call   77d <read>
+    if(cc < 1)
+ 47d:	83 c4 10             	add    $0x10,%esp
+ 480:	85 c0                	test   %eax,%eax
+ 482:	7e 1d                	jle    4a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 484:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 488:	8b 55 08             	mov    0x8(%ebp),%edx
+ 48b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 48f:	3c 0a                	cmp    $0xa,%al
+ 491:	74 10                	je     4a3 <gets+0x43>
+ 493:	3c 0d                	cmp    $0xd,%al
+ 495:	74 0c                	je     4a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 497:	89 df                	mov    %ebx,%edi
+ 499:	83 c3 01             	add    $0x1,%ebx
+ 49c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 49f:	7c cf                	jl     470 <gets+0x10>
+ 4a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4ad:	5b                   	pop    %ebx
+ 4ae:	5e                   	pop    %esi
+ 4af:	5f                   	pop    %edi
+ 4b0:	5d                   	pop    %ebp
+ 4b1:	c3                   	ret
+ 4b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	56                   	push   %esi
+ 4c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4c5:	83 ec 08             	sub    $0x8,%esp
+ 4c8:	6a 00                	push   $0x0
+ 4ca:	ff 75 08             	push   0x8(%ebp)
+ 4cd:	e8 e2 02 00 00       	call   7b4 <open>
+  if(fd < 0)
+ 4d2:	83 c4 10             	add    $0x10,%esp
+ 4d5:	85 c0                	test   %eax,%eax
+ 4d7:	78 27                	js     500 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4d9:	83 ec 08             	sub    $0x8,%esp
+ 4dc:	ff 75 0c             	push   0xc(%ebp)
+ 4df:	89 c3                	mov    %eax,%ebx
+ 4e1:	50                   	push   %eax
+ 4e2:	e8 ee 02 00 00       	call   7d5 <fstat>
+  close(fd);
+ 4e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4ec:	e8 a2 02 00 00       	call   793 <close>
+  return r;
+ 4f1:	83 c4 10             	add    $0x10,%esp
+}
+ 4f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4f7:	89 f0                	mov    %esi,%eax
+ 4f9:	5b                   	pop    %ebx
+ 4fa:	5e                   	pop    %esi
+ 4fb:	5d                   	pop    %ebp
+ 4fc:	c3                   	ret
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 500:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 505:	eb ed                	jmp    4f4 <stat+0x34>
+ 507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50e:	66 90                	xchg   %ax,%ax
+
+00000510 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	53                   	push   %ebx
+ 514:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 517:	0f be 02             	movsbl (%edx),%eax
+ 51a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 51d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 520:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 525:	77 1e                	ja     545 <atoi+0x35>
+ 527:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 530:	83 c2 01             	add    $0x1,%edx
+ 533:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 536:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 53a:	0f be 02             	movsbl (%edx),%eax
+ 53d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 540:	80 fb 09             	cmp    $0x9,%bl
+ 543:	76 eb                	jbe    530 <atoi+0x20>
+  return n;
+}
+ 545:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 548:	89 c8                	mov    %ecx,%eax
+ 54a:	c9                   	leave
+ 54b:	c3                   	ret
+ 54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	8b 45 10             	mov    0x10(%ebp),%eax
+ 558:	8b 55 08             	mov    0x8(%ebp),%edx
+ 55b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 55e:	85 c0                	test   %eax,%eax
+ 560:	7e 13                	jle    575 <memmove+0x25>
+ 562:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 564:	89 d7                	mov    %edx,%edi
+ 566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 570:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 571:	39 f8                	cmp    %edi,%eax
+ 573:	75 fb                	jne    570 <memmove+0x20>
+  return vdst;
+}
+ 575:	5e                   	pop    %esi
+ 576:	89 d0                	mov    %edx,%eax
+ 578:	5f                   	pop    %edi
+ 579:	5d                   	pop    %ebp
+ 57a:	c3                   	ret
+ 57b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 57f:	90                   	nop
+
+00000580 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 580:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 585:	85 c0                	test   %eax,%eax
+ 587:	74 07                	je     590 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 589:	c3                   	ret
+ 58a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 590:	e9 77 02 00 00       	jmp    80c <sysgetpid>
+ 595:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005a0 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 5a0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 5a5:	c3                   	ret
+ 5a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005b0 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 5b0:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 5b1:	31 d2                	xor    %edx,%edx
+ 5b3:	89 e5                	mov    %esp,%ebp
+ 5b5:	53                   	push   %ebx
+ 5b6:	83 ec 04             	sub    $0x4,%esp
+ 5b9:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 5bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 5bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 5c2:	85 c9                	test   %ecx,%ecx
+ 5c4:	7e 08                	jle    5ce <cyclereport+0x1e>
+ 5c6:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 5c8:	89 d8                	mov    %ebx,%eax
+ 5ca:	f7 f1                	div    %ecx
+ 5cc:	89 c2                	mov    %eax,%edx
+ 5ce:	83 ec 08             	sub    $0x8,%esp
+ 5d1:	52                   	push   %edx
+ 5d2:	ff 75 0c             	push   0xc(%ebp)
+ 5d5:	51                   	push   %ecx
+ 5d6:	ff 75 08             	push   0x8(%ebp)
+ 5d9:	68 52 0d 00 00       	push   $0xd52
+ 5de:	6a 01                	push   $0x1
+ 5e0:	e8 fb 03 00 00       	call   9e0 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 5e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5e8:	83 c4 20             	add    $0x20,%esp
+ 5eb:	c9                   	leave
+ 5ec:	c3                   	ret
+ 5ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005f0 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 5f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 5fc:	5d                   	pop    %ebp
+ 5fd:	c3                   	ret
+ 5fe:	66 90                	xchg   %ax,%ax
+
+00000600 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 600:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 601:	31 c0                	xor    %eax,%eax
+ 603:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 608:	89 e5                	mov    %esp,%ebp
+ 60a:	56                   	push   %esi
+ 60b:	53                   	push   %ebx
+ 60c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 60f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 613:	85 c0                	test   %eax,%eax
+ 615:	74 30                	je     647 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 617:	83 f8 02             	cmp    $0x2,%eax
+ 61a:	74 0c                	je     628 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 61c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 621:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 624:	85 c0                	test   %eax,%eax
+ 626:	74 1f                	je     647 <mutex_lock+0x47>
+ 628:	be 02 00 00 00       	mov    $0x2,%esi
+ 62d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 630:	83 ec 08             	sub    $0x8,%esp
+ 633:	6a 02                	push   $0x2
+ 635:	53                   	push   %ebx
+ 636:	e8 8c 02 00 00       	call   8c7 <futex_wait>
+ 63b:	89 f0                	mov    %esi,%eax
+ 63d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 640:	83 c4 10             	add    $0x10,%esp
+ 643:	85 c0                	test   %eax,%eax
+ 645:	75 e9                	jne    630 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 647:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 64a:	5b                   	pop    %ebx
+ 64b:	5e                   	pop    %esi
+ 64c:	5d                   	pop    %ebp
+ 64d:	c3                   	ret
+ 64e:	66 90                	xchg   %ax,%ax
+
+00000650 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	83 ec 08             	sub    $0x8,%esp
+ 656:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 659:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 65d:	75 09                	jne    668 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 65f:	c9                   	leave
+ 660:	c3                   	ret
+ 661:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 668:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 66b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 671:	6a 01                	push   $0x1
+ 673:	50                   	push   %eax
+ 674:	e8 59 02 00 00       	call   8d2 <futex_wake>
+ 679:	83 c4 10             	add    $0x10,%esp
+}
+ 67c:	c9                   	leave
+ 67d:	c3                   	ret
+ 67e:	66 90                	xchg   %ax,%ax
+
+00000680 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 683:	8b 45 08             	mov    0x8(%ebp),%eax
+ 686:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 68c:	5d                   	pop    %ebp
+ 68d:	c3                   	ret
+ 68e:	66 90                	xchg   %ax,%ax
+
+00000690 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 690:	55                   	push   %ebp
+ 691:	89 e5                	mov    %esp,%ebp
+ 693:	57                   	push   %edi
+ 694:	56                   	push   %esi
+ 695:	53                   	push   %ebx
+ 696:	83 ec 0c             	sub    $0xc,%esp
+ 699:	8b 75 08             	mov    0x8(%ebp),%esi
+ 69c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 69f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 6a1:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 6a5:	75 21                	jne    6c8 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 6a7:	83 ec 08             	sub    $0x8,%esp
+ 6aa:	57                   	push   %edi
+ 6ab:	56                   	push   %esi
+ 6ac:	e8 16 02 00 00       	call   8c7 <futex_wait>
+  mutex_lock(m);
+ 6b1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 6b4:	83 c4 10             	add    $0x10,%esp
+}
+ 6b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6ba:	5b                   	pop    %ebx
+ 6bb:	5e                   	pop    %esi
+ 6bc:	5f                   	pop    %edi
+ 6bd:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 6be:	e9 3d ff ff ff       	jmp    600 <mutex_lock>
+ 6c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6c7:	90                   	nop
+    futex_wake(&m->v, 1);
+ 6c8:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 6cb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 6d1:	6a 01                	push   $0x1
+ 6d3:	53                   	push   %ebx
+ 6d4:	e8 f9 01 00 00       	call   8d2 <futex_wake>
+ 6d9:	83 c4 10             	add    $0x10,%esp
+ 6dc:	eb c9                	jmp    6a7 <cond_wait+0x17>
+ 6de:	66 90                	xchg   %ax,%ax
+
+000006e0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 e5                	mov    %esp,%ebp
+ 6e3:	83 ec 10             	sub    $0x10,%esp
+ 6e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 6e9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 6ed:	6a 01                	push   $0x1
+ 6ef:	50                   	push   %eax
+ 6f0:	e8 dd 01 00 00       	call   8d2 <futex_wake>
+}
+ 6f5:	83 c4 10             	add    $0x10,%esp
+ 6f8:	c9                   	leave
+ 6f9:	c3                   	ret
+ 6fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000700 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 700:	55                   	push   %ebp
+ 701:	89 e5                	mov    %esp,%ebp
+ 703:	83 ec 10             	sub    $0x10,%esp
+ 706:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 709:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 70d:	68 ff ff ff 7f       	push   $0x7fffffff
+ 712:	50                   	push   %eax
+ 713:	e8 ba 01 00 00       	call   8d2 <futex_wake>
+}
+ 718:	83 c4 10             	add    $0x10,%esp
+ 71b:	c9                   	leave
+ 71c:	c3                   	ret
+
+0000071d <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 71d:	50                   	push   %eax
+  pushl %ebx
+ 71e:	53                   	push   %ebx
+  movl $1, %eax
+ 71f:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 724:	0f a2                	cpuid
+  popl %ebx
+ 726:	5b                   	pop    %ebx
+  popl %eax
+ 727:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 728:	c7 05 3c 12 00 00 4e 	movl   $0x74e,0x123c
+ 72f:	07 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 732:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 738:	74 14                	je     74e <sysint>
+  movl $sysfast, syscallvec
+ 73a:	c7 05 3c 12 00 00 44 	movl   $0x744,0x123c
+ 741:	07 00 00 
+
+00000744 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 744:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 746:	ba 4d 07 00 00       	mov    $0x74d,%edx
+  sysenter
+ 74b:	0f 34                	sysenter
+1:
+  ret
+ 74d:	c3                   	ret
+
+0000074e <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 74e:	cd 40                	int    $0x40
+  ret
+ 750:	c3                   	ret
+
+00000751 <fork>:
+
+SYSCALL(fork)
+ 751:	b8 01 00 00 00       	mov    $0x1,%eax
+ 756:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+0000075c <exit>:
+SYSCALL(exit)
+ 75c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 761:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+00000767 <wait>:
+SYSCALL(wait)
+ 767:	b8 03 00 00 00       	mov    $0x3,%eax
+ 76c:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+00000772 <pipe>:
+SYSCALL(pipe)
+ 772:	b8 04 00 00 00       	mov    $0x4,%eax
+ 777:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+0000077d <read>:
+SYSCALL(read)
+ 77d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 782:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+00000788 <write>:
+SYSCALL(write)
+ 788:	b8 10 00 00 00       	mov    $0x10,%eax
+ 78d:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+00000793 <close>:
+SYSCALL(close)
+ 793:	b8 15 00 00 00       	mov    $0x15,%eax
+ 798:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+0000079e <kill>:
+SYSCALL(kill)
+ 79e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 7a3:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+000007a9 <exec>:
+SYSCALL(exec)
+ 7a9:	b8 07 00 00 00       	mov    $0x7,%eax
+ 7ae:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+000007b4 <open>:
+SYSCALL(open)
+ 7b4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 7b9:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+000007bf <mknod>:
+SYSCALL(mknod)
+ 7bf:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7c4:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+000007ca <unlink>:
+SYSCALL(unlink)
+ 7ca:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7cf:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+000007d5 <fstat>:
+SYSCALL(fstat)
+ 7d5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7da:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+000007e0 <link>:
+SYSCALL(link)
+ 7e0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7e5:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+000007eb <mkdir>:
+SYSCALL(mkdir)
+ 7eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7f0:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+000007f6 <chdir>:
+SYSCALL(chdir)
+ 7f6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7fb:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+00000801 <dup>:
+SYSCALL(dup)
+ 801:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 806:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+0000080c <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 80c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 811:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+00000817 <sbrk>:
+SYSCALL(sbrk)
+ 817:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 81c:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+00000822 <sleep>:
+SYSCALL(sleep)
+ 822:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 827:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+0000082d <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 82d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 832:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+00000838 <swapread>:
+SYSCALL(swapread)
+ 838:	b8 16 00 00 00       	mov    $0x16,%eax
+ 83d:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+00000843 <swapwrite>:
+SYSCALL(swapwrite)
+ 843:	b8 17 00 00 00       	mov    $0x17,%eax
+ 848:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+0000084e <swapstat>:
+SYSCALL(swapstat)
+ 84e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 853:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+00000859 <madvise>:
+SYSCALL(madvise)
+ 859:	b8 19 00 00 00       	mov    $0x19,%eax
+ 85e:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+00000864 <mlock>:
+SYSCALL(mlock)
+ 864:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 869:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+0000086f <munlock>:
+SYSCALL(munlock)
+ 86f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 874:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+0000087a <membench>:
+SYSCALL(membench)
+ 87a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 87f:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+00000885 <nice>:
+SYSCALL(nice)
+ 885:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 88a:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+00000890 <setpriority>:
+SYSCALL(setpriority)
+ 890:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 895:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+0000089b <usleep>:
+SYSCALL(usleep)
+ 89b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 8a0:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+000008a6 <cpustat>:
+SYSCALL(cpustat)
+ 8a6:	b8 20 00 00 00       	mov    $0x20,%eax
+ 8ab:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+000008b1 <clone>:
+SYSCALL(clone)
+ 8b1:	b8 21 00 00 00       	mov    $0x21,%eax
+ 8b6:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+000008bc <join>:
+SYSCALL(join)
+ 8bc:	b8 22 00 00 00       	mov    $0x22,%eax
+ 8c1:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+000008c7 <futex_wait>:
+SYSCALL(futex_wait)
+ 8c7:	b8 23 00 00 00       	mov    $0x23,%eax
+ 8cc:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+000008d2 <futex_wake>:
+SYSCALL(futex_wake)
+ 8d2:	b8 24 00 00 00       	mov    $0x24,%eax
+ 8d7:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+000008dd <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 8dd:	b8 25 00 00 00       	mov    $0x25,%eax
+ 8e2:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+000008e8 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 8e8:	b8 26 00 00 00       	mov    $0x26,%eax
+ 8ed:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+000008f3 <getcpu>:
+SYSCALL(getcpu)
+ 8f3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 8f8:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+000008fe <migrations>:
+SYSCALL(migrations)
+ 8fe:	b8 28 00 00 00       	mov    $0x28,%eax
+ 903:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+00000909 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 909:	b8 29 00 00 00       	mov    $0x29,%eax
+ 90e:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+00000914 <lockstat>:
+SYSCALL(lockstat)
+ 914:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 919:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+0000091f <lockprof>:
+SYSCALL(lockprof)
+ 91f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 924:	ff 25 3c 12 00 00    	jmp    *0x123c
+
+0000092a <bcachestat>:
+SYSCALL(bcachestat)
+ 92a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 92f:	ff 25 3c 12 00 00    	jmp    *0x123c
+ 935:	66 90                	xchg   %ax,%ax
+ 937:	66 90                	xchg   %ax,%ax
+ 939:	66 90                	xchg   %ax,%ax
+ 93b:	66 90                	xchg   %ax,%ax
+ 93d:	66 90                	xchg   %ax,%ax
+ 93f:	90                   	nop
+
+00000940 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 940:	55                   	push   %ebp
+ 941:	89 e5                	mov    %esp,%ebp
+ 943:	57                   	push   %edi
+ 944:	56                   	push   %esi
+ 945:	53                   	push   %ebx
+ 946:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 948:	89 d1                	mov    %edx,%ecx
+{
+ 94a:	83 ec 3c             	sub    $0x3c,%esp
+ 94d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 950:	85 d2                	test   %edx,%edx
+ 952:	0f 89 80 00 00 00    	jns    9d8 <printint+0x98>
+ 958:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 95c:	74 7a                	je     9d8 <printint+0x98>
+    x = -xx;
+ 95e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 960:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 965:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 968:	31 f6                	xor    %esi,%esi
+ 96a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 970:	89 c8                	mov    %ecx,%eax
+ 972:	31 d2                	xor    %edx,%edx
+ 974:	89 f7                	mov    %esi,%edi
+ 976:	f7 f3                	div    %ebx
+ 978:	8d 76 01             	lea    0x1(%esi),%esi
+ 97b:	0f b6 92 cc 0d 00 00 	movzbl 0xdcc(%edx),%edx
+ 982:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 986:	89 ca                	mov    %ecx,%edx
+ 988:	89 c1                	mov    %eax,%ecx
+ 98a:	39 da                	cmp    %ebx,%edx
+ 98c:	73 e2                	jae    970 <printint+0x30>
+  if(neg)
+ 98e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 991:	85 c0                	test   %eax,%eax
+ 993:	74 07                	je     99c <printint+0x5c>
+    buf[i++] = '-';
+ 995:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 99a:	89 f7                	mov    %esi,%edi
+ 99c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 99f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 9a2:	01 df                	add    %ebx,%edi
+ 9a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 9a8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 9ab:	83 ec 04             	sub    $0x4,%esp
+ 9ae:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 9b1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 9b4:	6a 01                	push   $0x1
+ 9b6:	50                   	push   %eax
+ 9b7:	56                   	push   %esi
+ 9b8:	e8 cb fd ff ff       	call   788 <write>
+  while(--i >= 0)
+ 9bd:	89 f8                	mov    %edi,%eax
+ 9bf:	83 c4 10             	add    $0x10,%esp
+ 9c2:	83 ef 01             	sub    $0x1,%edi
+ 9c5:	39 d8                	cmp    %ebx,%eax
+ 9c7:	75 df                	jne    9a8 <printint+0x68>
+}
+ 9c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9cc:	5b                   	pop    %ebx
+ 9cd:	5e                   	pop    %esi
+ 9ce:	5f                   	pop    %edi
+ 9cf:	5d                   	pop    %ebp
+ 9d0:	c3                   	ret
+ 9d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 9d8:	31 c0                	xor    %eax,%eax
+ 9da:	eb 89                	jmp    965 <printint+0x25>
+ 9dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000009e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 9e0:	55                   	push   %ebp
+ 9e1:	89 e5                	mov    %esp,%ebp
+ 9e3:	57                   	push   %edi
+ 9e4:	56                   	push   %esi
+ 9e5:	53                   	push   %ebx
+ 9e6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 9e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 9ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 9ef:	0f b6 1e             	movzbl (%esi),%ebx
+ 9f2:	83 c6 01             	add    $0x1,%esi
+ 9f5:	84 db                	test   %bl,%bl
+ 9f7:	74 67                	je     a60 <printf+0x80>
+ 9f9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 9fc:	31 d2                	xor    %edx,%edx
+ 9fe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ a01:	eb 34                	jmp    a37 <printf+0x57>
+ a03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a07:	90                   	nop
+ a08:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ a0b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ a10:	83 f8 25             	cmp    $0x25,%eax
+ a13:	74 18                	je     a2d <printf+0x4d>
+  write(fd, &c, 1);
+ a15:	83 ec 04             	sub    $0x4,%esp
+ a18:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ a1b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a1e:	6a 01                	push   $0x1
+ a20:	50                   	push   %eax
+ a21:	57                   	push   %edi
+ a22:	e8 61 fd ff ff       	call   788 <write>
+ a27:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ a2a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ a2d:	0f b6 1e             	movzbl (%esi),%ebx
+ a30:	83 c6 01             	add    $0x1,%esi
+ a33:	84 db                	test   %bl,%bl
+ a35:	74 29                	je     a60 <printf+0x80>
+    c = fmt[i] & 0xff;
+ a37:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ a3a:	85 d2                	test   %edx,%edx
+ a3c:	74 ca                	je     a08 <printf+0x28>
+      }
+    } else if(state == '%'){
+ a3e:	83 fa 25             	cmp    $0x25,%edx
+ a41:	75 ea                	jne    a2d <printf+0x4d>
+      if(c == 'd'){
+ a43:	83 f8 25             	cmp    $0x25,%eax
+ a46:	0f 84 24 01 00 00    	je     b70 <printf+0x190>
+ a4c:	83 e8 63             	sub    $0x63,%eax
+ a4f:	83 f8 15             	cmp    $0x15,%eax
+ a52:	77 1c                	ja     a70 <printf+0x90>
+ a54:	ff 24 85 74 0d 00 00 	jmp    *0xd74(,%eax,4)
+ a5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a5f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ a60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a63:	5b                   	pop    %ebx
+ a64:	5e                   	pop    %esi
+ a65:	5f                   	pop    %edi
+ a66:	5d                   	pop    %ebp
+ a67:	c3                   	ret
+ a68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a6f:	90                   	nop
+  write(fd, &c, 1);
+ a70:	83 ec 04             	sub    $0x4,%esp
+ a73:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a76:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ a7a:	6a 01                	push   $0x1
+ a7c:	52                   	push   %edx
+ a7d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ a80:	57                   	push   %edi
+ a81:	e8 02 fd ff ff       	call   788 <write>
+ a86:	83 c4 0c             	add    $0xc,%esp
+ a89:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a8c:	6a 01                	push   $0x1
+ a8e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ a91:	52                   	push   %edx
+ a92:	57                   	push   %edi
+ a93:	e8 f0 fc ff ff       	call   788 <write>
+        putc(fd, c);
+ a98:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a9b:	31 d2                	xor    %edx,%edx
+ a9d:	eb 8e                	jmp    a2d <printf+0x4d>
+ a9f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ aa0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ aa3:	83 ec 0c             	sub    $0xc,%esp
+ aa6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ aab:	8b 13                	mov    (%ebx),%edx
+ aad:	6a 00                	push   $0x0
+ aaf:	89 f8                	mov    %edi,%eax
+        ap++;
+ ab1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ ab4:	e8 87 fe ff ff       	call   940 <printint>
+        ap++;
+ ab9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ abc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ abf:	31 d2                	xor    %edx,%edx
+ ac1:	e9 67 ff ff ff       	jmp    a2d <printf+0x4d>
+ ac6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ acd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ ad0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ ad3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ ad5:	83 c0 04             	add    $0x4,%eax
+ ad8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ adb:	85 db                	test   %ebx,%ebx
+ add:	0f 84 9d 00 00 00    	je     b80 <printf+0x1a0>
+        while(*s != 0){
+ ae3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ ae6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ ae8:	84 c0                	test   %al,%al
+ aea:	0f 84 3d ff ff ff    	je     a2d <printf+0x4d>
+ af0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ af3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ af6:	89 de                	mov    %ebx,%esi
+ af8:	89 d3                	mov    %edx,%ebx
+ afa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ b00:	83 ec 04             	sub    $0x4,%esp
+ b03:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ b06:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ b09:	6a 01                	push   $0x1
+ b0b:	53                   	push   %ebx
+ b0c:	57                   	push   %edi
+ b0d:	e8 76 fc ff ff       	call   788 <write>
+        while(*s != 0){
+ b12:	0f b6 06             	movzbl (%esi),%eax
+ b15:	83 c4 10             	add    $0x10,%esp
+ b18:	84 c0                	test   %al,%al
+ b1a:	75 e4                	jne    b00 <printf+0x120>
+      state = 0;
+ b1c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ b1f:	31 d2                	xor    %edx,%edx
+ b21:	e9 07 ff ff ff       	jmp    a2d <printf+0x4d>
+ b26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b2d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ b30:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b33:	83 ec 0c             	sub    $0xc,%esp
+ b36:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ b3b:	8b 13                	mov    (%ebx),%edx
+ b3d:	6a 01                	push   $0x1
+ b3f:	e9 6b ff ff ff       	jmp    aaf <printf+0xcf>
+ b44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ b48:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ b4b:	83 ec 04             	sub    $0x4,%esp
+ b4e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ b51:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ b53:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ b56:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ b59:	6a 01                	push   $0x1
+ b5b:	52                   	push   %edx
+ b5c:	57                   	push   %edi
+ b5d:	e8 26 fc ff ff       	call   788 <write>
+        ap++;
+ b62:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b65:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b68:	31 d2                	xor    %edx,%edx
+ b6a:	e9 be fe ff ff       	jmp    a2d <printf+0x4d>
+ b6f:	90                   	nop
+  write(fd, &c, 1);
+ b70:	83 ec 04             	sub    $0x4,%esp
+ b73:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b76:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b79:	6a 01                	push   $0x1
+ b7b:	e9 11 ff ff ff       	jmp    a91 <printf+0xb1>
+ b80:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ b85:	bb 6d 0d 00 00       	mov    $0xd6d,%ebx
+ b8a:	e9 61 ff ff ff       	jmp    af0 <printf+0x110>
+ b8f:	90                   	nop
+
+00000b90 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b90:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b91:	a1 50 12 00 00       	mov    0x1250,%eax
+{
+ b96:	89 e5                	mov    %esp,%ebp
+ b98:	57                   	push   %edi
+ b99:	56                   	push   %esi
+ b9a:	53                   	push   %ebx
+ b9b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ b9e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ba1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ba8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ baa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bac:	39 ca                	cmp    %ecx,%edx
+ bae:	73 30                	jae    be0 <free+0x50>
+ bb0:	39 c1                	cmp    %eax,%ecx
+ bb2:	72 04                	jb     bb8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bb4:	39 c2                	cmp    %eax,%edx
+ bb6:	72 f0                	jb     ba8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ bb8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ bbb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ bbe:	39 f8                	cmp    %edi,%eax
+ bc0:	74 2e                	je     bf0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ bc2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ bc5:	8b 42 04             	mov    0x4(%edx),%eax
+ bc8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ bcb:	39 f1                	cmp    %esi,%ecx
+ bcd:	74 38                	je     c07 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ bcf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ bd1:	5b                   	pop    %ebx
+  freep = p;
+ bd2:	89 15 50 12 00 00    	mov    %edx,0x1250
+}
+ bd8:	5e                   	pop    %esi
+ bd9:	5f                   	pop    %edi
+ bda:	5d                   	pop    %ebp
+ bdb:	c3                   	ret
+ bdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ be0:	39 c1                	cmp    %eax,%ecx
+ be2:	72 d0                	jb     bb4 <free+0x24>
+ be4:	eb c2                	jmp    ba8 <free+0x18>
+ be6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bed:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ bf0:	03 70 04             	add    0x4(%eax),%esi
+ bf3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ bf6:	8b 02                	mov    (%edx),%eax
+ bf8:	8b 00                	mov    (%eax),%eax
+ bfa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ bfd:	8b 42 04             	mov    0x4(%edx),%eax
+ c00:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c03:	39 f1                	cmp    %esi,%ecx
+ c05:	75 c8                	jne    bcf <free+0x3f>
+    p->s.size += bp->s.size;
+ c07:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ c0a:	89 15 50 12 00 00    	mov    %edx,0x1250
+    p->s.size += bp->s.size;
+ c10:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ c13:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ c16:	89 0a                	mov    %ecx,(%edx)
+}
+ c18:	5b                   	pop    %ebx
+ c19:	5e                   	pop    %esi
+ c1a:	5f                   	pop    %edi
+ c1b:	5d                   	pop    %ebp
+ c1c:	c3                   	ret
+ c1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c20 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ c20:	55                   	push   %ebp
+ c21:	89 e5                	mov    %esp,%ebp
+ c23:	57                   	push   %edi
+ c24:	56                   	push   %esi
+ c25:	53                   	push   %ebx
+ c26:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c29:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ c2c:	8b 15 50 12 00 00    	mov    0x1250,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c32:	8d 78 07             	lea    0x7(%eax),%edi
+ c35:	c1 ef 03             	shr    $0x3,%edi
+ c38:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ c3b:	85 d2                	test   %edx,%edx
+ c3d:	0f 84 8d 00 00 00    	je     cd0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c43:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c45:	8b 48 04             	mov    0x4(%eax),%ecx
+ c48:	39 f9                	cmp    %edi,%ecx
+ c4a:	73 64                	jae    cb0 <malloc+0x90>
+  if(nu < 4096)
+ c4c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ c51:	39 df                	cmp    %ebx,%edi
+ c53:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ c56:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ c5d:	eb 0a                	jmp    c69 <malloc+0x49>
+ c5f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c60:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c62:	8b 48 04             	mov    0x4(%eax),%ecx
+ c65:	39 f9                	cmp    %edi,%ecx
+ c67:	73 47                	jae    cb0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ c69:	89 c2                	mov    %eax,%edx
+ c6b:	39 05 50 12 00 00    	cmp    %eax,0x1250
+ c71:	75 ed                	jne    c60 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ c73:	83 ec 0c             	sub    $0xc,%esp
+ c76:	56                   	push   %esi
+ c77:	e8 9b fb ff ff       	call   817 <sbrk>
+  if(p == (char*)-1)
+ c7c:	83 c4 10             	add    $0x10,%esp
+ c7f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c82:	74 1c                	je     ca0 <malloc+0x80>
+  hp->s.size = nu;
+ c84:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ c87:	83 ec 0c             	sub    $0xc,%esp
+ c8a:	83 c0 08             	add    $0x8,%eax
+ c8d:	50                   	push   %eax
+ c8e:	e8 fd fe ff ff       	call   b90 <free>
+  return freep;
+ c93:	8b 15 50 12 00 00    	mov    0x1250,%edx
+      if((p = morecore(nunits)) == 0)
+ c99:	83 c4 10             	add    $0x10,%esp
+ c9c:	85 d2                	test   %edx,%edx
+ c9e:	75 c0                	jne    c60 <malloc+0x40>
+        return 0;
+  }
+}
+ ca0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ ca3:	31 c0                	xor    %eax,%eax
+}
+ ca5:	5b                   	pop    %ebx
+ ca6:	5e                   	pop    %esi
+ ca7:	5f                   	pop    %edi
+ ca8:	5d                   	pop    %ebp
+ ca9:	c3                   	ret
+ caa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ cb0:	39 cf                	cmp    %ecx,%edi
+ cb2:	74 4c                	je     d00 <malloc+0xe0>
+        p->s.size -= nunits;
+ cb4:	29 f9                	sub    %edi,%ecx
+ cb6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ cb9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ cbc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ cbf:	89 15 50 12 00 00    	mov    %edx,0x1250
+}
+ cc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ cc8:	83 c0 08             	add    $0x8,%eax
+}
+ ccb:	5b                   	pop    %ebx
+ ccc:	5e                   	pop    %esi
+ ccd:	5f                   	pop    %edi
+ cce:	5d                   	pop    %ebp
+ ccf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ cd0:	c7 05 50 12 00 00 54 	movl   $0x1254,0x1250
+ cd7:	12 00 00 
+    base.s.size = 0;
+ cda:	b8 54 12 00 00       	mov    $0x1254,%eax
+    base.s.ptr = freep = prevp = &base;
+ cdf:	c7 05 54 12 00 00 54 	movl   $0x1254,0x1254
+ ce6:	12 00 00 
+    base.s.size = 0;
+ ce9:	c7 05 58 12 00 00 00 	movl   $0x0,0x1258
+ cf0:	00 00 00 
+    if(p->s.size >= nunits){
+ cf3:	e9 54 ff ff ff       	jmp    c4c <malloc+0x2c>
+ cf8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ d00:	8b 08                	mov    (%eax),%ecx
+ d02:	89 0a                	mov    %ecx,(%edx)
+ d04:	eb b9                	jmp    cbf <malloc+0x9f>
@@ -0,0 +1,1999 @@
+
+_madvbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  int i, mb, half, window;
+
+  mb = 240;
+  if(argc > 1)
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  17:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1)
+  1a:	0f 8f 88 02 00 00    	jg     2a8 <main+0x2a8>
+  20:	bf 00 f0 00 00       	mov    $0xf000,%edi
+    mb = atoi(argv[1]);
+  npages = mb * (1024*1024 / PGSIZE);
+  half = npages / 2;
+  25:	bb 00 78 00 00       	mov    $0x7800,%ebx
+  mb = 240;
+  2a:	b9 f0 00 00 00       	mov    $0xf0,%ecx
+  window = 16 * (1024*1024 / PGSIZE);
+  2f:	be 00 10 00 00       	mov    $0x1000,%esi
+  if(window > half)
+    window = half;
+
+  printf(1, "madvbench: %d MB\n", mb);
+  34:	83 ec 04             	sub    $0x4,%esp
+  npages = mb * (1024*1024 / PGSIZE);
+  37:	89 3d 30 15 00 00    	mov    %edi,0x1530
+  printf(1, "madvbench: %d MB\n", mb);
+  3d:	51                   	push   %ecx
+  3e:	68 33 0f 00 00       	push   $0xf33
+  43:	6a 01                	push   $0x1
+  45:	e8 b6 0a 00 00       	call   b00 <printf>
+  start();
+  4a:	e8 d1 02 00 00       	call   320 <start>
+  region = sbrk(npages * PGSIZE);
+  4f:	a1 30 15 00 00       	mov    0x1530,%eax
+  54:	c1 e0 0c             	shl    $0xc,%eax
+  57:	89 04 24             	mov    %eax,(%esp)
+  5a:	e8 d8 08 00 00       	call   937 <sbrk>
+  if(region == (char*)-1){
+  5f:	83 c4 10             	add    $0x10,%esp
+  region = sbrk(npages * PGSIZE);
+  62:	a3 34 15 00 00       	mov    %eax,0x1534
+  if(region == (char*)-1){
+  67:	83 f8 ff             	cmp    $0xffffffff,%eax
+  6a:	0f 84 98 02 00 00    	je     308 <main+0x308>
+    printf(1, "madvbench: sbrk failed\n");
+    exit();
+  }
+  for(i = 0; i < npages; i++)
+  70:	8b 3d 30 15 00 00    	mov    0x1530,%edi
+  76:	85 ff                	test   %edi,%edi
+  78:	7e 2e                	jle    a8 <main+0xa8>
+    region[i*PGSIZE] = i;
+  7a:	c6 00 00             	movb   $0x0,(%eax)
+  for(i = 0; i < npages; i++)
+  7d:	83 3d 30 15 00 00 01 	cmpl   $0x1,0x1530
+  84:	7e 22                	jle    a8 <main+0xa8>
+  86:	b8 01 00 00 00       	mov    $0x1,%eax
+  8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  8f:	90                   	nop
+    region[i*PGSIZE] = i;
+  90:	89 c2                	mov    %eax,%edx
+  92:	c1 e2 0c             	shl    $0xc,%edx
+  95:	03 15 34 15 00 00    	add    0x1534,%edx
+  9b:	88 02                	mov    %al,(%edx)
+  for(i = 0; i < npages; i++)
+  9d:	83 c0 01             	add    $0x1,%eax
+  a0:	39 05 30 15 00 00    	cmp    %eax,0x1530
+  a6:	7f e8                	jg     90 <main+0x90>
+  report("fill");
+  a8:	83 ec 0c             	sub    $0xc,%esp
+  ab:	68 5d 0f 00 00       	push   $0xf5d
+  b0:	e8 9b 02 00 00       	call   350 <report>
+
+  start();
+  b5:	e8 66 02 00 00       	call   320 <start>
+  seqscan(0, npages);
+  ba:	5f                   	pop    %edi
+  bb:	58                   	pop    %eax
+  bc:	ff 35 30 15 00 00    	push   0x1530
+  c2:	6a 00                	push   $0x0
+  c4:	e8 d7 02 00 00       	call   3a0 <seqscan>
+  report("sequential scan, MADV_NORMAL");
+  c9:	c7 04 24 62 0f 00 00 	movl   $0xf62,(%esp)
+  d0:	e8 7b 02 00 00       	call   350 <report>
+
+  madvise(region, npages * PGSIZE, MADV_SEQUENTIAL);
+  d5:	a1 30 15 00 00       	mov    0x1530,%eax
+  da:	83 c4 0c             	add    $0xc,%esp
+  dd:	6a 02                	push   $0x2
+  df:	c1 e0 0c             	shl    $0xc,%eax
+  e2:	50                   	push   %eax
+  e3:	ff 35 34 15 00 00    	push   0x1534
+  e9:	e8 8b 08 00 00       	call   979 <madvise>
+  start();
+  ee:	e8 2d 02 00 00       	call   320 <start>
+  seqscan(0, npages);
+  f3:	58                   	pop    %eax
+  f4:	5a                   	pop    %edx
+  f5:	ff 35 30 15 00 00    	push   0x1530
+  fb:	6a 00                	push   $0x0
+  fd:	e8 9e 02 00 00       	call   3a0 <seqscan>
+  report("sequential scan, MADV_SEQUENTIAL");
+ 102:	c7 04 24 54 0e 00 00 	movl   $0xe54,(%esp)
+ 109:	e8 42 02 00 00       	call   350 <report>
+
+  madvise(region, npages * PGSIZE, MADV_NORMAL);
+ 10e:	a1 30 15 00 00       	mov    0x1530,%eax
+ 113:	83 c4 0c             	add    $0xc,%esp
+ 116:	6a 00                	push   $0x0
+ 118:	c1 e0 0c             	shl    $0xc,%eax
+ 11b:	50                   	push   %eax
+ 11c:	ff 35 34 15 00 00    	push   0x1534
+ 122:	e8 52 08 00 00       	call   979 <madvise>
+  start();
+ 127:	e8 f4 01 00 00       	call   320 <start>
+  randscan(npages / 4);
+ 12c:	8b 15 30 15 00 00    	mov    0x1530,%edx
+ 132:	85 d2                	test   %edx,%edx
+ 134:	8d 42 03             	lea    0x3(%edx),%eax
+ 137:	0f 49 c2             	cmovns %edx,%eax
+ 13a:	c1 f8 02             	sar    $0x2,%eax
+ 13d:	89 04 24             	mov    %eax,(%esp)
+ 140:	e8 ab 02 00 00       	call   3f0 <randscan>
+  report("random scan, MADV_NORMAL");
+ 145:	c7 04 24 7f 0f 00 00 	movl   $0xf7f,(%esp)
+ 14c:	e8 ff 01 00 00       	call   350 <report>
+
+  madvise(region, npages * PGSIZE, MADV_RANDOM);
+ 151:	a1 30 15 00 00       	mov    0x1530,%eax
+ 156:	83 c4 0c             	add    $0xc,%esp
+ 159:	6a 01                	push   $0x1
+ 15b:	c1 e0 0c             	shl    $0xc,%eax
+ 15e:	50                   	push   %eax
+ 15f:	ff 35 34 15 00 00    	push   0x1534
+ 165:	e8 0f 08 00 00       	call   979 <madvise>
+  start();
+ 16a:	e8 b1 01 00 00       	call   320 <start>
+  randscan(npages / 4);
+ 16f:	8b 15 30 15 00 00    	mov    0x1530,%edx
+ 175:	85 d2                	test   %edx,%edx
+ 177:	8d 42 03             	lea    0x3(%edx),%eax
+ 17a:	0f 49 c2             	cmovns %edx,%eax
+ 17d:	c1 f8 02             	sar    $0x2,%eax
+ 180:	89 04 24             	mov    %eax,(%esp)
+ 183:	e8 68 02 00 00       	call   3f0 <randscan>
+  report("random scan, MADV_RANDOM");
+ 188:	c7 04 24 98 0f 00 00 	movl   $0xf98,(%esp)
+ 18f:	e8 bc 01 00 00       	call   350 <report>
+
+  madvise(region, npages * PGSIZE, MADV_NORMAL);
+ 194:	a1 30 15 00 00       	mov    0x1530,%eax
+ 199:	83 c4 0c             	add    $0xc,%esp
+ 19c:	6a 00                	push   $0x0
+ 19e:	c1 e0 0c             	shl    $0xc,%eax
+ 1a1:	50                   	push   %eax
+ 1a2:	ff 35 34 15 00 00    	push   0x1534
+ 1a8:	e8 cc 07 00 00       	call   979 <madvise>
+  start();
+ 1ad:	e8 6e 01 00 00       	call   320 <start>
+  if(madvise(region, window * PGSIZE, MADV_WILLNEED) < 0)
+ 1b2:	89 f0                	mov    %esi,%eax
+ 1b4:	83 c4 0c             	add    $0xc,%esp
+ 1b7:	c1 e0 0c             	shl    $0xc,%eax
+ 1ba:	6a 03                	push   $0x3
+ 1bc:	50                   	push   %eax
+ 1bd:	ff 35 34 15 00 00    	push   0x1534
+ 1c3:	e8 b1 07 00 00       	call   979 <madvise>
+ 1c8:	83 c4 10             	add    $0x10,%esp
+ 1cb:	85 c0                	test   %eax,%eax
+ 1cd:	0f 88 1f 01 00 00    	js     2f2 <main+0x2f2>
+    printf(1, "madvbench: MADV_WILLNEED failed\n");
+  report("MADV_WILLNEED on window");
+ 1d3:	83 ec 0c             	sub    $0xc,%esp
+ 1d6:	68 b1 0f 00 00       	push   $0xfb1
+ 1db:	e8 70 01 00 00       	call   350 <report>
+  start();
+ 1e0:	e8 3b 01 00 00       	call   320 <start>
+  seqscan(0, window);
+ 1e5:	58                   	pop    %eax
+ 1e6:	5a                   	pop    %edx
+ 1e7:	56                   	push   %esi
+ 1e8:	6a 00                	push   $0x0
+ 1ea:	e8 b1 01 00 00       	call   3a0 <seqscan>
+  report("scan of window after MADV_WILLNEED");
+ 1ef:	c7 04 24 9c 0e 00 00 	movl   $0xe9c,(%esp)
+ 1f6:	e8 55 01 00 00       	call   350 <report>
+
+  start();
+ 1fb:	e8 20 01 00 00       	call   320 <start>
+  if(madvise(region + half * PGSIZE, (npages - half) * PGSIZE, MADV_DONTNEED) < 0)
+ 200:	a1 30 15 00 00       	mov    0x1530,%eax
+ 205:	83 c4 0c             	add    $0xc,%esp
+ 208:	6a 04                	push   $0x4
+ 20a:	29 d8                	sub    %ebx,%eax
+ 20c:	c1 e0 0c             	shl    $0xc,%eax
+ 20f:	50                   	push   %eax
+ 210:	89 d8                	mov    %ebx,%eax
+ 212:	c1 e0 0c             	shl    $0xc,%eax
+ 215:	03 05 34 15 00 00    	add    0x1534,%eax
+ 21b:	50                   	push   %eax
+ 21c:	e8 58 07 00 00       	call   979 <madvise>
+ 221:	83 c4 10             	add    $0x10,%esp
+ 224:	85 c0                	test   %eax,%eax
+ 226:	0f 88 b0 00 00 00    	js     2dc <main+0x2dc>
+    printf(1, "madvbench: MADV_DONTNEED failed\n");
+  report("MADV_DONTNEED on upper half");
+ 22c:	83 ec 0c             	sub    $0xc,%esp
+ 22f:	68 c9 0f 00 00       	push   $0xfc9
+ 234:	e8 17 01 00 00       	call   350 <report>
+  start();
+ 239:	e8 e2 00 00 00       	call   320 <start>
+  seqscan(0, half);
+ 23e:	59                   	pop    %ecx
+ 23f:	5e                   	pop    %esi
+ 240:	53                   	push   %ebx
+ 241:	6a 00                	push   $0x0
+ 243:	e8 58 01 00 00       	call   3a0 <seqscan>
+  report("sequential scan of lower half");
+ 248:	c7 04 24 e5 0f 00 00 	movl   $0xfe5,(%esp)
+ 24f:	e8 fc 00 00 00       	call   350 <report>
+  for(i = half; i < npages; i++){
+ 254:	8b 15 30 15 00 00    	mov    0x1530,%edx
+ 25a:	83 c4 10             	add    $0x10,%esp
+ 25d:	39 da                	cmp    %ebx,%edx
+ 25f:	7e 34                	jle    295 <main+0x295>
+    if(region[i*PGSIZE] != 0){
+ 261:	8b 0d 34 15 00 00    	mov    0x1534,%ecx
+ 267:	eb 0e                	jmp    277 <main+0x277>
+ 269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = half; i < npages; i++){
+ 270:	83 c3 01             	add    $0x1,%ebx
+ 273:	39 d3                	cmp    %edx,%ebx
+ 275:	74 1e                	je     295 <main+0x295>
+    if(region[i*PGSIZE] != 0){
+ 277:	89 d8                	mov    %ebx,%eax
+ 279:	c1 e0 0c             	shl    $0xc,%eax
+ 27c:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+ 280:	74 ee                	je     270 <main+0x270>
+      printf(1, "madvbench: page %d not zero after MADV_DONTNEED\n", i);
+ 282:	52                   	push   %edx
+ 283:	53                   	push   %ebx
+ 284:	68 e4 0e 00 00       	push   $0xee4
+ 289:	6a 01                	push   $0x1
+ 28b:	e8 70 08 00 00       	call   b00 <printf>
+      exit();
+ 290:	e8 e7 05 00 00       	call   87c <exit>
+    }
+  }
+
+  printf(1, "madvbench ok\n");
+ 295:	50                   	push   %eax
+ 296:	50                   	push   %eax
+ 297:	68 03 10 00 00       	push   $0x1003
+ 29c:	6a 01                	push   $0x1
+ 29e:	e8 5d 08 00 00       	call   b00 <printf>
+  exit();
+ 2a3:	e8 d4 05 00 00       	call   87c <exit>
+    mb = atoi(argv[1]);
+ 2a8:	83 ec 0c             	sub    $0xc,%esp
+ 2ab:	ff 70 04             	push   0x4(%eax)
+  half = npages / 2;
+ 2ae:	bb 02 00 00 00       	mov    $0x2,%ebx
+  window = 16 * (1024*1024 / PGSIZE);
+ 2b3:	be 00 10 00 00       	mov    $0x1000,%esi
+    mb = atoi(argv[1]);
+ 2b8:	e8 73 03 00 00       	call   630 <atoi>
+  if(window > half)
+ 2bd:	83 c4 10             	add    $0x10,%esp
+  npages = mb * (1024*1024 / PGSIZE);
+ 2c0:	89 c7                	mov    %eax,%edi
+    mb = atoi(argv[1]);
+ 2c2:	89 c1                	mov    %eax,%ecx
+  npages = mb * (1024*1024 / PGSIZE);
+ 2c4:	c1 e7 08             	shl    $0x8,%edi
+  half = npages / 2;
+ 2c7:	89 f8                	mov    %edi,%eax
+ 2c9:	99                   	cltd
+ 2ca:	f7 fb                	idiv   %ebx
+  window = 16 * (1024*1024 / PGSIZE);
+ 2cc:	81 ff 00 20 00 00    	cmp    $0x2000,%edi
+ 2d2:	0f 4c f0             	cmovl  %eax,%esi
+  half = npages / 2;
+ 2d5:	89 c3                	mov    %eax,%ebx
+  if(window > half)
+ 2d7:	e9 58 fd ff ff       	jmp    34 <main+0x34>
+    printf(1, "madvbench: MADV_DONTNEED failed\n");
+ 2dc:	57                   	push   %edi
+ 2dd:	57                   	push   %edi
+ 2de:	68 c0 0e 00 00       	push   $0xec0
+ 2e3:	6a 01                	push   $0x1
+ 2e5:	e8 16 08 00 00       	call   b00 <printf>
+ 2ea:	83 c4 10             	add    $0x10,%esp
+ 2ed:	e9 3a ff ff ff       	jmp    22c <main+0x22c>
+    printf(1, "madvbench: MADV_WILLNEED failed\n");
+ 2f2:	51                   	push   %ecx
+ 2f3:	51                   	push   %ecx
+ 2f4:	68 78 0e 00 00       	push   $0xe78
+ 2f9:	6a 01                	push   $0x1
+ 2fb:	e8 00 08 00 00       	call   b00 <printf>
+ 300:	83 c4 10             	add    $0x10,%esp
+ 303:	e9 cb fe ff ff       	jmp    1d3 <main+0x1d3>
+    printf(1, "madvbench: sbrk failed\n");
+ 308:	51                   	push   %ecx
+ 309:	51                   	push   %ecx
+ 30a:	68 45 0f 00 00       	push   $0xf45
+ 30f:	6a 01                	push   $0x1
+ 311:	e8 ea 07 00 00       	call   b00 <printf>
+    exit();
+ 316:	e8 61 05 00 00       	call   87c <exit>
+ 31b:	66 90                	xchg   %ax,%ax
+ 31d:	66 90                	xchg   %ax,%ax
+ 31f:	90                   	nop
+
+00000320 <start>:
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	83 ec 08             	sub    $0x8,%esp
+  t0 = uptime();
+ 326:	e8 95 03 00 00       	call   6c0 <uptime>
+  swapstat(&r0, &w0);
+ 32b:	83 ec 08             	sub    $0x8,%esp
+  t0 = uptime();
+ 32e:	a3 2c 15 00 00       	mov    %eax,0x152c
+  swapstat(&r0, &w0);
+ 333:	68 24 15 00 00       	push   $0x1524
+ 338:	68 28 15 00 00       	push   $0x1528
+ 33d:	e8 2c 06 00 00       	call   96e <swapstat>
+}
+ 342:	83 c4 10             	add    $0x10,%esp
+ 345:	c9                   	leave
+ 346:	c3                   	ret
+ 347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34e:	66 90                	xchg   %ax,%ax
+
+00000350 <report>:
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	56                   	push   %esi
+ 354:	53                   	push   %ebx
+  swapstat(&r, &w);
+ 355:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ 358:	83 ec 18             	sub    $0x18,%esp
+  swapstat(&r, &w);
+ 35b:	50                   	push   %eax
+ 35c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 35f:	50                   	push   %eax
+ 360:	e8 09 06 00 00       	call   96e <swapstat>
+  printf(1, "%s: %d ticks, %d sectors read, %d written\n",
+ 365:	8b 75 f4             	mov    -0xc(%ebp),%esi
+ 368:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+ 36b:	2b 35 24 15 00 00    	sub    0x1524,%esi
+ 371:	2b 1d 28 15 00 00    	sub    0x1528,%ebx
+         what, uptime() - t0, r - r0, w - w0);
+ 377:	e8 44 03 00 00       	call   6c0 <uptime>
+  printf(1, "%s: %d ticks, %d sectors read, %d written\n",
+ 37c:	5a                   	pop    %edx
+ 37d:	59                   	pop    %ecx
+ 37e:	56                   	push   %esi
+ 37f:	53                   	push   %ebx
+ 380:	2b 05 2c 15 00 00    	sub    0x152c,%eax
+ 386:	50                   	push   %eax
+ 387:	ff 75 08             	push   0x8(%ebp)
+ 38a:	68 28 0e 00 00       	push   $0xe28
+ 38f:	6a 01                	push   $0x1
+ 391:	e8 6a 07 00 00       	call   b00 <printf>
+}
+ 396:	83 c4 20             	add    $0x20,%esp
+ 399:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 39c:	5b                   	pop    %ebx
+ 39d:	5e                   	pop    %esi
+ 39e:	5d                   	pop    %ebp
+ 39f:	c3                   	ret
+
+000003a0 <seqscan>:
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	53                   	push   %ebx
+ 3a4:	83 ec 04             	sub    $0x4,%esp
+ 3a7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  for(i = first; i < first + n; i++){
+ 3ad:	8d 0c 10             	lea    (%eax,%edx,1),%ecx
+ 3b0:	85 d2                	test   %edx,%edx
+ 3b2:	7e 1d                	jle    3d1 <seqscan+0x31>
+    if(region[i*PGSIZE] != (char)i){
+ 3b4:	8b 1d 34 15 00 00    	mov    0x1534,%ebx
+ 3ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 3c0:	89 c2                	mov    %eax,%edx
+ 3c2:	c1 e2 0c             	shl    $0xc,%edx
+ 3c5:	38 04 13             	cmp    %al,(%ebx,%edx,1)
+ 3c8:	75 0c                	jne    3d6 <seqscan+0x36>
+  for(i = first; i < first + n; i++){
+ 3ca:	83 c0 01             	add    $0x1,%eax
+ 3cd:	39 c8                	cmp    %ecx,%eax
+ 3cf:	7c ef                	jl     3c0 <seqscan+0x20>
+}
+ 3d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3d4:	c9                   	leave
+ 3d5:	c3                   	ret
+      printf(1, "madvbench: page %d corrupted\n", i);
+ 3d6:	83 ec 04             	sub    $0x4,%esp
+ 3d9:	50                   	push   %eax
+ 3da:	68 15 0f 00 00       	push   $0xf15
+ 3df:	6a 01                	push   $0x1
+ 3e1:	e8 1a 07 00 00       	call   b00 <printf>
+      exit();
+ 3e6:	e8 91 04 00 00       	call   87c <exit>
+ 3eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ef:	90                   	nop
+
+000003f0 <randscan>:
+{
+ 3f0:	55                   	push   %ebp
+  seed = 12345;
+ 3f1:	b9 39 30 00 00       	mov    $0x3039,%ecx
+{
+ 3f6:	89 e5                	mov    %esp,%ebp
+ 3f8:	57                   	push   %edi
+ 3f9:	56                   	push   %esi
+ 3fa:	53                   	push   %ebx
+ 3fb:	83 ec 0c             	sub    $0xc,%esp
+    i = (seed >> 8) % npages;
+ 3fe:	8b 35 30 15 00 00    	mov    0x1530,%esi
+    if(region[i*PGSIZE] != (char)i){
+ 404:	8b 3d 34 15 00 00    	mov    0x1534,%edi
+ 40a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  while(n-- > 0){
+ 40d:	eb 23                	jmp    432 <randscan+0x42>
+ 40f:	90                   	nop
+    seed = seed * 1103515245 + 12345;
+ 410:	69 c9 6d 4e c6 41    	imul   $0x41c64e6d,%ecx,%ecx
+    i = (seed >> 8) % npages;
+ 416:	31 d2                	xor    %edx,%edx
+    if(region[i*PGSIZE] != (char)i){
+ 418:	83 eb 01             	sub    $0x1,%ebx
+    seed = seed * 1103515245 + 12345;
+ 41b:	81 c1 39 30 00 00    	add    $0x3039,%ecx
+    i = (seed >> 8) % npages;
+ 421:	89 c8                	mov    %ecx,%eax
+ 423:	c1 e8 08             	shr    $0x8,%eax
+ 426:	f7 f6                	div    %esi
+    if(region[i*PGSIZE] != (char)i){
+ 428:	89 d0                	mov    %edx,%eax
+ 42a:	c1 e0 0c             	shl    $0xc,%eax
+ 42d:	38 14 07             	cmp    %dl,(%edi,%eax,1)
+ 430:	75 0c                	jne    43e <randscan+0x4e>
+  while(n-- > 0){
+ 432:	85 db                	test   %ebx,%ebx
+ 434:	7f da                	jg     410 <randscan+0x20>
+}
+ 436:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 439:	5b                   	pop    %ebx
+ 43a:	5e                   	pop    %esi
+ 43b:	5f                   	pop    %edi
+ 43c:	5d                   	pop    %ebp
+ 43d:	c3                   	ret
+      printf(1, "madvbench: page %d corrupted\n", i);
+ 43e:	83 ec 04             	sub    $0x4,%esp
+ 441:	52                   	push   %edx
+ 442:	68 15 0f 00 00       	push   $0xf15
+ 447:	6a 01                	push   $0x1
+ 449:	e8 b2 06 00 00       	call   b00 <printf>
+      exit();
+ 44e:	e8 29 04 00 00       	call   87c <exit>
+ 453:	66 90                	xchg   %ax,%ax
+ 455:	66 90                	xchg   %ax,%ax
+ 457:	66 90                	xchg   %ax,%ax
+ 459:	66 90                	xchg   %ax,%ax
+ 45b:	66 90                	xchg   %ax,%ax
+ 45d:	66 90                	xchg   %ax,%ax
+ 45f:	90                   	nop
+
+00000460 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 460:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 461:	31 c0                	xor    %eax,%eax
+{
+ 463:	89 e5                	mov    %esp,%ebp
+ 465:	53                   	push   %ebx
+ 466:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 469:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 46c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 470:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 474:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 477:	83 c0 01             	add    $0x1,%eax
+ 47a:	84 d2                	test   %dl,%dl
+ 47c:	75 f2                	jne    470 <strcpy+0x10>
+    ;
+  return os;
+}
+ 47e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 481:	89 c8                	mov    %ecx,%eax
+ 483:	c9                   	leave
+ 484:	c3                   	ret
+ 485:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	53                   	push   %ebx
+ 494:	8b 55 08             	mov    0x8(%ebp),%edx
+ 497:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 49a:	0f b6 02             	movzbl (%edx),%eax
+ 49d:	84 c0                	test   %al,%al
+ 49f:	75 17                	jne    4b8 <strcmp+0x28>
+ 4a1:	eb 3a                	jmp    4dd <strcmp+0x4d>
+ 4a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4a7:	90                   	nop
+ 4a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 4ac:	83 c2 01             	add    $0x1,%edx
+ 4af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 4b2:	84 c0                	test   %al,%al
+ 4b4:	74 1a                	je     4d0 <strcmp+0x40>
+    p++, q++;
+ 4b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 4b8:	0f b6 19             	movzbl (%ecx),%ebx
+ 4bb:	38 c3                	cmp    %al,%bl
+ 4bd:	74 e9                	je     4a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 4bf:	29 d8                	sub    %ebx,%eax
+}
+ 4c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4c4:	c9                   	leave
+ 4c5:	c3                   	ret
+ 4c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 4d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 4d4:	31 c0                	xor    %eax,%eax
+ 4d6:	29 d8                	sub    %ebx,%eax
+}
+ 4d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4db:	c9                   	leave
+ 4dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 4dd:	0f b6 19             	movzbl (%ecx),%ebx
+ 4e0:	31 c0                	xor    %eax,%eax
+ 4e2:	eb db                	jmp    4bf <strcmp+0x2f>
+ 4e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ef:	90                   	nop
+
+000004f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 4f6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 4f9:	74 15                	je     510 <strlen+0x20>
+ 4fb:	31 c0                	xor    %eax,%eax
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 500:	83 c0 01             	add    $0x1,%eax
+ 503:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 507:	89 c1                	mov    %eax,%ecx
+ 509:	75 f5                	jne    500 <strlen+0x10>
+    ;
+  return n;
+}
+ 50b:	89 c8                	mov    %ecx,%eax
+ 50d:	5d                   	pop    %ebp
+ 50e:	c3                   	ret
+ 50f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 510:	31 c9                	xor    %ecx,%ecx
+}
+ 512:	5d                   	pop    %ebp
+ 513:	89 c8                	mov    %ecx,%eax
+ 515:	c3                   	ret
+ 516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000520 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	57                   	push   %edi
+ 524:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 527:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 52a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 52d:	89 d7                	mov    %edx,%edi
+ 52f:	fc                   	cld
+ 530:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 532:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 535:	89 d0                	mov    %edx,%eax
+ 537:	c9                   	leave
+ 538:	c3                   	ret
+ 539:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000540 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	8b 45 08             	mov    0x8(%ebp),%eax
+ 546:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 54a:	0f b6 10             	movzbl (%eax),%edx
+ 54d:	84 d2                	test   %dl,%dl
+ 54f:	75 12                	jne    563 <strchr+0x23>
+ 551:	eb 1d                	jmp    570 <strchr+0x30>
+ 553:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 557:	90                   	nop
+ 558:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 55c:	83 c0 01             	add    $0x1,%eax
+ 55f:	84 d2                	test   %dl,%dl
+ 561:	74 0d                	je     570 <strchr+0x30>
+    if(*s == c)
+ 563:	38 d1                	cmp    %dl,%cl
+ 565:	75 f1                	jne    558 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 567:	5d                   	pop    %ebp
+ 568:	c3                   	ret
+ 569:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 570:	31 c0                	xor    %eax,%eax
+}
+ 572:	5d                   	pop    %ebp
+ 573:	c3                   	ret
+ 574:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 57f:	90                   	nop
+
+00000580 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 585:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 588:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 589:	31 db                	xor    %ebx,%ebx
+{
+ 58b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 58e:	eb 27                	jmp    5b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 590:	83 ec 04             	sub    $0x4,%esp
+ 593:	6a 01                	push   $0x1
+ 595:	56                   	push   %esi
+ 596:	6a 00                	push   $0x0
+ 598:	e8 00 03 00 00       	call   89d <read>
+    if(cc < 1)
+ 59d:	83 c4 10             	add    $0x10,%esp
+ 5a0:	85 c0                	test   %eax,%eax
+ 5a2:	7e 1d                	jle    5c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 5a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 5a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 5af:	3c 0a                	cmp    $0xa,%al
+ 5b1:	74 10                	je     5c3 <gets+0x43>
+ 5b3:	3c 0d                	cmp    $0xd,%al
+ 5b5:	74 0c                	je     5c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 5b7:	89 df                	mov    %ebx,%edi
+ 5b9:	83 c3 01             	add    $0x1,%ebx
+ 5bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 5bf:	7c cf                	jl     590 <gets+0x10>
+ 5c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 5c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 5ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5cd:	5b                   	pop    %ebx
+ 5ce:	5e                   	pop    %esi
+ 5cf:	5f                   	pop    %edi
+ 5d0:	5d                   	pop    %ebp
+ 5d1:	c3                   	ret
+ 5d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	56                   	push   %esi
+ 5e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 5e5:	83 ec 08             	sub    $0x8,%esp
+ 5e8:	6a 00                	push   $0x0
+ 5ea:	ff 75 08             	push   0x8(%ebp)
+ 5ed:	e8 e2 02 00 00       	call   8d4 <open>
+  if(fd < 0)
+ 5f2:	83 c4 10             	add    $0x10,%esp
+ 5f5:	85 c0                	test   %eax,%eax
+ 5f7:	78 27                	js     620 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 5f9:	83 ec 08             	sub    $0x8,%esp
+ 5fc:	ff 75 0c             	push   0xc(%ebp)
+ 5ff:	89 c3                	mov    %eax,%ebx
+ 601:	50                   	push   %eax
+ 602:	e8 ee 02 00 00       	call   8f5 <fstat>
+  close(fd);
+ 607:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 60a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 60c:	e8 a2 02 00 00       	call   8b3 <close>
+  return r;
+ 611:	83 c4 10             	add    $0x10,%esp
+}
+ 614:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 617:	89 f0                	mov    %esi,%eax
+ 619:	5b                   	pop    %ebx
+ 61a:	5e                   	pop    %esi
+ 61b:	5d                   	pop    %ebp
+ 61c:	c3                   	ret
+ 61d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 620:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 625:	eb ed                	jmp    614 <stat+0x34>
+ 627:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62e:	66 90                	xchg   %ax,%ax
+
+00000630 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	53                   	push   %ebx
+ 634:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 637:	0f be 02             	movsbl (%edx),%eax
+ 63a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 63d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 640:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 645:	77 1e                	ja     665 <atoi+0x35>
+ 647:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 650:	83 c2 01             	add    $0x1,%edx
+ 653:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 656:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 65a:	0f be 02             	movsbl (%edx),%eax
+ 65d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 660:	80 fb 09             	cmp    $0x9,%bl
+ 663:	76 eb                	jbe    650 <atoi+0x20>
+  return n;
+}
+ 665:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 668:	89 c8                	mov    %ecx,%eax
+ 66a:	c9                   	leave
+ 66b:	c3                   	ret
+ 66c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000670 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 670:	55                   	push   %ebp
+ 671:	89 e5                	mov    %esp,%ebp
+ 673:	57                   	push   %edi
+ 674:	56                   	push   %esi
+ 675:	8b 45 10             	mov    0x10(%ebp),%eax
+ 678:	8b 55 08             	mov    0x8(%ebp),%edx
+ 67b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 67e:	85 c0                	test   %eax,%eax
+ 680:	7e 13                	jle    695 <memmove+0x25>
+ 682:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 684:	89 d7                	mov    %edx,%edi
+ 686:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 68d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 690:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 691:	39 f8                	cmp    %edi,%eax
+ 693:	75 fb                	jne    690 <memmove+0x20>
+  return vdst;
+}
+ 695:	5e                   	pop    %esi
+ 696:	89 d0                	mov    %edx,%eax
+ 698:	5f                   	pop    %edi
+ 699:	5d                   	pop    %ebp
+ 69a:	c3                   	ret
+ 69b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 69f:	90                   	nop
+
+000006a0 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 6a0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 6a5:	85 c0                	test   %eax,%eax
+ 6a7:	74 07                	je     6b0 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 6a9:	c3                   	ret
+ 6aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 6b0:	e9 77 02 00 00       	jmp    92c <sysgetpid>
+ 6b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006c0 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 6c0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 6c5:	c3                   	ret
+ 6c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006d0 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 6d0:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 6d1:	31 d2                	xor    %edx,%edx
+ 6d3:	89 e5                	mov    %esp,%ebp
+ 6d5:	53                   	push   %ebx
+ 6d6:	83 ec 04             	sub    $0x4,%esp
+ 6d9:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 6dc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 6df:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 6e2:	85 c9                	test   %ecx,%ecx
+ 6e4:	7e 08                	jle    6ee <cyclereport+0x1e>
+ 6e6:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 6e8:	89 d8                	mov    %ebx,%eax
+ 6ea:	f7 f1                	div    %ecx
+ 6ec:	89 c2                	mov    %eax,%edx
+ 6ee:	83 ec 08             	sub    $0x8,%esp
+ 6f1:	52                   	push   %edx
+ 6f2:	ff 75 0c             	push   0xc(%ebp)
+ 6f5:	51                   	push   %ecx
+ 6f6:	ff 75 08             	push   0x8(%ebp)
+ 6f9:	68 11 10 00 00       	push   $0x1011
+ 6fe:	6a 01                	push   $0x1
+ 700:	e8 fb 03 00 00       	call   b00 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 705:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 708:	83 c4 20             	add    $0x20,%esp
+ 70b:	c9                   	leave
+ 70c:	c3                   	ret
+ 70d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000710 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 713:	8b 45 08             	mov    0x8(%ebp),%eax
+ 716:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 71c:	5d                   	pop    %ebp
+ 71d:	c3                   	ret
+ 71e:	66 90                	xchg   %ax,%ax
+
+00000720 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 720:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 721:	31 c0                	xor    %eax,%eax
+ 723:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 728:	89 e5                	mov    %esp,%ebp
+ 72a:	56                   	push   %esi
+ 72b:	53                   	push   %ebx
+ 72c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 72f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 733:	85 c0                	test   %eax,%eax
+ 735:	74 30                	je     767 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 737:	83 f8 02             	cmp    $0x2,%eax
+ 73a:	74 0c                	je     748 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 73c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 741:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 744:	85 c0                	test   %eax,%eax
+ 746:	74 1f                	je     767 <mutex_lock+0x47>
+ 748:	be 02 00 00 00       	mov    $0x2,%esi
+ 74d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 750:	83 ec 08             	sub    $0x8,%esp
+ 753:	6a 02                	push   $0x2
+ 755:	53                   	push   %ebx
+ 756:	e8 8c 02 00 00       	call   9e7 <futex_wait>
+ 75b:	89 f0                	mov    %esi,%eax
+ 75d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 760:	83 c4 10             	add    $0x10,%esp
+ 763:	85 c0                	test   %eax,%eax
+ 765:	75 e9                	jne    750 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 767:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 76a:	5b                   	pop    %ebx
+ 76b:	5e                   	pop    %esi
+ 76c:	5d                   	pop    %ebp
+ 76d:	c3                   	ret
+ 76e:	66 90                	xchg   %ax,%ax
+
+00000770 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	83 ec 08             	sub    $0x8,%esp
+ 776:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 779:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 77d:	75 09                	jne    788 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 77f:	c9                   	leave
+ 780:	c3                   	ret
+ 781:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 788:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 78b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 791:	6a 01                	push   $0x1
+ 793:	50                   	push   %eax
+ 794:	e8 59 02 00 00       	call   9f2 <futex_wake>
+ 799:	83 c4 10             	add    $0x10,%esp
+}
+ 79c:	c9                   	leave
+ 79d:	c3                   	ret
+ 79e:	66 90                	xchg   %ax,%ax
+
+000007a0 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 7a0:	55                   	push   %ebp
+ 7a1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 7a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7a6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 7ac:	5d                   	pop    %ebp
+ 7ad:	c3                   	ret
+ 7ae:	66 90                	xchg   %ax,%ax
+
+000007b0 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 e5                	mov    %esp,%ebp
+ 7b3:	57                   	push   %edi
+ 7b4:	56                   	push   %esi
+ 7b5:	53                   	push   %ebx
+ 7b6:	83 ec 0c             	sub    $0xc,%esp
+ 7b9:	8b 75 08             	mov    0x8(%ebp),%esi
+ 7bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 7bf:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 7c1:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 7c5:	75 21                	jne    7e8 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 7c7:	83 ec 08             	sub    $0x8,%esp
+ 7ca:	57                   	push   %edi
+ 7cb:	56                   	push   %esi
+ 7cc:	e8 16 02 00 00       	call   9e7 <futex_wait>
+  mutex_lock(m);
+ 7d1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 7d4:	83 c4 10             	add    $0x10,%esp
+}
+ 7d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7da:	5b                   	pop    %ebx
+ 7db:	5e                   	pop    %esi
+ 7dc:	5f                   	pop    %edi
+ 7dd:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 7de:	e9 3d ff ff ff       	jmp    720 <mutex_lock>
+ 7e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7e7:	90                   	nop
+    futex_wake(&m->v, 1);
+ 7e8:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 7eb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 7f1:	6a 01                	push   $0x1
+ 7f3:	53                   	push   %ebx
+ 7f4:	e8 f9 01 00 00       	call   9f2 <futex_wake>
+ 7f9:	83 c4 10             	add    $0x10,%esp
+ 7fc:	eb c9                	jmp    7c7 <cond_wait+0x17>
+ 7fe:	66 90                	xchg   %ax,%ax
+
+00000800 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 800:	55                   	push   %ebp
+ 801:	89 e5                	mov    %esp,%ebp
+ 803:	83 ec 10             	sub    $0x10,%esp
+ 806:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 809:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 80d:	6a 01                	push   $0x1
+ 80f:	50                   	push   %eax
+ 810:	e8 dd 01 00 00       	call   9f2 <futex_wake>
+}
+ 815:	83 c4 10             	add    $0x10,%esp
+ 818:	c9                   	leave
+ 819:	c3                   	ret
+ 81a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000820 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 820:	55                   	push   %ebp
+ 821:	89 e5                	mov    %esp,%ebp
+ 823:	83 ec 10             	sub    $0x10,%esp
+ 826:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 829:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 82d:	68 ff ff ff 7f       	push   $0x7fffffff
+ 832:	50                   	push   %eax
+ 833:	e8 ba 01 00 00       	call   9f2 <futex_wake>
+}
+ 838:	83 c4 10             	add    $0x10,%esp
+ 83b:	c9                   	leave
+ 83c:	c3                   	ret
+
+0000083d <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 83d:	50                   	push   %eax
+  pushl %ebx
+ 83e:	53                   	push   %ebx
+  movl $1, %eax
+ 83f:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 844:	0f a2                	cpuid
+  popl %ebx
+ 846:	5b                   	pop    %ebx
+  popl %eax
+ 847:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 848:	c7 05 20 15 00 00 6e 	movl   $0x86e,0x1520
+ 84f:	08 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 852:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 858:	74 14                	je     86e <sysint>
+  movl $sysfast, syscallvec
+ 85a:	c7 05 20 15 00 00 64 	movl   $0x864,0x1520
+ 861:	08 00 00 
+
+00000864 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 864:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 866:	ba 6d 08 00 00       	mov    $0x86d,%edx
+  sysenter
+ 86b:	0f 34                	sysenter
+1:
+  ret
+ 86d:	c3                   	ret
+
+0000086e <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 86e:	cd 40                	int    $0x40
+  ret
+ 870:	c3                   	ret
+
+00000871 <fork>:
+
+SYSCALL(fork)
+ 871:	b8 01 00 00 00       	mov    $0x1,%eax
+ 876:	ff 25 20 15 00 00    	jmp    *0x1520
+
+0000087c <exit>:
+SYSCALL(exit)
+ 87c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 881:	ff 25 20 15 00 00    	jmp    *0x1520
+
+00000887 <wait>:
+SYSCALL(wait)
+ 887:	b8 03 00 00 00       	mov    $0x3,%eax
+ 88c:	ff 25 20 15 00 00    	jmp    *0x1520
+
+00000892 <pipe>:
+SYSCALL(pipe)
+ 892:	b8 04 00 00 00       	mov    $0x4,%eax
+ 897:	ff 25 20 15 00 00    	jmp    *0x1520
+
+0000089d <read>:
+SYSCALL(read)
+ 89d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 8a2:	ff 25 20 15 00 00    	jmp    *0x1520
+
+000008a8 <write>:
+SYSCALL(write)
+ 8a8:	b8 10 00 00 00       	mov    $0x10,%eax
+ 8ad:	ff 25 20 15 00 00    	jmp    *0x1520
+
+000008b3 <close>:
+SYSCALL(close)
+ 8b3:	b8 15 00 00 00       	mov    $0x15,%eax
+ 8b8:	ff 25 20 15 00 00    	jmp    *0x1520
+
+000008be <kill>:
+SYSCALL(kill)
+ 8be:	b8 06 00 00 00       	mov    $0x6,%eax
+ 8c3:	ff 25 20 15 00 00    	jmp    *0x1520
+
+000008c9 <exec>:
+SYSCALL(exec)
+ 8c9:	b8 07 00 00 00       	mov    $0x7,%eax
+ 8ce:	ff 25 20 15 00 00    	jmp    *0x1520
+
+000008d4 <open>:
+SYSCALL(open)
+ 8d4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 8d9:	ff 25 20 15 00 00    	jmp    *0x1520
+
+000008df <mknod>:
+SYSCALL(mknod)
+ 8df:	b8 11 00 00 00       	mov    $0x11,%eax
+ 8e4:	ff 25 20 15 00 00    	jmp    *0x1520
+
+000008ea <unlink>:
+SYSCALL(unlink)
+ 8ea:	b8 12 00 00 00       	mov    $0x12,%eax
+ 8ef:	ff 25 20 15 00 00    	jmp    *0x1520
+
+000008f5 <fstat>:
+SYSCALL(fstat)
+ 8f5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 8fa:	ff 25 20 15 00 00    	jmp    *0x1520
+
+00000900 <link>:
+SYSCALL(link)
+ 900:	b8 13 00 00 00       	mov    $0x13,%eax
+ 905:	ff 25 20 15 00 00    	jmp    *0x1520
+
+0000090b <mkdir>:
+SYSCALL(mkdir)
+ 90b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 910:	ff 25 20 15 00 00    	jmp    *0x1520
+
+00000916 <chdir>:
+SYSCALL(chdir)
+ 916:	b8 09 00 00 00       	mov    $0x9,%eax
+ 91b:	ff 25 20 15 00 00    	jmp    *0x1520
+
+00000921 <dup>:
+SYSCALL(dup)
+ 921:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 926:	ff 25 20 15 00 00    	jmp    *0x1520
+
+0000092c <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 92c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 931:	ff 25 20 15 00 00    	jmp    *0x1520
+
+00000937 <sbrk>:
+SYSCALL(sbrk)
+ 937:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 93c:	ff 25 20 15 00 00    	jmp    *0x1520
+
+00000942 <sleep>:
+SYSCALL(sleep)
+ 942:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 947:	ff 25 20 15 00 00    	jmp    *0x1520
+
+0000094d <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 94d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 952:	ff 25 20 15 00 00    	jmp    *0x1520
+
+00000958 <swapread>:
+SYSCALL(swapread)
+ 958:	b8 16 00 00 00       	mov    $0x16,%eax
+ 95d:	ff 25 20 15 00 00    	jmp    *0x1520
+
+00000963 <swapwrite>:
+SYSCALL(swapwrite)
+ 963:	b8 17 00 00 00       	mov    $0x17,%eax
+ 968:	ff 25 20 15 00 00    	jmp    *0x1520
+
+0000096e <swapstat>:
+SYSCALL(swapstat)
+ 96e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 973:	ff 25 20 15 00 00    	jmp    *0x1520
+
+00000979 <madvise>:
+SYSCALL(madvise)
+ 979:	b8 19 00 00 00       	mov    $0x19,%eax
+ 97e:	ff 25 20 15 00 00    	jmp    *0x1520
+
+00000984 <mlock>:
+SYSCALL(mlock)
+ 984:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 989:	ff 25 20 15 00 00    	jmp    *0x1520
+
+0000098f <munlock>:
+SYSCALL(munlock)
+ 98f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 994:	ff 25 20 15 00 00    	jmp    *0x1520
+
+0000099a <membench>:
+SYSCALL(membench)
+ 99a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 99f:	ff 25 20 15 00 00    	jmp    *0x1520
+
+000009a5 <nice>:
+SYSCALL(nice)
+ 9a5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 9aa:	ff 25 20 15 00 00    	jmp    *0x1520
+
+000009b0 <setpriority>:
+SYSCALL(setpriority)
+ 9b0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 9b5:	ff 25 20 15 00 00    	jmp    *0x1520
+
+000009bb <usleep>:
+SYSCALL(usleep)
+ 9bb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 9c0:	ff 25 20 15 00 00    	jmp    *0x1520
+
+000009c6 <cpustat>:
+SYSCALL(cpustat)
+ 9c6:	b8 20 00 00 00       	mov    $0x20,%eax
+ 9cb:	ff 25 20 15 00 00    	jmp    *0x1520
+
+000009d1 <clone>:
+SYSCALL(clone)
+ 9d1:	b8 21 00 00 00       	mov    $0x21,%eax
+ 9d6:	ff 25 20 15 00 00    	jmp    *0x1520
+
+000009dc <join>:
+SYSCALL(join)
+ 9dc:	b8 22 00 00 00       	mov    $0x22,%eax
+ 9e1:	ff 25 20 15 00 00    	jmp    *0x1520
+
+000009e7 <futex_wait>:
+SYSCALL(futex_wait)
+ 9e7:	b8 23 00 00 00       	mov    $0x23,%eax
+ 9ec:	ff 25 20 15 00 00    	jmp    *0x1520
+
+000009f2 <futex_wake>:
+SYSCALL(futex_wake)
+ 9f2:	b8 24 00 00 00       	mov    $0x24,%eax
+ 9f7:	ff 25 20 15 00 00    	jmp    *0x1520
+
+000009fd <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 9fd:	b8 25 00 00 00       	mov    $0x25,%eax
+ a02:	ff 25 20 15 00 00    	jmp    *0x1520
+
+00000a08 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ a08:	b8 26 00 00 00       	mov    $0x26,%eax
+ a0d:	ff 25 20 15 00 00    	jmp    *0x1520
+
+00000a13 <getcpu>:
+SYSCALL(getcpu)
+ a13:	b8 27 00 00 00       	mov    $0x27,%eax
+ a18:	ff 25 20 15 00 00    	jmp    *0x1520
+
+00000a1e <migrations>:
+SYSCALL(migrations)
+ a1e:	b8 28 00 00 00       	mov    $0x28,%eax
+ a23:	ff 25 20 15 00 00    	jmp    *0x1520
+
+00000a29 <ioring_enter>:
+SYSCALL(ioring_enter)
+ a29:	b8 29 00 00 00       	mov    $0x29,%eax
+ a2e:	ff 25 20 15 00 00    	jmp    *0x1520
+
+00000a34 <lockstat>:
+SYSCALL(lockstat)
+ a34:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ a39:	ff 25 20 15 00 00    	jmp    *0x1520
+
+00000a3f <lockprof>:
+SYSCALL(lockprof)
+ a3f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ a44:	ff 25 20 15 00 00    	jmp    *0x1520
+
+00000a4a <bcachestat>:
+SYSCALL(bcachestat)
+ a4a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ a4f:	ff 25 20 15 00 00    	jmp    *0x1520
+ a55:	66 90                	xchg   %ax,%ax
+ a57:	66 90                	xchg   %ax,%ax
+ a59:	66 90                	xchg   %ax,%ax
+ a5b:	66 90                	xchg   %ax,%ax
+ a5d:	66 90                	xchg   %ax,%ax
+ a5f:	90                   	nop
+
+00000a60 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a60:	55                   	push   %ebp
+ a61:	89 e5                	mov    %esp,%ebp
+ a63:	57                   	push   %edi
+ a64:	56                   	push   %esi
+ a65:	53                   	push   %ebx
+ a66:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ a68:	89 d1                	mov    %edx,%ecx
+{
+ a6a:	83 ec 3c             	sub    $0x3c,%esp
+ a6d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ a70:	85 d2                	test   %edx,%edx
+ a72:	0f 89 80 00 00 00    	jns    af8 <printint+0x98>
+ a78:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ a7c:	74 7a                	je     af8 <printint+0x98>
+    x = -xx;
+ a7e:	f7 d9                	neg    %ecx
+    neg = 1;
+ a80:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ a85:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ a88:	31 f6                	xor    %esi,%esi
+ a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ a90:	89 c8                	mov    %ecx,%eax
+ a92:	31 d2                	xor    %edx,%edx
+ a94:	89 f7                	mov    %esi,%edi
+ a96:	f7 f3                	div    %ebx
+ a98:	8d 76 01             	lea    0x1(%esi),%esi
+ a9b:	0f b6 92 8c 10 00 00 	movzbl 0x108c(%edx),%edx
+ aa2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ aa6:	89 ca                	mov    %ecx,%edx
+ aa8:	89 c1                	mov    %eax,%ecx
+ aaa:	39 da                	cmp    %ebx,%edx
+ aac:	73 e2                	jae    a90 <printint+0x30>
+  if(neg)
+ aae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ ab1:	85 c0                	test   %eax,%eax
+ ab3:	74 07                	je     abc <printint+0x5c>
+    buf[i++] = '-';
+ ab5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ aba:	89 f7                	mov    %esi,%edi
+ abc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ abf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ ac2:	01 df                	add    %ebx,%edi
+ ac4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ ac8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ acb:	83 ec 04             	sub    $0x4,%esp
+ ace:	88 45 d7             	mov    %al,-0x29(%ebp)
+ ad1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ ad4:	6a 01                	push   $0x1
+ ad6:	50                   	push   %eax
+ ad7:	56                   	push   %esi
+ ad8:	e8 cb fd ff ff       	call   8a8 <write>
+  while(--i >= 0)
+ add:	89 f8                	mov    %edi,%eax
+ adf:	83 c4 10             	add    $0x10,%esp
+ ae2:	83 ef 01             	sub    $0x1,%edi
+ ae5:	39 d8                	cmp    %ebx,%eax
+ ae7:	75 df                	jne    ac8 <printint+0x68>
+}
+ ae9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ aec:	5b                   	pop    %ebx
+ aed:	5e                   	pop    %esi
+ aee:	5f                   	pop    %edi
+ aef:	5d                   	pop    %ebp
+ af0:	c3                   	ret
+ af1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ af8:	31 c0                	xor    %eax,%eax
+ afa:	eb 89                	jmp    a85 <printint+0x25>
+ afc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b00 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ b00:	55                   	push   %ebp
+ b01:	89 e5                	mov    %esp,%ebp
+ b03:	57                   	push   %edi
+ b04:	56                   	push   %esi
+ b05:	53                   	push   %ebx
+ b06:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ b09:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ b0c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ b0f:	0f b6 1e             	movzbl (%esi),%ebx
+ b12:	83 c6 01             	add    $0x1,%esi
+ b15:	84 db                	test   %bl,%bl
+ b17:	74 67                	je     b80 <printf+0x80>
+ b19:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ b1c:	31 d2                	xor    %edx,%edx
+ b1e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ b21:	eb 34                	jmp    b57 <printf+0x57>
+ b23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b27:	90                   	nop
+ b28:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ b2b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ b30:	83 f8 25             	cmp    $0x25,%eax
+ b33:	74 18                	je     b4d <printf+0x4d>
+  write(fd, &c, 1);
+ b35:	83 ec 04             	sub    $0x4,%esp
+ b38:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ b3b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b3e:	6a 01                	push   $0x1
+ b40:	50                   	push   %eax
+ b41:	57                   	push   %edi
+ b42:	e8 61 fd ff ff       	call   8a8 <write>
+ b47:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ b4a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ b4d:	0f b6 1e             	movzbl (%esi),%ebx
+ b50:	83 c6 01             	add    $0x1,%esi
+ b53:	84 db                	test   %bl,%bl
+ b55:	74 29                	je     b80 <printf+0x80>
+    c = fmt[i] & 0xff;
+ b57:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ b5a:	85 d2                	test   %edx,%edx
+ b5c:	74 ca                	je     b28 <printf+0x28>
+      }
+    } else if(state == '%'){
+ b5e:	83 fa 25             	cmp    $0x25,%edx
+ b61:	75 ea                	jne    b4d <printf+0x4d>
+      if(c == 'd'){
+ b63:	83 f8 25             	cmp    $0x25,%eax
+ b66:	0f 84 24 01 00 00    	je     c90 <printf+0x190>
+ b6c:	83 e8 63             	sub    $0x63,%eax
+ b6f:	83 f8 15             	cmp    $0x15,%eax
+ b72:	77 1c                	ja     b90 <printf+0x90>
+ b74:	ff 24 85 34 10 00 00 	jmp    *0x1034(,%eax,4)
+ b7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b7f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ b80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b83:	5b                   	pop    %ebx
+ b84:	5e                   	pop    %esi
+ b85:	5f                   	pop    %edi
+ b86:	5d                   	pop    %ebp
+ b87:	c3                   	ret
+ b88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b8f:	90                   	nop
+  write(fd, &c, 1);
+ b90:	83 ec 04             	sub    $0x4,%esp
+ b93:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b96:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ b9a:	6a 01                	push   $0x1
+ b9c:	52                   	push   %edx
+ b9d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ ba0:	57                   	push   %edi
+ ba1:	e8 02 fd ff ff       	call   8a8 <write>
+ ba6:	83 c4 0c             	add    $0xc,%esp
+ ba9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ bac:	6a 01                	push   $0x1
+ bae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ bb1:	52                   	push   %edx
+ bb2:	57                   	push   %edi
+ bb3:	e8 f0 fc ff ff       	call   8a8 <write>
+        putc(fd, c);
+ bb8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ bbb:	31 d2                	xor    %edx,%edx
+ bbd:	eb 8e                	jmp    b4d <printf+0x4d>
+ bbf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ bc0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ bc3:	83 ec 0c             	sub    $0xc,%esp
+ bc6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ bcb:	8b 13                	mov    (%ebx),%edx
+ bcd:	6a 00                	push   $0x0
+ bcf:	89 f8                	mov    %edi,%eax
+        ap++;
+ bd1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ bd4:	e8 87 fe ff ff       	call   a60 <printint>
+        ap++;
+ bd9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ bdc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ bdf:	31 d2                	xor    %edx,%edx
+ be1:	e9 67 ff ff ff       	jmp    b4d <printf+0x4d>
+ be6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ bf0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ bf3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ bf5:	83 c0 04             	add    $0x4,%eax
+ bf8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ bfb:	85 db                	test   %ebx,%ebx
+ bfd:	0f 84 9d 00 00 00    	je     ca0 <printf+0x1a0>
+        while(*s != 0){
+ c03:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ c06:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ c08:	84 c0                	test   %al,%al
+ c0a:	0f 84 3d ff ff ff    	je     b4d <printf+0x4d>
+ c10:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c13:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ c16:	89 de                	mov    %ebx,%esi
+ c18:	89 d3                	mov    %edx,%ebx
+ c1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ c20:	83 ec 04             	sub    $0x4,%esp
+ c23:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ c26:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ c29:	6a 01                	push   $0x1
+ c2b:	53                   	push   %ebx
+ c2c:	57                   	push   %edi
+ c2d:	e8 76 fc ff ff       	call   8a8 <write>
+        while(*s != 0){
+ c32:	0f b6 06             	movzbl (%esi),%eax
+ c35:	83 c4 10             	add    $0x10,%esp
+ c38:	84 c0                	test   %al,%al
+ c3a:	75 e4                	jne    c20 <printf+0x120>
+      state = 0;
+ c3c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ c3f:	31 d2                	xor    %edx,%edx
+ c41:	e9 07 ff ff ff       	jmp    b4d <printf+0x4d>
+ c46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c4d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ c50:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ c53:	83 ec 0c             	sub    $0xc,%esp
+ c56:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ c5b:	8b 13                	mov    (%ebx),%edx
+ c5d:	6a 01                	push   $0x1
+ c5f:	e9 6b ff ff ff       	jmp    bcf <printf+0xcf>
+ c64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ c68:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ c6b:	83 ec 04             	sub    $0x4,%esp
+ c6e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ c71:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ c73:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ c76:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ c79:	6a 01                	push   $0x1
+ c7b:	52                   	push   %edx
+ c7c:	57                   	push   %edi
+ c7d:	e8 26 fc ff ff       	call   8a8 <write>
+        ap++;
+ c82:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ c85:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c88:	31 d2                	xor    %edx,%edx
+ c8a:	e9 be fe ff ff       	jmp    b4d <printf+0x4d>
+ c8f:	90                   	nop
+  write(fd, &c, 1);
+ c90:	83 ec 04             	sub    $0x4,%esp
+ c93:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ c96:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c99:	6a 01                	push   $0x1
+ c9b:	e9 11 ff ff ff       	jmp    bb1 <printf+0xb1>
+ ca0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ ca5:	bb 2c 10 00 00       	mov    $0x102c,%ebx
+ caa:	e9 61 ff ff ff       	jmp    c10 <printf+0x110>
+ caf:	90                   	nop
+
+00000cb0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ cb0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cb1:	a1 38 15 00 00       	mov    0x1538,%eax
+{
+ cb6:	89 e5                	mov    %esp,%ebp
+ cb8:	57                   	push   %edi
+ cb9:	56                   	push   %esi
+ cba:	53                   	push   %ebx
+ cbb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ cbe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cc8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ccc:	39 ca                	cmp    %ecx,%edx
+ cce:	73 30                	jae    d00 <free+0x50>
+ cd0:	39 c1                	cmp    %eax,%ecx
+ cd2:	72 04                	jb     cd8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cd4:	39 c2                	cmp    %eax,%edx
+ cd6:	72 f0                	jb     cc8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ cd8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ cdb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ cde:	39 f8                	cmp    %edi,%eax
+ ce0:	74 2e                	je     d10 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ce2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ ce5:	8b 42 04             	mov    0x4(%edx),%eax
+ ce8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ceb:	39 f1                	cmp    %esi,%ecx
+ ced:	74 38                	je     d27 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ cef:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ cf1:	5b                   	pop    %ebx
+  freep = p;
+ cf2:	89 15 38 15 00 00    	mov    %edx,0x1538
+}
+ cf8:	5e                   	pop    %esi
+ cf9:	5f                   	pop    %edi
+ cfa:	5d                   	pop    %ebp
+ cfb:	c3                   	ret
+ cfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d00:	39 c1                	cmp    %eax,%ecx
+ d02:	72 d0                	jb     cd4 <free+0x24>
+ d04:	eb c2                	jmp    cc8 <free+0x18>
+ d06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d0d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ d10:	03 70 04             	add    0x4(%eax),%esi
+ d13:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d16:	8b 02                	mov    (%edx),%eax
+ d18:	8b 00                	mov    (%eax),%eax
+ d1a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ d1d:	8b 42 04             	mov    0x4(%edx),%eax
+ d20:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d23:	39 f1                	cmp    %esi,%ecx
+ d25:	75 c8                	jne    cef <free+0x3f>
+    p->s.size += bp->s.size;
+ d27:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ d2a:	89 15 38 15 00 00    	mov    %edx,0x1538
+    p->s.size += bp->s.size;
+ d30:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ d33:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ d36:	89 0a                	mov    %ecx,(%edx)
+}
+ d38:	5b                   	pop    %ebx
+ d39:	5e                   	pop    %esi
+ d3a:	5f                   	pop    %edi
+ d3b:	5d                   	pop    %ebp
+ d3c:	c3                   	ret
+ d3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d40 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d40:	55                   	push   %ebp
+ d41:	89 e5                	mov    %esp,%ebp
+ d43:	57                   	push   %edi
+ d44:	56                   	push   %esi
+ d45:	53                   	push   %ebx
+ d46:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d49:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ d4c:	8b 15 38 15 00 00    	mov    0x1538,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d52:	8d 78 07             	lea    0x7(%eax),%edi
+ d55:	c1 ef 03             	shr    $0x3,%edi
+ d58:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ d5b:	85 d2                	test   %edx,%edx
+ d5d:	0f 84 8d 00 00 00    	je     df0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d63:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d65:	8b 48 04             	mov    0x4(%eax),%ecx
+ d68:	39 f9                	cmp    %edi,%ecx
+ d6a:	73 64                	jae    dd0 <malloc+0x90>
+  if(nu < 4096)
+ d6c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ d71:	39 df                	cmp    %ebx,%edi
+ d73:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ d76:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ d7d:	eb 0a                	jmp    d89 <malloc+0x49>
+ d7f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d80:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d82:	8b 48 04             	mov    0x4(%eax),%ecx
+ d85:	39 f9                	cmp    %edi,%ecx
+ d87:	73 47                	jae    dd0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ d89:	89 c2                	mov    %eax,%edx
+ d8b:	39 05 38 15 00 00    	cmp    %eax,0x1538
+ d91:	75 ed                	jne    d80 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ d93:	83 ec 0c             	sub    $0xc,%esp
+ d96:	56                   	push   %esi
+ d97:	e8 9b fb ff ff       	call   937 <sbrk>
+  if(p == (char*)-1)
+ d9c:	83 c4 10             	add    $0x10,%esp
+ d9f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ da2:	74 1c                	je     dc0 <malloc+0x80>
+  hp->s.size = nu;
+ da4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ da7:	83 ec 0c             	sub    $0xc,%esp
+ daa:	83 c0 08             	add    $0x8,%eax
+ dad:	50                   	push   %eax
+ dae:	e8 fd fe ff ff       	call   cb0 <free>
+  return freep;
+ db3:	8b 15 38 15 00 00    	mov    0x1538,%edx
+      if((p = morecore(nunits)) == 0)
+ db9:	83 c4 10             	add    $0x10,%esp
+ dbc:	85 d2                	test   %edx,%edx
+ dbe:	75 c0                	jne    d80 <malloc+0x40>
+        return 0;
+  }
+}
+ dc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ dc3:	31 c0                	xor    %eax,%eax
+}
+ dc5:	5b                   	pop    %ebx
+ dc6:	5e                   	pop    %esi
+ dc7:	5f                   	pop    %edi
+ dc8:	5d                   	pop    %ebp
+ dc9:	c3                   	ret
+ dca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ dd0:	39 cf                	cmp    %ecx,%edi
+ dd2:	74 4c                	je     e20 <malloc+0xe0>
+        p->s.size -= nunits;
+ dd4:	29 f9                	sub    %edi,%ecx
+ dd6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ dd9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ ddc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ ddf:	89 15 38 15 00 00    	mov    %edx,0x1538
+}
+ de5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ de8:	83 c0 08             	add    $0x8,%eax
+}
+ deb:	5b                   	pop    %ebx
+ dec:	5e                   	pop    %esi
+ ded:	5f                   	pop    %edi
+ dee:	5d                   	pop    %ebp
+ def:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ df0:	c7 05 38 15 00 00 3c 	movl   $0x153c,0x1538
+ df7:	15 00 00 
+    base.s.size = 0;
+ dfa:	b8 3c 15 00 00       	mov    $0x153c,%eax
+    base.s.ptr = freep = prevp = &base;
+ dff:	c7 05 3c 15 00 00 3c 	movl   $0x153c,0x153c
+ e06:	15 00 00 
+    base.s.size = 0;
+ e09:	c7 05 40 15 00 00 00 	movl   $0x0,0x1540
+ e10:	00 00 00 
+    if(p->s.size >= nunits){
+ e13:	e9 54 ff ff ff       	jmp    d6c <malloc+0x2c>
+ e18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e1f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ e20:	8b 08                	mov    (%eax),%ecx
+ e22:	89 0a                	mov    %ecx,(%edx)
+ e24:	eb b9                	jmp    ddf <malloc+0x9f>
@@ -0,0 +1,133 @@
+// Measure how madvise() hints change the swap traffic and the
+// time of scans over a region larger than physical memory.
+// usage: madvbench [megabytes]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "mman.h"
+
+#define PGSIZE 4096
+
+char *region;
+int npages;
+int t0, r0, w0;
+
+void
+start(void)
+{
+  t0 = uptime();
+  swapstat(&r0, &w0);
+}
+
+void
+report(char *what)
+{
+  int r, w;
+
+  swapstat(&r, &w);
+  printf(1, "%s: %d ticks, %d sectors read, %d written\n",
+         what, uptime() - t0, r - r0, w - w0);
+}
+
+// Read every page in order and check what was written there.
+void
+seqscan(int first, int n)
+{
+  int i;
+
+  for(i = first; i < first + n; i++){
+    if(region[i*PGSIZE] != (char)i){
+      printf(1, "madvbench: page %d corrupted\n", i);
+      exit();
+    }
+  }
+}
+
+void
+randscan(int n)
+{
+  uint seed;
+  int i;
+
+  seed = 12345;
+  while(n-- > 0){
+    seed = seed * 1103515245 + 12345;
+    i = (seed >> 8) % npages;
+    if(region[i*PGSIZE] != (char)i){
+      printf(1, "madvbench: page %d corrupted\n", i);
+      exit();
+    }
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, mb, half, window;
+
+  mb = 240;
+  if(argc > 1)
+    mb = atoi(argv[1]);
+  npages = mb * (1024*1024 / PGSIZE);
+  half = npages / 2;
+  window = 16 * (1024*1024 / PGSIZE);
+  if(window > half)
+    window = half;
+
+  printf(1, "madvbench: %d MB\n", mb);
+  start();
+  region = sbrk(npages * PGSIZE);
+  if(region == (char*)-1){
+    printf(1, "madvbench: sbrk failed\n");
+    exit();
+  }
+  for(i = 0; i < npages; i++)
+    region[i*PGSIZE] = i;
+  report("fill");
+
+  start();
+  seqscan(0, npages);
+  report("sequential scan, MADV_NORMAL");
+
+  madvise(region, npages * PGSIZE, MADV_SEQUENTIAL);
+  start();
+  seqscan(0, npages);
+  report("sequential scan, MADV_SEQUENTIAL");
+
+  madvise(region, npages * PGSIZE, MADV_NORMAL);
+  start();
+  randscan(npages / 4);
+  report("random scan, MADV_NORMAL");
+
+  madvise(region, npages * PGSIZE, MADV_RANDOM);
+  start();
+  randscan(npages / 4);
+  report("random scan, MADV_RANDOM");
+
+  madvise(region, npages * PGSIZE, MADV_NORMAL);
+  start();
+  if(madvise(region, window * PGSIZE, MADV_WILLNEED) < 0)
+    printf(1, "madvbench: MADV_WILLNEED failed\n");
+  report("MADV_WILLNEED on window");
+  start();
+  seqscan(0, window);
+  report("scan of window after MADV_WILLNEED");
+
+  start();
+  if(madvise(region + half * PGSIZE, (npages - half) * PGSIZE, MADV_DONTNEED) < 0)
+    printf(1, "madvbench: MADV_DONTNEED failed\n");
+  report("MADV_DONTNEED on upper half");
+  start();
+  seqscan(0, half);
+  report("sequential scan of lower half");
+  for(i = half; i < npages; i++){
+    if(region[i*PGSIZE] != 0){
+      printf(1, "madvbench: page %d not zero after MADV_DONTNEED\n", i);
+      exit();
+    }
+  }
+
+  printf(1, "madvbench ok\n");
+  exit();
+}
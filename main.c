@@ -3,6 +3,7 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 
@@ -17,6 +18,7 @@ extern char end[]; // first address after kernel loaded from ELF file
 int
 main(void)
 {
+  stringinit();    // pick memory copy routines
   kinit1(end, P2V(4*1024*1024)); // phys page allocator
   kvmalloc();      // kernel page table
   mpinit();        // detect other processors
@@ -26,7 +28,9 @@ main(void)
   ioapicinit();    // another interrupt controller
   consoleinit();   // console hardware
   uartinit();      // serial port
+  timerinit();     // calibrate TSC and APIC timer
   pinit();         // process table
+  futexinit();     // futex locks
   tvinit();        // trap vectors
   binit();         // buffer cache
   fileinit();      // file table
@@ -53,6 +57,7 @@ mpmain(void)
 {
   cprintf("cpu%d: starting %d\n", cpuid(), cpuid());
   idtinit();       // load idt register
+  fpuinit();       // lazy FPU and SSE switching
   xchg(&(mycpu()->started), 1); // tell startothers() we're up
   scheduler();     // start running processes
 }
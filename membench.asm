@@ -0,0 +1,1543 @@
+
+_membench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(membench() < 0)
+  11:	e8 64 05 00 00       	call   57a <membench>
+  16:	85 c0                	test   %eax,%eax
+  18:	78 05                	js     1f <main+0x1f>
+    printf(2, "membench: failed\n");
+  exit();
+  1a:	e8 3d 04 00 00       	call   45c <exit>
+    printf(2, "membench: failed\n");
+  1f:	50                   	push   %eax
+  20:	50                   	push   %eax
+  21:	68 08 0a 00 00       	push   $0xa08
+  26:	6a 02                	push   $0x2
+  28:	e8 b3 06 00 00       	call   6e0 <printf>
+  2d:	83 c4 10             	add    $0x10,%esp
+  30:	eb e8                	jmp    1a <main+0x1a>
+  32:	66 90                	xchg   %ax,%ax
+  34:	66 90                	xchg   %ax,%ax
+  36:	66 90                	xchg   %ax,%ax
+  38:	66 90                	xchg   %ax,%ax
+  3a:	66 90                	xchg   %ax,%ax
+  3c:	66 90                	xchg   %ax,%ax
+  3e:	66 90                	xchg   %ax,%ax
+
+00000040 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  40:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  41:	31 c0                	xor    %eax,%eax
+{
+  43:	89 e5                	mov    %esp,%ebp
+  45:	53                   	push   %ebx
+  46:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  49:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  50:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  54:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  57:	83 c0 01             	add    $0x1,%eax
+  5a:	84 d2                	test   %dl,%dl
+  5c:	75 f2                	jne    50 <strcpy+0x10>
+    ;
+  return os;
+}
+  5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  61:	89 c8                	mov    %ecx,%eax
+  63:	c9                   	leave
+  64:	c3                   	ret
+  65:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000070 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  70:	55                   	push   %ebp
+  71:	89 e5                	mov    %esp,%ebp
+  73:	53                   	push   %ebx
+  74:	8b 55 08             	mov    0x8(%ebp),%edx
+  77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  7a:	0f b6 02             	movzbl (%edx),%eax
+  7d:	84 c0                	test   %al,%al
+  7f:	75 17                	jne    98 <strcmp+0x28>
+  81:	eb 3a                	jmp    bd <strcmp+0x4d>
+  83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  87:	90                   	nop
+  88:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  8c:	83 c2 01             	add    $0x1,%edx
+  8f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  92:	84 c0                	test   %al,%al
+  94:	74 1a                	je     b0 <strcmp+0x40>
+    p++, q++;
+  96:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  98:	0f b6 19             	movzbl (%ecx),%ebx
+  9b:	38 c3                	cmp    %al,%bl
+  9d:	74 e9                	je     88 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  9f:	29 d8                	sub    %ebx,%eax
+}
+  a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  a4:	c9                   	leave
+  a5:	c3                   	ret
+  a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  b4:	31 c0                	xor    %eax,%eax
+  b6:	29 d8                	sub    %ebx,%eax
+}
+  b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  bb:	c9                   	leave
+  bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  bd:	0f b6 19             	movzbl (%ecx),%ebx
+  c0:	31 c0                	xor    %eax,%eax
+  c2:	eb db                	jmp    9f <strcmp+0x2f>
+  c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  cf:	90                   	nop
+
+000000d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  d0:	55                   	push   %ebp
+  d1:	89 e5                	mov    %esp,%ebp
+  d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  d6:	80 3a 00             	cmpb   $0x0,(%edx)
+  d9:	74 15                	je     f0 <strlen+0x20>
+  db:	31 c0                	xor    %eax,%eax
+  dd:	8d 76 00             	lea    0x0(%esi),%esi
+  e0:	83 c0 01             	add    $0x1,%eax
+  e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  e7:	89 c1                	mov    %eax,%ecx
+  e9:	75 f5                	jne    e0 <strlen+0x10>
+    ;
+  return n;
+}
+  eb:	89 c8                	mov    %ecx,%eax
+  ed:	5d                   	pop    %ebp
+  ee:	c3                   	ret
+  ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+  f0:	31 c9                	xor    %ecx,%ecx
+}
+  f2:	5d                   	pop    %ebp
+  f3:	89 c8                	mov    %ecx,%eax
+  f5:	c3                   	ret
+  f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000100 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	57                   	push   %edi
+ 104:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 107:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 10a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 10d:	89 d7                	mov    %edx,%edi
+ 10f:	fc                   	cld
+ 110:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 112:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 115:	89 d0                	mov    %edx,%eax
+ 117:	c9                   	leave
+ 118:	c3                   	ret
+ 119:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000120 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	8b 45 08             	mov    0x8(%ebp),%eax
+ 126:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 12a:	0f b6 10             	movzbl (%eax),%edx
+ 12d:	84 d2                	test   %dl,%dl
+ 12f:	75 12                	jne    143 <strchr+0x23>
+ 131:	eb 1d                	jmp    150 <strchr+0x30>
+ 133:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 137:	90                   	nop
+ 138:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 13c:	83 c0 01             	add    $0x1,%eax
+ 13f:	84 d2                	test   %dl,%dl
+ 141:	74 0d                	je     150 <strchr+0x30>
+    if(*s == c)
+ 143:	38 d1                	cmp    %dl,%cl
+ 145:	75 f1                	jne    138 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 147:	5d                   	pop    %ebp
+ 148:	c3                   	ret
+ 149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 150:	31 c0                	xor    %eax,%eax
+}
+ 152:	5d                   	pop    %ebp
+ 153:	c3                   	ret
+ 154:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 15f:	90                   	nop
+
+00000160 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	57                   	push   %edi
+ 164:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 165:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 168:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 169:	31 db                	xor    %ebx,%ebx
+{
+ 16b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 16e:	eb 27                	jmp    197 <gets+0x37>
+    cc = read(0, &c, 1);
+ 170:	83 ec 04             	sub    $0x4,%esp
+ 173:	6a 01                	push   $0x1
+ 175:	56                   	push   %esi
+ 176:	6a 00                	push   $0x0
+ 178:	e8 00 03 00 00       	call   47d <read>
+    if(cc < 1)
+ 17d:	83 c4 10             	add    $0x10,%esp
+ 180:	85 c0                	test   %eax,%eax
+ 182:	7e 1d                	jle    1a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 184:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 188:	8b 55 08             	mov    0x8(%ebp),%edx
+ 18b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 18f:	3c 0a                	cmp    $0xa,%al
+ 191:	74 10                	je     1a3 <gets+0x43>
+ 193:	3c 0d                	cmp    $0xd,%al
+ 195:	74 0c                	je     1a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 197:	89 df                	mov    %ebx,%edi
+ 199:	83 c3 01             	add    $0x1,%ebx
+ 19c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 19f:	7c cf                	jl     170 <gets+0x10>
+ 1a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ad:	5b                   	pop    %ebx
+ 1ae:	5e                   	pop    %esi
+ 1af:	5f                   	pop    %edi
+ 1b0:	5d                   	pop    %ebp
+ 1b1:	c3                   	ret
+ 1b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	56                   	push   %esi
+ 1c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1c5:	83 ec 08             	sub    $0x8,%esp
+ 1c8:	6a 00                	push   $0x0
+ 1ca:	ff 75 08             	push   0x8(%ebp)
+ 1cd:	e8 e2 02 00 00       	call   4b4 <open>
+  if(fd < 0)
+ 1d2:	83 c4 10             	add    $0x10,%esp
+ 1d5:	85 c0                	test   %eax,%eax
+ 1d7:	78 27                	js     200 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1d9:	83 ec 08             	sub    $0x8,%esp
+ 1dc:	ff 75 0c             	push   0xc(%ebp)
+ 1df:	89 c3                	mov    %eax,%ebx
+ 1e1:	50                   	push   %eax
+ 1e2:	e8 ee 02 00 00       	call   4d5 <fstat>
+  close(fd);
+ 1e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1ec:	e8 a2 02 00 00       	call   493 <close>
+  return r;
+ 1f1:	83 c4 10             	add    $0x10,%esp
+}
+ 1f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1f7:	89 f0                	mov    %esi,%eax
+ 1f9:	5b                   	pop    %ebx
+ 1fa:	5e                   	pop    %esi
+ 1fb:	5d                   	pop    %ebp
+ 1fc:	c3                   	ret
+ 1fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 200:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 205:	eb ed                	jmp    1f4 <stat+0x34>
+ 207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20e:	66 90                	xchg   %ax,%ax
+
+00000210 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	53                   	push   %ebx
+ 214:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 217:	0f be 02             	movsbl (%edx),%eax
+ 21a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 21d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 220:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 225:	77 1e                	ja     245 <atoi+0x35>
+ 227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 230:	83 c2 01             	add    $0x1,%edx
+ 233:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 236:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 23a:	0f be 02             	movsbl (%edx),%eax
+ 23d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 240:	80 fb 09             	cmp    $0x9,%bl
+ 243:	76 eb                	jbe    230 <atoi+0x20>
+  return n;
+}
+ 245:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 248:	89 c8                	mov    %ecx,%eax
+ 24a:	c9                   	leave
+ 24b:	c3                   	ret
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000250 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	57                   	push   %edi
+ 254:	56                   	push   %esi
+ 255:	8b 45 10             	mov    0x10(%ebp),%eax
+ 258:	8b 55 08             	mov    0x8(%ebp),%edx
+ 25b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 25e:	85 c0                	test   %eax,%eax
+ 260:	7e 13                	jle    275 <memmove+0x25>
+ 262:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 264:	89 d7                	mov    %edx,%edi
+ 266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 270:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 271:	39 f8                	cmp    %edi,%eax
+ 273:	75 fb                	jne    270 <memmove+0x20>
+  return vdst;
+}
+ 275:	5e                   	pop    %esi
+ 276:	89 d0                	mov    %edx,%eax
+ 278:	5f                   	pop    %edi
+ 279:	5d                   	pop    %ebp
+ 27a:	c3                   	ret
+ 27b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 27f:	90                   	nop
+
+00000280 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 280:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 285:	85 c0                	test   %eax,%eax
+ 287:	74 07                	je     290 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 289:	c3                   	ret
+ 28a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 290:	e9 77 02 00 00       	jmp    50c <sysgetpid>
+ 295:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 2a0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 2a5:	c3                   	ret
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002b0 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 2b0:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 2b1:	31 d2                	xor    %edx,%edx
+ 2b3:	89 e5                	mov    %esp,%ebp
+ 2b5:	53                   	push   %ebx
+ 2b6:	83 ec 04             	sub    $0x4,%esp
+ 2b9:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 2bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 2bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 2c2:	85 c9                	test   %ecx,%ecx
+ 2c4:	7e 08                	jle    2ce <cyclereport+0x1e>
+ 2c6:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 2c8:	89 d8                	mov    %ebx,%eax
+ 2ca:	f7 f1                	div    %ecx
+ 2cc:	89 c2                	mov    %eax,%edx
+ 2ce:	83 ec 08             	sub    $0x8,%esp
+ 2d1:	52                   	push   %edx
+ 2d2:	ff 75 0c             	push   0xc(%ebp)
+ 2d5:	51                   	push   %ecx
+ 2d6:	ff 75 08             	push   0x8(%ebp)
+ 2d9:	68 1a 0a 00 00       	push   $0xa1a
+ 2de:	6a 01                	push   $0x1
+ 2e0:	e8 fb 03 00 00       	call   6e0 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 2e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2e8:	83 c4 20             	add    $0x20,%esp
+ 2eb:	c9                   	leave
+ 2ec:	c3                   	ret
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002f0 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 2f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 2fc:	5d                   	pop    %ebp
+ 2fd:	c3                   	ret
+ 2fe:	66 90                	xchg   %ax,%ax
+
+00000300 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 300:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 301:	31 c0                	xor    %eax,%eax
+ 303:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 308:	89 e5                	mov    %esp,%ebp
+ 30a:	56                   	push   %esi
+ 30b:	53                   	push   %ebx
+ 30c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 30f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 313:	85 c0                	test   %eax,%eax
+ 315:	74 30                	je     347 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 317:	83 f8 02             	cmp    $0x2,%eax
+ 31a:	74 0c                	je     328 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 31c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 321:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 324:	85 c0                	test   %eax,%eax
+ 326:	74 1f                	je     347 <mutex_lock+0x47>
+ 328:	be 02 00 00 00       	mov    $0x2,%esi
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 330:	83 ec 08             	sub    $0x8,%esp
+ 333:	6a 02                	push   $0x2
+ 335:	53                   	push   %ebx
+ 336:	e8 8c 02 00 00       	call   5c7 <futex_wait>
+ 33b:	89 f0                	mov    %esi,%eax
+ 33d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 340:	83 c4 10             	add    $0x10,%esp
+ 343:	85 c0                	test   %eax,%eax
+ 345:	75 e9                	jne    330 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 347:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 34a:	5b                   	pop    %ebx
+ 34b:	5e                   	pop    %esi
+ 34c:	5d                   	pop    %ebp
+ 34d:	c3                   	ret
+ 34e:	66 90                	xchg   %ax,%ax
+
+00000350 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	83 ec 08             	sub    $0x8,%esp
+ 356:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 359:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 35d:	75 09                	jne    368 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 35f:	c9                   	leave
+ 360:	c3                   	ret
+ 361:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 368:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 36b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 371:	6a 01                	push   $0x1
+ 373:	50                   	push   %eax
+ 374:	e8 59 02 00 00       	call   5d2 <futex_wake>
+ 379:	83 c4 10             	add    $0x10,%esp
+}
+ 37c:	c9                   	leave
+ 37d:	c3                   	ret
+ 37e:	66 90                	xchg   %ax,%ax
+
+00000380 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 383:	8b 45 08             	mov    0x8(%ebp),%eax
+ 386:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 38c:	5d                   	pop    %ebp
+ 38d:	c3                   	ret
+ 38e:	66 90                	xchg   %ax,%ax
+
+00000390 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	56                   	push   %esi
+ 395:	53                   	push   %ebx
+ 396:	83 ec 0c             	sub    $0xc,%esp
+ 399:	8b 75 08             	mov    0x8(%ebp),%esi
+ 39c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 39f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 3a1:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 3a5:	75 21                	jne    3c8 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 3a7:	83 ec 08             	sub    $0x8,%esp
+ 3aa:	57                   	push   %edi
+ 3ab:	56                   	push   %esi
+ 3ac:	e8 16 02 00 00       	call   5c7 <futex_wait>
+  mutex_lock(m);
+ 3b1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 3b4:	83 c4 10             	add    $0x10,%esp
+}
+ 3b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3ba:	5b                   	pop    %ebx
+ 3bb:	5e                   	pop    %esi
+ 3bc:	5f                   	pop    %edi
+ 3bd:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 3be:	e9 3d ff ff ff       	jmp    300 <mutex_lock>
+ 3c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3c7:	90                   	nop
+    futex_wake(&m->v, 1);
+ 3c8:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 3cb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 3d1:	6a 01                	push   $0x1
+ 3d3:	53                   	push   %ebx
+ 3d4:	e8 f9 01 00 00       	call   5d2 <futex_wake>
+ 3d9:	83 c4 10             	add    $0x10,%esp
+ 3dc:	eb c9                	jmp    3a7 <cond_wait+0x17>
+ 3de:	66 90                	xchg   %ax,%ax
+
+000003e0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	83 ec 10             	sub    $0x10,%esp
+ 3e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 3e9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 3ed:	6a 01                	push   $0x1
+ 3ef:	50                   	push   %eax
+ 3f0:	e8 dd 01 00 00       	call   5d2 <futex_wake>
+}
+ 3f5:	83 c4 10             	add    $0x10,%esp
+ 3f8:	c9                   	leave
+ 3f9:	c3                   	ret
+ 3fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000400 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	83 ec 10             	sub    $0x10,%esp
+ 406:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 409:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 40d:	68 ff ff ff 7f       	push   $0x7fffffff
+ 412:	50                   	push   %eax
+ 413:	e8 ba 01 00 00       	call   5d2 <futex_wake>
+}
+ 418:	83 c4 10             	add    $0x10,%esp
+ 41b:	c9                   	leave
+ 41c:	c3                   	ret
+
+0000041d <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 41d:	50                   	push   %eax
+  pushl %ebx
+ 41e:	53                   	push   %ebx
+  movl $1, %eax
+ 41f:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 424:	0f a2                	cpuid
+  popl %ebx
+ 426:	5b                   	pop    %ebx
+  popl %eax
+ 427:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 428:	c7 05 7c 0e 00 00 4e 	movl   $0x44e,0xe7c
+ 42f:	04 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 432:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 438:	74 14                	je     44e <sysint>
+  movl $sysfast, syscallvec
+ 43a:	c7 05 7c 0e 00 00 44 	movl   $0x444,0xe7c
+ 441:	04 00 00 
+
+00000444 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 444:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 446:	ba 4d 04 00 00       	mov    $0x44d,%edx
+  sysenter
+ 44b:	0f 34                	sysenter
+1:
+  ret
+ 44d:	c3                   	ret
+
+0000044e <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 44e:	cd 40                	int    $0x40
+  ret
+ 450:	c3                   	ret
+
+00000451 <fork>:
+
+SYSCALL(fork)
+ 451:	b8 01 00 00 00       	mov    $0x1,%eax
+ 456:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+0000045c <exit>:
+SYSCALL(exit)
+ 45c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 461:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+00000467 <wait>:
+SYSCALL(wait)
+ 467:	b8 03 00 00 00       	mov    $0x3,%eax
+ 46c:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+00000472 <pipe>:
+SYSCALL(pipe)
+ 472:	b8 04 00 00 00       	mov    $0x4,%eax
+ 477:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+0000047d <read>:
+SYSCALL(read)
+ 47d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 482:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+00000488 <write>:
+SYSCALL(write)
+ 488:	b8 10 00 00 00       	mov    $0x10,%eax
+ 48d:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+00000493 <close>:
+SYSCALL(close)
+ 493:	b8 15 00 00 00       	mov    $0x15,%eax
+ 498:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+0000049e <kill>:
+SYSCALL(kill)
+ 49e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4a3:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+000004a9 <exec>:
+SYSCALL(exec)
+ 4a9:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4ae:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+000004b4 <open>:
+SYSCALL(open)
+ 4b4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4b9:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+000004bf <mknod>:
+SYSCALL(mknod)
+ 4bf:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4c4:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+000004ca <unlink>:
+SYSCALL(unlink)
+ 4ca:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4cf:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+000004d5 <fstat>:
+SYSCALL(fstat)
+ 4d5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4da:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+000004e0 <link>:
+SYSCALL(link)
+ 4e0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4e5:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+000004eb <mkdir>:
+SYSCALL(mkdir)
+ 4eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4f0:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+000004f6 <chdir>:
+SYSCALL(chdir)
+ 4f6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4fb:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+00000501 <dup>:
+SYSCALL(dup)
+ 501:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 506:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+0000050c <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 50c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 511:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+00000517 <sbrk>:
+SYSCALL(sbrk)
+ 517:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 51c:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+00000522 <sleep>:
+SYSCALL(sleep)
+ 522:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 527:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+0000052d <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 52d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 532:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+00000538 <swapread>:
+SYSCALL(swapread)
+ 538:	b8 16 00 00 00       	mov    $0x16,%eax
+ 53d:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+00000543 <swapwrite>:
+SYSCALL(swapwrite)
+ 543:	b8 17 00 00 00       	mov    $0x17,%eax
+ 548:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+0000054e <swapstat>:
+SYSCALL(swapstat)
+ 54e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 553:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+00000559 <madvise>:
+SYSCALL(madvise)
+ 559:	b8 19 00 00 00       	mov    $0x19,%eax
+ 55e:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+00000564 <mlock>:
+SYSCALL(mlock)
+ 564:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 569:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+0000056f <munlock>:
+SYSCALL(munlock)
+ 56f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 574:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+0000057a <membench>:
+SYSCALL(membench)
+ 57a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 57f:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+00000585 <nice>:
+SYSCALL(nice)
+ 585:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 58a:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+00000590 <setpriority>:
+SYSCALL(setpriority)
+ 590:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 595:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+0000059b <usleep>:
+SYSCALL(usleep)
+ 59b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5a0:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+000005a6 <cpustat>:
+SYSCALL(cpustat)
+ 5a6:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5ab:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+000005b1 <clone>:
+SYSCALL(clone)
+ 5b1:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5b6:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+000005bc <join>:
+SYSCALL(join)
+ 5bc:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5c1:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+000005c7 <futex_wait>:
+SYSCALL(futex_wait)
+ 5c7:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5cc:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+000005d2 <futex_wake>:
+SYSCALL(futex_wake)
+ 5d2:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5d7:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+000005dd <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 5dd:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5e2:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+000005e8 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 5e8:	b8 26 00 00 00       	mov    $0x26,%eax
+ 5ed:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+000005f3 <getcpu>:
+SYSCALL(getcpu)
+ 5f3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5f8:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+000005fe <migrations>:
+SYSCALL(migrations)
+ 5fe:	b8 28 00 00 00       	mov    $0x28,%eax
+ 603:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+00000609 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 609:	b8 29 00 00 00       	mov    $0x29,%eax
+ 60e:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+00000614 <lockstat>:
+SYSCALL(lockstat)
+ 614:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 619:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+0000061f <lockprof>:
+SYSCALL(lockprof)
+ 61f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 624:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+
+0000062a <bcachestat>:
+SYSCALL(bcachestat)
+ 62a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 62f:	ff 25 7c 0e 00 00    	jmp    *0xe7c
+ 635:	66 90                	xchg   %ax,%ax
+ 637:	66 90                	xchg   %ax,%ax
+ 639:	66 90                	xchg   %ax,%ax
+ 63b:	66 90                	xchg   %ax,%ax
+ 63d:	66 90                	xchg   %ax,%ax
+ 63f:	90                   	nop
+
+00000640 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	57                   	push   %edi
+ 644:	56                   	push   %esi
+ 645:	53                   	push   %ebx
+ 646:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 648:	89 d1                	mov    %edx,%ecx
+{
+ 64a:	83 ec 3c             	sub    $0x3c,%esp
+ 64d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 650:	85 d2                	test   %edx,%edx
+ 652:	0f 89 80 00 00 00    	jns    6d8 <printint+0x98>
+ 658:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 65c:	74 7a                	je     6d8 <printint+0x98>
+    x = -xx;
+ 65e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 660:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 665:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 668:	31 f6                	xor    %esi,%esi
+ 66a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 670:	89 c8                	mov    %ecx,%eax
+ 672:	31 d2                	xor    %edx,%edx
+ 674:	89 f7                	mov    %esi,%edi
+ 676:	f7 f3                	div    %ebx
+ 678:	8d 76 01             	lea    0x1(%esi),%esi
+ 67b:	0f b6 92 94 0a 00 00 	movzbl 0xa94(%edx),%edx
+ 682:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 686:	89 ca                	mov    %ecx,%edx
+ 688:	89 c1                	mov    %eax,%ecx
+ 68a:	39 da                	cmp    %ebx,%edx
+ 68c:	73 e2                	jae    670 <printint+0x30>
+  if(neg)
+ 68e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 691:	85 c0                	test   %eax,%eax
+ 693:	74 07                	je     69c <printint+0x5c>
+    buf[i++] = '-';
+ 695:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 69a:	89 f7                	mov    %esi,%edi
+ 69c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 69f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 6a2:	01 df                	add    %ebx,%edi
+ 6a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 6a8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 6ab:	83 ec 04             	sub    $0x4,%esp
+ 6ae:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 6b1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 6b4:	6a 01                	push   $0x1
+ 6b6:	50                   	push   %eax
+ 6b7:	56                   	push   %esi
+ 6b8:	e8 cb fd ff ff       	call   488 <write>
+  while(--i >= 0)
+ 6bd:	89 f8                	mov    %edi,%eax
+ 6bf:	83 c4 10             	add    $0x10,%esp
+ 6c2:	83 ef 01             	sub    $0x1,%edi
+ 6c5:	39 d8                	cmp    %ebx,%eax
+ 6c7:	75 df                	jne    6a8 <printint+0x68>
+}
+ 6c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6cc:	5b                   	pop    %ebx
+ 6cd:	5e                   	pop    %esi
+ 6ce:	5f                   	pop    %edi
+ 6cf:	5d                   	pop    %ebp
+ 6d0:	c3                   	ret
+ 6d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6d8:	31 c0                	xor    %eax,%eax
+ 6da:	eb 89                	jmp    665 <printint+0x25>
+ 6dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 e5                	mov    %esp,%ebp
+ 6e3:	57                   	push   %edi
+ 6e4:	56                   	push   %esi
+ 6e5:	53                   	push   %ebx
+ 6e6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 6ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 6ef:	0f b6 1e             	movzbl (%esi),%ebx
+ 6f2:	83 c6 01             	add    $0x1,%esi
+ 6f5:	84 db                	test   %bl,%bl
+ 6f7:	74 67                	je     760 <printf+0x80>
+ 6f9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 6fc:	31 d2                	xor    %edx,%edx
+ 6fe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 701:	eb 34                	jmp    737 <printf+0x57>
+ 703:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 707:	90                   	nop
+ 708:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 70b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 710:	83 f8 25             	cmp    $0x25,%eax
+ 713:	74 18                	je     72d <printf+0x4d>
+  write(fd, &c, 1);
+ 715:	83 ec 04             	sub    $0x4,%esp
+ 718:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 71b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 71e:	6a 01                	push   $0x1
+ 720:	50                   	push   %eax
+ 721:	57                   	push   %edi
+ 722:	e8 61 fd ff ff       	call   488 <write>
+ 727:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 72a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 72d:	0f b6 1e             	movzbl (%esi),%ebx
+ 730:	83 c6 01             	add    $0x1,%esi
+ 733:	84 db                	test   %bl,%bl
+ 735:	74 29                	je     760 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 737:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 73a:	85 d2                	test   %edx,%edx
+ 73c:	74 ca                	je     708 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 73e:	83 fa 25             	cmp    $0x25,%edx
+ 741:	75 ea                	jne    72d <printf+0x4d>
+      if(c == 'd'){
+ 743:	83 f8 25             	cmp    $0x25,%eax
+ 746:	0f 84 24 01 00 00    	je     870 <printf+0x190>
+ 74c:	83 e8 63             	sub    $0x63,%eax
+ 74f:	83 f8 15             	cmp    $0x15,%eax
+ 752:	77 1c                	ja     770 <printf+0x90>
+ 754:	ff 24 85 3c 0a 00 00 	jmp    *0xa3c(,%eax,4)
+ 75b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 75f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 760:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 763:	5b                   	pop    %ebx
+ 764:	5e                   	pop    %esi
+ 765:	5f                   	pop    %edi
+ 766:	5d                   	pop    %ebp
+ 767:	c3                   	ret
+ 768:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76f:	90                   	nop
+  write(fd, &c, 1);
+ 770:	83 ec 04             	sub    $0x4,%esp
+ 773:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 776:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 77a:	6a 01                	push   $0x1
+ 77c:	52                   	push   %edx
+ 77d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 780:	57                   	push   %edi
+ 781:	e8 02 fd ff ff       	call   488 <write>
+ 786:	83 c4 0c             	add    $0xc,%esp
+ 789:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 78c:	6a 01                	push   $0x1
+ 78e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 791:	52                   	push   %edx
+ 792:	57                   	push   %edi
+ 793:	e8 f0 fc ff ff       	call   488 <write>
+        putc(fd, c);
+ 798:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 79b:	31 d2                	xor    %edx,%edx
+ 79d:	eb 8e                	jmp    72d <printf+0x4d>
+ 79f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 7a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7a3:	83 ec 0c             	sub    $0xc,%esp
+ 7a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7ab:	8b 13                	mov    (%ebx),%edx
+ 7ad:	6a 00                	push   $0x0
+ 7af:	89 f8                	mov    %edi,%eax
+        ap++;
+ 7b1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 7b4:	e8 87 fe ff ff       	call   640 <printint>
+        ap++;
+ 7b9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7bc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7bf:	31 d2                	xor    %edx,%edx
+ 7c1:	e9 67 ff ff ff       	jmp    72d <printf+0x4d>
+ 7c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7cd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7d0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7d3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7d5:	83 c0 04             	add    $0x4,%eax
+ 7d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7db:	85 db                	test   %ebx,%ebx
+ 7dd:	0f 84 9d 00 00 00    	je     880 <printf+0x1a0>
+        while(*s != 0){
+ 7e3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 7e6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 7e8:	84 c0                	test   %al,%al
+ 7ea:	0f 84 3d ff ff ff    	je     72d <printf+0x4d>
+ 7f0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7f3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 7f6:	89 de                	mov    %ebx,%esi
+ 7f8:	89 d3                	mov    %edx,%ebx
+ 7fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 800:	83 ec 04             	sub    $0x4,%esp
+ 803:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 806:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 809:	6a 01                	push   $0x1
+ 80b:	53                   	push   %ebx
+ 80c:	57                   	push   %edi
+ 80d:	e8 76 fc ff ff       	call   488 <write>
+        while(*s != 0){
+ 812:	0f b6 06             	movzbl (%esi),%eax
+ 815:	83 c4 10             	add    $0x10,%esp
+ 818:	84 c0                	test   %al,%al
+ 81a:	75 e4                	jne    800 <printf+0x120>
+      state = 0;
+ 81c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 81f:	31 d2                	xor    %edx,%edx
+ 821:	e9 07 ff ff ff       	jmp    72d <printf+0x4d>
+ 826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 82d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 830:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 833:	83 ec 0c             	sub    $0xc,%esp
+ 836:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 83b:	8b 13                	mov    (%ebx),%edx
+ 83d:	6a 01                	push   $0x1
+ 83f:	e9 6b ff ff ff       	jmp    7af <printf+0xcf>
+ 844:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 848:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 84b:	83 ec 04             	sub    $0x4,%esp
+ 84e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 851:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 853:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 856:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 859:	6a 01                	push   $0x1
+ 85b:	52                   	push   %edx
+ 85c:	57                   	push   %edi
+ 85d:	e8 26 fc ff ff       	call   488 <write>
+        ap++;
+ 862:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 865:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 868:	31 d2                	xor    %edx,%edx
+ 86a:	e9 be fe ff ff       	jmp    72d <printf+0x4d>
+ 86f:	90                   	nop
+  write(fd, &c, 1);
+ 870:	83 ec 04             	sub    $0x4,%esp
+ 873:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 876:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 879:	6a 01                	push   $0x1
+ 87b:	e9 11 ff ff ff       	jmp    791 <printf+0xb1>
+ 880:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 885:	bb 35 0a 00 00       	mov    $0xa35,%ebx
+ 88a:	e9 61 ff ff ff       	jmp    7f0 <printf+0x110>
+ 88f:	90                   	nop
+
+00000890 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 890:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 891:	a1 80 0e 00 00       	mov    0xe80,%eax
+{
+ 896:	89 e5                	mov    %esp,%ebp
+ 898:	57                   	push   %edi
+ 899:	56                   	push   %esi
+ 89a:	53                   	push   %ebx
+ 89b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 89e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8a8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8aa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8ac:	39 ca                	cmp    %ecx,%edx
+ 8ae:	73 30                	jae    8e0 <free+0x50>
+ 8b0:	39 c1                	cmp    %eax,%ecx
+ 8b2:	72 04                	jb     8b8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8b4:	39 c2                	cmp    %eax,%edx
+ 8b6:	72 f0                	jb     8a8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8b8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 8bb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 8be:	39 f8                	cmp    %edi,%eax
+ 8c0:	74 2e                	je     8f0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8c2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8c5:	8b 42 04             	mov    0x4(%edx),%eax
+ 8c8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8cb:	39 f1                	cmp    %esi,%ecx
+ 8cd:	74 38                	je     907 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8cf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8d1:	5b                   	pop    %ebx
+  freep = p;
+ 8d2:	89 15 80 0e 00 00    	mov    %edx,0xe80
+}
+ 8d8:	5e                   	pop    %esi
+ 8d9:	5f                   	pop    %edi
+ 8da:	5d                   	pop    %ebp
+ 8db:	c3                   	ret
+ 8dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8e0:	39 c1                	cmp    %eax,%ecx
+ 8e2:	72 d0                	jb     8b4 <free+0x24>
+ 8e4:	eb c2                	jmp    8a8 <free+0x18>
+ 8e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ed:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 8f0:	03 70 04             	add    0x4(%eax),%esi
+ 8f3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8f6:	8b 02                	mov    (%edx),%eax
+ 8f8:	8b 00                	mov    (%eax),%eax
+ 8fa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 8fd:	8b 42 04             	mov    0x4(%edx),%eax
+ 900:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 903:	39 f1                	cmp    %esi,%ecx
+ 905:	75 c8                	jne    8cf <free+0x3f>
+    p->s.size += bp->s.size;
+ 907:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 90a:	89 15 80 0e 00 00    	mov    %edx,0xe80
+    p->s.size += bp->s.size;
+ 910:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 913:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 916:	89 0a                	mov    %ecx,(%edx)
+}
+ 918:	5b                   	pop    %ebx
+ 919:	5e                   	pop    %esi
+ 91a:	5f                   	pop    %edi
+ 91b:	5d                   	pop    %ebp
+ 91c:	c3                   	ret
+ 91d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000920 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 920:	55                   	push   %ebp
+ 921:	89 e5                	mov    %esp,%ebp
+ 923:	57                   	push   %edi
+ 924:	56                   	push   %esi
+ 925:	53                   	push   %ebx
+ 926:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 929:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 92c:	8b 15 80 0e 00 00    	mov    0xe80,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 932:	8d 78 07             	lea    0x7(%eax),%edi
+ 935:	c1 ef 03             	shr    $0x3,%edi
+ 938:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 93b:	85 d2                	test   %edx,%edx
+ 93d:	0f 84 8d 00 00 00    	je     9d0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 943:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 945:	8b 48 04             	mov    0x4(%eax),%ecx
+ 948:	39 f9                	cmp    %edi,%ecx
+ 94a:	73 64                	jae    9b0 <malloc+0x90>
+  if(nu < 4096)
+ 94c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 951:	39 df                	cmp    %ebx,%edi
+ 953:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 956:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 95d:	eb 0a                	jmp    969 <malloc+0x49>
+ 95f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 960:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 962:	8b 48 04             	mov    0x4(%eax),%ecx
+ 965:	39 f9                	cmp    %edi,%ecx
+ 967:	73 47                	jae    9b0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 969:	89 c2                	mov    %eax,%edx
+ 96b:	39 05 80 0e 00 00    	cmp    %eax,0xe80
+ 971:	75 ed                	jne    960 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 973:	83 ec 0c             	sub    $0xc,%esp
+ 976:	56                   	push   %esi
+ 977:	e8 9b fb ff ff       	call   517 <sbrk>
+  if(p == (char*)-1)
+ 97c:	83 c4 10             	add    $0x10,%esp
+ 97f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 982:	74 1c                	je     9a0 <malloc+0x80>
+  hp->s.size = nu;
+ 984:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 987:	83 ec 0c             	sub    $0xc,%esp
+ 98a:	83 c0 08             	add    $0x8,%eax
+ 98d:	50                   	push   %eax
+ 98e:	e8 fd fe ff ff       	call   890 <free>
+  return freep;
+ 993:	8b 15 80 0e 00 00    	mov    0xe80,%edx
+      if((p = morecore(nunits)) == 0)
+ 999:	83 c4 10             	add    $0x10,%esp
+ 99c:	85 d2                	test   %edx,%edx
+ 99e:	75 c0                	jne    960 <malloc+0x40>
+        return 0;
+  }
+}
+ 9a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 9a3:	31 c0                	xor    %eax,%eax
+}
+ 9a5:	5b                   	pop    %ebx
+ 9a6:	5e                   	pop    %esi
+ 9a7:	5f                   	pop    %edi
+ 9a8:	5d                   	pop    %ebp
+ 9a9:	c3                   	ret
+ 9aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 9b0:	39 cf                	cmp    %ecx,%edi
+ 9b2:	74 4c                	je     a00 <malloc+0xe0>
+        p->s.size -= nunits;
+ 9b4:	29 f9                	sub    %edi,%ecx
+ 9b6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 9b9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 9bc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 9bf:	89 15 80 0e 00 00    	mov    %edx,0xe80
+}
+ 9c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 9c8:	83 c0 08             	add    $0x8,%eax
+}
+ 9cb:	5b                   	pop    %ebx
+ 9cc:	5e                   	pop    %esi
+ 9cd:	5f                   	pop    %edi
+ 9ce:	5d                   	pop    %ebp
+ 9cf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 9d0:	c7 05 80 0e 00 00 84 	movl   $0xe84,0xe80
+ 9d7:	0e 00 00 
+    base.s.size = 0;
+ 9da:	b8 84 0e 00 00       	mov    $0xe84,%eax
+    base.s.ptr = freep = prevp = &base;
+ 9df:	c7 05 84 0e 00 00 84 	movl   $0xe84,0xe84
+ 9e6:	0e 00 00 
+    base.s.size = 0;
+ 9e9:	c7 05 88 0e 00 00 00 	movl   $0x0,0xe88
+ 9f0:	00 00 00 
+    if(p->s.size >= nunits){
+ 9f3:	e9 54 ff ff ff       	jmp    94c <malloc+0x2c>
+ 9f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a00:	8b 08                	mov    (%eax),%ecx
+ a02:	89 0a                	mov    %ecx,(%edx)
+ a04:	eb b9                	jmp    9bf <malloc+0x9f>
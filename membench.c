@@ -0,0 +1,14 @@
+// Run the in-kernel benchmark of memmove, memset, copy_page
+// and clear_page.  The kernel prints the results on the console.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+  if(membench() < 0)
+    printf(2, "membench: failed\n");
+  exit();
+}
@@ -0,0 +1,1579 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 01 00 00 00       	mov    $0x1,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1c:	8b 31                	mov    (%ecx),%esi
+  1e:	83 c3 04             	add    $0x4,%ebx
+  int i;
+
+  if(argc < 2){
+  21:	83 fe 01             	cmp    $0x1,%esi
+  24:	7f 14                	jg     3a <main+0x3a>
+  26:	eb 3a                	jmp    62 <main+0x62>
+  28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+    printf(2, "Usage: mkdir files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	83 c7 01             	add    $0x1,%edi
+  33:	83 c3 04             	add    $0x4,%ebx
+  36:	39 fe                	cmp    %edi,%esi
+  38:	74 23                	je     5d <main+0x5d>
+    if(mkdir(argv[i]) < 0){
+  3a:	83 ec 0c             	sub    $0xc,%esp
+  3d:	ff 33                	push   (%ebx)
+  3f:	e8 e7 04 00 00       	call   52b <mkdir>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	85 c0                	test   %eax,%eax
+  49:	79 e5                	jns    30 <main+0x30>
+      printf(2, "mkdir: %s failed to create\n", argv[i]);
+  4b:	50                   	push   %eax
+  4c:	ff 33                	push   (%ebx)
+  4e:	68 5f 0a 00 00       	push   $0xa5f
+  53:	6a 02                	push   $0x2
+  55:	e8 c6 06 00 00       	call   720 <printf>
+      break;
+  5a:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  5d:	e8 3a 04 00 00       	call   49c <exit>
+    printf(2, "Usage: mkdir files...\n");
+  62:	52                   	push   %edx
+  63:	52                   	push   %edx
+  64:	68 48 0a 00 00       	push   $0xa48
+  69:	6a 02                	push   $0x2
+  6b:	e8 b0 06 00 00       	call   720 <printf>
+    exit();
+  70:	e8 27 04 00 00       	call   49c <exit>
+  75:	66 90                	xchg   %ax,%ax
+  77:	66 90                	xchg   %ax,%ax
+  79:	66 90                	xchg   %ax,%ax
+  7b:	66 90                	xchg   %ax,%ax
+  7d:	66 90                	xchg   %ax,%ax
+  7f:	90                   	nop
+
+00000080 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  80:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  81:	31 c0                	xor    %eax,%eax
+{
+  83:	89 e5                	mov    %esp,%ebp
+  85:	53                   	push   %ebx
+  86:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  90:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  94:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  97:	83 c0 01             	add    $0x1,%eax
+  9a:	84 d2                	test   %dl,%dl
+  9c:	75 f2                	jne    90 <strcpy+0x10>
+    ;
+  return os;
+}
+  9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  a1:	89 c8                	mov    %ecx,%eax
+  a3:	c9                   	leave
+  a4:	c3                   	ret
+  a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	53                   	push   %ebx
+  b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  ba:	0f b6 02             	movzbl (%edx),%eax
+  bd:	84 c0                	test   %al,%al
+  bf:	75 17                	jne    d8 <strcmp+0x28>
+  c1:	eb 3a                	jmp    fd <strcmp+0x4d>
+  c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  c7:	90                   	nop
+  c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  cc:	83 c2 01             	add    $0x1,%edx
+  cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  d2:	84 c0                	test   %al,%al
+  d4:	74 1a                	je     f0 <strcmp+0x40>
+    p++, q++;
+  d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  d8:	0f b6 19             	movzbl (%ecx),%ebx
+  db:	38 c3                	cmp    %al,%bl
+  dd:	74 e9                	je     c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  df:	29 d8                	sub    %ebx,%eax
+}
+  e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  e4:	c9                   	leave
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  f4:	31 c0                	xor    %eax,%eax
+  f6:	29 d8                	sub    %ebx,%eax
+}
+  f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  fb:	c9                   	leave
+  fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 100:	31 c0                	xor    %eax,%eax
+ 102:	eb db                	jmp    df <strcmp+0x2f>
+ 104:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 10f:	90                   	nop
+
+00000110 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 116:	80 3a 00             	cmpb   $0x0,(%edx)
+ 119:	74 15                	je     130 <strlen+0x20>
+ 11b:	31 c0                	xor    %eax,%eax
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+ 120:	83 c0 01             	add    $0x1,%eax
+ 123:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 127:	89 c1                	mov    %eax,%ecx
+ 129:	75 f5                	jne    120 <strlen+0x10>
+    ;
+  return n;
+}
+ 12b:	89 c8                	mov    %ecx,%eax
+ 12d:	5d                   	pop    %ebp
+ 12e:	c3                   	ret
+ 12f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 130:	31 c9                	xor    %ecx,%ecx
+}
+ 132:	5d                   	pop    %ebp
+ 133:	89 c8                	mov    %ecx,%eax
+ 135:	c3                   	ret
+ 136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000140 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	57                   	push   %edi
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 147:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 14a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 14d:	89 d7                	mov    %edx,%edi
+ 14f:	fc                   	cld
+ 150:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 152:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 155:	89 d0                	mov    %edx,%eax
+ 157:	c9                   	leave
+ 158:	c3                   	ret
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000160 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	8b 45 08             	mov    0x8(%ebp),%eax
+ 166:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 16a:	0f b6 10             	movzbl (%eax),%edx
+ 16d:	84 d2                	test   %dl,%dl
+ 16f:	75 12                	jne    183 <strchr+0x23>
+ 171:	eb 1d                	jmp    190 <strchr+0x30>
+ 173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 177:	90                   	nop
+ 178:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 17c:	83 c0 01             	add    $0x1,%eax
+ 17f:	84 d2                	test   %dl,%dl
+ 181:	74 0d                	je     190 <strchr+0x30>
+    if(*s == c)
+ 183:	38 d1                	cmp    %dl,%cl
+ 185:	75 f1                	jne    178 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 187:	5d                   	pop    %ebp
+ 188:	c3                   	ret
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 190:	31 c0                	xor    %eax,%eax
+}
+ 192:	5d                   	pop    %ebp
+ 193:	c3                   	ret
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1a9:	31 db                	xor    %ebx,%ebx
+{
+ 1ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ae:	eb 27                	jmp    1d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1b0:	83 ec 04             	sub    $0x4,%esp
+ 1b3:	6a 01                	push   $0x1
+ 1b5:	56                   	push   %esi
+ 1b6:	6a 00                	push   $0x0
+ 1b8:	e8 00 03 00 00       	call   4bd <read>
+    if(cc < 1)
+ 1bd:	83 c4 10             	add    $0x10,%esp
+ 1c0:	85 c0                	test   %eax,%eax
+ 1c2:	7e 1d                	jle    1e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1cf:	3c 0a                	cmp    $0xa,%al
+ 1d1:	74 10                	je     1e3 <gets+0x43>
+ 1d3:	3c 0d                	cmp    $0xd,%al
+ 1d5:	74 0c                	je     1e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1d7:	89 df                	mov    %ebx,%edi
+ 1d9:	83 c3 01             	add    $0x1,%ebx
+ 1dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1df:	7c cf                	jl     1b0 <gets+0x10>
+ 1e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ed:	5b                   	pop    %ebx
+ 1ee:	5e                   	pop    %esi
+ 1ef:	5f                   	pop    %edi
+ 1f0:	5d                   	pop    %ebp
+ 1f1:	c3                   	ret
+ 1f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	56                   	push   %esi
+ 204:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 205:	83 ec 08             	sub    $0x8,%esp
+ 208:	6a 00                	push   $0x0
+ 20a:	ff 75 08             	push   0x8(%ebp)
+ 20d:	e8 e2 02 00 00       	call   4f4 <open>
+  if(fd < 0)
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	85 c0                	test   %eax,%eax
+ 217:	78 27                	js     240 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 219:	83 ec 08             	sub    $0x8,%esp
+ 21c:	ff 75 0c             	push   0xc(%ebp)
+ 21f:	89 c3                	mov    %eax,%ebx
+ 221:	50                   	push   %eax
+ 222:	e8 ee 02 00 00       	call   515 <fstat>
+  close(fd);
+ 227:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 22a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 22c:	e8 a2 02 00 00       	call   4d3 <close>
+  return r;
+ 231:	83 c4 10             	add    $0x10,%esp
+}
+ 234:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 237:	89 f0                	mov    %esi,%eax
+ 239:	5b                   	pop    %ebx
+ 23a:	5e                   	pop    %esi
+ 23b:	5d                   	pop    %ebp
+ 23c:	c3                   	ret
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 240:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 245:	eb ed                	jmp    234 <stat+0x34>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+
+00000250 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	53                   	push   %ebx
+ 254:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 257:	0f be 02             	movsbl (%edx),%eax
+ 25a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 25d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 260:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 265:	77 1e                	ja     285 <atoi+0x35>
+ 267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 270:	83 c2 01             	add    $0x1,%edx
+ 273:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 276:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 27a:	0f be 02             	movsbl (%edx),%eax
+ 27d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 280:	80 fb 09             	cmp    $0x9,%bl
+ 283:	76 eb                	jbe    270 <atoi+0x20>
+  return n;
+}
+ 285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 288:	89 c8                	mov    %ecx,%eax
+ 28a:	c9                   	leave
+ 28b:	c3                   	ret
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+ 295:	8b 45 10             	mov    0x10(%ebp),%eax
+ 298:	8b 55 08             	mov    0x8(%ebp),%edx
+ 29b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 29e:	85 c0                	test   %eax,%eax
+ 2a0:	7e 13                	jle    2b5 <memmove+0x25>
+ 2a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2a4:	89 d7                	mov    %edx,%edi
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2b1:	39 f8                	cmp    %edi,%eax
+ 2b3:	75 fb                	jne    2b0 <memmove+0x20>
+  return vdst;
+}
+ 2b5:	5e                   	pop    %esi
+ 2b6:	89 d0                	mov    %edx,%eax
+ 2b8:	5f                   	pop    %edi
+ 2b9:	5d                   	pop    %ebp
+ 2ba:	c3                   	ret
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 2c0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 2c5:	85 c0                	test   %eax,%eax
+ 2c7:	74 07                	je     2d0 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 2c9:	c3                   	ret
+ 2ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 2d0:	e9 77 02 00 00       	jmp    54c <sysgetpid>
+ 2d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002e0 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 2e0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 2e5:	c3                   	ret
+ 2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002f0 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 2f0:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 2f1:	31 d2                	xor    %edx,%edx
+ 2f3:	89 e5                	mov    %esp,%ebp
+ 2f5:	53                   	push   %ebx
+ 2f6:	83 ec 04             	sub    $0x4,%esp
+ 2f9:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 2fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 2ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 302:	85 c9                	test   %ecx,%ecx
+ 304:	7e 08                	jle    30e <cyclereport+0x1e>
+ 306:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 308:	89 d8                	mov    %ebx,%eax
+ 30a:	f7 f1                	div    %ecx
+ 30c:	89 c2                	mov    %eax,%edx
+ 30e:	83 ec 08             	sub    $0x8,%esp
+ 311:	52                   	push   %edx
+ 312:	ff 75 0c             	push   0xc(%ebp)
+ 315:	51                   	push   %ecx
+ 316:	ff 75 08             	push   0x8(%ebp)
+ 319:	68 7b 0a 00 00       	push   $0xa7b
+ 31e:	6a 01                	push   $0x1
+ 320:	e8 fb 03 00 00       	call   720 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 325:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 328:	83 c4 20             	add    $0x20,%esp
+ 32b:	c9                   	leave
+ 32c:	c3                   	ret
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000330 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 333:	8b 45 08             	mov    0x8(%ebp),%eax
+ 336:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 33c:	5d                   	pop    %ebp
+ 33d:	c3                   	ret
+ 33e:	66 90                	xchg   %ax,%ax
+
+00000340 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 340:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 341:	31 c0                	xor    %eax,%eax
+ 343:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 348:	89 e5                	mov    %esp,%ebp
+ 34a:	56                   	push   %esi
+ 34b:	53                   	push   %ebx
+ 34c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 34f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 353:	85 c0                	test   %eax,%eax
+ 355:	74 30                	je     387 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 357:	83 f8 02             	cmp    $0x2,%eax
+ 35a:	74 0c                	je     368 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 35c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 361:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 364:	85 c0                	test   %eax,%eax
+ 366:	74 1f                	je     387 <mutex_lock+0x47>
+ 368:	be 02 00 00 00       	mov    $0x2,%esi
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 370:	83 ec 08             	sub    $0x8,%esp
+ 373:	6a 02                	push   $0x2
+ 375:	53                   	push   %ebx
+ 376:	e8 8c 02 00 00       	call   607 <futex_wait>
+ 37b:	89 f0                	mov    %esi,%eax
+ 37d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 380:	83 c4 10             	add    $0x10,%esp
+ 383:	85 c0                	test   %eax,%eax
+ 385:	75 e9                	jne    370 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 387:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 38a:	5b                   	pop    %ebx
+ 38b:	5e                   	pop    %esi
+ 38c:	5d                   	pop    %ebp
+ 38d:	c3                   	ret
+ 38e:	66 90                	xchg   %ax,%ax
+
+00000390 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	83 ec 08             	sub    $0x8,%esp
+ 396:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 399:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 39d:	75 09                	jne    3a8 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 39f:	c9                   	leave
+ 3a0:	c3                   	ret
+ 3a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 3a8:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 3ab:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 3b1:	6a 01                	push   $0x1
+ 3b3:	50                   	push   %eax
+ 3b4:	e8 59 02 00 00       	call   612 <futex_wake>
+ 3b9:	83 c4 10             	add    $0x10,%esp
+}
+ 3bc:	c9                   	leave
+ 3bd:	c3                   	ret
+ 3be:	66 90                	xchg   %ax,%ax
+
+000003c0 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 3c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3cc:	5d                   	pop    %ebp
+ 3cd:	c3                   	ret
+ 3ce:	66 90                	xchg   %ax,%ax
+
+000003d0 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	56                   	push   %esi
+ 3d5:	53                   	push   %ebx
+ 3d6:	83 ec 0c             	sub    $0xc,%esp
+ 3d9:	8b 75 08             	mov    0x8(%ebp),%esi
+ 3dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 3df:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 3e1:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 3e5:	75 21                	jne    408 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 3e7:	83 ec 08             	sub    $0x8,%esp
+ 3ea:	57                   	push   %edi
+ 3eb:	56                   	push   %esi
+ 3ec:	e8 16 02 00 00       	call   607 <futex_wait>
+  mutex_lock(m);
+ 3f1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 3f4:	83 c4 10             	add    $0x10,%esp
+}
+ 3f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3fa:	5b                   	pop    %ebx
+ 3fb:	5e                   	pop    %esi
+ 3fc:	5f                   	pop    %edi
+ 3fd:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 3fe:	e9 3d ff ff ff       	jmp    340 <mutex_lock>
+ 403:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 407:	90                   	nop
+    futex_wake(&m->v, 1);
+ 408:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 40b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 411:	6a 01                	push   $0x1
+ 413:	53                   	push   %ebx
+ 414:	e8 f9 01 00 00       	call   612 <futex_wake>
+ 419:	83 c4 10             	add    $0x10,%esp
+ 41c:	eb c9                	jmp    3e7 <cond_wait+0x17>
+ 41e:	66 90                	xchg   %ax,%ax
+
+00000420 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	83 ec 10             	sub    $0x10,%esp
+ 426:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 429:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 42d:	6a 01                	push   $0x1
+ 42f:	50                   	push   %eax
+ 430:	e8 dd 01 00 00       	call   612 <futex_wake>
+}
+ 435:	83 c4 10             	add    $0x10,%esp
+ 438:	c9                   	leave
+ 439:	c3                   	ret
+ 43a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000440 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	83 ec 10             	sub    $0x10,%esp
+ 446:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 449:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 44d:	68 ff ff ff 7f       	push   $0x7fffffff
+ 452:	50                   	push   %eax
+ 453:	e8 ba 01 00 00       	call   612 <futex_wake>
+}
+ 458:	83 c4 10             	add    $0x10,%esp
+ 45b:	c9                   	leave
+ 45c:	c3                   	ret
+
+0000045d <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 45d:	50                   	push   %eax
+  pushl %ebx
+ 45e:	53                   	push   %ebx
+  movl $1, %eax
+ 45f:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 464:	0f a2                	cpuid
+  popl %ebx
+ 466:	5b                   	pop    %ebx
+  popl %eax
+ 467:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 468:	c7 05 f0 0e 00 00 8e 	movl   $0x48e,0xef0
+ 46f:	04 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 472:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 478:	74 14                	je     48e <sysint>
+  movl $sysfast, syscallvec
+ 47a:	c7 05 f0 0e 00 00 84 	movl   $0x484,0xef0
+ 481:	04 00 00 
+
+00000484 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 484:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 486:	ba 8d 04 00 00       	mov    $0x48d,%edx
+  sysenter
+ 48b:	0f 34                	sysenter
+1:
+  ret
+ 48d:	c3                   	ret
+
+0000048e <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 48e:	cd 40                	int    $0x40
+  ret
+ 490:	c3                   	ret
+
+00000491 <fork>:
+
+SYSCALL(fork)
+ 491:	b8 01 00 00 00       	mov    $0x1,%eax
+ 496:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+0000049c <exit>:
+SYSCALL(exit)
+ 49c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4a1:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+000004a7 <wait>:
+SYSCALL(wait)
+ 4a7:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4ac:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+000004b2 <pipe>:
+SYSCALL(pipe)
+ 4b2:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4b7:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+000004bd <read>:
+SYSCALL(read)
+ 4bd:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4c2:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+000004c8 <write>:
+SYSCALL(write)
+ 4c8:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4cd:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+000004d3 <close>:
+SYSCALL(close)
+ 4d3:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4d8:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+000004de <kill>:
+SYSCALL(kill)
+ 4de:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4e3:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+000004e9 <exec>:
+SYSCALL(exec)
+ 4e9:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4ee:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+000004f4 <open>:
+SYSCALL(open)
+ 4f4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4f9:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+000004ff <mknod>:
+SYSCALL(mknod)
+ 4ff:	b8 11 00 00 00       	mov    $0x11,%eax
+ 504:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+0000050a <unlink>:
+SYSCALL(unlink)
+ 50a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 50f:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+00000515 <fstat>:
+SYSCALL(fstat)
+ 515:	b8 08 00 00 00       	mov    $0x8,%eax
+ 51a:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+00000520 <link>:
+SYSCALL(link)
+ 520:	b8 13 00 00 00       	mov    $0x13,%eax
+ 525:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+0000052b <mkdir>:
+SYSCALL(mkdir)
+ 52b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 530:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+00000536 <chdir>:
+SYSCALL(chdir)
+ 536:	b8 09 00 00 00       	mov    $0x9,%eax
+ 53b:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+00000541 <dup>:
+SYSCALL(dup)
+ 541:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 546:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+0000054c <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 54c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 551:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+00000557 <sbrk>:
+SYSCALL(sbrk)
+ 557:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 55c:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+00000562 <sleep>:
+SYSCALL(sleep)
+ 562:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 567:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+0000056d <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 56d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 572:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+00000578 <swapread>:
+SYSCALL(swapread)
+ 578:	b8 16 00 00 00       	mov    $0x16,%eax
+ 57d:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+00000583 <swapwrite>:
+SYSCALL(swapwrite)
+ 583:	b8 17 00 00 00       	mov    $0x17,%eax
+ 588:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+0000058e <swapstat>:
+SYSCALL(swapstat)
+ 58e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 593:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+00000599 <madvise>:
+SYSCALL(madvise)
+ 599:	b8 19 00 00 00       	mov    $0x19,%eax
+ 59e:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+000005a4 <mlock>:
+SYSCALL(mlock)
+ 5a4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5a9:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+000005af <munlock>:
+SYSCALL(munlock)
+ 5af:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5b4:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+000005ba <membench>:
+SYSCALL(membench)
+ 5ba:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5bf:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+000005c5 <nice>:
+SYSCALL(nice)
+ 5c5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5ca:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+000005d0 <setpriority>:
+SYSCALL(setpriority)
+ 5d0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5d5:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+000005db <usleep>:
+SYSCALL(usleep)
+ 5db:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5e0:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+000005e6 <cpustat>:
+SYSCALL(cpustat)
+ 5e6:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5eb:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+000005f1 <clone>:
+SYSCALL(clone)
+ 5f1:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5f6:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+000005fc <join>:
+SYSCALL(join)
+ 5fc:	b8 22 00 00 00       	mov    $0x22,%eax
+ 601:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+00000607 <futex_wait>:
+SYSCALL(futex_wait)
+ 607:	b8 23 00 00 00       	mov    $0x23,%eax
+ 60c:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+00000612 <futex_wake>:
+SYSCALL(futex_wake)
+ 612:	b8 24 00 00 00       	mov    $0x24,%eax
+ 617:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+0000061d <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 61d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 622:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+00000628 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 628:	b8 26 00 00 00       	mov    $0x26,%eax
+ 62d:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+00000633 <getcpu>:
+SYSCALL(getcpu)
+ 633:	b8 27 00 00 00       	mov    $0x27,%eax
+ 638:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+0000063e <migrations>:
+SYSCALL(migrations)
+ 63e:	b8 28 00 00 00       	mov    $0x28,%eax
+ 643:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+00000649 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 649:	b8 29 00 00 00       	mov    $0x29,%eax
+ 64e:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+00000654 <lockstat>:
+SYSCALL(lockstat)
+ 654:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 659:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+0000065f <lockprof>:
+SYSCALL(lockprof)
+ 65f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 664:	ff 25 f0 0e 00 00    	jmp    *0xef0
+
+0000066a <bcachestat>:
+SYSCALL(bcachestat)
+ 66a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 66f:	ff 25 f0 0e 00 00    	jmp    *0xef0
+ 675:	66 90                	xchg   %ax,%ax
+ 677:	66 90                	xchg   %ax,%ax
+ 679:	66 90                	xchg   %ax,%ax
+ 67b:	66 90                	xchg   %ax,%ax
+ 67d:	66 90                	xchg   %ax,%ax
+ 67f:	90                   	nop
+
+00000680 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	57                   	push   %edi
+ 684:	56                   	push   %esi
+ 685:	53                   	push   %ebx
+ 686:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 688:	89 d1                	mov    %edx,%ecx
+{
+ 68a:	83 ec 3c             	sub    $0x3c,%esp
+ 68d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 690:	85 d2                	test   %edx,%edx
+ 692:	0f 89 80 00 00 00    	jns    718 <printint+0x98>
+ 698:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 69c:	74 7a                	je     718 <printint+0x98>
+    x = -xx;
+ 69e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 6a8:	31 f6                	xor    %esi,%esi
+ 6aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 6b0:	89 c8                	mov    %ecx,%eax
+ 6b2:	31 d2                	xor    %edx,%edx
+ 6b4:	89 f7                	mov    %esi,%edi
+ 6b6:	f7 f3                	div    %ebx
+ 6b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 6bb:	0f b6 92 f8 0a 00 00 	movzbl 0xaf8(%edx),%edx
+ 6c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 6c6:	89 ca                	mov    %ecx,%edx
+ 6c8:	89 c1                	mov    %eax,%ecx
+ 6ca:	39 da                	cmp    %ebx,%edx
+ 6cc:	73 e2                	jae    6b0 <printint+0x30>
+  if(neg)
+ 6ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 6d1:	85 c0                	test   %eax,%eax
+ 6d3:	74 07                	je     6dc <printint+0x5c>
+    buf[i++] = '-';
+ 6d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 6da:	89 f7                	mov    %esi,%edi
+ 6dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 6df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 6e2:	01 df                	add    %ebx,%edi
+ 6e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 6e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 6eb:	83 ec 04             	sub    $0x4,%esp
+ 6ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 6f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 6f4:	6a 01                	push   $0x1
+ 6f6:	50                   	push   %eax
+ 6f7:	56                   	push   %esi
+ 6f8:	e8 cb fd ff ff       	call   4c8 <write>
+  while(--i >= 0)
+ 6fd:	89 f8                	mov    %edi,%eax
+ 6ff:	83 c4 10             	add    $0x10,%esp
+ 702:	83 ef 01             	sub    $0x1,%edi
+ 705:	39 d8                	cmp    %ebx,%eax
+ 707:	75 df                	jne    6e8 <printint+0x68>
+}
+ 709:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 70c:	5b                   	pop    %ebx
+ 70d:	5e                   	pop    %esi
+ 70e:	5f                   	pop    %edi
+ 70f:	5d                   	pop    %ebp
+ 710:	c3                   	ret
+ 711:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 718:	31 c0                	xor    %eax,%eax
+ 71a:	eb 89                	jmp    6a5 <printint+0x25>
+ 71c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000720 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 720:	55                   	push   %ebp
+ 721:	89 e5                	mov    %esp,%ebp
+ 723:	57                   	push   %edi
+ 724:	56                   	push   %esi
+ 725:	53                   	push   %ebx
+ 726:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 729:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 72c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 72f:	0f b6 1e             	movzbl (%esi),%ebx
+ 732:	83 c6 01             	add    $0x1,%esi
+ 735:	84 db                	test   %bl,%bl
+ 737:	74 67                	je     7a0 <printf+0x80>
+ 739:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 73c:	31 d2                	xor    %edx,%edx
+ 73e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 741:	eb 34                	jmp    777 <printf+0x57>
+ 743:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 747:	90                   	nop
+ 748:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 74b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 750:	83 f8 25             	cmp    $0x25,%eax
+ 753:	74 18                	je     76d <printf+0x4d>
+  write(fd, &c, 1);
+ 755:	83 ec 04             	sub    $0x4,%esp
+ 758:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 75b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 75e:	6a 01                	push   $0x1
+ 760:	50                   	push   %eax
+ 761:	57                   	push   %edi
+ 762:	e8 61 fd ff ff       	call   4c8 <write>
+ 767:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 76a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 76d:	0f b6 1e             	movzbl (%esi),%ebx
+ 770:	83 c6 01             	add    $0x1,%esi
+ 773:	84 db                	test   %bl,%bl
+ 775:	74 29                	je     7a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 777:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 77a:	85 d2                	test   %edx,%edx
+ 77c:	74 ca                	je     748 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 77e:	83 fa 25             	cmp    $0x25,%edx
+ 781:	75 ea                	jne    76d <printf+0x4d>
+      if(c == 'd'){
+ 783:	83 f8 25             	cmp    $0x25,%eax
+ 786:	0f 84 24 01 00 00    	je     8b0 <printf+0x190>
+ 78c:	83 e8 63             	sub    $0x63,%eax
+ 78f:	83 f8 15             	cmp    $0x15,%eax
+ 792:	77 1c                	ja     7b0 <printf+0x90>
+ 794:	ff 24 85 a0 0a 00 00 	jmp    *0xaa0(,%eax,4)
+ 79b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 79f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 7a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7a3:	5b                   	pop    %ebx
+ 7a4:	5e                   	pop    %esi
+ 7a5:	5f                   	pop    %edi
+ 7a6:	5d                   	pop    %ebp
+ 7a7:	c3                   	ret
+ 7a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7af:	90                   	nop
+  write(fd, &c, 1);
+ 7b0:	83 ec 04             	sub    $0x4,%esp
+ 7b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 7ba:	6a 01                	push   $0x1
+ 7bc:	52                   	push   %edx
+ 7bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 7c0:	57                   	push   %edi
+ 7c1:	e8 02 fd ff ff       	call   4c8 <write>
+ 7c6:	83 c4 0c             	add    $0xc,%esp
+ 7c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7cc:	6a 01                	push   $0x1
+ 7ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 7d1:	52                   	push   %edx
+ 7d2:	57                   	push   %edi
+ 7d3:	e8 f0 fc ff ff       	call   4c8 <write>
+        putc(fd, c);
+ 7d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7db:	31 d2                	xor    %edx,%edx
+ 7dd:	eb 8e                	jmp    76d <printf+0x4d>
+ 7df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 7e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7e3:	83 ec 0c             	sub    $0xc,%esp
+ 7e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7eb:	8b 13                	mov    (%ebx),%edx
+ 7ed:	6a 00                	push   $0x0
+ 7ef:	89 f8                	mov    %edi,%eax
+        ap++;
+ 7f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 7f4:	e8 87 fe ff ff       	call   680 <printint>
+        ap++;
+ 7f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7ff:	31 d2                	xor    %edx,%edx
+ 801:	e9 67 ff ff ff       	jmp    76d <printf+0x4d>
+ 806:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 80d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 810:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 813:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 815:	83 c0 04             	add    $0x4,%eax
+ 818:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 81b:	85 db                	test   %ebx,%ebx
+ 81d:	0f 84 9d 00 00 00    	je     8c0 <printf+0x1a0>
+        while(*s != 0){
+ 823:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 826:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 828:	84 c0                	test   %al,%al
+ 82a:	0f 84 3d ff ff ff    	je     76d <printf+0x4d>
+ 830:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 833:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 836:	89 de                	mov    %ebx,%esi
+ 838:	89 d3                	mov    %edx,%ebx
+ 83a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 840:	83 ec 04             	sub    $0x4,%esp
+ 843:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 846:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 849:	6a 01                	push   $0x1
+ 84b:	53                   	push   %ebx
+ 84c:	57                   	push   %edi
+ 84d:	e8 76 fc ff ff       	call   4c8 <write>
+        while(*s != 0){
+ 852:	0f b6 06             	movzbl (%esi),%eax
+ 855:	83 c4 10             	add    $0x10,%esp
+ 858:	84 c0                	test   %al,%al
+ 85a:	75 e4                	jne    840 <printf+0x120>
+      state = 0;
+ 85c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 85f:	31 d2                	xor    %edx,%edx
+ 861:	e9 07 ff ff ff       	jmp    76d <printf+0x4d>
+ 866:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 86d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 870:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 873:	83 ec 0c             	sub    $0xc,%esp
+ 876:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 87b:	8b 13                	mov    (%ebx),%edx
+ 87d:	6a 01                	push   $0x1
+ 87f:	e9 6b ff ff ff       	jmp    7ef <printf+0xcf>
+ 884:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 888:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 88b:	83 ec 04             	sub    $0x4,%esp
+ 88e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 891:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 893:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 896:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 899:	6a 01                	push   $0x1
+ 89b:	52                   	push   %edx
+ 89c:	57                   	push   %edi
+ 89d:	e8 26 fc ff ff       	call   4c8 <write>
+        ap++;
+ 8a2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8a5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8a8:	31 d2                	xor    %edx,%edx
+ 8aa:	e9 be fe ff ff       	jmp    76d <printf+0x4d>
+ 8af:	90                   	nop
+  write(fd, &c, 1);
+ 8b0:	83 ec 04             	sub    $0x4,%esp
+ 8b3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8b6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8b9:	6a 01                	push   $0x1
+ 8bb:	e9 11 ff ff ff       	jmp    7d1 <printf+0xb1>
+ 8c0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 8c5:	bb 96 0a 00 00       	mov    $0xa96,%ebx
+ 8ca:	e9 61 ff ff ff       	jmp    830 <printf+0x110>
+ 8cf:	90                   	nop
+
+000008d0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8d0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8d1:	a1 f4 0e 00 00       	mov    0xef4,%eax
+{
+ 8d6:	89 e5                	mov    %esp,%ebp
+ 8d8:	57                   	push   %edi
+ 8d9:	56                   	push   %esi
+ 8da:	53                   	push   %ebx
+ 8db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 8de:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8e8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8ea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8ec:	39 ca                	cmp    %ecx,%edx
+ 8ee:	73 30                	jae    920 <free+0x50>
+ 8f0:	39 c1                	cmp    %eax,%ecx
+ 8f2:	72 04                	jb     8f8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8f4:	39 c2                	cmp    %eax,%edx
+ 8f6:	72 f0                	jb     8e8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8f8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 8fb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 8fe:	39 f8                	cmp    %edi,%eax
+ 900:	74 2e                	je     930 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 902:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 905:	8b 42 04             	mov    0x4(%edx),%eax
+ 908:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 90b:	39 f1                	cmp    %esi,%ecx
+ 90d:	74 38                	je     947 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 90f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 911:	5b                   	pop    %ebx
+  freep = p;
+ 912:	89 15 f4 0e 00 00    	mov    %edx,0xef4
+}
+ 918:	5e                   	pop    %esi
+ 919:	5f                   	pop    %edi
+ 91a:	5d                   	pop    %ebp
+ 91b:	c3                   	ret
+ 91c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 920:	39 c1                	cmp    %eax,%ecx
+ 922:	72 d0                	jb     8f4 <free+0x24>
+ 924:	eb c2                	jmp    8e8 <free+0x18>
+ 926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 92d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 930:	03 70 04             	add    0x4(%eax),%esi
+ 933:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 936:	8b 02                	mov    (%edx),%eax
+ 938:	8b 00                	mov    (%eax),%eax
+ 93a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 93d:	8b 42 04             	mov    0x4(%edx),%eax
+ 940:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 943:	39 f1                	cmp    %esi,%ecx
+ 945:	75 c8                	jne    90f <free+0x3f>
+    p->s.size += bp->s.size;
+ 947:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 94a:	89 15 f4 0e 00 00    	mov    %edx,0xef4
+    p->s.size += bp->s.size;
+ 950:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 953:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 956:	89 0a                	mov    %ecx,(%edx)
+}
+ 958:	5b                   	pop    %ebx
+ 959:	5e                   	pop    %esi
+ 95a:	5f                   	pop    %edi
+ 95b:	5d                   	pop    %ebp
+ 95c:	c3                   	ret
+ 95d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000960 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 960:	55                   	push   %ebp
+ 961:	89 e5                	mov    %esp,%ebp
+ 963:	57                   	push   %edi
+ 964:	56                   	push   %esi
+ 965:	53                   	push   %ebx
+ 966:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 969:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 96c:	8b 15 f4 0e 00 00    	mov    0xef4,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 972:	8d 78 07             	lea    0x7(%eax),%edi
+ 975:	c1 ef 03             	shr    $0x3,%edi
+ 978:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 97b:	85 d2                	test   %edx,%edx
+ 97d:	0f 84 8d 00 00 00    	je     a10 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 983:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 985:	8b 48 04             	mov    0x4(%eax),%ecx
+ 988:	39 f9                	cmp    %edi,%ecx
+ 98a:	73 64                	jae    9f0 <malloc+0x90>
+  if(nu < 4096)
+ 98c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 991:	39 df                	cmp    %ebx,%edi
+ 993:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 996:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 99d:	eb 0a                	jmp    9a9 <malloc+0x49>
+ 99f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9a0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9a2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9a5:	39 f9                	cmp    %edi,%ecx
+ 9a7:	73 47                	jae    9f0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 9a9:	89 c2                	mov    %eax,%edx
+ 9ab:	39 05 f4 0e 00 00    	cmp    %eax,0xef4
+ 9b1:	75 ed                	jne    9a0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 9b3:	83 ec 0c             	sub    $0xc,%esp
+ 9b6:	56                   	push   %esi
+ 9b7:	e8 9b fb ff ff       	call   557 <sbrk>
+  if(p == (char*)-1)
+ 9bc:	83 c4 10             	add    $0x10,%esp
+ 9bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9c2:	74 1c                	je     9e0 <malloc+0x80>
+  hp->s.size = nu;
+ 9c4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9c7:	83 ec 0c             	sub    $0xc,%esp
+ 9ca:	83 c0 08             	add    $0x8,%eax
+ 9cd:	50                   	push   %eax
+ 9ce:	e8 fd fe ff ff       	call   8d0 <free>
+  return freep;
+ 9d3:	8b 15 f4 0e 00 00    	mov    0xef4,%edx
+      if((p = morecore(nunits)) == 0)
+ 9d9:	83 c4 10             	add    $0x10,%esp
+ 9dc:	85 d2                	test   %edx,%edx
+ 9de:	75 c0                	jne    9a0 <malloc+0x40>
+        return 0;
+  }
+}
+ 9e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 9e3:	31 c0                	xor    %eax,%eax
+}
+ 9e5:	5b                   	pop    %ebx
+ 9e6:	5e                   	pop    %esi
+ 9e7:	5f                   	pop    %edi
+ 9e8:	5d                   	pop    %ebp
+ 9e9:	c3                   	ret
+ 9ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 9f0:	39 cf                	cmp    %ecx,%edi
+ 9f2:	74 4c                	je     a40 <malloc+0xe0>
+        p->s.size -= nunits;
+ 9f4:	29 f9                	sub    %edi,%ecx
+ 9f6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 9f9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 9fc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 9ff:	89 15 f4 0e 00 00    	mov    %edx,0xef4
+}
+ a05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a08:	83 c0 08             	add    $0x8,%eax
+}
+ a0b:	5b                   	pop    %ebx
+ a0c:	5e                   	pop    %esi
+ a0d:	5f                   	pop    %edi
+ a0e:	5d                   	pop    %ebp
+ a0f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a10:	c7 05 f4 0e 00 00 f8 	movl   $0xef8,0xef4
+ a17:	0e 00 00 
+    base.s.size = 0;
+ a1a:	b8 f8 0e 00 00       	mov    $0xef8,%eax
+    base.s.ptr = freep = prevp = &base;
+ a1f:	c7 05 f8 0e 00 00 f8 	movl   $0xef8,0xef8
+ a26:	0e 00 00 
+    base.s.size = 0;
+ a29:	c7 05 fc 0e 00 00 00 	movl   $0x0,0xefc
+ a30:	00 00 00 
+    if(p->s.size >= nunits){
+ a33:	e9 54 ff ff ff       	jmp    98c <malloc+0x2c>
+ a38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a3f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a40:	8b 08                	mov    (%eax),%ecx
+ a42:	89 0a                	mov    %ecx,(%edx)
+ a44:	eb b9                	jmp    9ff <malloc+0x9f>
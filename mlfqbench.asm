@@ -0,0 +1,1855 @@
+
+_mlfqbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%s: mean %d cycles, max %d cycles\n", what, sum, max);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 19                	mov    (%ecx),%ebx
+  16:	8b 51 04             	mov    0x4(%ecx),%edx
+  int i, nhogs, nreq;
+
+  nhogs = 4;
+  nreq = 50;
+  if(argc > 1)
+  19:	83 fb 01             	cmp    $0x1,%ebx
+  1c:	0f 8f c9 00 00 00    	jg     eb <main+0xeb>
+  if(argc > 2)
+    nreq = atoi(argv[2]);
+  if(nhogs > NHOG)
+    nhogs = NHOG;
+
+  respond(nreq, "idle");
+  22:	50                   	push   %eax
+  nreq = 50;
+  23:	be 32 00 00 00       	mov    $0x32,%esi
+  if(nhogs > NHOG)
+  28:	bb 04 00 00 00       	mov    $0x4,%ebx
+  respond(nreq, "idle");
+  2d:	50                   	push   %eax
+  2e:	68 c7 0c 00 00       	push   $0xcc7
+  33:	6a 32                	push   $0x32
+  35:	e8 26 01 00 00       	call   160 <respond>
+  3a:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < nhogs; i++){
+  3d:	31 ff                	xor    %edi,%edi
+  3f:	eb 0e                	jmp    4f <main+0x4f>
+  41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  48:	83 c7 01             	add    $0x1,%edi
+  4b:	39 df                	cmp    %ebx,%edi
+  4d:	7d 12                	jge    61 <main+0x61>
+    if((hogs[i] = fork()) == 0){
+  4f:	e8 8d 06 00 00       	call   6e1 <fork>
+  54:	89 04 bd e0 11 00 00 	mov    %eax,0x11e0(,%edi,4)
+  5b:	85 c0                	test   %eax,%eax
+  5d:	75 e9                	jne    48 <main+0x48>
+      for(;;)
+  5f:	eb fe                	jmp    5f <main+0x5f>
+        ;
+    }
+  }
+  respond(nreq, "with hogs");
+  61:	52                   	push   %edx
+
+  for(i = 0; i < nhogs; i++)
+  62:	31 ff                	xor    %edi,%edi
+  respond(nreq, "with hogs");
+  64:	52                   	push   %edx
+  65:	68 cc 0c 00 00       	push   $0xccc
+  6a:	56                   	push   %esi
+  6b:	e8 f0 00 00 00       	call   160 <respond>
+  70:	83 c4 10             	add    $0x10,%esp
+  73:	eb 0a                	jmp    7f <main+0x7f>
+  75:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; i < nhogs; i++)
+  78:	83 c7 01             	add    $0x1,%edi
+  7b:	39 df                	cmp    %ebx,%edi
+  7d:	7d 31                	jge    b0 <main+0xb0>
+    if(setpriority(hogs[i], NPRIO-1) < 0)
+  7f:	83 ec 08             	sub    $0x8,%esp
+  82:	6a 02                	push   $0x2
+  84:	ff 34 bd e0 11 00 00 	push   0x11e0(,%edi,4)
+  8b:	e8 90 07 00 00       	call   820 <setpriority>
+  90:	83 c4 10             	add    $0x10,%esp
+  93:	85 c0                	test   %eax,%eax
+  95:	79 e1                	jns    78 <main+0x78>
+      printf(1, "mlfqbench: setpriority failed\n");
+  97:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < nhogs; i++)
+  9a:	83 c7 01             	add    $0x1,%edi
+      printf(1, "mlfqbench: setpriority failed\n");
+  9d:	68 0c 0d 00 00       	push   $0xd0c
+  a2:	6a 01                	push   $0x1
+  a4:	e8 c7 08 00 00       	call   970 <printf>
+  a9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < nhogs; i++)
+  ac:	39 df                	cmp    %ebx,%edi
+  ae:	7c cf                	jl     7f <main+0x7f>
+  respond(nreq, "with niced hogs");
+  b0:	50                   	push   %eax
+  b1:	50                   	push   %eax
+  b2:	68 d6 0c 00 00       	push   $0xcd6
+  b7:	56                   	push   %esi
+
+  for(i = 0; i < nhogs; i++){
+  b8:	31 f6                	xor    %esi,%esi
+  respond(nreq, "with niced hogs");
+  ba:	e8 a1 00 00 00       	call   160 <respond>
+  bf:	83 c4 10             	add    $0x10,%esp
+  c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    kill(hogs[i]);
+  c8:	83 ec 0c             	sub    $0xc,%esp
+  cb:	ff 34 b5 e0 11 00 00 	push   0x11e0(,%esi,4)
+  for(i = 0; i < nhogs; i++){
+  d2:	83 c6 01             	add    $0x1,%esi
+    kill(hogs[i]);
+  d5:	e8 54 06 00 00       	call   72e <kill>
+    wait();
+  da:	e8 18 06 00 00       	call   6f7 <wait>
+  for(i = 0; i < nhogs; i++){
+  df:	83 c4 10             	add    $0x10,%esp
+  e2:	39 de                	cmp    %ebx,%esi
+  e4:	7c e2                	jl     c8 <main+0xc8>
+  }
+  exit();
+  e6:	e8 01 06 00 00       	call   6ec <exit>
+    nhogs = atoi(argv[1]);
+  eb:	83 ec 0c             	sub    $0xc,%esp
+  ee:	ff 72 04             	push   0x4(%edx)
+  nreq = 50;
+  f1:	be 32 00 00 00       	mov    $0x32,%esi
+    nhogs = atoi(argv[1]);
+  f6:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  f9:	e8 a2 03 00 00       	call   4a0 <atoi>
+  if(argc > 2)
+  fe:	83 c4 10             	add    $0x10,%esp
+    nhogs = atoi(argv[1]);
+ 101:	89 c7                	mov    %eax,%edi
+  if(argc > 2)
+ 103:	83 fb 02             	cmp    $0x2,%ebx
+ 106:	74 13                	je     11b <main+0x11b>
+    nreq = atoi(argv[2]);
+ 108:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 10b:	83 ec 0c             	sub    $0xc,%esp
+ 10e:	ff 72 08             	push   0x8(%edx)
+ 111:	e8 8a 03 00 00       	call   4a0 <atoi>
+ 116:	83 c4 10             	add    $0x10,%esp
+ 119:	89 c6                	mov    %eax,%esi
+  respond(nreq, "idle");
+ 11b:	50                   	push   %eax
+  if(nhogs > NHOG)
+ 11c:	bb 10 00 00 00       	mov    $0x10,%ebx
+  respond(nreq, "idle");
+ 121:	50                   	push   %eax
+  if(nhogs > NHOG)
+ 122:	39 df                	cmp    %ebx,%edi
+  respond(nreq, "idle");
+ 124:	68 c7 0c 00 00       	push   $0xcc7
+  if(nhogs > NHOG)
+ 129:	0f 4e df             	cmovle %edi,%ebx
+  respond(nreq, "idle");
+ 12c:	56                   	push   %esi
+ 12d:	e8 2e 00 00 00       	call   160 <respond>
+  for(i = 0; i < nhogs; i++){
+ 132:	83 c4 10             	add    $0x10,%esp
+ 135:	85 ff                	test   %edi,%edi
+ 137:	0f 8f 00 ff ff ff    	jg     3d <main+0x3d>
+  respond(nreq, "with hogs");
+ 13d:	51                   	push   %ecx
+ 13e:	51                   	push   %ecx
+ 13f:	68 cc 0c 00 00       	push   $0xccc
+ 144:	56                   	push   %esi
+ 145:	e8 16 00 00 00       	call   160 <respond>
+  respond(nreq, "with niced hogs");
+ 14a:	5b                   	pop    %ebx
+ 14b:	5f                   	pop    %edi
+ 14c:	68 d6 0c 00 00       	push   $0xcd6
+ 151:	56                   	push   %esi
+ 152:	e8 09 00 00 00       	call   160 <respond>
+ 157:	83 c4 10             	add    $0x10,%esp
+ 15a:	eb 8a                	jmp    e6 <main+0xe6>
+ 15c:	66 90                	xchg   %ax,%ax
+ 15e:	66 90                	xchg   %ax,%ax
+
+00000160 <respond>:
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	57                   	push   %edi
+ 164:	56                   	push   %esi
+  if(pipe(a) < 0 || pipe(b) < 0){
+ 165:	8d 45 d8             	lea    -0x28(%ebp),%eax
+{
+ 168:	53                   	push   %ebx
+ 169:	83 ec 48             	sub    $0x48,%esp
+  if(pipe(a) < 0 || pipe(b) < 0){
+ 16c:	50                   	push   %eax
+ 16d:	e8 90 05 00 00       	call   702 <pipe>
+ 172:	83 c4 10             	add    $0x10,%esp
+ 175:	85 c0                	test   %eax,%eax
+ 177:	0f 88 f7 00 00 00    	js     274 <respond+0x114>
+ 17d:	83 ec 0c             	sub    $0xc,%esp
+ 180:	8d 45 e0             	lea    -0x20(%ebp),%eax
+ 183:	50                   	push   %eax
+ 184:	e8 79 05 00 00       	call   702 <pipe>
+ 189:	83 c4 10             	add    $0x10,%esp
+ 18c:	85 c0                	test   %eax,%eax
+ 18e:	0f 88 e0 00 00 00    	js     274 <respond+0x114>
+  if((pid = fork()) == 0){
+ 194:	e8 48 05 00 00       	call   6e1 <fork>
+ 199:	85 c0                	test   %eax,%eax
+ 19b:	0f 84 e6 00 00 00    	je     287 <respond+0x127>
+  close(a[0]);
+ 1a1:	83 ec 0c             	sub    $0xc,%esp
+ 1a4:	ff 75 d8             	push   -0x28(%ebp)
+  sum = max = 0;
+ 1a7:	31 f6                	xor    %esi,%esi
+  close(a[0]);
+ 1a9:	e8 75 05 00 00       	call   723 <close>
+  close(b[1]);
+ 1ae:	5a                   	pop    %edx
+ 1af:	ff 75 e4             	push   -0x1c(%ebp)
+ 1b2:	e8 6c 05 00 00       	call   723 <close>
+  for(i = 0; i < nreq; i++){
+ 1b7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1ba:	83 c4 10             	add    $0x10,%esp
+  c = 0;
+ 1bd:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+  sum = max = 0;
+ 1c1:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+  for(i = 0; i < nreq; i++){
+ 1c8:	85 c9                	test   %ecx,%ecx
+ 1ca:	7e 6f                	jle    23b <respond+0xdb>
+ 1cc:	31 ff                	xor    %edi,%edi
+ 1ce:	8d 5d d7             	lea    -0x29(%ebp),%ebx
+ 1d1:	eb 23                	jmp    1f6 <respond+0x96>
+ 1d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1d7:	90                   	nop
+
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+ 1d8:	0f 31                	rdtsc
+    t = rdtsc() - t;
+ 1da:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 1dd:	29 d0                	sub    %edx,%eax
+    sum += t / nreq;
+ 1df:	31 d2                	xor    %edx,%edx
+    t = rdtsc() - t;
+ 1e1:	89 c1                	mov    %eax,%ecx
+    sum += t / nreq;
+ 1e3:	f7 75 08             	divl   0x8(%ebp)
+ 1e6:	01 45 c0             	add    %eax,-0x40(%ebp)
+ 1e9:	39 ce                	cmp    %ecx,%esi
+ 1eb:	0f 42 f1             	cmovb  %ecx,%esi
+  for(i = 0; i < nreq; i++){
+ 1ee:	83 c7 01             	add    $0x1,%edi
+ 1f1:	39 7d 08             	cmp    %edi,0x8(%ebp)
+ 1f4:	74 45                	je     23b <respond+0xdb>
+    sleep(1);
+ 1f6:	83 ec 0c             	sub    $0xc,%esp
+ 1f9:	6a 01                	push   $0x1
+ 1fb:	e8 b2 05 00 00       	call   7b2 <sleep>
+ 200:	0f 31                	rdtsc
+    write(a[1], &c, 1);
+ 202:	83 c4 0c             	add    $0xc,%esp
+ 205:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 208:	6a 01                	push   $0x1
+ 20a:	53                   	push   %ebx
+ 20b:	ff 75 dc             	push   -0x24(%ebp)
+ 20e:	e8 05 05 00 00       	call   718 <write>
+    if(read(b[0], &c, 1) != 1){
+ 213:	83 c4 0c             	add    $0xc,%esp
+ 216:	6a 01                	push   $0x1
+ 218:	53                   	push   %ebx
+ 219:	ff 75 e0             	push   -0x20(%ebp)
+ 21c:	e8 ec 04 00 00       	call   70d <read>
+ 221:	83 c4 10             	add    $0x10,%esp
+ 224:	83 f8 01             	cmp    $0x1,%eax
+ 227:	74 af                	je     1d8 <respond+0x78>
+      printf(1, "mlfqbench: short read\n");
+ 229:	83 ec 08             	sub    $0x8,%esp
+ 22c:	68 b0 0c 00 00       	push   $0xcb0
+ 231:	6a 01                	push   $0x1
+ 233:	e8 38 07 00 00       	call   970 <printf>
+      break;
+ 238:	83 c4 10             	add    $0x10,%esp
+  close(a[1]);
+ 23b:	83 ec 0c             	sub    $0xc,%esp
+ 23e:	ff 75 dc             	push   -0x24(%ebp)
+ 241:	e8 dd 04 00 00       	call   723 <close>
+  close(b[0]);
+ 246:	58                   	pop    %eax
+ 247:	ff 75 e0             	push   -0x20(%ebp)
+ 24a:	e8 d4 04 00 00       	call   723 <close>
+  wait();
+ 24f:	e8 a3 04 00 00       	call   6f7 <wait>
+  printf(1, "%s: mean %d cycles, max %d cycles\n", what, sum, max);
+ 254:	89 34 24             	mov    %esi,(%esp)
+ 257:	ff 75 c0             	push   -0x40(%ebp)
+ 25a:	ff 75 0c             	push   0xc(%ebp)
+ 25d:	68 e8 0c 00 00       	push   $0xce8
+ 262:	6a 01                	push   $0x1
+ 264:	e8 07 07 00 00       	call   970 <printf>
+}
+ 269:	83 c4 20             	add    $0x20,%esp
+ 26c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 26f:	5b                   	pop    %ebx
+ 270:	5e                   	pop    %esi
+ 271:	5f                   	pop    %edi
+ 272:	5d                   	pop    %ebp
+ 273:	c3                   	ret
+    printf(1, "mlfqbench: pipe failed\n");
+ 274:	56                   	push   %esi
+ 275:	56                   	push   %esi
+ 276:	68 98 0c 00 00       	push   $0xc98
+ 27b:	6a 01                	push   $0x1
+ 27d:	e8 ee 06 00 00       	call   970 <printf>
+    exit();
+ 282:	e8 65 04 00 00       	call   6ec <exit>
+    close(a[1]);
+ 287:	83 ec 0c             	sub    $0xc,%esp
+ 28a:	ff 75 dc             	push   -0x24(%ebp)
+ 28d:	e8 91 04 00 00       	call   723 <close>
+    close(b[0]);
+ 292:	5b                   	pop    %ebx
+ 293:	ff 75 e0             	push   -0x20(%ebp)
+ 296:	8d 5d d7             	lea    -0x29(%ebp),%ebx
+ 299:	e8 85 04 00 00       	call   723 <close>
+    while(read(a[0], &c, 1) == 1)
+ 29e:	83 c4 10             	add    $0x10,%esp
+ 2a1:	eb 11                	jmp    2b4 <respond+0x154>
+      write(b[1], &c, 1);
+ 2a3:	83 ec 04             	sub    $0x4,%esp
+ 2a6:	6a 01                	push   $0x1
+ 2a8:	53                   	push   %ebx
+ 2a9:	ff 75 e4             	push   -0x1c(%ebp)
+ 2ac:	e8 67 04 00 00       	call   718 <write>
+ 2b1:	83 c4 10             	add    $0x10,%esp
+    while(read(a[0], &c, 1) == 1)
+ 2b4:	83 ec 04             	sub    $0x4,%esp
+ 2b7:	6a 01                	push   $0x1
+ 2b9:	53                   	push   %ebx
+ 2ba:	ff 75 d8             	push   -0x28(%ebp)
+ 2bd:	e8 4b 04 00 00       	call   70d <read>
+ 2c2:	83 c4 10             	add    $0x10,%esp
+ 2c5:	83 f8 01             	cmp    $0x1,%eax
+ 2c8:	74 d9                	je     2a3 <respond+0x143>
+    exit();
+ 2ca:	e8 1d 04 00 00       	call   6ec <exit>
+ 2cf:	90                   	nop
+
+000002d0 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 2d0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2d1:	31 c0                	xor    %eax,%eax
+{
+ 2d3:	89 e5                	mov    %esp,%ebp
+ 2d5:	53                   	push   %ebx
+ 2d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 2dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 2e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 2e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 2e7:	83 c0 01             	add    $0x1,%eax
+ 2ea:	84 d2                	test   %dl,%dl
+ 2ec:	75 f2                	jne    2e0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 2ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2f1:	89 c8                	mov    %ecx,%eax
+ 2f3:	c9                   	leave
+ 2f4:	c3                   	ret
+ 2f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	53                   	push   %ebx
+ 304:	8b 55 08             	mov    0x8(%ebp),%edx
+ 307:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 30a:	0f b6 02             	movzbl (%edx),%eax
+ 30d:	84 c0                	test   %al,%al
+ 30f:	75 17                	jne    328 <strcmp+0x28>
+ 311:	eb 3a                	jmp    34d <strcmp+0x4d>
+ 313:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 317:	90                   	nop
+ 318:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 31c:	83 c2 01             	add    $0x1,%edx
+ 31f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 322:	84 c0                	test   %al,%al
+ 324:	74 1a                	je     340 <strcmp+0x40>
+    p++, q++;
+ 326:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 328:	0f b6 19             	movzbl (%ecx),%ebx
+ 32b:	38 c3                	cmp    %al,%bl
+ 32d:	74 e9                	je     318 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 32f:	29 d8                	sub    %ebx,%eax
+}
+ 331:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 334:	c9                   	leave
+ 335:	c3                   	ret
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 340:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 344:	31 c0                	xor    %eax,%eax
+ 346:	29 d8                	sub    %ebx,%eax
+}
+ 348:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 34b:	c9                   	leave
+ 34c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 34d:	0f b6 19             	movzbl (%ecx),%ebx
+ 350:	31 c0                	xor    %eax,%eax
+ 352:	eb db                	jmp    32f <strcmp+0x2f>
+ 354:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 35f:	90                   	nop
+
+00000360 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 366:	80 3a 00             	cmpb   $0x0,(%edx)
+ 369:	74 15                	je     380 <strlen+0x20>
+ 36b:	31 c0                	xor    %eax,%eax
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+ 370:	83 c0 01             	add    $0x1,%eax
+ 373:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 377:	89 c1                	mov    %eax,%ecx
+ 379:	75 f5                	jne    370 <strlen+0x10>
+    ;
+  return n;
+}
+ 37b:	89 c8                	mov    %ecx,%eax
+ 37d:	5d                   	pop    %ebp
+ 37e:	c3                   	ret
+ 37f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 380:	31 c9                	xor    %ecx,%ecx
+}
+ 382:	5d                   	pop    %ebp
+ 383:	89 c8                	mov    %ecx,%eax
+ 385:	c3                   	ret
+ 386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000390 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("cld; rep stosb" :
+ 397:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 39a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 39d:	89 d7                	mov    %edx,%edi
+ 39f:	fc                   	cld
+ 3a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3a5:	89 d0                	mov    %edx,%eax
+ 3a7:	c9                   	leave
+ 3a8:	c3                   	ret
+ 3a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3ba:	0f b6 10             	movzbl (%eax),%edx
+ 3bd:	84 d2                	test   %dl,%dl
+ 3bf:	75 12                	jne    3d3 <strchr+0x23>
+ 3c1:	eb 1d                	jmp    3e0 <strchr+0x30>
+ 3c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3c7:	90                   	nop
+ 3c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3cc:	83 c0 01             	add    $0x1,%eax
+ 3cf:	84 d2                	test   %dl,%dl
+ 3d1:	74 0d                	je     3e0 <strchr+0x30>
+    if(*s == c)
+ 3d3:	38 d1                	cmp    %dl,%cl
+ 3d5:	75 f1                	jne    3c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3d7:	5d                   	pop    %ebp
+ 3d8:	c3                   	ret
+ 3d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3e0:	31 c0                	xor    %eax,%eax
+}
+ 3e2:	5d                   	pop    %ebp
+ 3e3:	c3                   	ret
+ 3e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ef:	90                   	nop
+
+000003f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	57                   	push   %edi
+ 3f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3f9:	31 db                	xor    %ebx,%ebx
+{
+ 3fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3fe:	eb 27                	jmp    427 <gets+0x37>
+    cc = read(0, &c, 1);
+ 400:	83 ec 04             	sub    $0x4,%esp
+ 403:	6a 01                	push   $0x1
+ 405:	56                   	push   %esi
+ 406:	6a 00                	push   $0x0
+ 408:	e8 00 03 00 00       	call   70d <read>
+    if(cc < 1)
+ 40d:	83 c4 10             	add    $0x10,%esp
+ 410:	85 c0                	test   %eax,%eax
+ 412:	7e 1d                	jle    431 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 414:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 418:	8b 55 08             	mov    0x8(%ebp),%edx
+ 41b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 41f:	3c 0a                	cmp    $0xa,%al
+ 421:	74 10                	je     433 <gets+0x43>
+ 423:	3c 0d                	cmp    $0xd,%al
+ 425:	74 0c                	je     433 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 427:	89 df                	mov    %ebx,%edi
+ 429:	83 c3 01             	add    $0x1,%ebx
+ 42c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 42f:	7c cf                	jl     400 <gets+0x10>
+ 431:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 433:	8b 45 08             	mov    0x8(%ebp),%eax
+ 436:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 43a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 43d:	5b                   	pop    %ebx
+ 43e:	5e                   	pop    %esi
+ 43f:	5f                   	pop    %edi
+ 440:	5d                   	pop    %ebp
+ 441:	c3                   	ret
+ 442:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	56                   	push   %esi
+ 454:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 455:	83 ec 08             	sub    $0x8,%esp
+ 458:	6a 00                	push   $0x0
+ 45a:	ff 75 08             	push   0x8(%ebp)
+ 45d:	e8 e2 02 00 00       	call   744 <open>
+  if(fd < 0)
+ 462:	83 c4 10             	add    $0x10,%esp
+ 465:	85 c0                	test   %eax,%eax
+ 467:	78 27                	js     490 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 469:	83 ec 08             	sub    $0x8,%esp
+ 46c:	ff 75 0c             	push   0xc(%ebp)
+ 46f:	89 c3                	mov    %eax,%ebx
+ 471:	50                   	push   %eax
+ 472:	e8 ee 02 00 00       	call   765 <fstat>
+  close(fd);
+ 477:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 47a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 47c:	e8 a2 02 00 00       	call   723 <close>
+  return r;
+ 481:	83 c4 10             	add    $0x10,%esp
+}
+ 484:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 487:	89 f0                	mov    %esi,%eax
+ 489:	5b                   	pop    %ebx
+ 48a:	5e                   	pop    %esi
+ 48b:	5d                   	pop    %ebp
+ 48c:	c3                   	ret
+ 48d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 490:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 495:	eb ed                	jmp    484 <stat+0x34>
+ 497:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49e:	66 90                	xchg   %ax,%ax
+
+000004a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	53                   	push   %ebx
+ 4a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 4a7:	0f be 02             	movsbl (%edx),%eax
+ 4aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 4ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 4b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 4b5:	77 1e                	ja     4d5 <atoi+0x35>
+ 4b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4c0:	83 c2 01             	add    $0x1,%edx
+ 4c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 4c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 4ca:	0f be 02             	movsbl (%edx),%eax
+ 4cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 4d0:	80 fb 09             	cmp    $0x9,%bl
+ 4d3:	76 eb                	jbe    4c0 <atoi+0x20>
+  return n;
+}
+ 4d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4d8:	89 c8                	mov    %ecx,%eax
+ 4da:	c9                   	leave
+ 4db:	c3                   	ret
+ 4dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004e0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	57                   	push   %edi
+ 4e4:	56                   	push   %esi
+ 4e5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4ee:	85 c0                	test   %eax,%eax
+ 4f0:	7e 13                	jle    505 <memmove+0x25>
+ 4f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4f4:	89 d7                	mov    %edx,%edi
+ 4f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 500:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 501:	39 f8                	cmp    %edi,%eax
+ 503:	75 fb                	jne    500 <memmove+0x20>
+  return vdst;
+}
+ 505:	5e                   	pop    %esi
+ 506:	89 d0                	mov    %edx,%eax
+ 508:	5f                   	pop    %edi
+ 509:	5d                   	pop    %ebp
+ 50a:	c3                   	ret
+ 50b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 50f:	90                   	nop
+
+00000510 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 510:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 515:	85 c0                	test   %eax,%eax
+ 517:	74 07                	je     520 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 519:	c3                   	ret
+ 51a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 520:	e9 77 02 00 00       	jmp    79c <sysgetpid>
+ 525:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000530 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 530:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 535:	c3                   	ret
+ 536:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000540 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 540:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 541:	31 d2                	xor    %edx,%edx
+ 543:	89 e5                	mov    %esp,%ebp
+ 545:	53                   	push   %ebx
+ 546:	83 ec 04             	sub    $0x4,%esp
+ 549:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 54c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 54f:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 552:	85 c9                	test   %ecx,%ecx
+ 554:	7e 08                	jle    55e <cyclereport+0x1e>
+ 556:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 558:	89 d8                	mov    %ebx,%eax
+ 55a:	f7 f1                	div    %ecx
+ 55c:	89 c2                	mov    %eax,%edx
+ 55e:	83 ec 08             	sub    $0x8,%esp
+ 561:	52                   	push   %edx
+ 562:	ff 75 0c             	push   0xc(%ebp)
+ 565:	51                   	push   %ecx
+ 566:	ff 75 08             	push   0x8(%ebp)
+ 569:	68 2b 0d 00 00       	push   $0xd2b
+ 56e:	6a 01                	push   $0x1
+ 570:	e8 fb 03 00 00       	call   970 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 575:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 578:	83 c4 20             	add    $0x20,%esp
+ 57b:	c9                   	leave
+ 57c:	c3                   	ret
+ 57d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000580 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 583:	8b 45 08             	mov    0x8(%ebp),%eax
+ 586:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 58c:	5d                   	pop    %ebp
+ 58d:	c3                   	ret
+ 58e:	66 90                	xchg   %ax,%ax
+
+00000590 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 590:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 591:	31 c0                	xor    %eax,%eax
+ 593:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 598:	89 e5                	mov    %esp,%ebp
+ 59a:	56                   	push   %esi
+ 59b:	53                   	push   %ebx
+ 59c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 59f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 5a3:	85 c0                	test   %eax,%eax
+ 5a5:	74 30                	je     5d7 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 5a7:	83 f8 02             	cmp    $0x2,%eax
+ 5aa:	74 0c                	je     5b8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 5ac:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5b1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 5b4:	85 c0                	test   %eax,%eax
+ 5b6:	74 1f                	je     5d7 <mutex_lock+0x47>
+ 5b8:	be 02 00 00 00       	mov    $0x2,%esi
+ 5bd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 5c0:	83 ec 08             	sub    $0x8,%esp
+ 5c3:	6a 02                	push   $0x2
+ 5c5:	53                   	push   %ebx
+ 5c6:	e8 8c 02 00 00       	call   857 <futex_wait>
+ 5cb:	89 f0                	mov    %esi,%eax
+ 5cd:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 5d0:	83 c4 10             	add    $0x10,%esp
+ 5d3:	85 c0                	test   %eax,%eax
+ 5d5:	75 e9                	jne    5c0 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 5d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 5da:	5b                   	pop    %ebx
+ 5db:	5e                   	pop    %esi
+ 5dc:	5d                   	pop    %ebp
+ 5dd:	c3                   	ret
+ 5de:	66 90                	xchg   %ax,%ax
+
+000005e0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	83 ec 08             	sub    $0x8,%esp
+ 5e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 5e9:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 5ed:	75 09                	jne    5f8 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 5ef:	c9                   	leave
+ 5f0:	c3                   	ret
+ 5f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 5f8:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 5fb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 601:	6a 01                	push   $0x1
+ 603:	50                   	push   %eax
+ 604:	e8 59 02 00 00       	call   862 <futex_wake>
+ 609:	83 c4 10             	add    $0x10,%esp
+}
+ 60c:	c9                   	leave
+ 60d:	c3                   	ret
+ 60e:	66 90                	xchg   %ax,%ax
+
+00000610 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 613:	8b 45 08             	mov    0x8(%ebp),%eax
+ 616:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 61c:	5d                   	pop    %ebp
+ 61d:	c3                   	ret
+ 61e:	66 90                	xchg   %ax,%ax
+
+00000620 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	57                   	push   %edi
+ 624:	56                   	push   %esi
+ 625:	53                   	push   %ebx
+ 626:	83 ec 0c             	sub    $0xc,%esp
+ 629:	8b 75 08             	mov    0x8(%ebp),%esi
+ 62c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 62f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 631:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 635:	75 21                	jne    658 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 637:	83 ec 08             	sub    $0x8,%esp
+ 63a:	57                   	push   %edi
+ 63b:	56                   	push   %esi
+ 63c:	e8 16 02 00 00       	call   857 <futex_wait>
+  mutex_lock(m);
+ 641:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 644:	83 c4 10             	add    $0x10,%esp
+}
+ 647:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 64a:	5b                   	pop    %ebx
+ 64b:	5e                   	pop    %esi
+ 64c:	5f                   	pop    %edi
+ 64d:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 64e:	e9 3d ff ff ff       	jmp    590 <mutex_lock>
+ 653:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 657:	90                   	nop
+    futex_wake(&m->v, 1);
+ 658:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 65b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 661:	6a 01                	push   $0x1
+ 663:	53                   	push   %ebx
+ 664:	e8 f9 01 00 00       	call   862 <futex_wake>
+ 669:	83 c4 10             	add    $0x10,%esp
+ 66c:	eb c9                	jmp    637 <cond_wait+0x17>
+ 66e:	66 90                	xchg   %ax,%ax
+
+00000670 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 670:	55                   	push   %ebp
+ 671:	89 e5                	mov    %esp,%ebp
+ 673:	83 ec 10             	sub    $0x10,%esp
+ 676:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 679:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 67d:	6a 01                	push   $0x1
+ 67f:	50                   	push   %eax
+ 680:	e8 dd 01 00 00       	call   862 <futex_wake>
+}
+ 685:	83 c4 10             	add    $0x10,%esp
+ 688:	c9                   	leave
+ 689:	c3                   	ret
+ 68a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000690 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 690:	55                   	push   %ebp
+ 691:	89 e5                	mov    %esp,%ebp
+ 693:	83 ec 10             	sub    $0x10,%esp
+ 696:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 699:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 69d:	68 ff ff ff 7f       	push   $0x7fffffff
+ 6a2:	50                   	push   %eax
+ 6a3:	e8 ba 01 00 00       	call   862 <futex_wake>
+}
+ 6a8:	83 c4 10             	add    $0x10,%esp
+ 6ab:	c9                   	leave
+ 6ac:	c3                   	ret
+
+000006ad <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 6ad:	50                   	push   %eax
+  pushl %ebx
+ 6ae:	53                   	push   %ebx
+  movl $1, %eax
+ 6af:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 6b4:	0f a2                	cpuid
+  popl %ebx
+ 6b6:	5b                   	pop    %ebx
+  popl %eax
+ 6b7:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 6b8:	c7 05 cc 11 00 00 de 	movl   $0x6de,0x11cc
+ 6bf:	06 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 6c2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 6c8:	74 14                	je     6de <sysint>
+  movl $sysfast, syscallvec
+ 6ca:	c7 05 cc 11 00 00 d4 	movl   $0x6d4,0x11cc
+ 6d1:	06 00 00 
+
+000006d4 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 6d4:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 6d6:	ba dd 06 00 00       	mov    $0x6dd,%edx
+  sysenter
+ 6db:	0f 34                	sysenter
+1:
+  ret
+ 6dd:	c3                   	ret
+
+000006de <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 6de:	cd 40                	int    $0x40
+  ret
+ 6e0:	c3                   	ret
+
+000006e1 <fork>:
+
+SYSCALL(fork)
+ 6e1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6e6:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+000006ec <exit>:
+SYSCALL(exit)
+ 6ec:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6f1:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+000006f7 <wait>:
+SYSCALL(wait)
+ 6f7:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6fc:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+00000702 <pipe>:
+SYSCALL(pipe)
+ 702:	b8 04 00 00 00       	mov    $0x4,%eax
+ 707:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+0000070d <read>:
+SYSCALL(read)
+ 70d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 712:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+00000718 <write>:
+SYSCALL(write)
+ 718:	b8 10 00 00 00       	mov    $0x10,%eax
+ 71d:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+00000723 <close>:
+SYSCALL(close)
+ 723:	b8 15 00 00 00       	mov    $0x15,%eax
+ 728:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+0000072e <kill>:
+SYSCALL(kill)
+ 72e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 733:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+00000739 <exec>:
+SYSCALL(exec)
+ 739:	b8 07 00 00 00       	mov    $0x7,%eax
+ 73e:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+00000744 <open>:
+SYSCALL(open)
+ 744:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 749:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+0000074f <mknod>:
+SYSCALL(mknod)
+ 74f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 754:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+0000075a <unlink>:
+SYSCALL(unlink)
+ 75a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 75f:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+00000765 <fstat>:
+SYSCALL(fstat)
+ 765:	b8 08 00 00 00       	mov    $0x8,%eax
+ 76a:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+00000770 <link>:
+SYSCALL(link)
+ 770:	b8 13 00 00 00       	mov    $0x13,%eax
+ 775:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+0000077b <mkdir>:
+SYSCALL(mkdir)
+ 77b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 780:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+00000786 <chdir>:
+SYSCALL(chdir)
+ 786:	b8 09 00 00 00       	mov    $0x9,%eax
+ 78b:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+00000791 <dup>:
+SYSCALL(dup)
+ 791:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 796:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+0000079c <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 79c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7a1:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+000007a7 <sbrk>:
+SYSCALL(sbrk)
+ 7a7:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7ac:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+000007b2 <sleep>:
+SYSCALL(sleep)
+ 7b2:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7b7:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+000007bd <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 7bd:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7c2:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+000007c8 <swapread>:
+SYSCALL(swapread)
+ 7c8:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7cd:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+000007d3 <swapwrite>:
+SYSCALL(swapwrite)
+ 7d3:	b8 17 00 00 00       	mov    $0x17,%eax
+ 7d8:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+000007de <swapstat>:
+SYSCALL(swapstat)
+ 7de:	b8 18 00 00 00       	mov    $0x18,%eax
+ 7e3:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+000007e9 <madvise>:
+SYSCALL(madvise)
+ 7e9:	b8 19 00 00 00       	mov    $0x19,%eax
+ 7ee:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+000007f4 <mlock>:
+SYSCALL(mlock)
+ 7f4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7f9:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+000007ff <munlock>:
+SYSCALL(munlock)
+ 7ff:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 804:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+0000080a <membench>:
+SYSCALL(membench)
+ 80a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 80f:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+00000815 <nice>:
+SYSCALL(nice)
+ 815:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 81a:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+00000820 <setpriority>:
+SYSCALL(setpriority)
+ 820:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 825:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+0000082b <usleep>:
+SYSCALL(usleep)
+ 82b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 830:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+00000836 <cpustat>:
+SYSCALL(cpustat)
+ 836:	b8 20 00 00 00       	mov    $0x20,%eax
+ 83b:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+00000841 <clone>:
+SYSCALL(clone)
+ 841:	b8 21 00 00 00       	mov    $0x21,%eax
+ 846:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+0000084c <join>:
+SYSCALL(join)
+ 84c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 851:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+00000857 <futex_wait>:
+SYSCALL(futex_wait)
+ 857:	b8 23 00 00 00       	mov    $0x23,%eax
+ 85c:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+00000862 <futex_wake>:
+SYSCALL(futex_wake)
+ 862:	b8 24 00 00 00       	mov    $0x24,%eax
+ 867:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+0000086d <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 86d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 872:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+00000878 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 878:	b8 26 00 00 00       	mov    $0x26,%eax
+ 87d:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+00000883 <getcpu>:
+SYSCALL(getcpu)
+ 883:	b8 27 00 00 00       	mov    $0x27,%eax
+ 888:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+0000088e <migrations>:
+SYSCALL(migrations)
+ 88e:	b8 28 00 00 00       	mov    $0x28,%eax
+ 893:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+00000899 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 899:	b8 29 00 00 00       	mov    $0x29,%eax
+ 89e:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+000008a4 <lockstat>:
+SYSCALL(lockstat)
+ 8a4:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 8a9:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+000008af <lockprof>:
+SYSCALL(lockprof)
+ 8af:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 8b4:	ff 25 cc 11 00 00    	jmp    *0x11cc
+
+000008ba <bcachestat>:
+SYSCALL(bcachestat)
+ 8ba:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 8bf:	ff 25 cc 11 00 00    	jmp    *0x11cc
+ 8c5:	66 90                	xchg   %ax,%ax
+ 8c7:	66 90                	xchg   %ax,%ax
+ 8c9:	66 90                	xchg   %ax,%ax
+ 8cb:	66 90                	xchg   %ax,%ax
+ 8cd:	66 90                	xchg   %ax,%ax
+ 8cf:	90                   	nop
+
+000008d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8d0:	55                   	push   %ebp
+ 8d1:	89 e5                	mov    %esp,%ebp
+ 8d3:	57                   	push   %edi
+ 8d4:	56                   	push   %esi
+ 8d5:	53                   	push   %ebx
+ 8d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 8d8:	89 d1                	mov    %edx,%ecx
+{
+ 8da:	83 ec 3c             	sub    $0x3c,%esp
+ 8dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 8e0:	85 d2                	test   %edx,%edx
+ 8e2:	0f 89 80 00 00 00    	jns    968 <printint+0x98>
+ 8e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 8ec:	74 7a                	je     968 <printint+0x98>
+    x = -xx;
+ 8ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 8f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 8f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 8f8:	31 f6                	xor    %esi,%esi
+ 8fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 900:	89 c8                	mov    %ecx,%eax
+ 902:	31 d2                	xor    %edx,%edx
+ 904:	89 f7                	mov    %esi,%edi
+ 906:	f7 f3                	div    %ebx
+ 908:	8d 76 01             	lea    0x1(%esi),%esi
+ 90b:	0f b6 92 a8 0d 00 00 	movzbl 0xda8(%edx),%edx
+ 912:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 916:	89 ca                	mov    %ecx,%edx
+ 918:	89 c1                	mov    %eax,%ecx
+ 91a:	39 da                	cmp    %ebx,%edx
+ 91c:	73 e2                	jae    900 <printint+0x30>
+  if(neg)
+ 91e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 921:	85 c0                	test   %eax,%eax
+ 923:	74 07                	je     92c <printint+0x5c>
+    buf[i++] = '-';
+ 925:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 92a:	89 f7                	mov    %esi,%edi
+ 92c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 92f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 932:	01 df                	add    %ebx,%edi
+ 934:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 938:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 93b:	83 ec 04             	sub    $0x4,%esp
+ 93e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 941:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 944:	6a 01                	push   $0x1
+ 946:	50                   	push   %eax
+ 947:	56                   	push   %esi
+ 948:	e8 cb fd ff ff       	call   718 <write>
+  while(--i >= 0)
+ 94d:	89 f8                	mov    %edi,%eax
+ 94f:	83 c4 10             	add    $0x10,%esp
+ 952:	83 ef 01             	sub    $0x1,%edi
+ 955:	39 d8                	cmp    %ebx,%eax
+ 957:	75 df                	jne    938 <printint+0x68>
+}
+ 959:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 95c:	5b                   	pop    %ebx
+ 95d:	5e                   	pop    %esi
+ 95e:	5f                   	pop    %edi
+ 95f:	5d                   	pop    %ebp
+ 960:	c3                   	ret
+ 961:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 968:	31 c0                	xor    %eax,%eax
+ 96a:	eb 89                	jmp    8f5 <printint+0x25>
+ 96c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000970 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 970:	55                   	push   %ebp
+ 971:	89 e5                	mov    %esp,%ebp
+ 973:	57                   	push   %edi
+ 974:	56                   	push   %esi
+ 975:	53                   	push   %ebx
+ 976:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 979:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 97c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 97f:	0f b6 1e             	movzbl (%esi),%ebx
+ 982:	83 c6 01             	add    $0x1,%esi
+ 985:	84 db                	test   %bl,%bl
+ 987:	74 67                	je     9f0 <printf+0x80>
+ 989:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 98c:	31 d2                	xor    %edx,%edx
+ 98e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 991:	eb 34                	jmp    9c7 <printf+0x57>
+ 993:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 997:	90                   	nop
+ 998:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 99b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 9a0:	83 f8 25             	cmp    $0x25,%eax
+ 9a3:	74 18                	je     9bd <printf+0x4d>
+  write(fd, &c, 1);
+ 9a5:	83 ec 04             	sub    $0x4,%esp
+ 9a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 9ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9ae:	6a 01                	push   $0x1
+ 9b0:	50                   	push   %eax
+ 9b1:	57                   	push   %edi
+ 9b2:	e8 61 fd ff ff       	call   718 <write>
+ 9b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 9ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 9bd:	0f b6 1e             	movzbl (%esi),%ebx
+ 9c0:	83 c6 01             	add    $0x1,%esi
+ 9c3:	84 db                	test   %bl,%bl
+ 9c5:	74 29                	je     9f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 9c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 9ca:	85 d2                	test   %edx,%edx
+ 9cc:	74 ca                	je     998 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 9ce:	83 fa 25             	cmp    $0x25,%edx
+ 9d1:	75 ea                	jne    9bd <printf+0x4d>
+      if(c == 'd'){
+ 9d3:	83 f8 25             	cmp    $0x25,%eax
+ 9d6:	0f 84 24 01 00 00    	je     b00 <printf+0x190>
+ 9dc:	83 e8 63             	sub    $0x63,%eax
+ 9df:	83 f8 15             	cmp    $0x15,%eax
+ 9e2:	77 1c                	ja     a00 <printf+0x90>
+ 9e4:	ff 24 85 50 0d 00 00 	jmp    *0xd50(,%eax,4)
+ 9eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 9f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9f3:	5b                   	pop    %ebx
+ 9f4:	5e                   	pop    %esi
+ 9f5:	5f                   	pop    %edi
+ 9f6:	5d                   	pop    %ebp
+ 9f7:	c3                   	ret
+ 9f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ff:	90                   	nop
+  write(fd, &c, 1);
+ a00:	83 ec 04             	sub    $0x4,%esp
+ a03:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a06:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ a0a:	6a 01                	push   $0x1
+ a0c:	52                   	push   %edx
+ a0d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ a10:	57                   	push   %edi
+ a11:	e8 02 fd ff ff       	call   718 <write>
+ a16:	83 c4 0c             	add    $0xc,%esp
+ a19:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a1c:	6a 01                	push   $0x1
+ a1e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ a21:	52                   	push   %edx
+ a22:	57                   	push   %edi
+ a23:	e8 f0 fc ff ff       	call   718 <write>
+        putc(fd, c);
+ a28:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a2b:	31 d2                	xor    %edx,%edx
+ a2d:	eb 8e                	jmp    9bd <printf+0x4d>
+ a2f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ a30:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a33:	83 ec 0c             	sub    $0xc,%esp
+ a36:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a3b:	8b 13                	mov    (%ebx),%edx
+ a3d:	6a 00                	push   $0x0
+ a3f:	89 f8                	mov    %edi,%eax
+        ap++;
+ a41:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ a44:	e8 87 fe ff ff       	call   8d0 <printint>
+        ap++;
+ a49:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a4c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a4f:	31 d2                	xor    %edx,%edx
+ a51:	e9 67 ff ff ff       	jmp    9bd <printf+0x4d>
+ a56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a5d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a60:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a63:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a65:	83 c0 04             	add    $0x4,%eax
+ a68:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a6b:	85 db                	test   %ebx,%ebx
+ a6d:	0f 84 9d 00 00 00    	je     b10 <printf+0x1a0>
+        while(*s != 0){
+ a73:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a76:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a78:	84 c0                	test   %al,%al
+ a7a:	0f 84 3d ff ff ff    	je     9bd <printf+0x4d>
+ a80:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a83:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a86:	89 de                	mov    %ebx,%esi
+ a88:	89 d3                	mov    %edx,%ebx
+ a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a90:	83 ec 04             	sub    $0x4,%esp
+ a93:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a96:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a99:	6a 01                	push   $0x1
+ a9b:	53                   	push   %ebx
+ a9c:	57                   	push   %edi
+ a9d:	e8 76 fc ff ff       	call   718 <write>
+        while(*s != 0){
+ aa2:	0f b6 06             	movzbl (%esi),%eax
+ aa5:	83 c4 10             	add    $0x10,%esp
+ aa8:	84 c0                	test   %al,%al
+ aaa:	75 e4                	jne    a90 <printf+0x120>
+      state = 0;
+ aac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ aaf:	31 d2                	xor    %edx,%edx
+ ab1:	e9 07 ff ff ff       	jmp    9bd <printf+0x4d>
+ ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ ac0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ ac3:	83 ec 0c             	sub    $0xc,%esp
+ ac6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ acb:	8b 13                	mov    (%ebx),%edx
+ acd:	6a 01                	push   $0x1
+ acf:	e9 6b ff ff ff       	jmp    a3f <printf+0xcf>
+ ad4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ ad8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ adb:	83 ec 04             	sub    $0x4,%esp
+ ade:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ ae1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ ae3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ ae6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ ae9:	6a 01                	push   $0x1
+ aeb:	52                   	push   %edx
+ aec:	57                   	push   %edi
+ aed:	e8 26 fc ff ff       	call   718 <write>
+        ap++;
+ af2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ af5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ af8:	31 d2                	xor    %edx,%edx
+ afa:	e9 be fe ff ff       	jmp    9bd <printf+0x4d>
+ aff:	90                   	nop
+  write(fd, &c, 1);
+ b00:	83 ec 04             	sub    $0x4,%esp
+ b03:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b06:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b09:	6a 01                	push   $0x1
+ b0b:	e9 11 ff ff ff       	jmp    a21 <printf+0xb1>
+ b10:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ b15:	bb 46 0d 00 00       	mov    $0xd46,%ebx
+ b1a:	e9 61 ff ff ff       	jmp    a80 <printf+0x110>
+ b1f:	90                   	nop
+
+00000b20 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b20:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b21:	a1 20 12 00 00       	mov    0x1220,%eax
+{
+ b26:	89 e5                	mov    %esp,%ebp
+ b28:	57                   	push   %edi
+ b29:	56                   	push   %esi
+ b2a:	53                   	push   %ebx
+ b2b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ b2e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b38:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b3a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b3c:	39 ca                	cmp    %ecx,%edx
+ b3e:	73 30                	jae    b70 <free+0x50>
+ b40:	39 c1                	cmp    %eax,%ecx
+ b42:	72 04                	jb     b48 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b44:	39 c2                	cmp    %eax,%edx
+ b46:	72 f0                	jb     b38 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b48:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ b4b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ b4e:	39 f8                	cmp    %edi,%eax
+ b50:	74 2e                	je     b80 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b52:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ b55:	8b 42 04             	mov    0x4(%edx),%eax
+ b58:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b5b:	39 f1                	cmp    %esi,%ecx
+ b5d:	74 38                	je     b97 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b5f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b61:	5b                   	pop    %ebx
+  freep = p;
+ b62:	89 15 20 12 00 00    	mov    %edx,0x1220
+}
+ b68:	5e                   	pop    %esi
+ b69:	5f                   	pop    %edi
+ b6a:	5d                   	pop    %ebp
+ b6b:	c3                   	ret
+ b6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b70:	39 c1                	cmp    %eax,%ecx
+ b72:	72 d0                	jb     b44 <free+0x24>
+ b74:	eb c2                	jmp    b38 <free+0x18>
+ b76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b7d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ b80:	03 70 04             	add    0x4(%eax),%esi
+ b83:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b86:	8b 02                	mov    (%edx),%eax
+ b88:	8b 00                	mov    (%eax),%eax
+ b8a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ b8d:	8b 42 04             	mov    0x4(%edx),%eax
+ b90:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b93:	39 f1                	cmp    %esi,%ecx
+ b95:	75 c8                	jne    b5f <free+0x3f>
+    p->s.size += bp->s.size;
+ b97:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ b9a:	89 15 20 12 00 00    	mov    %edx,0x1220
+    p->s.size += bp->s.size;
+ ba0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ba3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ ba6:	89 0a                	mov    %ecx,(%edx)
+}
+ ba8:	5b                   	pop    %ebx
+ ba9:	5e                   	pop    %esi
+ baa:	5f                   	pop    %edi
+ bab:	5d                   	pop    %ebp
+ bac:	c3                   	ret
+ bad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000bb0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ bb0:	55                   	push   %ebp
+ bb1:	89 e5                	mov    %esp,%ebp
+ bb3:	57                   	push   %edi
+ bb4:	56                   	push   %esi
+ bb5:	53                   	push   %ebx
+ bb6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ bbc:	8b 15 20 12 00 00    	mov    0x1220,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bc2:	8d 78 07             	lea    0x7(%eax),%edi
+ bc5:	c1 ef 03             	shr    $0x3,%edi
+ bc8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ bcb:	85 d2                	test   %edx,%edx
+ bcd:	0f 84 8d 00 00 00    	je     c60 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bd3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ bd5:	8b 48 04             	mov    0x4(%eax),%ecx
+ bd8:	39 f9                	cmp    %edi,%ecx
+ bda:	73 64                	jae    c40 <malloc+0x90>
+  if(nu < 4096)
+ bdc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ be1:	39 df                	cmp    %ebx,%edi
+ be3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ be6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ bed:	eb 0a                	jmp    bf9 <malloc+0x49>
+ bef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bf0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ bf2:	8b 48 04             	mov    0x4(%eax),%ecx
+ bf5:	39 f9                	cmp    %edi,%ecx
+ bf7:	73 47                	jae    c40 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ bf9:	89 c2                	mov    %eax,%edx
+ bfb:	39 05 20 12 00 00    	cmp    %eax,0x1220
+ c01:	75 ed                	jne    bf0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ c03:	83 ec 0c             	sub    $0xc,%esp
+ c06:	56                   	push   %esi
+ c07:	e8 9b fb ff ff       	call   7a7 <sbrk>
+  if(p == (char*)-1)
+ c0c:	83 c4 10             	add    $0x10,%esp
+ c0f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c12:	74 1c                	je     c30 <malloc+0x80>
+  hp->s.size = nu;
+ c14:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ c17:	83 ec 0c             	sub    $0xc,%esp
+ c1a:	83 c0 08             	add    $0x8,%eax
+ c1d:	50                   	push   %eax
+ c1e:	e8 fd fe ff ff       	call   b20 <free>
+  return freep;
+ c23:	8b 15 20 12 00 00    	mov    0x1220,%edx
+      if((p = morecore(nunits)) == 0)
+ c29:	83 c4 10             	add    $0x10,%esp
+ c2c:	85 d2                	test   %edx,%edx
+ c2e:	75 c0                	jne    bf0 <malloc+0x40>
+        return 0;
+  }
+}
+ c30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ c33:	31 c0                	xor    %eax,%eax
+}
+ c35:	5b                   	pop    %ebx
+ c36:	5e                   	pop    %esi
+ c37:	5f                   	pop    %edi
+ c38:	5d                   	pop    %ebp
+ c39:	c3                   	ret
+ c3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ c40:	39 cf                	cmp    %ecx,%edi
+ c42:	74 4c                	je     c90 <malloc+0xe0>
+        p->s.size -= nunits;
+ c44:	29 f9                	sub    %edi,%ecx
+ c46:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ c49:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ c4c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ c4f:	89 15 20 12 00 00    	mov    %edx,0x1220
+}
+ c55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ c58:	83 c0 08             	add    $0x8,%eax
+}
+ c5b:	5b                   	pop    %ebx
+ c5c:	5e                   	pop    %esi
+ c5d:	5f                   	pop    %edi
+ c5e:	5d                   	pop    %ebp
+ c5f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ c60:	c7 05 20 12 00 00 24 	movl   $0x1224,0x1220
+ c67:	12 00 00 
+    base.s.size = 0;
+ c6a:	b8 24 12 00 00       	mov    $0x1224,%eax
+    base.s.ptr = freep = prevp = &base;
+ c6f:	c7 05 24 12 00 00 24 	movl   $0x1224,0x1224
+ c76:	12 00 00 
+    base.s.size = 0;
+ c79:	c7 05 28 12 00 00 00 	movl   $0x0,0x1228
+ c80:	00 00 00 
+    if(p->s.size >= nunits){
+ c83:	e9 54 ff ff ff       	jmp    bdc <malloc+0x2c>
+ c88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c8f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ c90:	8b 08                	mov    (%eax),%ecx
+ c92:	89 0a                	mov    %ecx,(%edx)
+ c94:	eb b9                	jmp    c4f <malloc+0x9f>
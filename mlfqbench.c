@@ -0,0 +1,95 @@
+// Interactive response time while CPU-bound jobs run.
+// An "interactive" child answers a byte sent over a pipe;
+// the parent sleeps a tick between requests, as a user at a
+// shell would, and times each answer.  This is done with no
+// load, with nhogs spinning processes, and with the spinning
+// processes niced to the lowest level.
+// usage: mlfqbench [nhogs [requests]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "x86.h"
+#include "param.h"
+
+#define NHOG 16
+
+int hogs[NHOG];
+
+void
+respond(int nreq, char *what)
+{
+  int a[2], b[2], i, pid;
+  uint t, sum, max;
+  char c;
+
+  if(pipe(a) < 0 || pipe(b) < 0){
+    printf(1, "mlfqbench: pipe failed\n");
+    exit();
+  }
+  if((pid = fork()) == 0){
+    close(a[1]);
+    close(b[0]);
+    while(read(a[0], &c, 1) == 1)
+      write(b[1], &c, 1);
+    exit();
+  }
+  close(a[0]);
+  close(b[1]);
+
+  sum = max = 0;
+  c = 0;
+  for(i = 0; i < nreq; i++){
+    sleep(1);
+    t = rdtsc();
+    write(a[1], &c, 1);
+    if(read(b[0], &c, 1) != 1){
+      printf(1, "mlfqbench: short read\n");
+      break;
+    }
+    t = rdtsc() - t;
+    sum += t / nreq;
+    if(t > max)
+      max = t;
+  }
+  close(a[1]);
+  close(b[0]);
+  wait();
+  printf(1, "%s: mean %d cycles, max %d cycles\n", what, sum, max);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, nhogs, nreq;
+
+  nhogs = 4;
+  nreq = 50;
+  if(argc > 1)
+    nhogs = atoi(argv[1]);
+  if(argc > 2)
+    nreq = atoi(argv[2]);
+  if(nhogs > NHOG)
+    nhogs = NHOG;
+
+  respond(nreq, "idle");
+
+  for(i = 0; i < nhogs; i++){
+    if((hogs[i] = fork()) == 0){
+      for(;;)
+        ;
+    }
+  }
+  respond(nreq, "with hogs");
+
+  for(i = 0; i < nhogs; i++)
+    if(setpriority(hogs[i], NPRIO-1) < 0)
+      printf(1, "mlfqbench: setpriority failed\n");
+  respond(nreq, "with niced hogs");
+
+  for(i = 0; i < nhogs; i++){
+    kill(hogs[i]);
+    wait();
+  }
+  exit();
+}
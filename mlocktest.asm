@@ -0,0 +1,1857 @@
+
+_mlocktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be f0 00 00 00       	mov    $0xf0,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  int i, mb, r0, w0, r1, w1;
+  uint sz;
+
+  mb = 240;
+  if(argc > 1)
+  19:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  1c:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1)
+  1f:	7e 10                	jle    31 <main+0x31>
+    mb = atoi(argv[1]);
+  21:	83 ec 0c             	sub    $0xc,%esp
+  24:	ff 70 04             	push   0x4(%eax)
+  27:	e8 54 04 00 00       	call   480 <atoi>
+  2c:	83 c4 10             	add    $0x10,%esp
+  2f:	89 c6                	mov    %eax,%esi
+
+  buf = sbrk(NLOCK * PGSIZE);
+  31:	83 ec 0c             	sub    $0xc,%esp
+  34:	68 00 00 04 00       	push   $0x40000
+  39:	e8 49 07 00 00       	call   787 <sbrk>
+  if(buf == (char*)-1){
+  3e:	83 c4 10             	add    $0x10,%esp
+  buf = sbrk(NLOCK * PGSIZE);
+  41:	a3 a8 12 00 00       	mov    %eax,0x12a8
+  if(buf == (char*)-1){
+  46:	83 f8 ff             	cmp    $0xffffffff,%eax
+  49:	0f 84 d1 00 00 00    	je     120 <main+0x120>
+    printf(1, "mlocktest: sbrk failed\n");
+    exit();
+  }
+  for(i = 0; i < NLOCK; i++)
+    buf[i*PGSIZE] = i;
+  4f:	c6 00 00             	movb   $0x0,(%eax)
+  for(i = 0; i < NLOCK; i++)
+  52:	b8 01 00 00 00       	mov    $0x1,%eax
+  57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5e:	66 90                	xchg   %ax,%ax
+    buf[i*PGSIZE] = i;
+  60:	89 c2                	mov    %eax,%edx
+  62:	c1 e2 0c             	shl    $0xc,%edx
+  65:	03 15 a8 12 00 00    	add    0x12a8,%edx
+  6b:	88 02                	mov    %al,(%edx)
+  for(i = 0; i < NLOCK; i++)
+  6d:	83 c0 01             	add    $0x1,%eax
+  70:	83 f8 40             	cmp    $0x40,%eax
+  73:	75 eb                	jne    60 <main+0x60>
+
+  // Pin the whole image: text, data, stack and buf.
+  sz = (uint)sbrk(0);
+  75:	83 ec 0c             	sub    $0xc,%esp
+  78:	6a 00                	push   $0x0
+  7a:	e8 08 07 00 00       	call   787 <sbrk>
+  if(mlock(0, sz) < 0){
+  7f:	5a                   	pop    %edx
+  80:	59                   	pop    %ecx
+  81:	50                   	push   %eax
+  sz = (uint)sbrk(0);
+  82:	89 c3                	mov    %eax,%ebx
+  if(mlock(0, sz) < 0){
+  84:	6a 00                	push   $0x0
+  86:	e8 49 07 00 00       	call   7d4 <mlock>
+  8b:	83 c4 10             	add    $0x10,%esp
+  8e:	85 c0                	test   %eax,%eax
+  90:	78 2a                	js     bc <main+0xbc>
+    printf(1, "mlocktest: mlock failed\n");
+    exit();
+  }
+  if(mlock(0, sz + PGSIZE) == 0){
+  92:	50                   	push   %eax
+  93:	50                   	push   %eax
+  94:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+  9a:	50                   	push   %eax
+  9b:	6a 00                	push   $0x0
+  9d:	e8 32 07 00 00       	call   7d4 <mlock>
+  a2:	83 c4 10             	add    $0x10,%esp
+  a5:	85 c0                	test   %eax,%eax
+  a7:	75 26                	jne    cf <main+0xcf>
+    printf(1, "mlocktest: mlock beyond sz succeeded\n");
+  a9:	50                   	push   %eax
+  aa:	50                   	push   %eax
+  ab:	68 fc 0c 00 00       	push   $0xcfc
+  b0:	6a 01                	push   $0x1
+  b2:	e8 99 08 00 00       	call   950 <printf>
+    exit();
+  b7:	e8 10 06 00 00       	call   6cc <exit>
+    printf(1, "mlocktest: mlock failed\n");
+  bc:	50                   	push   %eax
+  bd:	50                   	push   %eax
+  be:	68 90 0c 00 00       	push   $0xc90
+  c3:	6a 01                	push   $0x1
+  c5:	e8 86 08 00 00       	call   950 <printf>
+    exit();
+  ca:	e8 fd 05 00 00       	call   6cc <exit>
+  }
+  if(madvise(buf, PGSIZE, MADV_DONTNEED) == 0){
+  cf:	50                   	push   %eax
+  d0:	6a 04                	push   $0x4
+  d2:	68 00 10 00 00       	push   $0x1000
+  d7:	ff 35 a8 12 00 00    	push   0x12a8
+  dd:	e8 e7 06 00 00       	call   7c9 <madvise>
+  e2:	83 c4 10             	add    $0x10,%esp
+  e5:	85 c0                	test   %eax,%eax
+  e7:	74 24                	je     10d <main+0x10d>
+    printf(1, "mlocktest: MADV_DONTNEED on a locked page succeeded\n");
+    exit();
+  }
+
+  swapstat(&r0, &w0);
+  e9:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  ec:	57                   	push   %edi
+  ed:	57                   	push   %edi
+  ee:	8d 7d dc             	lea    -0x24(%ebp),%edi
+  f1:	57                   	push   %edi
+  f2:	50                   	push   %eax
+  f3:	e8 c6 06 00 00       	call   7be <swapstat>
+  if(fork() == 0)
+  f8:	e8 c4 05 00 00       	call   6c1 <fork>
+  fd:	83 c4 10             	add    $0x10,%esp
+ 100:	85 c0                	test   %eax,%eax
+ 102:	75 2f                	jne    133 <main+0x133>
+    pressure(mb);
+ 104:	83 ec 0c             	sub    $0xc,%esp
+ 107:	56                   	push   %esi
+ 108:	e8 13 01 00 00       	call   220 <pressure>
+    printf(1, "mlocktest: MADV_DONTNEED on a locked page succeeded\n");
+ 10d:	50                   	push   %eax
+ 10e:	50                   	push   %eax
+ 10f:	68 24 0d 00 00       	push   $0xd24
+ 114:	6a 01                	push   $0x1
+ 116:	e8 35 08 00 00       	call   950 <printf>
+    exit();
+ 11b:	e8 ac 05 00 00       	call   6cc <exit>
+    printf(1, "mlocktest: sbrk failed\n");
+ 120:	53                   	push   %ebx
+ 121:	53                   	push   %ebx
+ 122:	68 78 0c 00 00       	push   $0xc78
+ 127:	6a 01                	push   $0x1
+ 129:	e8 22 08 00 00       	call   950 <printf>
+    exit();
+ 12e:	e8 99 05 00 00       	call   6cc <exit>
+  wait();
+ 133:	e8 9f 05 00 00       	call   6d7 <wait>
+  swapstat(&r1, &w1);
+ 138:	8d 45 e0             	lea    -0x20(%ebp),%eax
+ 13b:	56                   	push   %esi
+ 13c:	56                   	push   %esi
+ 13d:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+ 140:	56                   	push   %esi
+ 141:	50                   	push   %eax
+ 142:	e8 77 06 00 00       	call   7be <swapstat>
+  if(w1 == w0)
+ 147:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 14a:	83 c4 10             	add    $0x10,%esp
+ 14d:	3b 45 dc             	cmp    -0x24(%ebp),%eax
+ 150:	74 53                	je     1a5 <main+0x1a5>
+    printf(1, "mlocktest: warning: no swap traffic, try more megabytes\n");
+  printf(1, "mlocktest: child wrote %d sectors to swap\n", w1 - w0);
+ 152:	51                   	push   %ecx
+ 153:	2b 45 dc             	sub    -0x24(%ebp),%eax
+ 156:	50                   	push   %eax
+ 157:	68 98 0d 00 00       	push   $0xd98
+ 15c:	6a 01                	push   $0x1
+ 15e:	e8 ed 07 00 00       	call   950 <printf>
+
+  // Everything we touch from here on is locked, so nothing
+  // may come back in from swap.
+  swapstat(&r0, &w0);
+ 163:	58                   	pop    %eax
+ 164:	8d 45 d8             	lea    -0x28(%ebp),%eax
+ 167:	5a                   	pop    %edx
+ 168:	57                   	push   %edi
+ 169:	50                   	push   %eax
+ 16a:	e8 4f 06 00 00       	call   7be <swapstat>
+  for(i = 0; i < NLOCK; i++)
+    if(buf[i*PGSIZE] != (char)i){
+ 16f:	8b 0d a8 12 00 00    	mov    0x12a8,%ecx
+ 175:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NLOCK; i++)
+ 178:	31 c0                	xor    %eax,%eax
+ 17a:	eb 0c                	jmp    188 <main+0x188>
+ 17c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 180:	83 c0 01             	add    $0x1,%eax
+ 183:	83 f8 40             	cmp    $0x40,%eax
+ 186:	74 33                	je     1bb <main+0x1bb>
+    if(buf[i*PGSIZE] != (char)i){
+ 188:	89 c2                	mov    %eax,%edx
+ 18a:	c1 e2 0c             	shl    $0xc,%edx
+ 18d:	38 04 11             	cmp    %al,(%ecx,%edx,1)
+ 190:	74 ee                	je     180 <main+0x180>
+      printf(1, "mlocktest: locked page %d corrupted\n", i);
+ 192:	52                   	push   %edx
+ 193:	50                   	push   %eax
+ 194:	68 c4 0d 00 00       	push   $0xdc4
+ 199:	6a 01                	push   $0x1
+ 19b:	e8 b0 07 00 00       	call   950 <printf>
+      exit();
+ 1a0:	e8 27 05 00 00       	call   6cc <exit>
+    printf(1, "mlocktest: warning: no swap traffic, try more megabytes\n");
+ 1a5:	51                   	push   %ecx
+ 1a6:	51                   	push   %ecx
+ 1a7:	68 5c 0d 00 00       	push   $0xd5c
+ 1ac:	6a 01                	push   $0x1
+ 1ae:	e8 9d 07 00 00       	call   950 <printf>
+ 1b3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 1b6:	83 c4 10             	add    $0x10,%esp
+ 1b9:	eb 97                	jmp    152 <main+0x152>
+    }
+  swapstat(&r1, &w1);
+ 1bb:	8d 45 e0             	lea    -0x20(%ebp),%eax
+ 1be:	57                   	push   %edi
+ 1bf:	57                   	push   %edi
+ 1c0:	56                   	push   %esi
+ 1c1:	50                   	push   %eax
+ 1c2:	e8 f7 05 00 00       	call   7be <swapstat>
+  if(r1 != r0){
+ 1c7:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 1ca:	83 c4 10             	add    $0x10,%esp
+ 1cd:	39 45 e0             	cmp    %eax,-0x20(%ebp)
+ 1d0:	74 13                	je     1e5 <main+0x1e5>
+    printf(1, "mlocktest: locked pages were swapped out\n");
+ 1d2:	53                   	push   %ebx
+ 1d3:	53                   	push   %ebx
+ 1d4:	68 ec 0d 00 00       	push   $0xdec
+ 1d9:	6a 01                	push   $0x1
+ 1db:	e8 70 07 00 00       	call   950 <printf>
+    exit();
+ 1e0:	e8 e7 04 00 00       	call   6cc <exit>
+  }
+
+  if(munlock(0, sz) < 0){
+ 1e5:	51                   	push   %ecx
+ 1e6:	51                   	push   %ecx
+ 1e7:	53                   	push   %ebx
+ 1e8:	6a 00                	push   $0x0
+ 1ea:	e8 f0 05 00 00       	call   7df <munlock>
+ 1ef:	83 c4 10             	add    $0x10,%esp
+ 1f2:	85 c0                	test   %eax,%eax
+ 1f4:	78 13                	js     209 <main+0x209>
+    printf(1, "mlocktest: munlock failed\n");
+    exit();
+  }
+  printf(1, "mlocktest ok\n");
+ 1f6:	50                   	push   %eax
+ 1f7:	50                   	push   %eax
+ 1f8:	68 c4 0c 00 00       	push   $0xcc4
+ 1fd:	6a 01                	push   $0x1
+ 1ff:	e8 4c 07 00 00       	call   950 <printf>
+  exit();
+ 204:	e8 c3 04 00 00       	call   6cc <exit>
+    printf(1, "mlocktest: munlock failed\n");
+ 209:	52                   	push   %edx
+ 20a:	52                   	push   %edx
+ 20b:	68 a9 0c 00 00       	push   $0xca9
+ 210:	6a 01                	push   $0x1
+ 212:	e8 39 07 00 00       	call   950 <printf>
+    exit();
+ 217:	e8 b0 04 00 00       	call   6cc <exit>
+ 21c:	66 90                	xchg   %ax,%ax
+ 21e:	66 90                	xchg   %ax,%ax
+
+00000220 <pressure>:
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	53                   	push   %ebx
+ 224:	83 ec 10             	sub    $0x10,%esp
+ 227:	8b 45 08             	mov    0x8(%ebp),%eax
+  n = mb * (1024*1024 / PGSIZE);
+ 22a:	89 c3                	mov    %eax,%ebx
+  p = sbrk(n * PGSIZE);
+ 22c:	c1 e0 14             	shl    $0x14,%eax
+ 22f:	50                   	push   %eax
+  n = mb * (1024*1024 / PGSIZE);
+ 230:	c1 e3 08             	shl    $0x8,%ebx
+  p = sbrk(n * PGSIZE);
+ 233:	e8 4f 05 00 00       	call   787 <sbrk>
+  if(p == (char*)-1){
+ 238:	83 c4 10             	add    $0x10,%esp
+ 23b:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 23e:	74 51                	je     291 <pressure+0x71>
+  for(i = 0; i < n; i++)
+ 240:	31 d2                	xor    %edx,%edx
+ 242:	85 db                	test   %ebx,%ebx
+ 244:	7e 46                	jle    28c <pressure+0x6c>
+ 246:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24d:	8d 76 00             	lea    0x0(%esi),%esi
+    p[i*PGSIZE] = i;
+ 250:	89 d1                	mov    %edx,%ecx
+ 252:	c1 e1 0c             	shl    $0xc,%ecx
+ 255:	88 14 08             	mov    %dl,(%eax,%ecx,1)
+  for(i = 0; i < n; i++)
+ 258:	83 c2 01             	add    $0x1,%edx
+ 25b:	39 d3                	cmp    %edx,%ebx
+ 25d:	75 f1                	jne    250 <pressure+0x30>
+  for(i = 0; i < n; i++)
+ 25f:	31 d2                	xor    %edx,%edx
+ 261:	eb 0c                	jmp    26f <pressure+0x4f>
+ 263:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 267:	90                   	nop
+ 268:	83 c2 01             	add    $0x1,%edx
+ 26b:	39 d3                	cmp    %edx,%ebx
+ 26d:	74 1d                	je     28c <pressure+0x6c>
+    if(p[i*PGSIZE] != (char)i){
+ 26f:	89 d1                	mov    %edx,%ecx
+ 271:	c1 e1 0c             	shl    $0xc,%ecx
+ 274:	38 14 08             	cmp    %dl,(%eax,%ecx,1)
+ 277:	74 ef                	je     268 <pressure+0x48>
+      printf(1, "mlocktest: pressure page %d corrupted\n", i);
+ 279:	50                   	push   %eax
+ 27a:	52                   	push   %edx
+ 27b:	68 d4 0c 00 00       	push   $0xcd4
+ 280:	6a 01                	push   $0x1
+ 282:	e8 c9 06 00 00       	call   950 <printf>
+      exit();
+ 287:	e8 40 04 00 00       	call   6cc <exit>
+  exit();
+ 28c:	e8 3b 04 00 00       	call   6cc <exit>
+    printf(1, "mlocktest: sbrk failed\n");
+ 291:	52                   	push   %edx
+ 292:	52                   	push   %edx
+ 293:	68 78 0c 00 00       	push   $0xc78
+ 298:	6a 01                	push   $0x1
+ 29a:	e8 b1 06 00 00       	call   950 <printf>
+    exit();
+ 29f:	e8 28 04 00 00       	call   6cc <exit>
+ 2a4:	66 90                	xchg   %ax,%ax
+ 2a6:	66 90                	xchg   %ax,%ax
+ 2a8:	66 90                	xchg   %ax,%ax
+ 2aa:	66 90                	xchg   %ax,%ax
+ 2ac:	66 90                	xchg   %ax,%ax
+ 2ae:	66 90                	xchg   %ax,%ax
+
+000002b0 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 2b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2b1:	31 c0                	xor    %eax,%eax
+{
+ 2b3:	89 e5                	mov    %esp,%ebp
+ 2b5:	53                   	push   %ebx
+ 2b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 2c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 2c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 2c7:	83 c0 01             	add    $0x1,%eax
+ 2ca:	84 d2                	test   %dl,%dl
+ 2cc:	75 f2                	jne    2c0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 2ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2d1:	89 c8                	mov    %ecx,%eax
+ 2d3:	c9                   	leave
+ 2d4:	c3                   	ret
+ 2d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	53                   	push   %ebx
+ 2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2ea:	0f b6 02             	movzbl (%edx),%eax
+ 2ed:	84 c0                	test   %al,%al
+ 2ef:	75 17                	jne    308 <strcmp+0x28>
+ 2f1:	eb 3a                	jmp    32d <strcmp+0x4d>
+ 2f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2f7:	90                   	nop
+ 2f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2fc:	83 c2 01             	add    $0x1,%edx
+ 2ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 302:	84 c0                	test   %al,%al
+ 304:	74 1a                	je     320 <strcmp+0x40>
+    p++, q++;
+ 306:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 308:	0f b6 19             	movzbl (%ecx),%ebx
+ 30b:	38 c3                	cmp    %al,%bl
+ 30d:	74 e9                	je     2f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 30f:	29 d8                	sub    %ebx,%eax
+}
+ 311:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 314:	c9                   	leave
+ 315:	c3                   	ret
+ 316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 320:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 324:	31 c0                	xor    %eax,%eax
+ 326:	29 d8                	sub    %ebx,%eax
+}
+ 328:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 32b:	c9                   	leave
+ 32c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 32d:	0f b6 19             	movzbl (%ecx),%ebx
+ 330:	31 c0                	xor    %eax,%eax
+ 332:	eb db                	jmp    30f <strcmp+0x2f>
+ 334:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 33f:	90                   	nop
+
+00000340 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 346:	80 3a 00             	cmpb   $0x0,(%edx)
+ 349:	74 15                	je     360 <strlen+0x20>
+ 34b:	31 c0                	xor    %eax,%eax
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+ 350:	83 c0 01             	add    $0x1,%eax
+ 353:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 357:	89 c1                	mov    %eax,%ecx
+ 359:	75 f5                	jne    350 <strlen+0x10>
+    ;
+  return n;
+}
+ 35b:	89 c8                	mov    %ecx,%eax
+ 35d:	5d                   	pop    %ebp
+ 35e:	c3                   	ret
+ 35f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 360:	31 c9                	xor    %ecx,%ecx
+}
+ 362:	5d                   	pop    %ebp
+ 363:	89 c8                	mov    %ecx,%eax
+ 365:	c3                   	ret
+ 366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000370 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	57                   	push   %edi
+ 374:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 377:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 37a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 37d:	89 d7                	mov    %edx,%edi
+ 37f:	fc                   	cld
+ 380:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 382:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 385:	89 d0                	mov    %edx,%eax
+ 387:	c9                   	leave
+ 388:	c3                   	ret
+ 389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	8b 45 08             	mov    0x8(%ebp),%eax
+ 396:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 39a:	0f b6 10             	movzbl (%eax),%edx
+ 39d:	84 d2                	test   %dl,%dl
+ 39f:	75 12                	jne    3b3 <strchr+0x23>
+ 3a1:	eb 1d                	jmp    3c0 <strchr+0x30>
+ 3a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3a7:	90                   	nop
+ 3a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3ac:	83 c0 01             	add    $0x1,%eax
+ 3af:	84 d2                	test   %dl,%dl
+ 3b1:	74 0d                	je     3c0 <strchr+0x30>
+    if(*s == c)
+ 3b3:	38 d1                	cmp    %dl,%cl
+ 3b5:	75 f1                	jne    3a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3b7:	5d                   	pop    %ebp
+ 3b8:	c3                   	ret
+ 3b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3c0:	31 c0                	xor    %eax,%eax
+}
+ 3c2:	5d                   	pop    %ebp
+ 3c3:	c3                   	ret
+ 3c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3cf:	90                   	nop
+
+000003d0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3d5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3d8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3d9:	31 db                	xor    %ebx,%ebx
+{
+ 3db:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3de:	eb 27                	jmp    407 <gets+0x37>
+    cc = read(0, &c, 1);
+ 3e0:	83 ec 04             	sub    $0x4,%esp
+ 3e3:	6a 01                	push   $0x1
+ 3e5:	56                   	push   %esi
+ 3e6:	6a 00                	push   $0x0
+ 3e8:	e8 00 03 00 00       	call   6ed <read>
+    if(cc < 1)
+ 3ed:	83 c4 10             	add    $0x10,%esp
+ 3f0:	85 c0                	test   %eax,%eax
+ 3f2:	7e 1d                	jle    411 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 3f4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3fb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 3ff:	3c 0a                	cmp    $0xa,%al
+ 401:	74 10                	je     413 <gets+0x43>
+ 403:	3c 0d                	cmp    $0xd,%al
+ 405:	74 0c                	je     413 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 407:	89 df                	mov    %ebx,%edi
+ 409:	83 c3 01             	add    $0x1,%ebx
+ 40c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 40f:	7c cf                	jl     3e0 <gets+0x10>
+ 411:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 413:	8b 45 08             	mov    0x8(%ebp),%eax
+ 416:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 41a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 41d:	5b                   	pop    %ebx
+ 41e:	5e                   	pop    %esi
+ 41f:	5f                   	pop    %edi
+ 420:	5d                   	pop    %ebp
+ 421:	c3                   	ret
+ 422:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 429:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	56                   	push   %esi
+ 434:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 435:	83 ec 08             	sub    $0x8,%esp
+ 438:	6a 00                	push   $0x0
+ 43a:	ff 75 08             	push   0x8(%ebp)
+ 43d:	e8 e2 02 00 00       	call   724 <open>
+  if(fd < 0)
+ 442:	83 c4 10             	add    $0x10,%esp
+ 445:	85 c0                	test   %eax,%eax
+ 447:	78 27                	js     470 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 449:	83 ec 08             	sub    $0x8,%esp
+ 44c:	ff 75 0c             	push   0xc(%ebp)
+ 44f:	89 c3                	mov    %eax,%ebx
+ 451:	50                   	push   %eax
+ 452:	e8 ee 02 00 00       	call   745 <fstat>
+  close(fd);
+ 457:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 45a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 45c:	e8 a2 02 00 00       	call   703 <close>
+  return r;
+ 461:	83 c4 10             	add    $0x10,%esp
+}
+ 464:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 467:	89 f0                	mov    %esi,%eax
+ 469:	5b                   	pop    %ebx
+ 46a:	5e                   	pop    %esi
+ 46b:	5d                   	pop    %ebp
+ 46c:	c3                   	ret
+ 46d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 470:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 475:	eb ed                	jmp    464 <stat+0x34>
+ 477:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47e:	66 90                	xchg   %ax,%ax
+
+00000480 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	53                   	push   %ebx
+ 484:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 487:	0f be 02             	movsbl (%edx),%eax
+ 48a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 48d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 490:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 495:	77 1e                	ja     4b5 <atoi+0x35>
+ 497:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4a0:	83 c2 01             	add    $0x1,%edx
+ 4a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 4a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 4aa:	0f be 02             	movsbl (%edx),%eax
+ 4ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 4b0:	80 fb 09             	cmp    $0x9,%bl
+ 4b3:	76 eb                	jbe    4a0 <atoi+0x20>
+  return n;
+}
+ 4b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4b8:	89 c8                	mov    %ecx,%eax
+ 4ba:	c9                   	leave
+ 4bb:	c3                   	ret
+ 4bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+ 4c5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4ce:	85 c0                	test   %eax,%eax
+ 4d0:	7e 13                	jle    4e5 <memmove+0x25>
+ 4d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4d4:	89 d7                	mov    %edx,%edi
+ 4d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4e1:	39 f8                	cmp    %edi,%eax
+ 4e3:	75 fb                	jne    4e0 <memmove+0x20>
+  return vdst;
+}
+ 4e5:	5e                   	pop    %esi
+ 4e6:	89 d0                	mov    %edx,%eax
+ 4e8:	5f                   	pop    %edi
+ 4e9:	5d                   	pop    %ebp
+ 4ea:	c3                   	ret
+ 4eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ef:	90                   	nop
+
+000004f0 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 4f0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 4f5:	85 c0                	test   %eax,%eax
+ 4f7:	74 07                	je     500 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 4f9:	c3                   	ret
+ 4fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 500:	e9 77 02 00 00       	jmp    77c <sysgetpid>
+ 505:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000510 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 510:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 515:	c3                   	ret
+ 516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000520 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 520:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 521:	31 d2                	xor    %edx,%edx
+ 523:	89 e5                	mov    %esp,%ebp
+ 525:	53                   	push   %ebx
+ 526:	83 ec 04             	sub    $0x4,%esp
+ 529:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 52c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 52f:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 532:	85 c9                	test   %ecx,%ecx
+ 534:	7e 08                	jle    53e <cyclereport+0x1e>
+ 536:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 538:	89 d8                	mov    %ebx,%eax
+ 53a:	f7 f1                	div    %ecx
+ 53c:	89 c2                	mov    %eax,%edx
+ 53e:	83 ec 08             	sub    $0x8,%esp
+ 541:	52                   	push   %edx
+ 542:	ff 75 0c             	push   0xc(%ebp)
+ 545:	51                   	push   %ecx
+ 546:	ff 75 08             	push   0x8(%ebp)
+ 549:	68 16 0e 00 00       	push   $0xe16
+ 54e:	6a 01                	push   $0x1
+ 550:	e8 fb 03 00 00       	call   950 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 555:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 558:	83 c4 20             	add    $0x20,%esp
+ 55b:	c9                   	leave
+ 55c:	c3                   	ret
+ 55d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000560 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 563:	8b 45 08             	mov    0x8(%ebp),%eax
+ 566:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 56c:	5d                   	pop    %ebp
+ 56d:	c3                   	ret
+ 56e:	66 90                	xchg   %ax,%ax
+
+00000570 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 570:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 571:	31 c0                	xor    %eax,%eax
+ 573:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 578:	89 e5                	mov    %esp,%ebp
+ 57a:	56                   	push   %esi
+ 57b:	53                   	push   %ebx
+ 57c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 57f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 583:	85 c0                	test   %eax,%eax
+ 585:	74 30                	je     5b7 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 587:	83 f8 02             	cmp    $0x2,%eax
+ 58a:	74 0c                	je     598 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 58c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 591:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 594:	85 c0                	test   %eax,%eax
+ 596:	74 1f                	je     5b7 <mutex_lock+0x47>
+ 598:	be 02 00 00 00       	mov    $0x2,%esi
+ 59d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 5a0:	83 ec 08             	sub    $0x8,%esp
+ 5a3:	6a 02                	push   $0x2
+ 5a5:	53                   	push   %ebx
+ 5a6:	e8 8c 02 00 00       	call   837 <futex_wait>
+ 5ab:	89 f0                	mov    %esi,%eax
+ 5ad:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 5b0:	83 c4 10             	add    $0x10,%esp
+ 5b3:	85 c0                	test   %eax,%eax
+ 5b5:	75 e9                	jne    5a0 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 5b7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 5ba:	5b                   	pop    %ebx
+ 5bb:	5e                   	pop    %esi
+ 5bc:	5d                   	pop    %ebp
+ 5bd:	c3                   	ret
+ 5be:	66 90                	xchg   %ax,%ax
+
+000005c0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	83 ec 08             	sub    $0x8,%esp
+ 5c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 5c9:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 5cd:	75 09                	jne    5d8 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 5cf:	c9                   	leave
+ 5d0:	c3                   	ret
+ 5d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 5d8:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 5db:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 5e1:	6a 01                	push   $0x1
+ 5e3:	50                   	push   %eax
+ 5e4:	e8 59 02 00 00       	call   842 <futex_wake>
+ 5e9:	83 c4 10             	add    $0x10,%esp
+}
+ 5ec:	c9                   	leave
+ 5ed:	c3                   	ret
+ 5ee:	66 90                	xchg   %ax,%ax
+
+000005f0 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 5f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 5fc:	5d                   	pop    %ebp
+ 5fd:	c3                   	ret
+ 5fe:	66 90                	xchg   %ax,%ax
+
+00000600 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+ 603:	57                   	push   %edi
+ 604:	56                   	push   %esi
+ 605:	53                   	push   %ebx
+ 606:	83 ec 0c             	sub    $0xc,%esp
+ 609:	8b 75 08             	mov    0x8(%ebp),%esi
+ 60c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 60f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 611:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 615:	75 21                	jne    638 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 617:	83 ec 08             	sub    $0x8,%esp
+ 61a:	57                   	push   %edi
+ 61b:	56                   	push   %esi
+ 61c:	e8 16 02 00 00       	call   837 <futex_wait>
+  mutex_lock(m);
+ 621:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 624:	83 c4 10             	add    $0x10,%esp
+}
+ 627:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 62a:	5b                   	pop    %ebx
+ 62b:	5e                   	pop    %esi
+ 62c:	5f                   	pop    %edi
+ 62d:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 62e:	e9 3d ff ff ff       	jmp    570 <mutex_lock>
+ 633:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 637:	90                   	nop
+    futex_wake(&m->v, 1);
+ 638:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 63b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 641:	6a 01                	push   $0x1
+ 643:	53                   	push   %ebx
+ 644:	e8 f9 01 00 00       	call   842 <futex_wake>
+ 649:	83 c4 10             	add    $0x10,%esp
+ 64c:	eb c9                	jmp    617 <cond_wait+0x17>
+ 64e:	66 90                	xchg   %ax,%ax
+
+00000650 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	83 ec 10             	sub    $0x10,%esp
+ 656:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 659:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 65d:	6a 01                	push   $0x1
+ 65f:	50                   	push   %eax
+ 660:	e8 dd 01 00 00       	call   842 <futex_wake>
+}
+ 665:	83 c4 10             	add    $0x10,%esp
+ 668:	c9                   	leave
+ 669:	c3                   	ret
+ 66a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000670 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 670:	55                   	push   %ebp
+ 671:	89 e5                	mov    %esp,%ebp
+ 673:	83 ec 10             	sub    $0x10,%esp
+ 676:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 679:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 67d:	68 ff ff ff 7f       	push   $0x7fffffff
+ 682:	50                   	push   %eax
+ 683:	e8 ba 01 00 00       	call   842 <futex_wake>
+}
+ 688:	83 c4 10             	add    $0x10,%esp
+ 68b:	c9                   	leave
+ 68c:	c3                   	ret
+
+0000068d <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 68d:	50                   	push   %eax
+  pushl %ebx
+ 68e:	53                   	push   %ebx
+  movl $1, %eax
+ 68f:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 694:	0f a2                	cpuid
+  popl %ebx
+ 696:	5b                   	pop    %ebx
+  popl %eax
+ 697:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 698:	c7 05 a4 12 00 00 be 	movl   $0x6be,0x12a4
+ 69f:	06 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 6a2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 6a8:	74 14                	je     6be <sysint>
+  movl $sysfast, syscallvec
+ 6aa:	c7 05 a4 12 00 00 b4 	movl   $0x6b4,0x12a4
+ 6b1:	06 00 00 
+
+000006b4 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 6b4:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 6b6:	ba bd 06 00 00       	mov    $0x6bd,%edx
+  sysenter
+ 6bb:	0f 34                	sysenter
+1:
+  ret
+ 6bd:	c3                   	ret
+
+000006be <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 6be:	cd 40                	int    $0x40
+  ret
+ 6c0:	c3                   	ret
+
+000006c1 <fork>:
+
+SYSCALL(fork)
+ 6c1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6c6:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+000006cc <exit>:
+SYSCALL(exit)
+ 6cc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6d1:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+000006d7 <wait>:
+SYSCALL(wait)
+ 6d7:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6dc:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+000006e2 <pipe>:
+SYSCALL(pipe)
+ 6e2:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6e7:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+000006ed <read>:
+SYSCALL(read)
+ 6ed:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6f2:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+000006f8 <write>:
+SYSCALL(write)
+ 6f8:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6fd:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+00000703 <close>:
+SYSCALL(close)
+ 703:	b8 15 00 00 00       	mov    $0x15,%eax
+ 708:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+0000070e <kill>:
+SYSCALL(kill)
+ 70e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 713:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+00000719 <exec>:
+SYSCALL(exec)
+ 719:	b8 07 00 00 00       	mov    $0x7,%eax
+ 71e:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+00000724 <open>:
+SYSCALL(open)
+ 724:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 729:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+0000072f <mknod>:
+SYSCALL(mknod)
+ 72f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 734:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+0000073a <unlink>:
+SYSCALL(unlink)
+ 73a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 73f:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+00000745 <fstat>:
+SYSCALL(fstat)
+ 745:	b8 08 00 00 00       	mov    $0x8,%eax
+ 74a:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+00000750 <link>:
+SYSCALL(link)
+ 750:	b8 13 00 00 00       	mov    $0x13,%eax
+ 755:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+0000075b <mkdir>:
+SYSCALL(mkdir)
+ 75b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 760:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+00000766 <chdir>:
+SYSCALL(chdir)
+ 766:	b8 09 00 00 00       	mov    $0x9,%eax
+ 76b:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+00000771 <dup>:
+SYSCALL(dup)
+ 771:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 776:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+0000077c <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 77c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 781:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+00000787 <sbrk>:
+SYSCALL(sbrk)
+ 787:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 78c:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+00000792 <sleep>:
+SYSCALL(sleep)
+ 792:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 797:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+0000079d <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 79d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7a2:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+000007a8 <swapread>:
+SYSCALL(swapread)
+ 7a8:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7ad:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+000007b3 <swapwrite>:
+SYSCALL(swapwrite)
+ 7b3:	b8 17 00 00 00       	mov    $0x17,%eax
+ 7b8:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+000007be <swapstat>:
+SYSCALL(swapstat)
+ 7be:	b8 18 00 00 00       	mov    $0x18,%eax
+ 7c3:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+000007c9 <madvise>:
+SYSCALL(madvise)
+ 7c9:	b8 19 00 00 00       	mov    $0x19,%eax
+ 7ce:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+000007d4 <mlock>:
+SYSCALL(mlock)
+ 7d4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7d9:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+000007df <munlock>:
+SYSCALL(munlock)
+ 7df:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7e4:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+000007ea <membench>:
+SYSCALL(membench)
+ 7ea:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7ef:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+000007f5 <nice>:
+SYSCALL(nice)
+ 7f5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 7fa:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+00000800 <setpriority>:
+SYSCALL(setpriority)
+ 800:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 805:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+0000080b <usleep>:
+SYSCALL(usleep)
+ 80b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 810:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+00000816 <cpustat>:
+SYSCALL(cpustat)
+ 816:	b8 20 00 00 00       	mov    $0x20,%eax
+ 81b:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+00000821 <clone>:
+SYSCALL(clone)
+ 821:	b8 21 00 00 00       	mov    $0x21,%eax
+ 826:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+0000082c <join>:
+SYSCALL(join)
+ 82c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 831:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+00000837 <futex_wait>:
+SYSCALL(futex_wait)
+ 837:	b8 23 00 00 00       	mov    $0x23,%eax
+ 83c:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+00000842 <futex_wake>:
+SYSCALL(futex_wake)
+ 842:	b8 24 00 00 00       	mov    $0x24,%eax
+ 847:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+0000084d <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 84d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 852:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+00000858 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 858:	b8 26 00 00 00       	mov    $0x26,%eax
+ 85d:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+00000863 <getcpu>:
+SYSCALL(getcpu)
+ 863:	b8 27 00 00 00       	mov    $0x27,%eax
+ 868:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+0000086e <migrations>:
+SYSCALL(migrations)
+ 86e:	b8 28 00 00 00       	mov    $0x28,%eax
+ 873:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+00000879 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 879:	b8 29 00 00 00       	mov    $0x29,%eax
+ 87e:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+00000884 <lockstat>:
+SYSCALL(lockstat)
+ 884:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 889:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+0000088f <lockprof>:
+SYSCALL(lockprof)
+ 88f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 894:	ff 25 a4 12 00 00    	jmp    *0x12a4
+
+0000089a <bcachestat>:
+SYSCALL(bcachestat)
+ 89a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 89f:	ff 25 a4 12 00 00    	jmp    *0x12a4
+ 8a5:	66 90                	xchg   %ax,%ax
+ 8a7:	66 90                	xchg   %ax,%ax
+ 8a9:	66 90                	xchg   %ax,%ax
+ 8ab:	66 90                	xchg   %ax,%ax
+ 8ad:	66 90                	xchg   %ax,%ax
+ 8af:	90                   	nop
+
+000008b0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	57                   	push   %edi
+ 8b4:	56                   	push   %esi
+ 8b5:	53                   	push   %ebx
+ 8b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 8b8:	89 d1                	mov    %edx,%ecx
+{
+ 8ba:	83 ec 3c             	sub    $0x3c,%esp
+ 8bd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 8c0:	85 d2                	test   %edx,%edx
+ 8c2:	0f 89 80 00 00 00    	jns    948 <printint+0x98>
+ 8c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 8cc:	74 7a                	je     948 <printint+0x98>
+    x = -xx;
+ 8ce:	f7 d9                	neg    %ecx
+    neg = 1;
+ 8d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 8d5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 8d8:	31 f6                	xor    %esi,%esi
+ 8da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 8e0:	89 c8                	mov    %ecx,%eax
+ 8e2:	31 d2                	xor    %edx,%edx
+ 8e4:	89 f7                	mov    %esi,%edi
+ 8e6:	f7 f3                	div    %ebx
+ 8e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 8eb:	0f b6 92 90 0e 00 00 	movzbl 0xe90(%edx),%edx
+ 8f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 8f6:	89 ca                	mov    %ecx,%edx
+ 8f8:	89 c1                	mov    %eax,%ecx
+ 8fa:	39 da                	cmp    %ebx,%edx
+ 8fc:	73 e2                	jae    8e0 <printint+0x30>
+  if(neg)
+ 8fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 901:	85 c0                	test   %eax,%eax
+ 903:	74 07                	je     90c <printint+0x5c>
+    buf[i++] = '-';
+ 905:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 90a:	89 f7                	mov    %esi,%edi
+ 90c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 90f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 912:	01 df                	add    %ebx,%edi
+ 914:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 918:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 91b:	83 ec 04             	sub    $0x4,%esp
+ 91e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 921:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 924:	6a 01                	push   $0x1
+ 926:	50                   	push   %eax
+ 927:	56                   	push   %esi
+ 928:	e8 cb fd ff ff       	call   6f8 <write>
+  while(--i >= 0)
+ 92d:	89 f8                	mov    %edi,%eax
+ 92f:	83 c4 10             	add    $0x10,%esp
+ 932:	83 ef 01             	sub    $0x1,%edi
+ 935:	39 d8                	cmp    %ebx,%eax
+ 937:	75 df                	jne    918 <printint+0x68>
+}
+ 939:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 93c:	5b                   	pop    %ebx
+ 93d:	5e                   	pop    %esi
+ 93e:	5f                   	pop    %edi
+ 93f:	5d                   	pop    %ebp
+ 940:	c3                   	ret
+ 941:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 948:	31 c0                	xor    %eax,%eax
+ 94a:	eb 89                	jmp    8d5 <printint+0x25>
+ 94c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000950 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 950:	55                   	push   %ebp
+ 951:	89 e5                	mov    %esp,%ebp
+ 953:	57                   	push   %edi
+ 954:	56                   	push   %esi
+ 955:	53                   	push   %ebx
+ 956:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 959:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 95c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 95f:	0f b6 1e             	movzbl (%esi),%ebx
+ 962:	83 c6 01             	add    $0x1,%esi
+ 965:	84 db                	test   %bl,%bl
+ 967:	74 67                	je     9d0 <printf+0x80>
+ 969:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 96c:	31 d2                	xor    %edx,%edx
+ 96e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 971:	eb 34                	jmp    9a7 <printf+0x57>
+ 973:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 977:	90                   	nop
+ 978:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 97b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 980:	83 f8 25             	cmp    $0x25,%eax
+ 983:	74 18                	je     99d <printf+0x4d>
+  write(fd, &c, 1);
+ 985:	83 ec 04             	sub    $0x4,%esp
+ 988:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 98b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 98e:	6a 01                	push   $0x1
+ 990:	50                   	push   %eax
+ 991:	57                   	push   %edi
+ 992:	e8 61 fd ff ff       	call   6f8 <write>
+ 997:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 99a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 99d:	0f b6 1e             	movzbl (%esi),%ebx
+ 9a0:	83 c6 01             	add    $0x1,%esi
+ 9a3:	84 db                	test   %bl,%bl
+ 9a5:	74 29                	je     9d0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 9a7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 9aa:	85 d2                	test   %edx,%edx
+ 9ac:	74 ca                	je     978 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 9ae:	83 fa 25             	cmp    $0x25,%edx
+ 9b1:	75 ea                	jne    99d <printf+0x4d>
+      if(c == 'd'){
+ 9b3:	83 f8 25             	cmp    $0x25,%eax
+ 9b6:	0f 84 24 01 00 00    	je     ae0 <printf+0x190>
+ 9bc:	83 e8 63             	sub    $0x63,%eax
+ 9bf:	83 f8 15             	cmp    $0x15,%eax
+ 9c2:	77 1c                	ja     9e0 <printf+0x90>
+ 9c4:	ff 24 85 38 0e 00 00 	jmp    *0xe38(,%eax,4)
+ 9cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9cf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 9d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9d3:	5b                   	pop    %ebx
+ 9d4:	5e                   	pop    %esi
+ 9d5:	5f                   	pop    %edi
+ 9d6:	5d                   	pop    %ebp
+ 9d7:	c3                   	ret
+ 9d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9df:	90                   	nop
+  write(fd, &c, 1);
+ 9e0:	83 ec 04             	sub    $0x4,%esp
+ 9e3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9e6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 9ea:	6a 01                	push   $0x1
+ 9ec:	52                   	push   %edx
+ 9ed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 9f0:	57                   	push   %edi
+ 9f1:	e8 02 fd ff ff       	call   6f8 <write>
+ 9f6:	83 c4 0c             	add    $0xc,%esp
+ 9f9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9fc:	6a 01                	push   $0x1
+ 9fe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ a01:	52                   	push   %edx
+ a02:	57                   	push   %edi
+ a03:	e8 f0 fc ff ff       	call   6f8 <write>
+        putc(fd, c);
+ a08:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a0b:	31 d2                	xor    %edx,%edx
+ a0d:	eb 8e                	jmp    99d <printf+0x4d>
+ a0f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ a10:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a13:	83 ec 0c             	sub    $0xc,%esp
+ a16:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a1b:	8b 13                	mov    (%ebx),%edx
+ a1d:	6a 00                	push   $0x0
+ a1f:	89 f8                	mov    %edi,%eax
+        ap++;
+ a21:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ a24:	e8 87 fe ff ff       	call   8b0 <printint>
+        ap++;
+ a29:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a2c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a2f:	31 d2                	xor    %edx,%edx
+ a31:	e9 67 ff ff ff       	jmp    99d <printf+0x4d>
+ a36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a3d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a40:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a43:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a45:	83 c0 04             	add    $0x4,%eax
+ a48:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a4b:	85 db                	test   %ebx,%ebx
+ a4d:	0f 84 9d 00 00 00    	je     af0 <printf+0x1a0>
+        while(*s != 0){
+ a53:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a56:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a58:	84 c0                	test   %al,%al
+ a5a:	0f 84 3d ff ff ff    	je     99d <printf+0x4d>
+ a60:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a63:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a66:	89 de                	mov    %ebx,%esi
+ a68:	89 d3                	mov    %edx,%ebx
+ a6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a70:	83 ec 04             	sub    $0x4,%esp
+ a73:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a76:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a79:	6a 01                	push   $0x1
+ a7b:	53                   	push   %ebx
+ a7c:	57                   	push   %edi
+ a7d:	e8 76 fc ff ff       	call   6f8 <write>
+        while(*s != 0){
+ a82:	0f b6 06             	movzbl (%esi),%eax
+ a85:	83 c4 10             	add    $0x10,%esp
+ a88:	84 c0                	test   %al,%al
+ a8a:	75 e4                	jne    a70 <printf+0x120>
+      state = 0;
+ a8c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ a8f:	31 d2                	xor    %edx,%edx
+ a91:	e9 07 ff ff ff       	jmp    99d <printf+0x4d>
+ a96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a9d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ aa0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ aa3:	83 ec 0c             	sub    $0xc,%esp
+ aa6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ aab:	8b 13                	mov    (%ebx),%edx
+ aad:	6a 01                	push   $0x1
+ aaf:	e9 6b ff ff ff       	jmp    a1f <printf+0xcf>
+ ab4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ ab8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ abb:	83 ec 04             	sub    $0x4,%esp
+ abe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ ac1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ ac3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ ac6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ ac9:	6a 01                	push   $0x1
+ acb:	52                   	push   %edx
+ acc:	57                   	push   %edi
+ acd:	e8 26 fc ff ff       	call   6f8 <write>
+        ap++;
+ ad2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ ad5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ ad8:	31 d2                	xor    %edx,%edx
+ ada:	e9 be fe ff ff       	jmp    99d <printf+0x4d>
+ adf:	90                   	nop
+  write(fd, &c, 1);
+ ae0:	83 ec 04             	sub    $0x4,%esp
+ ae3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ ae6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ae9:	6a 01                	push   $0x1
+ aeb:	e9 11 ff ff ff       	jmp    a01 <printf+0xb1>
+ af0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ af5:	bb 31 0e 00 00       	mov    $0xe31,%ebx
+ afa:	e9 61 ff ff ff       	jmp    a60 <printf+0x110>
+ aff:	90                   	nop
+
+00000b00 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b00:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b01:	a1 ac 12 00 00       	mov    0x12ac,%eax
+{
+ b06:	89 e5                	mov    %esp,%ebp
+ b08:	57                   	push   %edi
+ b09:	56                   	push   %esi
+ b0a:	53                   	push   %ebx
+ b0b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ b0e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b18:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b1a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b1c:	39 ca                	cmp    %ecx,%edx
+ b1e:	73 30                	jae    b50 <free+0x50>
+ b20:	39 c1                	cmp    %eax,%ecx
+ b22:	72 04                	jb     b28 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b24:	39 c2                	cmp    %eax,%edx
+ b26:	72 f0                	jb     b18 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b28:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ b2b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ b2e:	39 f8                	cmp    %edi,%eax
+ b30:	74 2e                	je     b60 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b32:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ b35:	8b 42 04             	mov    0x4(%edx),%eax
+ b38:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b3b:	39 f1                	cmp    %esi,%ecx
+ b3d:	74 38                	je     b77 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b3f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b41:	5b                   	pop    %ebx
+  freep = p;
+ b42:	89 15 ac 12 00 00    	mov    %edx,0x12ac
+}
+ b48:	5e                   	pop    %esi
+ b49:	5f                   	pop    %edi
+ b4a:	5d                   	pop    %ebp
+ b4b:	c3                   	ret
+ b4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b50:	39 c1                	cmp    %eax,%ecx
+ b52:	72 d0                	jb     b24 <free+0x24>
+ b54:	eb c2                	jmp    b18 <free+0x18>
+ b56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b5d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ b60:	03 70 04             	add    0x4(%eax),%esi
+ b63:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b66:	8b 02                	mov    (%edx),%eax
+ b68:	8b 00                	mov    (%eax),%eax
+ b6a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ b6d:	8b 42 04             	mov    0x4(%edx),%eax
+ b70:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b73:	39 f1                	cmp    %esi,%ecx
+ b75:	75 c8                	jne    b3f <free+0x3f>
+    p->s.size += bp->s.size;
+ b77:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ b7a:	89 15 ac 12 00 00    	mov    %edx,0x12ac
+    p->s.size += bp->s.size;
+ b80:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ b83:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ b86:	89 0a                	mov    %ecx,(%edx)
+}
+ b88:	5b                   	pop    %ebx
+ b89:	5e                   	pop    %esi
+ b8a:	5f                   	pop    %edi
+ b8b:	5d                   	pop    %ebp
+ b8c:	c3                   	ret
+ b8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b90 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ b90:	55                   	push   %ebp
+ b91:	89 e5                	mov    %esp,%ebp
+ b93:	57                   	push   %edi
+ b94:	56                   	push   %esi
+ b95:	53                   	push   %ebx
+ b96:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b99:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ b9c:	8b 15 ac 12 00 00    	mov    0x12ac,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ba2:	8d 78 07             	lea    0x7(%eax),%edi
+ ba5:	c1 ef 03             	shr    $0x3,%edi
+ ba8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ bab:	85 d2                	test   %edx,%edx
+ bad:	0f 84 8d 00 00 00    	je     c40 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bb3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ bb5:	8b 48 04             	mov    0x4(%eax),%ecx
+ bb8:	39 f9                	cmp    %edi,%ecx
+ bba:	73 64                	jae    c20 <malloc+0x90>
+  if(nu < 4096)
+ bbc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ bc1:	39 df                	cmp    %ebx,%edi
+ bc3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ bc6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ bcd:	eb 0a                	jmp    bd9 <malloc+0x49>
+ bcf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bd0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ bd2:	8b 48 04             	mov    0x4(%eax),%ecx
+ bd5:	39 f9                	cmp    %edi,%ecx
+ bd7:	73 47                	jae    c20 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ bd9:	89 c2                	mov    %eax,%edx
+ bdb:	39 05 ac 12 00 00    	cmp    %eax,0x12ac
+ be1:	75 ed                	jne    bd0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ be3:	83 ec 0c             	sub    $0xc,%esp
+ be6:	56                   	push   %esi
+ be7:	e8 9b fb ff ff       	call   787 <sbrk>
+  if(p == (char*)-1)
+ bec:	83 c4 10             	add    $0x10,%esp
+ bef:	83 f8 ff             	cmp    $0xffffffff,%eax
+ bf2:	74 1c                	je     c10 <malloc+0x80>
+  hp->s.size = nu;
+ bf4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ bf7:	83 ec 0c             	sub    $0xc,%esp
+ bfa:	83 c0 08             	add    $0x8,%eax
+ bfd:	50                   	push   %eax
+ bfe:	e8 fd fe ff ff       	call   b00 <free>
+  return freep;
+ c03:	8b 15 ac 12 00 00    	mov    0x12ac,%edx
+      if((p = morecore(nunits)) == 0)
+ c09:	83 c4 10             	add    $0x10,%esp
+ c0c:	85 d2                	test   %edx,%edx
+ c0e:	75 c0                	jne    bd0 <malloc+0x40>
+        return 0;
+  }
+}
+ c10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ c13:	31 c0                	xor    %eax,%eax
+}
+ c15:	5b                   	pop    %ebx
+ c16:	5e                   	pop    %esi
+ c17:	5f                   	pop    %edi
+ c18:	5d                   	pop    %ebp
+ c19:	c3                   	ret
+ c1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ c20:	39 cf                	cmp    %ecx,%edi
+ c22:	74 4c                	je     c70 <malloc+0xe0>
+        p->s.size -= nunits;
+ c24:	29 f9                	sub    %edi,%ecx
+ c26:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ c29:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ c2c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ c2f:	89 15 ac 12 00 00    	mov    %edx,0x12ac
+}
+ c35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ c38:	83 c0 08             	add    $0x8,%eax
+}
+ c3b:	5b                   	pop    %ebx
+ c3c:	5e                   	pop    %esi
+ c3d:	5f                   	pop    %edi
+ c3e:	5d                   	pop    %ebp
+ c3f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ c40:	c7 05 ac 12 00 00 b0 	movl   $0x12b0,0x12ac
+ c47:	12 00 00 
+    base.s.size = 0;
+ c4a:	b8 b0 12 00 00       	mov    $0x12b0,%eax
+    base.s.ptr = freep = prevp = &base;
+ c4f:	c7 05 b0 12 00 00 b0 	movl   $0x12b0,0x12b0
+ c56:	12 00 00 
+    base.s.size = 0;
+ c59:	c7 05 b4 12 00 00 00 	movl   $0x0,0x12b4
+ c60:	00 00 00 
+    if(p->s.size >= nunits){
+ c63:	e9 54 ff ff ff       	jmp    bbc <malloc+0x2c>
+ c68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c6f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ c70:	8b 08                	mov    (%eax),%ecx
+ c72:	89 0a                	mov    %ecx,(%edx)
+ c74:	eb b9                	jmp    c2f <malloc+0x9f>
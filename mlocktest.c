@@ -0,0 +1,99 @@
+// Check that mlock()ed pages stay resident while another
+// process pushes the rest of memory out to swap.
+// usage: mlocktest [megabytes of pressure]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "mman.h"
+
+#define PGSIZE 4096
+#define NLOCK  64
+
+char *buf;
+
+void
+pressure(int mb)
+{
+  char *p;
+  int i, n;
+
+  n = mb * (1024*1024 / PGSIZE);
+  p = sbrk(n * PGSIZE);
+  if(p == (char*)-1){
+    printf(1, "mlocktest: sbrk failed\n");
+    exit();
+  }
+  for(i = 0; i < n; i++)
+    p[i*PGSIZE] = i;
+  for(i = 0; i < n; i++)
+    if(p[i*PGSIZE] != (char)i){
+      printf(1, "mlocktest: pressure page %d corrupted\n", i);
+      exit();
+    }
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, mb, r0, w0, r1, w1;
+  uint sz;
+
+  mb = 240;
+  if(argc > 1)
+    mb = atoi(argv[1]);
+
+  buf = sbrk(NLOCK * PGSIZE);
+  if(buf == (char*)-1){
+    printf(1, "mlocktest: sbrk failed\n");
+    exit();
+  }
+  for(i = 0; i < NLOCK; i++)
+    buf[i*PGSIZE] = i;
+
+  // Pin the whole image: text, data, stack and buf.
+  sz = (uint)sbrk(0);
+  if(mlock(0, sz) < 0){
+    printf(1, "mlocktest: mlock failed\n");
+    exit();
+  }
+  if(mlock(0, sz + PGSIZE) == 0){
+    printf(1, "mlocktest: mlock beyond sz succeeded\n");
+    exit();
+  }
+  if(madvise(buf, PGSIZE, MADV_DONTNEED) == 0){
+    printf(1, "mlocktest: MADV_DONTNEED on a locked page succeeded\n");
+    exit();
+  }
+
+  swapstat(&r0, &w0);
+  if(fork() == 0)
+    pressure(mb);
+  wait();
+  swapstat(&r1, &w1);
+  if(w1 == w0)
+    printf(1, "mlocktest: warning: no swap traffic, try more megabytes\n");
+  printf(1, "mlocktest: child wrote %d sectors to swap\n", w1 - w0);
+
+  // Everything we touch from here on is locked, so nothing
+  // may come back in from swap.
+  swapstat(&r0, &w0);
+  for(i = 0; i < NLOCK; i++)
+    if(buf[i*PGSIZE] != (char)i){
+      printf(1, "mlocktest: locked page %d corrupted\n", i);
+      exit();
+    }
+  swapstat(&r1, &w1);
+  if(r1 != r0){
+    printf(1, "mlocktest: locked pages were swapped out\n");
+    exit();
+  }
+
+  if(munlock(0, sz) < 0){
+    printf(1, "mlocktest: munlock failed\n");
+    exit();
+  }
+  printf(1, "mlocktest ok\n");
+  exit();
+}
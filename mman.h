@@ -0,0 +1,6 @@
+// madvise() advice values.
+#define MADV_NORMAL     0  // no special treatment
+#define MADV_RANDOM     1  // expect random access: no read-ahead
+#define MADV_SEQUENTIAL 2  // expect sequential access: read ahead, evict early
+#define MADV_WILLNEED   3  // bring the pages in now
+#define MADV_DONTNEED   4  // drop the pages; they read back as zeroes
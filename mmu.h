@@ -2,14 +2,21 @@
 // x86 memory management unit (MMU).
 
 // Eflags register
+#define FL_TF           0x00000100      // Trap Flag
 #define FL_IF           0x00000200      // Interrupt Enable
 
 // Control Register flags
 #define CR0_PE          0x00000001      // Protection Enable
+#define CR0_MP          0x00000002      // Monitor coProcessor
+#define CR0_EM          0x00000004      // Emulation
+#define CR0_TS          0x00000008      // Task Switched
+#define CR0_NE          0x00000020      // Numeric Error
 #define CR0_WP          0x00010000      // Write Protect
 #define CR0_PG          0x80000000      // Paging
 
 #define CR4_PSE         0x00000010      // Page size extension
+#define CR4_OSFXSR      0x00000200      // fxsave/fxrstor and SSE
+#define CR4_OSXMMEXCPT  0x00000400      // SIMD exceptions as #XM
 
 // various segment selectors.
 #define SEG_KCODE 1  // kernel code
@@ -17,9 +24,10 @@
 #define SEG_UCODE 3  // user code
 #define SEG_UDATA 4  // user data+stack
 #define SEG_TSS   5  // this process's task state
+#define SEG_KCPU  6  // this cpu's struct cpu, in %gs
 
 // cpu->gdt[NSEGS] holds the above segments.
-#define NSEGS     6
+#define NSEGS     7
 
 #ifndef __ASSEMBLER__
 // Segment Descriptor
@@ -97,14 +105,19 @@ struct segdesc {
 #define PTE_PS          0x080   // Page Size
 #define PTE_A			0x20	// access bit
 #define PTE_SWAP  0x200 // swap bit
+#define PTE_SEQ   0x400 // madvise: sequential access expected
+#define PTE_RAND  0x800 // madvise: random access expected
 
 // Address in page table or page directory entry
 #define PTE_ADDR(pte)   ((uint)(pte) & ~0xFFF)
 #define PTE_FLAGS(pte)  ((uint)(pte) &  0xFFF)
 
-#ifndef __ASSEMBLER__
-typedef uint pte_t;
+// Swap slot held in the address bits of a PTE_SWAP entry.
+// SWAP_ZERO marks a page that reads back as zeroes (madvise DONTNEED).
+#define PTE_SWAPIDX(pte) ((uint)(pte) >> PTXSHIFT)
+#define SWAP_ZERO       0xFFFFF
 
+#ifndef __ASSEMBLER__
 // Task state segment format
 struct taskstate {
   uint link;         // Old ts selector
@@ -184,9 +197,14 @@ struct page{
 	struct page *next;
 	struct page *prev;
 	pde_t *pgdir;
-	char *vaddr;
+	char *vaddr;	// user virtual address
+	int flags;
+	int npin;	// futex waiters and system calls pinning it; see pinpage()
 };
 
+#define PG_LRU		0x1	// on the LRU list
+#define PG_MLOCK	0x2	// pinned by mlock(), never reclaimed
+
 
 
 #endif
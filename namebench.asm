@@ -0,0 +1,1777 @@
+
+_namebench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         nproc, n, udiv64(t, n));
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 19                	mov    (%ecx),%ebx
+  16:	8b 51 04             	mov    0x4(%ecx),%edx
+  int fd, n, nproc, i;
+
+  nproc = NPROCS;
+  n = 2000;
+  if(argc > 1)
+  19:	83 fb 01             	cmp    $0x1,%ebx
+  1c:	0f 8f dc 00 00 00    	jg     fe <main+0xfe>
+    nproc = atoi(argv[1]);
+  if(argc > 2)
+    n = atoi(argv[2]);
+
+  mkdir("nb");
+  22:	83 ec 0c             	sub    $0xc,%esp
+  25:	68 53 0c 00 00       	push   $0xc53
+  2a:	e8 ec 06 00 00       	call   71b <mkdir>
+  mkdir("nb/a");
+  2f:	c7 04 24 56 0c 00 00 	movl   $0xc56,(%esp)
+  36:	e8 e0 06 00 00       	call   71b <mkdir>
+  mkdir("nb/a/b");
+  3b:	c7 04 24 5b 0c 00 00 	movl   $0xc5b,(%esp)
+  42:	e8 d4 06 00 00       	call   71b <mkdir>
+  mkdir("nb/a/b/c");
+  47:	c7 04 24 62 0c 00 00 	movl   $0xc62,(%esp)
+  4e:	e8 c8 06 00 00       	call   71b <mkdir>
+  if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+  53:	58                   	pop    %eax
+  54:	5a                   	pop    %edx
+  55:	68 02 02 00 00       	push   $0x202
+  5a:	ff 35 64 11 00 00    	push   0x1164
+  60:	e8 7f 06 00 00       	call   6e4 <open>
+  65:	83 c4 10             	add    $0x10,%esp
+  68:	85 c0                	test   %eax,%eax
+  6a:	78 7a                	js     e6 <main+0xe6>
+    printf(1, "namebench: create %s failed\n", path);
+    exit();
+  }
+  close(fd);
+  6c:	83 ec 0c             	sub    $0xc,%esp
+  nproc = NPROCS;
+  6f:	be 08 00 00 00       	mov    $0x8,%esi
+  n = 2000;
+  74:	bf d0 07 00 00       	mov    $0x7d0,%edi
+  close(fd);
+  79:	50                   	push   %eax
+  7a:	e8 44 06 00 00       	call   6c3 <close>
+  7f:	83 c4 10             	add    $0x10,%esp
+  n = 2000;
+  82:	bb 01 00 00 00       	mov    $0x1,%ebx
+  87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8e:	66 90                	xchg   %ax,%ax
+
+  for(i = 1; i <= nproc; i *= 2)
+    run(i, n);
+  90:	83 ec 08             	sub    $0x8,%esp
+  93:	57                   	push   %edi
+  94:	53                   	push   %ebx
+  for(i = 1; i <= nproc; i *= 2)
+  95:	01 db                	add    %ebx,%ebx
+    run(i, n);
+  97:	e8 04 01 00 00       	call   1a0 <run>
+  for(i = 1; i <= nproc; i *= 2)
+  9c:	83 c4 10             	add    $0x10,%esp
+  9f:	39 f3                	cmp    %esi,%ebx
+  a1:	7e ed                	jle    90 <main+0x90>
+
+  unlink(path);
+  a3:	83 ec 0c             	sub    $0xc,%esp
+  a6:	ff 35 64 11 00 00    	push   0x1164
+  ac:	e8 49 06 00 00       	call   6fa <unlink>
+  unlink("nb/a/b/c");
+  b1:	c7 04 24 62 0c 00 00 	movl   $0xc62,(%esp)
+  b8:	e8 3d 06 00 00       	call   6fa <unlink>
+  unlink("nb/a/b");
+  bd:	c7 04 24 5b 0c 00 00 	movl   $0xc5b,(%esp)
+  c4:	e8 31 06 00 00       	call   6fa <unlink>
+  unlink("nb/a");
+  c9:	c7 04 24 56 0c 00 00 	movl   $0xc56,(%esp)
+  d0:	e8 25 06 00 00       	call   6fa <unlink>
+  unlink("nb");
+  d5:	c7 04 24 53 0c 00 00 	movl   $0xc53,(%esp)
+  dc:	e8 19 06 00 00       	call   6fa <unlink>
+  exit();
+  e1:	e8 a6 05 00 00       	call   68c <exit>
+    printf(1, "namebench: create %s failed\n", path);
+  e6:	51                   	push   %ecx
+  e7:	ff 35 64 11 00 00    	push   0x1164
+  ed:	68 6b 0c 00 00       	push   $0xc6b
+  f2:	6a 01                	push   $0x1
+  f4:	e8 17 08 00 00       	call   910 <printf>
+    exit();
+  f9:	e8 8e 05 00 00       	call   68c <exit>
+    nproc = atoi(argv[1]);
+  fe:	83 ec 0c             	sub    $0xc,%esp
+ 101:	ff 72 04             	push   0x4(%edx)
+  n = 2000;
+ 104:	bf d0 07 00 00       	mov    $0x7d0,%edi
+    nproc = atoi(argv[1]);
+ 109:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 10c:	e8 2f 03 00 00       	call   440 <atoi>
+  if(argc > 2)
+ 111:	83 c4 10             	add    $0x10,%esp
+    nproc = atoi(argv[1]);
+ 114:	89 c6                	mov    %eax,%esi
+  if(argc > 2)
+ 116:	83 fb 02             	cmp    $0x2,%ebx
+ 119:	74 13                	je     12e <main+0x12e>
+    n = atoi(argv[2]);
+ 11b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 11e:	83 ec 0c             	sub    $0xc,%esp
+ 121:	ff 72 08             	push   0x8(%edx)
+ 124:	e8 17 03 00 00       	call   440 <atoi>
+ 129:	83 c4 10             	add    $0x10,%esp
+ 12c:	89 c7                	mov    %eax,%edi
+  mkdir("nb");
+ 12e:	83 ec 0c             	sub    $0xc,%esp
+ 131:	68 53 0c 00 00       	push   $0xc53
+ 136:	e8 e0 05 00 00       	call   71b <mkdir>
+  mkdir("nb/a");
+ 13b:	c7 04 24 56 0c 00 00 	movl   $0xc56,(%esp)
+ 142:	e8 d4 05 00 00       	call   71b <mkdir>
+  mkdir("nb/a/b");
+ 147:	c7 04 24 5b 0c 00 00 	movl   $0xc5b,(%esp)
+ 14e:	e8 c8 05 00 00       	call   71b <mkdir>
+  mkdir("nb/a/b/c");
+ 153:	c7 04 24 62 0c 00 00 	movl   $0xc62,(%esp)
+ 15a:	e8 bc 05 00 00       	call   71b <mkdir>
+  if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+ 15f:	5b                   	pop    %ebx
+ 160:	58                   	pop    %eax
+ 161:	68 02 02 00 00       	push   $0x202
+ 166:	ff 35 64 11 00 00    	push   0x1164
+ 16c:	e8 73 05 00 00       	call   6e4 <open>
+ 171:	83 c4 10             	add    $0x10,%esp
+ 174:	85 c0                	test   %eax,%eax
+ 176:	0f 88 6a ff ff ff    	js     e6 <main+0xe6>
+  close(fd);
+ 17c:	83 ec 0c             	sub    $0xc,%esp
+ 17f:	50                   	push   %eax
+ 180:	e8 3e 05 00 00       	call   6c3 <close>
+  for(i = 1; i <= nproc; i *= 2)
+ 185:	83 c4 10             	add    $0x10,%esp
+ 188:	85 f6                	test   %esi,%esi
+ 18a:	0f 8f f2 fe ff ff    	jg     82 <main+0x82>
+ 190:	e9 0e ff ff ff       	jmp    a3 <main+0xa3>
+ 195:	66 90                	xchg   %ax,%ax
+ 197:	66 90                	xchg   %ax,%ax
+ 199:	66 90                	xchg   %ax,%ax
+ 19b:	66 90                	xchg   %ax,%ax
+ 19d:	66 90                	xchg   %ax,%ax
+ 19f:	90                   	nop
+
+000001a0 <run>:
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+ 1a5:	53                   	push   %ebx
+ 1a6:	83 ec 3c             	sub    $0x3c,%esp
+ 1a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+ 1ac:	0f 31                	rdtsc
+ 1ae:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 1b1:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+  for(i = 0; i < nproc; i++){
+ 1b4:	85 db                	test   %ebx,%ebx
+ 1b6:	7e 2e                	jle    1e6 <run+0x46>
+ 1b8:	31 f6                	xor    %esi,%esi
+ 1ba:	eb 06                	jmp    1c2 <run+0x22>
+ 1bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1c0:	89 c6                	mov    %eax,%esi
+    if(fork() == 0){
+ 1c2:	e8 ba 04 00 00       	call   681 <fork>
+ 1c7:	85 c0                	test   %eax,%eax
+ 1c9:	74 50                	je     21b <run+0x7b>
+  for(i = 0; i < nproc; i++){
+ 1cb:	8d 46 01             	lea    0x1(%esi),%eax
+ 1ce:	39 c3                	cmp    %eax,%ebx
+ 1d0:	75 ee                	jne    1c0 <run+0x20>
+  for(i = 0; i < nproc; i++)
+ 1d2:	31 ff                	xor    %edi,%edi
+ 1d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    wait();
+ 1d8:	e8 ba 04 00 00       	call   697 <wait>
+  for(i = 0; i < nproc; i++)
+ 1dd:	89 f8                	mov    %edi,%eax
+ 1df:	83 c7 01             	add    $0x1,%edi
+ 1e2:	39 c6                	cmp    %eax,%esi
+ 1e4:	75 f2                	jne    1d8 <run+0x38>
+ 1e6:	0f 31                	rdtsc
+  t = rdtsc() - t;
+ 1e8:	2b 45 c0             	sub    -0x40(%ebp),%eax
+ 1eb:	1b 55 c4             	sbb    -0x3c(%ebp),%edx
+ 1ee:	89 c6                	mov    %eax,%esi
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 1f0:	89 d0                	mov    %edx,%eax
+ 1f2:	31 d2                	xor    %edx,%edx
+ 1f4:	f7 75 0c             	divl   0xc(%ebp)
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 1f7:	89 f0                	mov    %esi,%eax
+ 1f9:	f7 75 0c             	divl   0xc(%ebp)
+  printf(1, "%d procs: %d lookups each, %d cycles per lookup\n",
+ 1fc:	83 ec 0c             	sub    $0xc,%esp
+ 1ff:	50                   	push   %eax
+ 200:	ff 75 0c             	push   0xc(%ebp)
+ 203:	53                   	push   %ebx
+ 204:	68 94 0c 00 00       	push   $0xc94
+ 209:	6a 01                	push   $0x1
+ 20b:	e8 00 07 00 00       	call   910 <printf>
+}
+ 210:	83 c4 20             	add    $0x20,%esp
+ 213:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 216:	5b                   	pop    %ebx
+ 217:	5e                   	pop    %esi
+ 218:	5f                   	pop    %edi
+ 219:	5d                   	pop    %ebp
+ 21a:	c3                   	ret
+      for(j = 0; j < n; j++){
+ 21b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 21e:	85 d2                	test   %edx,%edx
+ 220:	7e 3f                	jle    261 <run+0xc1>
+ 222:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 225:	8d 5d d4             	lea    -0x2c(%ebp),%ebx
+ 228:	89 c6                	mov    %eax,%esi
+ 22a:	eb 07                	jmp    233 <run+0x93>
+ 22c:	83 c6 01             	add    $0x1,%esi
+ 22f:	39 f7                	cmp    %esi,%edi
+ 231:	74 2e                	je     261 <run+0xc1>
+        if(stat(path, &st) < 0){
+ 233:	83 ec 08             	sub    $0x8,%esp
+ 236:	53                   	push   %ebx
+ 237:	ff 35 64 11 00 00    	push   0x1164
+ 23d:	e8 ae 01 00 00       	call   3f0 <stat>
+ 242:	83 c4 10             	add    $0x10,%esp
+ 245:	85 c0                	test   %eax,%eax
+ 247:	79 e3                	jns    22c <run+0x8c>
+          printf(1, "namebench: stat %s failed\n", path);
+ 249:	83 ec 04             	sub    $0x4,%esp
+ 24c:	ff 35 64 11 00 00    	push   0x1164
+ 252:	68 38 0c 00 00       	push   $0xc38
+ 257:	6a 01                	push   $0x1
+ 259:	e8 b2 06 00 00       	call   910 <printf>
+          break;
+ 25e:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 261:	e8 26 04 00 00       	call   68c <exit>
+ 266:	66 90                	xchg   %ax,%ax
+ 268:	66 90                	xchg   %ax,%ax
+ 26a:	66 90                	xchg   %ax,%ax
+ 26c:	66 90                	xchg   %ax,%ax
+ 26e:	66 90                	xchg   %ax,%ax
+
+00000270 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 270:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 271:	31 c0                	xor    %eax,%eax
+{
+ 273:	89 e5                	mov    %esp,%ebp
+ 275:	53                   	push   %ebx
+ 276:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 279:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 280:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 284:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 287:	83 c0 01             	add    $0x1,%eax
+ 28a:	84 d2                	test   %dl,%dl
+ 28c:	75 f2                	jne    280 <strcpy+0x10>
+    ;
+  return os;
+}
+ 28e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 291:	89 c8                	mov    %ecx,%eax
+ 293:	c9                   	leave
+ 294:	c3                   	ret
+ 295:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	53                   	push   %ebx
+ 2a4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2aa:	0f b6 02             	movzbl (%edx),%eax
+ 2ad:	84 c0                	test   %al,%al
+ 2af:	75 17                	jne    2c8 <strcmp+0x28>
+ 2b1:	eb 3a                	jmp    2ed <strcmp+0x4d>
+ 2b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2b7:	90                   	nop
+ 2b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2bc:	83 c2 01             	add    $0x1,%edx
+ 2bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2c2:	84 c0                	test   %al,%al
+ 2c4:	74 1a                	je     2e0 <strcmp+0x40>
+    p++, q++;
+ 2c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2c8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2cb:	38 c3                	cmp    %al,%bl
+ 2cd:	74 e9                	je     2b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2cf:	29 d8                	sub    %ebx,%eax
+}
+ 2d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2d4:	c9                   	leave
+ 2d5:	c3                   	ret
+ 2d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2e4:	31 c0                	xor    %eax,%eax
+ 2e6:	29 d8                	sub    %ebx,%eax
+}
+ 2e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2eb:	c9                   	leave
+ 2ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2ed:	0f b6 19             	movzbl (%ecx),%ebx
+ 2f0:	31 c0                	xor    %eax,%eax
+ 2f2:	eb db                	jmp    2cf <strcmp+0x2f>
+ 2f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ff:	90                   	nop
+
+00000300 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 306:	80 3a 00             	cmpb   $0x0,(%edx)
+ 309:	74 15                	je     320 <strlen+0x20>
+ 30b:	31 c0                	xor    %eax,%eax
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+ 310:	83 c0 01             	add    $0x1,%eax
+ 313:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 317:	89 c1                	mov    %eax,%ecx
+ 319:	75 f5                	jne    310 <strlen+0x10>
+    ;
+  return n;
+}
+ 31b:	89 c8                	mov    %ecx,%eax
+ 31d:	5d                   	pop    %ebp
+ 31e:	c3                   	ret
+ 31f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 320:	31 c9                	xor    %ecx,%ecx
+}
+ 322:	5d                   	pop    %ebp
+ 323:	89 c8                	mov    %ecx,%eax
+ 325:	c3                   	ret
+ 326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000330 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("cld; rep stosb" :
+ 337:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 33a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 33d:	89 d7                	mov    %edx,%edi
+ 33f:	fc                   	cld
+ 340:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 342:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 345:	89 d0                	mov    %edx,%eax
+ 347:	c9                   	leave
+ 348:	c3                   	ret
+ 349:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000350 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	8b 45 08             	mov    0x8(%ebp),%eax
+ 356:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 35a:	0f b6 10             	movzbl (%eax),%edx
+ 35d:	84 d2                	test   %dl,%dl
+ 35f:	75 12                	jne    373 <strchr+0x23>
+ 361:	eb 1d                	jmp    380 <strchr+0x30>
+ 363:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 367:	90                   	nop
+ 368:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 36c:	83 c0 01             	add    $0x1,%eax
+ 36f:	84 d2                	test   %dl,%dl
+ 371:	74 0d                	je     380 <strchr+0x30>
+    if(*s == c)
+ 373:	38 d1                	cmp    %dl,%cl
+ 375:	75 f1                	jne    368 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 377:	5d                   	pop    %ebp
+ 378:	c3                   	ret
+ 379:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 380:	31 c0                	xor    %eax,%eax
+}
+ 382:	5d                   	pop    %ebp
+ 383:	c3                   	ret
+ 384:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 38f:	90                   	nop
+
+00000390 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 395:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 398:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 399:	31 db                	xor    %ebx,%ebx
+{
+ 39b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 39e:	eb 27                	jmp    3c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 3a0:	83 ec 04             	sub    $0x4,%esp
+ 3a3:	6a 01                	push   $0x1
+ 3a5:	56                   	push   %esi
+ 3a6:	6a 00                	push   $0x0
+ 3a8:	e8 00 03 00 00       	call   6ad <read>
+    if(cc < 1)
+ 3ad:	83 c4 10             	add    $0x10,%esp
+ 3b0:	85 c0                	test   %eax,%eax
+ 3b2:	7e 1d                	jle    3d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 3b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 3bf:	3c 0a                	cmp    $0xa,%al
+ 3c1:	74 10                	je     3d3 <gets+0x43>
+ 3c3:	3c 0d                	cmp    $0xd,%al
+ 3c5:	74 0c                	je     3d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3c7:	89 df                	mov    %ebx,%edi
+ 3c9:	83 c3 01             	add    $0x1,%ebx
+ 3cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3cf:	7c cf                	jl     3a0 <gets+0x10>
+ 3d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 3d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 3da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3dd:	5b                   	pop    %ebx
+ 3de:	5e                   	pop    %esi
+ 3df:	5f                   	pop    %edi
+ 3e0:	5d                   	pop    %ebp
+ 3e1:	c3                   	ret
+ 3e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	56                   	push   %esi
+ 3f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3f5:	83 ec 08             	sub    $0x8,%esp
+ 3f8:	6a 00                	push   $0x0
+ 3fa:	ff 75 08             	push   0x8(%ebp)
+ 3fd:	e8 e2 02 00 00       	call   6e4 <open>
+  if(fd < 0)
+ 402:	83 c4 10             	add    $0x10,%esp
+ 405:	85 c0                	test   %eax,%eax
+ 407:	78 27                	js     430 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 409:	83 ec 08             	sub    $0x8,%esp
+ 40c:	ff 75 0c             	push   0xc(%ebp)
+ 40f:	89 c3                	mov    %eax,%ebx
+ 411:	50                   	push   %eax
+ 412:	e8 ee 02 00 00       	call   705 <fstat>
+  close(fd);
+ 417:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 41a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 41c:	e8 a2 02 00 00       	call   6c3 <close>
+  return r;
+ 421:	83 c4 10             	add    $0x10,%esp
+}
+ 424:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 427:	89 f0                	mov    %esi,%eax
+ 429:	5b                   	pop    %ebx
+ 42a:	5e                   	pop    %esi
+ 42b:	5d                   	pop    %ebp
+ 42c:	c3                   	ret
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 430:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 435:	eb ed                	jmp    424 <stat+0x34>
+ 437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43e:	66 90                	xchg   %ax,%ax
+
+00000440 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	53                   	push   %ebx
+ 444:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 447:	0f be 02             	movsbl (%edx),%eax
+ 44a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 44d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 450:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 455:	77 1e                	ja     475 <atoi+0x35>
+ 457:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 460:	83 c2 01             	add    $0x1,%edx
+ 463:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 466:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 46a:	0f be 02             	movsbl (%edx),%eax
+ 46d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 470:	80 fb 09             	cmp    $0x9,%bl
+ 473:	76 eb                	jbe    460 <atoi+0x20>
+  return n;
+}
+ 475:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 478:	89 c8                	mov    %ecx,%eax
+ 47a:	c9                   	leave
+ 47b:	c3                   	ret
+ 47c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	56                   	push   %esi
+ 485:	8b 45 10             	mov    0x10(%ebp),%eax
+ 488:	8b 55 08             	mov    0x8(%ebp),%edx
+ 48b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 48e:	85 c0                	test   %eax,%eax
+ 490:	7e 13                	jle    4a5 <memmove+0x25>
+ 492:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 494:	89 d7                	mov    %edx,%edi
+ 496:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4a1:	39 f8                	cmp    %edi,%eax
+ 4a3:	75 fb                	jne    4a0 <memmove+0x20>
+  return vdst;
+}
+ 4a5:	5e                   	pop    %esi
+ 4a6:	89 d0                	mov    %edx,%eax
+ 4a8:	5f                   	pop    %edi
+ 4a9:	5d                   	pop    %ebp
+ 4aa:	c3                   	ret
+ 4ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4af:	90                   	nop
+
+000004b0 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 4b0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 4b5:	85 c0                	test   %eax,%eax
+ 4b7:	74 07                	je     4c0 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 4b9:	c3                   	ret
+ 4ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 4c0:	e9 77 02 00 00       	jmp    73c <sysgetpid>
+ 4c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 4d0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 4d5:	c3                   	ret
+ 4d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004e0 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 4e0:	55                   	push   %ebp
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 4e1:	31 d2                	xor    %edx,%edx
+ 4e3:	89 e5                	mov    %esp,%ebp
+ 4e5:	53                   	push   %ebx
+ 4e6:	83 ec 04             	sub    $0x4,%esp
+ 4e9:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 4ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 4ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 4f2:	85 c9                	test   %ecx,%ecx
+ 4f4:	7e 08                	jle    4fe <cyclereport+0x1e>
+ 4f6:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 4f8:	89 d8                	mov    %ebx,%eax
+ 4fa:	f7 f1                	div    %ecx
+ 4fc:	89 c2                	mov    %eax,%edx
+ 4fe:	83 ec 08             	sub    $0x8,%esp
+ 501:	52                   	push   %edx
+ 502:	ff 75 0c             	push   0xc(%ebp)
+ 505:	51                   	push   %ecx
+ 506:	ff 75 08             	push   0x8(%ebp)
+ 509:	68 c5 0c 00 00       	push   $0xcc5
+ 50e:	6a 01                	push   $0x1
+ 510:	e8 fb 03 00 00       	call   910 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 515:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 518:	83 c4 20             	add    $0x20,%esp
+ 51b:	c9                   	leave
+ 51c:	c3                   	ret
+ 51d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000520 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 523:	8b 45 08             	mov    0x8(%ebp),%eax
+ 526:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 52c:	5d                   	pop    %ebp
+ 52d:	c3                   	ret
+ 52e:	66 90                	xchg   %ax,%ax
+
+00000530 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 530:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 531:	31 c0                	xor    %eax,%eax
+ 533:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 538:	89 e5                	mov    %esp,%ebp
+ 53a:	56                   	push   %esi
+ 53b:	53                   	push   %ebx
+ 53c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 53f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 543:	85 c0                	test   %eax,%eax
+ 545:	74 30                	je     577 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 547:	83 f8 02             	cmp    $0x2,%eax
+ 54a:	74 0c                	je     558 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 54c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 551:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 554:	85 c0                	test   %eax,%eax
+ 556:	74 1f                	je     577 <mutex_lock+0x47>
+ 558:	be 02 00 00 00       	mov    $0x2,%esi
+ 55d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 560:	83 ec 08             	sub    $0x8,%esp
+ 563:	6a 02                	push   $0x2
+ 565:	53                   	push   %ebx
+ 566:	e8 8c 02 00 00       	call   7f7 <futex_wait>
+ 56b:	89 f0                	mov    %esi,%eax
+ 56d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 570:	83 c4 10             	add    $0x10,%esp
+ 573:	85 c0                	test   %eax,%eax
+ 575:	75 e9                	jne    560 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 577:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 57a:	5b                   	pop    %ebx
+ 57b:	5e                   	pop    %esi
+ 57c:	5d                   	pop    %ebp
+ 57d:	c3                   	ret
+ 57e:	66 90                	xchg   %ax,%ax
+
+00000580 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	83 ec 08             	sub    $0x8,%esp
+ 586:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 589:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 58d:	75 09                	jne    598 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 58f:	c9                   	leave
+ 590:	c3                   	ret
+ 591:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 598:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 59b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 5a1:	6a 01                	push   $0x1
+ 5a3:	50                   	push   %eax
+ 5a4:	e8 59 02 00 00       	call   802 <futex_wake>
+ 5a9:	83 c4 10             	add    $0x10,%esp
+}
+ 5ac:	c9                   	leave
+ 5ad:	c3                   	ret
+ 5ae:	66 90                	xchg   %ax,%ax
+
+000005b0 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 5b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 5bc:	5d                   	pop    %ebp
+ 5bd:	c3                   	ret
+ 5be:	66 90                	xchg   %ax,%ax
+
+000005c0 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	57                   	push   %edi
+ 5c4:	56                   	push   %esi
+ 5c5:	53                   	push   %ebx
+ 5c6:	83 ec 0c             	sub    $0xc,%esp
+ 5c9:	8b 75 08             	mov    0x8(%ebp),%esi
+ 5cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 5cf:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 5d1:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 5d5:	75 21                	jne    5f8 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 5d7:	83 ec 08             	sub    $0x8,%esp
+ 5da:	57                   	push   %edi
+ 5db:	56                   	push   %esi
+ 5dc:	e8 16 02 00 00       	call   7f7 <futex_wait>
+  mutex_lock(m);
+ 5e1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 5e4:	83 c4 10             	add    $0x10,%esp
+}
+ 5e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5ea:	5b                   	pop    %ebx
+ 5eb:	5e                   	pop    %esi
+ 5ec:	5f                   	pop    %edi
+ 5ed:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 5ee:	e9 3d ff ff ff       	jmp    530 <mutex_lock>
+ 5f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5f7:	90                   	nop
+    futex_wake(&m->v, 1);
+ 5f8:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 5fb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 601:	6a 01                	push   $0x1
+ 603:	53                   	push   %ebx
+ 604:	e8 f9 01 00 00       	call   802 <futex_wake>
+ 609:	83 c4 10             	add    $0x10,%esp
+ 60c:	eb c9                	jmp    5d7 <cond_wait+0x17>
+ 60e:	66 90                	xchg   %ax,%ax
+
+00000610 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	83 ec 10             	sub    $0x10,%esp
+ 616:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 619:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 61d:	6a 01                	push   $0x1
+ 61f:	50                   	push   %eax
+ 620:	e8 dd 01 00 00       	call   802 <futex_wake>
+}
+ 625:	83 c4 10             	add    $0x10,%esp
+ 628:	c9                   	leave
+ 629:	c3                   	ret
+ 62a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000630 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	83 ec 10             	sub    $0x10,%esp
+ 636:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 639:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 63d:	68 ff ff ff 7f       	push   $0x7fffffff
+ 642:	50                   	push   %eax
+ 643:	e8 ba 01 00 00       	call   802 <futex_wake>
+}
+ 648:	83 c4 10             	add    $0x10,%esp
+ 64b:	c9                   	leave
+ 64c:	c3                   	ret
+
+0000064d <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 64d:	50                   	push   %eax
+  pushl %ebx
+ 64e:	53                   	push   %ebx
+  movl $1, %eax
+ 64f:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 654:	0f a2                	cpuid
+  popl %ebx
+ 656:	5b                   	pop    %ebx
+  popl %eax
+ 657:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 658:	c7 05 68 11 00 00 7e 	movl   $0x67e,0x1168
+ 65f:	06 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 662:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 668:	74 14                	je     67e <sysint>
+  movl $sysfast, syscallvec
+ 66a:	c7 05 68 11 00 00 74 	movl   $0x674,0x1168
+ 671:	06 00 00 
+
+00000674 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 674:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 676:	ba 7d 06 00 00       	mov    $0x67d,%edx
+  sysenter
+ 67b:	0f 34                	sysenter
+1:
+  ret
+ 67d:	c3                   	ret
+
+0000067e <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 67e:	cd 40                	int    $0x40
+  ret
+ 680:	c3                   	ret
+
+00000681 <fork>:
+
+SYSCALL(fork)
+ 681:	b8 01 00 00 00       	mov    $0x1,%eax
+ 686:	ff 25 68 11 00 00    	jmp    *0x1168
+
+0000068c <exit>:
+SYSCALL(exit)
+ 68c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 691:	ff 25 68 11 00 00    	jmp    *0x1168
+
+00000697 <wait>:
+SYSCALL(wait)
+ 697:	b8 03 00 00 00       	mov    $0x3,%eax
+ 69c:	ff 25 68 11 00 00    	jmp    *0x1168
+
+000006a2 <pipe>:
+SYSCALL(pipe)
+ 6a2:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6a7:	ff 25 68 11 00 00    	jmp    *0x1168
+
+000006ad <read>:
+SYSCALL(read)
+ 6ad:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6b2:	ff 25 68 11 00 00    	jmp    *0x1168
+
+000006b8 <write>:
+SYSCALL(write)
+ 6b8:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6bd:	ff 25 68 11 00 00    	jmp    *0x1168
+
+000006c3 <close>:
+SYSCALL(close)
+ 6c3:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6c8:	ff 25 68 11 00 00    	jmp    *0x1168
+
+000006ce <kill>:
+SYSCALL(kill)
+ 6ce:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6d3:	ff 25 68 11 00 00    	jmp    *0x1168
+
+000006d9 <exec>:
+SYSCALL(exec)
+ 6d9:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6de:	ff 25 68 11 00 00    	jmp    *0x1168
+
+000006e4 <open>:
+SYSCALL(open)
+ 6e4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6e9:	ff 25 68 11 00 00    	jmp    *0x1168
+
+000006ef <mknod>:
+SYSCALL(mknod)
+ 6ef:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6f4:	ff 25 68 11 00 00    	jmp    *0x1168
+
+000006fa <unlink>:
+SYSCALL(unlink)
+ 6fa:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6ff:	ff 25 68 11 00 00    	jmp    *0x1168
+
+00000705 <fstat>:
+SYSCALL(fstat)
+ 705:	b8 08 00 00 00       	mov    $0x8,%eax
+ 70a:	ff 25 68 11 00 00    	jmp    *0x1168
+
+00000710 <link>:
+SYSCALL(link)
+ 710:	b8 13 00 00 00       	mov    $0x13,%eax
+ 715:	ff 25 68 11 00 00    	jmp    *0x1168
+
+0000071b <mkdir>:
+SYSCALL(mkdir)
+ 71b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 720:	ff 25 68 11 00 00    	jmp    *0x1168
+
+00000726 <chdir>:
+SYSCALL(chdir)
+ 726:	b8 09 00 00 00       	mov    $0x9,%eax
+ 72b:	ff 25 68 11 00 00    	jmp    *0x1168
+
+00000731 <dup>:
+SYSCALL(dup)
+ 731:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 736:	ff 25 68 11 00 00    	jmp    *0x1168
+
+0000073c <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 73c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 741:	ff 25 68 11 00 00    	jmp    *0x1168
+
+00000747 <sbrk>:
+SYSCALL(sbrk)
+ 747:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 74c:	ff 25 68 11 00 00    	jmp    *0x1168
+
+00000752 <sleep>:
+SYSCALL(sleep)
+ 752:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 757:	ff 25 68 11 00 00    	jmp    *0x1168
+
+0000075d <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 75d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 762:	ff 25 68 11 00 00    	jmp    *0x1168
+
+00000768 <swapread>:
+SYSCALL(swapread)
+ 768:	b8 16 00 00 00       	mov    $0x16,%eax
+ 76d:	ff 25 68 11 00 00    	jmp    *0x1168
+
+00000773 <swapwrite>:
+SYSCALL(swapwrite)
+ 773:	b8 17 00 00 00       	mov    $0x17,%eax
+ 778:	ff 25 68 11 00 00    	jmp    *0x1168
+
+0000077e <swapstat>:
+SYSCALL(swapstat)
+ 77e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 783:	ff 25 68 11 00 00    	jmp    *0x1168
+
+00000789 <madvise>:
+SYSCALL(madvise)
+ 789:	b8 19 00 00 00       	mov    $0x19,%eax
+ 78e:	ff 25 68 11 00 00    	jmp    *0x1168
+
+00000794 <mlock>:
+SYSCALL(mlock)
+ 794:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 799:	ff 25 68 11 00 00    	jmp    *0x1168
+
+0000079f <munlock>:
+SYSCALL(munlock)
+ 79f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7a4:	ff 25 68 11 00 00    	jmp    *0x1168
+
+000007aa <membench>:
+SYSCALL(membench)
+ 7aa:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7af:	ff 25 68 11 00 00    	jmp    *0x1168
+
+000007b5 <nice>:
+SYSCALL(nice)
+ 7b5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 7ba:	ff 25 68 11 00 00    	jmp    *0x1168
+
+000007c0 <setpriority>:
+SYSCALL(setpriority)
+ 7c0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 7c5:	ff 25 68 11 00 00    	jmp    *0x1168
+
+000007cb <usleep>:
+SYSCALL(usleep)
+ 7cb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 7d0:	ff 25 68 11 00 00    	jmp    *0x1168
+
+000007d6 <cpustat>:
+SYSCALL(cpustat)
+ 7d6:	b8 20 00 00 00       	mov    $0x20,%eax
+ 7db:	ff 25 68 11 00 00    	jmp    *0x1168
+
+000007e1 <clone>:
+SYSCALL(clone)
+ 7e1:	b8 21 00 00 00       	mov    $0x21,%eax
+ 7e6:	ff 25 68 11 00 00    	jmp    *0x1168
+
+000007ec <join>:
+SYSCALL(join)
+ 7ec:	b8 22 00 00 00       	mov    $0x22,%eax
+ 7f1:	ff 25 68 11 00 00    	jmp    *0x1168
+
+000007f7 <futex_wait>:
+SYSCALL(futex_wait)
+ 7f7:	b8 23 00 00 00       	mov    $0x23,%eax
+ 7fc:	ff 25 68 11 00 00    	jmp    *0x1168
+
+00000802 <futex_wake>:
+SYSCALL(futex_wake)
+ 802:	b8 24 00 00 00       	mov    $0x24,%eax
+ 807:	ff 25 68 11 00 00    	jmp    *0x1168
+
+0000080d <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 80d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 812:	ff 25 68 11 00 00    	jmp    *0x1168
+
+00000818 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 818:	b8 26 00 00 00       	mov    $0x26,%eax
+ 81d:	ff 25 68 11 00 00    	jmp    *0x1168
+
+00000823 <getcpu>:
+SYSCALL(getcpu)
+ 823:	b8 27 00 00 00       	mov    $0x27,%eax
+ 828:	ff 25 68 11 00 00    	jmp    *0x1168
+
+0000082e <migrations>:
+SYSCALL(migrations)
+ 82e:	b8 28 00 00 00       	mov    $0x28,%eax
+ 833:	ff 25 68 11 00 00    	jmp    *0x1168
+
+00000839 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 839:	b8 29 00 00 00       	mov    $0x29,%eax
+ 83e:	ff 25 68 11 00 00    	jmp    *0x1168
+
+00000844 <lockstat>:
+SYSCALL(lockstat)
+ 844:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 849:	ff 25 68 11 00 00    	jmp    *0x1168
+
+0000084f <lockprof>:
+SYSCALL(lockprof)
+ 84f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 854:	ff 25 68 11 00 00    	jmp    *0x1168
+
+0000085a <bcachestat>:
+SYSCALL(bcachestat)
+ 85a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 85f:	ff 25 68 11 00 00    	jmp    *0x1168
+ 865:	66 90                	xchg   %ax,%ax
+ 867:	66 90                	xchg   %ax,%ax
+ 869:	66 90                	xchg   %ax,%ax
+ 86b:	66 90                	xchg   %ax,%ax
+ 86d:	66 90                	xchg   %ax,%ax
+ 86f:	90                   	nop
+
+00000870 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 870:	55                   	push   %ebp
+ 871:	89 e5                	mov    %esp,%ebp
+ 873:	57                   	push   %edi
+ 874:	56                   	push   %esi
+ 875:	53                   	push   %ebx
+ 876:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 878:	89 d1                	mov    %edx,%ecx
+{
+ 87a:	83 ec 3c             	sub    $0x3c,%esp
+ 87d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 880:	85 d2                	test   %edx,%edx
+ 882:	0f 89 80 00 00 00    	jns    908 <printint+0x98>
+ 888:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 88c:	74 7a                	je     908 <printint+0x98>
+    x = -xx;
+ 88e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 890:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 895:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 898:	31 f6                	xor    %esi,%esi
+ 89a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 8a0:	89 c8                	mov    %ecx,%eax
+ 8a2:	31 d2                	xor    %edx,%edx
+ 8a4:	89 f7                	mov    %esi,%edi
+ 8a6:	f7 f3                	div    %ebx
+ 8a8:	8d 76 01             	lea    0x1(%esi),%esi
+ 8ab:	0f b6 92 40 0d 00 00 	movzbl 0xd40(%edx),%edx
+ 8b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 8b6:	89 ca                	mov    %ecx,%edx
+ 8b8:	89 c1                	mov    %eax,%ecx
+ 8ba:	39 da                	cmp    %ebx,%edx
+ 8bc:	73 e2                	jae    8a0 <printint+0x30>
+  if(neg)
+ 8be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 8c1:	85 c0                	test   %eax,%eax
+ 8c3:	74 07                	je     8cc <printint+0x5c>
+    buf[i++] = '-';
+ 8c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 8ca:	89 f7                	mov    %esi,%edi
+ 8cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 8cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 8d2:	01 df                	add    %ebx,%edi
+ 8d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 8d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 8db:	83 ec 04             	sub    $0x4,%esp
+ 8de:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 8e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 8e4:	6a 01                	push   $0x1
+ 8e6:	50                   	push   %eax
+ 8e7:	56                   	push   %esi
+ 8e8:	e8 cb fd ff ff       	call   6b8 <write>
+  while(--i >= 0)
+ 8ed:	89 f8                	mov    %edi,%eax
+ 8ef:	83 c4 10             	add    $0x10,%esp
+ 8f2:	83 ef 01             	sub    $0x1,%edi
+ 8f5:	39 d8                	cmp    %ebx,%eax
+ 8f7:	75 df                	jne    8d8 <printint+0x68>
+}
+ 8f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8fc:	5b                   	pop    %ebx
+ 8fd:	5e                   	pop    %esi
+ 8fe:	5f                   	pop    %edi
+ 8ff:	5d                   	pop    %ebp
+ 900:	c3                   	ret
+ 901:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 908:	31 c0                	xor    %eax,%eax
+ 90a:	eb 89                	jmp    895 <printint+0x25>
+ 90c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000910 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 910:	55                   	push   %ebp
+ 911:	89 e5                	mov    %esp,%ebp
+ 913:	57                   	push   %edi
+ 914:	56                   	push   %esi
+ 915:	53                   	push   %ebx
+ 916:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 919:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 91c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 91f:	0f b6 1e             	movzbl (%esi),%ebx
+ 922:	83 c6 01             	add    $0x1,%esi
+ 925:	84 db                	test   %bl,%bl
+ 927:	74 67                	je     990 <printf+0x80>
+ 929:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 92c:	31 d2                	xor    %edx,%edx
+ 92e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 931:	eb 34                	jmp    967 <printf+0x57>
+ 933:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 937:	90                   	nop
+ 938:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 93b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 940:	83 f8 25             	cmp    $0x25,%eax
+ 943:	74 18                	je     95d <printf+0x4d>
+  write(fd, &c, 1);
+ 945:	83 ec 04             	sub    $0x4,%esp
+ 948:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 94b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 94e:	6a 01                	push   $0x1
+ 950:	50                   	push   %eax
+ 951:	57                   	push   %edi
+ 952:	e8 61 fd ff ff       	call   6b8 <write>
+ 957:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 95a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 95d:	0f b6 1e             	movzbl (%esi),%ebx
+ 960:	83 c6 01             	add    $0x1,%esi
+ 963:	84 db                	test   %bl,%bl
+ 965:	74 29                	je     990 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 967:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 96a:	85 d2                	test   %edx,%edx
+ 96c:	74 ca                	je     938 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 96e:	83 fa 25             	cmp    $0x25,%edx
+ 971:	75 ea                	jne    95d <printf+0x4d>
+      if(c == 'd'){
+ 973:	83 f8 25             	cmp    $0x25,%eax
+ 976:	0f 84 24 01 00 00    	je     aa0 <printf+0x190>
+ 97c:	83 e8 63             	sub    $0x63,%eax
+ 97f:	83 f8 15             	cmp    $0x15,%eax
+ 982:	77 1c                	ja     9a0 <printf+0x90>
+ 984:	ff 24 85 e8 0c 00 00 	jmp    *0xce8(,%eax,4)
+ 98b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 98f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 990:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 993:	5b                   	pop    %ebx
+ 994:	5e                   	pop    %esi
+ 995:	5f                   	pop    %edi
+ 996:	5d                   	pop    %ebp
+ 997:	c3                   	ret
+ 998:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 99f:	90                   	nop
+  write(fd, &c, 1);
+ 9a0:	83 ec 04             	sub    $0x4,%esp
+ 9a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 9aa:	6a 01                	push   $0x1
+ 9ac:	52                   	push   %edx
+ 9ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 9b0:	57                   	push   %edi
+ 9b1:	e8 02 fd ff ff       	call   6b8 <write>
+ 9b6:	83 c4 0c             	add    $0xc,%esp
+ 9b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9bc:	6a 01                	push   $0x1
+ 9be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 9c1:	52                   	push   %edx
+ 9c2:	57                   	push   %edi
+ 9c3:	e8 f0 fc ff ff       	call   6b8 <write>
+        putc(fd, c);
+ 9c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9cb:	31 d2                	xor    %edx,%edx
+ 9cd:	eb 8e                	jmp    95d <printf+0x4d>
+ 9cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 9d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9d3:	83 ec 0c             	sub    $0xc,%esp
+ 9d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 9db:	8b 13                	mov    (%ebx),%edx
+ 9dd:	6a 00                	push   $0x0
+ 9df:	89 f8                	mov    %edi,%eax
+        ap++;
+ 9e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 9e4:	e8 87 fe ff ff       	call   870 <printint>
+        ap++;
+ 9e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9ef:	31 d2                	xor    %edx,%edx
+ 9f1:	e9 67 ff ff ff       	jmp    95d <printf+0x4d>
+ 9f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a00:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a03:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a05:	83 c0 04             	add    $0x4,%eax
+ a08:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a0b:	85 db                	test   %ebx,%ebx
+ a0d:	0f 84 9d 00 00 00    	je     ab0 <printf+0x1a0>
+        while(*s != 0){
+ a13:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a16:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a18:	84 c0                	test   %al,%al
+ a1a:	0f 84 3d ff ff ff    	je     95d <printf+0x4d>
+ a20:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a23:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a26:	89 de                	mov    %ebx,%esi
+ a28:	89 d3                	mov    %edx,%ebx
+ a2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a30:	83 ec 04             	sub    $0x4,%esp
+ a33:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a36:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a39:	6a 01                	push   $0x1
+ a3b:	53                   	push   %ebx
+ a3c:	57                   	push   %edi
+ a3d:	e8 76 fc ff ff       	call   6b8 <write>
+        while(*s != 0){
+ a42:	0f b6 06             	movzbl (%esi),%eax
+ a45:	83 c4 10             	add    $0x10,%esp
+ a48:	84 c0                	test   %al,%al
+ a4a:	75 e4                	jne    a30 <printf+0x120>
+      state = 0;
+ a4c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ a4f:	31 d2                	xor    %edx,%edx
+ a51:	e9 07 ff ff ff       	jmp    95d <printf+0x4d>
+ a56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a5d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a60:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a63:	83 ec 0c             	sub    $0xc,%esp
+ a66:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a6b:	8b 13                	mov    (%ebx),%edx
+ a6d:	6a 01                	push   $0x1
+ a6f:	e9 6b ff ff ff       	jmp    9df <printf+0xcf>
+ a74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a78:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a7b:	83 ec 04             	sub    $0x4,%esp
+ a7e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a81:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a83:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a86:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a89:	6a 01                	push   $0x1
+ a8b:	52                   	push   %edx
+ a8c:	57                   	push   %edi
+ a8d:	e8 26 fc ff ff       	call   6b8 <write>
+        ap++;
+ a92:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a95:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a98:	31 d2                	xor    %edx,%edx
+ a9a:	e9 be fe ff ff       	jmp    95d <printf+0x4d>
+ a9f:	90                   	nop
+  write(fd, &c, 1);
+ aa0:	83 ec 04             	sub    $0x4,%esp
+ aa3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ aa6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ aa9:	6a 01                	push   $0x1
+ aab:	e9 11 ff ff ff       	jmp    9c1 <printf+0xb1>
+ ab0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ ab5:	bb e0 0c 00 00       	mov    $0xce0,%ebx
+ aba:	e9 61 ff ff ff       	jmp    a20 <printf+0x110>
+ abf:	90                   	nop
+
+00000ac0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ ac0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ac1:	a1 6c 11 00 00       	mov    0x116c,%eax
+{
+ ac6:	89 e5                	mov    %esp,%ebp
+ ac8:	57                   	push   %edi
+ ac9:	56                   	push   %esi
+ aca:	53                   	push   %ebx
+ acb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ ace:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ad1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ad8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ada:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ adc:	39 ca                	cmp    %ecx,%edx
+ ade:	73 30                	jae    b10 <free+0x50>
+ ae0:	39 c1                	cmp    %eax,%ecx
+ ae2:	72 04                	jb     ae8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ae4:	39 c2                	cmp    %eax,%edx
+ ae6:	72 f0                	jb     ad8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ ae8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ aeb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ aee:	39 f8                	cmp    %edi,%eax
+ af0:	74 2e                	je     b20 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ af2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ af5:	8b 42 04             	mov    0x4(%edx),%eax
+ af8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ afb:	39 f1                	cmp    %esi,%ecx
+ afd:	74 38                	je     b37 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ aff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b01:	5b                   	pop    %ebx
+  freep = p;
+ b02:	89 15 6c 11 00 00    	mov    %edx,0x116c
+}
+ b08:	5e                   	pop    %esi
+ b09:	5f                   	pop    %edi
+ b0a:	5d                   	pop    %ebp
+ b0b:	c3                   	ret
+ b0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b10:	39 c1                	cmp    %eax,%ecx
+ b12:	72 d0                	jb     ae4 <free+0x24>
+ b14:	eb c2                	jmp    ad8 <free+0x18>
+ b16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b1d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ b20:	03 70 04             	add    0x4(%eax),%esi
+ b23:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b26:	8b 02                	mov    (%edx),%eax
+ b28:	8b 00                	mov    (%eax),%eax
+ b2a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ b2d:	8b 42 04             	mov    0x4(%edx),%eax
+ b30:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b33:	39 f1                	cmp    %esi,%ecx
+ b35:	75 c8                	jne    aff <free+0x3f>
+    p->s.size += bp->s.size;
+ b37:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ b3a:	89 15 6c 11 00 00    	mov    %edx,0x116c
+    p->s.size += bp->s.size;
+ b40:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ b43:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ b46:	89 0a                	mov    %ecx,(%edx)
+}
+ b48:	5b                   	pop    %ebx
+ b49:	5e                   	pop    %esi
+ b4a:	5f                   	pop    %edi
+ b4b:	5d                   	pop    %ebp
+ b4c:	c3                   	ret
+ b4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b50 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ b50:	55                   	push   %ebp
+ b51:	89 e5                	mov    %esp,%ebp
+ b53:	57                   	push   %edi
+ b54:	56                   	push   %esi
+ b55:	53                   	push   %ebx
+ b56:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b59:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ b5c:	8b 15 6c 11 00 00    	mov    0x116c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b62:	8d 78 07             	lea    0x7(%eax),%edi
+ b65:	c1 ef 03             	shr    $0x3,%edi
+ b68:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ b6b:	85 d2                	test   %edx,%edx
+ b6d:	0f 84 8d 00 00 00    	je     c00 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b73:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b75:	8b 48 04             	mov    0x4(%eax),%ecx
+ b78:	39 f9                	cmp    %edi,%ecx
+ b7a:	73 64                	jae    be0 <malloc+0x90>
+  if(nu < 4096)
+ b7c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b81:	39 df                	cmp    %ebx,%edi
+ b83:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b86:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b8d:	eb 0a                	jmp    b99 <malloc+0x49>
+ b8f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b90:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b92:	8b 48 04             	mov    0x4(%eax),%ecx
+ b95:	39 f9                	cmp    %edi,%ecx
+ b97:	73 47                	jae    be0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ b99:	89 c2                	mov    %eax,%edx
+ b9b:	39 05 6c 11 00 00    	cmp    %eax,0x116c
+ ba1:	75 ed                	jne    b90 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ba3:	83 ec 0c             	sub    $0xc,%esp
+ ba6:	56                   	push   %esi
+ ba7:	e8 9b fb ff ff       	call   747 <sbrk>
+  if(p == (char*)-1)
+ bac:	83 c4 10             	add    $0x10,%esp
+ baf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ bb2:	74 1c                	je     bd0 <malloc+0x80>
+  hp->s.size = nu;
+ bb4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ bb7:	83 ec 0c             	sub    $0xc,%esp
+ bba:	83 c0 08             	add    $0x8,%eax
+ bbd:	50                   	push   %eax
+ bbe:	e8 fd fe ff ff       	call   ac0 <free>
+  return freep;
+ bc3:	8b 15 6c 11 00 00    	mov    0x116c,%edx
+      if((p = morecore(nunits)) == 0)
+ bc9:	83 c4 10             	add    $0x10,%esp
+ bcc:	85 d2                	test   %edx,%edx
+ bce:	75 c0                	jne    b90 <malloc+0x40>
+        return 0;
+  }
+}
+ bd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ bd3:	31 c0                	xor    %eax,%eax
+}
+ bd5:	5b                   	pop    %ebx
+ bd6:	5e                   	pop    %esi
+ bd7:	5f                   	pop    %edi
+ bd8:	5d                   	pop    %ebp
+ bd9:	c3                   	ret
+ bda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ be0:	39 cf                	cmp    %ecx,%edi
+ be2:	74 4c                	je     c30 <malloc+0xe0>
+        p->s.size -= nunits;
+ be4:	29 f9                	sub    %edi,%ecx
+ be6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ be9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ bec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ bef:	89 15 6c 11 00 00    	mov    %edx,0x116c
+}
+ bf5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ bf8:	83 c0 08             	add    $0x8,%eax
+}
+ bfb:	5b                   	pop    %ebx
+ bfc:	5e                   	pop    %esi
+ bfd:	5f                   	pop    %edi
+ bfe:	5d                   	pop    %ebp
+ bff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ c00:	c7 05 6c 11 00 00 70 	movl   $0x1170,0x116c
+ c07:	11 00 00 
+    base.s.size = 0;
+ c0a:	b8 70 11 00 00       	mov    $0x1170,%eax
+    base.s.ptr = freep = prevp = &base;
+ c0f:	c7 05 70 11 00 00 70 	movl   $0x1170,0x1170
+ c16:	11 00 00 
+    base.s.size = 0;
+ c19:	c7 05 74 11 00 00 00 	movl   $0x0,0x1174
+ c20:	00 00 00 
+    if(p->s.size >= nunits){
+ c23:	e9 54 ff ff ff       	jmp    b7c <malloc+0x2c>
+ c28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c2f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ c30:	8b 08                	mov    (%eax),%ecx
+ c32:	89 0a                	mov    %ecx,(%edx)
+ c34:	eb b9                	jmp    bef <malloc+0x9f>
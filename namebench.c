@@ -0,0 +1,74 @@
+// Concurrent path lookups.  nproc processes each stat a
+// multi-component path n times; the time per lookup should
+// not grow much with nproc on a multiprocessor.
+// usage: namebench [nproc [n]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "x86.h"
+
+#define NPROCS 8
+
+char *path = "nb/a/b/c/d";
+
+void
+run(int nproc, int n)
+{
+  struct stat st;
+  uint64 t;
+  int i, j;
+
+  t = rdtsc();
+  for(i = 0; i < nproc; i++){
+    if(fork() == 0){
+      for(j = 0; j < n; j++){
+        if(stat(path, &st) < 0){
+          printf(1, "namebench: stat %s failed\n", path);
+          break;
+        }
+      }
+      exit();
+    }
+  }
+  for(i = 0; i < nproc; i++)
+    wait();
+  t = rdtsc() - t;
+
+  printf(1, "%d procs: %d lookups each, %d cycles per lookup\n",
+         nproc, n, udiv64(t, n));
+}
+
+int
+main(int argc, char *argv[])
+{
+  int fd, n, nproc, i;
+
+  nproc = NPROCS;
+  n = 2000;
+  if(argc > 1)
+    nproc = atoi(argv[1]);
+  if(argc > 2)
+    n = atoi(argv[2]);
+
+  mkdir("nb");
+  mkdir("nb/a");
+  mkdir("nb/a/b");
+  mkdir("nb/a/b/c");
+  if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+    printf(1, "namebench: create %s failed\n", path);
+    exit();
+  }
+  close(fd);
+
+  for(i = 1; i <= nproc; i *= 2)
+    run(i, n);
+
+  unlink(path);
+  unlink("nb/a/b/c");
+  unlink("nb/a/b");
+  unlink("nb/a");
+  unlink("nb");
+  exit();
+}
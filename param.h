@@ -1,16 +1,32 @@
-#define NPROC        64  // maximum number of processes
+#define NPROC      1024  // maximum number of processes
+#define NPIDHASH    256  // pid lookup hash buckets
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
+#define NPRIO         3  // scheduling levels
+#define QUANTUM       1  // ticks at level 0, doubling at each level down
+#define BOOSTTICKS  100  // ticks between priority boosts
+#define NWAITQ       64  // sleep/wakeup hash buckets
+#define NLOCKSTAT    64  // lock names with their own statistics
+#define NLOCKPROF   256  // lock profile entries per CPU
+#define TICKJIFFIES  10  // 1 ms timer interrupts per clock tick
 #define NOFILE       16  // open files per process
 #define NFILE       100  // open files per system
 #define NINODE       50  // maximum number of active i-nodes
+#define NIHASH       64  // i-node cache hash buckets
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
+#define NPINARG      (MAXARG+8)  // user ranges a system call may pin
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
+#define NBUF         (MAXOPBLOCKS*3)  // disk block cache buffers always there
+#define NBUFMAX      4096  // ... most it grows to
+#define NBHASH       509  // disk block cache hash buckets
+#define BCACHEFREE   2048  // pages left free when the block cache grows
 #define FSSIZE       100000  // size of file system in blocks
 #define SWAPBASE	500
 #define SWAPMAX		(100000 - SWAPBASE)
+#define SWAPRA        1  // pages read ahead on a swap fault
+#define SWAPRA_SEQ    8  // ... in a MADV_SEQUENTIAL range
+#define MLOCKMAX   1024  // max pages a process may mlock()
 
@@ -0,0 +1,1740 @@
+
+_pipebench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  cyclereport(what, "round trips", t, trips);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	bb 10 27 00 00       	mov    $0x2710,%ebx
+  13:	51                   	push   %ecx
+  int trips;
+
+  trips = 10000;
+  if(argc > 1)
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  17:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1)
+  1a:	7e 1a                	jle    36 <main+0x36>
+    trips = atoi(argv[1]);
+  1c:	83 ec 0c             	sub    $0xc,%esp
+  1f:	ff 70 04             	push   0x4(%eax)
+  22:	e8 a9 03 00 00       	call   3d0 <atoi>
+  if(trips < 1)
+  27:	83 c4 10             	add    $0x10,%esp
+    trips = 1;
+  2a:	ba 01 00 00 00       	mov    $0x1,%edx
+  2f:	85 c0                	test   %eax,%eax
+  31:	0f 4f d0             	cmovg  %eax,%edx
+  34:	89 d3                	mov    %edx,%ebx
+  pingpong("one cpu", trips, 1);
+  36:	83 ec 04             	sub    $0x4,%esp
+  39:	6a 01                	push   $0x1
+  3b:	53                   	push   %ebx
+  3c:	68 03 0c 00 00       	push   $0xc03
+  41:	e8 1a 00 00 00       	call   60 <pingpong>
+  pingpong("any cpu", trips, 0);
+  46:	83 c4 0c             	add    $0xc,%esp
+  49:	6a 00                	push   $0x0
+  4b:	53                   	push   %ebx
+  4c:	68 0b 0c 00 00       	push   $0xc0b
+  51:	e8 0a 00 00 00       	call   60 <pingpong>
+  exit();
+  56:	e8 c1 05 00 00       	call   61c <exit>
+  5b:	66 90                	xchg   %ax,%ax
+  5d:	66 90                	xchg   %ax,%ax
+  5f:	90                   	nop
+
+00000060 <pingpong>:
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	57                   	push   %edi
+  64:	56                   	push   %esi
+  if(pipe(a) < 0 || pipe(b) < 0){
+  65:	8d 45 d8             	lea    -0x28(%ebp),%eax
+{
+  68:	53                   	push   %ebx
+  69:	83 ec 48             	sub    $0x48,%esp
+  6c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(pipe(a) < 0 || pipe(b) < 0){
+  6f:	50                   	push   %eax
+  70:	e8 bd 05 00 00       	call   632 <pipe>
+  75:	83 c4 10             	add    $0x10,%esp
+  78:	85 c0                	test   %eax,%eax
+  7a:	0f 88 1a 01 00 00    	js     19a <pingpong+0x13a>
+  80:	83 ec 0c             	sub    $0xc,%esp
+  83:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  86:	50                   	push   %eax
+  87:	e8 a6 05 00 00       	call   632 <pipe>
+  8c:	83 c4 10             	add    $0x10,%esp
+  8f:	85 c0                	test   %eax,%eax
+  91:	0f 88 03 01 00 00    	js     19a <pingpong+0x13a>
+  if(pin && sched_setaffinity(0, 1) < 0){
+  97:	8b 45 10             	mov    0x10(%ebp),%eax
+  9a:	85 c0                	test   %eax,%eax
+  9c:	0f 85 ce 00 00 00    	jne    170 <pingpong+0x110>
+  if(fork() == 0){
+  a2:	e8 6a 05 00 00       	call   611 <fork>
+  a7:	85 c0                	test   %eax,%eax
+  a9:	0f 84 fe 00 00 00    	je     1ad <pingpong+0x14d>
+  close(a[0]);
+  af:	83 ec 0c             	sub    $0xc,%esp
+  b2:	ff 75 d8             	push   -0x28(%ebp)
+  b5:	e8 99 05 00 00       	call   653 <close>
+  close(b[1]);
+  ba:	5e                   	pop    %esi
+  bb:	ff 75 e4             	push   -0x1c(%ebp)
+  be:	e8 90 05 00 00       	call   653 <close>
+  c = 0;
+  c3:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+  c7:	0f 31                	rdtsc
+  c9:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  for(i = 0; i < trips; i++){
+  cc:	83 c4 10             	add    $0x10,%esp
+  cf:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+  d2:	85 db                	test   %ebx,%ebx
+  d4:	7e 47                	jle    11d <pingpong+0xbd>
+  d6:	31 ff                	xor    %edi,%edi
+  d8:	8d 75 d7             	lea    -0x29(%ebp),%esi
+  db:	eb 0a                	jmp    e7 <pingpong+0x87>
+  dd:	8d 76 00             	lea    0x0(%esi),%esi
+  e0:	83 c7 01             	add    $0x1,%edi
+  e3:	39 fb                	cmp    %edi,%ebx
+  e5:	74 36                	je     11d <pingpong+0xbd>
+    write(a[1], &c, 1);
+  e7:	83 ec 04             	sub    $0x4,%esp
+  ea:	6a 01                	push   $0x1
+  ec:	56                   	push   %esi
+  ed:	ff 75 dc             	push   -0x24(%ebp)
+  f0:	e8 53 05 00 00       	call   648 <write>
+    if(read(b[0], &c, 1) != 1){
+  f5:	83 c4 0c             	add    $0xc,%esp
+  f8:	6a 01                	push   $0x1
+  fa:	56                   	push   %esi
+  fb:	ff 75 e0             	push   -0x20(%ebp)
+  fe:	e8 3a 05 00 00       	call   63d <read>
+ 103:	83 c4 10             	add    $0x10,%esp
+ 106:	83 f8 01             	cmp    $0x1,%eax
+ 109:	74 d5                	je     e0 <pingpong+0x80>
+      printf(1, "pipebench: short read\n");
+ 10b:	83 ec 08             	sub    $0x8,%esp
+ 10e:	68 e0 0b 00 00       	push   $0xbe0
+ 113:	6a 01                	push   $0x1
+ 115:	e8 86 07 00 00       	call   8a0 <printf>
+      break;
+ 11a:	83 c4 10             	add    $0x10,%esp
+ 11d:	0f 31                	rdtsc
+  t = rdtsc() - t;
+ 11f:	2b 45 c0             	sub    -0x40(%ebp),%eax
+ 122:	1b 55 c4             	sbb    -0x3c(%ebp),%edx
+  close(a[1]);
+ 125:	83 ec 0c             	sub    $0xc,%esp
+ 128:	ff 75 dc             	push   -0x24(%ebp)
+  t = rdtsc() - t;
+ 12b:	89 d7                	mov    %edx,%edi
+ 12d:	89 c6                	mov    %eax,%esi
+  close(a[1]);
+ 12f:	e8 1f 05 00 00       	call   653 <close>
+  close(b[0]);
+ 134:	58                   	pop    %eax
+ 135:	ff 75 e0             	push   -0x20(%ebp)
+ 138:	e8 16 05 00 00       	call   653 <close>
+  wait();
+ 13d:	e8 e5 04 00 00       	call   627 <wait>
+  sched_setaffinity(0, ~0);
+ 142:	5a                   	pop    %edx
+ 143:	59                   	pop    %ecx
+ 144:	6a ff                	push   $0xffffffff
+ 146:	6a 00                	push   $0x0
+ 148:	e8 50 06 00 00       	call   79d <sched_setaffinity>
+  cyclereport(what, "round trips", t, trips);
+ 14d:	89 1c 24             	mov    %ebx,(%esp)
+ 150:	57                   	push   %edi
+ 151:	56                   	push   %esi
+ 152:	68 f7 0b 00 00       	push   $0xbf7
+ 157:	ff 75 08             	push   0x8(%ebp)
+ 15a:	e8 11 03 00 00       	call   470 <cyclereport>
+}
+ 15f:	83 c4 20             	add    $0x20,%esp
+ 162:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 165:	5b                   	pop    %ebx
+ 166:	5e                   	pop    %esi
+ 167:	5f                   	pop    %edi
+ 168:	5d                   	pop    %ebp
+ 169:	c3                   	ret
+ 16a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(pin && sched_setaffinity(0, 1) < 0){
+ 170:	83 ec 08             	sub    $0x8,%esp
+ 173:	6a 01                	push   $0x1
+ 175:	6a 00                	push   $0x0
+ 177:	e8 21 06 00 00       	call   79d <sched_setaffinity>
+ 17c:	83 c4 10             	add    $0x10,%esp
+ 17f:	85 c0                	test   %eax,%eax
+ 181:	0f 89 1b ff ff ff    	jns    a2 <pingpong+0x42>
+    printf(1, "pipebench: sched_setaffinity failed\n");
+ 187:	50                   	push   %eax
+ 188:	50                   	push   %eax
+ 189:	68 14 0c 00 00       	push   $0xc14
+ 18e:	6a 01                	push   $0x1
+ 190:	e8 0b 07 00 00       	call   8a0 <printf>
+    exit();
+ 195:	e8 82 04 00 00       	call   61c <exit>
+    printf(1, "pipebench: pipe failed\n");
+ 19a:	50                   	push   %eax
+ 19b:	50                   	push   %eax
+ 19c:	68 c8 0b 00 00       	push   $0xbc8
+ 1a1:	6a 01                	push   $0x1
+ 1a3:	e8 f8 06 00 00       	call   8a0 <printf>
+    exit();
+ 1a8:	e8 6f 04 00 00       	call   61c <exit>
+    close(a[1]);
+ 1ad:	83 ec 0c             	sub    $0xc,%esp
+ 1b0:	ff 75 dc             	push   -0x24(%ebp)
+ 1b3:	8d 75 d7             	lea    -0x29(%ebp),%esi
+ 1b6:	e8 98 04 00 00       	call   653 <close>
+    close(b[0]);
+ 1bb:	5f                   	pop    %edi
+ 1bc:	ff 75 e0             	push   -0x20(%ebp)
+ 1bf:	e8 8f 04 00 00       	call   653 <close>
+    while(read(a[0], &c, 1) == 1)
+ 1c4:	83 c4 10             	add    $0x10,%esp
+ 1c7:	eb 11                	jmp    1da <pingpong+0x17a>
+      write(b[1], &c, 1);
+ 1c9:	83 ec 04             	sub    $0x4,%esp
+ 1cc:	6a 01                	push   $0x1
+ 1ce:	56                   	push   %esi
+ 1cf:	ff 75 e4             	push   -0x1c(%ebp)
+ 1d2:	e8 71 04 00 00       	call   648 <write>
+ 1d7:	83 c4 10             	add    $0x10,%esp
+    while(read(a[0], &c, 1) == 1)
+ 1da:	83 ec 04             	sub    $0x4,%esp
+ 1dd:	6a 01                	push   $0x1
+ 1df:	56                   	push   %esi
+ 1e0:	ff 75 d8             	push   -0x28(%ebp)
+ 1e3:	e8 55 04 00 00       	call   63d <read>
+ 1e8:	83 c4 10             	add    $0x10,%esp
+ 1eb:	83 f8 01             	cmp    $0x1,%eax
+ 1ee:	74 d9                	je     1c9 <pingpong+0x169>
+    exit();
+ 1f0:	e8 27 04 00 00       	call   61c <exit>
+ 1f5:	66 90                	xchg   %ax,%ax
+ 1f7:	66 90                	xchg   %ax,%ax
+ 1f9:	66 90                	xchg   %ax,%ax
+ 1fb:	66 90                	xchg   %ax,%ax
+ 1fd:	66 90                	xchg   %ax,%ax
+ 1ff:	90                   	nop
+
+00000200 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 200:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 201:	31 c0                	xor    %eax,%eax
+{
+ 203:	89 e5                	mov    %esp,%ebp
+ 205:	53                   	push   %ebx
+ 206:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 209:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 20c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 210:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 214:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 217:	83 c0 01             	add    $0x1,%eax
+ 21a:	84 d2                	test   %dl,%dl
+ 21c:	75 f2                	jne    210 <strcpy+0x10>
+    ;
+  return os;
+}
+ 21e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 221:	89 c8                	mov    %ecx,%eax
+ 223:	c9                   	leave
+ 224:	c3                   	ret
+ 225:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000230 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	53                   	push   %ebx
+ 234:	8b 55 08             	mov    0x8(%ebp),%edx
+ 237:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 23a:	0f b6 02             	movzbl (%edx),%eax
+ 23d:	84 c0                	test   %al,%al
+ 23f:	75 17                	jne    258 <strcmp+0x28>
+ 241:	eb 3a                	jmp    27d <strcmp+0x4d>
+ 243:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 247:	90                   	nop
+ 248:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 24c:	83 c2 01             	add    $0x1,%edx
+ 24f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 252:	84 c0                	test   %al,%al
+ 254:	74 1a                	je     270 <strcmp+0x40>
+    p++, q++;
+ 256:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 258:	0f b6 19             	movzbl (%ecx),%ebx
+ 25b:	38 c3                	cmp    %al,%bl
+ 25d:	74 e9                	je     248 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 25f:	29 d8                	sub    %ebx,%eax
+}
+ 261:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 264:	c9                   	leave
+ 265:	c3                   	ret
+ 266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 270:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 274:	31 c0                	xor    %eax,%eax
+ 276:	29 d8                	sub    %ebx,%eax
+}
+ 278:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 27b:	c9                   	leave
+ 27c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 27d:	0f b6 19             	movzbl (%ecx),%ebx
+ 280:	31 c0                	xor    %eax,%eax
+ 282:	eb db                	jmp    25f <strcmp+0x2f>
+ 284:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 28f:	90                   	nop
+
+00000290 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 296:	80 3a 00             	cmpb   $0x0,(%edx)
+ 299:	74 15                	je     2b0 <strlen+0x20>
+ 29b:	31 c0                	xor    %eax,%eax
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+ 2a0:	83 c0 01             	add    $0x1,%eax
+ 2a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2a7:	89 c1                	mov    %eax,%ecx
+ 2a9:	75 f5                	jne    2a0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2ab:	89 c8                	mov    %ecx,%eax
+ 2ad:	5d                   	pop    %ebp
+ 2ae:	c3                   	ret
+ 2af:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2b0:	31 c9                	xor    %ecx,%ecx
+}
+ 2b2:	5d                   	pop    %ebp
+ 2b3:	89 c8                	mov    %ecx,%eax
+ 2b5:	c3                   	ret
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	57                   	push   %edi
+ 2c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("cld; rep stosb" :
+ 2c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2cd:	89 d7                	mov    %edx,%edi
+ 2cf:	fc                   	cld
+ 2d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2d5:	89 d0                	mov    %edx,%eax
+ 2d7:	c9                   	leave
+ 2d8:	c3                   	ret
+ 2d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2ea:	0f b6 10             	movzbl (%eax),%edx
+ 2ed:	84 d2                	test   %dl,%dl
+ 2ef:	75 12                	jne    303 <strchr+0x23>
+ 2f1:	eb 1d                	jmp    310 <strchr+0x30>
+ 2f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2f7:	90                   	nop
+ 2f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2fc:	83 c0 01             	add    $0x1,%eax
+ 2ff:	84 d2                	test   %dl,%dl
+ 301:	74 0d                	je     310 <strchr+0x30>
+    if(*s == c)
+ 303:	38 d1                	cmp    %dl,%cl
+ 305:	75 f1                	jne    2f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 307:	5d                   	pop    %ebp
+ 308:	c3                   	ret
+ 309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 310:	31 c0                	xor    %eax,%eax
+}
+ 312:	5d                   	pop    %ebp
+ 313:	c3                   	ret
+ 314:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 31f:	90                   	nop
+
+00000320 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 325:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 328:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 329:	31 db                	xor    %ebx,%ebx
+{
+ 32b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 32e:	eb 27                	jmp    357 <gets+0x37>
+    cc = read(0, &c, 1);
+ 330:	83 ec 04             	sub    $0x4,%esp
+ 333:	6a 01                	push   $0x1
+ 335:	56                   	push   %esi
+ 336:	6a 00                	push   $0x0
+ 338:	e8 00 03 00 00       	call   63d <read>
+    if(cc < 1)
+ 33d:	83 c4 10             	add    $0x10,%esp
+ 340:	85 c0                	test   %eax,%eax
+ 342:	7e 1d                	jle    361 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 344:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 348:	8b 55 08             	mov    0x8(%ebp),%edx
+ 34b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 34f:	3c 0a                	cmp    $0xa,%al
+ 351:	74 10                	je     363 <gets+0x43>
+ 353:	3c 0d                	cmp    $0xd,%al
+ 355:	74 0c                	je     363 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 357:	89 df                	mov    %ebx,%edi
+ 359:	83 c3 01             	add    $0x1,%ebx
+ 35c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 35f:	7c cf                	jl     330 <gets+0x10>
+ 361:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 363:	8b 45 08             	mov    0x8(%ebp),%eax
+ 366:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 36a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 36d:	5b                   	pop    %ebx
+ 36e:	5e                   	pop    %esi
+ 36f:	5f                   	pop    %edi
+ 370:	5d                   	pop    %ebp
+ 371:	c3                   	ret
+ 372:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 379:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000380 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	56                   	push   %esi
+ 384:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 385:	83 ec 08             	sub    $0x8,%esp
+ 388:	6a 00                	push   $0x0
+ 38a:	ff 75 08             	push   0x8(%ebp)
+ 38d:	e8 e2 02 00 00       	call   674 <open>
+  if(fd < 0)
+ 392:	83 c4 10             	add    $0x10,%esp
+ 395:	85 c0                	test   %eax,%eax
+ 397:	78 27                	js     3c0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 399:	83 ec 08             	sub    $0x8,%esp
+ 39c:	ff 75 0c             	push   0xc(%ebp)
+ 39f:	89 c3                	mov    %eax,%ebx
+ 3a1:	50                   	push   %eax
+ 3a2:	e8 ee 02 00 00       	call   695 <fstat>
+  close(fd);
+ 3a7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3aa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3ac:	e8 a2 02 00 00       	call   653 <close>
+  return r;
+ 3b1:	83 c4 10             	add    $0x10,%esp
+}
+ 3b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3b7:	89 f0                	mov    %esi,%eax
+ 3b9:	5b                   	pop    %ebx
+ 3ba:	5e                   	pop    %esi
+ 3bb:	5d                   	pop    %ebp
+ 3bc:	c3                   	ret
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3c5:	eb ed                	jmp    3b4 <stat+0x34>
+ 3c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ce:	66 90                	xchg   %ax,%ax
+
+000003d0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	53                   	push   %ebx
+ 3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3d7:	0f be 02             	movsbl (%edx),%eax
+ 3da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3e5:	77 1e                	ja     405 <atoi+0x35>
+ 3e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3f0:	83 c2 01             	add    $0x1,%edx
+ 3f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3fa:	0f be 02             	movsbl (%edx),%eax
+ 3fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 400:	80 fb 09             	cmp    $0x9,%bl
+ 403:	76 eb                	jbe    3f0 <atoi+0x20>
+  return n;
+}
+ 405:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 408:	89 c8                	mov    %ecx,%eax
+ 40a:	c9                   	leave
+ 40b:	c3                   	ret
+ 40c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000410 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	57                   	push   %edi
+ 414:	56                   	push   %esi
+ 415:	8b 45 10             	mov    0x10(%ebp),%eax
+ 418:	8b 55 08             	mov    0x8(%ebp),%edx
+ 41b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 41e:	85 c0                	test   %eax,%eax
+ 420:	7e 13                	jle    435 <memmove+0x25>
+ 422:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 424:	89 d7                	mov    %edx,%edi
+ 426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 430:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 431:	39 f8                	cmp    %edi,%eax
+ 433:	75 fb                	jne    430 <memmove+0x20>
+  return vdst;
+}
+ 435:	5e                   	pop    %esi
+ 436:	89 d0                	mov    %edx,%eax
+ 438:	5f                   	pop    %edi
+ 439:	5d                   	pop    %ebp
+ 43a:	c3                   	ret
+ 43b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 43f:	90                   	nop
+
+00000440 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 440:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 445:	85 c0                	test   %eax,%eax
+ 447:	74 07                	je     450 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 449:	c3                   	ret
+ 44a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 450:	e9 77 02 00 00       	jmp    6cc <sysgetpid>
+ 455:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 460:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 465:	c3                   	ret
+ 466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000470 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 470:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 471:	31 d2                	xor    %edx,%edx
+ 473:	89 e5                	mov    %esp,%ebp
+ 475:	53                   	push   %ebx
+ 476:	83 ec 04             	sub    $0x4,%esp
+ 479:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 47c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 47f:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 482:	85 c9                	test   %ecx,%ecx
+ 484:	7e 08                	jle    48e <cyclereport+0x1e>
+ 486:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 488:	89 d8                	mov    %ebx,%eax
+ 48a:	f7 f1                	div    %ecx
+ 48c:	89 c2                	mov    %eax,%edx
+ 48e:	83 ec 08             	sub    $0x8,%esp
+ 491:	52                   	push   %edx
+ 492:	ff 75 0c             	push   0xc(%ebp)
+ 495:	51                   	push   %ecx
+ 496:	ff 75 08             	push   0x8(%ebp)
+ 499:	68 39 0c 00 00       	push   $0xc39
+ 49e:	6a 01                	push   $0x1
+ 4a0:	e8 fb 03 00 00       	call   8a0 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 4a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4a8:	83 c4 20             	add    $0x20,%esp
+ 4ab:	c9                   	leave
+ 4ac:	c3                   	ret
+ 4ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004b0 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 4b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 4bc:	5d                   	pop    %ebp
+ 4bd:	c3                   	ret
+ 4be:	66 90                	xchg   %ax,%ax
+
+000004c0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 4c0:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 4c1:	31 c0                	xor    %eax,%eax
+ 4c3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 4c8:	89 e5                	mov    %esp,%ebp
+ 4ca:	56                   	push   %esi
+ 4cb:	53                   	push   %ebx
+ 4cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 4cf:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 4d3:	85 c0                	test   %eax,%eax
+ 4d5:	74 30                	je     507 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 4d7:	83 f8 02             	cmp    $0x2,%eax
+ 4da:	74 0c                	je     4e8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 4dc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4e1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 4e4:	85 c0                	test   %eax,%eax
+ 4e6:	74 1f                	je     507 <mutex_lock+0x47>
+ 4e8:	be 02 00 00 00       	mov    $0x2,%esi
+ 4ed:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 4f0:	83 ec 08             	sub    $0x8,%esp
+ 4f3:	6a 02                	push   $0x2
+ 4f5:	53                   	push   %ebx
+ 4f6:	e8 8c 02 00 00       	call   787 <futex_wait>
+ 4fb:	89 f0                	mov    %esi,%eax
+ 4fd:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 500:	83 c4 10             	add    $0x10,%esp
+ 503:	85 c0                	test   %eax,%eax
+ 505:	75 e9                	jne    4f0 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 507:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 50a:	5b                   	pop    %ebx
+ 50b:	5e                   	pop    %esi
+ 50c:	5d                   	pop    %ebp
+ 50d:	c3                   	ret
+ 50e:	66 90                	xchg   %ax,%ax
+
+00000510 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	83 ec 08             	sub    $0x8,%esp
+ 516:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 519:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 51d:	75 09                	jne    528 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 51f:	c9                   	leave
+ 520:	c3                   	ret
+ 521:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 528:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 52b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 531:	6a 01                	push   $0x1
+ 533:	50                   	push   %eax
+ 534:	e8 59 02 00 00       	call   792 <futex_wake>
+ 539:	83 c4 10             	add    $0x10,%esp
+}
+ 53c:	c9                   	leave
+ 53d:	c3                   	ret
+ 53e:	66 90                	xchg   %ax,%ax
+
+00000540 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 543:	8b 45 08             	mov    0x8(%ebp),%eax
+ 546:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 54c:	5d                   	pop    %ebp
+ 54d:	c3                   	ret
+ 54e:	66 90                	xchg   %ax,%ax
+
+00000550 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	53                   	push   %ebx
+ 556:	83 ec 0c             	sub    $0xc,%esp
+ 559:	8b 75 08             	mov    0x8(%ebp),%esi
+ 55c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 55f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 561:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 565:	75 21                	jne    588 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 567:	83 ec 08             	sub    $0x8,%esp
+ 56a:	57                   	push   %edi
+ 56b:	56                   	push   %esi
+ 56c:	e8 16 02 00 00       	call   787 <futex_wait>
+  mutex_lock(m);
+ 571:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 574:	83 c4 10             	add    $0x10,%esp
+}
+ 577:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 57a:	5b                   	pop    %ebx
+ 57b:	5e                   	pop    %esi
+ 57c:	5f                   	pop    %edi
+ 57d:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 57e:	e9 3d ff ff ff       	jmp    4c0 <mutex_lock>
+ 583:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 587:	90                   	nop
+    futex_wake(&m->v, 1);
+ 588:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 58b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 591:	6a 01                	push   $0x1
+ 593:	53                   	push   %ebx
+ 594:	e8 f9 01 00 00       	call   792 <futex_wake>
+ 599:	83 c4 10             	add    $0x10,%esp
+ 59c:	eb c9                	jmp    567 <cond_wait+0x17>
+ 59e:	66 90                	xchg   %ax,%ax
+
+000005a0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	83 ec 10             	sub    $0x10,%esp
+ 5a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 5a9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 5ad:	6a 01                	push   $0x1
+ 5af:	50                   	push   %eax
+ 5b0:	e8 dd 01 00 00       	call   792 <futex_wake>
+}
+ 5b5:	83 c4 10             	add    $0x10,%esp
+ 5b8:	c9                   	leave
+ 5b9:	c3                   	ret
+ 5ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000005c0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	83 ec 10             	sub    $0x10,%esp
+ 5c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 5c9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 5cd:	68 ff ff ff 7f       	push   $0x7fffffff
+ 5d2:	50                   	push   %eax
+ 5d3:	e8 ba 01 00 00       	call   792 <futex_wake>
+}
+ 5d8:	83 c4 10             	add    $0x10,%esp
+ 5db:	c9                   	leave
+ 5dc:	c3                   	ret
+
+000005dd <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 5dd:	50                   	push   %eax
+  pushl %ebx
+ 5de:	53                   	push   %ebx
+  movl $1, %eax
+ 5df:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 5e4:	0f a2                	cpuid
+  popl %ebx
+ 5e6:	5b                   	pop    %ebx
+  popl %eax
+ 5e7:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 5e8:	c7 05 d0 10 00 00 0e 	movl   $0x60e,0x10d0
+ 5ef:	06 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 5f2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 5f8:	74 14                	je     60e <sysint>
+  movl $sysfast, syscallvec
+ 5fa:	c7 05 d0 10 00 00 04 	movl   $0x604,0x10d0
+ 601:	06 00 00 
+
+00000604 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 604:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 606:	ba 0d 06 00 00       	mov    $0x60d,%edx
+  sysenter
+ 60b:	0f 34                	sysenter
+1:
+  ret
+ 60d:	c3                   	ret
+
+0000060e <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 60e:	cd 40                	int    $0x40
+  ret
+ 610:	c3                   	ret
+
+00000611 <fork>:
+
+SYSCALL(fork)
+ 611:	b8 01 00 00 00       	mov    $0x1,%eax
+ 616:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+0000061c <exit>:
+SYSCALL(exit)
+ 61c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 621:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+00000627 <wait>:
+SYSCALL(wait)
+ 627:	b8 03 00 00 00       	mov    $0x3,%eax
+ 62c:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+00000632 <pipe>:
+SYSCALL(pipe)
+ 632:	b8 04 00 00 00       	mov    $0x4,%eax
+ 637:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+0000063d <read>:
+SYSCALL(read)
+ 63d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 642:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+00000648 <write>:
+SYSCALL(write)
+ 648:	b8 10 00 00 00       	mov    $0x10,%eax
+ 64d:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+00000653 <close>:
+SYSCALL(close)
+ 653:	b8 15 00 00 00       	mov    $0x15,%eax
+ 658:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+0000065e <kill>:
+SYSCALL(kill)
+ 65e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 663:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+00000669 <exec>:
+SYSCALL(exec)
+ 669:	b8 07 00 00 00       	mov    $0x7,%eax
+ 66e:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+00000674 <open>:
+SYSCALL(open)
+ 674:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 679:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+0000067f <mknod>:
+SYSCALL(mknod)
+ 67f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 684:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+0000068a <unlink>:
+SYSCALL(unlink)
+ 68a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 68f:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+00000695 <fstat>:
+SYSCALL(fstat)
+ 695:	b8 08 00 00 00       	mov    $0x8,%eax
+ 69a:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+000006a0 <link>:
+SYSCALL(link)
+ 6a0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6a5:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+000006ab <mkdir>:
+SYSCALL(mkdir)
+ 6ab:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6b0:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+000006b6 <chdir>:
+SYSCALL(chdir)
+ 6b6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6bb:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+000006c1 <dup>:
+SYSCALL(dup)
+ 6c1:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6c6:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+000006cc <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 6cc:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6d1:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+000006d7 <sbrk>:
+SYSCALL(sbrk)
+ 6d7:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6dc:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+000006e2 <sleep>:
+SYSCALL(sleep)
+ 6e2:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6e7:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+000006ed <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 6ed:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 6f2:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+000006f8 <swapread>:
+SYSCALL(swapread)
+ 6f8:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6fd:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+00000703 <swapwrite>:
+SYSCALL(swapwrite)
+ 703:	b8 17 00 00 00       	mov    $0x17,%eax
+ 708:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+0000070e <swapstat>:
+SYSCALL(swapstat)
+ 70e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 713:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+00000719 <madvise>:
+SYSCALL(madvise)
+ 719:	b8 19 00 00 00       	mov    $0x19,%eax
+ 71e:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+00000724 <mlock>:
+SYSCALL(mlock)
+ 724:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 729:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+0000072f <munlock>:
+SYSCALL(munlock)
+ 72f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 734:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+0000073a <membench>:
+SYSCALL(membench)
+ 73a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 73f:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+00000745 <nice>:
+SYSCALL(nice)
+ 745:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 74a:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+00000750 <setpriority>:
+SYSCALL(setpriority)
+ 750:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 755:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+0000075b <usleep>:
+SYSCALL(usleep)
+ 75b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 760:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+00000766 <cpustat>:
+SYSCALL(cpustat)
+ 766:	b8 20 00 00 00       	mov    $0x20,%eax
+ 76b:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+00000771 <clone>:
+SYSCALL(clone)
+ 771:	b8 21 00 00 00       	mov    $0x21,%eax
+ 776:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+0000077c <join>:
+SYSCALL(join)
+ 77c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 781:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+00000787 <futex_wait>:
+SYSCALL(futex_wait)
+ 787:	b8 23 00 00 00       	mov    $0x23,%eax
+ 78c:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+00000792 <futex_wake>:
+SYSCALL(futex_wake)
+ 792:	b8 24 00 00 00       	mov    $0x24,%eax
+ 797:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+0000079d <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 79d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 7a2:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+000007a8 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 7a8:	b8 26 00 00 00       	mov    $0x26,%eax
+ 7ad:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+000007b3 <getcpu>:
+SYSCALL(getcpu)
+ 7b3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 7b8:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+000007be <migrations>:
+SYSCALL(migrations)
+ 7be:	b8 28 00 00 00       	mov    $0x28,%eax
+ 7c3:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+000007c9 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 7c9:	b8 29 00 00 00       	mov    $0x29,%eax
+ 7ce:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+000007d4 <lockstat>:
+SYSCALL(lockstat)
+ 7d4:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 7d9:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+000007df <lockprof>:
+SYSCALL(lockprof)
+ 7df:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 7e4:	ff 25 d0 10 00 00    	jmp    *0x10d0
+
+000007ea <bcachestat>:
+SYSCALL(bcachestat)
+ 7ea:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 7ef:	ff 25 d0 10 00 00    	jmp    *0x10d0
+ 7f5:	66 90                	xchg   %ax,%ax
+ 7f7:	66 90                	xchg   %ax,%ax
+ 7f9:	66 90                	xchg   %ax,%ax
+ 7fb:	66 90                	xchg   %ax,%ax
+ 7fd:	66 90                	xchg   %ax,%ax
+ 7ff:	90                   	nop
+
+00000800 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 800:	55                   	push   %ebp
+ 801:	89 e5                	mov    %esp,%ebp
+ 803:	57                   	push   %edi
+ 804:	56                   	push   %esi
+ 805:	53                   	push   %ebx
+ 806:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 808:	89 d1                	mov    %edx,%ecx
+{
+ 80a:	83 ec 3c             	sub    $0x3c,%esp
+ 80d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 810:	85 d2                	test   %edx,%edx
+ 812:	0f 89 80 00 00 00    	jns    898 <printint+0x98>
+ 818:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 81c:	74 7a                	je     898 <printint+0x98>
+    x = -xx;
+ 81e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 820:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 825:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 828:	31 f6                	xor    %esi,%esi
+ 82a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 830:	89 c8                	mov    %ecx,%eax
+ 832:	31 d2                	xor    %edx,%edx
+ 834:	89 f7                	mov    %esi,%edi
+ 836:	f7 f3                	div    %ebx
+ 838:	8d 76 01             	lea    0x1(%esi),%esi
+ 83b:	0f b6 92 b4 0c 00 00 	movzbl 0xcb4(%edx),%edx
+ 842:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 846:	89 ca                	mov    %ecx,%edx
+ 848:	89 c1                	mov    %eax,%ecx
+ 84a:	39 da                	cmp    %ebx,%edx
+ 84c:	73 e2                	jae    830 <printint+0x30>
+  if(neg)
+ 84e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 851:	85 c0                	test   %eax,%eax
+ 853:	74 07                	je     85c <printint+0x5c>
+    buf[i++] = '-';
+ 855:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 85a:	89 f7                	mov    %esi,%edi
+ 85c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 85f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 862:	01 df                	add    %ebx,%edi
+ 864:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 868:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 86b:	83 ec 04             	sub    $0x4,%esp
+ 86e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 871:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 874:	6a 01                	push   $0x1
+ 876:	50                   	push   %eax
+ 877:	56                   	push   %esi
+ 878:	e8 cb fd ff ff       	call   648 <write>
+  while(--i >= 0)
+ 87d:	89 f8                	mov    %edi,%eax
+ 87f:	83 c4 10             	add    $0x10,%esp
+ 882:	83 ef 01             	sub    $0x1,%edi
+ 885:	39 d8                	cmp    %ebx,%eax
+ 887:	75 df                	jne    868 <printint+0x68>
+}
+ 889:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 88c:	5b                   	pop    %ebx
+ 88d:	5e                   	pop    %esi
+ 88e:	5f                   	pop    %edi
+ 88f:	5d                   	pop    %ebp
+ 890:	c3                   	ret
+ 891:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 898:	31 c0                	xor    %eax,%eax
+ 89a:	eb 89                	jmp    825 <printint+0x25>
+ 89c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 8a0:	55                   	push   %ebp
+ 8a1:	89 e5                	mov    %esp,%ebp
+ 8a3:	57                   	push   %edi
+ 8a4:	56                   	push   %esi
+ 8a5:	53                   	push   %ebx
+ 8a6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 8a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 8ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 8af:	0f b6 1e             	movzbl (%esi),%ebx
+ 8b2:	83 c6 01             	add    $0x1,%esi
+ 8b5:	84 db                	test   %bl,%bl
+ 8b7:	74 67                	je     920 <printf+0x80>
+ 8b9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 8bc:	31 d2                	xor    %edx,%edx
+ 8be:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 8c1:	eb 34                	jmp    8f7 <printf+0x57>
+ 8c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8c7:	90                   	nop
+ 8c8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 8cb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 8d0:	83 f8 25             	cmp    $0x25,%eax
+ 8d3:	74 18                	je     8ed <printf+0x4d>
+  write(fd, &c, 1);
+ 8d5:	83 ec 04             	sub    $0x4,%esp
+ 8d8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 8db:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8de:	6a 01                	push   $0x1
+ 8e0:	50                   	push   %eax
+ 8e1:	57                   	push   %edi
+ 8e2:	e8 61 fd ff ff       	call   648 <write>
+ 8e7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 8ea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 8ed:	0f b6 1e             	movzbl (%esi),%ebx
+ 8f0:	83 c6 01             	add    $0x1,%esi
+ 8f3:	84 db                	test   %bl,%bl
+ 8f5:	74 29                	je     920 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 8f7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 8fa:	85 d2                	test   %edx,%edx
+ 8fc:	74 ca                	je     8c8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 8fe:	83 fa 25             	cmp    $0x25,%edx
+ 901:	75 ea                	jne    8ed <printf+0x4d>
+      if(c == 'd'){
+ 903:	83 f8 25             	cmp    $0x25,%eax
+ 906:	0f 84 24 01 00 00    	je     a30 <printf+0x190>
+ 90c:	83 e8 63             	sub    $0x63,%eax
+ 90f:	83 f8 15             	cmp    $0x15,%eax
+ 912:	77 1c                	ja     930 <printf+0x90>
+ 914:	ff 24 85 5c 0c 00 00 	jmp    *0xc5c(,%eax,4)
+ 91b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 91f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 920:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 923:	5b                   	pop    %ebx
+ 924:	5e                   	pop    %esi
+ 925:	5f                   	pop    %edi
+ 926:	5d                   	pop    %ebp
+ 927:	c3                   	ret
+ 928:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 92f:	90                   	nop
+  write(fd, &c, 1);
+ 930:	83 ec 04             	sub    $0x4,%esp
+ 933:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 936:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 93a:	6a 01                	push   $0x1
+ 93c:	52                   	push   %edx
+ 93d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 940:	57                   	push   %edi
+ 941:	e8 02 fd ff ff       	call   648 <write>
+ 946:	83 c4 0c             	add    $0xc,%esp
+ 949:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 94c:	6a 01                	push   $0x1
+ 94e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 951:	52                   	push   %edx
+ 952:	57                   	push   %edi
+ 953:	e8 f0 fc ff ff       	call   648 <write>
+        putc(fd, c);
+ 958:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 95b:	31 d2                	xor    %edx,%edx
+ 95d:	eb 8e                	jmp    8ed <printf+0x4d>
+ 95f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 960:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 963:	83 ec 0c             	sub    $0xc,%esp
+ 966:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 96b:	8b 13                	mov    (%ebx),%edx
+ 96d:	6a 00                	push   $0x0
+ 96f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 971:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 974:	e8 87 fe ff ff       	call   800 <printint>
+        ap++;
+ 979:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 97c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 97f:	31 d2                	xor    %edx,%edx
+ 981:	e9 67 ff ff ff       	jmp    8ed <printf+0x4d>
+ 986:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 990:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 993:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 995:	83 c0 04             	add    $0x4,%eax
+ 998:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 99b:	85 db                	test   %ebx,%ebx
+ 99d:	0f 84 9d 00 00 00    	je     a40 <printf+0x1a0>
+        while(*s != 0){
+ 9a3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 9a6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 9a8:	84 c0                	test   %al,%al
+ 9aa:	0f 84 3d ff ff ff    	je     8ed <printf+0x4d>
+ 9b0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9b3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 9b6:	89 de                	mov    %ebx,%esi
+ 9b8:	89 d3                	mov    %edx,%ebx
+ 9ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 9c0:	83 ec 04             	sub    $0x4,%esp
+ 9c3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 9c6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 9c9:	6a 01                	push   $0x1
+ 9cb:	53                   	push   %ebx
+ 9cc:	57                   	push   %edi
+ 9cd:	e8 76 fc ff ff       	call   648 <write>
+        while(*s != 0){
+ 9d2:	0f b6 06             	movzbl (%esi),%eax
+ 9d5:	83 c4 10             	add    $0x10,%esp
+ 9d8:	84 c0                	test   %al,%al
+ 9da:	75 e4                	jne    9c0 <printf+0x120>
+      state = 0;
+ 9dc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 9df:	31 d2                	xor    %edx,%edx
+ 9e1:	e9 07 ff ff ff       	jmp    8ed <printf+0x4d>
+ 9e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ed:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 9f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9f3:	83 ec 0c             	sub    $0xc,%esp
+ 9f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 9fb:	8b 13                	mov    (%ebx),%edx
+ 9fd:	6a 01                	push   $0x1
+ 9ff:	e9 6b ff ff ff       	jmp    96f <printf+0xcf>
+ a04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a08:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a0b:	83 ec 04             	sub    $0x4,%esp
+ a0e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a11:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a13:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a16:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a19:	6a 01                	push   $0x1
+ a1b:	52                   	push   %edx
+ a1c:	57                   	push   %edi
+ a1d:	e8 26 fc ff ff       	call   648 <write>
+        ap++;
+ a22:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a25:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a28:	31 d2                	xor    %edx,%edx
+ a2a:	e9 be fe ff ff       	jmp    8ed <printf+0x4d>
+ a2f:	90                   	nop
+  write(fd, &c, 1);
+ a30:	83 ec 04             	sub    $0x4,%esp
+ a33:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a36:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a39:	6a 01                	push   $0x1
+ a3b:	e9 11 ff ff ff       	jmp    951 <printf+0xb1>
+ a40:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ a45:	bb 54 0c 00 00       	mov    $0xc54,%ebx
+ a4a:	e9 61 ff ff ff       	jmp    9b0 <printf+0x110>
+ a4f:	90                   	nop
+
+00000a50 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a50:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a51:	a1 d4 10 00 00       	mov    0x10d4,%eax
+{
+ a56:	89 e5                	mov    %esp,%ebp
+ a58:	57                   	push   %edi
+ a59:	56                   	push   %esi
+ a5a:	53                   	push   %ebx
+ a5b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ a5e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a68:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a6a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a6c:	39 ca                	cmp    %ecx,%edx
+ a6e:	73 30                	jae    aa0 <free+0x50>
+ a70:	39 c1                	cmp    %eax,%ecx
+ a72:	72 04                	jb     a78 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a74:	39 c2                	cmp    %eax,%edx
+ a76:	72 f0                	jb     a68 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a78:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a7b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a7e:	39 f8                	cmp    %edi,%eax
+ a80:	74 2e                	je     ab0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a82:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a85:	8b 42 04             	mov    0x4(%edx),%eax
+ a88:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a8b:	39 f1                	cmp    %esi,%ecx
+ a8d:	74 38                	je     ac7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a8f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a91:	5b                   	pop    %ebx
+  freep = p;
+ a92:	89 15 d4 10 00 00    	mov    %edx,0x10d4
+}
+ a98:	5e                   	pop    %esi
+ a99:	5f                   	pop    %edi
+ a9a:	5d                   	pop    %ebp
+ a9b:	c3                   	ret
+ a9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ aa0:	39 c1                	cmp    %eax,%ecx
+ aa2:	72 d0                	jb     a74 <free+0x24>
+ aa4:	eb c2                	jmp    a68 <free+0x18>
+ aa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ ab0:	03 70 04             	add    0x4(%eax),%esi
+ ab3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ab6:	8b 02                	mov    (%edx),%eax
+ ab8:	8b 00                	mov    (%eax),%eax
+ aba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ abd:	8b 42 04             	mov    0x4(%edx),%eax
+ ac0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ac3:	39 f1                	cmp    %esi,%ecx
+ ac5:	75 c8                	jne    a8f <free+0x3f>
+    p->s.size += bp->s.size;
+ ac7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ aca:	89 15 d4 10 00 00    	mov    %edx,0x10d4
+    p->s.size += bp->s.size;
+ ad0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ad3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ ad6:	89 0a                	mov    %ecx,(%edx)
+}
+ ad8:	5b                   	pop    %ebx
+ ad9:	5e                   	pop    %esi
+ ada:	5f                   	pop    %edi
+ adb:	5d                   	pop    %ebp
+ adc:	c3                   	ret
+ add:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ae0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ ae0:	55                   	push   %ebp
+ ae1:	89 e5                	mov    %esp,%ebp
+ ae3:	57                   	push   %edi
+ ae4:	56                   	push   %esi
+ ae5:	53                   	push   %ebx
+ ae6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ae9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ aec:	8b 15 d4 10 00 00    	mov    0x10d4,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ af2:	8d 78 07             	lea    0x7(%eax),%edi
+ af5:	c1 ef 03             	shr    $0x3,%edi
+ af8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ afb:	85 d2                	test   %edx,%edx
+ afd:	0f 84 8d 00 00 00    	je     b90 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b03:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b05:	8b 48 04             	mov    0x4(%eax),%ecx
+ b08:	39 f9                	cmp    %edi,%ecx
+ b0a:	73 64                	jae    b70 <malloc+0x90>
+  if(nu < 4096)
+ b0c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b11:	39 df                	cmp    %ebx,%edi
+ b13:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b16:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b1d:	eb 0a                	jmp    b29 <malloc+0x49>
+ b1f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b20:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b22:	8b 48 04             	mov    0x4(%eax),%ecx
+ b25:	39 f9                	cmp    %edi,%ecx
+ b27:	73 47                	jae    b70 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ b29:	89 c2                	mov    %eax,%edx
+ b2b:	39 05 d4 10 00 00    	cmp    %eax,0x10d4
+ b31:	75 ed                	jne    b20 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ b33:	83 ec 0c             	sub    $0xc,%esp
+ b36:	56                   	push   %esi
+ b37:	e8 9b fb ff ff       	call   6d7 <sbrk>
+  if(p == (char*)-1)
+ b3c:	83 c4 10             	add    $0x10,%esp
+ b3f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b42:	74 1c                	je     b60 <malloc+0x80>
+  hp->s.size = nu;
+ b44:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ b47:	83 ec 0c             	sub    $0xc,%esp
+ b4a:	83 c0 08             	add    $0x8,%eax
+ b4d:	50                   	push   %eax
+ b4e:	e8 fd fe ff ff       	call   a50 <free>
+  return freep;
+ b53:	8b 15 d4 10 00 00    	mov    0x10d4,%edx
+      if((p = morecore(nunits)) == 0)
+ b59:	83 c4 10             	add    $0x10,%esp
+ b5c:	85 d2                	test   %edx,%edx
+ b5e:	75 c0                	jne    b20 <malloc+0x40>
+        return 0;
+  }
+}
+ b60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b63:	31 c0                	xor    %eax,%eax
+}
+ b65:	5b                   	pop    %ebx
+ b66:	5e                   	pop    %esi
+ b67:	5f                   	pop    %edi
+ b68:	5d                   	pop    %ebp
+ b69:	c3                   	ret
+ b6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b70:	39 cf                	cmp    %ecx,%edi
+ b72:	74 4c                	je     bc0 <malloc+0xe0>
+        p->s.size -= nunits;
+ b74:	29 f9                	sub    %edi,%ecx
+ b76:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ b79:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ b7c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ b7f:	89 15 d4 10 00 00    	mov    %edx,0x10d4
+}
+ b85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b88:	83 c0 08             	add    $0x8,%eax
+}
+ b8b:	5b                   	pop    %ebx
+ b8c:	5e                   	pop    %esi
+ b8d:	5f                   	pop    %edi
+ b8e:	5d                   	pop    %ebp
+ b8f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b90:	c7 05 d4 10 00 00 d8 	movl   $0x10d8,0x10d4
+ b97:	10 00 00 
+    base.s.size = 0;
+ b9a:	b8 d8 10 00 00       	mov    $0x10d8,%eax
+    base.s.ptr = freep = prevp = &base;
+ b9f:	c7 05 d8 10 00 00 d8 	movl   $0x10d8,0x10d8
+ ba6:	10 00 00 
+    base.s.size = 0;
+ ba9:	c7 05 dc 10 00 00 00 	movl   $0x0,0x10dc
+ bb0:	00 00 00 
+    if(p->s.size >= nunits){
+ bb3:	e9 54 ff ff ff       	jmp    b0c <malloc+0x2c>
+ bb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bbf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ bc0:	8b 08                	mov    (%eax),%ecx
+ bc2:	89 0a                	mov    %ecx,(%edx)
+ bc4:	eb b9                	jmp    b7f <malloc+0x9f>
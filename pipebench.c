@@ -0,0 +1,69 @@
+// Pipe round-trip latency: a byte bounced between two
+// processes over a pair of pipes.  Each round trip blocks
+// and wakes each side once, so it is dominated by the cost
+// of handing the CPU from one process to the other.  Runs
+// with both processes pinned to one CPU, where every hand-off
+// is a switch on that CPU, and then unpinned.
+// usage: pipebench [trips]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "x86.h"
+
+void
+pingpong(char *what, int trips, int pin)
+{
+  int a[2], b[2], i;
+  uint64 t;
+  char c;
+
+  if(pipe(a) < 0 || pipe(b) < 0){
+    printf(1, "pipebench: pipe failed\n");
+    exit();
+  }
+  if(pin && sched_setaffinity(0, 1) < 0){
+    printf(1, "pipebench: sched_setaffinity failed\n");
+    exit();
+  }
+  if(fork() == 0){
+    close(a[1]);
+    close(b[0]);
+    while(read(a[0], &c, 1) == 1)
+      write(b[1], &c, 1);
+    exit();
+  }
+  close(a[0]);
+  close(b[1]);
+
+  c = 0;
+  t = rdtsc();
+  for(i = 0; i < trips; i++){
+    write(a[1], &c, 1);
+    if(read(b[0], &c, 1) != 1){
+      printf(1, "pipebench: short read\n");
+      break;
+    }
+  }
+  t = rdtsc() - t;
+  close(a[1]);
+  close(b[0]);
+  wait();
+  sched_setaffinity(0, ~0);
+  cyclereport(what, "round trips", t, trips);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int trips;
+
+  trips = 10000;
+  if(argc > 1)
+    trips = atoi(argv[1]);
+  if(trips < 1)
+    trips = 1;
+  pingpong("one cpu", trips, 1);
+  pingpong("any cpu", trips, 0);
+  exit();
+}
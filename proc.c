@@ -4,26 +4,65 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "x86.h"
-#include "proc.h"
 #include "spinlock.h"
-
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+#include "proc.h"
+#include "traps.h"
+
+// Each process has its own lock, and each CPU its own run
+// queue, so that scheduling on one CPU does not serialize
+// with the others.  Locks are taken in this order:
+//   ptable.waitlock, wait queue lock, p->lock, run queue lock.
+// ptable.pidlock is taken on its own, or last.
+//
+// Procs are allocated a page at a time as needed, and never
+// given back: an unused one goes on a free list for the next
+// fork.  So a pointer to a proc always points to one, if not
+// always the same process; see findproc().
 struct {
-  struct spinlock lock;
-  struct proc proc[NPROC];
+  struct spinlock pidlock;     // Protects nextpid, nproc, pidhash, free
+  struct spinlock waitlock;    // Protects parent, children, vmnext
+  int nproc;                   // Procs in use
+  struct proc *free;           // Unused procs, linked by pidnext
+  struct proc *all;            // All procs, linked by allnext
+  struct proc *pidhash[NPIDHASH];
 } ptable;
 
+// Sleeping processes, hashed by the channel they sleep on,
+// so that wakeup() only looks at sleepers that may match.
+struct waitq {
+  struct spinlock lock;
+  struct proc *head;           // Linked through p->wqnext
+} waitq[NWAITQ];
+
 static struct proc *initproc;
 
+// Serializes growproc(), so that threads sharing an address
+// space do not grow it at the same time.
+static struct sleeplock growlock;
+
 int nextpid = 1;
+static int quantum0 = QUANTUM * TICKJIFFIES;  // jiffies, at level 0
 extern void forkret(void);
 extern void trapret(void);
 
-static void wakeup1(void *chan);
-
 void
 pinit(void)
 {
-  initlock(&ptable.lock, "ptable");
+  struct cpu *c;
+  int i;
+
+  initlock(&ptable.pidlock, "nextpid");
+  initlock(&ptable.waitlock, "wait");
+  initsleeplock(&growlock, "growproc");
+  for(c = cpus; c < &cpus[NCPU]; c++)
+    initlock(&c->rqlock, "runq");
+  for(i = 0; i < NWAITQ; i++)
+    initlock(&waitq[i].lock, "waitq");
+  if((i = fwcfgint("opt/xv6/quantum", 0)) > 0)
+    quantum0 = i;
 }
 
 // Must be called with interrupts disabled
@@ -33,41 +72,534 @@ cpuid() {
 }
 
 // Must be called with interrupts disabled to avoid the caller being
-// rescheduled between reading lapicid and running through the loop.
+// rescheduled onto another CPU while it uses the result.
+// %gs is this CPU's segment (see seginit), and %gs:0 its c->self.
+// volatile, so that gcc does not reuse the load across a swtch.
 struct cpu*
 mycpu(void)
 {
-  int apicid, i;
-  
-  if(readeflags()&FL_IF)
-    panic("mycpu called with interrupts enabled\n");
-  
-  apicid = lapicid();
-  // APIC IDs are not guaranteed to be contiguous. Maybe we should have
-  // a reverse map, or reserve a register to store &cpus[i].
-  for (i = 0; i < ncpu; ++i) {
-    if (cpus[i].apicid == apicid)
-      return &cpus[i];
-  }
-  panic("unknown apicid\n");
+  struct cpu *c;
+
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+  return c;
 }
 
-// Disable interrupts so that we are not rescheduled
-// while reading proc from the cpu structure
+// The process running on this CPU, or 0.
 struct proc*
 myproc(void) {
+  struct proc *p;
+
+  // One load of this CPU's c->proc, so it needs no pushcli():
+  // whichever CPU it runs on, the answer is the caller.
+  asm volatile("movl %%gs:%c1, %0"
+               : "=r" (p) : "i" (__builtin_offsetof(struct cpu, proc)));
+  return p;
+}
+
+// Take a proc off the free list, carving a new page into
+// procs if it is empty, and give it a pid.  Returns 0 if
+// there are NPROC processes already or no memory.
+static struct proc*
+procget(void)
+{
+  struct proc *p;
+  char *mem;
+  int i;
+
+  acquire(&ptable.pidlock);
+  while(ptable.free == 0){
+    release(&ptable.pidlock);
+    if((mem = kalloc()) == 0)
+      return 0;
+    memset(mem, 0, PGSIZE);
+    acquire(&ptable.pidlock);
+    for(i = 0; i + sizeof(*p) <= PGSIZE; i += sizeof(*p)){
+      p = (struct proc*)(mem + i);
+      initlock(&p->lock, "proc");
+      p->allnext = ptable.all;
+      ptable.all = p;
+      p->pidnext = ptable.free;
+      ptable.free = p;
+    }
+  }
+  if(ptable.nproc >= NPROC){
+    release(&ptable.pidlock);
+    return 0;
+  }
+  p = ptable.free;
+  ptable.free = p->pidnext;
+  ptable.nproc++;
+  p->pid = nextpid++;
+  p->pidnext = ptable.pidhash[p->pid % NPIDHASH];
+  ptable.pidhash[p->pid % NPIDHASH] = p;
+  release(&ptable.pidlock);
+  return p;
+}
+
+// Put p, now UNUSED, back on the free list.
+static void
+procput(struct proc *p)
+{
+  struct proc **pp;
+
+  acquire(&ptable.pidlock);
+  for(pp = &ptable.pidhash[p->pid % NPIDHASH]; *pp != p; pp = &(*pp)->pidnext)
+    ;
+  *pp = p->pidnext;
+  p->pid = 0;
+  p->pidnext = ptable.free;
+  ptable.free = p;
+  ptable.nproc--;
+  release(&ptable.pidlock);
+}
+
+// The process with the given pid, locked, or 0 if there
+// is none.  A proc found in the hash may be reaped before
+// it is locked, and even reused; it is still a proc, so
+// check that it is the one wanted once locked.
+static struct proc*
+findproc(int pid)
+{
+  struct proc *p;
+
+  acquire(&ptable.pidlock);
+  for(p = ptable.pidhash[(uint)pid % NPIDHASH]; p; p = p->pidnext)
+    if(p->pid == pid)
+      break;
+  release(&ptable.pidlock);
+  if(p == 0)
+    return 0;
+  acquire(&p->lock);
+  if(p->pid != pid || p->state == UNUSED){
+    release(&p->lock);
+    return 0;
+  }
+  return p;
+}
+
+//PAGEBREAK!
+// Scheduling is a multi-level feedback queue.  A process
+// starts at level p->nice and drops one level each time it
+// uses up its quantum there, which doubles at every level.
+// Processes that block before their quantum is gone keep
+// their level, so interactive ones stay above CPU hogs.
+// Every BOOSTTICKS ticks all processes go back to their
+// nice level, so that nothing starves.  The level 0 quantum
+// can be set in milliseconds when booting under QEMU with
+// -fw_cfg name=opt/xv6/quantum,string=N (make QUANTUM=N).
+
+// Jiffies a process may run at level prio.
+static int
+quantum(int prio)
+{
+  return quantum0 << prio;
+}
+
+// Apply the latest boost to p, if it has not seen it yet.
+static void
+boost(struct proc *p)
+{
+  uint epoch;
+
+  epoch = ticks / BOOSTTICKS;
+  if(p->epoch != epoch){
+    p->epoch = epoch;
+    p->prio = p->nice;
+    p->runtime = 0;
+  }
+}
+
+// Append p to c's queue for p's level.  Caller holds c->rqlock.
+static void
+runqappend(struct cpu *c, struct proc *p)
+{
+  boost(p);
+  p->rqnext = 0;
+  if(c->rqtail[p->prio])
+    c->rqtail[p->prio]->rqnext = p;
+  else
+    c->rqhead[p->prio] = p;
+  c->rqtail[p->prio] = p;
+}
+
+// Append p to the run queue of CPU c.
+static void
+runqput(struct cpu *c, struct proc *p)
+{
+  acquire(&c->rqlock);
+  runqappend(c, p);
+  c->rqlen++;
+  release(&c->rqlock);
+}
+
+// May p run on CPU c?
+static int
+allowed(struct proc *p, struct cpu *c)
+{
+  return (p->affinity & (1U << (c - cpus))) != 0;
+}
+
+// Return the first process of the highest level of c's run
+// queue that may run on CPU self, taking it off the queue if
+// take is set.  Caller holds c->rqlock.
+static struct proc*
+runqfind(struct cpu *c, struct cpu *self, int take)
+{
+  struct proc *p, *prev, **pp;
+  int i;
+
+  for(i = 0; i < NPRIO; i++){
+    prev = 0;
+    for(pp = &c->rqhead[i]; (p = *pp) != 0; pp = &p->rqnext){
+      if(!allowed(p, self)){
+        prev = p;
+        continue;
+      }
+      if(take){
+        *pp = p->rqnext;
+        if(c->rqtail[i] == p)
+          c->rqtail[i] = prev;
+        c->rqlen--;
+      }
+      return p;
+    }
+  }
+  return 0;
+}
+
+// Take p off c's run queue if it is there.  Returns 1 if it was.
+// Caller holds c->rqlock.
+static int
+runqremove(struct cpu *c, struct proc *p)
+{
+  struct proc *q, *prev, **pp;
+  int i;
+
+  for(i = 0; i < NPRIO; i++){
+    prev = 0;
+    for(pp = &c->rqhead[i]; (q = *pp) != 0; pp = &q->rqnext){
+      if(q == p){
+        *pp = p->rqnext;
+        if(c->rqtail[i] == p)
+          c->rqtail[i] = prev;
+        c->rqlen--;
+        return 1;
+      }
+      prev = q;
+    }
+  }
+  return 0;
+}
+
+// Remove and return the first process of the highest
+// non-empty level of the run queue of c that may run on
+// CPU self.
+static struct proc*
+runqget(struct cpu *c, struct cpu *self)
+{
+  struct proc *p, *q;
+  uint epoch;
+  int i;
+
+  acquire(&c->rqlock);
+  epoch = ticks / BOOSTTICKS;
+  if(c->epoch != epoch){
+    // Move the demoted processes back up.
+    c->epoch = epoch;
+    for(i = 1; i < NPRIO; i++){
+      p = c->rqhead[i];
+      c->rqhead[i] = c->rqtail[i] = 0;
+      for(; p; p = q){
+        q = p->rqnext;
+        runqappend(c, p);
+      }
+    }
+  }
+  p = runqfind(c, self, 1);
+  release(&c->rqlock);
+  return p;
+}
+
+// Take a process that may run here from the longest run queue
+// of another CPU, or failing that from any other.  The lengths
+// are read without locks; they only pick the victim.
+static struct proc*
+steal(struct cpu *self)
+{
+  struct cpu *c, *busiest;
+  struct proc *p;
+
+  busiest = 0;
+  for(c = cpus; c < cpus+ncpu; c++)
+    if(c != self && c->rqlen > 0 &&
+       (busiest == 0 || c->rqlen > busiest->rqlen))
+      busiest = c;
+  if(busiest == 0)
+    return 0;
+  p = runqget(busiest, self);
+  for(c = cpus; p == 0 && c < cpus+ncpu; c++)
+    if(c != self && c != busiest && c->rqlen > 0)
+      p = runqget(c, self);
+  if(p == 0)
+    return 0;
+  self->nsteal++;
+  return p;
+}
+
+// Charge the process running on this CPU for the jiffies
+// since it was last charged.  Returns 1 if it should yield:
+// its quantum is used up, in which case it also drops a
+// level, or a process of a higher level is waiting here.
+int
+schedtick(void)
+{
   struct cpu *c;
   struct proc *p;
+  uint now;
+  int i, r;
+
   pushcli();
   c = mycpu();
   p = c->proc;
+  r = 0;
+  if(p){
+    boost(p);
+    now = jiffynow();
+    p->runtime += now - c->lastcharge;
+    c->lastcharge = now;
+    if(p->runtime >= quantum(p->prio)){
+      if(p->prio < NPRIO-1)
+        p->prio++;
+      p->runtime = 0;
+      r = 1;
+    }
+    for(i = 0; i < p->prio; i++)
+      if(c->rqhead[i])
+        r = 1;
+  }
   popcli();
-  return p;
+  return r;
+}
+
+// Jiffies from now until this CPU should next look at its
+// running process, for timerarm(): when its quantum runs out,
+// and at least every tick, so that it still notices processes
+// of higher levels queued behind it.  -1 if the CPU is idle.
+// Interrupts must be off.
+int
+schednext(uint now)
+{
+  struct cpu *c;
+  struct proc *p;
+  int n;
+
+  c = mycpu();
+  if((p = c->proc) == 0)
+    return -1;
+  n = quantum(p->prio) - p->runtime - (now - c->lastcharge);
+  if(n > TICKJIFFIES)
+    n = TICKJIFFIES;
+  if(n < 1)
+    n = 1;
+  return n;
+}
+
+// Set the nice level of process pid: the highest level it
+// runs at, and the one it returns to at each boost.
+int
+setpriority(int pid, int nice)
+{
+  struct proc *p;
+
+  if(nice < 0 || nice >= NPRIO)
+    return -1;
+  if((p = findproc(pid)) == 0)
+    return -1;
+  p->nice = nice;
+  if(p->state != RUNNABLE){
+    // A queued process keeps its place until the next boost.
+    p->prio = nice;
+    p->runtime = 0;
+  }
+  release(&p->lock);
+  return 0;
+}
+
+// Is anything queued that CPU self may run?
+static int
+anyqueued(struct cpu *self)
+{
+  struct cpu *c;
+  int found;
+
+  for(c = cpus; c < cpus+ncpu; c++){
+    if(c->rqlen == 0)
+      continue;
+    if(c == self)
+      return 1;
+    acquire(&c->rqlock);
+    found = runqfind(c, self, 0) != 0;
+    release(&c->rqlock);
+    if(found)
+      return 1;
+  }
+  return 0;
+}
+
+// Get p, just queued on CPU c, running soon.  Wake c if it
+// is halted; otherwise, unless c is about to run p itself
+// (it is idle, or p is yielding), wake one halted CPU that
+// may run p, so that it can steal it.
+static void
+kick(struct cpu *c, struct proc *p)
+{
+  struct cpu *d, *self;
+
+  self = mycpu();
+  if(c != self && c->idle && xchg(&c->idle, 0)){
+    lapicipi(c->apicid, T_IRQ0 + IRQ_RESCHED);
+    return;
+  }
+  if(c->rqlen <= (c->proc == 0 || c->proc == p))
+    return;
+  for(d = cpus; d < cpus+ncpu; d++){
+    if(d != self && d != c && allowed(p, d) &&
+       d->idle && xchg(&d->idle, 0)){
+      lapicipi(d->apicid, T_IRQ0 + IRQ_RESCHED);
+      return;
+    }
+  }
+}
+
+// Choose the run queue for p.  Soft affinity: the CPU it last
+// ran on, whose cache may still be warm, if that one is halted
+// or no busier than this one; otherwise this one, or if p may
+// not run here, the least busy CPU that it may run on.
+static struct cpu*
+pickcpu(struct proc *p)
+{
+  struct cpu *c, *self, *best;
+
+  self = mycpu();
+  if(p->lastcpu >= 0 && p->lastcpu < ncpu){
+    c = &cpus[p->lastcpu];
+    if(allowed(p, c) && (c->idle || c->rqlen <= self->rqlen))
+      return c;
+  }
+  if(allowed(p, self))
+    return self;
+  best = 0;
+  for(c = cpus; c < cpus+ncpu; c++)
+    if(allowed(p, c) && (best == 0 || c->rqlen < best->rqlen))
+      best = c;
+  if(best == 0)
+    panic("pickcpu");
+  return best;
+}
+
+// Halt this CPU until the next interrupt, unless there is
+// work to run.  Setting c->idle before looking at the queues,
+// while runqput() queues before kick() looks at c->idle, means
+// that either we see the new process or its waker sees us.
+// sti takes effect only after the next instruction, so the
+// IPI cannot slip in between it and the hlt.
+static void
+idle(struct cpu *c)
+{
+  uint64 t;
+
+  cli();
+  xchg(&c->idle, 1);
+  if(!anyqueued(c)){
+    timerarm();
+    t = rdtsc();
+    asm volatile("sti; hlt");
+    c->idlecycles += rdtsc() - t;
+  }
+  c->idle = 0;
+}
+
+// Mark p RUNNABLE and queue it on a CPU it may run on.
+// Caller must hold p->lock.
+static void
+makerunnable(struct proc *p)
+{
+  struct cpu *c;
+
+  p->state = RUNNABLE;
+  c = pickcpu(p);
+  runqput(c, p);
+  kick(c, p);
+}
+
+// Restrict process pid, or the caller if pid is 0, to the CPUs
+// in mask.  A queued process moves to a CPU it may run on now;
+// a running one moves the next time it is scheduled, which for
+// the caller is at once.  Returns -1 if there is no such process
+// or mask has no CPUs in it.
+int
+setaffinity(int pid, uint mask)
+{
+  struct proc *p, *curproc = myproc();
+  struct cpu *c;
+  int move;
+
+  if(ncpu < 32)
+    mask &= (1U << ncpu) - 1;
+  if(mask == 0)
+    return -1;
+  if(pid == 0)
+    pid = curproc->pid;
+  if((p = findproc(pid)) == 0)
+    return -1;
+  p->affinity = mask;
+  if(p->state == RUNNABLE){
+    for(c = cpus; c < cpus+ncpu; c++){
+      if(allowed(p, c))
+        continue;
+      acquire(&c->rqlock);
+      move = runqremove(c, p);
+      release(&c->rqlock);
+      if(move){
+        makerunnable(p);
+        break;
+      }
+    }
+  }
+  release(&p->lock);
+  if(p == curproc){
+    pushcli();
+    move = !allowed(p, mycpu());
+    popcli();
+    if(move)
+      yield();
+  }
+  return 0;
+}
+
+// The CPUs process pid, or the caller if pid is 0, may run on,
+// with its migration count in *nmigrate.  -1 if there is none.
+int
+getaffinity(int pid, uint *nmigrate)
+{
+  struct proc *p;
+  int mask;
+
+  if(pid == 0)
+    pid = myproc()->pid;
+  if((p = findproc(pid)) == 0)
+    return -1;
+  mask = p->affinity;
+  if(ncpu < 32)
+    mask &= (1U << ncpu) - 1;
+  *nmigrate = p->nmigrate;
+  release(&p->lock);
+  return mask;
 }
 
 //PAGEBREAK: 32
-// Look in the process table for an UNUSED proc.
-// If found, change state to EMBRYO and initialize
+// Get an UNUSED proc.
+// If there is one, change state to EMBRYO and initialize
 // state required to run in the kernel.
 // Otherwise return 0.
 static struct proc*
@@ -76,24 +608,24 @@ allocproc(void)
   struct proc *p;
   char *sp;
 
-  acquire(&ptable.lock);
-
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == UNUSED)
-      goto found;
-
-  release(&ptable.lock);
-  return 0;
-
-found:
+  if((p = procget()) == 0)
+    return 0;
+  acquire(&p->lock);
   p->state = EMBRYO;
-  p->pid = nextpid++;
-
-  release(&ptable.lock);
+  p->affinity = ~0;
+  p->lastcpu = -1;
+  p->nmigrate = 0;
+  p->fpuused = 0;
+  p->fpucpu = -1;
+  p->vmnext = p;
+  release(&p->lock);
 
   // Allocate kernel stack.
   if((p->kstack = kalloc()) == 0){
+    acquire(&p->lock);
     p->state = UNUSED;
+    release(&p->lock);
+    procput(p);
     return 0;
   }
   sp = p->kstack + KSTACKSIZE;
@@ -129,6 +661,8 @@ userinit(void)
   if((p->pgdir = setupkvm()) == 0)
     panic("userinit: out of memory?");
   inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
+  if(mapinfo(p->pgdir, p->pid) < 0)
+    panic("userinit: out of memory?");
   p->sz = PGSIZE;
   memset(p->tf, 0, sizeof(*p->tf));
   p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
@@ -140,38 +674,92 @@ userinit(void)
   p->tf->eip = 0;  // beginning of initcode.S
 
   safestrcpy(p->name, "initcode", sizeof(p->name));
-  p->cwd = namei("/");
+  if((p->fdt = fdtalloc()) == 0)
+    panic("userinit: out of memory?");
+  p->fdt->cwd = namei("/");
 
   // this assignment to p->state lets other cores
   // run this process. the acquire forces the above
   // writes to be visible, and the lock is also needed
   // because the assignment might not be atomic.
-  acquire(&ptable.lock);
+  acquire(&p->lock);
 
-  p->state = RUNNABLE;
+  makerunnable(p);
+
+  release(&p->lock);
+}
+
+// Take p out of the ring of threads sharing its pgdir, and
+// return whether it was the last one in it.  Threads made by
+// clone() share their creator's pgdir, and the last of them
+// to be reaped frees it.  Caller holds ptable.waitlock.
+static int
+vmleave(struct proc *p)
+{
+  struct proc *q;
+
+  if(p->vmnext == p)
+    return 1;
+  for(q = p->vmnext; q->vmnext != p; q = q->vmnext)
+    ;
+  q->vmnext = p->vmnext;
+  p->vmnext = p;
+  return 0;
+}
 
-  release(&ptable.lock);
+// Give the current process the address space pgdir, for exec().
+// Returns the old one if it is now unused and should be freed,
+// 0 if other threads still run in it.
+pde_t*
+vmreplace(pde_t *pgdir)
+{
+  struct proc *curproc = myproc();
+  pde_t *old;
+
+  acquire(&ptable.waitlock);
+  old = curproc->pgdir;
+  curproc->pgdir = pgdir;
+  if(!vmleave(curproc))
+    old = 0;
+  release(&ptable.waitlock);
+  return old;
 }
 
-// Grow current process's memory by n bytes.
-// Return 0 on success, -1 on failure.
+// Grow current process's memory by n bytes, for it and
+// every thread that shares its address space.
+// Return the old size on success, -1 on failure.
 int
 growproc(int n)
 {
-  uint sz;
+  uint sz, oldsz;
   struct proc *curproc = myproc();
+  struct proc *p;
 
-  sz = curproc->sz;
+  acquiresleep(&growlock);
+  sz = oldsz = curproc->sz;
   if(n > 0){
-    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0){
+      releasesleep(&growlock);
       return -1;
+    }
   } else if(n < 0){
-    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    // Not while another thread's system call is using the pages.
+    if(revokeuvm(curproc->pgdir, sz, sz + n) < 0 ||
+       (sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0){
+      releasesleep(&growlock);
       return -1;
+    }
   }
-  curproc->sz = sz;
+  acquire(&ptable.waitlock);
+  p = curproc;
+  do {
+    p->sz = sz;
+    p = p->vmnext;
+  } while(p != curproc);
+  release(&ptable.waitlock);
   switchuvm(curproc);
-  return 0;
+  releasesleep(&growlock);
+  return oldsz;
 }
 
 // Create a new process copying p as the parent.
@@ -180,7 +768,7 @@ growproc(int n)
 int
 fork(void)
 {
-  int i, pid;
+  int pid;
   struct proc *np;
   struct proc *curproc = myproc();
 
@@ -190,33 +778,121 @@ fork(void)
   }
 
   // Copy process state from proc.
-  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
+  if((np->fdt = fdtcopy(curproc->fdt)) == 0 ||
+     (np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0 ||
+     mapinfo(np->pgdir, np->pid) < 0){
+    if(np->fdt)
+      fdtput(np->fdt);
+    np->fdt = 0;
+    if(np->pgdir)
+      freevm(np->pgdir);
+    np->pgdir = 0;
     kfree(np->kstack);
     np->kstack = 0;
+    acquire(&np->lock);
     np->state = UNUSED;
+    release(&np->lock);
+    procput(np);
     return -1;
   }
   np->sz = curproc->sz;
-  np->parent = curproc;
+  np->affinity = curproc->affinity;
+  np->nice = curproc->nice;
+  np->prio = np->nice;
+  np->runtime = 0;
   *np->tf = *curproc->tf;
+  fpufork(np);
 
   // Clear %eax so that fork returns 0 in the child.
   np->tf->eax = 0;
 
-  for(i = 0; i < NOFILE; i++)
-    if(curproc->ofile[i])
-      np->ofile[i] = filedup(curproc->ofile[i]);
-  np->cwd = idup(curproc->cwd);
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+
+  pid = np->pid;
+
+  acquire(&ptable.waitlock);
+  np->parent = curproc;
+  np->sibling = curproc->children;
+  curproc->children = np;
+  release(&ptable.waitlock);
+
+  acquire(&np->lock);
+
+  makerunnable(np);
+
+  release(&np->lock);
+
+  return pid;
+}
+
+// Create a thread: a process that shares the caller's address
+// space, open files and cwd.
+// It runs fn(arg1, arg2) on the page-aligned, page-sized user
+// stack at stack, and must not return from fn.  Returns the
+// thread's pid, for join().
+int
+clone(void (*fn)(void*, void*), void *arg1, void *arg2, void *stack)
+{
+  int pid;
+  uint sp, ustack[3];
+  struct proc *np;
+  struct proc *curproc = myproc();
+
+  if((uint)stack % PGSIZE != 0 || (uint)stack + PGSIZE > curproc->sz)
+    return -1;
+  if((np = allocproc()) == 0)
+    return -1;
+
+  // Fake return PC and the arguments, at the top of the stack.
+  sp = (uint)stack + PGSIZE - sizeof(ustack);
+  ustack[0] = 0xffffffff;
+  ustack[1] = (uint)arg1;
+  ustack[2] = (uint)arg2;
+  if(copyout(curproc->pgdir, sp, ustack, sizeof(ustack)) < 0 &&
+     (swap_fault(curproc->pgdir, sp) < 0 ||
+      copyout(curproc->pgdir, sp, ustack, sizeof(ustack)) < 0)){
+    kfree(np->kstack);
+    np->kstack = 0;
+    acquire(&np->lock);
+    np->state = UNUSED;
+    release(&np->lock);
+    procput(np);
+    return -1;
+  }
+
+  np->pgdir = curproc->pgdir;
+  np->sz = curproc->sz;
+  np->thread = 1;
+  np->ustack = stack;
+  np->affinity = curproc->affinity;
+  np->nice = curproc->nice;
+  np->prio = np->nice;
+  np->runtime = 0;
+  *np->tf = *curproc->tf;
+  np->tf->eip = (uint)fn;
+  np->tf->esp = sp;
+  np->fdt = fdtdup(curproc->fdt);
 
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
 
   pid = np->pid;
 
-  acquire(&ptable.lock);
+  acquire(&ptable.waitlock);
+  np->parent = curproc;
+  np->sibling = curproc->children;
+  curproc->children = np;
+  np->vmnext = curproc->vmnext;
+  curproc->vmnext = np;
+  release(&ptable.waitlock);
+  // Its procinfo page is now the threads', so getpid()
+  // has to ask the kernel.
+  setinfopid(curproc->pgdir, 0);
+
+  acquire(&np->lock);
 
-  np->state = RUNNABLE;
+  makerunnable(np);
 
-  release(&ptable.lock);
+  release(&np->lock);
 
   return pid;
 }
@@ -229,85 +905,153 @@ exit(void)
 {
   struct proc *curproc = myproc();
   struct proc *p;
-  int fd;
 
   if(curproc == initproc)
     panic("init exiting");
 
-  // Close all open files.
-  for(fd = 0; fd < NOFILE; fd++){
-    if(curproc->ofile[fd]){
-      fileclose(curproc->ofile[fd]);
-      curproc->ofile[fd] = 0;
-    }
-  }
-
-  begin_op();
-  iput(curproc->cwd);
-  end_op();
-  curproc->cwd = 0;
+  // Close all open files, unless other threads share them.
+  fdtput(curproc->fdt);
+  curproc->fdt = 0;
 
-  acquire(&ptable.lock);
+  acquire(&ptable.waitlock);
 
   // Parent might be sleeping in wait().
-  wakeup1(curproc->parent);
-
-  // Pass abandoned children to init.
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->parent == curproc){
-      p->parent = initproc;
-      if(p->state == ZOMBIE)
-        wakeup1(initproc);
-    }
+  wakeup(curproc->parent);
+
+  // Pass abandoned children to init, which reaps threads
+  // with wait() too.  A child only becomes a ZOMBIE with
+  // waitlock held, so its state is stable here.
+  while((p = curproc->children) != 0){
+    curproc->children = p->sibling;
+    p->parent = initproc;
+    p->thread = 0;
+    p->sibling = initproc->children;
+    initproc->children = p;
+    if(p->state == ZOMBIE)
+      wakeup(initproc);
   }
 
   // Jump into the scheduler, never to return.
+  acquire(&curproc->lock);
   curproc->state = ZOMBIE;
+  release(&ptable.waitlock);
   sched();
   panic("zombie exit");
 }
 
-// Wait for a child process to exit and return its pid.
-// Return -1 if this process has no children.
-int
-wait(void)
+// Wait for a child that is a thread if thread is set, or a
+// process if not, to exit.  Free it and return its pid, and
+// its user stack in *stack for a thread.  Return -1 if this
+// process has no such children.
+static int
+reap(int thread, void **stack)
 {
-  struct proc *p;
+  struct proc *p, **pp;
   int havekids, pid;
+  pde_t *pgdir;
   struct proc *curproc = myproc();
   
-  acquire(&ptable.lock);
+  acquire(&ptable.waitlock);
   for(;;){
-    // Scan through table looking for exited children.
+    // Scan through children looking for exited ones.
     havekids = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->parent != curproc)
+    for(pp = &curproc->children; (p = *pp) != 0; pp = &p->sibling){
+      if(p->thread != thread)
         continue;
       havekids = 1;
+      // The child's lock is held until it has switched
+      // off its kernel stack for the last time.
+      acquire(&p->lock);
       if(p->state == ZOMBIE){
         // Found one.
+        *pp = p->sibling;
         pid = p->pid;
+        if(stack)
+          *stack = p->ustack;
         kfree(p->kstack);
         p->kstack = 0;
-        freevm(p->pgdir);
-        p->pid = 0;
+        // Freed below, once no locks are held: see tlbshootdown().
+        pgdir = vmleave(p) ? p->pgdir : 0;
+        p->pgdir = 0;
         p->parent = 0;
+        p->sibling = 0;
         p->name[0] = 0;
         p->killed = 0;
+        p->nice = 0;
+        p->thread = 0;
+        p->ustack = 0;
         p->state = UNUSED;
-        release(&ptable.lock);
+        release(&p->lock);
+        procput(p);
+        release(&ptable.waitlock);
+        if(pgdir)
+          freevm(pgdir);
         return pid;
       }
+      release(&p->lock);
     }
 
     // No point waiting if we don't have any children.
     if(!havekids || curproc->killed){
-      release(&ptable.lock);
+      release(&ptable.waitlock);
       return -1;
     }
 
-    // Wait for children to exit.  (See wakeup1 call in proc_exit.)
-    sleep(curproc, &ptable.lock);  //DOC: wait-sleep
+    // Wait for children to exit.  (See wakeup call in proc_exit.)
+    sleep(curproc, &ptable.waitlock);  //DOC: wait-sleep
+  }
+}
+
+// Wait for a child process to exit and return its pid.
+// Return -1 if this process has no children.
+int
+wait(void)
+{
+  return reap(0, 0);
+}
+
+// Wait for a thread made by clone() to exit and return its
+// pid, with the user stack it was given in *stack.
+// Return -1 if this process has no threads.
+int
+join(void **stack)
+{
+  return reap(1, stack);
+}
+
+// Make p, locked and just taken off a run queue, the process
+// running on CPU c.
+static void
+dispatch(struct cpu *c, struct proc *p)
+{
+  if(p->state != RUNNABLE)
+    panic("dispatch: not runnable");
+  if(p->lastcpu != c - cpus){
+    if(p->lastcpu >= 0)
+      p->nmigrate++;
+    p->lastcpu = c - cpus;
+  }
+  c->proc = p;
+  switchuvm(p);
+  fpuenter(p);
+  p->state = RUNNING;
+  c->lastcharge = jiffynow();
+  timerarm();
+}
+
+// Called just after being switched to, by a process that was
+// switched to directly by another: release the other's lock,
+// which it held until it was off its stack.
+static void
+finishswitch(void)
+{
+  struct cpu *c;
+  struct proc *prev;
+
+  c = mycpu();
+  if((prev = c->prev) != 0){
+    c->prev = 0;
+    release(&prev->lock);
   }
 }
 
@@ -315,7 +1059,8 @@ wait(void)
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
 // Scheduler never returns.  It loops, doing:
-//  - choose a process to run
+//  - take the first process off this CPU's run queue,
+//    or steal one from the busiest other CPU
 //  - swtch to start running that process
 //  - eventually that process transfers control
 //      via swtch back to the scheduler.
@@ -325,59 +1070,93 @@ scheduler(void)
   struct proc *p;
   struct cpu *c = mycpu();
   c->proc = 0;
+  c->starttsc = rdtsc();
   
   for(;;){
     // Enable interrupts on this processor.
     sti();
+    rcuquiesce(c);
 
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
-        continue;
-
-      // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
-      // before jumping back to us.
-      c->proc = p;
-      switchuvm(p);
-      p->state = RUNNING;
-
-      swtch(&(c->scheduler), p->context);
-      switchkvm();
-
-      // Process is done running for now.
-      // It should have changed its p->state before coming back.
-      c->proc = 0;
+    if((p = runqget(c, c)) == 0 && (p = steal(c)) == 0){
+      idle(c);
+      continue;
     }
-    release(&ptable.lock);
 
+    // Switch to chosen process.  It is the process's job
+    // to release p->lock and then reacquire it
+    // before jumping back to us.  If p only just queued
+    // itself on another CPU, this waits until that CPU
+    // is off p's stack.
+    acquire(&p->lock);
+    dispatch(c, p);
+    swtch(&(c->scheduler), p->context);
+    switchkvm();
+
+    // Process is done running for now.
+    // It should have changed its p->state before coming back.
+    // It need not be the one we switched to: processes hand
+    // the CPU to each other directly (see sched).
+    p = c->proc;
+    c->proc = 0;
+    release(&p->lock);
   }
 }
 
-// Enter scheduler.  Must hold only ptable.lock
+// Enter scheduler.  Must hold only p->lock
 // and have changed proc->state. Saves and restores
 // intena because intena is a property of this
 // kernel thread, not this CPU. It should
 // be proc->intena and proc->ncli, but that would
 // break in the few places where a lock is held but
 // there's no process.
+//
+// If another process is queued here, switch straight to it
+// rather than to the scheduler and from there to it: one
+// context switch per hand-off instead of two, which is what
+// blocking ping-pong between processes does all the time.
+// The next process then releases p->lock (finishswitch).
 void
 sched(void)
 {
   int intena;
   struct proc *p = myproc();
+  struct proc *q;
+  struct cpu *c = mycpu();
 
-  if(!holding(&ptable.lock))
-    panic("sched ptable.lock");
-  if(mycpu()->ncli != 1)
+  if(!holding(&p->lock))
+    panic("sched p->lock");
+  if(c->ncli != 1)
     panic("sched locks");
   if(p->state == RUNNING)
     panic("sched running");
   if(readeflags()&FL_IF)
     panic("sched interruptible");
-  intena = mycpu()->intena;
-  swtch(&p->context, mycpu()->scheduler);
+  rcuquiesce(c);
+  intena = c->intena;
+  q = runqget(c, c);
+  if(q == p){
+    // Yielded, and nothing else may run here first.
+    p->state = RUNNING;
+    c->lastcharge = jiffynow();
+    timerarm();
+    c->intena = intena;
+    return;
+  }
+  if(q && !tryacquire(&q->lock)){
+    // Still on its way off another CPU's stack: let
+    // the scheduler wait for it, not us with p->lock.
+    runqput(c, q);
+    q = 0;
+  }
+  fpuleave(p);
+  if(q){
+    c->prev = p;
+    dispatch(c, q);
+    swtch(&p->context, q->context);
+  } else
+    swtch(&p->context, c->scheduler);
+  // Back, from the scheduler or straight from another process.
+  finishswitch();
   mycpu()->intena = intena;
 }
 
@@ -385,10 +1164,12 @@ sched(void)
 void
 yield(void)
 {
-  acquire(&ptable.lock);  //DOC: yieldlock
-  myproc()->state = RUNNABLE;
+  struct proc *p = myproc();
+
+  acquire(&p->lock);  //DOC: yieldlock
+  makerunnable(p);
   sched();
-  release(&ptable.lock);
+  release(&p->lock);
 }
 
 // A fork child's very first scheduling by scheduler()
@@ -397,8 +1178,10 @@ void
 forkret(void)
 {
   static int first = 1;
-  // Still holding ptable.lock from scheduler.
-  release(&ptable.lock);
+  // Still holding p->lock from scheduler, or from the
+  // process that switched to us, which holds its own too.
+  finishswitch();
+  release(&myproc()->lock);
 
   if (first) {
     // Some initialization functions must be run in the context
@@ -412,12 +1195,20 @@ forkret(void)
   // Return to "caller", actually trapret (see allocproc).
 }
 
+static struct waitq*
+waitqof(void *chan)
+{
+  return &waitq[(((uint)chan * 2654435761U) >> 16) % NWAITQ];
+}
+
 // Atomically release lock and sleep on chan.
 // Reacquires lock when awakened.
 void
 sleep(void *chan, struct spinlock *lk)
 {
   struct proc *p = myproc();
+  struct waitq *wq;
+  struct proc **pp;
   
   if(p == 0)
     panic("sleep");
@@ -425,52 +1216,73 @@ sleep(void *chan, struct spinlock *lk)
   if(lk == 0)
     panic("sleep without lk");
 
-  // Must acquire ptable.lock in order to
-  // change p->state and then call sched.
-  // Once we hold ptable.lock, we can be
-  // guaranteed that we won't miss any wakeup
-  // (wakeup runs with ptable.lock locked),
+  // Must acquire the wait queue lock in order to
+  // join the queue, and p->lock to change p->state
+  // and then call sched.  Once we hold the wait
+  // queue lock, we can be guaranteed that we won't
+  // miss any wakeup (wakeup runs with it locked),
   // so it's okay to release lk.
-  if(lk != &ptable.lock){  //DOC: sleeplock0
-    acquire(&ptable.lock);  //DOC: sleeplock1
-    release(lk);
-  }
+  wq = waitqof(chan);
+  acquire(&wq->lock);  //DOC: sleeplock1
+  acquire(&p->lock);
+  release(lk);
+
   // Go to sleep.
   p->chan = chan;
+  p->wqnext = wq->head;
+  wq->head = p;
   p->state = SLEEPING;
+  release(&wq->lock);
 
   sched();
-
-  // Tidy up.
+  release(&p->lock);
+
+  // Tidy up.  Wakers leave us on the queue, so that
+  // kill() does not need the wait queue lock.
+  acquire(&wq->lock);
+  for(pp = &wq->head; *pp != p; pp = &(*pp)->wqnext)
+    ;
+  *pp = p->wqnext;
   p->chan = 0;
+  release(&wq->lock);
 
   // Reacquire original lock.
-  if(lk != &ptable.lock){  //DOC: sleeplock2
-    release(&ptable.lock);
-    acquire(lk);
-  }
+  acquire(lk);
 }
 
 //PAGEBREAK!
 // Wake up all processes sleeping on chan.
-// The ptable lock must be held.
-static void
-wakeup1(void *chan)
+// Must be called without any p->lock.
+void
+wakeup(void *chan)
 {
-  struct proc *p;
-
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+  wakeupn(chan, NPROC);
 }
 
-// Wake up all processes sleeping on chan.
-void
-wakeup(void *chan)
+// Wake up at most n processes sleeping on chan, most recent
+// sleeper first.  Returns the number woken.
+int
+wakeupn(void *chan, int n)
 {
-  acquire(&ptable.lock);
-  wakeup1(chan);
-  release(&ptable.lock);
+  struct waitq *wq;
+  struct proc *p;
+  int woken;
+
+  woken = 0;
+  wq = waitqof(chan);
+  acquire(&wq->lock);
+  for(p = wq->head; p && woken < n; p = p->wqnext){
+    if(p->chan != chan)
+      continue;
+    acquire(&p->lock);
+    if(p->state == SLEEPING){
+      makerunnable(p);
+      woken++;
+    }
+    release(&p->lock);
+  }
+  release(&wq->lock);
+  return woken;
 }
 
 // Kill the process with the given pid.
@@ -481,19 +1293,14 @@ kill(int pid)
 {
   struct proc *p;
 
-  acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->pid == pid){
-      p->killed = 1;
-      // Wake process from sleep if necessary.
-      if(p->state == SLEEPING)
-        p->state = RUNNABLE;
-      release(&ptable.lock);
-      return 0;
-    }
-  }
-  release(&ptable.lock);
-  return -1;
+  if((p = findproc(pid)) == 0)
+    return -1;
+  p->killed = 1;
+  // Wake process from sleep if necessary.
+  if(p->state == SLEEPING)
+    makerunnable(p);
+  release(&p->lock);
+  return 0;
 }
 
 //PAGEBREAK: 36
@@ -513,17 +1320,19 @@ procdump(void)
   };
   int i;
   struct proc *p;
+  struct cpu *c;
   char *state;
   uint pc[10];
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.all; p; p = p->allnext){
     if(p->state == UNUSED)
       continue;
     if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
       state = states[p->state];
     else
       state = "???";
-    cprintf("%d %s %s", p->pid, state, p->name);
+    cprintf("%d %s %s %d cpu%d %d migrations", p->pid, state, p->name,
+            p->prio, p->lastcpu, p->nmigrate);
     if(p->state == SLEEPING){
       getcallerpcs((uint*)p->context->ebp+2, pc);
       for(i=0; i<10 && pc[i] != 0; i++)
@@ -531,4 +1340,6 @@ procdump(void)
     }
     cprintf("\n");
   }
+  for(c = cpus; c < cpus+ncpu; c++)
+    cprintf("cpu%d: %d queued, %d stolen\n", c-cpus, c->rqlen, c->nsteal);
 }
@@ -1,13 +1,34 @@
 // Per-CPU state
 struct cpu {
+  struct cpu *self;            // &cpus[i], at %gs:0; see seginit()
   uchar apicid;                // Local APIC ID
   struct context *scheduler;   // swtch() here to enter scheduler
+  uint dbstack[2];             // With ts.link, room for a debug trap
+                               // at sysentry; see debugentry
   struct taskstate ts;         // Used by x86 to find stack for interrupt
   struct segdesc gdt[NSEGS];   // x86 global descriptor table
   volatile uint started;       // Has the CPU started?
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  struct proc *prev;           // Process to unlock after a direct switch
+  struct spinlock rqlock;      // Protects the run queue
+  struct proc *rqhead[NPRIO];  // RUNNABLE processes, a FIFO per level
+  struct proc *rqtail[NPRIO];
+  int rqlen;                   // Length of the run queue
+  uint epoch;                  // Last priority boost applied to it
+  uint nsteal;                 // Processes taken from other CPUs' queues
+  volatile uint idle;          // Halted, or about to; see idle()
+  uint nipi;                   // Reschedule IPIs received
+  uint64 starttsc;             // TSC when the scheduler started
+  uint64 idlecycles;           // TSC cycles spent halted
+  volatile uint deadline;      // Jiffy the timer is armed for (cpu 0)
+  uint lastcharge;             // Jiffy proc was last charged up to
+  uint ntimer;                 // Timer interrupts taken
+  volatile int tlbflush;       // TLB flush requested; see tlbshootdown()
+  struct proc *fpuowner;       // Whose FPU registers it last loaded
+  uint nfpu;                   // FPU state loads on #NM
+  volatile uint rcugen;        // Quiescent states passed; see rcu.c
 };
 
 extern struct cpu cpus[NCPU];
@@ -34,8 +55,21 @@ struct context {
 
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
+// A range of user memory a system call has pinned; see fetchptr().
+struct pinned {
+  uint addr;                   // Page-aligned
+  uint len;
+};
+
 // Per-process state
+// p->lock must be held when using state and killed.
+// ptable.waitlock must be held when using parent, children,
+// sibling and vmnext.
+// The lock of the wait queue for chan guards chan and wqnext.
+// rqnext belongs to the run queue the process is on; prio,
+// runtime and epoch to that queue, or to the CPU running it.
 struct proc {
+  struct spinlock lock;
   uint sz;                     // Size of process memory (bytes)
   pde_t* pgdir;                // Page table
   char *kstack;                // Bottom of kernel stack for this process
@@ -46,9 +80,29 @@ struct proc {
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
   int killed;                  // If non-zero, have been killed
-  struct file *ofile[NOFILE];  // Open files
-  struct inode *cwd;           // Current directory
+  struct fdtable *fdt;         // Open files and cwd; see file.h
   char name[16];               // Process name (debugging)
+  struct proc *rqnext;         // Next on its CPU's run queue
+  struct proc *wqnext;         // Next sleeper in the same wait queue
+  int nice;                    // Highest level it may run at
+  int prio;                    // Current level, 0 is highest
+  int runtime;                 // Jiffies run at the current level
+  uint epoch;                  // Priority boost prio was reset in
+  uint affinity;               // Mask of CPUs it may run on
+  int lastcpu;                 // CPU it last ran on, -1 if none
+  uint nmigrate;               // Times it ran on a different CPU
+  int thread;                  // Made by clone(), reaped by join()
+  void *ustack;                // User stack passed to clone()
+  int fpuused;                 // Has FPU state in fpu; see fpu.c
+  int fpucpu;                  // CPU whose registers hold it, or -1
+  struct proc *children;       // First child; see wait()
+  struct proc *sibling;        // Next child of the same parent
+  struct proc *vmnext;         // Next thread sharing pgdir, circular
+  struct proc *pidnext;        // Next in pid hash chain or free list
+  struct proc *allnext;        // Next of all procs; see procdump()
+  struct pinned pins[NPINARG]; // User memory the current system call uses
+  int npins;                   // ... how many ranges of it
+  uchar fpu[512] __attribute__((aligned(16)));  // fxsave area
 };
 
 // Process memory is laid out contiguously, low addresses first:
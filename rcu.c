@@ -0,0 +1,64 @@
+// Read-copy-update, enough of it for lock-free lookups.
+//
+// A reader brackets its lookup with rcureadlock() and
+// rcureadunlock(), which only turn interrupts off: a reader
+// cannot be preempted and may not sleep, so a CPU is done with
+// every read section it was in once it calls sched() or goes
+// round its scheduler loop.  Each CPU counts those quiescent
+// states in c->rcugen.
+//
+// A writer unlinks an object so that no new reader can find
+// it, then calls rcusync(), which waits out a grace period:
+// until each other CPU has passed a quiescent state, or is
+// idle.  After that no reader can still hold a pointer to
+// the object, and it may be reused.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "proc.h"
+
+// Start a read section.  Nests.
+void
+rcureadlock(void)
+{
+  pushcli();
+}
+
+void
+rcureadunlock(void)
+{
+  popcli();
+}
+
+// Note a quiescent state: this CPU is in no read section.
+void
+rcuquiesce(struct cpu *c)
+{
+  c->rcugen++;
+}
+
+// Wait for every read section in progress to end.
+// Caller must be a process, in no read section.
+void
+rcusync(void)
+{
+  uint gen[NCPU];
+  struct cpu *c, *me;
+
+  pushcli();
+  me = mycpu();
+  for(c = cpus; c < cpus+ncpu; c++)
+    gen[c - cpus] = c->rcugen;
+  popcli();
+
+  for(c = cpus; c < cpus+ncpu; c++){
+    if(c == me)
+      continue;
+    while(c->started && !c->idle && c->rcugen == gen[c - cpus])
+      yield();
+  }
+}
@@ -0,0 +1,1851 @@
+
+_readbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         nproc, n, udiv64(t, n));
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 39                	mov    (%ecx),%edi
+  16:	8b 51 04             	mov    0x4(%ecx),%edx
+  int fd, i, j, nproc, nblocks, n;
+
+  nproc = NPROCS;
+  nblocks = 4;
+  n = 500;
+  if(argc > 1)
+  19:	83 ff 01             	cmp    $0x1,%edi
+  1c:	0f 8f 09 01 00 00    	jg     12b <main+0x12b>
+  if(nproc > 10)
+    nproc = 10;
+  if(nblocks < 1)
+    nblocks = 1;
+
+  memset(buf, 'r', sizeof(buf));
+  22:	50                   	push   %eax
+  if(nblocks < 1)
+  23:	bb 04 00 00 00       	mov    $0x4,%ebx
+  memset(buf, 'r', sizeof(buf));
+  28:	68 00 02 00 00       	push   $0x200
+  2d:	6a 72                	push   $0x72
+  2f:	68 a0 11 00 00       	push   $0x11a0
+  34:	e8 47 03 00 00       	call   380 <memset>
+  if(nproc > 10)
+  39:	c7 45 e0 04 00 00 00 	movl   $0x4,-0x20(%ebp)
+  memset(buf, 'r', sizeof(buf));
+  40:	83 c4 10             	add    $0x10,%esp
+  n = 500;
+  43:	c7 45 dc f4 01 00 00 	movl   $0x1f4,-0x24(%ebp)
+  if(nblocks < 1)
+  4a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < nproc; i++){
+    name[2] = '0' + i;
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+  58:	83 ec 08             	sub    $0x8,%esp
+    name[2] = '0' + i;
+  5b:	0f b6 45 e4          	movzbl -0x1c(%ebp),%eax
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+  5f:	68 02 02 00 00       	push   $0x202
+  64:	68 90 11 00 00       	push   $0x1190
+    name[2] = '0' + i;
+  69:	83 c0 30             	add    $0x30,%eax
+  6c:	a2 92 11 00 00       	mov    %al,0x1192
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+  71:	e8 be 06 00 00       	call   734 <open>
+  76:	83 c4 10             	add    $0x10,%esp
+  79:	89 c7                	mov    %eax,%edi
+  7b:	85 c0                	test   %eax,%eax
+  7d:	0f 88 91 00 00 00    	js     114 <main+0x114>
+      printf(1, "readbench: create %s failed\n", name);
+      exit();
+    }
+    for(j = 0; j < nblocks; j++)
+  83:	31 f6                	xor    %esi,%esi
+  85:	8d 76 00             	lea    0x0(%esi),%esi
+      write(fd, buf, sizeof(buf));
+  88:	83 ec 04             	sub    $0x4,%esp
+    for(j = 0; j < nblocks; j++)
+  8b:	83 c6 01             	add    $0x1,%esi
+      write(fd, buf, sizeof(buf));
+  8e:	68 00 02 00 00       	push   $0x200
+  93:	68 a0 11 00 00       	push   $0x11a0
+  98:	57                   	push   %edi
+  99:	e8 6a 06 00 00       	call   708 <write>
+    for(j = 0; j < nblocks; j++)
+  9e:	83 c4 10             	add    $0x10,%esp
+  a1:	39 f3                	cmp    %esi,%ebx
+  a3:	75 e3                	jne    88 <main+0x88>
+    close(fd);
+  a5:	83 ec 0c             	sub    $0xc,%esp
+  a8:	57                   	push   %edi
+  a9:	e8 65 06 00 00       	call   713 <close>
+  for(i = 0; i < nproc; i++){
+  ae:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+  b2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  b5:	83 c4 10             	add    $0x10,%esp
+  b8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  bb:	39 d0                	cmp    %edx,%eax
+  bd:	7c 99                	jl     58 <main+0x58>
+  }
+
+  for(i = 1; i <= nproc; i *= 2)
+  bf:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  c2:	be 01 00 00 00       	mov    $0x1,%esi
+  c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ce:	66 90                	xchg   %ax,%ax
+    run(i, nblocks, n);
+  d0:	83 ec 04             	sub    $0x4,%esp
+  d3:	57                   	push   %edi
+  d4:	53                   	push   %ebx
+  d5:	56                   	push   %esi
+  for(i = 1; i <= nproc; i *= 2)
+  d6:	01 f6                	add    %esi,%esi
+    run(i, nblocks, n);
+  d8:	e8 e3 00 00 00       	call   1c0 <run>
+  for(i = 1; i <= nproc; i *= 2)
+  dd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  e0:	83 c4 10             	add    $0x10,%esp
+  e3:	39 c6                	cmp    %eax,%esi
+  e5:	7e e9                	jle    d0 <main+0xd0>
+
+  for(i = 0; i < nproc; i++){
+  e7:	31 db                	xor    %ebx,%ebx
+  e9:	89 c6                	mov    %eax,%esi
+  eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ef:	90                   	nop
+    name[2] = '0' + i;
+    unlink(name);
+  f0:	83 ec 0c             	sub    $0xc,%esp
+    name[2] = '0' + i;
+  f3:	8d 43 30             	lea    0x30(%ebx),%eax
+  for(i = 0; i < nproc; i++){
+  f6:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+  f9:	68 90 11 00 00       	push   $0x1190
+    name[2] = '0' + i;
+  fe:	a2 92 11 00 00       	mov    %al,0x1192
+    unlink(name);
+ 103:	e8 42 06 00 00       	call   74a <unlink>
+  for(i = 0; i < nproc; i++){
+ 108:	83 c4 10             	add    $0x10,%esp
+ 10b:	39 f3                	cmp    %esi,%ebx
+ 10d:	7c e1                	jl     f0 <main+0xf0>
+  }
+  exit();
+ 10f:	e8 c8 05 00 00       	call   6dc <exit>
+      printf(1, "readbench: create %s failed\n", name);
+ 114:	52                   	push   %edx
+ 115:	68 90 11 00 00       	push   $0x1190
+ 11a:	68 a3 0c 00 00       	push   $0xca3
+ 11f:	6a 01                	push   $0x1
+ 121:	e8 3a 08 00 00       	call   960 <printf>
+      exit();
+ 126:	e8 b1 05 00 00       	call   6dc <exit>
+    nproc = atoi(argv[1]);
+ 12b:	83 ec 0c             	sub    $0xc,%esp
+ 12e:	ff 72 04             	push   0x4(%edx)
+ 131:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 134:	e8 57 03 00 00       	call   490 <atoi>
+  if(argc > 2)
+ 139:	83 c4 10             	add    $0x10,%esp
+    nproc = atoi(argv[1]);
+ 13c:	89 c6                	mov    %eax,%esi
+  if(argc > 2)
+ 13e:	83 ff 02             	cmp    $0x2,%edi
+ 141:	74 65                	je     1a8 <main+0x1a8>
+    nblocks = atoi(argv[2]);
+ 143:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 146:	83 ec 0c             	sub    $0xc,%esp
+ 149:	ff 72 08             	push   0x8(%edx)
+ 14c:	e8 3f 03 00 00       	call   490 <atoi>
+  if(argc > 3)
+ 151:	83 c4 10             	add    $0x10,%esp
+    nblocks = atoi(argv[2]);
+ 154:	89 c3                	mov    %eax,%ebx
+  if(argc > 3)
+ 156:	83 ff 03             	cmp    $0x3,%edi
+ 159:	74 5b                	je     1b6 <main+0x1b6>
+    n = atoi(argv[3]);
+ 15b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 15e:	83 ec 0c             	sub    $0xc,%esp
+ 161:	ff 72 0c             	push   0xc(%edx)
+ 164:	e8 27 03 00 00       	call   490 <atoi>
+ 169:	83 c4 10             	add    $0x10,%esp
+ 16c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  if(nproc > 10)
+ 16f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  if(nblocks < 1)
+ 174:	b8 01 00 00 00       	mov    $0x1,%eax
+  if(nproc > 10)
+ 179:	39 fe                	cmp    %edi,%esi
+ 17b:	0f 4e fe             	cmovle %esi,%edi
+  if(nblocks < 1)
+ 17e:	85 db                	test   %ebx,%ebx
+ 180:	0f 4e d8             	cmovle %eax,%ebx
+  if(nproc > 10)
+ 183:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  memset(buf, 'r', sizeof(buf));
+ 186:	51                   	push   %ecx
+ 187:	68 00 02 00 00       	push   $0x200
+ 18c:	6a 72                	push   $0x72
+ 18e:	68 a0 11 00 00       	push   $0x11a0
+ 193:	e8 e8 01 00 00       	call   380 <memset>
+  for(i = 0; i < nproc; i++){
+ 198:	83 c4 10             	add    $0x10,%esp
+ 19b:	85 f6                	test   %esi,%esi
+ 19d:	0f 8f a7 fe ff ff    	jg     4a <main+0x4a>
+ 1a3:	e9 67 ff ff ff       	jmp    10f <main+0x10f>
+  n = 500;
+ 1a8:	c7 45 dc f4 01 00 00 	movl   $0x1f4,-0x24(%ebp)
+  nblocks = 4;
+ 1af:	bb 04 00 00 00       	mov    $0x4,%ebx
+ 1b4:	eb b9                	jmp    16f <main+0x16f>
+  n = 500;
+ 1b6:	c7 45 dc f4 01 00 00 	movl   $0x1f4,-0x24(%ebp)
+ 1bd:	eb b0                	jmp    16f <main+0x16f>
+ 1bf:	90                   	nop
+
+000001c0 <run>:
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	57                   	push   %edi
+ 1c4:	56                   	push   %esi
+ 1c5:	53                   	push   %ebx
+ 1c6:	83 ec 1c             	sub    $0x1c,%esp
+ 1c9:	8b 75 08             	mov    0x8(%ebp),%esi
+
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+ 1cc:	0f 31                	rdtsc
+ 1ce:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 1d1:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  for(i = 0; i < nproc; i++){
+ 1d4:	85 f6                	test   %esi,%esi
+ 1d6:	7e 2e                	jle    206 <run+0x46>
+ 1d8:	31 db                	xor    %ebx,%ebx
+ 1da:	eb 06                	jmp    1e2 <run+0x22>
+ 1dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1e0:	89 c3                	mov    %eax,%ebx
+    if(fork() == 0){
+ 1e2:	e8 ea 04 00 00       	call   6d1 <fork>
+ 1e7:	85 c0                	test   %eax,%eax
+ 1e9:	74 53                	je     23e <run+0x7e>
+  for(i = 0; i < nproc; i++){
+ 1eb:	8d 43 01             	lea    0x1(%ebx),%eax
+ 1ee:	39 c6                	cmp    %eax,%esi
+ 1f0:	75 ee                	jne    1e0 <run+0x20>
+  for(i = 0; i < nproc; i++)
+ 1f2:	31 ff                	xor    %edi,%edi
+ 1f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    wait();
+ 1f8:	e8 ea 04 00 00       	call   6e7 <wait>
+  for(i = 0; i < nproc; i++)
+ 1fd:	89 f8                	mov    %edi,%eax
+ 1ff:	83 c7 01             	add    $0x1,%edi
+ 202:	39 c3                	cmp    %eax,%ebx
+ 204:	75 f2                	jne    1f8 <run+0x38>
+ 206:	0f 31                	rdtsc
+  t = rdtsc() - t;
+ 208:	2b 45 e0             	sub    -0x20(%ebp),%eax
+  n *= nblocks;
+ 20b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  t = rdtsc() - t;
+ 20e:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+  n *= nblocks;
+ 211:	0f af 7d 0c          	imul   0xc(%ebp),%edi
+  t = rdtsc() - t;
+ 215:	89 c1                	mov    %eax,%ecx
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 217:	89 d0                	mov    %edx,%eax
+ 219:	31 d2                	xor    %edx,%edx
+ 21b:	f7 f7                	div    %edi
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 21d:	89 c8                	mov    %ecx,%eax
+ 21f:	f7 f7                	div    %edi
+  printf(1, "%d procs: %d blocks each, %d cycles per block\n",
+ 221:	83 ec 0c             	sub    $0xc,%esp
+ 224:	50                   	push   %eax
+ 225:	57                   	push   %edi
+ 226:	56                   	push   %esi
+ 227:	68 c0 0c 00 00       	push   $0xcc0
+ 22c:	6a 01                	push   $0x1
+ 22e:	e8 2d 07 00 00       	call   960 <printf>
+}
+ 233:	83 c4 20             	add    $0x20,%esp
+ 236:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 239:	5b                   	pop    %ebx
+ 23a:	5e                   	pop    %esi
+ 23b:	5f                   	pop    %edi
+ 23c:	5d                   	pop    %ebp
+ 23d:	c3                   	ret
+      for(j = 0; j < n; j++){
+ 23e:	8b 55 10             	mov    0x10(%ebp),%edx
+      name[2] = '0' + i;
+ 241:	83 c3 30             	add    $0x30,%ebx
+ 244:	88 1d 92 11 00 00    	mov    %bl,0x1192
+      for(j = 0; j < n; j++){
+ 24a:	85 d2                	test   %edx,%edx
+ 24c:	7e 4f                	jle    29d <run+0xdd>
+ 24e:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 251:	89 c6                	mov    %eax,%esi
+        if((fd = open(name, O_RDONLY)) < 0){
+ 253:	83 ec 08             	sub    $0x8,%esp
+ 256:	6a 00                	push   $0x0
+ 258:	68 90 11 00 00       	push   $0x1190
+ 25d:	e8 d2 04 00 00       	call   734 <open>
+ 262:	83 c4 10             	add    $0x10,%esp
+ 265:	89 c3                	mov    %eax,%ebx
+ 267:	85 c0                	test   %eax,%eax
+ 269:	78 37                	js     2a2 <run+0xe2>
+ 26b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+        while(read(fd, buf, sizeof(buf)) > 0)
+ 270:	83 ec 04             	sub    $0x4,%esp
+ 273:	68 00 02 00 00       	push   $0x200
+ 278:	68 a0 11 00 00       	push   $0x11a0
+ 27d:	53                   	push   %ebx
+ 27e:	e8 7a 04 00 00       	call   6fd <read>
+ 283:	83 c4 10             	add    $0x10,%esp
+ 286:	85 c0                	test   %eax,%eax
+ 288:	7f e6                	jg     270 <run+0xb0>
+        close(fd);
+ 28a:	83 ec 0c             	sub    $0xc,%esp
+      for(j = 0; j < n; j++){
+ 28d:	83 c6 01             	add    $0x1,%esi
+        close(fd);
+ 290:	53                   	push   %ebx
+ 291:	e8 7d 04 00 00       	call   713 <close>
+      for(j = 0; j < n; j++){
+ 296:	83 c4 10             	add    $0x10,%esp
+ 299:	39 f7                	cmp    %esi,%edi
+ 29b:	75 b6                	jne    253 <run+0x93>
+      exit();
+ 29d:	e8 3a 04 00 00       	call   6dc <exit>
+          printf(1, "readbench: open %s failed\n", name);
+ 2a2:	83 ec 04             	sub    $0x4,%esp
+ 2a5:	68 90 11 00 00       	push   $0x1190
+ 2aa:	68 88 0c 00 00       	push   $0xc88
+ 2af:	6a 01                	push   $0x1
+ 2b1:	e8 aa 06 00 00       	call   960 <printf>
+          break;
+ 2b6:	83 c4 10             	add    $0x10,%esp
+ 2b9:	eb e2                	jmp    29d <run+0xdd>
+ 2bb:	66 90                	xchg   %ax,%ax
+ 2bd:	66 90                	xchg   %ax,%ax
+ 2bf:	90                   	nop
+
+000002c0 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 2c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2c1:	31 c0                	xor    %eax,%eax
+{
+ 2c3:	89 e5                	mov    %esp,%ebp
+ 2c5:	53                   	push   %ebx
+ 2c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 2cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 2d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 2d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 2d7:	83 c0 01             	add    $0x1,%eax
+ 2da:	84 d2                	test   %dl,%dl
+ 2dc:	75 f2                	jne    2d0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 2de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2e1:	89 c8                	mov    %ecx,%eax
+ 2e3:	c9                   	leave
+ 2e4:	c3                   	ret
+ 2e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	53                   	push   %ebx
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2fa:	0f b6 02             	movzbl (%edx),%eax
+ 2fd:	84 c0                	test   %al,%al
+ 2ff:	75 17                	jne    318 <strcmp+0x28>
+ 301:	eb 3a                	jmp    33d <strcmp+0x4d>
+ 303:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 307:	90                   	nop
+ 308:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 30c:	83 c2 01             	add    $0x1,%edx
+ 30f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 312:	84 c0                	test   %al,%al
+ 314:	74 1a                	je     330 <strcmp+0x40>
+    p++, q++;
+ 316:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 318:	0f b6 19             	movzbl (%ecx),%ebx
+ 31b:	38 c3                	cmp    %al,%bl
+ 31d:	74 e9                	je     308 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 31f:	29 d8                	sub    %ebx,%eax
+}
+ 321:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 324:	c9                   	leave
+ 325:	c3                   	ret
+ 326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 330:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 334:	31 c0                	xor    %eax,%eax
+ 336:	29 d8                	sub    %ebx,%eax
+}
+ 338:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 33b:	c9                   	leave
+ 33c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 33d:	0f b6 19             	movzbl (%ecx),%ebx
+ 340:	31 c0                	xor    %eax,%eax
+ 342:	eb db                	jmp    31f <strcmp+0x2f>
+ 344:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+
+00000350 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 356:	80 3a 00             	cmpb   $0x0,(%edx)
+ 359:	74 15                	je     370 <strlen+0x20>
+ 35b:	31 c0                	xor    %eax,%eax
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+ 360:	83 c0 01             	add    $0x1,%eax
+ 363:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 367:	89 c1                	mov    %eax,%ecx
+ 369:	75 f5                	jne    360 <strlen+0x10>
+    ;
+  return n;
+}
+ 36b:	89 c8                	mov    %ecx,%eax
+ 36d:	5d                   	pop    %ebp
+ 36e:	c3                   	ret
+ 36f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 370:	31 c9                	xor    %ecx,%ecx
+}
+ 372:	5d                   	pop    %ebp
+ 373:	89 c8                	mov    %ecx,%eax
+ 375:	c3                   	ret
+ 376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000380 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	57                   	push   %edi
+ 384:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("cld; rep stosb" :
+ 387:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 38a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 38d:	89 d7                	mov    %edx,%edi
+ 38f:	fc                   	cld
+ 390:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 392:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 395:	89 d0                	mov    %edx,%eax
+ 397:	c9                   	leave
+ 398:	c3                   	ret
+ 399:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3aa:	0f b6 10             	movzbl (%eax),%edx
+ 3ad:	84 d2                	test   %dl,%dl
+ 3af:	75 12                	jne    3c3 <strchr+0x23>
+ 3b1:	eb 1d                	jmp    3d0 <strchr+0x30>
+ 3b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3b7:	90                   	nop
+ 3b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3bc:	83 c0 01             	add    $0x1,%eax
+ 3bf:	84 d2                	test   %dl,%dl
+ 3c1:	74 0d                	je     3d0 <strchr+0x30>
+    if(*s == c)
+ 3c3:	38 d1                	cmp    %dl,%cl
+ 3c5:	75 f1                	jne    3b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3c7:	5d                   	pop    %ebp
+ 3c8:	c3                   	ret
+ 3c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3d0:	31 c0                	xor    %eax,%eax
+}
+ 3d2:	5d                   	pop    %ebp
+ 3d3:	c3                   	ret
+ 3d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3df:	90                   	nop
+
+000003e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	57                   	push   %edi
+ 3e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3e9:	31 db                	xor    %ebx,%ebx
+{
+ 3eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3ee:	eb 27                	jmp    417 <gets+0x37>
+    cc = read(0, &c, 1);
+ 3f0:	83 ec 04             	sub    $0x4,%esp
+ 3f3:	6a 01                	push   $0x1
+ 3f5:	56                   	push   %esi
+ 3f6:	6a 00                	push   $0x0
+ 3f8:	e8 00 03 00 00       	call   6fd <read>
+    if(cc < 1)
+ 3fd:	83 c4 10             	add    $0x10,%esp
+ 400:	85 c0                	test   %eax,%eax
+ 402:	7e 1d                	jle    421 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 404:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 408:	8b 55 08             	mov    0x8(%ebp),%edx
+ 40b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 40f:	3c 0a                	cmp    $0xa,%al
+ 411:	74 10                	je     423 <gets+0x43>
+ 413:	3c 0d                	cmp    $0xd,%al
+ 415:	74 0c                	je     423 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 417:	89 df                	mov    %ebx,%edi
+ 419:	83 c3 01             	add    $0x1,%ebx
+ 41c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 41f:	7c cf                	jl     3f0 <gets+0x10>
+ 421:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+ 426:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 42a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 42d:	5b                   	pop    %ebx
+ 42e:	5e                   	pop    %esi
+ 42f:	5f                   	pop    %edi
+ 430:	5d                   	pop    %ebp
+ 431:	c3                   	ret
+ 432:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 439:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000440 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	56                   	push   %esi
+ 444:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 445:	83 ec 08             	sub    $0x8,%esp
+ 448:	6a 00                	push   $0x0
+ 44a:	ff 75 08             	push   0x8(%ebp)
+ 44d:	e8 e2 02 00 00       	call   734 <open>
+  if(fd < 0)
+ 452:	83 c4 10             	add    $0x10,%esp
+ 455:	85 c0                	test   %eax,%eax
+ 457:	78 27                	js     480 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 459:	83 ec 08             	sub    $0x8,%esp
+ 45c:	ff 75 0c             	push   0xc(%ebp)
+ 45f:	89 c3                	mov    %eax,%ebx
+ 461:	50                   	push   %eax
+ 462:	e8 ee 02 00 00       	call   755 <fstat>
+  close(fd);
+ 467:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 46a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 46c:	e8 a2 02 00 00       	call   713 <close>
+  return r;
+ 471:	83 c4 10             	add    $0x10,%esp
+}
+ 474:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 477:	89 f0                	mov    %esi,%eax
+ 479:	5b                   	pop    %ebx
+ 47a:	5e                   	pop    %esi
+ 47b:	5d                   	pop    %ebp
+ 47c:	c3                   	ret
+ 47d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 480:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 485:	eb ed                	jmp    474 <stat+0x34>
+ 487:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48e:	66 90                	xchg   %ax,%ax
+
+00000490 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	53                   	push   %ebx
+ 494:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 497:	0f be 02             	movsbl (%edx),%eax
+ 49a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 49d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 4a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 4a5:	77 1e                	ja     4c5 <atoi+0x35>
+ 4a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4b0:	83 c2 01             	add    $0x1,%edx
+ 4b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 4b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 4ba:	0f be 02             	movsbl (%edx),%eax
+ 4bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 4c0:	80 fb 09             	cmp    $0x9,%bl
+ 4c3:	76 eb                	jbe    4b0 <atoi+0x20>
+  return n;
+}
+ 4c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4c8:	89 c8                	mov    %ecx,%eax
+ 4ca:	c9                   	leave
+ 4cb:	c3                   	ret
+ 4cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	57                   	push   %edi
+ 4d4:	56                   	push   %esi
+ 4d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4de:	85 c0                	test   %eax,%eax
+ 4e0:	7e 13                	jle    4f5 <memmove+0x25>
+ 4e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4e4:	89 d7                	mov    %edx,%edi
+ 4e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4f1:	39 f8                	cmp    %edi,%eax
+ 4f3:	75 fb                	jne    4f0 <memmove+0x20>
+  return vdst;
+}
+ 4f5:	5e                   	pop    %esi
+ 4f6:	89 d0                	mov    %edx,%eax
+ 4f8:	5f                   	pop    %edi
+ 4f9:	5d                   	pop    %ebp
+ 4fa:	c3                   	ret
+ 4fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ff:	90                   	nop
+
+00000500 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 500:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 505:	85 c0                	test   %eax,%eax
+ 507:	74 07                	je     510 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 509:	c3                   	ret
+ 50a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 510:	e9 77 02 00 00       	jmp    78c <sysgetpid>
+ 515:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 520:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 525:	c3                   	ret
+ 526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000530 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 530:	55                   	push   %ebp
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 531:	31 d2                	xor    %edx,%edx
+ 533:	89 e5                	mov    %esp,%ebp
+ 535:	53                   	push   %ebx
+ 536:	83 ec 04             	sub    $0x4,%esp
+ 539:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 53c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 53f:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 542:	85 c9                	test   %ecx,%ecx
+ 544:	7e 08                	jle    54e <cyclereport+0x1e>
+ 546:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 548:	89 d8                	mov    %ebx,%eax
+ 54a:	f7 f1                	div    %ecx
+ 54c:	89 c2                	mov    %eax,%edx
+ 54e:	83 ec 08             	sub    $0x8,%esp
+ 551:	52                   	push   %edx
+ 552:	ff 75 0c             	push   0xc(%ebp)
+ 555:	51                   	push   %ecx
+ 556:	ff 75 08             	push   0x8(%ebp)
+ 559:	68 ef 0c 00 00       	push   $0xcef
+ 55e:	6a 01                	push   $0x1
+ 560:	e8 fb 03 00 00       	call   960 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 565:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 568:	83 c4 20             	add    $0x20,%esp
+ 56b:	c9                   	leave
+ 56c:	c3                   	ret
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000570 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 573:	8b 45 08             	mov    0x8(%ebp),%eax
+ 576:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 57c:	5d                   	pop    %ebp
+ 57d:	c3                   	ret
+ 57e:	66 90                	xchg   %ax,%ax
+
+00000580 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 580:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 581:	31 c0                	xor    %eax,%eax
+ 583:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 588:	89 e5                	mov    %esp,%ebp
+ 58a:	56                   	push   %esi
+ 58b:	53                   	push   %ebx
+ 58c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 58f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 593:	85 c0                	test   %eax,%eax
+ 595:	74 30                	je     5c7 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 597:	83 f8 02             	cmp    $0x2,%eax
+ 59a:	74 0c                	je     5a8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 59c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5a1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 5a4:	85 c0                	test   %eax,%eax
+ 5a6:	74 1f                	je     5c7 <mutex_lock+0x47>
+ 5a8:	be 02 00 00 00       	mov    $0x2,%esi
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 5b0:	83 ec 08             	sub    $0x8,%esp
+ 5b3:	6a 02                	push   $0x2
+ 5b5:	53                   	push   %ebx
+ 5b6:	e8 8c 02 00 00       	call   847 <futex_wait>
+ 5bb:	89 f0                	mov    %esi,%eax
+ 5bd:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 5c0:	83 c4 10             	add    $0x10,%esp
+ 5c3:	85 c0                	test   %eax,%eax
+ 5c5:	75 e9                	jne    5b0 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 5c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 5ca:	5b                   	pop    %ebx
+ 5cb:	5e                   	pop    %esi
+ 5cc:	5d                   	pop    %ebp
+ 5cd:	c3                   	ret
+ 5ce:	66 90                	xchg   %ax,%ax
+
+000005d0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	83 ec 08             	sub    $0x8,%esp
+ 5d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 5d9:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 5dd:	75 09                	jne    5e8 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 5df:	c9                   	leave
+ 5e0:	c3                   	ret
+ 5e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 5e8:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 5eb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 5f1:	6a 01                	push   $0x1
+ 5f3:	50                   	push   %eax
+ 5f4:	e8 59 02 00 00       	call   852 <futex_wake>
+ 5f9:	83 c4 10             	add    $0x10,%esp
+}
+ 5fc:	c9                   	leave
+ 5fd:	c3                   	ret
+ 5fe:	66 90                	xchg   %ax,%ax
+
+00000600 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 603:	8b 45 08             	mov    0x8(%ebp),%eax
+ 606:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 60c:	5d                   	pop    %ebp
+ 60d:	c3                   	ret
+ 60e:	66 90                	xchg   %ax,%ax
+
+00000610 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	57                   	push   %edi
+ 614:	56                   	push   %esi
+ 615:	53                   	push   %ebx
+ 616:	83 ec 0c             	sub    $0xc,%esp
+ 619:	8b 75 08             	mov    0x8(%ebp),%esi
+ 61c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 61f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 621:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 625:	75 21                	jne    648 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 627:	83 ec 08             	sub    $0x8,%esp
+ 62a:	57                   	push   %edi
+ 62b:	56                   	push   %esi
+ 62c:	e8 16 02 00 00       	call   847 <futex_wait>
+  mutex_lock(m);
+ 631:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 634:	83 c4 10             	add    $0x10,%esp
+}
+ 637:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 63a:	5b                   	pop    %ebx
+ 63b:	5e                   	pop    %esi
+ 63c:	5f                   	pop    %edi
+ 63d:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 63e:	e9 3d ff ff ff       	jmp    580 <mutex_lock>
+ 643:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 647:	90                   	nop
+    futex_wake(&m->v, 1);
+ 648:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 64b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 651:	6a 01                	push   $0x1
+ 653:	53                   	push   %ebx
+ 654:	e8 f9 01 00 00       	call   852 <futex_wake>
+ 659:	83 c4 10             	add    $0x10,%esp
+ 65c:	eb c9                	jmp    627 <cond_wait+0x17>
+ 65e:	66 90                	xchg   %ax,%ax
+
+00000660 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	83 ec 10             	sub    $0x10,%esp
+ 666:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 669:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 66d:	6a 01                	push   $0x1
+ 66f:	50                   	push   %eax
+ 670:	e8 dd 01 00 00       	call   852 <futex_wake>
+}
+ 675:	83 c4 10             	add    $0x10,%esp
+ 678:	c9                   	leave
+ 679:	c3                   	ret
+ 67a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000680 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	83 ec 10             	sub    $0x10,%esp
+ 686:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 689:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 68d:	68 ff ff ff 7f       	push   $0x7fffffff
+ 692:	50                   	push   %eax
+ 693:	e8 ba 01 00 00       	call   852 <futex_wake>
+}
+ 698:	83 c4 10             	add    $0x10,%esp
+ 69b:	c9                   	leave
+ 69c:	c3                   	ret
+
+0000069d <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 69d:	50                   	push   %eax
+  pushl %ebx
+ 69e:	53                   	push   %ebx
+  movl $1, %eax
+ 69f:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 6a4:	0f a2                	cpuid
+  popl %ebx
+ 6a6:	5b                   	pop    %ebx
+  popl %eax
+ 6a7:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 6a8:	c7 05 94 11 00 00 ce 	movl   $0x6ce,0x1194
+ 6af:	06 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 6b2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 6b8:	74 14                	je     6ce <sysint>
+  movl $sysfast, syscallvec
+ 6ba:	c7 05 94 11 00 00 c4 	movl   $0x6c4,0x1194
+ 6c1:	06 00 00 
+
+000006c4 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 6c4:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 6c6:	ba cd 06 00 00       	mov    $0x6cd,%edx
+  sysenter
+ 6cb:	0f 34                	sysenter
+1:
+  ret
+ 6cd:	c3                   	ret
+
+000006ce <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 6ce:	cd 40                	int    $0x40
+  ret
+ 6d0:	c3                   	ret
+
+000006d1 <fork>:
+
+SYSCALL(fork)
+ 6d1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6d6:	ff 25 94 11 00 00    	jmp    *0x1194
+
+000006dc <exit>:
+SYSCALL(exit)
+ 6dc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6e1:	ff 25 94 11 00 00    	jmp    *0x1194
+
+000006e7 <wait>:
+SYSCALL(wait)
+ 6e7:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6ec:	ff 25 94 11 00 00    	jmp    *0x1194
+
+000006f2 <pipe>:
+SYSCALL(pipe)
+ 6f2:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6f7:	ff 25 94 11 00 00    	jmp    *0x1194
+
+000006fd <read>:
+SYSCALL(read)
+ 6fd:	b8 05 00 00 00       	mov    $0x5,%eax
+ 702:	ff 25 94 11 00 00    	jmp    *0x1194
+
+00000708 <write>:
+SYSCALL(write)
+ 708:	b8 10 00 00 00       	mov    $0x10,%eax
+ 70d:	ff 25 94 11 00 00    	jmp    *0x1194
+
+00000713 <close>:
+SYSCALL(close)
+ 713:	b8 15 00 00 00       	mov    $0x15,%eax
+ 718:	ff 25 94 11 00 00    	jmp    *0x1194
+
+0000071e <kill>:
+SYSCALL(kill)
+ 71e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 723:	ff 25 94 11 00 00    	jmp    *0x1194
+
+00000729 <exec>:
+SYSCALL(exec)
+ 729:	b8 07 00 00 00       	mov    $0x7,%eax
+ 72e:	ff 25 94 11 00 00    	jmp    *0x1194
+
+00000734 <open>:
+SYSCALL(open)
+ 734:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 739:	ff 25 94 11 00 00    	jmp    *0x1194
+
+0000073f <mknod>:
+SYSCALL(mknod)
+ 73f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 744:	ff 25 94 11 00 00    	jmp    *0x1194
+
+0000074a <unlink>:
+SYSCALL(unlink)
+ 74a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 74f:	ff 25 94 11 00 00    	jmp    *0x1194
+
+00000755 <fstat>:
+SYSCALL(fstat)
+ 755:	b8 08 00 00 00       	mov    $0x8,%eax
+ 75a:	ff 25 94 11 00 00    	jmp    *0x1194
+
+00000760 <link>:
+SYSCALL(link)
+ 760:	b8 13 00 00 00       	mov    $0x13,%eax
+ 765:	ff 25 94 11 00 00    	jmp    *0x1194
+
+0000076b <mkdir>:
+SYSCALL(mkdir)
+ 76b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 770:	ff 25 94 11 00 00    	jmp    *0x1194
+
+00000776 <chdir>:
+SYSCALL(chdir)
+ 776:	b8 09 00 00 00       	mov    $0x9,%eax
+ 77b:	ff 25 94 11 00 00    	jmp    *0x1194
+
+00000781 <dup>:
+SYSCALL(dup)
+ 781:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 786:	ff 25 94 11 00 00    	jmp    *0x1194
+
+0000078c <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 78c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 791:	ff 25 94 11 00 00    	jmp    *0x1194
+
+00000797 <sbrk>:
+SYSCALL(sbrk)
+ 797:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 79c:	ff 25 94 11 00 00    	jmp    *0x1194
+
+000007a2 <sleep>:
+SYSCALL(sleep)
+ 7a2:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7a7:	ff 25 94 11 00 00    	jmp    *0x1194
+
+000007ad <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 7ad:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7b2:	ff 25 94 11 00 00    	jmp    *0x1194
+
+000007b8 <swapread>:
+SYSCALL(swapread)
+ 7b8:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7bd:	ff 25 94 11 00 00    	jmp    *0x1194
+
+000007c3 <swapwrite>:
+SYSCALL(swapwrite)
+ 7c3:	b8 17 00 00 00       	mov    $0x17,%eax
+ 7c8:	ff 25 94 11 00 00    	jmp    *0x1194
+
+000007ce <swapstat>:
+SYSCALL(swapstat)
+ 7ce:	b8 18 00 00 00       	mov    $0x18,%eax
+ 7d3:	ff 25 94 11 00 00    	jmp    *0x1194
+
+000007d9 <madvise>:
+SYSCALL(madvise)
+ 7d9:	b8 19 00 00 00       	mov    $0x19,%eax
+ 7de:	ff 25 94 11 00 00    	jmp    *0x1194
+
+000007e4 <mlock>:
+SYSCALL(mlock)
+ 7e4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7e9:	ff 25 94 11 00 00    	jmp    *0x1194
+
+000007ef <munlock>:
+SYSCALL(munlock)
+ 7ef:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7f4:	ff 25 94 11 00 00    	jmp    *0x1194
+
+000007fa <membench>:
+SYSCALL(membench)
+ 7fa:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7ff:	ff 25 94 11 00 00    	jmp    *0x1194
+
+00000805 <nice>:
+SYSCALL(nice)
+ 805:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 80a:	ff 25 94 11 00 00    	jmp    *0x1194
+
+00000810 <setpriority>:
+SYSCALL(setpriority)
+ 810:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 815:	ff 25 94 11 00 00    	jmp    *0x1194
+
+0000081b <usleep>:
+SYSCALL(usleep)
+ 81b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 820:	ff 25 94 11 00 00    	jmp    *0x1194
+
+00000826 <cpustat>:
+SYSCALL(cpustat)
+ 826:	b8 20 00 00 00       	mov    $0x20,%eax
+ 82b:	ff 25 94 11 00 00    	jmp    *0x1194
+
+00000831 <clone>:
+SYSCALL(clone)
+ 831:	b8 21 00 00 00       	mov    $0x21,%eax
+ 836:	ff 25 94 11 00 00    	jmp    *0x1194
+
+0000083c <join>:
+SYSCALL(join)
+ 83c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 841:	ff 25 94 11 00 00    	jmp    *0x1194
+
+00000847 <futex_wait>:
+SYSCALL(futex_wait)
+ 847:	b8 23 00 00 00       	mov    $0x23,%eax
+ 84c:	ff 25 94 11 00 00    	jmp    *0x1194
+
+00000852 <futex_wake>:
+SYSCALL(futex_wake)
+ 852:	b8 24 00 00 00       	mov    $0x24,%eax
+ 857:	ff 25 94 11 00 00    	jmp    *0x1194
+
+0000085d <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 85d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 862:	ff 25 94 11 00 00    	jmp    *0x1194
+
+00000868 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 868:	b8 26 00 00 00       	mov    $0x26,%eax
+ 86d:	ff 25 94 11 00 00    	jmp    *0x1194
+
+00000873 <getcpu>:
+SYSCALL(getcpu)
+ 873:	b8 27 00 00 00       	mov    $0x27,%eax
+ 878:	ff 25 94 11 00 00    	jmp    *0x1194
+
+0000087e <migrations>:
+SYSCALL(migrations)
+ 87e:	b8 28 00 00 00       	mov    $0x28,%eax
+ 883:	ff 25 94 11 00 00    	jmp    *0x1194
+
+00000889 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 889:	b8 29 00 00 00       	mov    $0x29,%eax
+ 88e:	ff 25 94 11 00 00    	jmp    *0x1194
+
+00000894 <lockstat>:
+SYSCALL(lockstat)
+ 894:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 899:	ff 25 94 11 00 00    	jmp    *0x1194
+
+0000089f <lockprof>:
+SYSCALL(lockprof)
+ 89f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 8a4:	ff 25 94 11 00 00    	jmp    *0x1194
+
+000008aa <bcachestat>:
+SYSCALL(bcachestat)
+ 8aa:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 8af:	ff 25 94 11 00 00    	jmp    *0x1194
+ 8b5:	66 90                	xchg   %ax,%ax
+ 8b7:	66 90                	xchg   %ax,%ax
+ 8b9:	66 90                	xchg   %ax,%ax
+ 8bb:	66 90                	xchg   %ax,%ax
+ 8bd:	66 90                	xchg   %ax,%ax
+ 8bf:	90                   	nop
+
+000008c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8c0:	55                   	push   %ebp
+ 8c1:	89 e5                	mov    %esp,%ebp
+ 8c3:	57                   	push   %edi
+ 8c4:	56                   	push   %esi
+ 8c5:	53                   	push   %ebx
+ 8c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 8c8:	89 d1                	mov    %edx,%ecx
+{
+ 8ca:	83 ec 3c             	sub    $0x3c,%esp
+ 8cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 8d0:	85 d2                	test   %edx,%edx
+ 8d2:	0f 89 80 00 00 00    	jns    958 <printint+0x98>
+ 8d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 8dc:	74 7a                	je     958 <printint+0x98>
+    x = -xx;
+ 8de:	f7 d9                	neg    %ecx
+    neg = 1;
+ 8e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 8e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 8e8:	31 f6                	xor    %esi,%esi
+ 8ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 8f0:	89 c8                	mov    %ecx,%eax
+ 8f2:	31 d2                	xor    %edx,%edx
+ 8f4:	89 f7                	mov    %esi,%edi
+ 8f6:	f7 f3                	div    %ebx
+ 8f8:	8d 76 01             	lea    0x1(%esi),%esi
+ 8fb:	0f b6 92 6c 0d 00 00 	movzbl 0xd6c(%edx),%edx
+ 902:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 906:	89 ca                	mov    %ecx,%edx
+ 908:	89 c1                	mov    %eax,%ecx
+ 90a:	39 da                	cmp    %ebx,%edx
+ 90c:	73 e2                	jae    8f0 <printint+0x30>
+  if(neg)
+ 90e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 911:	85 c0                	test   %eax,%eax
+ 913:	74 07                	je     91c <printint+0x5c>
+    buf[i++] = '-';
+ 915:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 91a:	89 f7                	mov    %esi,%edi
+ 91c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 91f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 922:	01 df                	add    %ebx,%edi
+ 924:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 928:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 92b:	83 ec 04             	sub    $0x4,%esp
+ 92e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 931:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 934:	6a 01                	push   $0x1
+ 936:	50                   	push   %eax
+ 937:	56                   	push   %esi
+ 938:	e8 cb fd ff ff       	call   708 <write>
+  while(--i >= 0)
+ 93d:	89 f8                	mov    %edi,%eax
+ 93f:	83 c4 10             	add    $0x10,%esp
+ 942:	83 ef 01             	sub    $0x1,%edi
+ 945:	39 d8                	cmp    %ebx,%eax
+ 947:	75 df                	jne    928 <printint+0x68>
+}
+ 949:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 94c:	5b                   	pop    %ebx
+ 94d:	5e                   	pop    %esi
+ 94e:	5f                   	pop    %edi
+ 94f:	5d                   	pop    %ebp
+ 950:	c3                   	ret
+ 951:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 958:	31 c0                	xor    %eax,%eax
+ 95a:	eb 89                	jmp    8e5 <printint+0x25>
+ 95c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000960 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 960:	55                   	push   %ebp
+ 961:	89 e5                	mov    %esp,%ebp
+ 963:	57                   	push   %edi
+ 964:	56                   	push   %esi
+ 965:	53                   	push   %ebx
+ 966:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 969:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 96c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 96f:	0f b6 1e             	movzbl (%esi),%ebx
+ 972:	83 c6 01             	add    $0x1,%esi
+ 975:	84 db                	test   %bl,%bl
+ 977:	74 67                	je     9e0 <printf+0x80>
+ 979:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 97c:	31 d2                	xor    %edx,%edx
+ 97e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 981:	eb 34                	jmp    9b7 <printf+0x57>
+ 983:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 987:	90                   	nop
+ 988:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 98b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 990:	83 f8 25             	cmp    $0x25,%eax
+ 993:	74 18                	je     9ad <printf+0x4d>
+  write(fd, &c, 1);
+ 995:	83 ec 04             	sub    $0x4,%esp
+ 998:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 99b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 99e:	6a 01                	push   $0x1
+ 9a0:	50                   	push   %eax
+ 9a1:	57                   	push   %edi
+ 9a2:	e8 61 fd ff ff       	call   708 <write>
+ 9a7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 9aa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 9ad:	0f b6 1e             	movzbl (%esi),%ebx
+ 9b0:	83 c6 01             	add    $0x1,%esi
+ 9b3:	84 db                	test   %bl,%bl
+ 9b5:	74 29                	je     9e0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 9b7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 9ba:	85 d2                	test   %edx,%edx
+ 9bc:	74 ca                	je     988 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 9be:	83 fa 25             	cmp    $0x25,%edx
+ 9c1:	75 ea                	jne    9ad <printf+0x4d>
+      if(c == 'd'){
+ 9c3:	83 f8 25             	cmp    $0x25,%eax
+ 9c6:	0f 84 24 01 00 00    	je     af0 <printf+0x190>
+ 9cc:	83 e8 63             	sub    $0x63,%eax
+ 9cf:	83 f8 15             	cmp    $0x15,%eax
+ 9d2:	77 1c                	ja     9f0 <printf+0x90>
+ 9d4:	ff 24 85 14 0d 00 00 	jmp    *0xd14(,%eax,4)
+ 9db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9df:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 9e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9e3:	5b                   	pop    %ebx
+ 9e4:	5e                   	pop    %esi
+ 9e5:	5f                   	pop    %edi
+ 9e6:	5d                   	pop    %ebp
+ 9e7:	c3                   	ret
+ 9e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ef:	90                   	nop
+  write(fd, &c, 1);
+ 9f0:	83 ec 04             	sub    $0x4,%esp
+ 9f3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9f6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 9fa:	6a 01                	push   $0x1
+ 9fc:	52                   	push   %edx
+ 9fd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ a00:	57                   	push   %edi
+ a01:	e8 02 fd ff ff       	call   708 <write>
+ a06:	83 c4 0c             	add    $0xc,%esp
+ a09:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a0c:	6a 01                	push   $0x1
+ a0e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ a11:	52                   	push   %edx
+ a12:	57                   	push   %edi
+ a13:	e8 f0 fc ff ff       	call   708 <write>
+        putc(fd, c);
+ a18:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a1b:	31 d2                	xor    %edx,%edx
+ a1d:	eb 8e                	jmp    9ad <printf+0x4d>
+ a1f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ a20:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a23:	83 ec 0c             	sub    $0xc,%esp
+ a26:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a2b:	8b 13                	mov    (%ebx),%edx
+ a2d:	6a 00                	push   $0x0
+ a2f:	89 f8                	mov    %edi,%eax
+        ap++;
+ a31:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ a34:	e8 87 fe ff ff       	call   8c0 <printint>
+        ap++;
+ a39:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a3c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a3f:	31 d2                	xor    %edx,%edx
+ a41:	e9 67 ff ff ff       	jmp    9ad <printf+0x4d>
+ a46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a4d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a50:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a53:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a55:	83 c0 04             	add    $0x4,%eax
+ a58:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a5b:	85 db                	test   %ebx,%ebx
+ a5d:	0f 84 9d 00 00 00    	je     b00 <printf+0x1a0>
+        while(*s != 0){
+ a63:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a66:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a68:	84 c0                	test   %al,%al
+ a6a:	0f 84 3d ff ff ff    	je     9ad <printf+0x4d>
+ a70:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a73:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a76:	89 de                	mov    %ebx,%esi
+ a78:	89 d3                	mov    %edx,%ebx
+ a7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a80:	83 ec 04             	sub    $0x4,%esp
+ a83:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a86:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a89:	6a 01                	push   $0x1
+ a8b:	53                   	push   %ebx
+ a8c:	57                   	push   %edi
+ a8d:	e8 76 fc ff ff       	call   708 <write>
+        while(*s != 0){
+ a92:	0f b6 06             	movzbl (%esi),%eax
+ a95:	83 c4 10             	add    $0x10,%esp
+ a98:	84 c0                	test   %al,%al
+ a9a:	75 e4                	jne    a80 <printf+0x120>
+      state = 0;
+ a9c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ a9f:	31 d2                	xor    %edx,%edx
+ aa1:	e9 07 ff ff ff       	jmp    9ad <printf+0x4d>
+ aa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ ab0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ ab3:	83 ec 0c             	sub    $0xc,%esp
+ ab6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ abb:	8b 13                	mov    (%ebx),%edx
+ abd:	6a 01                	push   $0x1
+ abf:	e9 6b ff ff ff       	jmp    a2f <printf+0xcf>
+ ac4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ ac8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ acb:	83 ec 04             	sub    $0x4,%esp
+ ace:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ ad1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ ad3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ ad6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ ad9:	6a 01                	push   $0x1
+ adb:	52                   	push   %edx
+ adc:	57                   	push   %edi
+ add:	e8 26 fc ff ff       	call   708 <write>
+        ap++;
+ ae2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ ae5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ ae8:	31 d2                	xor    %edx,%edx
+ aea:	e9 be fe ff ff       	jmp    9ad <printf+0x4d>
+ aef:	90                   	nop
+  write(fd, &c, 1);
+ af0:	83 ec 04             	sub    $0x4,%esp
+ af3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ af6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ af9:	6a 01                	push   $0x1
+ afb:	e9 11 ff ff ff       	jmp    a11 <printf+0xb1>
+ b00:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ b05:	bb 0a 0d 00 00       	mov    $0xd0a,%ebx
+ b0a:	e9 61 ff ff ff       	jmp    a70 <printf+0x110>
+ b0f:	90                   	nop
+
+00000b10 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b10:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b11:	a1 a0 13 00 00       	mov    0x13a0,%eax
+{
+ b16:	89 e5                	mov    %esp,%ebp
+ b18:	57                   	push   %edi
+ b19:	56                   	push   %esi
+ b1a:	53                   	push   %ebx
+ b1b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ b1e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b28:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b2a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b2c:	39 ca                	cmp    %ecx,%edx
+ b2e:	73 30                	jae    b60 <free+0x50>
+ b30:	39 c1                	cmp    %eax,%ecx
+ b32:	72 04                	jb     b38 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b34:	39 c2                	cmp    %eax,%edx
+ b36:	72 f0                	jb     b28 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b38:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ b3b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ b3e:	39 f8                	cmp    %edi,%eax
+ b40:	74 2e                	je     b70 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b42:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ b45:	8b 42 04             	mov    0x4(%edx),%eax
+ b48:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b4b:	39 f1                	cmp    %esi,%ecx
+ b4d:	74 38                	je     b87 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b4f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b51:	5b                   	pop    %ebx
+  freep = p;
+ b52:	89 15 a0 13 00 00    	mov    %edx,0x13a0
+}
+ b58:	5e                   	pop    %esi
+ b59:	5f                   	pop    %edi
+ b5a:	5d                   	pop    %ebp
+ b5b:	c3                   	ret
+ b5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b60:	39 c1                	cmp    %eax,%ecx
+ b62:	72 d0                	jb     b34 <free+0x24>
+ b64:	eb c2                	jmp    b28 <free+0x18>
+ b66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b6d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ b70:	03 70 04             	add    0x4(%eax),%esi
+ b73:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b76:	8b 02                	mov    (%edx),%eax
+ b78:	8b 00                	mov    (%eax),%eax
+ b7a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ b7d:	8b 42 04             	mov    0x4(%edx),%eax
+ b80:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b83:	39 f1                	cmp    %esi,%ecx
+ b85:	75 c8                	jne    b4f <free+0x3f>
+    p->s.size += bp->s.size;
+ b87:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ b8a:	89 15 a0 13 00 00    	mov    %edx,0x13a0
+    p->s.size += bp->s.size;
+ b90:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ b93:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ b96:	89 0a                	mov    %ecx,(%edx)
+}
+ b98:	5b                   	pop    %ebx
+ b99:	5e                   	pop    %esi
+ b9a:	5f                   	pop    %edi
+ b9b:	5d                   	pop    %ebp
+ b9c:	c3                   	ret
+ b9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ba0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ ba0:	55                   	push   %ebp
+ ba1:	89 e5                	mov    %esp,%ebp
+ ba3:	57                   	push   %edi
+ ba4:	56                   	push   %esi
+ ba5:	53                   	push   %ebx
+ ba6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ba9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ bac:	8b 15 a0 13 00 00    	mov    0x13a0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bb2:	8d 78 07             	lea    0x7(%eax),%edi
+ bb5:	c1 ef 03             	shr    $0x3,%edi
+ bb8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ bbb:	85 d2                	test   %edx,%edx
+ bbd:	0f 84 8d 00 00 00    	je     c50 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bc3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ bc5:	8b 48 04             	mov    0x4(%eax),%ecx
+ bc8:	39 f9                	cmp    %edi,%ecx
+ bca:	73 64                	jae    c30 <malloc+0x90>
+  if(nu < 4096)
+ bcc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ bd1:	39 df                	cmp    %ebx,%edi
+ bd3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ bd6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ bdd:	eb 0a                	jmp    be9 <malloc+0x49>
+ bdf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ be0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ be2:	8b 48 04             	mov    0x4(%eax),%ecx
+ be5:	39 f9                	cmp    %edi,%ecx
+ be7:	73 47                	jae    c30 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ be9:	89 c2                	mov    %eax,%edx
+ beb:	39 05 a0 13 00 00    	cmp    %eax,0x13a0
+ bf1:	75 ed                	jne    be0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ bf3:	83 ec 0c             	sub    $0xc,%esp
+ bf6:	56                   	push   %esi
+ bf7:	e8 9b fb ff ff       	call   797 <sbrk>
+  if(p == (char*)-1)
+ bfc:	83 c4 10             	add    $0x10,%esp
+ bff:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c02:	74 1c                	je     c20 <malloc+0x80>
+  hp->s.size = nu;
+ c04:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ c07:	83 ec 0c             	sub    $0xc,%esp
+ c0a:	83 c0 08             	add    $0x8,%eax
+ c0d:	50                   	push   %eax
+ c0e:	e8 fd fe ff ff       	call   b10 <free>
+  return freep;
+ c13:	8b 15 a0 13 00 00    	mov    0x13a0,%edx
+      if((p = morecore(nunits)) == 0)
+ c19:	83 c4 10             	add    $0x10,%esp
+ c1c:	85 d2                	test   %edx,%edx
+ c1e:	75 c0                	jne    be0 <malloc+0x40>
+        return 0;
+  }
+}
+ c20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ c23:	31 c0                	xor    %eax,%eax
+}
+ c25:	5b                   	pop    %ebx
+ c26:	5e                   	pop    %esi
+ c27:	5f                   	pop    %edi
+ c28:	5d                   	pop    %ebp
+ c29:	c3                   	ret
+ c2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ c30:	39 cf                	cmp    %ecx,%edi
+ c32:	74 4c                	je     c80 <malloc+0xe0>
+        p->s.size -= nunits;
+ c34:	29 f9                	sub    %edi,%ecx
+ c36:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ c39:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ c3c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ c3f:	89 15 a0 13 00 00    	mov    %edx,0x13a0
+}
+ c45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ c48:	83 c0 08             	add    $0x8,%eax
+}
+ c4b:	5b                   	pop    %ebx
+ c4c:	5e                   	pop    %esi
+ c4d:	5f                   	pop    %edi
+ c4e:	5d                   	pop    %ebp
+ c4f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ c50:	c7 05 a0 13 00 00 a4 	movl   $0x13a4,0x13a0
+ c57:	13 00 00 
+    base.s.size = 0;
+ c5a:	b8 a4 13 00 00       	mov    $0x13a4,%eax
+    base.s.ptr = freep = prevp = &base;
+ c5f:	c7 05 a4 13 00 00 a4 	movl   $0x13a4,0x13a4
+ c66:	13 00 00 
+    base.s.size = 0;
+ c69:	c7 05 a8 13 00 00 00 	movl   $0x0,0x13a8
+ c70:	00 00 00 
+    if(p->s.size >= nunits){
+ c73:	e9 54 ff ff ff       	jmp    bcc <malloc+0x2c>
+ c78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c7f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ c80:	8b 08                	mov    (%eax),%ecx
+ c82:	89 0a                	mov    %ecx,(%edx)
+ c84:	eb b9                	jmp    c3f <malloc+0x9f>
@@ -0,0 +1,89 @@
+// Cached reads from several processes at once.  Each of
+// nproc processes reads its own small file over and over, so
+// every block comes from the buffer cache; the time per block
+// read should not grow much with nproc on a multiprocessor.
+// usage: readbench [nproc [nblocks [n]]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "fs.h"
+#include "x86.h"
+
+#define NPROCS 4
+
+char buf[BSIZE];
+char name[] = "rb0";
+
+void
+run(int nproc, int nblocks, int n)
+{
+  uint64 t;
+  int fd, i, j;
+
+  t = rdtsc();
+  for(i = 0; i < nproc; i++){
+    if(fork() == 0){
+      name[2] = '0' + i;
+      for(j = 0; j < n; j++){
+        if((fd = open(name, O_RDONLY)) < 0){
+          printf(1, "readbench: open %s failed\n", name);
+          break;
+        }
+        while(read(fd, buf, sizeof(buf)) > 0)
+          ;
+        close(fd);
+      }
+      exit();
+    }
+  }
+  for(i = 0; i < nproc; i++)
+    wait();
+  t = rdtsc() - t;
+
+  n *= nblocks;
+  printf(1, "%d procs: %d blocks each, %d cycles per block\n",
+         nproc, n, udiv64(t, n));
+}
+
+int
+main(int argc, char *argv[])
+{
+  int fd, i, j, nproc, nblocks, n;
+
+  nproc = NPROCS;
+  nblocks = 4;
+  n = 500;
+  if(argc > 1)
+    nproc = atoi(argv[1]);
+  if(argc > 2)
+    nblocks = atoi(argv[2]);
+  if(argc > 3)
+    n = atoi(argv[3]);
+  if(nproc > 10)
+    nproc = 10;
+  if(nblocks < 1)
+    nblocks = 1;
+
+  memset(buf, 'r', sizeof(buf));
+  for(i = 0; i < nproc; i++){
+    name[2] = '0' + i;
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+      printf(1, "readbench: create %s failed\n", name);
+      exit();
+    }
+    for(j = 0; j < nblocks; j++)
+      write(fd, buf, sizeof(buf));
+    close(fd);
+  }
+
+  for(i = 1; i <= nproc; i *= 2)
+    run(i, nblocks, n);
+
+  for(i = 0; i < nproc; i++){
+    name[2] = '0' + i;
+    unlink(name);
+  }
+  exit();
+}
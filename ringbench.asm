@@ -0,0 +1,1859 @@
+
+_ringbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return total;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	bb 00 01 00 00       	mov    $0x100,%ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 38             	sub    $0x38,%esp
+  int fd, i, j, kb, n0, n1;
+  uint sum0, sum1;
+  uint64 t0, t1;
+
+  kb = 256;
+  if(argc > 1)
+  19:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  1c:	8b 51 04             	mov    0x4(%ecx),%edx
+  if(argc > 1)
+  1f:	7e 18                	jle    39 <main+0x39>
+    kb = atoi(argv[1]);
+  21:	83 ec 0c             	sub    $0xc,%esp
+  24:	ff 72 04             	push   0x4(%edx)
+  if(kb < 1)
+  27:	bb 01 00 00 00       	mov    $0x1,%ebx
+    kb = atoi(argv[1]);
+  2c:	e8 7f 04 00 00       	call   4b0 <atoi>
+  if(kb < 1)
+  31:	85 c0                	test   %eax,%eax
+  33:	0f 4f d8             	cmovg  %eax,%ebx
+  36:	83 c4 10             	add    $0x10,%esp
+    kb = 1;
+
+  if((fd = open("ringbench.in", O_CREATE|O_RDWR)) < 0){
+  39:	83 ec 08             	sub    $0x8,%esp
+  3c:	68 02 02 00 00       	push   $0x202
+  41:	68 db 0c 00 00       	push   $0xcdb
+  46:	e8 09 07 00 00       	call   754 <open>
+  4b:	83 c4 10             	add    $0x10,%esp
+  4e:	89 c2                	mov    %eax,%edx
+  50:	85 c0                	test   %eax,%eax
+  52:	0f 88 29 01 00 00    	js     181 <main+0x181>
+    printf(1, "ringbench: cannot create file\n");
+    exit();
+  }
+  for(i = 0; i < kb*2; i++){
+  58:	8d 04 1b             	lea    (%ebx,%ebx,1),%eax
+  5b:	89 5d bc             	mov    %ebx,-0x44(%ebp)
+  5e:	31 f6                	xor    %esi,%esi
+    for(j = 0; j < sizeof(buf); j++)
+      buf[j] = 'a' + (i + j) % 26;
+  60:	bf 4f ec c4 4e       	mov    $0x4ec4ec4f,%edi
+  for(i = 0; i < kb*2; i++){
+  65:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  68:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+  6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  6f:	90                   	nop
+    for(j = 0; j < sizeof(buf); j++)
+  70:	31 db                	xor    %ebx,%ebx
+  72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      buf[j] = 'a' + (i + j) % 26;
+  78:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    for(j = 0; j < sizeof(buf); j++)
+  7b:	83 c3 01             	add    $0x1,%ebx
+      buf[j] = 'a' + (i + j) % 26;
+  7e:	89 c8                	mov    %ecx,%eax
+  80:	f7 e7                	mul    %edi
+  82:	c1 ea 03             	shr    $0x3,%edx
+  85:	6b d2 1a             	imul   $0x1a,%edx,%edx
+  88:	29 d1                	sub    %edx,%ecx
+  8a:	83 c1 61             	add    $0x61,%ecx
+  8d:	88 8b 3f 12 00 00    	mov    %cl,0x123f(%ebx)
+    for(j = 0; j < sizeof(buf); j++)
+  93:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  99:	75 dd                	jne    78 <main+0x78>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+  9b:	83 ec 04             	sub    $0x4,%esp
+  9e:	68 00 02 00 00       	push   $0x200
+  a3:	68 40 12 00 00       	push   $0x1240
+  a8:	ff 75 c4             	push   -0x3c(%ebp)
+  ab:	e8 78 06 00 00       	call   728 <write>
+  b0:	83 c4 10             	add    $0x10,%esp
+  b3:	3d 00 02 00 00       	cmp    $0x200,%eax
+  b8:	0f 85 b0 00 00 00    	jne    16e <main+0x16e>
+  for(i = 0; i < kb*2; i++){
+  be:	83 c6 01             	add    $0x1,%esi
+  c1:	39 75 c0             	cmp    %esi,-0x40(%ebp)
+  c4:	75 aa                	jne    70 <main+0x70>
+      printf(1, "ringbench: write failed\n");
+      exit();
+    }
+  }
+  close(fd);
+  c6:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+  c9:	83 ec 0c             	sub    $0xc,%esp
+  cc:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+  cf:	52                   	push   %edx
+
+  n0 = run("cat", "ringbench.in", &sum0, &t0);
+  n1 = run("ringcat", "ringbench.in", &sum1, &t1);
+  printf(1, "cat: %d bytes, %d Kcycles\n", n0, (uint)(t0 >> 10));
+  printf(1, "ringcat: %d bytes, %d Kcycles\n", n1, (uint)(t1 >> 10));
+  if(n0 != kb*1024 || n1 != n0 || sum1 != sum0)
+  d0:	c1 e3 0a             	shl    $0xa,%ebx
+  close(fd);
+  d3:	e8 5b 06 00 00       	call   733 <close>
+  n0 = run("cat", "ringbench.in", &sum0, &t0);
+  d8:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  db:	50                   	push   %eax
+  dc:	8d 45 d0             	lea    -0x30(%ebp),%eax
+  df:	50                   	push   %eax
+  e0:	68 db 0c 00 00       	push   $0xcdb
+  e5:	68 05 0d 00 00       	push   $0xd05
+  ea:	e8 b1 00 00 00       	call   1a0 <run>
+  n1 = run("ringcat", "ringbench.in", &sum1, &t1);
+  ef:	83 c4 20             	add    $0x20,%esp
+  n0 = run("cat", "ringbench.in", &sum0, &t0);
+  f2:	89 c6                	mov    %eax,%esi
+  n1 = run("ringcat", "ringbench.in", &sum1, &t1);
+  f4:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  f7:	50                   	push   %eax
+  f8:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  fb:	50                   	push   %eax
+  fc:	68 db 0c 00 00       	push   $0xcdb
+ 101:	68 01 0d 00 00       	push   $0xd01
+ 106:	e8 95 00 00 00       	call   1a0 <run>
+  printf(1, "cat: %d bytes, %d Kcycles\n", n0, (uint)(t0 >> 10));
+ 10b:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  n1 = run("ringcat", "ringbench.in", &sum1, &t1);
+ 10e:	89 c7                	mov    %eax,%edi
+  printf(1, "cat: %d bytes, %d Kcycles\n", n0, (uint)(t0 >> 10));
+ 110:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 113:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+ 117:	50                   	push   %eax
+ 118:	56                   	push   %esi
+ 119:	68 09 0d 00 00       	push   $0xd09
+ 11e:	6a 01                	push   $0x1
+ 120:	e8 5b 08 00 00       	call   980 <printf>
+  printf(1, "ringcat: %d bytes, %d Kcycles\n", n1, (uint)(t1 >> 10));
+ 125:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 128:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 12b:	83 c4 20             	add    $0x20,%esp
+ 12e:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+ 132:	50                   	push   %eax
+ 133:	57                   	push   %edi
+ 134:	68 60 0d 00 00       	push   $0xd60
+ 139:	6a 01                	push   $0x1
+ 13b:	e8 40 08 00 00       	call   980 <printf>
+  if(n0 != kb*1024 || n1 != n0 || sum1 != sum0)
+ 140:	83 c4 10             	add    $0x10,%esp
+ 143:	39 f3                	cmp    %esi,%ebx
+ 145:	75 04                	jne    14b <main+0x14b>
+ 147:	39 fe                	cmp    %edi,%esi
+ 149:	74 49                	je     194 <main+0x194>
+    printf(1, "ringbench: outputs differ\n");
+ 14b:	50                   	push   %eax
+ 14c:	50                   	push   %eax
+ 14d:	68 24 0d 00 00       	push   $0xd24
+ 152:	6a 01                	push   $0x1
+ 154:	e8 27 08 00 00       	call   980 <printf>
+ 159:	83 c4 10             	add    $0x10,%esp
+  unlink("ringbench.in");
+ 15c:	83 ec 0c             	sub    $0xc,%esp
+ 15f:	68 db 0c 00 00       	push   $0xcdb
+ 164:	e8 01 06 00 00       	call   76a <unlink>
+  exit();
+ 169:	e8 8e 05 00 00       	call   6fc <exit>
+      printf(1, "ringbench: write failed\n");
+ 16e:	53                   	push   %ebx
+ 16f:	53                   	push   %ebx
+ 170:	68 e8 0c 00 00       	push   $0xce8
+ 175:	6a 01                	push   $0x1
+ 177:	e8 04 08 00 00       	call   980 <printf>
+      exit();
+ 17c:	e8 7b 05 00 00       	call   6fc <exit>
+    printf(1, "ringbench: cannot create file\n");
+ 181:	56                   	push   %esi
+ 182:	56                   	push   %esi
+ 183:	68 40 0d 00 00       	push   $0xd40
+ 188:	6a 01                	push   $0x1
+ 18a:	e8 f1 07 00 00       	call   980 <printf>
+    exit();
+ 18f:	e8 68 05 00 00       	call   6fc <exit>
+  if(n0 != kb*1024 || n1 != n0 || sum1 != sum0)
+ 194:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 197:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+ 19a:	75 af                	jne    14b <main+0x14b>
+ 19c:	eb be                	jmp    15c <main+0x15c>
+ 19e:	66 90                	xchg   %ax,%ax
+
+000001a0 <run>:
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+  if(pipe(fds) < 0){
+ 1a5:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+{
+ 1a8:	53                   	push   %ebx
+ 1a9:	83 ec 48             	sub    $0x48,%esp
+ 1ac:	8b 7d 14             	mov    0x14(%ebp),%edi
+  if(pipe(fds) < 0){
+ 1af:	50                   	push   %eax
+ 1b0:	e8 5d 05 00 00       	call   712 <pipe>
+ 1b5:	83 c4 10             	add    $0x10,%esp
+ 1b8:	85 c0                	test   %eax,%eax
+ 1ba:	0f 88 b1 00 00 00    	js     271 <run+0xd1>
+
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+ 1c0:	0f 31                	rdtsc
+  *t = rdtsc();
+ 1c2:	89 07                	mov    %eax,(%edi)
+ 1c4:	89 57 04             	mov    %edx,0x4(%edi)
+  if(fork() == 0){
+ 1c7:	e8 25 05 00 00       	call   6f1 <fork>
+ 1cc:	85 c0                	test   %eax,%eax
+ 1ce:	0f 84 b0 00 00 00    	je     284 <run+0xe4>
+  close(fds[1]);
+ 1d4:	83 ec 0c             	sub    $0xc,%esp
+ 1d7:	ff 75 d8             	push   -0x28(%ebp)
+  total = 0;
+ 1da:	31 db                	xor    %ebx,%ebx
+  close(fds[1]);
+ 1dc:	e8 52 05 00 00       	call   733 <close>
+  *sum = 0;
+ 1e1:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1e4:	89 7d 14             	mov    %edi,0x14(%ebp)
+  while((n = read(fds[0], buf, sizeof(buf))) > 0){
+ 1e7:	83 c4 10             	add    $0x10,%esp
+  *sum = 0;
+ 1ea:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  while((n = read(fds[0], buf, sizeof(buf))) > 0){
+ 1f0:	83 ec 04             	sub    $0x4,%esp
+ 1f3:	68 00 02 00 00       	push   $0x200
+ 1f8:	68 40 12 00 00       	push   $0x1240
+ 1fd:	ff 75 d4             	push   -0x2c(%ebp)
+ 200:	e8 18 05 00 00       	call   71d <read>
+ 205:	83 c4 10             	add    $0x10,%esp
+ 208:	89 c6                	mov    %eax,%esi
+ 20a:	85 c0                	test   %eax,%eax
+ 20c:	7e 3a                	jle    248 <run+0xa8>
+      *sum += (uchar)buf[i] * (total + i + 1);
+ 20e:	8b 45 10             	mov    0x10(%ebp),%eax
+ 211:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+ 214:	8d 7b 01             	lea    0x1(%ebx),%edi
+ 217:	8b 08                	mov    (%eax),%ecx
+    for(i = 0; i < n; i++)
+ 219:	31 c0                	xor    %eax,%eax
+ 21b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 21f:	90                   	nop
+      *sum += (uchar)buf[i] * (total + i + 1);
+ 220:	0f b6 98 40 12 00 00 	movzbl 0x1240(%eax),%ebx
+ 227:	8d 14 07             	lea    (%edi,%eax,1),%edx
+    for(i = 0; i < n; i++)
+ 22a:	83 c0 01             	add    $0x1,%eax
+      *sum += (uchar)buf[i] * (total + i + 1);
+ 22d:	0f af d3             	imul   %ebx,%edx
+ 230:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 233:	01 d1                	add    %edx,%ecx
+ 235:	89 0b                	mov    %ecx,(%ebx)
+    for(i = 0; i < n; i++)
+ 237:	39 c6                	cmp    %eax,%esi
+ 239:	75 e5                	jne    220 <run+0x80>
+    total += n;
+ 23b:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+ 23e:	01 f3                	add    %esi,%ebx
+ 240:	eb ae                	jmp    1f0 <run+0x50>
+ 242:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  close(fds[0]);
+ 248:	83 ec 0c             	sub    $0xc,%esp
+ 24b:	8b 7d 14             	mov    0x14(%ebp),%edi
+ 24e:	ff 75 d4             	push   -0x2c(%ebp)
+ 251:	e8 dd 04 00 00       	call   733 <close>
+  wait();
+ 256:	e8 ac 04 00 00       	call   707 <wait>
+ 25b:	0f 31                	rdtsc
+  *t = rdtsc() - *t;
+ 25d:	2b 07                	sub    (%edi),%eax
+ 25f:	1b 57 04             	sbb    0x4(%edi),%edx
+ 262:	89 07                	mov    %eax,(%edi)
+}
+ 264:	89 d8                	mov    %ebx,%eax
+  *t = rdtsc() - *t;
+ 266:	89 57 04             	mov    %edx,0x4(%edi)
+}
+ 269:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 26c:	5b                   	pop    %ebx
+ 26d:	5e                   	pop    %esi
+ 26e:	5f                   	pop    %edi
+ 26f:	5d                   	pop    %ebp
+ 270:	c3                   	ret
+    printf(1, "ringbench: pipe failed\n");
+ 271:	50                   	push   %eax
+ 272:	50                   	push   %eax
+ 273:	68 a8 0c 00 00       	push   $0xca8
+ 278:	6a 01                	push   $0x1
+ 27a:	e8 01 07 00 00       	call   980 <printf>
+    exit();
+ 27f:	e8 78 04 00 00       	call   6fc <exit>
+    close(1);
+ 284:	83 ec 0c             	sub    $0xc,%esp
+    argv[2] = 0;
+ 287:	31 db                	xor    %ebx,%ebx
+    close(1);
+ 289:	6a 01                	push   $0x1
+ 28b:	e8 a3 04 00 00       	call   733 <close>
+    dup(fds[1]);
+ 290:	58                   	pop    %eax
+ 291:	ff 75 d8             	push   -0x28(%ebp)
+ 294:	e8 08 05 00 00       	call   7a1 <dup>
+    close(fds[0]);
+ 299:	5a                   	pop    %edx
+ 29a:	ff 75 d4             	push   -0x2c(%ebp)
+ 29d:	e8 91 04 00 00       	call   733 <close>
+    close(fds[1]);
+ 2a2:	59                   	pop    %ecx
+ 2a3:	ff 75 d8             	push   -0x28(%ebp)
+ 2a6:	e8 88 04 00 00       	call   733 <close>
+    argv[0] = prog;
+ 2ab:	8b 45 08             	mov    0x8(%ebp),%eax
+    argv[2] = 0;
+ 2ae:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+    argv[0] = prog;
+ 2b1:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    argv[1] = file;
+ 2b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2b7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    exec(prog, argv);
+ 2ba:	8d 45 dc             	lea    -0x24(%ebp),%eax
+ 2bd:	5e                   	pop    %esi
+ 2be:	5f                   	pop    %edi
+ 2bf:	50                   	push   %eax
+ 2c0:	ff 75 08             	push   0x8(%ebp)
+ 2c3:	e8 81 04 00 00       	call   749 <exec>
+    printf(2, "ringbench: exec %s failed\n", prog);
+ 2c8:	83 c4 0c             	add    $0xc,%esp
+ 2cb:	ff 75 08             	push   0x8(%ebp)
+ 2ce:	68 c0 0c 00 00       	push   $0xcc0
+ 2d3:	6a 02                	push   $0x2
+ 2d5:	e8 a6 06 00 00       	call   980 <printf>
+    exit();
+ 2da:	e8 1d 04 00 00       	call   6fc <exit>
+ 2df:	90                   	nop
+
+000002e0 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 2e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2e1:	31 c0                	xor    %eax,%eax
+{
+ 2e3:	89 e5                	mov    %esp,%ebp
+ 2e5:	53                   	push   %ebx
+ 2e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 2f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 2f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 2f7:	83 c0 01             	add    $0x1,%eax
+ 2fa:	84 d2                	test   %dl,%dl
+ 2fc:	75 f2                	jne    2f0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 2fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 301:	89 c8                	mov    %ecx,%eax
+ 303:	c9                   	leave
+ 304:	c3                   	ret
+ 305:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	53                   	push   %ebx
+ 314:	8b 55 08             	mov    0x8(%ebp),%edx
+ 317:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 31a:	0f b6 02             	movzbl (%edx),%eax
+ 31d:	84 c0                	test   %al,%al
+ 31f:	75 17                	jne    338 <strcmp+0x28>
+ 321:	eb 3a                	jmp    35d <strcmp+0x4d>
+ 323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 327:	90                   	nop
+ 328:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 32c:	83 c2 01             	add    $0x1,%edx
+ 32f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 332:	84 c0                	test   %al,%al
+ 334:	74 1a                	je     350 <strcmp+0x40>
+    p++, q++;
+ 336:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 338:	0f b6 19             	movzbl (%ecx),%ebx
+ 33b:	38 c3                	cmp    %al,%bl
+ 33d:	74 e9                	je     328 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 33f:	29 d8                	sub    %ebx,%eax
+}
+ 341:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 344:	c9                   	leave
+ 345:	c3                   	ret
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 350:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 354:	31 c0                	xor    %eax,%eax
+ 356:	29 d8                	sub    %ebx,%eax
+}
+ 358:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 35b:	c9                   	leave
+ 35c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 35d:	0f b6 19             	movzbl (%ecx),%ebx
+ 360:	31 c0                	xor    %eax,%eax
+ 362:	eb db                	jmp    33f <strcmp+0x2f>
+ 364:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 36f:	90                   	nop
+
+00000370 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 376:	80 3a 00             	cmpb   $0x0,(%edx)
+ 379:	74 15                	je     390 <strlen+0x20>
+ 37b:	31 c0                	xor    %eax,%eax
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+ 380:	83 c0 01             	add    $0x1,%eax
+ 383:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 387:	89 c1                	mov    %eax,%ecx
+ 389:	75 f5                	jne    380 <strlen+0x10>
+    ;
+  return n;
+}
+ 38b:	89 c8                	mov    %ecx,%eax
+ 38d:	5d                   	pop    %ebp
+ 38e:	c3                   	ret
+ 38f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 390:	31 c9                	xor    %ecx,%ecx
+}
+ 392:	5d                   	pop    %ebp
+ 393:	89 c8                	mov    %ecx,%eax
+ 395:	c3                   	ret
+ 396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	57                   	push   %edi
+ 3a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("cld; rep stosb" :
+ 3a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3ad:	89 d7                	mov    %edx,%edi
+ 3af:	fc                   	cld
+ 3b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3b5:	89 d0                	mov    %edx,%eax
+ 3b7:	c9                   	leave
+ 3b8:	c3                   	ret
+ 3b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3ca:	0f b6 10             	movzbl (%eax),%edx
+ 3cd:	84 d2                	test   %dl,%dl
+ 3cf:	75 12                	jne    3e3 <strchr+0x23>
+ 3d1:	eb 1d                	jmp    3f0 <strchr+0x30>
+ 3d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3d7:	90                   	nop
+ 3d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3dc:	83 c0 01             	add    $0x1,%eax
+ 3df:	84 d2                	test   %dl,%dl
+ 3e1:	74 0d                	je     3f0 <strchr+0x30>
+    if(*s == c)
+ 3e3:	38 d1                	cmp    %dl,%cl
+ 3e5:	75 f1                	jne    3d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3e7:	5d                   	pop    %ebp
+ 3e8:	c3                   	ret
+ 3e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3f0:	31 c0                	xor    %eax,%eax
+}
+ 3f2:	5d                   	pop    %ebp
+ 3f3:	c3                   	ret
+ 3f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ff:	90                   	nop
+
+00000400 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 405:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 408:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 409:	31 db                	xor    %ebx,%ebx
+{
+ 40b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 40e:	eb 27                	jmp    437 <gets+0x37>
+    cc = read(0, &c, 1);
+ 410:	83 ec 04             	sub    $0x4,%esp
+ 413:	6a 01                	push   $0x1
+ 415:	56                   	push   %esi
+ 416:	6a 00                	push   $0x0
+ 418:	e8 00 03 00 00       	call   71d <read>
+    if(cc < 1)
+ 41d:	83 c4 10             	add    $0x10,%esp
+ 420:	85 c0                	test   %eax,%eax
+ 422:	7e 1d                	jle    441 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 424:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 428:	8b 55 08             	mov    0x8(%ebp),%edx
+ 42b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 42f:	3c 0a                	cmp    $0xa,%al
+ 431:	74 10                	je     443 <gets+0x43>
+ 433:	3c 0d                	cmp    $0xd,%al
+ 435:	74 0c                	je     443 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 437:	89 df                	mov    %ebx,%edi
+ 439:	83 c3 01             	add    $0x1,%ebx
+ 43c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 43f:	7c cf                	jl     410 <gets+0x10>
+ 441:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 443:	8b 45 08             	mov    0x8(%ebp),%eax
+ 446:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 44a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 44d:	5b                   	pop    %ebx
+ 44e:	5e                   	pop    %esi
+ 44f:	5f                   	pop    %edi
+ 450:	5d                   	pop    %ebp
+ 451:	c3                   	ret
+ 452:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 459:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	56                   	push   %esi
+ 464:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 465:	83 ec 08             	sub    $0x8,%esp
+ 468:	6a 00                	push   $0x0
+ 46a:	ff 75 08             	push   0x8(%ebp)
+ 46d:	e8 e2 02 00 00       	call   754 <open>
+  if(fd < 0)
+ 472:	83 c4 10             	add    $0x10,%esp
+ 475:	85 c0                	test   %eax,%eax
+ 477:	78 27                	js     4a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 479:	83 ec 08             	sub    $0x8,%esp
+ 47c:	ff 75 0c             	push   0xc(%ebp)
+ 47f:	89 c3                	mov    %eax,%ebx
+ 481:	50                   	push   %eax
+ 482:	e8 ee 02 00 00       	call   775 <fstat>
+  close(fd);
+ 487:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 48a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 48c:	e8 a2 02 00 00       	call   733 <close>
+  return r;
+ 491:	83 c4 10             	add    $0x10,%esp
+}
+ 494:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 497:	89 f0                	mov    %esi,%eax
+ 499:	5b                   	pop    %ebx
+ 49a:	5e                   	pop    %esi
+ 49b:	5d                   	pop    %ebp
+ 49c:	c3                   	ret
+ 49d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 4a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 4a5:	eb ed                	jmp    494 <stat+0x34>
+ 4a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ae:	66 90                	xchg   %ax,%ax
+
+000004b0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	53                   	push   %ebx
+ 4b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 4b7:	0f be 02             	movsbl (%edx),%eax
+ 4ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 4bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 4c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 4c5:	77 1e                	ja     4e5 <atoi+0x35>
+ 4c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4d0:	83 c2 01             	add    $0x1,%edx
+ 4d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 4d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 4da:	0f be 02             	movsbl (%edx),%eax
+ 4dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 4e0:	80 fb 09             	cmp    $0x9,%bl
+ 4e3:	76 eb                	jbe    4d0 <atoi+0x20>
+  return n;
+}
+ 4e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4e8:	89 c8                	mov    %ecx,%eax
+ 4ea:	c9                   	leave
+ 4eb:	c3                   	ret
+ 4ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004f0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	57                   	push   %edi
+ 4f4:	56                   	push   %esi
+ 4f5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4fe:	85 c0                	test   %eax,%eax
+ 500:	7e 13                	jle    515 <memmove+0x25>
+ 502:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 504:	89 d7                	mov    %edx,%edi
+ 506:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 510:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 511:	39 f8                	cmp    %edi,%eax
+ 513:	75 fb                	jne    510 <memmove+0x20>
+  return vdst;
+}
+ 515:	5e                   	pop    %esi
+ 516:	89 d0                	mov    %edx,%eax
+ 518:	5f                   	pop    %edi
+ 519:	5d                   	pop    %ebp
+ 51a:	c3                   	ret
+ 51b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 51f:	90                   	nop
+
+00000520 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 520:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 525:	85 c0                	test   %eax,%eax
+ 527:	74 07                	je     530 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 529:	c3                   	ret
+ 52a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 530:	e9 77 02 00 00       	jmp    7ac <sysgetpid>
+ 535:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000540 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 540:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 545:	c3                   	ret
+ 546:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000550 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 550:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 551:	31 d2                	xor    %edx,%edx
+ 553:	89 e5                	mov    %esp,%ebp
+ 555:	53                   	push   %ebx
+ 556:	83 ec 04             	sub    $0x4,%esp
+ 559:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 55c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 55f:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 562:	85 c9                	test   %ecx,%ecx
+ 564:	7e 08                	jle    56e <cyclereport+0x1e>
+ 566:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 568:	89 d8                	mov    %ebx,%eax
+ 56a:	f7 f1                	div    %ecx
+ 56c:	89 c2                	mov    %eax,%edx
+ 56e:	83 ec 08             	sub    $0x8,%esp
+ 571:	52                   	push   %edx
+ 572:	ff 75 0c             	push   0xc(%ebp)
+ 575:	51                   	push   %ecx
+ 576:	ff 75 08             	push   0x8(%ebp)
+ 579:	68 7f 0d 00 00       	push   $0xd7f
+ 57e:	6a 01                	push   $0x1
+ 580:	e8 fb 03 00 00       	call   980 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 585:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 588:	83 c4 20             	add    $0x20,%esp
+ 58b:	c9                   	leave
+ 58c:	c3                   	ret
+ 58d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000590 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 593:	8b 45 08             	mov    0x8(%ebp),%eax
+ 596:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 59c:	5d                   	pop    %ebp
+ 59d:	c3                   	ret
+ 59e:	66 90                	xchg   %ax,%ax
+
+000005a0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 5a0:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 5a1:	31 c0                	xor    %eax,%eax
+ 5a3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 5a8:	89 e5                	mov    %esp,%ebp
+ 5aa:	56                   	push   %esi
+ 5ab:	53                   	push   %ebx
+ 5ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 5af:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 5b3:	85 c0                	test   %eax,%eax
+ 5b5:	74 30                	je     5e7 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 5b7:	83 f8 02             	cmp    $0x2,%eax
+ 5ba:	74 0c                	je     5c8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 5bc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5c1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 5c4:	85 c0                	test   %eax,%eax
+ 5c6:	74 1f                	je     5e7 <mutex_lock+0x47>
+ 5c8:	be 02 00 00 00       	mov    $0x2,%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 5d0:	83 ec 08             	sub    $0x8,%esp
+ 5d3:	6a 02                	push   $0x2
+ 5d5:	53                   	push   %ebx
+ 5d6:	e8 8c 02 00 00       	call   867 <futex_wait>
+ 5db:	89 f0                	mov    %esi,%eax
+ 5dd:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 5e0:	83 c4 10             	add    $0x10,%esp
+ 5e3:	85 c0                	test   %eax,%eax
+ 5e5:	75 e9                	jne    5d0 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 5e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 5ea:	5b                   	pop    %ebx
+ 5eb:	5e                   	pop    %esi
+ 5ec:	5d                   	pop    %ebp
+ 5ed:	c3                   	ret
+ 5ee:	66 90                	xchg   %ax,%ax
+
+000005f0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	83 ec 08             	sub    $0x8,%esp
+ 5f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 5f9:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 5fd:	75 09                	jne    608 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 5ff:	c9                   	leave
+ 600:	c3                   	ret
+ 601:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 608:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 60b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 611:	6a 01                	push   $0x1
+ 613:	50                   	push   %eax
+ 614:	e8 59 02 00 00       	call   872 <futex_wake>
+ 619:	83 c4 10             	add    $0x10,%esp
+}
+ 61c:	c9                   	leave
+ 61d:	c3                   	ret
+ 61e:	66 90                	xchg   %ax,%ax
+
+00000620 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 623:	8b 45 08             	mov    0x8(%ebp),%eax
+ 626:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 62c:	5d                   	pop    %ebp
+ 62d:	c3                   	ret
+ 62e:	66 90                	xchg   %ax,%ax
+
+00000630 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	57                   	push   %edi
+ 634:	56                   	push   %esi
+ 635:	53                   	push   %ebx
+ 636:	83 ec 0c             	sub    $0xc,%esp
+ 639:	8b 75 08             	mov    0x8(%ebp),%esi
+ 63c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 63f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 641:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 645:	75 21                	jne    668 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 647:	83 ec 08             	sub    $0x8,%esp
+ 64a:	57                   	push   %edi
+ 64b:	56                   	push   %esi
+ 64c:	e8 16 02 00 00       	call   867 <futex_wait>
+  mutex_lock(m);
+ 651:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 654:	83 c4 10             	add    $0x10,%esp
+}
+ 657:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 65a:	5b                   	pop    %ebx
+ 65b:	5e                   	pop    %esi
+ 65c:	5f                   	pop    %edi
+ 65d:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 65e:	e9 3d ff ff ff       	jmp    5a0 <mutex_lock>
+ 663:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 667:	90                   	nop
+    futex_wake(&m->v, 1);
+ 668:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 66b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 671:	6a 01                	push   $0x1
+ 673:	53                   	push   %ebx
+ 674:	e8 f9 01 00 00       	call   872 <futex_wake>
+ 679:	83 c4 10             	add    $0x10,%esp
+ 67c:	eb c9                	jmp    647 <cond_wait+0x17>
+ 67e:	66 90                	xchg   %ax,%ax
+
+00000680 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	83 ec 10             	sub    $0x10,%esp
+ 686:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 689:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 68d:	6a 01                	push   $0x1
+ 68f:	50                   	push   %eax
+ 690:	e8 dd 01 00 00       	call   872 <futex_wake>
+}
+ 695:	83 c4 10             	add    $0x10,%esp
+ 698:	c9                   	leave
+ 699:	c3                   	ret
+ 69a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000006a0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	83 ec 10             	sub    $0x10,%esp
+ 6a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 6a9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 6ad:	68 ff ff ff 7f       	push   $0x7fffffff
+ 6b2:	50                   	push   %eax
+ 6b3:	e8 ba 01 00 00       	call   872 <futex_wake>
+}
+ 6b8:	83 c4 10             	add    $0x10,%esp
+ 6bb:	c9                   	leave
+ 6bc:	c3                   	ret
+
+000006bd <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 6bd:	50                   	push   %eax
+  pushl %ebx
+ 6be:	53                   	push   %ebx
+  movl $1, %eax
+ 6bf:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 6c4:	0f a2                	cpuid
+  popl %ebx
+ 6c6:	5b                   	pop    %ebx
+  popl %eax
+ 6c7:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 6c8:	c7 05 24 12 00 00 ee 	movl   $0x6ee,0x1224
+ 6cf:	06 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 6d2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 6d8:	74 14                	je     6ee <sysint>
+  movl $sysfast, syscallvec
+ 6da:	c7 05 24 12 00 00 e4 	movl   $0x6e4,0x1224
+ 6e1:	06 00 00 
+
+000006e4 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 6e4:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 6e6:	ba ed 06 00 00       	mov    $0x6ed,%edx
+  sysenter
+ 6eb:	0f 34                	sysenter
+1:
+  ret
+ 6ed:	c3                   	ret
+
+000006ee <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 6ee:	cd 40                	int    $0x40
+  ret
+ 6f0:	c3                   	ret
+
+000006f1 <fork>:
+
+SYSCALL(fork)
+ 6f1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6f6:	ff 25 24 12 00 00    	jmp    *0x1224
+
+000006fc <exit>:
+SYSCALL(exit)
+ 6fc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 701:	ff 25 24 12 00 00    	jmp    *0x1224
+
+00000707 <wait>:
+SYSCALL(wait)
+ 707:	b8 03 00 00 00       	mov    $0x3,%eax
+ 70c:	ff 25 24 12 00 00    	jmp    *0x1224
+
+00000712 <pipe>:
+SYSCALL(pipe)
+ 712:	b8 04 00 00 00       	mov    $0x4,%eax
+ 717:	ff 25 24 12 00 00    	jmp    *0x1224
+
+0000071d <read>:
+SYSCALL(read)
+ 71d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 722:	ff 25 24 12 00 00    	jmp    *0x1224
+
+00000728 <write>:
+SYSCALL(write)
+ 728:	b8 10 00 00 00       	mov    $0x10,%eax
+ 72d:	ff 25 24 12 00 00    	jmp    *0x1224
+
+00000733 <close>:
+SYSCALL(close)
+ 733:	b8 15 00 00 00       	mov    $0x15,%eax
+ 738:	ff 25 24 12 00 00    	jmp    *0x1224
+
+0000073e <kill>:
+SYSCALL(kill)
+ 73e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 743:	ff 25 24 12 00 00    	jmp    *0x1224
+
+00000749 <exec>:
+SYSCALL(exec)
+ 749:	b8 07 00 00 00       	mov    $0x7,%eax
+ 74e:	ff 25 24 12 00 00    	jmp    *0x1224
+
+00000754 <open>:
+SYSCALL(open)
+ 754:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 759:	ff 25 24 12 00 00    	jmp    *0x1224
+
+0000075f <mknod>:
+SYSCALL(mknod)
+ 75f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 764:	ff 25 24 12 00 00    	jmp    *0x1224
+
+0000076a <unlink>:
+SYSCALL(unlink)
+ 76a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 76f:	ff 25 24 12 00 00    	jmp    *0x1224
+
+00000775 <fstat>:
+SYSCALL(fstat)
+ 775:	b8 08 00 00 00       	mov    $0x8,%eax
+ 77a:	ff 25 24 12 00 00    	jmp    *0x1224
+
+00000780 <link>:
+SYSCALL(link)
+ 780:	b8 13 00 00 00       	mov    $0x13,%eax
+ 785:	ff 25 24 12 00 00    	jmp    *0x1224
+
+0000078b <mkdir>:
+SYSCALL(mkdir)
+ 78b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 790:	ff 25 24 12 00 00    	jmp    *0x1224
+
+00000796 <chdir>:
+SYSCALL(chdir)
+ 796:	b8 09 00 00 00       	mov    $0x9,%eax
+ 79b:	ff 25 24 12 00 00    	jmp    *0x1224
+
+000007a1 <dup>:
+SYSCALL(dup)
+ 7a1:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7a6:	ff 25 24 12 00 00    	jmp    *0x1224
+
+000007ac <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 7ac:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7b1:	ff 25 24 12 00 00    	jmp    *0x1224
+
+000007b7 <sbrk>:
+SYSCALL(sbrk)
+ 7b7:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7bc:	ff 25 24 12 00 00    	jmp    *0x1224
+
+000007c2 <sleep>:
+SYSCALL(sleep)
+ 7c2:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7c7:	ff 25 24 12 00 00    	jmp    *0x1224
+
+000007cd <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 7cd:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7d2:	ff 25 24 12 00 00    	jmp    *0x1224
+
+000007d8 <swapread>:
+SYSCALL(swapread)
+ 7d8:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7dd:	ff 25 24 12 00 00    	jmp    *0x1224
+
+000007e3 <swapwrite>:
+SYSCALL(swapwrite)
+ 7e3:	b8 17 00 00 00       	mov    $0x17,%eax
+ 7e8:	ff 25 24 12 00 00    	jmp    *0x1224
+
+000007ee <swapstat>:
+SYSCALL(swapstat)
+ 7ee:	b8 18 00 00 00       	mov    $0x18,%eax
+ 7f3:	ff 25 24 12 00 00    	jmp    *0x1224
+
+000007f9 <madvise>:
+SYSCALL(madvise)
+ 7f9:	b8 19 00 00 00       	mov    $0x19,%eax
+ 7fe:	ff 25 24 12 00 00    	jmp    *0x1224
+
+00000804 <mlock>:
+SYSCALL(mlock)
+ 804:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 809:	ff 25 24 12 00 00    	jmp    *0x1224
+
+0000080f <munlock>:
+SYSCALL(munlock)
+ 80f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 814:	ff 25 24 12 00 00    	jmp    *0x1224
+
+0000081a <membench>:
+SYSCALL(membench)
+ 81a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 81f:	ff 25 24 12 00 00    	jmp    *0x1224
+
+00000825 <nice>:
+SYSCALL(nice)
+ 825:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 82a:	ff 25 24 12 00 00    	jmp    *0x1224
+
+00000830 <setpriority>:
+SYSCALL(setpriority)
+ 830:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 835:	ff 25 24 12 00 00    	jmp    *0x1224
+
+0000083b <usleep>:
+SYSCALL(usleep)
+ 83b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 840:	ff 25 24 12 00 00    	jmp    *0x1224
+
+00000846 <cpustat>:
+SYSCALL(cpustat)
+ 846:	b8 20 00 00 00       	mov    $0x20,%eax
+ 84b:	ff 25 24 12 00 00    	jmp    *0x1224
+
+00000851 <clone>:
+SYSCALL(clone)
+ 851:	b8 21 00 00 00       	mov    $0x21,%eax
+ 856:	ff 25 24 12 00 00    	jmp    *0x1224
+
+0000085c <join>:
+SYSCALL(join)
+ 85c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 861:	ff 25 24 12 00 00    	jmp    *0x1224
+
+00000867 <futex_wait>:
+SYSCALL(futex_wait)
+ 867:	b8 23 00 00 00       	mov    $0x23,%eax
+ 86c:	ff 25 24 12 00 00    	jmp    *0x1224
+
+00000872 <futex_wake>:
+SYSCALL(futex_wake)
+ 872:	b8 24 00 00 00       	mov    $0x24,%eax
+ 877:	ff 25 24 12 00 00    	jmp    *0x1224
+
+0000087d <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 87d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 882:	ff 25 24 12 00 00    	jmp    *0x1224
+
+00000888 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 888:	b8 26 00 00 00       	mov    $0x26,%eax
+ 88d:	ff 25 24 12 00 00    	jmp    *0x1224
+
+00000893 <getcpu>:
+SYSCALL(getcpu)
+ 893:	b8 27 00 00 00       	mov    $0x27,%eax
+ 898:	ff 25 24 12 00 00    	jmp    *0x1224
+
+0000089e <migrations>:
+SYSCALL(migrations)
+ 89e:	b8 28 00 00 00       	mov    $0x28,%eax
+ 8a3:	ff 25 24 12 00 00    	jmp    *0x1224
+
+000008a9 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 8a9:	b8 29 00 00 00       	mov    $0x29,%eax
+ 8ae:	ff 25 24 12 00 00    	jmp    *0x1224
+
+000008b4 <lockstat>:
+SYSCALL(lockstat)
+ 8b4:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 8b9:	ff 25 24 12 00 00    	jmp    *0x1224
+
+000008bf <lockprof>:
+SYSCALL(lockprof)
+ 8bf:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 8c4:	ff 25 24 12 00 00    	jmp    *0x1224
+
+000008ca <bcachestat>:
+SYSCALL(bcachestat)
+ 8ca:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 8cf:	ff 25 24 12 00 00    	jmp    *0x1224
+ 8d5:	66 90                	xchg   %ax,%ax
+ 8d7:	66 90                	xchg   %ax,%ax
+ 8d9:	66 90                	xchg   %ax,%ax
+ 8db:	66 90                	xchg   %ax,%ax
+ 8dd:	66 90                	xchg   %ax,%ax
+ 8df:	90                   	nop
+
+000008e0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8e0:	55                   	push   %ebp
+ 8e1:	89 e5                	mov    %esp,%ebp
+ 8e3:	57                   	push   %edi
+ 8e4:	56                   	push   %esi
+ 8e5:	53                   	push   %ebx
+ 8e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 8e8:	89 d1                	mov    %edx,%ecx
+{
+ 8ea:	83 ec 3c             	sub    $0x3c,%esp
+ 8ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 8f0:	85 d2                	test   %edx,%edx
+ 8f2:	0f 89 80 00 00 00    	jns    978 <printint+0x98>
+ 8f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 8fc:	74 7a                	je     978 <printint+0x98>
+    x = -xx;
+ 8fe:	f7 d9                	neg    %ecx
+    neg = 1;
+ 900:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 905:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 908:	31 f6                	xor    %esi,%esi
+ 90a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 910:	89 c8                	mov    %ecx,%eax
+ 912:	31 d2                	xor    %edx,%edx
+ 914:	89 f7                	mov    %esi,%edi
+ 916:	f7 f3                	div    %ebx
+ 918:	8d 76 01             	lea    0x1(%esi),%esi
+ 91b:	0f b6 92 fc 0d 00 00 	movzbl 0xdfc(%edx),%edx
+ 922:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 926:	89 ca                	mov    %ecx,%edx
+ 928:	89 c1                	mov    %eax,%ecx
+ 92a:	39 da                	cmp    %ebx,%edx
+ 92c:	73 e2                	jae    910 <printint+0x30>
+  if(neg)
+ 92e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 931:	85 c0                	test   %eax,%eax
+ 933:	74 07                	je     93c <printint+0x5c>
+    buf[i++] = '-';
+ 935:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 93a:	89 f7                	mov    %esi,%edi
+ 93c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 93f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 942:	01 df                	add    %ebx,%edi
+ 944:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 948:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 94b:	83 ec 04             	sub    $0x4,%esp
+ 94e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 951:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 954:	6a 01                	push   $0x1
+ 956:	50                   	push   %eax
+ 957:	56                   	push   %esi
+ 958:	e8 cb fd ff ff       	call   728 <write>
+  while(--i >= 0)
+ 95d:	89 f8                	mov    %edi,%eax
+ 95f:	83 c4 10             	add    $0x10,%esp
+ 962:	83 ef 01             	sub    $0x1,%edi
+ 965:	39 d8                	cmp    %ebx,%eax
+ 967:	75 df                	jne    948 <printint+0x68>
+}
+ 969:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 96c:	5b                   	pop    %ebx
+ 96d:	5e                   	pop    %esi
+ 96e:	5f                   	pop    %edi
+ 96f:	5d                   	pop    %ebp
+ 970:	c3                   	ret
+ 971:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 978:	31 c0                	xor    %eax,%eax
+ 97a:	eb 89                	jmp    905 <printint+0x25>
+ 97c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000980 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 980:	55                   	push   %ebp
+ 981:	89 e5                	mov    %esp,%ebp
+ 983:	57                   	push   %edi
+ 984:	56                   	push   %esi
+ 985:	53                   	push   %ebx
+ 986:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 989:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 98c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 98f:	0f b6 1e             	movzbl (%esi),%ebx
+ 992:	83 c6 01             	add    $0x1,%esi
+ 995:	84 db                	test   %bl,%bl
+ 997:	74 67                	je     a00 <printf+0x80>
+ 999:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 99c:	31 d2                	xor    %edx,%edx
+ 99e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 9a1:	eb 34                	jmp    9d7 <printf+0x57>
+ 9a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9a7:	90                   	nop
+ 9a8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 9ab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 9b0:	83 f8 25             	cmp    $0x25,%eax
+ 9b3:	74 18                	je     9cd <printf+0x4d>
+  write(fd, &c, 1);
+ 9b5:	83 ec 04             	sub    $0x4,%esp
+ 9b8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 9bb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9be:	6a 01                	push   $0x1
+ 9c0:	50                   	push   %eax
+ 9c1:	57                   	push   %edi
+ 9c2:	e8 61 fd ff ff       	call   728 <write>
+ 9c7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 9ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 9cd:	0f b6 1e             	movzbl (%esi),%ebx
+ 9d0:	83 c6 01             	add    $0x1,%esi
+ 9d3:	84 db                	test   %bl,%bl
+ 9d5:	74 29                	je     a00 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 9d7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 9da:	85 d2                	test   %edx,%edx
+ 9dc:	74 ca                	je     9a8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 9de:	83 fa 25             	cmp    $0x25,%edx
+ 9e1:	75 ea                	jne    9cd <printf+0x4d>
+      if(c == 'd'){
+ 9e3:	83 f8 25             	cmp    $0x25,%eax
+ 9e6:	0f 84 24 01 00 00    	je     b10 <printf+0x190>
+ 9ec:	83 e8 63             	sub    $0x63,%eax
+ 9ef:	83 f8 15             	cmp    $0x15,%eax
+ 9f2:	77 1c                	ja     a10 <printf+0x90>
+ 9f4:	ff 24 85 a4 0d 00 00 	jmp    *0xda4(,%eax,4)
+ 9fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9ff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ a00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a03:	5b                   	pop    %ebx
+ a04:	5e                   	pop    %esi
+ a05:	5f                   	pop    %edi
+ a06:	5d                   	pop    %ebp
+ a07:	c3                   	ret
+ a08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0f:	90                   	nop
+  write(fd, &c, 1);
+ a10:	83 ec 04             	sub    $0x4,%esp
+ a13:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a16:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ a1a:	6a 01                	push   $0x1
+ a1c:	52                   	push   %edx
+ a1d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ a20:	57                   	push   %edi
+ a21:	e8 02 fd ff ff       	call   728 <write>
+ a26:	83 c4 0c             	add    $0xc,%esp
+ a29:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a2c:	6a 01                	push   $0x1
+ a2e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ a31:	52                   	push   %edx
+ a32:	57                   	push   %edi
+ a33:	e8 f0 fc ff ff       	call   728 <write>
+        putc(fd, c);
+ a38:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a3b:	31 d2                	xor    %edx,%edx
+ a3d:	eb 8e                	jmp    9cd <printf+0x4d>
+ a3f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ a40:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a43:	83 ec 0c             	sub    $0xc,%esp
+ a46:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a4b:	8b 13                	mov    (%ebx),%edx
+ a4d:	6a 00                	push   $0x0
+ a4f:	89 f8                	mov    %edi,%eax
+        ap++;
+ a51:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ a54:	e8 87 fe ff ff       	call   8e0 <printint>
+        ap++;
+ a59:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a5c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a5f:	31 d2                	xor    %edx,%edx
+ a61:	e9 67 ff ff ff       	jmp    9cd <printf+0x4d>
+ a66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a6d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a70:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a73:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a75:	83 c0 04             	add    $0x4,%eax
+ a78:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a7b:	85 db                	test   %ebx,%ebx
+ a7d:	0f 84 9d 00 00 00    	je     b20 <printf+0x1a0>
+        while(*s != 0){
+ a83:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a86:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a88:	84 c0                	test   %al,%al
+ a8a:	0f 84 3d ff ff ff    	je     9cd <printf+0x4d>
+ a90:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a93:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a96:	89 de                	mov    %ebx,%esi
+ a98:	89 d3                	mov    %edx,%ebx
+ a9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ aa0:	83 ec 04             	sub    $0x4,%esp
+ aa3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ aa6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ aa9:	6a 01                	push   $0x1
+ aab:	53                   	push   %ebx
+ aac:	57                   	push   %edi
+ aad:	e8 76 fc ff ff       	call   728 <write>
+        while(*s != 0){
+ ab2:	0f b6 06             	movzbl (%esi),%eax
+ ab5:	83 c4 10             	add    $0x10,%esp
+ ab8:	84 c0                	test   %al,%al
+ aba:	75 e4                	jne    aa0 <printf+0x120>
+      state = 0;
+ abc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ abf:	31 d2                	xor    %edx,%edx
+ ac1:	e9 07 ff ff ff       	jmp    9cd <printf+0x4d>
+ ac6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ acd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ ad0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ ad3:	83 ec 0c             	sub    $0xc,%esp
+ ad6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ adb:	8b 13                	mov    (%ebx),%edx
+ add:	6a 01                	push   $0x1
+ adf:	e9 6b ff ff ff       	jmp    a4f <printf+0xcf>
+ ae4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ ae8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ aeb:	83 ec 04             	sub    $0x4,%esp
+ aee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ af1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ af3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ af6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ af9:	6a 01                	push   $0x1
+ afb:	52                   	push   %edx
+ afc:	57                   	push   %edi
+ afd:	e8 26 fc ff ff       	call   728 <write>
+        ap++;
+ b02:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b05:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b08:	31 d2                	xor    %edx,%edx
+ b0a:	e9 be fe ff ff       	jmp    9cd <printf+0x4d>
+ b0f:	90                   	nop
+  write(fd, &c, 1);
+ b10:	83 ec 04             	sub    $0x4,%esp
+ b13:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b16:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b19:	6a 01                	push   $0x1
+ b1b:	e9 11 ff ff ff       	jmp    a31 <printf+0xb1>
+ b20:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ b25:	bb 9a 0d 00 00       	mov    $0xd9a,%ebx
+ b2a:	e9 61 ff ff ff       	jmp    a90 <printf+0x110>
+ b2f:	90                   	nop
+
+00000b30 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b30:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b31:	a1 40 14 00 00       	mov    0x1440,%eax
+{
+ b36:	89 e5                	mov    %esp,%ebp
+ b38:	57                   	push   %edi
+ b39:	56                   	push   %esi
+ b3a:	53                   	push   %ebx
+ b3b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ b3e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b48:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b4a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b4c:	39 ca                	cmp    %ecx,%edx
+ b4e:	73 30                	jae    b80 <free+0x50>
+ b50:	39 c1                	cmp    %eax,%ecx
+ b52:	72 04                	jb     b58 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b54:	39 c2                	cmp    %eax,%edx
+ b56:	72 f0                	jb     b48 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b58:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ b5b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ b5e:	39 f8                	cmp    %edi,%eax
+ b60:	74 2e                	je     b90 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b62:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ b65:	8b 42 04             	mov    0x4(%edx),%eax
+ b68:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b6b:	39 f1                	cmp    %esi,%ecx
+ b6d:	74 38                	je     ba7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b6f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b71:	5b                   	pop    %ebx
+  freep = p;
+ b72:	89 15 40 14 00 00    	mov    %edx,0x1440
+}
+ b78:	5e                   	pop    %esi
+ b79:	5f                   	pop    %edi
+ b7a:	5d                   	pop    %ebp
+ b7b:	c3                   	ret
+ b7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b80:	39 c1                	cmp    %eax,%ecx
+ b82:	72 d0                	jb     b54 <free+0x24>
+ b84:	eb c2                	jmp    b48 <free+0x18>
+ b86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b8d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ b90:	03 70 04             	add    0x4(%eax),%esi
+ b93:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b96:	8b 02                	mov    (%edx),%eax
+ b98:	8b 00                	mov    (%eax),%eax
+ b9a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ b9d:	8b 42 04             	mov    0x4(%edx),%eax
+ ba0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ba3:	39 f1                	cmp    %esi,%ecx
+ ba5:	75 c8                	jne    b6f <free+0x3f>
+    p->s.size += bp->s.size;
+ ba7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ baa:	89 15 40 14 00 00    	mov    %edx,0x1440
+    p->s.size += bp->s.size;
+ bb0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ bb3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ bb6:	89 0a                	mov    %ecx,(%edx)
+}
+ bb8:	5b                   	pop    %ebx
+ bb9:	5e                   	pop    %esi
+ bba:	5f                   	pop    %edi
+ bbb:	5d                   	pop    %ebp
+ bbc:	c3                   	ret
+ bbd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000bc0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ bc0:	55                   	push   %ebp
+ bc1:	89 e5                	mov    %esp,%ebp
+ bc3:	57                   	push   %edi
+ bc4:	56                   	push   %esi
+ bc5:	53                   	push   %ebx
+ bc6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ bcc:	8b 15 40 14 00 00    	mov    0x1440,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bd2:	8d 78 07             	lea    0x7(%eax),%edi
+ bd5:	c1 ef 03             	shr    $0x3,%edi
+ bd8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ bdb:	85 d2                	test   %edx,%edx
+ bdd:	0f 84 8d 00 00 00    	je     c70 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ be3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ be5:	8b 48 04             	mov    0x4(%eax),%ecx
+ be8:	39 f9                	cmp    %edi,%ecx
+ bea:	73 64                	jae    c50 <malloc+0x90>
+  if(nu < 4096)
+ bec:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ bf1:	39 df                	cmp    %ebx,%edi
+ bf3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ bf6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ bfd:	eb 0a                	jmp    c09 <malloc+0x49>
+ bff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c00:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c02:	8b 48 04             	mov    0x4(%eax),%ecx
+ c05:	39 f9                	cmp    %edi,%ecx
+ c07:	73 47                	jae    c50 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ c09:	89 c2                	mov    %eax,%edx
+ c0b:	39 05 40 14 00 00    	cmp    %eax,0x1440
+ c11:	75 ed                	jne    c00 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ c13:	83 ec 0c             	sub    $0xc,%esp
+ c16:	56                   	push   %esi
+ c17:	e8 9b fb ff ff       	call   7b7 <sbrk>
+  if(p == (char*)-1)
+ c1c:	83 c4 10             	add    $0x10,%esp
+ c1f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c22:	74 1c                	je     c40 <malloc+0x80>
+  hp->s.size = nu;
+ c24:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ c27:	83 ec 0c             	sub    $0xc,%esp
+ c2a:	83 c0 08             	add    $0x8,%eax
+ c2d:	50                   	push   %eax
+ c2e:	e8 fd fe ff ff       	call   b30 <free>
+  return freep;
+ c33:	8b 15 40 14 00 00    	mov    0x1440,%edx
+      if((p = morecore(nunits)) == 0)
+ c39:	83 c4 10             	add    $0x10,%esp
+ c3c:	85 d2                	test   %edx,%edx
+ c3e:	75 c0                	jne    c00 <malloc+0x40>
+        return 0;
+  }
+}
+ c40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ c43:	31 c0                	xor    %eax,%eax
+}
+ c45:	5b                   	pop    %ebx
+ c46:	5e                   	pop    %esi
+ c47:	5f                   	pop    %edi
+ c48:	5d                   	pop    %ebp
+ c49:	c3                   	ret
+ c4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ c50:	39 cf                	cmp    %ecx,%edi
+ c52:	74 4c                	je     ca0 <malloc+0xe0>
+        p->s.size -= nunits;
+ c54:	29 f9                	sub    %edi,%ecx
+ c56:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ c59:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ c5c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ c5f:	89 15 40 14 00 00    	mov    %edx,0x1440
+}
+ c65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ c68:	83 c0 08             	add    $0x8,%eax
+}
+ c6b:	5b                   	pop    %ebx
+ c6c:	5e                   	pop    %esi
+ c6d:	5f                   	pop    %edi
+ c6e:	5d                   	pop    %ebp
+ c6f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ c70:	c7 05 40 14 00 00 44 	movl   $0x1444,0x1440
+ c77:	14 00 00 
+    base.s.size = 0;
+ c7a:	b8 44 14 00 00       	mov    $0x1444,%eax
+    base.s.ptr = freep = prevp = &base;
+ c7f:	c7 05 44 14 00 00 44 	movl   $0x1444,0x1444
+ c86:	14 00 00 
+    base.s.size = 0;
+ c89:	c7 05 48 14 00 00 00 	movl   $0x0,0x1448
+ c90:	00 00 00 
+    if(p->s.size >= nunits){
+ c93:	e9 54 ff ff ff       	jmp    bec <malloc+0x2c>
+ c98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c9f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ca0:	8b 08                	mov    (%eax),%ecx
+ ca2:	89 0a                	mov    %ecx,(%edx)
+ ca4:	eb b9                	jmp    c5f <malloc+0x9f>
@@ -0,0 +1,87 @@
+// cat against ringcat: time each copying a file into a pipe,
+// and check that both deliver the same bytes.
+// usage: ringbench [kbytes]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "x86.h"
+
+char buf[512];
+
+// Run prog on file with its output into a pipe, and return
+// how many bytes came out and their sum in *sum.
+int
+run(char *prog, char *file, uint *sum, uint64 *t)
+{
+  char *argv[3];
+  int fds[2], i, n, total;
+
+  if(pipe(fds) < 0){
+    printf(1, "ringbench: pipe failed\n");
+    exit();
+  }
+  *t = rdtsc();
+  if(fork() == 0){
+    close(1);
+    dup(fds[1]);
+    close(fds[0]);
+    close(fds[1]);
+    argv[0] = prog;
+    argv[1] = file;
+    argv[2] = 0;
+    exec(prog, argv);
+    printf(2, "ringbench: exec %s failed\n", prog);
+    exit();
+  }
+  close(fds[1]);
+  total = 0;
+  *sum = 0;
+  while((n = read(fds[0], buf, sizeof(buf))) > 0){
+    for(i = 0; i < n; i++)
+      *sum += (uchar)buf[i] * (total + i + 1);
+    total += n;
+  }
+  close(fds[0]);
+  wait();
+  *t = rdtsc() - *t;
+  return total;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int fd, i, j, kb, n0, n1;
+  uint sum0, sum1;
+  uint64 t0, t1;
+
+  kb = 256;
+  if(argc > 1)
+    kb = atoi(argv[1]);
+  if(kb < 1)
+    kb = 1;
+
+  if((fd = open("ringbench.in", O_CREATE|O_RDWR)) < 0){
+    printf(1, "ringbench: cannot create file\n");
+    exit();
+  }
+  for(i = 0; i < kb*2; i++){
+    for(j = 0; j < sizeof(buf); j++)
+      buf[j] = 'a' + (i + j) % 26;
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+      printf(1, "ringbench: write failed\n");
+      exit();
+    }
+  }
+  close(fd);
+
+  n0 = run("cat", "ringbench.in", &sum0, &t0);
+  n1 = run("ringcat", "ringbench.in", &sum1, &t1);
+  printf(1, "cat: %d bytes, %d Kcycles\n", n0, (uint)(t0 >> 10));
+  printf(1, "ringcat: %d bytes, %d Kcycles\n", n1, (uint)(t1 >> 10));
+  if(n0 != kb*1024 || n1 != n0 || sum1 != sum0)
+    printf(1, "ringbench: outputs differ\n");
+  unlink("ringbench.in");
+  exit();
+}
@@ -0,0 +1,1836 @@
+
+_ringcat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 26                	jg     4f <main+0x4f>
+  29:	eb 52                	jmp    7d <main+0x7d>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "ringcat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+  30:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 1; i < argc; i++){
+  33:	83 c6 01             	add    $0x1,%esi
+  36:	83 c3 04             	add    $0x4,%ebx
+    cat(fd);
+  39:	50                   	push   %eax
+  3a:	e8 a1 00 00 00       	call   e0 <cat>
+    close(fd);
+  3f:	89 3c 24             	mov    %edi,(%esp)
+  42:	e8 0c 07 00 00       	call   753 <close>
+  for(i = 1; i < argc; i++){
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4d:	74 29                	je     78 <main+0x78>
+    if((fd = open(argv[i], 0)) < 0){
+  4f:	83 ec 08             	sub    $0x8,%esp
+  52:	6a 00                	push   $0x0
+  54:	ff 33                	push   (%ebx)
+  56:	e8 19 07 00 00       	call   774 <open>
+  5b:	83 c4 10             	add    $0x10,%esp
+  5e:	89 c7                	mov    %eax,%edi
+  60:	85 c0                	test   %eax,%eax
+  62:	79 cc                	jns    30 <main+0x30>
+      printf(1, "ringcat: cannot open %s\n", argv[i]);
+  64:	50                   	push   %eax
+  65:	ff 33                	push   (%ebx)
+  67:	68 0a 0d 00 00       	push   $0xd0a
+  6c:	6a 01                	push   $0x1
+  6e:	e8 2d 09 00 00       	call   9a0 <printf>
+      exit();
+  73:	e8 a4 06 00 00       	call   71c <exit>
+  }
+  exit();
+  78:	e8 9f 06 00 00       	call   71c <exit>
+    cat(0);
+  7d:	83 ec 0c             	sub    $0xc,%esp
+  80:	6a 00                	push   $0x0
+  82:	e8 59 00 00 00       	call   e0 <cat>
+    exit();
+  87:	e8 90 06 00 00       	call   71c <exit>
+  8c:	66 90                	xchg   %ax,%ax
+  8e:	66 90                	xchg   %ax,%ax
+
+00000090 <submit>:
+{
+  90:	55                   	push   %ebp
+  e = &ring.sq[ring.sqtail % IORING_SIZE];
+  91:	a1 44 32 00 00       	mov    0x3244,%eax
+  96:	83 e0 3f             	and    $0x3f,%eax
+{
+  99:	89 e5                	mov    %esp,%ebp
+  e->op = op;
+  9b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  a1:	8d 04 85 40 32 00 00 	lea    0x3240(,%eax,4),%eax
+  a8:	89 50 10             	mov    %edx,0x10(%eax)
+  e->fd = fd;
+  ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+  ae:	89 50 14             	mov    %edx,0x14(%eax)
+  e->addr = (uint)addr;
+  b1:	8b 55 10             	mov    0x10(%ebp),%edx
+  b4:	89 50 18             	mov    %edx,0x18(%eax)
+  e->n = n;
+  b7:	8b 55 14             	mov    0x14(%ebp),%edx
+  ba:	89 50 1c             	mov    %edx,0x1c(%eax)
+  e->data = data;
+  bd:	8b 55 18             	mov    0x18(%ebp),%edx
+  c0:	89 50 20             	mov    %edx,0x20(%eax)
+  ring.sqtail++;
+  c3:	a1 44 32 00 00       	mov    0x3244,%eax
+}
+  c8:	5d                   	pop    %ebp
+  ring.sqtail++;
+  c9:	83 c0 01             	add    $0x1,%eax
+  cc:	a3 44 32 00 00       	mov    %eax,0x3244
+}
+  d1:	c3                   	ret
+  d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000000e0 <cat>:
+{
+  e0:	55                   	push   %ebp
+  e1:	89 e5                	mov    %esp,%ebp
+  e3:	57                   	push   %edi
+  e4:	56                   	push   %esi
+  if(fstat(fd, &st) < 0 || st.type != T_FILE)
+  e5:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+{
+  e8:	53                   	push   %ebx
+    nr = 1;
+  e9:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+  ee:	83 ec 44             	sub    $0x44,%esp
+  f1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(fstat(fd, &st) < 0 || st.type != T_FILE)
+  f4:	50                   	push   %eax
+  f5:	57                   	push   %edi
+  f6:	e8 9a 06 00 00       	call   795 <fstat>
+    nr = 1;
+  fb:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+  if(fstat(fd, &st) < 0 || st.type != T_FILE)
+  fe:	83 c4 10             	add    $0x10,%esp
+ 101:	85 c0                	test   %eax,%eax
+ 103:	78 10                	js     115 <cat+0x35>
+    nr = 1;
+ 105:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+ 10a:	b8 10 00 00 00       	mov    $0x10,%eax
+ 10f:	0f 45 c3             	cmovne %ebx,%eax
+ 112:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  eof = 0;
+ 115:	31 f6                	xor    %esi,%esi
+ 117:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11e:	66 90                	xchg   %ax,%ax
+    if(!eof)
+ 120:	85 f6                	test   %esi,%esi
+ 122:	0f 84 b1 00 00 00    	je     1d9 <cat+0xf9>
+    ioring_enter(&ring);
+ 128:	83 ec 0c             	sub    $0xc,%esp
+ 12b:	68 40 32 00 00       	push   $0x3240
+ 130:	e8 94 07 00 00       	call   8c9 <ioring_enter>
+    if(ring.sqhead != ring.sqtail){
+ 135:	8b 15 40 32 00 00    	mov    0x3240,%edx
+ 13b:	83 c4 10             	add    $0x10,%esp
+ 13e:	a1 44 32 00 00       	mov    0x3244,%eax
+ 143:	39 c2                	cmp    %eax,%edx
+ 145:	0f 85 9f 01 00 00    	jne    2ea <cat+0x20a>
+    for(; ring.cqhead != ring.cqtail; ring.cqhead++){
+ 14b:	a1 48 32 00 00       	mov    0x3248,%eax
+ 150:	8b 15 4c 32 00 00    	mov    0x324c,%edx
+    nw = 0;
+ 156:	31 db                	xor    %ebx,%ebx
+    for(; ring.cqhead != ring.cqtail; ring.cqhead++){
+ 158:	39 c2                	cmp    %eax,%edx
+ 15a:	75 3b                	jne    197 <cat+0xb7>
+ 15c:	eb 73                	jmp    1d1 <cat+0xf1>
+ 15e:	66 90                	xchg   %ax,%ax
+        if(c->res != len[c->data & ~WRITING]){
+ 160:	80 e6 fe             	and    $0xfe,%dh
+ 163:	8b 0c 95 00 12 00 00 	mov    0x1200(,%edx,4),%ecx
+ 16a:	39 0c c5 44 32 00 00 	cmp    %ecx,0x3244(,%eax,8)
+ 171:	0f 85 4b 01 00 00    	jne    2c2 <cat+0x1e2>
+    for(; ring.cqhead != ring.cqtail; ring.cqhead++){
+ 177:	a1 48 32 00 00       	mov    0x3248,%eax
+ 17c:	83 c0 01             	add    $0x1,%eax
+ 17f:	a3 48 32 00 00       	mov    %eax,0x3248
+ 184:	8b 15 48 32 00 00    	mov    0x3248,%edx
+ 18a:	a1 4c 32 00 00       	mov    0x324c,%eax
+ 18f:	39 c2                	cmp    %eax,%edx
+ 191:	0f 84 a9 00 00 00    	je     240 <cat+0x160>
+      c = &ring.cq[ring.cqhead % IORING_SIZE];
+ 197:	a1 48 32 00 00       	mov    0x3248,%eax
+ 19c:	83 e0 3f             	and    $0x3f,%eax
+      if(c->data & WRITING){
+ 19f:	05 a2 00 00 00       	add    $0xa2,%eax
+ 1a4:	8b 14 c5 40 32 00 00 	mov    0x3240(,%eax,8),%edx
+ 1ab:	f6 c6 01             	test   $0x1,%dh
+ 1ae:	75 b0                	jne    160 <cat+0x80>
+      if(c->res < 0){
+ 1b0:	8b 04 c5 44 32 00 00 	mov    0x3244(,%eax,8),%eax
+ 1b7:	85 c0                	test   %eax,%eax
+ 1b9:	0f 88 17 01 00 00    	js     2d6 <cat+0x1f6>
+      if(c->res == 0)
+ 1bf:	74 6f                	je     230 <cat+0x150>
+      else if(!eof)
+ 1c1:	85 f6                	test   %esi,%esi
+ 1c3:	75 b2                	jne    177 <cat+0x97>
+        len[nw++] = c->res;
+ 1c5:	89 04 9d 00 12 00 00 	mov    %eax,0x1200(,%ebx,4)
+ 1cc:	83 c3 01             	add    $0x1,%ebx
+ 1cf:	eb a6                	jmp    177 <cat+0x97>
+  while(nw > 0 || !eof){
+ 1d1:	85 f6                	test   %esi,%esi
+ 1d3:	0f 85 e1 00 00 00    	jne    2ba <cat+0x1da>
+      for(i = 0; i < nr; i++)
+ 1d9:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+ 1dc:	31 d2                	xor    %edx,%edx
+ 1de:	66 90                	xchg   %ax,%ax
+  e = &ring.sq[ring.sqtail % IORING_SIZE];
+ 1e0:	a1 44 32 00 00       	mov    0x3244,%eax
+  e->addr = (uint)addr;
+ 1e5:	89 d3                	mov    %edx,%ebx
+ 1e7:	c1 e3 09             	shl    $0x9,%ebx
+  e = &ring.sq[ring.sqtail % IORING_SIZE];
+ 1ea:	83 e0 3f             	and    $0x3f,%eax
+  e->addr = (uint)addr;
+ 1ed:	81 c3 40 12 00 00    	add    $0x1240,%ebx
+  e->op = op;
+ 1f3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 1f6:	8d 04 85 40 32 00 00 	lea    0x3240(,%eax,4),%eax
+  e->data = data;
+ 1fd:	89 50 20             	mov    %edx,0x20(%eax)
+      for(i = 0; i < nr; i++)
+ 200:	83 c2 01             	add    $0x1,%edx
+  e->op = op;
+ 203:	c7 40 10 01 00 00 00 	movl   $0x1,0x10(%eax)
+  e->fd = fd;
+ 20a:	89 78 14             	mov    %edi,0x14(%eax)
+  e->addr = (uint)addr;
+ 20d:	89 58 18             	mov    %ebx,0x18(%eax)
+  e->n = n;
+ 210:	c7 40 1c 00 02 00 00 	movl   $0x200,0x1c(%eax)
+  ring.sqtail++;
+ 217:	a1 44 32 00 00       	mov    0x3244,%eax
+ 21c:	83 c0 01             	add    $0x1,%eax
+ 21f:	a3 44 32 00 00       	mov    %eax,0x3244
+      for(i = 0; i < nr; i++)
+ 224:	39 d1                	cmp    %edx,%ecx
+ 226:	75 b8                	jne    1e0 <cat+0x100>
+ 228:	31 f6                	xor    %esi,%esi
+ 22a:	e9 f9 fe ff ff       	jmp    128 <cat+0x48>
+ 22f:	90                   	nop
+        eof = 1;
+ 230:	be 01 00 00 00       	mov    $0x1,%esi
+ 235:	e9 3d ff ff ff       	jmp    177 <cat+0x97>
+ 23a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  while(nw > 0 || !eof){
+ 240:	85 f6                	test   %esi,%esi
+ 242:	74 04                	je     248 <cat+0x168>
+ 244:	85 db                	test   %ebx,%ebx
+ 246:	7e 72                	jle    2ba <cat+0x1da>
+    for(i = 0; i < nw; i++)
+ 248:	b9 40 12 00 00       	mov    $0x1240,%ecx
+ 24d:	31 d2                	xor    %edx,%edx
+ 24f:	85 db                	test   %ebx,%ebx
+ 251:	0f 84 c9 fe ff ff    	je     120 <cat+0x40>
+ 257:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ 25a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  e = &ring.sq[ring.sqtail % IORING_SIZE];
+ 260:	a1 44 32 00 00       	mov    0x3244,%eax
+      submit(IORING_WRITE, 1, buf[i], len[i], WRITING | i);
+ 265:	8b 34 95 00 12 00 00 	mov    0x1200(,%edx,4),%esi
+  e = &ring.sq[ring.sqtail % IORING_SIZE];
+ 26c:	83 e0 3f             	and    $0x3f,%eax
+  e->op = op;
+ 26f:	8d 04 80             	lea    (%eax,%eax,4),%eax
+ 272:	8d 04 85 40 32 00 00 	lea    0x3240(,%eax,4),%eax
+  e->n = n;
+ 279:	89 70 1c             	mov    %esi,0x1c(%eax)
+      submit(IORING_WRITE, 1, buf[i], len[i], WRITING | i);
+ 27c:	89 d6                	mov    %edx,%esi
+    for(i = 0; i < nw; i++)
+ 27e:	83 c2 01             	add    $0x1,%edx
+      submit(IORING_WRITE, 1, buf[i], len[i], WRITING | i);
+ 281:	81 ce 00 01 00 00    	or     $0x100,%esi
+  e->addr = (uint)addr;
+ 287:	89 48 18             	mov    %ecx,0x18(%eax)
+    for(i = 0; i < nw; i++)
+ 28a:	81 c1 00 02 00 00    	add    $0x200,%ecx
+  e->op = op;
+ 290:	c7 40 10 02 00 00 00 	movl   $0x2,0x10(%eax)
+  e->fd = fd;
+ 297:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+      submit(IORING_WRITE, 1, buf[i], len[i], WRITING | i);
+ 29e:	89 70 20             	mov    %esi,0x20(%eax)
+  ring.sqtail++;
+ 2a1:	a1 44 32 00 00       	mov    0x3244,%eax
+ 2a6:	83 c0 01             	add    $0x1,%eax
+ 2a9:	a3 44 32 00 00       	mov    %eax,0x3244
+    for(i = 0; i < nw; i++)
+ 2ae:	39 d3                	cmp    %edx,%ebx
+ 2b0:	75 ae                	jne    260 <cat+0x180>
+ 2b2:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+ 2b5:	e9 66 fe ff ff       	jmp    120 <cat+0x40>
+}
+ 2ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2bd:	5b                   	pop    %ebx
+ 2be:	5e                   	pop    %esi
+ 2bf:	5f                   	pop    %edi
+ 2c0:	5d                   	pop    %ebp
+ 2c1:	c3                   	ret
+          printf(1, "ringcat: write error\n");
+ 2c2:	83 ec 08             	sub    $0x8,%esp
+ 2c5:	68 df 0c 00 00       	push   $0xcdf
+ 2ca:	6a 01                	push   $0x1
+ 2cc:	e8 cf 06 00 00       	call   9a0 <printf>
+          exit();
+ 2d1:	e8 46 04 00 00       	call   71c <exit>
+        printf(1, "ringcat: read error\n");
+ 2d6:	83 ec 08             	sub    $0x8,%esp
+ 2d9:	68 f5 0c 00 00       	push   $0xcf5
+ 2de:	6a 01                	push   $0x1
+ 2e0:	e8 bb 06 00 00       	call   9a0 <printf>
+        exit();
+ 2e5:	e8 32 04 00 00       	call   71c <exit>
+      printf(1, "ringcat: ring stalled\n");
+ 2ea:	83 ec 08             	sub    $0x8,%esp
+ 2ed:	68 c8 0c 00 00       	push   $0xcc8
+ 2f2:	6a 01                	push   $0x1
+ 2f4:	e8 a7 06 00 00       	call   9a0 <printf>
+      exit();
+ 2f9:	e8 1e 04 00 00       	call   71c <exit>
+ 2fe:	66 90                	xchg   %ax,%ax
+
+00000300 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 300:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 301:	31 c0                	xor    %eax,%eax
+{
+ 303:	89 e5                	mov    %esp,%ebp
+ 305:	53                   	push   %ebx
+ 306:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 309:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 310:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 314:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 317:	83 c0 01             	add    $0x1,%eax
+ 31a:	84 d2                	test   %dl,%dl
+ 31c:	75 f2                	jne    310 <strcpy+0x10>
+    ;
+  return os;
+}
+ 31e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 321:	89 c8                	mov    %ecx,%eax
+ 323:	c9                   	leave
+ 324:	c3                   	ret
+ 325:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	53                   	push   %ebx
+ 334:	8b 55 08             	mov    0x8(%ebp),%edx
+ 337:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 33a:	0f b6 02             	movzbl (%edx),%eax
+ 33d:	84 c0                	test   %al,%al
+ 33f:	75 17                	jne    358 <strcmp+0x28>
+ 341:	eb 3a                	jmp    37d <strcmp+0x4d>
+ 343:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 347:	90                   	nop
+ 348:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 34c:	83 c2 01             	add    $0x1,%edx
+ 34f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 352:	84 c0                	test   %al,%al
+ 354:	74 1a                	je     370 <strcmp+0x40>
+    p++, q++;
+ 356:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 358:	0f b6 19             	movzbl (%ecx),%ebx
+ 35b:	38 c3                	cmp    %al,%bl
+ 35d:	74 e9                	je     348 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 35f:	29 d8                	sub    %ebx,%eax
+}
+ 361:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 364:	c9                   	leave
+ 365:	c3                   	ret
+ 366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 370:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 374:	31 c0                	xor    %eax,%eax
+ 376:	29 d8                	sub    %ebx,%eax
+}
+ 378:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 37b:	c9                   	leave
+ 37c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 37d:	0f b6 19             	movzbl (%ecx),%ebx
+ 380:	31 c0                	xor    %eax,%eax
+ 382:	eb db                	jmp    35f <strcmp+0x2f>
+ 384:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 38f:	90                   	nop
+
+00000390 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 396:	80 3a 00             	cmpb   $0x0,(%edx)
+ 399:	74 15                	je     3b0 <strlen+0x20>
+ 39b:	31 c0                	xor    %eax,%eax
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+ 3a0:	83 c0 01             	add    $0x1,%eax
+ 3a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3a7:	89 c1                	mov    %eax,%ecx
+ 3a9:	75 f5                	jne    3a0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3ab:	89 c8                	mov    %ecx,%eax
+ 3ad:	5d                   	pop    %ebp
+ 3ae:	c3                   	ret
+ 3af:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3b0:	31 c9                	xor    %ecx,%ecx
+}
+ 3b2:	5d                   	pop    %ebp
+ 3b3:	89 c8                	mov    %ecx,%eax
+ 3b5:	c3                   	ret
+ 3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	57                   	push   %edi
+ 3c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 3c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3cd:	89 d7                	mov    %edx,%edi
+ 3cf:	fc                   	cld
+ 3d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3d5:	89 d0                	mov    %edx,%eax
+ 3d7:	c9                   	leave
+ 3d8:	c3                   	ret
+ 3d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3ea:	0f b6 10             	movzbl (%eax),%edx
+ 3ed:	84 d2                	test   %dl,%dl
+ 3ef:	75 12                	jne    403 <strchr+0x23>
+ 3f1:	eb 1d                	jmp    410 <strchr+0x30>
+ 3f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3f7:	90                   	nop
+ 3f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3fc:	83 c0 01             	add    $0x1,%eax
+ 3ff:	84 d2                	test   %dl,%dl
+ 401:	74 0d                	je     410 <strchr+0x30>
+    if(*s == c)
+ 403:	38 d1                	cmp    %dl,%cl
+ 405:	75 f1                	jne    3f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 407:	5d                   	pop    %ebp
+ 408:	c3                   	ret
+ 409:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 410:	31 c0                	xor    %eax,%eax
+}
+ 412:	5d                   	pop    %ebp
+ 413:	c3                   	ret
+ 414:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 41f:	90                   	nop
+
+00000420 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	57                   	push   %edi
+ 424:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 425:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 428:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 429:	31 db                	xor    %ebx,%ebx
+{
+ 42b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 42e:	eb 27                	jmp    457 <gets+0x37>
+    cc = read(0, &c, 1);
+ 430:	83 ec 04             	sub    $0x4,%esp
+ 433:	6a 01                	push   $0x1
+ 435:	56                   	push   %esi
+ 436:	6a 00                	push   $0x0
+ 438:	e8 00 03 00 00       	call   73d <read>
+    if(cc < 1)
+ 43d:	83 c4 10             	add    $0x10,%esp
+ 440:	85 c0                	test   %eax,%eax
+ 442:	7e 1d                	jle    461 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 444:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 448:	8b 55 08             	mov    0x8(%ebp),%edx
+ 44b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 44f:	3c 0a                	cmp    $0xa,%al
+ 451:	74 10                	je     463 <gets+0x43>
+ 453:	3c 0d                	cmp    $0xd,%al
+ 455:	74 0c                	je     463 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 457:	89 df                	mov    %ebx,%edi
+ 459:	83 c3 01             	add    $0x1,%ebx
+ 45c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 45f:	7c cf                	jl     430 <gets+0x10>
+ 461:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 463:	8b 45 08             	mov    0x8(%ebp),%eax
+ 466:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 46a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 46d:	5b                   	pop    %ebx
+ 46e:	5e                   	pop    %esi
+ 46f:	5f                   	pop    %edi
+ 470:	5d                   	pop    %ebp
+ 471:	c3                   	ret
+ 472:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	56                   	push   %esi
+ 484:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 485:	83 ec 08             	sub    $0x8,%esp
+ 488:	6a 00                	push   $0x0
+ 48a:	ff 75 08             	push   0x8(%ebp)
+ 48d:	e8 e2 02 00 00       	call   774 <open>
+  if(fd < 0)
+ 492:	83 c4 10             	add    $0x10,%esp
+ 495:	85 c0                	test   %eax,%eax
+ 497:	78 27                	js     4c0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 499:	83 ec 08             	sub    $0x8,%esp
+ 49c:	ff 75 0c             	push   0xc(%ebp)
+ 49f:	89 c3                	mov    %eax,%ebx
+ 4a1:	50                   	push   %eax
+ 4a2:	e8 ee 02 00 00       	call   795 <fstat>
+  close(fd);
+ 4a7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4aa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4ac:	e8 a2 02 00 00       	call   753 <close>
+  return r;
+ 4b1:	83 c4 10             	add    $0x10,%esp
+}
+ 4b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4b7:	89 f0                	mov    %esi,%eax
+ 4b9:	5b                   	pop    %ebx
+ 4ba:	5e                   	pop    %esi
+ 4bb:	5d                   	pop    %ebp
+ 4bc:	c3                   	ret
+ 4bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 4c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 4c5:	eb ed                	jmp    4b4 <stat+0x34>
+ 4c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ce:	66 90                	xchg   %ax,%ax
+
+000004d0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	53                   	push   %ebx
+ 4d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 4d7:	0f be 02             	movsbl (%edx),%eax
+ 4da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 4dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 4e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 4e5:	77 1e                	ja     505 <atoi+0x35>
+ 4e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4f0:	83 c2 01             	add    $0x1,%edx
+ 4f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 4f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 4fa:	0f be 02             	movsbl (%edx),%eax
+ 4fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 500:	80 fb 09             	cmp    $0x9,%bl
+ 503:	76 eb                	jbe    4f0 <atoi+0x20>
+  return n;
+}
+ 505:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 508:	89 c8                	mov    %ecx,%eax
+ 50a:	c9                   	leave
+ 50b:	c3                   	ret
+ 50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000510 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+ 514:	56                   	push   %esi
+ 515:	8b 45 10             	mov    0x10(%ebp),%eax
+ 518:	8b 55 08             	mov    0x8(%ebp),%edx
+ 51b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 51e:	85 c0                	test   %eax,%eax
+ 520:	7e 13                	jle    535 <memmove+0x25>
+ 522:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 524:	89 d7                	mov    %edx,%edi
+ 526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 530:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 531:	39 f8                	cmp    %edi,%eax
+ 533:	75 fb                	jne    530 <memmove+0x20>
+  return vdst;
+}
+ 535:	5e                   	pop    %esi
+ 536:	89 d0                	mov    %edx,%eax
+ 538:	5f                   	pop    %edi
+ 539:	5d                   	pop    %ebp
+ 53a:	c3                   	ret
+ 53b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 53f:	90                   	nop
+
+00000540 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 540:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 545:	85 c0                	test   %eax,%eax
+ 547:	74 07                	je     550 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 549:	c3                   	ret
+ 54a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 550:	e9 77 02 00 00       	jmp    7cc <sysgetpid>
+ 555:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000560 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 560:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 565:	c3                   	ret
+ 566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000570 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 570:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 571:	31 d2                	xor    %edx,%edx
+ 573:	89 e5                	mov    %esp,%ebp
+ 575:	53                   	push   %ebx
+ 576:	83 ec 04             	sub    $0x4,%esp
+ 579:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 57c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 57f:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 582:	85 c9                	test   %ecx,%ecx
+ 584:	7e 08                	jle    58e <cyclereport+0x1e>
+ 586:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 588:	89 d8                	mov    %ebx,%eax
+ 58a:	f7 f1                	div    %ecx
+ 58c:	89 c2                	mov    %eax,%edx
+ 58e:	83 ec 08             	sub    $0x8,%esp
+ 591:	52                   	push   %edx
+ 592:	ff 75 0c             	push   0xc(%ebp)
+ 595:	51                   	push   %ecx
+ 596:	ff 75 08             	push   0x8(%ebp)
+ 599:	68 23 0d 00 00       	push   $0xd23
+ 59e:	6a 01                	push   $0x1
+ 5a0:	e8 fb 03 00 00       	call   9a0 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 5a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5a8:	83 c4 20             	add    $0x20,%esp
+ 5ab:	c9                   	leave
+ 5ac:	c3                   	ret
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005b0 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 5b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 5bc:	5d                   	pop    %ebp
+ 5bd:	c3                   	ret
+ 5be:	66 90                	xchg   %ax,%ax
+
+000005c0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 5c0:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 5c1:	31 c0                	xor    %eax,%eax
+ 5c3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 5c8:	89 e5                	mov    %esp,%ebp
+ 5ca:	56                   	push   %esi
+ 5cb:	53                   	push   %ebx
+ 5cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 5cf:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 5d3:	85 c0                	test   %eax,%eax
+ 5d5:	74 30                	je     607 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 5d7:	83 f8 02             	cmp    $0x2,%eax
+ 5da:	74 0c                	je     5e8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 5dc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5e1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 5e4:	85 c0                	test   %eax,%eax
+ 5e6:	74 1f                	je     607 <mutex_lock+0x47>
+ 5e8:	be 02 00 00 00       	mov    $0x2,%esi
+ 5ed:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 5f0:	83 ec 08             	sub    $0x8,%esp
+ 5f3:	6a 02                	push   $0x2
+ 5f5:	53                   	push   %ebx
+ 5f6:	e8 8c 02 00 00       	call   887 <futex_wait>
+ 5fb:	89 f0                	mov    %esi,%eax
+ 5fd:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 600:	83 c4 10             	add    $0x10,%esp
+ 603:	85 c0                	test   %eax,%eax
+ 605:	75 e9                	jne    5f0 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 607:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 60a:	5b                   	pop    %ebx
+ 60b:	5e                   	pop    %esi
+ 60c:	5d                   	pop    %ebp
+ 60d:	c3                   	ret
+ 60e:	66 90                	xchg   %ax,%ax
+
+00000610 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	83 ec 08             	sub    $0x8,%esp
+ 616:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 619:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 61d:	75 09                	jne    628 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 61f:	c9                   	leave
+ 620:	c3                   	ret
+ 621:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 628:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 62b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 631:	6a 01                	push   $0x1
+ 633:	50                   	push   %eax
+ 634:	e8 59 02 00 00       	call   892 <futex_wake>
+ 639:	83 c4 10             	add    $0x10,%esp
+}
+ 63c:	c9                   	leave
+ 63d:	c3                   	ret
+ 63e:	66 90                	xchg   %ax,%ax
+
+00000640 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 643:	8b 45 08             	mov    0x8(%ebp),%eax
+ 646:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 64c:	5d                   	pop    %ebp
+ 64d:	c3                   	ret
+ 64e:	66 90                	xchg   %ax,%ax
+
+00000650 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	57                   	push   %edi
+ 654:	56                   	push   %esi
+ 655:	53                   	push   %ebx
+ 656:	83 ec 0c             	sub    $0xc,%esp
+ 659:	8b 75 08             	mov    0x8(%ebp),%esi
+ 65c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 65f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 661:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 665:	75 21                	jne    688 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 667:	83 ec 08             	sub    $0x8,%esp
+ 66a:	57                   	push   %edi
+ 66b:	56                   	push   %esi
+ 66c:	e8 16 02 00 00       	call   887 <futex_wait>
+  mutex_lock(m);
+ 671:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 674:	83 c4 10             	add    $0x10,%esp
+}
+ 677:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 67a:	5b                   	pop    %ebx
+ 67b:	5e                   	pop    %esi
+ 67c:	5f                   	pop    %edi
+ 67d:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 67e:	e9 3d ff ff ff       	jmp    5c0 <mutex_lock>
+ 683:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 687:	90                   	nop
+    futex_wake(&m->v, 1);
+ 688:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 68b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 691:	6a 01                	push   $0x1
+ 693:	53                   	push   %ebx
+ 694:	e8 f9 01 00 00       	call   892 <futex_wake>
+ 699:	83 c4 10             	add    $0x10,%esp
+ 69c:	eb c9                	jmp    667 <cond_wait+0x17>
+ 69e:	66 90                	xchg   %ax,%ax
+
+000006a0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	83 ec 10             	sub    $0x10,%esp
+ 6a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 6a9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 6ad:	6a 01                	push   $0x1
+ 6af:	50                   	push   %eax
+ 6b0:	e8 dd 01 00 00       	call   892 <futex_wake>
+}
+ 6b5:	83 c4 10             	add    $0x10,%esp
+ 6b8:	c9                   	leave
+ 6b9:	c3                   	ret
+ 6ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000006c0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 e5                	mov    %esp,%ebp
+ 6c3:	83 ec 10             	sub    $0x10,%esp
+ 6c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 6c9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 6cd:	68 ff ff ff 7f       	push   $0x7fffffff
+ 6d2:	50                   	push   %eax
+ 6d3:	e8 ba 01 00 00       	call   892 <futex_wake>
+}
+ 6d8:	83 c4 10             	add    $0x10,%esp
+ 6db:	c9                   	leave
+ 6dc:	c3                   	ret
+
+000006dd <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 6dd:	50                   	push   %eax
+  pushl %ebx
+ 6de:	53                   	push   %ebx
+  movl $1, %eax
+ 6df:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 6e4:	0f a2                	cpuid
+  popl %ebx
+ 6e6:	5b                   	pop    %ebx
+  popl %eax
+ 6e7:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 6e8:	c7 05 e8 11 00 00 0e 	movl   $0x70e,0x11e8
+ 6ef:	07 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 6f2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 6f8:	74 14                	je     70e <sysint>
+  movl $sysfast, syscallvec
+ 6fa:	c7 05 e8 11 00 00 04 	movl   $0x704,0x11e8
+ 701:	07 00 00 
+
+00000704 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 704:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 706:	ba 0d 07 00 00       	mov    $0x70d,%edx
+  sysenter
+ 70b:	0f 34                	sysenter
+1:
+  ret
+ 70d:	c3                   	ret
+
+0000070e <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 70e:	cd 40                	int    $0x40
+  ret
+ 710:	c3                   	ret
+
+00000711 <fork>:
+
+SYSCALL(fork)
+ 711:	b8 01 00 00 00       	mov    $0x1,%eax
+ 716:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+0000071c <exit>:
+SYSCALL(exit)
+ 71c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 721:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+00000727 <wait>:
+SYSCALL(wait)
+ 727:	b8 03 00 00 00       	mov    $0x3,%eax
+ 72c:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+00000732 <pipe>:
+SYSCALL(pipe)
+ 732:	b8 04 00 00 00       	mov    $0x4,%eax
+ 737:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+0000073d <read>:
+SYSCALL(read)
+ 73d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 742:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+00000748 <write>:
+SYSCALL(write)
+ 748:	b8 10 00 00 00       	mov    $0x10,%eax
+ 74d:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+00000753 <close>:
+SYSCALL(close)
+ 753:	b8 15 00 00 00       	mov    $0x15,%eax
+ 758:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+0000075e <kill>:
+SYSCALL(kill)
+ 75e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 763:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+00000769 <exec>:
+SYSCALL(exec)
+ 769:	b8 07 00 00 00       	mov    $0x7,%eax
+ 76e:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+00000774 <open>:
+SYSCALL(open)
+ 774:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 779:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+0000077f <mknod>:
+SYSCALL(mknod)
+ 77f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 784:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+0000078a <unlink>:
+SYSCALL(unlink)
+ 78a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 78f:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+00000795 <fstat>:
+SYSCALL(fstat)
+ 795:	b8 08 00 00 00       	mov    $0x8,%eax
+ 79a:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+000007a0 <link>:
+SYSCALL(link)
+ 7a0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7a5:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+000007ab <mkdir>:
+SYSCALL(mkdir)
+ 7ab:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7b0:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+000007b6 <chdir>:
+SYSCALL(chdir)
+ 7b6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7bb:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+000007c1 <dup>:
+SYSCALL(dup)
+ 7c1:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7c6:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+000007cc <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 7cc:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7d1:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+000007d7 <sbrk>:
+SYSCALL(sbrk)
+ 7d7:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7dc:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+000007e2 <sleep>:
+SYSCALL(sleep)
+ 7e2:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7e7:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+000007ed <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 7ed:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7f2:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+000007f8 <swapread>:
+SYSCALL(swapread)
+ 7f8:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7fd:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+00000803 <swapwrite>:
+SYSCALL(swapwrite)
+ 803:	b8 17 00 00 00       	mov    $0x17,%eax
+ 808:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+0000080e <swapstat>:
+SYSCALL(swapstat)
+ 80e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 813:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+00000819 <madvise>:
+SYSCALL(madvise)
+ 819:	b8 19 00 00 00       	mov    $0x19,%eax
+ 81e:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+00000824 <mlock>:
+SYSCALL(mlock)
+ 824:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 829:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+0000082f <munlock>:
+SYSCALL(munlock)
+ 82f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 834:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+0000083a <membench>:
+SYSCALL(membench)
+ 83a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 83f:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+00000845 <nice>:
+SYSCALL(nice)
+ 845:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 84a:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+00000850 <setpriority>:
+SYSCALL(setpriority)
+ 850:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 855:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+0000085b <usleep>:
+SYSCALL(usleep)
+ 85b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 860:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+00000866 <cpustat>:
+SYSCALL(cpustat)
+ 866:	b8 20 00 00 00       	mov    $0x20,%eax
+ 86b:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+00000871 <clone>:
+SYSCALL(clone)
+ 871:	b8 21 00 00 00       	mov    $0x21,%eax
+ 876:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+0000087c <join>:
+SYSCALL(join)
+ 87c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 881:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+00000887 <futex_wait>:
+SYSCALL(futex_wait)
+ 887:	b8 23 00 00 00       	mov    $0x23,%eax
+ 88c:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+00000892 <futex_wake>:
+SYSCALL(futex_wake)
+ 892:	b8 24 00 00 00       	mov    $0x24,%eax
+ 897:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+0000089d <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 89d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 8a2:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+000008a8 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 8a8:	b8 26 00 00 00       	mov    $0x26,%eax
+ 8ad:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+000008b3 <getcpu>:
+SYSCALL(getcpu)
+ 8b3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 8b8:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+000008be <migrations>:
+SYSCALL(migrations)
+ 8be:	b8 28 00 00 00       	mov    $0x28,%eax
+ 8c3:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+000008c9 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 8c9:	b8 29 00 00 00       	mov    $0x29,%eax
+ 8ce:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+000008d4 <lockstat>:
+SYSCALL(lockstat)
+ 8d4:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 8d9:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+000008df <lockprof>:
+SYSCALL(lockprof)
+ 8df:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 8e4:	ff 25 e8 11 00 00    	jmp    *0x11e8
+
+000008ea <bcachestat>:
+SYSCALL(bcachestat)
+ 8ea:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 8ef:	ff 25 e8 11 00 00    	jmp    *0x11e8
+ 8f5:	66 90                	xchg   %ax,%ax
+ 8f7:	66 90                	xchg   %ax,%ax
+ 8f9:	66 90                	xchg   %ax,%ax
+ 8fb:	66 90                	xchg   %ax,%ax
+ 8fd:	66 90                	xchg   %ax,%ax
+ 8ff:	90                   	nop
+
+00000900 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 900:	55                   	push   %ebp
+ 901:	89 e5                	mov    %esp,%ebp
+ 903:	57                   	push   %edi
+ 904:	56                   	push   %esi
+ 905:	53                   	push   %ebx
+ 906:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 908:	89 d1                	mov    %edx,%ecx
+{
+ 90a:	83 ec 3c             	sub    $0x3c,%esp
+ 90d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 910:	85 d2                	test   %edx,%edx
+ 912:	0f 89 80 00 00 00    	jns    998 <printint+0x98>
+ 918:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 91c:	74 7a                	je     998 <printint+0x98>
+    x = -xx;
+ 91e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 920:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 925:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 928:	31 f6                	xor    %esi,%esi
+ 92a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 930:	89 c8                	mov    %ecx,%eax
+ 932:	31 d2                	xor    %edx,%edx
+ 934:	89 f7                	mov    %esi,%edi
+ 936:	f7 f3                	div    %ebx
+ 938:	8d 76 01             	lea    0x1(%esi),%esi
+ 93b:	0f b6 92 a0 0d 00 00 	movzbl 0xda0(%edx),%edx
+ 942:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 946:	89 ca                	mov    %ecx,%edx
+ 948:	89 c1                	mov    %eax,%ecx
+ 94a:	39 da                	cmp    %ebx,%edx
+ 94c:	73 e2                	jae    930 <printint+0x30>
+  if(neg)
+ 94e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 951:	85 c0                	test   %eax,%eax
+ 953:	74 07                	je     95c <printint+0x5c>
+    buf[i++] = '-';
+ 955:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 95a:	89 f7                	mov    %esi,%edi
+ 95c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 95f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 962:	01 df                	add    %ebx,%edi
+ 964:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 968:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 96b:	83 ec 04             	sub    $0x4,%esp
+ 96e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 971:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 974:	6a 01                	push   $0x1
+ 976:	50                   	push   %eax
+ 977:	56                   	push   %esi
+ 978:	e8 cb fd ff ff       	call   748 <write>
+  while(--i >= 0)
+ 97d:	89 f8                	mov    %edi,%eax
+ 97f:	83 c4 10             	add    $0x10,%esp
+ 982:	83 ef 01             	sub    $0x1,%edi
+ 985:	39 d8                	cmp    %ebx,%eax
+ 987:	75 df                	jne    968 <printint+0x68>
+}
+ 989:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 98c:	5b                   	pop    %ebx
+ 98d:	5e                   	pop    %esi
+ 98e:	5f                   	pop    %edi
+ 98f:	5d                   	pop    %ebp
+ 990:	c3                   	ret
+ 991:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 998:	31 c0                	xor    %eax,%eax
+ 99a:	eb 89                	jmp    925 <printint+0x25>
+ 99c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000009a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 9a0:	55                   	push   %ebp
+ 9a1:	89 e5                	mov    %esp,%ebp
+ 9a3:	57                   	push   %edi
+ 9a4:	56                   	push   %esi
+ 9a5:	53                   	push   %ebx
+ 9a6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 9a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 9ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 9af:	0f b6 1e             	movzbl (%esi),%ebx
+ 9b2:	83 c6 01             	add    $0x1,%esi
+ 9b5:	84 db                	test   %bl,%bl
+ 9b7:	74 67                	je     a20 <printf+0x80>
+ 9b9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 9bc:	31 d2                	xor    %edx,%edx
+ 9be:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 9c1:	eb 34                	jmp    9f7 <printf+0x57>
+ 9c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9c7:	90                   	nop
+ 9c8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 9cb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 9d0:	83 f8 25             	cmp    $0x25,%eax
+ 9d3:	74 18                	je     9ed <printf+0x4d>
+  write(fd, &c, 1);
+ 9d5:	83 ec 04             	sub    $0x4,%esp
+ 9d8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 9db:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9de:	6a 01                	push   $0x1
+ 9e0:	50                   	push   %eax
+ 9e1:	57                   	push   %edi
+ 9e2:	e8 61 fd ff ff       	call   748 <write>
+ 9e7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 9ea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 9ed:	0f b6 1e             	movzbl (%esi),%ebx
+ 9f0:	83 c6 01             	add    $0x1,%esi
+ 9f3:	84 db                	test   %bl,%bl
+ 9f5:	74 29                	je     a20 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 9f7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 9fa:	85 d2                	test   %edx,%edx
+ 9fc:	74 ca                	je     9c8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 9fe:	83 fa 25             	cmp    $0x25,%edx
+ a01:	75 ea                	jne    9ed <printf+0x4d>
+      if(c == 'd'){
+ a03:	83 f8 25             	cmp    $0x25,%eax
+ a06:	0f 84 24 01 00 00    	je     b30 <printf+0x190>
+ a0c:	83 e8 63             	sub    $0x63,%eax
+ a0f:	83 f8 15             	cmp    $0x15,%eax
+ a12:	77 1c                	ja     a30 <printf+0x90>
+ a14:	ff 24 85 48 0d 00 00 	jmp    *0xd48(,%eax,4)
+ a1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a1f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ a20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a23:	5b                   	pop    %ebx
+ a24:	5e                   	pop    %esi
+ a25:	5f                   	pop    %edi
+ a26:	5d                   	pop    %ebp
+ a27:	c3                   	ret
+ a28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2f:	90                   	nop
+  write(fd, &c, 1);
+ a30:	83 ec 04             	sub    $0x4,%esp
+ a33:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a36:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ a3a:	6a 01                	push   $0x1
+ a3c:	52                   	push   %edx
+ a3d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ a40:	57                   	push   %edi
+ a41:	e8 02 fd ff ff       	call   748 <write>
+ a46:	83 c4 0c             	add    $0xc,%esp
+ a49:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a4c:	6a 01                	push   $0x1
+ a4e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ a51:	52                   	push   %edx
+ a52:	57                   	push   %edi
+ a53:	e8 f0 fc ff ff       	call   748 <write>
+        putc(fd, c);
+ a58:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a5b:	31 d2                	xor    %edx,%edx
+ a5d:	eb 8e                	jmp    9ed <printf+0x4d>
+ a5f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ a60:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a63:	83 ec 0c             	sub    $0xc,%esp
+ a66:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a6b:	8b 13                	mov    (%ebx),%edx
+ a6d:	6a 00                	push   $0x0
+ a6f:	89 f8                	mov    %edi,%eax
+        ap++;
+ a71:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ a74:	e8 87 fe ff ff       	call   900 <printint>
+        ap++;
+ a79:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a7c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a7f:	31 d2                	xor    %edx,%edx
+ a81:	e9 67 ff ff ff       	jmp    9ed <printf+0x4d>
+ a86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a90:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a93:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a95:	83 c0 04             	add    $0x4,%eax
+ a98:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a9b:	85 db                	test   %ebx,%ebx
+ a9d:	0f 84 9d 00 00 00    	je     b40 <printf+0x1a0>
+        while(*s != 0){
+ aa3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ aa6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ aa8:	84 c0                	test   %al,%al
+ aaa:	0f 84 3d ff ff ff    	je     9ed <printf+0x4d>
+ ab0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ab3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ ab6:	89 de                	mov    %ebx,%esi
+ ab8:	89 d3                	mov    %edx,%ebx
+ aba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ ac0:	83 ec 04             	sub    $0x4,%esp
+ ac3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ ac6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ ac9:	6a 01                	push   $0x1
+ acb:	53                   	push   %ebx
+ acc:	57                   	push   %edi
+ acd:	e8 76 fc ff ff       	call   748 <write>
+        while(*s != 0){
+ ad2:	0f b6 06             	movzbl (%esi),%eax
+ ad5:	83 c4 10             	add    $0x10,%esp
+ ad8:	84 c0                	test   %al,%al
+ ada:	75 e4                	jne    ac0 <printf+0x120>
+      state = 0;
+ adc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ adf:	31 d2                	xor    %edx,%edx
+ ae1:	e9 07 ff ff ff       	jmp    9ed <printf+0x4d>
+ ae6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aed:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ af0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ af3:	83 ec 0c             	sub    $0xc,%esp
+ af6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ afb:	8b 13                	mov    (%ebx),%edx
+ afd:	6a 01                	push   $0x1
+ aff:	e9 6b ff ff ff       	jmp    a6f <printf+0xcf>
+ b04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ b08:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ b0b:	83 ec 04             	sub    $0x4,%esp
+ b0e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ b11:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ b13:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ b16:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ b19:	6a 01                	push   $0x1
+ b1b:	52                   	push   %edx
+ b1c:	57                   	push   %edi
+ b1d:	e8 26 fc ff ff       	call   748 <write>
+        ap++;
+ b22:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b25:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b28:	31 d2                	xor    %edx,%edx
+ b2a:	e9 be fe ff ff       	jmp    9ed <printf+0x4d>
+ b2f:	90                   	nop
+  write(fd, &c, 1);
+ b30:	83 ec 04             	sub    $0x4,%esp
+ b33:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b36:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b39:	6a 01                	push   $0x1
+ b3b:	e9 11 ff ff ff       	jmp    a51 <printf+0xb1>
+ b40:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ b45:	bb 3e 0d 00 00       	mov    $0xd3e,%ebx
+ b4a:	e9 61 ff ff ff       	jmp    ab0 <printf+0x110>
+ b4f:	90                   	nop
+
+00000b50 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b50:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b51:	a1 50 39 00 00       	mov    0x3950,%eax
+{
+ b56:	89 e5                	mov    %esp,%ebp
+ b58:	57                   	push   %edi
+ b59:	56                   	push   %esi
+ b5a:	53                   	push   %ebx
+ b5b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ b5e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b68:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b6a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b6c:	39 ca                	cmp    %ecx,%edx
+ b6e:	73 30                	jae    ba0 <free+0x50>
+ b70:	39 c1                	cmp    %eax,%ecx
+ b72:	72 04                	jb     b78 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b74:	39 c2                	cmp    %eax,%edx
+ b76:	72 f0                	jb     b68 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b78:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ b7b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ b7e:	39 f8                	cmp    %edi,%eax
+ b80:	74 2e                	je     bb0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b82:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ b85:	8b 42 04             	mov    0x4(%edx),%eax
+ b88:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b8b:	39 f1                	cmp    %esi,%ecx
+ b8d:	74 38                	je     bc7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b8f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b91:	5b                   	pop    %ebx
+  freep = p;
+ b92:	89 15 50 39 00 00    	mov    %edx,0x3950
+}
+ b98:	5e                   	pop    %esi
+ b99:	5f                   	pop    %edi
+ b9a:	5d                   	pop    %ebp
+ b9b:	c3                   	ret
+ b9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ba0:	39 c1                	cmp    %eax,%ecx
+ ba2:	72 d0                	jb     b74 <free+0x24>
+ ba4:	eb c2                	jmp    b68 <free+0x18>
+ ba6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ bb0:	03 70 04             	add    0x4(%eax),%esi
+ bb3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ bb6:	8b 02                	mov    (%edx),%eax
+ bb8:	8b 00                	mov    (%eax),%eax
+ bba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ bbd:	8b 42 04             	mov    0x4(%edx),%eax
+ bc0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ bc3:	39 f1                	cmp    %esi,%ecx
+ bc5:	75 c8                	jne    b8f <free+0x3f>
+    p->s.size += bp->s.size;
+ bc7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ bca:	89 15 50 39 00 00    	mov    %edx,0x3950
+    p->s.size += bp->s.size;
+ bd0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ bd3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ bd6:	89 0a                	mov    %ecx,(%edx)
+}
+ bd8:	5b                   	pop    %ebx
+ bd9:	5e                   	pop    %esi
+ bda:	5f                   	pop    %edi
+ bdb:	5d                   	pop    %ebp
+ bdc:	c3                   	ret
+ bdd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000be0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ be0:	55                   	push   %ebp
+ be1:	89 e5                	mov    %esp,%ebp
+ be3:	57                   	push   %edi
+ be4:	56                   	push   %esi
+ be5:	53                   	push   %ebx
+ be6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ be9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ bec:	8b 15 50 39 00 00    	mov    0x3950,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bf2:	8d 78 07             	lea    0x7(%eax),%edi
+ bf5:	c1 ef 03             	shr    $0x3,%edi
+ bf8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ bfb:	85 d2                	test   %edx,%edx
+ bfd:	0f 84 8d 00 00 00    	je     c90 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c03:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c05:	8b 48 04             	mov    0x4(%eax),%ecx
+ c08:	39 f9                	cmp    %edi,%ecx
+ c0a:	73 64                	jae    c70 <malloc+0x90>
+  if(nu < 4096)
+ c0c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ c11:	39 df                	cmp    %ebx,%edi
+ c13:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ c16:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ c1d:	eb 0a                	jmp    c29 <malloc+0x49>
+ c1f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c20:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c22:	8b 48 04             	mov    0x4(%eax),%ecx
+ c25:	39 f9                	cmp    %edi,%ecx
+ c27:	73 47                	jae    c70 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ c29:	89 c2                	mov    %eax,%edx
+ c2b:	39 05 50 39 00 00    	cmp    %eax,0x3950
+ c31:	75 ed                	jne    c20 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ c33:	83 ec 0c             	sub    $0xc,%esp
+ c36:	56                   	push   %esi
+ c37:	e8 9b fb ff ff       	call   7d7 <sbrk>
+  if(p == (char*)-1)
+ c3c:	83 c4 10             	add    $0x10,%esp
+ c3f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c42:	74 1c                	je     c60 <malloc+0x80>
+  hp->s.size = nu;
+ c44:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ c47:	83 ec 0c             	sub    $0xc,%esp
+ c4a:	83 c0 08             	add    $0x8,%eax
+ c4d:	50                   	push   %eax
+ c4e:	e8 fd fe ff ff       	call   b50 <free>
+  return freep;
+ c53:	8b 15 50 39 00 00    	mov    0x3950,%edx
+      if((p = morecore(nunits)) == 0)
+ c59:	83 c4 10             	add    $0x10,%esp
+ c5c:	85 d2                	test   %edx,%edx
+ c5e:	75 c0                	jne    c20 <malloc+0x40>
+        return 0;
+  }
+}
+ c60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ c63:	31 c0                	xor    %eax,%eax
+}
+ c65:	5b                   	pop    %ebx
+ c66:	5e                   	pop    %esi
+ c67:	5f                   	pop    %edi
+ c68:	5d                   	pop    %ebp
+ c69:	c3                   	ret
+ c6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ c70:	39 cf                	cmp    %ecx,%edi
+ c72:	74 4c                	je     cc0 <malloc+0xe0>
+        p->s.size -= nunits;
+ c74:	29 f9                	sub    %edi,%ecx
+ c76:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ c79:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ c7c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ c7f:	89 15 50 39 00 00    	mov    %edx,0x3950
+}
+ c85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ c88:	83 c0 08             	add    $0x8,%eax
+}
+ c8b:	5b                   	pop    %ebx
+ c8c:	5e                   	pop    %esi
+ c8d:	5f                   	pop    %edi
+ c8e:	5d                   	pop    %ebp
+ c8f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ c90:	c7 05 50 39 00 00 54 	movl   $0x3954,0x3950
+ c97:	39 00 00 
+    base.s.size = 0;
+ c9a:	b8 54 39 00 00       	mov    $0x3954,%eax
+    base.s.ptr = freep = prevp = &base;
+ c9f:	c7 05 54 39 00 00 54 	movl   $0x3954,0x3954
+ ca6:	39 00 00 
+    base.s.size = 0;
+ ca9:	c7 05 58 39 00 00 00 	movl   $0x0,0x3958
+ cb0:	00 00 00 
+    if(p->s.size >= nunits){
+ cb3:	e9 54 ff ff ff       	jmp    c0c <malloc+0x2c>
+ cb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cbf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ cc0:	8b 08                	mov    (%eax),%ecx
+ cc2:	89 0a                	mov    %ecx,(%edx)
+ cc4:	eb b9                	jmp    c7f <malloc+0x9f>
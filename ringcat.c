@@ -0,0 +1,101 @@
+// cat, with reads and writes batched on an ioring: each
+// ioring_enter() writes out one batch of blocks and reads the
+// next, so a file costs one trap per NBATCH blocks instead of
+// two per block.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "ioring.h"
+
+#define NBATCH 16
+#define WRITING 0x100          // in iosqe.data
+
+struct ioring ring;
+char buf[NBATCH][512];
+int len[NBATCH];
+
+void
+submit(int op, int fd, char *addr, int n, uint data)
+{
+  struct iosqe *e;
+
+  e = &ring.sq[ring.sqtail % IORING_SIZE];
+  e->op = op;
+  e->fd = fd;
+  e->addr = (uint)addr;
+  e->n = n;
+  e->data = data;
+  ring.sqtail++;
+}
+
+void
+cat(int fd)
+{
+  struct iocqe *c;
+  struct stat st;
+  int i, nr, nw, eof;
+
+  // Reading ahead only pays for files; the console and
+  // pipes should see their data go straight through.
+  nr = NBATCH;
+  if(fstat(fd, &st) < 0 || st.type != T_FILE)
+    nr = 1;
+  nw = 0;
+  eof = 0;
+  while(nw > 0 || !eof){
+    // Write out what the last batch read, and read the next
+    // into the same buffers: the ring does them in order.
+    for(i = 0; i < nw; i++)
+      submit(IORING_WRITE, 1, buf[i], len[i], WRITING | i);
+    if(!eof)
+      for(i = 0; i < nr; i++)
+        submit(IORING_READ, fd, buf[i], sizeof(buf[i]), i);
+    ioring_enter(&ring);
+    if(ring.sqhead != ring.sqtail){
+      printf(1, "ringcat: ring stalled\n");
+      exit();
+    }
+
+    nw = 0;
+    for(; ring.cqhead != ring.cqtail; ring.cqhead++){
+      c = &ring.cq[ring.cqhead % IORING_SIZE];
+      if(c->data & WRITING){
+        if(c->res != len[c->data & ~WRITING]){
+          printf(1, "ringcat: write error\n");
+          exit();
+        }
+        continue;
+      }
+      if(c->res < 0){
+        printf(1, "ringcat: read error\n");
+        exit();
+      }
+      if(c->res == 0)
+        eof = 1;
+      else if(!eof)
+        len[nw++] = c->res;
+    }
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int fd, i;
+
+  if(argc <= 1){
+    cat(0);
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "ringcat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+    close(fd);
+  }
+  exit();
+}
@@ -0,0 +1,1932 @@
+
+_schedbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    ;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  int i, npairs, trips;
+  uint64 t;
+
+  npairs = 4;
+  10:	bb 04 00 00 00       	mov    $0x4,%ebx
+{
+  15:	51                   	push   %ecx
+  16:	83 ec 28             	sub    $0x28,%esp
+  19:	8b 31                	mov    (%ecx),%esi
+  1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  trips = 2000;
+  1e:	c7 45 d4 d0 07 00 00 	movl   $0x7d0,-0x2c(%ebp)
+  if(argc > 1)
+  25:	83 fe 01             	cmp    $0x1,%esi
+  28:	0f 8f a1 01 00 00    	jg     1cf <main+0x1cf>
+
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+  2e:	0f 31                	rdtsc
+    npairs = atoi(argv[1]);
+  if(argc > 2)
+    trips = atoi(argv[2]);
+
+  t = rdtsc();
+  pingpong(trips);
+  30:	83 ec 0c             	sub    $0xc,%esp
+  33:	ff 75 d4             	push   -0x2c(%ebp)
+  36:	89 c6                	mov    %eax,%esi
+  38:	89 d7                	mov    %edx,%edi
+  3a:	e8 f1 01 00 00       	call   230 <pingpong>
+  3f:	0f 31                	rdtsc
+  cyclereport("pingpong", "ops", rdtsc() - t, trips);
+  41:	29 f0                	sub    %esi,%eax
+  43:	59                   	pop    %ecx
+  44:	ff 75 d4             	push   -0x2c(%ebp)
+  47:	19 fa                	sbb    %edi,%edx
+  49:	52                   	push   %edx
+  4a:	50                   	push   %eax
+  4b:	68 a9 0d 00 00       	push   $0xda9
+  50:	68 b6 0d 00 00       	push   $0xdb6
+  55:	e8 c6 05 00 00       	call   620 <cyclereport>
+  5a:	0f 31                	rdtsc
+  5c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  t = rdtsc();
+  for(i = 0; i < npairs; i++){
+  5f:	83 c4 20             	add    $0x20,%esp
+  62:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  65:	85 db                	test   %ebx,%ebx
+  67:	7e 3d                	jle    a6 <main+0xa6>
+  69:	31 f6                	xor    %esi,%esi
+  6b:	eb 0c                	jmp    79 <main+0x79>
+  6d:	8d 76 00             	lea    0x0(%esi),%esi
+  70:	8d 46 01             	lea    0x1(%esi),%eax
+  73:	39 c3                	cmp    %eax,%ebx
+  75:	74 1b                	je     92 <main+0x92>
+  77:	89 c6                	mov    %eax,%esi
+    if(fork() == 0){
+  79:	e8 43 07 00 00       	call   7c1 <fork>
+  7e:	85 c0                	test   %eax,%eax
+  80:	75 ee                	jne    70 <main+0x70>
+      pingpong(trips);
+  82:	83 ec 0c             	sub    $0xc,%esp
+  85:	ff 75 d4             	push   -0x2c(%ebp)
+  88:	e8 a3 01 00 00       	call   230 <pingpong>
+      exit();
+  8d:	e8 3a 07 00 00       	call   7cc <exit>
+    }
+  }
+  for(i = 0; i < npairs; i++)
+  92:	31 ff                	xor    %edi,%edi
+  94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    wait();
+  98:	e8 3a 07 00 00       	call   7d7 <wait>
+  for(i = 0; i < npairs; i++)
+  9d:	89 f8                	mov    %edi,%eax
+  9f:	83 c7 01             	add    $0x1,%edi
+  a2:	39 c6                	cmp    %eax,%esi
+  a4:	75 f2                	jne    98 <main+0x98>
+  a6:	0f 31                	rdtsc
+  cyclereport("parallel pingpong", "ops", rdtsc() - t, npairs * trips);
+  a8:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  ab:	83 ec 0c             	sub    $0xc,%esp
+  ae:	0f af cb             	imul   %ebx,%ecx
+  b1:	51                   	push   %ecx
+  b2:	2b 45 c8             	sub    -0x38(%ebp),%eax
+  b5:	1b 55 cc             	sbb    -0x34(%ebp),%edx
+  b8:	52                   	push   %edx
+  b9:	50                   	push   %eax
+  ba:	68 a9 0d 00 00       	push   $0xda9
+  bf:	68 ad 0d 00 00       	push   $0xdad
+  c4:	e8 57 05 00 00       	call   620 <cyclereport>
+  c9:	0f 31                	rdtsc
+  cb:	89 d7                	mov    %edx,%edi
+  for(i = 0; i < SPIN; i++)
+  cd:	31 d2                	xor    %edx,%edx
+  cf:	89 c6                	mov    %eax,%esi
+  d1:	83 c4 20             	add    $0x20,%esp
+  d4:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  d7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  da:	3d ff 2c 31 01       	cmp    $0x1312cff,%eax
+  df:	7f 1a                	jg     fb <main+0xfb>
+  e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  e8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  eb:	83 c0 01             	add    $0x1,%eax
+  ee:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  f1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  f4:	3d ff 2c 31 01       	cmp    $0x1312cff,%eax
+  f9:	7e ed                	jle    e8 <main+0xe8>
+  fb:	0f 31                	rdtsc
+
+  t = rdtsc();
+  spin();
+  cyclereport("spin, 1 process", "ops", rdtsc() - t, 1);
+  fd:	83 ec 0c             	sub    $0xc,%esp
+ 100:	29 f0                	sub    %esi,%eax
+ 102:	19 fa                	sbb    %edi,%edx
+ 104:	6a 01                	push   $0x1
+ 106:	52                   	push   %edx
+ 107:	50                   	push   %eax
+ 108:	68 a9 0d 00 00       	push   $0xda9
+ 10d:	68 bf 0d 00 00       	push   $0xdbf
+ 112:	e8 09 05 00 00       	call   620 <cyclereport>
+ 117:	0f 31                	rdtsc
+  t = rdtsc();
+  for(i = 0; i < 2*npairs; i++){
+ 119:	01 db                	add    %ebx,%ebx
+ 11b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 11e:	83 c4 20             	add    $0x20,%esp
+ 121:	89 55 cc             	mov    %edx,-0x34(%ebp)
+ 124:	85 db                	test   %ebx,%ebx
+ 126:	7e 54                	jle    17c <main+0x17c>
+ 128:	31 f6                	xor    %esi,%esi
+ 12a:	eb 0b                	jmp    137 <main+0x137>
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 130:	83 c6 01             	add    $0x1,%esi
+ 133:	39 de                	cmp    %ebx,%esi
+ 135:	74 31                	je     168 <main+0x168>
+    if(fork() == 0){
+ 137:	e8 85 06 00 00       	call   7c1 <fork>
+ 13c:	85 c0                	test   %eax,%eax
+ 13e:	75 f0                	jne    130 <main+0x130>
+  for(i = 0; i < SPIN; i++)
+ 140:	31 c0                	xor    %eax,%eax
+ 142:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 145:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 148:	3d ff 2c 31 01       	cmp    $0x1312cff,%eax
+ 14d:	7f 14                	jg     163 <main+0x163>
+ 14f:	90                   	nop
+ 150:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 153:	83 c0 01             	add    $0x1,%eax
+ 156:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 159:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 15c:	3d ff 2c 31 01       	cmp    $0x1312cff,%eax
+ 161:	7e ed                	jle    150 <main+0x150>
+      exit();
+    wait();
+  }
+  cyclereport("fork", "ops", rdtsc() - t, trips);
+
+  exit();
+ 163:	e8 64 06 00 00       	call   7cc <exit>
+  for(i = 0; i < 2*npairs; i++)
+ 168:	31 f6                	xor    %esi,%esi
+ 16a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+ 170:	e8 62 06 00 00       	call   7d7 <wait>
+  for(i = 0; i < 2*npairs; i++)
+ 175:	83 c6 01             	add    $0x1,%esi
+ 178:	39 de                	cmp    %ebx,%esi
+ 17a:	75 f4                	jne    170 <main+0x170>
+ 17c:	0f 31                	rdtsc
+  cyclereport("spin, 2*npairs processes", "ops", rdtsc() - t, 2*npairs);
+ 17e:	83 ec 0c             	sub    $0xc,%esp
+ 181:	53                   	push   %ebx
+ 182:	2b 45 c8             	sub    -0x38(%ebp),%eax
+ 185:	1b 55 cc             	sbb    -0x34(%ebp),%edx
+ 188:	52                   	push   %edx
+ 189:	50                   	push   %eax
+ 18a:	68 a9 0d 00 00       	push   $0xda9
+ 18f:	68 cf 0d 00 00       	push   $0xdcf
+ 194:	e8 87 04 00 00       	call   620 <cyclereport>
+ 199:	0f 31                	rdtsc
+  for(i = 0; i < trips; i++){
+ 19b:	31 db                	xor    %ebx,%ebx
+ 19d:	83 c4 20             	add    $0x20,%esp
+ 1a0:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 1a4:	89 c6                	mov    %eax,%esi
+ 1a6:	89 d7                	mov    %edx,%edi
+ 1a8:	7e 5a                	jle    204 <main+0x204>
+ 1aa:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 1ad:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 1b0:	89 55 cc             	mov    %edx,-0x34(%ebp)
+ 1b3:	eb 0f                	jmp    1c4 <main+0x1c4>
+ 1b5:	8d 76 00             	lea    0x0(%esi),%esi
+    wait();
+ 1b8:	e8 1a 06 00 00       	call   7d7 <wait>
+  for(i = 0; i < trips; i++){
+ 1bd:	83 c3 01             	add    $0x1,%ebx
+ 1c0:	39 df                	cmp    %ebx,%edi
+ 1c2:	74 3a                	je     1fe <main+0x1fe>
+    if(fork() == 0)
+ 1c4:	e8 f8 05 00 00       	call   7c1 <fork>
+ 1c9:	85 c0                	test   %eax,%eax
+ 1cb:	75 eb                	jne    1b8 <main+0x1b8>
+ 1cd:	eb 94                	jmp    163 <main+0x163>
+    npairs = atoi(argv[1]);
+ 1cf:	83 ec 0c             	sub    $0xc,%esp
+ 1d2:	ff 77 04             	push   0x4(%edi)
+ 1d5:	e8 a6 03 00 00       	call   580 <atoi>
+  if(argc > 2)
+ 1da:	83 c4 10             	add    $0x10,%esp
+    npairs = atoi(argv[1]);
+ 1dd:	89 c3                	mov    %eax,%ebx
+  if(argc > 2)
+ 1df:	83 fe 02             	cmp    $0x2,%esi
+ 1e2:	0f 84 46 fe ff ff    	je     2e <main+0x2e>
+    trips = atoi(argv[2]);
+ 1e8:	83 ec 0c             	sub    $0xc,%esp
+ 1eb:	ff 77 08             	push   0x8(%edi)
+ 1ee:	e8 8d 03 00 00       	call   580 <atoi>
+ 1f3:	83 c4 10             	add    $0x10,%esp
+ 1f6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 1f9:	e9 30 fe ff ff       	jmp    2e <main+0x2e>
+ 1fe:	8b 75 c8             	mov    -0x38(%ebp),%esi
+ 201:	8b 7d cc             	mov    -0x34(%ebp),%edi
+ 204:	0f 31                	rdtsc
+  cyclereport("fork", "ops", rdtsc() - t, trips);
+ 206:	83 ec 0c             	sub    $0xc,%esp
+ 209:	29 f0                	sub    %esi,%eax
+ 20b:	ff 75 d4             	push   -0x2c(%ebp)
+ 20e:	19 fa                	sbb    %edi,%edx
+ 210:	52                   	push   %edx
+ 211:	50                   	push   %eax
+ 212:	68 a9 0d 00 00       	push   $0xda9
+ 217:	68 e8 0d 00 00       	push   $0xde8
+ 21c:	e8 ff 03 00 00       	call   620 <cyclereport>
+  exit();
+ 221:	83 c4 20             	add    $0x20,%esp
+ 224:	e9 3a ff ff ff       	jmp    163 <main+0x163>
+ 229:	66 90                	xchg   %ax,%ax
+ 22b:	66 90                	xchg   %ax,%ax
+ 22d:	66 90                	xchg   %ax,%ax
+ 22f:	90                   	nop
+
+00000230 <pingpong>:
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	57                   	push   %edi
+ 234:	56                   	push   %esi
+  if(pipe(a) < 0 || pipe(b) < 0){
+ 235:	8d 45 d8             	lea    -0x28(%ebp),%eax
+{
+ 238:	53                   	push   %ebx
+ 239:	83 ec 38             	sub    $0x38,%esp
+ 23c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(pipe(a) < 0 || pipe(b) < 0){
+ 23f:	50                   	push   %eax
+ 240:	e8 9d 05 00 00       	call   7e2 <pipe>
+ 245:	83 c4 10             	add    $0x10,%esp
+ 248:	85 c0                	test   %eax,%eax
+ 24a:	0f 88 b1 00 00 00    	js     301 <pingpong+0xd1>
+ 250:	83 ec 0c             	sub    $0xc,%esp
+ 253:	8d 45 e0             	lea    -0x20(%ebp),%eax
+ 256:	50                   	push   %eax
+ 257:	e8 86 05 00 00       	call   7e2 <pipe>
+ 25c:	83 c4 10             	add    $0x10,%esp
+ 25f:	85 c0                	test   %eax,%eax
+ 261:	0f 88 9a 00 00 00    	js     301 <pingpong+0xd1>
+  if(fork() == 0){
+ 267:	e8 55 05 00 00       	call   7c1 <fork>
+ 26c:	89 c3                	mov    %eax,%ebx
+ 26e:	85 c0                	test   %eax,%eax
+ 270:	0f 84 9e 00 00 00    	je     314 <pingpong+0xe4>
+  close(a[0]);
+ 276:	83 ec 0c             	sub    $0xc,%esp
+ 279:	ff 75 d8             	push   -0x28(%ebp)
+ 27c:	e8 82 05 00 00       	call   803 <close>
+  close(b[1]);
+ 281:	5a                   	pop    %edx
+ 282:	ff 75 e4             	push   -0x1c(%ebp)
+ 285:	e8 79 05 00 00       	call   803 <close>
+  c = 0;
+ 28a:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+  for(i = 0; i < trips; i++){
+ 28e:	83 c4 10             	add    $0x10,%esp
+ 291:	85 ff                	test   %edi,%edi
+ 293:	7e 48                	jle    2dd <pingpong+0xad>
+ 295:	31 db                	xor    %ebx,%ebx
+ 297:	8d 75 d7             	lea    -0x29(%ebp),%esi
+ 29a:	eb 0b                	jmp    2a7 <pingpong+0x77>
+ 29c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2a0:	83 c3 01             	add    $0x1,%ebx
+ 2a3:	39 df                	cmp    %ebx,%edi
+ 2a5:	74 36                	je     2dd <pingpong+0xad>
+    write(a[1], &c, 1);
+ 2a7:	83 ec 04             	sub    $0x4,%esp
+ 2aa:	6a 01                	push   $0x1
+ 2ac:	56                   	push   %esi
+ 2ad:	ff 75 dc             	push   -0x24(%ebp)
+ 2b0:	e8 43 05 00 00       	call   7f8 <write>
+    if(read(b[0], &c, 1) != 1){
+ 2b5:	83 c4 0c             	add    $0xc,%esp
+ 2b8:	6a 01                	push   $0x1
+ 2ba:	56                   	push   %esi
+ 2bb:	ff 75 e0             	push   -0x20(%ebp)
+ 2be:	e8 2a 05 00 00       	call   7ed <read>
+ 2c3:	83 c4 10             	add    $0x10,%esp
+ 2c6:	83 f8 01             	cmp    $0x1,%eax
+ 2c9:	74 d5                	je     2a0 <pingpong+0x70>
+      printf(1, "schedbench: short read\n");
+ 2cb:	83 ec 08             	sub    $0x8,%esp
+ 2ce:	68 91 0d 00 00       	push   $0xd91
+ 2d3:	6a 01                	push   $0x1
+ 2d5:	e8 76 07 00 00       	call   a50 <printf>
+      break;
+ 2da:	83 c4 10             	add    $0x10,%esp
+  close(a[1]);
+ 2dd:	83 ec 0c             	sub    $0xc,%esp
+ 2e0:	ff 75 dc             	push   -0x24(%ebp)
+ 2e3:	e8 1b 05 00 00       	call   803 <close>
+  close(b[0]);
+ 2e8:	58                   	pop    %eax
+ 2e9:	ff 75 e0             	push   -0x20(%ebp)
+ 2ec:	e8 12 05 00 00       	call   803 <close>
+  wait();
+ 2f1:	e8 e1 04 00 00       	call   7d7 <wait>
+}
+ 2f6:	83 c4 10             	add    $0x10,%esp
+ 2f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2fc:	5b                   	pop    %ebx
+ 2fd:	5e                   	pop    %esi
+ 2fe:	5f                   	pop    %edi
+ 2ff:	5d                   	pop    %ebp
+ 300:	c3                   	ret
+    printf(1, "schedbench: pipe failed\n");
+ 301:	53                   	push   %ebx
+ 302:	53                   	push   %ebx
+ 303:	68 78 0d 00 00       	push   $0xd78
+ 308:	6a 01                	push   $0x1
+ 30a:	e8 41 07 00 00       	call   a50 <printf>
+    exit();
+ 30f:	e8 b8 04 00 00       	call   7cc <exit>
+    close(a[1]);
+ 314:	83 ec 0c             	sub    $0xc,%esp
+ 317:	ff 75 dc             	push   -0x24(%ebp)
+ 31a:	e8 e4 04 00 00       	call   803 <close>
+    close(b[0]);
+ 31f:	59                   	pop    %ecx
+ 320:	ff 75 e0             	push   -0x20(%ebp)
+ 323:	e8 db 04 00 00       	call   803 <close>
+    for(i = 0; i < trips; i++){
+ 328:	83 c4 10             	add    $0x10,%esp
+ 32b:	85 ff                	test   %edi,%edi
+ 32d:	7e 33                	jle    362 <pingpong+0x132>
+ 32f:	8d 75 d7             	lea    -0x29(%ebp),%esi
+ 332:	eb 18                	jmp    34c <pingpong+0x11c>
+      write(b[1], &c, 1);
+ 334:	83 ec 04             	sub    $0x4,%esp
+    for(i = 0; i < trips; i++){
+ 337:	83 c3 01             	add    $0x1,%ebx
+      write(b[1], &c, 1);
+ 33a:	6a 01                	push   $0x1
+ 33c:	56                   	push   %esi
+ 33d:	ff 75 e4             	push   -0x1c(%ebp)
+ 340:	e8 b3 04 00 00       	call   7f8 <write>
+    for(i = 0; i < trips; i++){
+ 345:	83 c4 10             	add    $0x10,%esp
+ 348:	39 df                	cmp    %ebx,%edi
+ 34a:	74 16                	je     362 <pingpong+0x132>
+      if(read(a[0], &c, 1) != 1)
+ 34c:	83 ec 04             	sub    $0x4,%esp
+ 34f:	6a 01                	push   $0x1
+ 351:	56                   	push   %esi
+ 352:	ff 75 d8             	push   -0x28(%ebp)
+ 355:	e8 93 04 00 00       	call   7ed <read>
+ 35a:	83 c4 10             	add    $0x10,%esp
+ 35d:	83 f8 01             	cmp    $0x1,%eax
+ 360:	74 d2                	je     334 <pingpong+0x104>
+    exit();
+ 362:	e8 65 04 00 00       	call   7cc <exit>
+ 367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36e:	66 90                	xchg   %ax,%ax
+
+00000370 <spin>:
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	83 ec 10             	sub    $0x10,%esp
+  for(i = 0; i < SPIN; i++)
+ 376:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 37d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 380:	3d ff 2c 31 01       	cmp    $0x1312cff,%eax
+ 385:	7f 1c                	jg     3a3 <spin+0x33>
+ 387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38e:	66 90                	xchg   %ax,%ax
+ 390:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 393:	83 c0 01             	add    $0x1,%eax
+ 396:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 399:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 39c:	3d ff 2c 31 01       	cmp    $0x1312cff,%eax
+ 3a1:	7e ed                	jle    390 <spin+0x20>
+}
+ 3a3:	c9                   	leave
+ 3a4:	c3                   	ret
+ 3a5:	66 90                	xchg   %ax,%ax
+ 3a7:	66 90                	xchg   %ax,%ax
+ 3a9:	66 90                	xchg   %ax,%ax
+ 3ab:	66 90                	xchg   %ax,%ax
+ 3ad:	66 90                	xchg   %ax,%ax
+ 3af:	90                   	nop
+
+000003b0 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 3b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3b1:	31 c0                	xor    %eax,%eax
+{
+ 3b3:	89 e5                	mov    %esp,%ebp
+ 3b5:	53                   	push   %ebx
+ 3b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3c7:	83 c0 01             	add    $0x1,%eax
+ 3ca:	84 d2                	test   %dl,%dl
+ 3cc:	75 f2                	jne    3c0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 3ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3d1:	89 c8                	mov    %ecx,%eax
+ 3d3:	c9                   	leave
+ 3d4:	c3                   	ret
+ 3d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	53                   	push   %ebx
+ 3e4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3ea:	0f b6 02             	movzbl (%edx),%eax
+ 3ed:	84 c0                	test   %al,%al
+ 3ef:	75 17                	jne    408 <strcmp+0x28>
+ 3f1:	eb 3a                	jmp    42d <strcmp+0x4d>
+ 3f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3f7:	90                   	nop
+ 3f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3fc:	83 c2 01             	add    $0x1,%edx
+ 3ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 402:	84 c0                	test   %al,%al
+ 404:	74 1a                	je     420 <strcmp+0x40>
+    p++, q++;
+ 406:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 408:	0f b6 19             	movzbl (%ecx),%ebx
+ 40b:	38 c3                	cmp    %al,%bl
+ 40d:	74 e9                	je     3f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 40f:	29 d8                	sub    %ebx,%eax
+}
+ 411:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 414:	c9                   	leave
+ 415:	c3                   	ret
+ 416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 420:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 424:	31 c0                	xor    %eax,%eax
+ 426:	29 d8                	sub    %ebx,%eax
+}
+ 428:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 42b:	c9                   	leave
+ 42c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 42d:	0f b6 19             	movzbl (%ecx),%ebx
+ 430:	31 c0                	xor    %eax,%eax
+ 432:	eb db                	jmp    40f <strcmp+0x2f>
+ 434:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 43f:	90                   	nop
+
+00000440 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 446:	80 3a 00             	cmpb   $0x0,(%edx)
+ 449:	74 15                	je     460 <strlen+0x20>
+ 44b:	31 c0                	xor    %eax,%eax
+ 44d:	8d 76 00             	lea    0x0(%esi),%esi
+ 450:	83 c0 01             	add    $0x1,%eax
+ 453:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 457:	89 c1                	mov    %eax,%ecx
+ 459:	75 f5                	jne    450 <strlen+0x10>
+    ;
+  return n;
+}
+ 45b:	89 c8                	mov    %ecx,%eax
+ 45d:	5d                   	pop    %ebp
+ 45e:	c3                   	ret
+ 45f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 460:	31 c9                	xor    %ecx,%ecx
+}
+ 462:	5d                   	pop    %ebp
+ 463:	89 c8                	mov    %ecx,%eax
+ 465:	c3                   	ret
+ 466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000470 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("cld; rep stosb" :
+ 477:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 47a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 47d:	89 d7                	mov    %edx,%edi
+ 47f:	fc                   	cld
+ 480:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 482:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 485:	89 d0                	mov    %edx,%eax
+ 487:	c9                   	leave
+ 488:	c3                   	ret
+ 489:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	8b 45 08             	mov    0x8(%ebp),%eax
+ 496:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 49a:	0f b6 10             	movzbl (%eax),%edx
+ 49d:	84 d2                	test   %dl,%dl
+ 49f:	75 12                	jne    4b3 <strchr+0x23>
+ 4a1:	eb 1d                	jmp    4c0 <strchr+0x30>
+ 4a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4a7:	90                   	nop
+ 4a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 4ac:	83 c0 01             	add    $0x1,%eax
+ 4af:	84 d2                	test   %dl,%dl
+ 4b1:	74 0d                	je     4c0 <strchr+0x30>
+    if(*s == c)
+ 4b3:	38 d1                	cmp    %dl,%cl
+ 4b5:	75 f1                	jne    4a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 4b7:	5d                   	pop    %ebp
+ 4b8:	c3                   	ret
+ 4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 4c0:	31 c0                	xor    %eax,%eax
+}
+ 4c2:	5d                   	pop    %ebp
+ 4c3:	c3                   	ret
+ 4c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4cf:	90                   	nop
+
+000004d0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	57                   	push   %edi
+ 4d4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 4d5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 4d8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 4d9:	31 db                	xor    %ebx,%ebx
+{
+ 4db:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 4de:	eb 27                	jmp    507 <gets+0x37>
+    cc = read(0, &c, 1);
+ 4e0:	83 ec 04             	sub    $0x4,%esp
+ 4e3:	6a 01                	push   $0x1
+ 4e5:	56                   	push   %esi
+ 4e6:	6a 00                	push   $0x0
+ 4e8:	e8 00 03 00 00       	call   7ed <read>
+    if(cc < 1)
+ 4ed:	83 c4 10             	add    $0x10,%esp
+ 4f0:	85 c0                	test   %eax,%eax
+ 4f2:	7e 1d                	jle    511 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 4f4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4fb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 4ff:	3c 0a                	cmp    $0xa,%al
+ 501:	74 10                	je     513 <gets+0x43>
+ 503:	3c 0d                	cmp    $0xd,%al
+ 505:	74 0c                	je     513 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 507:	89 df                	mov    %ebx,%edi
+ 509:	83 c3 01             	add    $0x1,%ebx
+ 50c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 50f:	7c cf                	jl     4e0 <gets+0x10>
+ 511:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 513:	8b 45 08             	mov    0x8(%ebp),%eax
+ 516:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 51a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 51d:	5b                   	pop    %ebx
+ 51e:	5e                   	pop    %esi
+ 51f:	5f                   	pop    %edi
+ 520:	5d                   	pop    %ebp
+ 521:	c3                   	ret
+ 522:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 529:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000530 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	56                   	push   %esi
+ 534:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 535:	83 ec 08             	sub    $0x8,%esp
+ 538:	6a 00                	push   $0x0
+ 53a:	ff 75 08             	push   0x8(%ebp)
+ 53d:	e8 e2 02 00 00       	call   824 <open>
+  if(fd < 0)
+ 542:	83 c4 10             	add    $0x10,%esp
+ 545:	85 c0                	test   %eax,%eax
+ 547:	78 27                	js     570 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 549:	83 ec 08             	sub    $0x8,%esp
+ 54c:	ff 75 0c             	push   0xc(%ebp)
+ 54f:	89 c3                	mov    %eax,%ebx
+ 551:	50                   	push   %eax
+ 552:	e8 ee 02 00 00       	call   845 <fstat>
+  close(fd);
+ 557:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 55a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 55c:	e8 a2 02 00 00       	call   803 <close>
+  return r;
+ 561:	83 c4 10             	add    $0x10,%esp
+}
+ 564:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 567:	89 f0                	mov    %esi,%eax
+ 569:	5b                   	pop    %ebx
+ 56a:	5e                   	pop    %esi
+ 56b:	5d                   	pop    %ebp
+ 56c:	c3                   	ret
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 570:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 575:	eb ed                	jmp    564 <stat+0x34>
+ 577:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57e:	66 90                	xchg   %ax,%ax
+
+00000580 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	53                   	push   %ebx
+ 584:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 587:	0f be 02             	movsbl (%edx),%eax
+ 58a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 58d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 590:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 595:	77 1e                	ja     5b5 <atoi+0x35>
+ 597:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 5a0:	83 c2 01             	add    $0x1,%edx
+ 5a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 5a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 5aa:	0f be 02             	movsbl (%edx),%eax
+ 5ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 5b0:	80 fb 09             	cmp    $0x9,%bl
+ 5b3:	76 eb                	jbe    5a0 <atoi+0x20>
+  return n;
+}
+ 5b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5b8:	89 c8                	mov    %ecx,%eax
+ 5ba:	c9                   	leave
+ 5bb:	c3                   	ret
+ 5bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005c0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	57                   	push   %edi
+ 5c4:	56                   	push   %esi
+ 5c5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 5ce:	85 c0                	test   %eax,%eax
+ 5d0:	7e 13                	jle    5e5 <memmove+0x25>
+ 5d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 5d4:	89 d7                	mov    %edx,%edi
+ 5d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 5e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 5e1:	39 f8                	cmp    %edi,%eax
+ 5e3:	75 fb                	jne    5e0 <memmove+0x20>
+  return vdst;
+}
+ 5e5:	5e                   	pop    %esi
+ 5e6:	89 d0                	mov    %edx,%eax
+ 5e8:	5f                   	pop    %edi
+ 5e9:	5d                   	pop    %ebp
+ 5ea:	c3                   	ret
+ 5eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5ef:	90                   	nop
+
+000005f0 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 5f0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 5f5:	85 c0                	test   %eax,%eax
+ 5f7:	74 07                	je     600 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 5f9:	c3                   	ret
+ 5fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 600:	e9 77 02 00 00       	jmp    87c <sysgetpid>
+ 605:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000610 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 610:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 615:	c3                   	ret
+ 616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000620 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 620:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 621:	31 d2                	xor    %edx,%edx
+ 623:	89 e5                	mov    %esp,%ebp
+ 625:	53                   	push   %ebx
+ 626:	83 ec 04             	sub    $0x4,%esp
+ 629:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 62c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 62f:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 632:	85 c9                	test   %ecx,%ecx
+ 634:	7e 08                	jle    63e <cyclereport+0x1e>
+ 636:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 638:	89 d8                	mov    %ebx,%eax
+ 63a:	f7 f1                	div    %ecx
+ 63c:	89 c2                	mov    %eax,%edx
+ 63e:	83 ec 08             	sub    $0x8,%esp
+ 641:	52                   	push   %edx
+ 642:	ff 75 0c             	push   0xc(%ebp)
+ 645:	51                   	push   %ecx
+ 646:	ff 75 08             	push   0x8(%ebp)
+ 649:	68 ed 0d 00 00       	push   $0xded
+ 64e:	6a 01                	push   $0x1
+ 650:	e8 fb 03 00 00       	call   a50 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 655:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 658:	83 c4 20             	add    $0x20,%esp
+ 65b:	c9                   	leave
+ 65c:	c3                   	ret
+ 65d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000660 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 663:	8b 45 08             	mov    0x8(%ebp),%eax
+ 666:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 66c:	5d                   	pop    %ebp
+ 66d:	c3                   	ret
+ 66e:	66 90                	xchg   %ax,%ax
+
+00000670 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 670:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 671:	31 c0                	xor    %eax,%eax
+ 673:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 678:	89 e5                	mov    %esp,%ebp
+ 67a:	56                   	push   %esi
+ 67b:	53                   	push   %ebx
+ 67c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 67f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 683:	85 c0                	test   %eax,%eax
+ 685:	74 30                	je     6b7 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 687:	83 f8 02             	cmp    $0x2,%eax
+ 68a:	74 0c                	je     698 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 68c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 691:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 694:	85 c0                	test   %eax,%eax
+ 696:	74 1f                	je     6b7 <mutex_lock+0x47>
+ 698:	be 02 00 00 00       	mov    $0x2,%esi
+ 69d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 6a0:	83 ec 08             	sub    $0x8,%esp
+ 6a3:	6a 02                	push   $0x2
+ 6a5:	53                   	push   %ebx
+ 6a6:	e8 8c 02 00 00       	call   937 <futex_wait>
+ 6ab:	89 f0                	mov    %esi,%eax
+ 6ad:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 6b0:	83 c4 10             	add    $0x10,%esp
+ 6b3:	85 c0                	test   %eax,%eax
+ 6b5:	75 e9                	jne    6a0 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 6b7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 6ba:	5b                   	pop    %ebx
+ 6bb:	5e                   	pop    %esi
+ 6bc:	5d                   	pop    %ebp
+ 6bd:	c3                   	ret
+ 6be:	66 90                	xchg   %ax,%ax
+
+000006c0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 e5                	mov    %esp,%ebp
+ 6c3:	83 ec 08             	sub    $0x8,%esp
+ 6c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 6c9:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 6cd:	75 09                	jne    6d8 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 6cf:	c9                   	leave
+ 6d0:	c3                   	ret
+ 6d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 6d8:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 6db:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 6e1:	6a 01                	push   $0x1
+ 6e3:	50                   	push   %eax
+ 6e4:	e8 59 02 00 00       	call   942 <futex_wake>
+ 6e9:	83 c4 10             	add    $0x10,%esp
+}
+ 6ec:	c9                   	leave
+ 6ed:	c3                   	ret
+ 6ee:	66 90                	xchg   %ax,%ax
+
+000006f0 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 6f0:	55                   	push   %ebp
+ 6f1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 6f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6f6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 6fc:	5d                   	pop    %ebp
+ 6fd:	c3                   	ret
+ 6fe:	66 90                	xchg   %ax,%ax
+
+00000700 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 700:	55                   	push   %ebp
+ 701:	89 e5                	mov    %esp,%ebp
+ 703:	57                   	push   %edi
+ 704:	56                   	push   %esi
+ 705:	53                   	push   %ebx
+ 706:	83 ec 0c             	sub    $0xc,%esp
+ 709:	8b 75 08             	mov    0x8(%ebp),%esi
+ 70c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 70f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 711:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 715:	75 21                	jne    738 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 717:	83 ec 08             	sub    $0x8,%esp
+ 71a:	57                   	push   %edi
+ 71b:	56                   	push   %esi
+ 71c:	e8 16 02 00 00       	call   937 <futex_wait>
+  mutex_lock(m);
+ 721:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 724:	83 c4 10             	add    $0x10,%esp
+}
+ 727:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 72a:	5b                   	pop    %ebx
+ 72b:	5e                   	pop    %esi
+ 72c:	5f                   	pop    %edi
+ 72d:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 72e:	e9 3d ff ff ff       	jmp    670 <mutex_lock>
+ 733:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 737:	90                   	nop
+    futex_wake(&m->v, 1);
+ 738:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 73b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 741:	6a 01                	push   $0x1
+ 743:	53                   	push   %ebx
+ 744:	e8 f9 01 00 00       	call   942 <futex_wake>
+ 749:	83 c4 10             	add    $0x10,%esp
+ 74c:	eb c9                	jmp    717 <cond_wait+0x17>
+ 74e:	66 90                	xchg   %ax,%ax
+
+00000750 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 750:	55                   	push   %ebp
+ 751:	89 e5                	mov    %esp,%ebp
+ 753:	83 ec 10             	sub    $0x10,%esp
+ 756:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 759:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 75d:	6a 01                	push   $0x1
+ 75f:	50                   	push   %eax
+ 760:	e8 dd 01 00 00       	call   942 <futex_wake>
+}
+ 765:	83 c4 10             	add    $0x10,%esp
+ 768:	c9                   	leave
+ 769:	c3                   	ret
+ 76a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000770 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	83 ec 10             	sub    $0x10,%esp
+ 776:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 779:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 77d:	68 ff ff ff 7f       	push   $0x7fffffff
+ 782:	50                   	push   %eax
+ 783:	e8 ba 01 00 00       	call   942 <futex_wake>
+}
+ 788:	83 c4 10             	add    $0x10,%esp
+ 78b:	c9                   	leave
+ 78c:	c3                   	ret
+
+0000078d <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 78d:	50                   	push   %eax
+  pushl %ebx
+ 78e:	53                   	push   %ebx
+  movl $1, %eax
+ 78f:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 794:	0f a2                	cpuid
+  popl %ebx
+ 796:	5b                   	pop    %ebx
+  popl %eax
+ 797:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 798:	c7 05 b0 12 00 00 be 	movl   $0x7be,0x12b0
+ 79f:	07 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 7a2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 7a8:	74 14                	je     7be <sysint>
+  movl $sysfast, syscallvec
+ 7aa:	c7 05 b0 12 00 00 b4 	movl   $0x7b4,0x12b0
+ 7b1:	07 00 00 
+
+000007b4 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 7b4:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 7b6:	ba bd 07 00 00       	mov    $0x7bd,%edx
+  sysenter
+ 7bb:	0f 34                	sysenter
+1:
+  ret
+ 7bd:	c3                   	ret
+
+000007be <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 7be:	cd 40                	int    $0x40
+  ret
+ 7c0:	c3                   	ret
+
+000007c1 <fork>:
+
+SYSCALL(fork)
+ 7c1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7c6:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+000007cc <exit>:
+SYSCALL(exit)
+ 7cc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7d1:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+000007d7 <wait>:
+SYSCALL(wait)
+ 7d7:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7dc:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+000007e2 <pipe>:
+SYSCALL(pipe)
+ 7e2:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7e7:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+000007ed <read>:
+SYSCALL(read)
+ 7ed:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7f2:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+000007f8 <write>:
+SYSCALL(write)
+ 7f8:	b8 10 00 00 00       	mov    $0x10,%eax
+ 7fd:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+00000803 <close>:
+SYSCALL(close)
+ 803:	b8 15 00 00 00       	mov    $0x15,%eax
+ 808:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+0000080e <kill>:
+SYSCALL(kill)
+ 80e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 813:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+00000819 <exec>:
+SYSCALL(exec)
+ 819:	b8 07 00 00 00       	mov    $0x7,%eax
+ 81e:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+00000824 <open>:
+SYSCALL(open)
+ 824:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 829:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+0000082f <mknod>:
+SYSCALL(mknod)
+ 82f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 834:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+0000083a <unlink>:
+SYSCALL(unlink)
+ 83a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 83f:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+00000845 <fstat>:
+SYSCALL(fstat)
+ 845:	b8 08 00 00 00       	mov    $0x8,%eax
+ 84a:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+00000850 <link>:
+SYSCALL(link)
+ 850:	b8 13 00 00 00       	mov    $0x13,%eax
+ 855:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+0000085b <mkdir>:
+SYSCALL(mkdir)
+ 85b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 860:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+00000866 <chdir>:
+SYSCALL(chdir)
+ 866:	b8 09 00 00 00       	mov    $0x9,%eax
+ 86b:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+00000871 <dup>:
+SYSCALL(dup)
+ 871:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 876:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+0000087c <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 87c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 881:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+00000887 <sbrk>:
+SYSCALL(sbrk)
+ 887:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 88c:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+00000892 <sleep>:
+SYSCALL(sleep)
+ 892:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 897:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+0000089d <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 89d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 8a2:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+000008a8 <swapread>:
+SYSCALL(swapread)
+ 8a8:	b8 16 00 00 00       	mov    $0x16,%eax
+ 8ad:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+000008b3 <swapwrite>:
+SYSCALL(swapwrite)
+ 8b3:	b8 17 00 00 00       	mov    $0x17,%eax
+ 8b8:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+000008be <swapstat>:
+SYSCALL(swapstat)
+ 8be:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8c3:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+000008c9 <madvise>:
+SYSCALL(madvise)
+ 8c9:	b8 19 00 00 00       	mov    $0x19,%eax
+ 8ce:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+000008d4 <mlock>:
+SYSCALL(mlock)
+ 8d4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 8d9:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+000008df <munlock>:
+SYSCALL(munlock)
+ 8df:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 8e4:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+000008ea <membench>:
+SYSCALL(membench)
+ 8ea:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 8ef:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+000008f5 <nice>:
+SYSCALL(nice)
+ 8f5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 8fa:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+00000900 <setpriority>:
+SYSCALL(setpriority)
+ 900:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 905:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+0000090b <usleep>:
+SYSCALL(usleep)
+ 90b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 910:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+00000916 <cpustat>:
+SYSCALL(cpustat)
+ 916:	b8 20 00 00 00       	mov    $0x20,%eax
+ 91b:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+00000921 <clone>:
+SYSCALL(clone)
+ 921:	b8 21 00 00 00       	mov    $0x21,%eax
+ 926:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+0000092c <join>:
+SYSCALL(join)
+ 92c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 931:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+00000937 <futex_wait>:
+SYSCALL(futex_wait)
+ 937:	b8 23 00 00 00       	mov    $0x23,%eax
+ 93c:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+00000942 <futex_wake>:
+SYSCALL(futex_wake)
+ 942:	b8 24 00 00 00       	mov    $0x24,%eax
+ 947:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+0000094d <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 94d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 952:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+00000958 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 958:	b8 26 00 00 00       	mov    $0x26,%eax
+ 95d:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+00000963 <getcpu>:
+SYSCALL(getcpu)
+ 963:	b8 27 00 00 00       	mov    $0x27,%eax
+ 968:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+0000096e <migrations>:
+SYSCALL(migrations)
+ 96e:	b8 28 00 00 00       	mov    $0x28,%eax
+ 973:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+00000979 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 979:	b8 29 00 00 00       	mov    $0x29,%eax
+ 97e:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+00000984 <lockstat>:
+SYSCALL(lockstat)
+ 984:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 989:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+0000098f <lockprof>:
+SYSCALL(lockprof)
+ 98f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 994:	ff 25 b0 12 00 00    	jmp    *0x12b0
+
+0000099a <bcachestat>:
+SYSCALL(bcachestat)
+ 99a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 99f:	ff 25 b0 12 00 00    	jmp    *0x12b0
+ 9a5:	66 90                	xchg   %ax,%ax
+ 9a7:	66 90                	xchg   %ax,%ax
+ 9a9:	66 90                	xchg   %ax,%ax
+ 9ab:	66 90                	xchg   %ax,%ax
+ 9ad:	66 90                	xchg   %ax,%ax
+ 9af:	90                   	nop
+
+000009b0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 9b0:	55                   	push   %ebp
+ 9b1:	89 e5                	mov    %esp,%ebp
+ 9b3:	57                   	push   %edi
+ 9b4:	56                   	push   %esi
+ 9b5:	53                   	push   %ebx
+ 9b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 9b8:	89 d1                	mov    %edx,%ecx
+{
+ 9ba:	83 ec 3c             	sub    $0x3c,%esp
+ 9bd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 9c0:	85 d2                	test   %edx,%edx
+ 9c2:	0f 89 80 00 00 00    	jns    a48 <printint+0x98>
+ 9c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 9cc:	74 7a                	je     a48 <printint+0x98>
+    x = -xx;
+ 9ce:	f7 d9                	neg    %ecx
+    neg = 1;
+ 9d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 9d5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 9d8:	31 f6                	xor    %esi,%esi
+ 9da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 9e0:	89 c8                	mov    %ecx,%eax
+ 9e2:	31 d2                	xor    %edx,%edx
+ 9e4:	89 f7                	mov    %esi,%edi
+ 9e6:	f7 f3                	div    %ebx
+ 9e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 9eb:	0f b6 92 68 0e 00 00 	movzbl 0xe68(%edx),%edx
+ 9f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 9f6:	89 ca                	mov    %ecx,%edx
+ 9f8:	89 c1                	mov    %eax,%ecx
+ 9fa:	39 da                	cmp    %ebx,%edx
+ 9fc:	73 e2                	jae    9e0 <printint+0x30>
+  if(neg)
+ 9fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ a01:	85 c0                	test   %eax,%eax
+ a03:	74 07                	je     a0c <printint+0x5c>
+    buf[i++] = '-';
+ a05:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ a0a:	89 f7                	mov    %esi,%edi
+ a0c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ a0f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ a12:	01 df                	add    %ebx,%edi
+ a14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ a18:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ a1b:	83 ec 04             	sub    $0x4,%esp
+ a1e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ a21:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ a24:	6a 01                	push   $0x1
+ a26:	50                   	push   %eax
+ a27:	56                   	push   %esi
+ a28:	e8 cb fd ff ff       	call   7f8 <write>
+  while(--i >= 0)
+ a2d:	89 f8                	mov    %edi,%eax
+ a2f:	83 c4 10             	add    $0x10,%esp
+ a32:	83 ef 01             	sub    $0x1,%edi
+ a35:	39 d8                	cmp    %ebx,%eax
+ a37:	75 df                	jne    a18 <printint+0x68>
+}
+ a39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a3c:	5b                   	pop    %ebx
+ a3d:	5e                   	pop    %esi
+ a3e:	5f                   	pop    %edi
+ a3f:	5d                   	pop    %ebp
+ a40:	c3                   	ret
+ a41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ a48:	31 c0                	xor    %eax,%eax
+ a4a:	eb 89                	jmp    9d5 <printint+0x25>
+ a4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a50 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ a50:	55                   	push   %ebp
+ a51:	89 e5                	mov    %esp,%ebp
+ a53:	57                   	push   %edi
+ a54:	56                   	push   %esi
+ a55:	53                   	push   %ebx
+ a56:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ a59:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ a5c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ a5f:	0f b6 1e             	movzbl (%esi),%ebx
+ a62:	83 c6 01             	add    $0x1,%esi
+ a65:	84 db                	test   %bl,%bl
+ a67:	74 67                	je     ad0 <printf+0x80>
+ a69:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ a6c:	31 d2                	xor    %edx,%edx
+ a6e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ a71:	eb 34                	jmp    aa7 <printf+0x57>
+ a73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a77:	90                   	nop
+ a78:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ a7b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ a80:	83 f8 25             	cmp    $0x25,%eax
+ a83:	74 18                	je     a9d <printf+0x4d>
+  write(fd, &c, 1);
+ a85:	83 ec 04             	sub    $0x4,%esp
+ a88:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ a8b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a8e:	6a 01                	push   $0x1
+ a90:	50                   	push   %eax
+ a91:	57                   	push   %edi
+ a92:	e8 61 fd ff ff       	call   7f8 <write>
+ a97:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ a9a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ a9d:	0f b6 1e             	movzbl (%esi),%ebx
+ aa0:	83 c6 01             	add    $0x1,%esi
+ aa3:	84 db                	test   %bl,%bl
+ aa5:	74 29                	je     ad0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ aa7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ aaa:	85 d2                	test   %edx,%edx
+ aac:	74 ca                	je     a78 <printf+0x28>
+      }
+    } else if(state == '%'){
+ aae:	83 fa 25             	cmp    $0x25,%edx
+ ab1:	75 ea                	jne    a9d <printf+0x4d>
+      if(c == 'd'){
+ ab3:	83 f8 25             	cmp    $0x25,%eax
+ ab6:	0f 84 24 01 00 00    	je     be0 <printf+0x190>
+ abc:	83 e8 63             	sub    $0x63,%eax
+ abf:	83 f8 15             	cmp    $0x15,%eax
+ ac2:	77 1c                	ja     ae0 <printf+0x90>
+ ac4:	ff 24 85 10 0e 00 00 	jmp    *0xe10(,%eax,4)
+ acb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ acf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ ad0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ad3:	5b                   	pop    %ebx
+ ad4:	5e                   	pop    %esi
+ ad5:	5f                   	pop    %edi
+ ad6:	5d                   	pop    %ebp
+ ad7:	c3                   	ret
+ ad8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ adf:	90                   	nop
+  write(fd, &c, 1);
+ ae0:	83 ec 04             	sub    $0x4,%esp
+ ae3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ae6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ aea:	6a 01                	push   $0x1
+ aec:	52                   	push   %edx
+ aed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ af0:	57                   	push   %edi
+ af1:	e8 02 fd ff ff       	call   7f8 <write>
+ af6:	83 c4 0c             	add    $0xc,%esp
+ af9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ afc:	6a 01                	push   $0x1
+ afe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ b01:	52                   	push   %edx
+ b02:	57                   	push   %edi
+ b03:	e8 f0 fc ff ff       	call   7f8 <write>
+        putc(fd, c);
+ b08:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b0b:	31 d2                	xor    %edx,%edx
+ b0d:	eb 8e                	jmp    a9d <printf+0x4d>
+ b0f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ b10:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b13:	83 ec 0c             	sub    $0xc,%esp
+ b16:	b9 10 00 00 00       	mov    $0x10,%ecx
+ b1b:	8b 13                	mov    (%ebx),%edx
+ b1d:	6a 00                	push   $0x0
+ b1f:	89 f8                	mov    %edi,%eax
+        ap++;
+ b21:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ b24:	e8 87 fe ff ff       	call   9b0 <printint>
+        ap++;
+ b29:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b2c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b2f:	31 d2                	xor    %edx,%edx
+ b31:	e9 67 ff ff ff       	jmp    a9d <printf+0x4d>
+ b36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b3d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ b40:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ b43:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ b45:	83 c0 04             	add    $0x4,%eax
+ b48:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ b4b:	85 db                	test   %ebx,%ebx
+ b4d:	0f 84 9d 00 00 00    	je     bf0 <printf+0x1a0>
+        while(*s != 0){
+ b53:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ b56:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ b58:	84 c0                	test   %al,%al
+ b5a:	0f 84 3d ff ff ff    	je     a9d <printf+0x4d>
+ b60:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b63:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ b66:	89 de                	mov    %ebx,%esi
+ b68:	89 d3                	mov    %edx,%ebx
+ b6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ b70:	83 ec 04             	sub    $0x4,%esp
+ b73:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ b76:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ b79:	6a 01                	push   $0x1
+ b7b:	53                   	push   %ebx
+ b7c:	57                   	push   %edi
+ b7d:	e8 76 fc ff ff       	call   7f8 <write>
+        while(*s != 0){
+ b82:	0f b6 06             	movzbl (%esi),%eax
+ b85:	83 c4 10             	add    $0x10,%esp
+ b88:	84 c0                	test   %al,%al
+ b8a:	75 e4                	jne    b70 <printf+0x120>
+      state = 0;
+ b8c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ b8f:	31 d2                	xor    %edx,%edx
+ b91:	e9 07 ff ff ff       	jmp    a9d <printf+0x4d>
+ b96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b9d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ ba0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ ba3:	83 ec 0c             	sub    $0xc,%esp
+ ba6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ bab:	8b 13                	mov    (%ebx),%edx
+ bad:	6a 01                	push   $0x1
+ baf:	e9 6b ff ff ff       	jmp    b1f <printf+0xcf>
+ bb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ bb8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ bbb:	83 ec 04             	sub    $0x4,%esp
+ bbe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ bc1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ bc3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ bc6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ bc9:	6a 01                	push   $0x1
+ bcb:	52                   	push   %edx
+ bcc:	57                   	push   %edi
+ bcd:	e8 26 fc ff ff       	call   7f8 <write>
+        ap++;
+ bd2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ bd5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ bd8:	31 d2                	xor    %edx,%edx
+ bda:	e9 be fe ff ff       	jmp    a9d <printf+0x4d>
+ bdf:	90                   	nop
+  write(fd, &c, 1);
+ be0:	83 ec 04             	sub    $0x4,%esp
+ be3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ be6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ be9:	6a 01                	push   $0x1
+ beb:	e9 11 ff ff ff       	jmp    b01 <printf+0xb1>
+ bf0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ bf5:	bb 08 0e 00 00       	mov    $0xe08,%ebx
+ bfa:	e9 61 ff ff ff       	jmp    b60 <printf+0x110>
+ bff:	90                   	nop
+
+00000c00 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ c00:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c01:	a1 b4 12 00 00       	mov    0x12b4,%eax
+{
+ c06:	89 e5                	mov    %esp,%ebp
+ c08:	57                   	push   %edi
+ c09:	56                   	push   %esi
+ c0a:	53                   	push   %ebx
+ c0b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ c0e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c18:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c1a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c1c:	39 ca                	cmp    %ecx,%edx
+ c1e:	73 30                	jae    c50 <free+0x50>
+ c20:	39 c1                	cmp    %eax,%ecx
+ c22:	72 04                	jb     c28 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c24:	39 c2                	cmp    %eax,%edx
+ c26:	72 f0                	jb     c18 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ c28:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ c2b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ c2e:	39 f8                	cmp    %edi,%eax
+ c30:	74 2e                	je     c60 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c32:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ c35:	8b 42 04             	mov    0x4(%edx),%eax
+ c38:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c3b:	39 f1                	cmp    %esi,%ecx
+ c3d:	74 38                	je     c77 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ c3f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ c41:	5b                   	pop    %ebx
+  freep = p;
+ c42:	89 15 b4 12 00 00    	mov    %edx,0x12b4
+}
+ c48:	5e                   	pop    %esi
+ c49:	5f                   	pop    %edi
+ c4a:	5d                   	pop    %ebp
+ c4b:	c3                   	ret
+ c4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c50:	39 c1                	cmp    %eax,%ecx
+ c52:	72 d0                	jb     c24 <free+0x24>
+ c54:	eb c2                	jmp    c18 <free+0x18>
+ c56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c5d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ c60:	03 70 04             	add    0x4(%eax),%esi
+ c63:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c66:	8b 02                	mov    (%edx),%eax
+ c68:	8b 00                	mov    (%eax),%eax
+ c6a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ c6d:	8b 42 04             	mov    0x4(%edx),%eax
+ c70:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c73:	39 f1                	cmp    %esi,%ecx
+ c75:	75 c8                	jne    c3f <free+0x3f>
+    p->s.size += bp->s.size;
+ c77:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ c7a:	89 15 b4 12 00 00    	mov    %edx,0x12b4
+    p->s.size += bp->s.size;
+ c80:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ c83:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ c86:	89 0a                	mov    %ecx,(%edx)
+}
+ c88:	5b                   	pop    %ebx
+ c89:	5e                   	pop    %esi
+ c8a:	5f                   	pop    %edi
+ c8b:	5d                   	pop    %ebp
+ c8c:	c3                   	ret
+ c8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c90 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ c90:	55                   	push   %ebp
+ c91:	89 e5                	mov    %esp,%ebp
+ c93:	57                   	push   %edi
+ c94:	56                   	push   %esi
+ c95:	53                   	push   %ebx
+ c96:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c99:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ c9c:	8b 15 b4 12 00 00    	mov    0x12b4,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ca2:	8d 78 07             	lea    0x7(%eax),%edi
+ ca5:	c1 ef 03             	shr    $0x3,%edi
+ ca8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ cab:	85 d2                	test   %edx,%edx
+ cad:	0f 84 8d 00 00 00    	je     d40 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cb3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ cb5:	8b 48 04             	mov    0x4(%eax),%ecx
+ cb8:	39 f9                	cmp    %edi,%ecx
+ cba:	73 64                	jae    d20 <malloc+0x90>
+  if(nu < 4096)
+ cbc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ cc1:	39 df                	cmp    %ebx,%edi
+ cc3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ cc6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ ccd:	eb 0a                	jmp    cd9 <malloc+0x49>
+ ccf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cd0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ cd2:	8b 48 04             	mov    0x4(%eax),%ecx
+ cd5:	39 f9                	cmp    %edi,%ecx
+ cd7:	73 47                	jae    d20 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ cd9:	89 c2                	mov    %eax,%edx
+ cdb:	39 05 b4 12 00 00    	cmp    %eax,0x12b4
+ ce1:	75 ed                	jne    cd0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ce3:	83 ec 0c             	sub    $0xc,%esp
+ ce6:	56                   	push   %esi
+ ce7:	e8 9b fb ff ff       	call   887 <sbrk>
+  if(p == (char*)-1)
+ cec:	83 c4 10             	add    $0x10,%esp
+ cef:	83 f8 ff             	cmp    $0xffffffff,%eax
+ cf2:	74 1c                	je     d10 <malloc+0x80>
+  hp->s.size = nu;
+ cf4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ cf7:	83 ec 0c             	sub    $0xc,%esp
+ cfa:	83 c0 08             	add    $0x8,%eax
+ cfd:	50                   	push   %eax
+ cfe:	e8 fd fe ff ff       	call   c00 <free>
+  return freep;
+ d03:	8b 15 b4 12 00 00    	mov    0x12b4,%edx
+      if((p = morecore(nunits)) == 0)
+ d09:	83 c4 10             	add    $0x10,%esp
+ d0c:	85 d2                	test   %edx,%edx
+ d0e:	75 c0                	jne    cd0 <malloc+0x40>
+        return 0;
+  }
+}
+ d10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ d13:	31 c0                	xor    %eax,%eax
+}
+ d15:	5b                   	pop    %ebx
+ d16:	5e                   	pop    %esi
+ d17:	5f                   	pop    %edi
+ d18:	5d                   	pop    %ebp
+ d19:	c3                   	ret
+ d1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ d20:	39 cf                	cmp    %ecx,%edi
+ d22:	74 4c                	je     d70 <malloc+0xe0>
+        p->s.size -= nunits;
+ d24:	29 f9                	sub    %edi,%ecx
+ d26:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ d29:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ d2c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ d2f:	89 15 b4 12 00 00    	mov    %edx,0x12b4
+}
+ d35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ d38:	83 c0 08             	add    $0x8,%eax
+}
+ d3b:	5b                   	pop    %ebx
+ d3c:	5e                   	pop    %esi
+ d3d:	5f                   	pop    %edi
+ d3e:	5d                   	pop    %ebp
+ d3f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ d40:	c7 05 b4 12 00 00 b8 	movl   $0x12b8,0x12b4
+ d47:	12 00 00 
+    base.s.size = 0;
+ d4a:	b8 b8 12 00 00       	mov    $0x12b8,%eax
+    base.s.ptr = freep = prevp = &base;
+ d4f:	c7 05 b8 12 00 00 b8 	movl   $0x12b8,0x12b8
+ d56:	12 00 00 
+    base.s.size = 0;
+ d59:	c7 05 bc 12 00 00 00 	movl   $0x0,0x12bc
+ d60:	00 00 00 
+    if(p->s.size >= nunits){
+ d63:	e9 54 ff ff ff       	jmp    cbc <malloc+0x2c>
+ d68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d6f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ d70:	8b 08                	mov    (%eax),%ecx
+ d72:	89 0a                	mov    %ecx,(%edx)
+ d74:	eb b9                	jmp    d2f <malloc+0x9f>
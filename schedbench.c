@@ -0,0 +1,114 @@
+// Scheduler latency and throughput.  Run it under
+// "make qemu CPUS=n" for n = 1, 2, 4 and 8 and compare.
+//   pingpong: a byte bounced between two processes over a pair
+//             of pipes; each round trip is two wakeups and two
+//             context switches, so this is wakeup latency.
+//   parallel: npairs ping-pong pairs at once.
+//   spin:     2*npairs CPU-bound children; shows how well the
+//             run queues spread work over the CPUs.
+//   fork:     fork, exit and wait of an empty child.
+// usage: schedbench [npairs [trips]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "x86.h"
+
+#define SPIN 20000000
+
+void
+pingpong(int trips)
+{
+  int a[2], b[2], i;
+  char c;
+
+  if(pipe(a) < 0 || pipe(b) < 0){
+    printf(1, "schedbench: pipe failed\n");
+    exit();
+  }
+  if(fork() == 0){
+    close(a[1]);
+    close(b[0]);
+    for(i = 0; i < trips; i++){
+      if(read(a[0], &c, 1) != 1)
+        break;
+      write(b[1], &c, 1);
+    }
+    exit();
+  }
+  close(a[0]);
+  close(b[1]);
+  c = 0;
+  for(i = 0; i < trips; i++){
+    write(a[1], &c, 1);
+    if(read(b[0], &c, 1) != 1){
+      printf(1, "schedbench: short read\n");
+      break;
+    }
+  }
+  close(a[1]);
+  close(b[0]);
+  wait();
+}
+
+void
+spin(void)
+{
+  volatile int i;
+
+  for(i = 0; i < SPIN; i++)
+    ;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, npairs, trips;
+  uint64 t;
+
+  npairs = 4;
+  trips = 2000;
+  if(argc > 1)
+    npairs = atoi(argv[1]);
+  if(argc > 2)
+    trips = atoi(argv[2]);
+
+  t = rdtsc();
+  pingpong(trips);
+  cyclereport("pingpong", "ops", rdtsc() - t, trips);
+
+  t = rdtsc();
+  for(i = 0; i < npairs; i++){
+    if(fork() == 0){
+      pingpong(trips);
+      exit();
+    }
+  }
+  for(i = 0; i < npairs; i++)
+    wait();
+  cyclereport("parallel pingpong", "ops", rdtsc() - t, npairs * trips);
+
+  t = rdtsc();
+  spin();
+  cyclereport("spin, 1 process", "ops", rdtsc() - t, 1);
+  t = rdtsc();
+  for(i = 0; i < 2*npairs; i++){
+    if(fork() == 0){
+      spin();
+      exit();
+    }
+  }
+  for(i = 0; i < 2*npairs; i++)
+    wait();
+  cyclereport("spin, 2*npairs processes", "ops", rdtsc() - t, 2*npairs);
+
+  t = rdtsc();
+  for(i = 0; i < trips; i++){
+    if(fork() == 0)
+      exit();
+    wait();
+  }
+  cyclereport("fork", "ops", rdtsc() - t, trips);
+
+  exit();
+}
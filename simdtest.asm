@@ -0,0 +1,2118 @@
+
+_simdtest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return c ? 0 : -1;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 28             	sub    $0x28,%esp
+  14:	8b 41 04             	mov    0x4(%ecx),%eax
+  17:	8b 39                	mov    (%ecx),%edi
+static inline void
+getcpuid(uint info, uint *eaxp, uint *ebxp, uint *ecxp, uint *edxp)
+{
+  uint eax, ebx, ecx, edx;
+
+  asm volatile("cpuid" :
+  19:	31 c9                	xor    %ecx,%ecx
+  1b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  1e:	b8 01 00 00 00       	mov    $0x1,%eax
+  23:	0f a2                	cpuid
+  int nproc, passes, fds[2], i, bad;
+  uint edx;
+  char c;
+
+  getcpuid(1, 0, 0, 0, &edx);
+  if((edx & CPUID_SSE2) == 0){
+  25:	81 e2 00 00 00 04    	and    $0x4000000,%edx
+  2b:	0f 84 d1 00 00 00    	je     102 <main+0x102>
+    printf(1, "simdtest: no SSE2\n");
+    exit();
+  }
+  nproc = 4;
+  passes = 200;
+  31:	c7 45 d0 c8 00 00 00 	movl   $0xc8,-0x30(%ebp)
+  nproc = 4;
+  38:	be 04 00 00 00       	mov    $0x4,%esi
+  if(argc > 1)
+  3d:	83 ff 01             	cmp    $0x1,%edi
+  40:	0f 8f 8d 00 00 00    	jg     d3 <main+0xd3>
+    nproc = 4;
+  if(passes < 1)
+    passes = 1;
+
+  bad = 0;
+  if(forkcheck() < 0){
+  46:	e8 d5 03 00 00       	call   420 <forkcheck>
+  bad = 0;
+  4b:	31 ff                	xor    %edi,%edi
+  if(forkcheck() < 0){
+  4d:	85 c0                	test   %eax,%eax
+  4f:	0f 88 3a 01 00 00    	js     18f <main+0x18f>
+    printf(1, "simdtest: fork lost the parent's registers\n");
+    bad = 1;
+  }
+
+  if(pipe(fds) < 0){
+  55:	83 ec 0c             	sub    $0xc,%esp
+  58:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    printf(1, "simdtest: pipe failed\n");
+    exit();
+  }
+  for(i = 0; i < nproc; i++){
+  5b:	31 db                	xor    %ebx,%ebx
+  if(pipe(fds) < 0){
+  5d:	50                   	push   %eax
+  5e:	e8 cf 08 00 00       	call   932 <pipe>
+  63:	83 c4 10             	add    $0x10,%esp
+  66:	85 c0                	test   %eax,%eax
+  68:	79 23                	jns    8d <main+0x8d>
+    printf(1, "simdtest: pipe failed\n");
+  6a:	53                   	push   %ebx
+  6b:	53                   	push   %ebx
+  6c:	68 37 0f 00 00       	push   $0xf37
+  71:	6a 01                	push   $0x1
+  73:	e8 28 0b 00 00       	call   ba0 <printf>
+    exit();
+  78:	e8 9f 08 00 00       	call   91c <exit>
+  7d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; i < nproc; i++){
+  80:	8d 43 01             	lea    0x1(%ebx),%eax
+  83:	39 c6                	cmp    %eax,%esi
+  85:	0f 84 8a 00 00 00    	je     115 <main+0x115>
+  8b:	89 c3                	mov    %eax,%ebx
+    if(fork() == 0){
+  8d:	e8 7f 08 00 00       	call   911 <fork>
+  92:	85 c0                	test   %eax,%eax
+  94:	75 ea                	jne    80 <main+0x80>
+      close(fds[0]);
+  96:	83 ec 0c             	sub    $0xc,%esp
+  99:	ff 75 e0             	push   -0x20(%ebp)
+  9c:	e8 b2 08 00 00       	call   953 <close>
+      c = check(i, passes) == 0;
+  a1:	5a                   	pop    %edx
+  if(passes < 1)
+  a2:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  a5:	b8 01 00 00 00       	mov    $0x1,%eax
+      c = check(i, passes) == 0;
+  aa:	59                   	pop    %ecx
+  if(passes < 1)
+  ab:	85 d2                	test   %edx,%edx
+  ad:	0f 4f c2             	cmovg  %edx,%eax
+      c = check(i, passes) == 0;
+  b0:	50                   	push   %eax
+  b1:	53                   	push   %ebx
+  b2:	e8 09 02 00 00       	call   2c0 <check>
+  b7:	83 c4 0c             	add    $0xc,%esp
+  ba:	85 c0                	test   %eax,%eax
+      write(fds[1], &c, 1);
+  bc:	8d 45 df             	lea    -0x21(%ebp),%eax
+      c = check(i, passes) == 0;
+  bf:	0f 94 45 df          	sete   -0x21(%ebp)
+      write(fds[1], &c, 1);
+  c3:	6a 01                	push   $0x1
+  c5:	50                   	push   %eax
+  c6:	ff 75 e4             	push   -0x1c(%ebp)
+  c9:	e8 7a 08 00 00       	call   948 <write>
+      exit();
+  ce:	e8 49 08 00 00       	call   91c <exit>
+    nproc = atoi(argv[1]);
+  d3:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  d6:	83 ec 0c             	sub    $0xc,%esp
+  d9:	ff 73 04             	push   0x4(%ebx)
+  dc:	e8 ef 05 00 00       	call   6d0 <atoi>
+  if(argc > 2)
+  e1:	83 c4 10             	add    $0x10,%esp
+    nproc = atoi(argv[1]);
+  e4:	89 c6                	mov    %eax,%esi
+  if(argc > 2)
+  e6:	83 ff 02             	cmp    $0x2,%edi
+  e9:	0f 85 bb 00 00 00    	jne    1aa <main+0x1aa>
+  if(nproc < 1 || nproc > NPROCS)
+  ef:	8d 46 ff             	lea    -0x1(%esi),%eax
+    nproc = 4;
+  f2:	83 f8 10             	cmp    $0x10,%eax
+  f5:	b8 04 00 00 00       	mov    $0x4,%eax
+  fa:	0f 43 f0             	cmovae %eax,%esi
+  fd:	e9 44 ff ff ff       	jmp    46 <main+0x46>
+    printf(1, "simdtest: no SSE2\n");
+ 102:	50                   	push   %eax
+ 103:	50                   	push   %eax
+ 104:	68 24 0f 00 00       	push   $0xf24
+ 109:	6a 01                	push   $0x1
+ 10b:	e8 90 0a 00 00       	call   ba0 <printf>
+    exit();
+ 110:	e8 07 08 00 00       	call   91c <exit>
+    }
+  }
+  close(fds[1]);
+ 115:	83 ec 0c             	sub    $0xc,%esp
+ 118:	ff 75 e4             	push   -0x1c(%ebp)
+  for(i = 0; i < nproc; i++){
+ 11b:	31 f6                	xor    %esi,%esi
+  close(fds[1]);
+ 11d:	e8 31 08 00 00       	call   953 <close>
+ 122:	83 c4 10             	add    $0x10,%esp
+ 125:	eb 0b                	jmp    132 <main+0x132>
+ 127:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12e:	66 90                	xchg   %ax,%ax
+  for(i = 0; i < nproc; i++){
+ 130:	89 c6                	mov    %eax,%esi
+    if(read(fds[0], &c, 1) != 1 || !c){
+ 132:	83 ec 04             	sub    $0x4,%esp
+ 135:	8d 45 df             	lea    -0x21(%ebp),%eax
+ 138:	6a 01                	push   $0x1
+ 13a:	50                   	push   %eax
+ 13b:	ff 75 e0             	push   -0x20(%ebp)
+ 13e:	e8 fa 07 00 00       	call   93d <read>
+ 143:	83 c4 10             	add    $0x10,%esp
+ 146:	83 f8 01             	cmp    $0x1,%eax
+ 149:	75 06                	jne    151 <main+0x151>
+ 14b:	80 7d df 00          	cmpb   $0x0,-0x21(%ebp)
+ 14f:	75 17                	jne    168 <main+0x168>
+      printf(1, "simdtest: checksum mismatch\n");
+ 151:	83 ec 08             	sub    $0x8,%esp
+      bad = 1;
+ 154:	bf 01 00 00 00       	mov    $0x1,%edi
+      printf(1, "simdtest: checksum mismatch\n");
+ 159:	68 4e 0f 00 00       	push   $0xf4e
+ 15e:	6a 01                	push   $0x1
+ 160:	e8 3b 0a 00 00       	call   ba0 <printf>
+ 165:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < nproc; i++){
+ 168:	8d 46 01             	lea    0x1(%esi),%eax
+ 16b:	39 f3                	cmp    %esi,%ebx
+ 16d:	75 c1                	jne    130 <main+0x130>
+    }
+  }
+  for(i = 0; i < nproc; i++)
+ 16f:	31 f6                	xor    %esi,%esi
+ 171:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    wait();
+ 178:	e8 aa 07 00 00       	call   927 <wait>
+  for(i = 0; i < nproc; i++)
+ 17d:	89 f0                	mov    %esi,%eax
+ 17f:	83 c6 01             	add    $0x1,%esi
+ 182:	39 c3                	cmp    %eax,%ebx
+ 184:	75 f2                	jne    178 <main+0x178>
+  if(!bad)
+ 186:	85 ff                	test   %edi,%edi
+ 188:	74 36                	je     1c0 <main+0x1c0>
+    printf(1, "simdtest ok\n");
+  exit();
+ 18a:	e8 8d 07 00 00       	call   91c <exit>
+    printf(1, "simdtest: fork lost the parent's registers\n");
+ 18f:	57                   	push   %edi
+ 190:	57                   	push   %edi
+    bad = 1;
+ 191:	bf 01 00 00 00       	mov    $0x1,%edi
+    printf(1, "simdtest: fork lost the parent's registers\n");
+ 196:	68 f8 0e 00 00       	push   $0xef8
+ 19b:	6a 01                	push   $0x1
+ 19d:	e8 fe 09 00 00       	call   ba0 <printf>
+ 1a2:	83 c4 10             	add    $0x10,%esp
+ 1a5:	e9 ab fe ff ff       	jmp    55 <main+0x55>
+    passes = atoi(argv[2]);
+ 1aa:	83 ec 0c             	sub    $0xc,%esp
+ 1ad:	ff 73 08             	push   0x8(%ebx)
+ 1b0:	e8 1b 05 00 00       	call   6d0 <atoi>
+ 1b5:	83 c4 10             	add    $0x10,%esp
+ 1b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 1bb:	e9 2f ff ff ff       	jmp    ef <main+0xef>
+    printf(1, "simdtest ok\n");
+ 1c0:	50                   	push   %eax
+ 1c1:	50                   	push   %eax
+ 1c2:	68 6b 0f 00 00       	push   $0xf6b
+ 1c7:	6a 01                	push   $0x1
+ 1c9:	e8 d2 09 00 00       	call   ba0 <printf>
+ 1ce:	83 c4 10             	add    $0x10,%esp
+ 1d1:	eb b7                	jmp    18a <main+0x18a>
+ 1d3:	66 90                	xchg   %ax,%ax
+ 1d5:	66 90                	xchg   %ax,%ax
+ 1d7:	66 90                	xchg   %ax,%ax
+ 1d9:	66 90                	xchg   %ax,%ax
+ 1db:	66 90                	xchg   %ax,%ax
+ 1dd:	66 90                	xchg   %ax,%ax
+ 1df:	90                   	nop
+
+000001e0 <simdsum>:
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	56                   	push   %esi
+ 1e5:	53                   	push   %ebx
+  asm volatile(
+ 1e6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e9:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 1ef:	8b 7d 14             	mov    0x14(%ebp),%edi
+ 1f2:	66 0f ef c0          	pxor   %xmm0,%xmm0
+ 1f6:	66 0f ef c9          	pxor   %xmm1,%xmm1
+ 1fa:	89 c6                	mov    %eax,%esi
+ 1fc:	89 d1                	mov    %edx,%ecx
+ 1fe:	f3 0f 6f 16          	movdqu (%esi),%xmm2
+ 202:	66 0f fe c2          	paddd  %xmm2,%xmm0
+ 206:	66 0f fe c8          	paddd  %xmm0,%xmm1
+ 20a:	83 c6 10             	add    $0x10,%esi
+ 20d:	83 e9 04             	sub    $0x4,%ecx
+ 210:	75 ec                	jne    1fe <simdsum+0x1e>
+ 212:	4b                   	dec    %ebx
+ 213:	75 e5                	jne    1fa <simdsum+0x1a>
+ 215:	f3 0f 7f 07          	movdqu %xmm0,(%edi)
+ 219:	f3 0f 7f 4f 10       	movdqu %xmm1,0x10(%edi)
+}
+ 21e:	5b                   	pop    %ebx
+ 21f:	5e                   	pop    %esi
+ 220:	5f                   	pop    %edi
+ 221:	5d                   	pop    %ebp
+ 222:	c3                   	ret
+ 223:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000230 <scalarsum>:
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	57                   	push   %edi
+ 234:	56                   	push   %esi
+ 235:	53                   	push   %ebx
+ 236:	83 ec 04             	sub    $0x4,%esp
+ 239:	8b 4d 14             	mov    0x14(%ebp),%ecx
+ 23c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 23f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 242:	89 c8                	mov    %ecx,%eax
+ 244:	8d 51 20             	lea    0x20(%ecx),%edx
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+    out[j] = 0;
+ 250:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(j = 0; j < 8; j++)
+ 256:	83 c0 04             	add    $0x4,%eax
+ 259:	39 c2                	cmp    %eax,%edx
+ 25b:	75 f3                	jne    250 <scalarsum+0x20>
+  while(passes-- > 0){
+ 25d:	8d 53 ff             	lea    -0x1(%ebx),%edx
+ 260:	85 db                	test   %ebx,%ebx
+ 262:	7e 45                	jle    2a9 <scalarsum+0x79>
+    for(i = 0; i < n; i += 4){
+ 264:	85 ff                	test   %edi,%edi
+ 266:	7e 49                	jle    2b1 <scalarsum+0x81>
+ 268:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+ 270:	89 55 f0             	mov    %edx,-0x10(%ebp)
+ 273:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 276:	31 f6                	xor    %esi,%esi
+ 278:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27f:	90                   	nop
+      for(j = 0; j < 4; j++){
+ 280:	31 c0                	xor    %eax,%eax
+        out[j] += buf[i+j];
+ 282:	8b 14 83             	mov    (%ebx,%eax,4),%edx
+ 285:	03 14 81             	add    (%ecx,%eax,4),%edx
+ 288:	89 14 81             	mov    %edx,(%ecx,%eax,4)
+        out[4+j] += out[j];
+ 28b:	01 54 81 10          	add    %edx,0x10(%ecx,%eax,4)
+      for(j = 0; j < 4; j++){
+ 28f:	83 c0 01             	add    $0x1,%eax
+ 292:	83 f8 04             	cmp    $0x4,%eax
+ 295:	75 eb                	jne    282 <scalarsum+0x52>
+    for(i = 0; i < n; i += 4){
+ 297:	83 c6 04             	add    $0x4,%esi
+ 29a:	83 c3 10             	add    $0x10,%ebx
+ 29d:	39 f7                	cmp    %esi,%edi
+ 29f:	7f df                	jg     280 <scalarsum+0x50>
+  while(passes-- > 0){
+ 2a1:	8b 55 f0             	mov    -0x10(%ebp),%edx
+ 2a4:	83 ea 01             	sub    $0x1,%edx
+ 2a7:	73 c7                	jae    270 <scalarsum+0x40>
+}
+ 2a9:	83 c4 04             	add    $0x4,%esp
+ 2ac:	5b                   	pop    %ebx
+ 2ad:	5e                   	pop    %esi
+ 2ae:	5f                   	pop    %edi
+ 2af:	5d                   	pop    %ebp
+ 2b0:	c3                   	ret
+  while(passes-- > 0){
+ 2b1:	83 ea 01             	sub    $0x1,%edx
+ 2b4:	72 f3                	jb     2a9 <scalarsum+0x79>
+ 2b6:	eb ac                	jmp    264 <scalarsum+0x34>
+ 2b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <check>:
+{
+ 2c0:	55                   	push   %ebp
+  for(i = 0; i < NWORD; i++){
+ 2c1:	31 c9                	xor    %ecx,%ecx
+{
+ 2c3:	89 e5                	mov    %esp,%ebp
+ 2c5:	57                   	push   %edi
+ 2c6:	56                   	push   %esi
+ 2c7:	53                   	push   %ebx
+ 2c8:	83 ec 6c             	sub    $0x6c,%esp
+  seed = 12345 + id * 7919;
+ 2cb:	69 45 08 ef 1e 00 00 	imul   $0x1eef,0x8(%ebp),%eax
+  for(i = 0; i < NWORD; i++){
+ 2d2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  seed = 12345 + id * 7919;
+ 2d5:	05 39 30 00 00       	add    $0x3039,%eax
+  for(i = 0; i < NWORD; i++){
+ 2da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seed = seed * 1103515245 + 12345;
+ 2e0:	69 c0 6d 4e c6 41    	imul   $0x41c64e6d,%eax,%eax
+ 2e6:	05 39 30 00 00       	add    $0x3039,%eax
+    buf[i] = seed;
+ 2eb:	89 04 8d c0 14 00 00 	mov    %eax,0x14c0(,%ecx,4)
+  for(i = 0; i < NWORD; i++){
+ 2f2:	83 c1 01             	add    $0x1,%ecx
+ 2f5:	81 f9 00 40 00 00    	cmp    $0x4000,%ecx
+ 2fb:	75 e3                	jne    2e0 <check+0x20>
+
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+ 2fd:	89 7d 0c             	mov    %edi,0xc(%ebp)
+ 300:	0f 31                	rdtsc
+ 302:	89 45 98             	mov    %eax,-0x68(%ebp)
+  asm volatile(
+ 305:	89 fb                	mov    %edi,%ebx
+ 307:	89 c8                	mov    %ecx,%eax
+ 309:	8d 7d c8             	lea    -0x38(%ebp),%edi
+ 30c:	89 55 9c             	mov    %edx,-0x64(%ebp)
+ 30f:	ba c0 14 00 00       	mov    $0x14c0,%edx
+ 314:	66 0f ef c0          	pxor   %xmm0,%xmm0
+ 318:	66 0f ef c9          	pxor   %xmm1,%xmm1
+ 31c:	89 d6                	mov    %edx,%esi
+ 31e:	89 c1                	mov    %eax,%ecx
+ 320:	f3 0f 6f 16          	movdqu (%esi),%xmm2
+ 324:	66 0f fe c2          	paddd  %xmm2,%xmm0
+ 328:	66 0f fe c8          	paddd  %xmm0,%xmm1
+ 32c:	83 c6 10             	add    $0x10,%esi
+ 32f:	83 e9 04             	sub    $0x4,%ecx
+ 332:	75 ec                	jne    320 <check+0x60>
+ 334:	4b                   	dec    %ebx
+ 335:	75 e5                	jne    31c <check+0x5c>
+ 337:	f3 0f 7f 07          	movdqu %xmm0,(%edi)
+ 33b:	f3 0f 7f 4f 10       	movdqu %xmm1,0x10(%edi)
+ 340:	0f 31                	rdtsc
+ 342:	89 55 94             	mov    %edx,-0x6c(%ebp)
+ 345:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 348:	89 45 90             	mov    %eax,-0x70(%ebp)
+ 34b:	8d 45 a8             	lea    -0x58(%ebp),%eax
+ 34e:	66 90                	xchg   %ax,%ax
+    out[j] = 0;
+ 350:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(j = 0; j < 8; j++)
+ 356:	8d 75 c8             	lea    -0x38(%ebp),%esi
+ 359:	83 c0 04             	add    $0x4,%eax
+ 35c:	39 f0                	cmp    %esi,%eax
+ 35e:	75 f0                	jne    350 <check+0x90>
+  while(passes-- > 0){
+ 360:	89 7d 0c             	mov    %edi,0xc(%ebp)
+ 363:	8d 57 ff             	lea    -0x1(%edi),%edx
+ 366:	8d 5d b8             	lea    -0x48(%ebp),%ebx
+ 369:	85 ff                	test   %edi,%edi
+ 36b:	7e 42                	jle    3af <check+0xef>
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+    for(i = 0; i < n; i += 4){
+ 370:	89 55 a4             	mov    %edx,-0x5c(%ebp)
+ 373:	bf c0 14 00 00       	mov    $0x14c0,%edi
+ 378:	31 f6                	xor    %esi,%esi
+ 37a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 380:	89 f9                	mov    %edi,%ecx
+ 382:	8d 45 a8             	lea    -0x58(%ebp),%eax
+        out[j] += buf[i+j];
+ 385:	8b 11                	mov    (%ecx),%edx
+ 387:	03 10                	add    (%eax),%edx
+      for(j = 0; j < 4; j++){
+ 389:	83 c1 04             	add    $0x4,%ecx
+        out[4+j] += out[j];
+ 38c:	01 50 10             	add    %edx,0x10(%eax)
+      for(j = 0; j < 4; j++){
+ 38f:	83 c0 04             	add    $0x4,%eax
+        out[j] += buf[i+j];
+ 392:	89 50 fc             	mov    %edx,-0x4(%eax)
+      for(j = 0; j < 4; j++){
+ 395:	39 c3                	cmp    %eax,%ebx
+ 397:	75 ec                	jne    385 <check+0xc5>
+    for(i = 0; i < n; i += 4){
+ 399:	83 c6 04             	add    $0x4,%esi
+ 39c:	83 c7 10             	add    $0x10,%edi
+ 39f:	81 fe 00 40 00 00    	cmp    $0x4000,%esi
+ 3a5:	75 d9                	jne    380 <check+0xc0>
+  while(passes-- > 0){
+ 3a7:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+ 3aa:	83 ea 01             	sub    $0x1,%edx
+ 3ad:	73 c1                	jae    370 <check+0xb0>
+ 3af:	0f 31                	rdtsc
+         (uint)((t1 - t0) >> 20), (uint)((t2 - t1) >> 20));
+ 3b1:	8b 75 90             	mov    -0x70(%ebp),%esi
+ 3b4:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+  printf(1, "simdtest %d: sse %d Mcycles, scalar %d Mcycles\n", id,
+ 3b7:	83 ec 0c             	sub    $0xc,%esp
+         (uint)((t1 - t0) >> 20), (uint)((t2 - t1) >> 20));
+ 3ba:	29 f0                	sub    %esi,%eax
+ 3bc:	19 fa                	sbb    %edi,%edx
+ 3be:	0f ac d0 14          	shrd   $0x14,%edx,%eax
+ 3c2:	89 fa                	mov    %edi,%edx
+  printf(1, "simdtest %d: sse %d Mcycles, scalar %d Mcycles\n", id,
+ 3c4:	50                   	push   %eax
+         (uint)((t1 - t0) >> 20), (uint)((t2 - t1) >> 20));
+ 3c5:	89 f0                	mov    %esi,%eax
+ 3c7:	2b 45 98             	sub    -0x68(%ebp),%eax
+ 3ca:	1b 55 9c             	sbb    -0x64(%ebp),%edx
+ 3cd:	0f ac d0 14          	shrd   $0x14,%edx,%eax
+  printf(1, "simdtest %d: sse %d Mcycles, scalar %d Mcycles\n", id,
+ 3d1:	50                   	push   %eax
+ 3d2:	ff 75 08             	push   0x8(%ebp)
+ 3d5:	68 c8 0e 00 00       	push   $0xec8
+ 3da:	6a 01                	push   $0x1
+ 3dc:	e8 bf 07 00 00       	call   ba0 <printf>
+ 3e1:	83 c4 20             	add    $0x20,%esp
+  for(i = 0; i < 8; i++)
+ 3e4:	31 c0                	xor    %eax,%eax
+ 3e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+    if(got[i] != want[i])
+ 3f0:	8b 7c 85 a8          	mov    -0x58(%ebp,%eax,4),%edi
+ 3f4:	39 7c 85 c8          	cmp    %edi,-0x38(%ebp,%eax,4)
+ 3f8:	75 12                	jne    40c <check+0x14c>
+  for(i = 0; i < 8; i++)
+ 3fa:	83 c0 01             	add    $0x1,%eax
+ 3fd:	83 f8 08             	cmp    $0x8,%eax
+ 400:	75 ee                	jne    3f0 <check+0x130>
+}
+ 402:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+ 405:	31 c0                	xor    %eax,%eax
+}
+ 407:	5b                   	pop    %ebx
+ 408:	5e                   	pop    %esi
+ 409:	5f                   	pop    %edi
+ 40a:	5d                   	pop    %ebp
+ 40b:	c3                   	ret
+ 40c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+ 40f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ 414:	5b                   	pop    %ebx
+ 415:	5e                   	pop    %esi
+ 416:	5f                   	pop    %edi
+ 417:	5d                   	pop    %ebp
+ 418:	c3                   	ret
+ 419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <forkcheck>:
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	83 ec 44             	sub    $0x44,%esp
+  if(pipe(fds) < 0)
+ 426:	8d 45 d0             	lea    -0x30(%ebp),%eax
+  uint v[4] = { 0xdeadbeef, 1, 2, 3 }, w[4];
+ 429:	c7 45 d8 ef be ad de 	movl   $0xdeadbeef,-0x28(%ebp)
+ 430:	c7 45 dc 01 00 00 00 	movl   $0x1,-0x24(%ebp)
+ 437:	c7 45 e0 02 00 00 00 	movl   $0x2,-0x20(%ebp)
+ 43e:	c7 45 e4 03 00 00 00 	movl   $0x3,-0x1c(%ebp)
+  if(pipe(fds) < 0)
+ 445:	50                   	push   %eax
+ 446:	e8 e7 04 00 00       	call   932 <pipe>
+ 44b:	83 c4 10             	add    $0x10,%esp
+ 44e:	85 c0                	test   %eax,%eax
+ 450:	78 66                	js     4b8 <forkcheck+0x98>
+  asm volatile("movdqu (%0), %%xmm7" : : "r" (v) : "memory");
+ 452:	8d 45 d8             	lea    -0x28(%ebp),%eax
+ 455:	f3 0f 6f 38          	movdqu (%eax),%xmm7
+  if((pid = fork()) == 0){
+ 459:	e8 b3 04 00 00       	call   911 <fork>
+ 45e:	85 c0                	test   %eax,%eax
+ 460:	74 5d                	je     4bf <forkcheck+0x9f>
+  c = 0;
+ 462:	c6 45 cf 00          	movb   $0x0,-0x31(%ebp)
+  if(pid < 0 || read(fds[0], &c, 1) != 1)
+ 466:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 469:	79 2d                	jns    498 <forkcheck+0x78>
+    c = 0;
+ 46b:	c6 45 cf 00          	movb   $0x0,-0x31(%ebp)
+  close(fds[0]);
+ 46f:	83 ec 0c             	sub    $0xc,%esp
+ 472:	ff 75 d0             	push   -0x30(%ebp)
+ 475:	e8 d9 04 00 00       	call   953 <close>
+  close(fds[1]);
+ 47a:	58                   	pop    %eax
+ 47b:	ff 75 d4             	push   -0x2c(%ebp)
+ 47e:	e8 d0 04 00 00       	call   953 <close>
+  wait();
+ 483:	e8 9f 04 00 00       	call   927 <wait>
+  return c ? 0 : -1;
+ 488:	83 c4 10             	add    $0x10,%esp
+ 48b:	80 7d cf 01          	cmpb   $0x1,-0x31(%ebp)
+}
+ 48f:	c9                   	leave
+  return c ? 0 : -1;
+ 490:	19 c0                	sbb    %eax,%eax
+}
+ 492:	c3                   	ret
+ 493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 497:	90                   	nop
+  if(pid < 0 || read(fds[0], &c, 1) != 1)
+ 498:	83 ec 04             	sub    $0x4,%esp
+ 49b:	8d 55 cf             	lea    -0x31(%ebp),%edx
+ 49e:	6a 01                	push   $0x1
+ 4a0:	52                   	push   %edx
+ 4a1:	50                   	push   %eax
+ 4a2:	e8 96 04 00 00       	call   93d <read>
+ 4a7:	83 c4 10             	add    $0x10,%esp
+ 4aa:	83 f8 01             	cmp    $0x1,%eax
+ 4ad:	75 bc                	jne    46b <forkcheck+0x4b>
+ 4af:	eb be                	jmp    46f <forkcheck+0x4f>
+ 4b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+}
+ 4b8:	c9                   	leave
+    return -1;
+ 4b9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ 4be:	c3                   	ret
+    asm volatile("movdqu %%xmm7, (%0)" : : "r" (w) : "memory");
+ 4bf:	8d 55 e8             	lea    -0x18(%ebp),%edx
+ 4c2:	f3 0f 7f 3a          	movdqu %xmm7,(%edx)
+    c = w[0] == v[0] && w[3] == v[3];
+ 4c6:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+ 4c9:	39 4d e8             	cmp    %ecx,-0x18(%ebp)
+ 4cc:	75 0c                	jne    4da <forkcheck+0xba>
+ 4ce:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 4d1:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 4d4:	0f 94 c0             	sete   %al
+ 4d7:	0f b6 c0             	movzbl %al,%eax
+ 4da:	88 45 cf             	mov    %al,-0x31(%ebp)
+    write(fds[1], &c, 1);
+ 4dd:	8d 45 cf             	lea    -0x31(%ebp),%eax
+ 4e0:	52                   	push   %edx
+ 4e1:	6a 01                	push   $0x1
+ 4e3:	50                   	push   %eax
+ 4e4:	ff 75 d4             	push   -0x2c(%ebp)
+ 4e7:	e8 5c 04 00 00       	call   948 <write>
+    exit();
+ 4ec:	e8 2b 04 00 00       	call   91c <exit>
+ 4f1:	66 90                	xchg   %ax,%ax
+ 4f3:	66 90                	xchg   %ax,%ax
+ 4f5:	66 90                	xchg   %ax,%ax
+ 4f7:	66 90                	xchg   %ax,%ax
+ 4f9:	66 90                	xchg   %ax,%ax
+ 4fb:	66 90                	xchg   %ax,%ax
+ 4fd:	66 90                	xchg   %ax,%ax
+ 4ff:	90                   	nop
+
+00000500 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 500:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 501:	31 c0                	xor    %eax,%eax
+{
+ 503:	89 e5                	mov    %esp,%ebp
+ 505:	53                   	push   %ebx
+ 506:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 509:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 510:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 514:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 517:	83 c0 01             	add    $0x1,%eax
+ 51a:	84 d2                	test   %dl,%dl
+ 51c:	75 f2                	jne    510 <strcpy+0x10>
+    ;
+  return os;
+}
+ 51e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 521:	89 c8                	mov    %ecx,%eax
+ 523:	c9                   	leave
+ 524:	c3                   	ret
+ 525:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000530 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	53                   	push   %ebx
+ 534:	8b 55 08             	mov    0x8(%ebp),%edx
+ 537:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 53a:	0f b6 02             	movzbl (%edx),%eax
+ 53d:	84 c0                	test   %al,%al
+ 53f:	75 17                	jne    558 <strcmp+0x28>
+ 541:	eb 3a                	jmp    57d <strcmp+0x4d>
+ 543:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 547:	90                   	nop
+ 548:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 54c:	83 c2 01             	add    $0x1,%edx
+ 54f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 552:	84 c0                	test   %al,%al
+ 554:	74 1a                	je     570 <strcmp+0x40>
+    p++, q++;
+ 556:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 558:	0f b6 19             	movzbl (%ecx),%ebx
+ 55b:	38 c3                	cmp    %al,%bl
+ 55d:	74 e9                	je     548 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 55f:	29 d8                	sub    %ebx,%eax
+}
+ 561:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 564:	c9                   	leave
+ 565:	c3                   	ret
+ 566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 570:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 574:	31 c0                	xor    %eax,%eax
+ 576:	29 d8                	sub    %ebx,%eax
+}
+ 578:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 57b:	c9                   	leave
+ 57c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 57d:	0f b6 19             	movzbl (%ecx),%ebx
+ 580:	31 c0                	xor    %eax,%eax
+ 582:	eb db                	jmp    55f <strcmp+0x2f>
+ 584:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 58f:	90                   	nop
+
+00000590 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 596:	80 3a 00             	cmpb   $0x0,(%edx)
+ 599:	74 15                	je     5b0 <strlen+0x20>
+ 59b:	31 c0                	xor    %eax,%eax
+ 59d:	8d 76 00             	lea    0x0(%esi),%esi
+ 5a0:	83 c0 01             	add    $0x1,%eax
+ 5a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 5a7:	89 c1                	mov    %eax,%ecx
+ 5a9:	75 f5                	jne    5a0 <strlen+0x10>
+    ;
+  return n;
+}
+ 5ab:	89 c8                	mov    %ecx,%eax
+ 5ad:	5d                   	pop    %ebp
+ 5ae:	c3                   	ret
+ 5af:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 5b0:	31 c9                	xor    %ecx,%ecx
+}
+ 5b2:	5d                   	pop    %ebp
+ 5b3:	89 c8                	mov    %ecx,%eax
+ 5b5:	c3                   	ret
+ 5b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	57                   	push   %edi
+ 5c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("cld; rep stosb" :
+ 5c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5cd:	89 d7                	mov    %edx,%edi
+ 5cf:	fc                   	cld
+ 5d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 5d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 5d5:	89 d0                	mov    %edx,%eax
+ 5d7:	c9                   	leave
+ 5d8:	c3                   	ret
+ 5d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 5ea:	0f b6 10             	movzbl (%eax),%edx
+ 5ed:	84 d2                	test   %dl,%dl
+ 5ef:	75 12                	jne    603 <strchr+0x23>
+ 5f1:	eb 1d                	jmp    610 <strchr+0x30>
+ 5f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5f7:	90                   	nop
+ 5f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 5fc:	83 c0 01             	add    $0x1,%eax
+ 5ff:	84 d2                	test   %dl,%dl
+ 601:	74 0d                	je     610 <strchr+0x30>
+    if(*s == c)
+ 603:	38 d1                	cmp    %dl,%cl
+ 605:	75 f1                	jne    5f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 607:	5d                   	pop    %ebp
+ 608:	c3                   	ret
+ 609:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 610:	31 c0                	xor    %eax,%eax
+}
+ 612:	5d                   	pop    %ebp
+ 613:	c3                   	ret
+ 614:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 61f:	90                   	nop
+
+00000620 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	57                   	push   %edi
+ 624:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 625:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 628:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 629:	31 db                	xor    %ebx,%ebx
+{
+ 62b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 62e:	eb 27                	jmp    657 <gets+0x37>
+    cc = read(0, &c, 1);
+ 630:	83 ec 04             	sub    $0x4,%esp
+ 633:	6a 01                	push   $0x1
+ 635:	56                   	push   %esi
+ 636:	6a 00                	push   $0x0
+ 638:	e8 00 03 00 00       	call   93d <read>
+    if(cc < 1)
+ 63d:	83 c4 10             	add    $0x10,%esp
+ 640:	85 c0                	test   %eax,%eax
+ 642:	7e 1d                	jle    661 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 644:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 648:	8b 55 08             	mov    0x8(%ebp),%edx
+ 64b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 64f:	3c 0a                	cmp    $0xa,%al
+ 651:	74 10                	je     663 <gets+0x43>
+ 653:	3c 0d                	cmp    $0xd,%al
+ 655:	74 0c                	je     663 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 657:	89 df                	mov    %ebx,%edi
+ 659:	83 c3 01             	add    $0x1,%ebx
+ 65c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 65f:	7c cf                	jl     630 <gets+0x10>
+ 661:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 663:	8b 45 08             	mov    0x8(%ebp),%eax
+ 666:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 66a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 66d:	5b                   	pop    %ebx
+ 66e:	5e                   	pop    %esi
+ 66f:	5f                   	pop    %edi
+ 670:	5d                   	pop    %ebp
+ 671:	c3                   	ret
+ 672:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 679:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000680 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	56                   	push   %esi
+ 684:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 685:	83 ec 08             	sub    $0x8,%esp
+ 688:	6a 00                	push   $0x0
+ 68a:	ff 75 08             	push   0x8(%ebp)
+ 68d:	e8 e2 02 00 00       	call   974 <open>
+  if(fd < 0)
+ 692:	83 c4 10             	add    $0x10,%esp
+ 695:	85 c0                	test   %eax,%eax
+ 697:	78 27                	js     6c0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 699:	83 ec 08             	sub    $0x8,%esp
+ 69c:	ff 75 0c             	push   0xc(%ebp)
+ 69f:	89 c3                	mov    %eax,%ebx
+ 6a1:	50                   	push   %eax
+ 6a2:	e8 ee 02 00 00       	call   995 <fstat>
+  close(fd);
+ 6a7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 6aa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 6ac:	e8 a2 02 00 00       	call   953 <close>
+  return r;
+ 6b1:	83 c4 10             	add    $0x10,%esp
+}
+ 6b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 6b7:	89 f0                	mov    %esi,%eax
+ 6b9:	5b                   	pop    %ebx
+ 6ba:	5e                   	pop    %esi
+ 6bb:	5d                   	pop    %ebp
+ 6bc:	c3                   	ret
+ 6bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 6c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 6c5:	eb ed                	jmp    6b4 <stat+0x34>
+ 6c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ce:	66 90                	xchg   %ax,%ax
+
+000006d0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	53                   	push   %ebx
+ 6d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 6d7:	0f be 02             	movsbl (%edx),%eax
+ 6da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 6dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 6e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 6e5:	77 1e                	ja     705 <atoi+0x35>
+ 6e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 6f0:	83 c2 01             	add    $0x1,%edx
+ 6f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 6f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 6fa:	0f be 02             	movsbl (%edx),%eax
+ 6fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 700:	80 fb 09             	cmp    $0x9,%bl
+ 703:	76 eb                	jbe    6f0 <atoi+0x20>
+  return n;
+}
+ 705:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 708:	89 c8                	mov    %ecx,%eax
+ 70a:	c9                   	leave
+ 70b:	c3                   	ret
+ 70c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000710 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	57                   	push   %edi
+ 714:	56                   	push   %esi
+ 715:	8b 45 10             	mov    0x10(%ebp),%eax
+ 718:	8b 55 08             	mov    0x8(%ebp),%edx
+ 71b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 71e:	85 c0                	test   %eax,%eax
+ 720:	7e 13                	jle    735 <memmove+0x25>
+ 722:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 724:	89 d7                	mov    %edx,%edi
+ 726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 72d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 730:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 731:	39 f8                	cmp    %edi,%eax
+ 733:	75 fb                	jne    730 <memmove+0x20>
+  return vdst;
+}
+ 735:	5e                   	pop    %esi
+ 736:	89 d0                	mov    %edx,%eax
+ 738:	5f                   	pop    %edi
+ 739:	5d                   	pop    %ebp
+ 73a:	c3                   	ret
+ 73b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 73f:	90                   	nop
+
+00000740 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 740:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 745:	85 c0                	test   %eax,%eax
+ 747:	74 07                	je     750 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 749:	c3                   	ret
+ 74a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 750:	e9 77 02 00 00       	jmp    9cc <sysgetpid>
+ 755:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 75c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000760 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 760:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 765:	c3                   	ret
+ 766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000770 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 770:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 771:	31 d2                	xor    %edx,%edx
+ 773:	89 e5                	mov    %esp,%ebp
+ 775:	53                   	push   %ebx
+ 776:	83 ec 04             	sub    $0x4,%esp
+ 779:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 77c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 77f:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 782:	85 c9                	test   %ecx,%ecx
+ 784:	7e 08                	jle    78e <cyclereport+0x1e>
+ 786:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 788:	89 d8                	mov    %ebx,%eax
+ 78a:	f7 f1                	div    %ecx
+ 78c:	89 c2                	mov    %eax,%edx
+ 78e:	83 ec 08             	sub    $0x8,%esp
+ 791:	52                   	push   %edx
+ 792:	ff 75 0c             	push   0xc(%ebp)
+ 795:	51                   	push   %ecx
+ 796:	ff 75 08             	push   0x8(%ebp)
+ 799:	68 78 0f 00 00       	push   $0xf78
+ 79e:	6a 01                	push   $0x1
+ 7a0:	e8 fb 03 00 00       	call   ba0 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 7a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 7a8:	83 c4 20             	add    $0x20,%esp
+ 7ab:	c9                   	leave
+ 7ac:	c3                   	ret
+ 7ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007b0 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 7b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7b6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 7bc:	5d                   	pop    %ebp
+ 7bd:	c3                   	ret
+ 7be:	66 90                	xchg   %ax,%ax
+
+000007c0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 7c0:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 7c1:	31 c0                	xor    %eax,%eax
+ 7c3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 7c8:	89 e5                	mov    %esp,%ebp
+ 7ca:	56                   	push   %esi
+ 7cb:	53                   	push   %ebx
+ 7cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 7cf:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 7d3:	85 c0                	test   %eax,%eax
+ 7d5:	74 30                	je     807 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 7d7:	83 f8 02             	cmp    $0x2,%eax
+ 7da:	74 0c                	je     7e8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 7dc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7e1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 7e4:	85 c0                	test   %eax,%eax
+ 7e6:	74 1f                	je     807 <mutex_lock+0x47>
+ 7e8:	be 02 00 00 00       	mov    $0x2,%esi
+ 7ed:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 7f0:	83 ec 08             	sub    $0x8,%esp
+ 7f3:	6a 02                	push   $0x2
+ 7f5:	53                   	push   %ebx
+ 7f6:	e8 8c 02 00 00       	call   a87 <futex_wait>
+ 7fb:	89 f0                	mov    %esi,%eax
+ 7fd:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 800:	83 c4 10             	add    $0x10,%esp
+ 803:	85 c0                	test   %eax,%eax
+ 805:	75 e9                	jne    7f0 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 807:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 80a:	5b                   	pop    %ebx
+ 80b:	5e                   	pop    %esi
+ 80c:	5d                   	pop    %ebp
+ 80d:	c3                   	ret
+ 80e:	66 90                	xchg   %ax,%ax
+
+00000810 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 810:	55                   	push   %ebp
+ 811:	89 e5                	mov    %esp,%ebp
+ 813:	83 ec 08             	sub    $0x8,%esp
+ 816:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 819:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 81d:	75 09                	jne    828 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 81f:	c9                   	leave
+ 820:	c3                   	ret
+ 821:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 828:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 82b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 831:	6a 01                	push   $0x1
+ 833:	50                   	push   %eax
+ 834:	e8 59 02 00 00       	call   a92 <futex_wake>
+ 839:	83 c4 10             	add    $0x10,%esp
+}
+ 83c:	c9                   	leave
+ 83d:	c3                   	ret
+ 83e:	66 90                	xchg   %ax,%ax
+
+00000840 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 840:	55                   	push   %ebp
+ 841:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 843:	8b 45 08             	mov    0x8(%ebp),%eax
+ 846:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 84c:	5d                   	pop    %ebp
+ 84d:	c3                   	ret
+ 84e:	66 90                	xchg   %ax,%ax
+
+00000850 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 850:	55                   	push   %ebp
+ 851:	89 e5                	mov    %esp,%ebp
+ 853:	57                   	push   %edi
+ 854:	56                   	push   %esi
+ 855:	53                   	push   %ebx
+ 856:	83 ec 0c             	sub    $0xc,%esp
+ 859:	8b 75 08             	mov    0x8(%ebp),%esi
+ 85c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 85f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 861:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 865:	75 21                	jne    888 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 867:	83 ec 08             	sub    $0x8,%esp
+ 86a:	57                   	push   %edi
+ 86b:	56                   	push   %esi
+ 86c:	e8 16 02 00 00       	call   a87 <futex_wait>
+  mutex_lock(m);
+ 871:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 874:	83 c4 10             	add    $0x10,%esp
+}
+ 877:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 87a:	5b                   	pop    %ebx
+ 87b:	5e                   	pop    %esi
+ 87c:	5f                   	pop    %edi
+ 87d:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 87e:	e9 3d ff ff ff       	jmp    7c0 <mutex_lock>
+ 883:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 887:	90                   	nop
+    futex_wake(&m->v, 1);
+ 888:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 88b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 891:	6a 01                	push   $0x1
+ 893:	53                   	push   %ebx
+ 894:	e8 f9 01 00 00       	call   a92 <futex_wake>
+ 899:	83 c4 10             	add    $0x10,%esp
+ 89c:	eb c9                	jmp    867 <cond_wait+0x17>
+ 89e:	66 90                	xchg   %ax,%ax
+
+000008a0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 8a0:	55                   	push   %ebp
+ 8a1:	89 e5                	mov    %esp,%ebp
+ 8a3:	83 ec 10             	sub    $0x10,%esp
+ 8a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 8a9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 8ad:	6a 01                	push   $0x1
+ 8af:	50                   	push   %eax
+ 8b0:	e8 dd 01 00 00       	call   a92 <futex_wake>
+}
+ 8b5:	83 c4 10             	add    $0x10,%esp
+ 8b8:	c9                   	leave
+ 8b9:	c3                   	ret
+ 8ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008c0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 8c0:	55                   	push   %ebp
+ 8c1:	89 e5                	mov    %esp,%ebp
+ 8c3:	83 ec 10             	sub    $0x10,%esp
+ 8c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 8c9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 8cd:	68 ff ff ff 7f       	push   $0x7fffffff
+ 8d2:	50                   	push   %eax
+ 8d3:	e8 ba 01 00 00       	call   a92 <futex_wake>
+}
+ 8d8:	83 c4 10             	add    $0x10,%esp
+ 8db:	c9                   	leave
+ 8dc:	c3                   	ret
+
+000008dd <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 8dd:	50                   	push   %eax
+  pushl %ebx
+ 8de:	53                   	push   %ebx
+  movl $1, %eax
+ 8df:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 8e4:	0f a2                	cpuid
+  popl %ebx
+ 8e6:	5b                   	pop    %ebx
+  popl %eax
+ 8e7:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 8e8:	c7 05 ac 14 00 00 0e 	movl   $0x90e,0x14ac
+ 8ef:	09 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 8f2:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 8f8:	74 14                	je     90e <sysint>
+  movl $sysfast, syscallvec
+ 8fa:	c7 05 ac 14 00 00 04 	movl   $0x904,0x14ac
+ 901:	09 00 00 
+
+00000904 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 904:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 906:	ba 0d 09 00 00       	mov    $0x90d,%edx
+  sysenter
+ 90b:	0f 34                	sysenter
+1:
+  ret
+ 90d:	c3                   	ret
+
+0000090e <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 90e:	cd 40                	int    $0x40
+  ret
+ 910:	c3                   	ret
+
+00000911 <fork>:
+
+SYSCALL(fork)
+ 911:	b8 01 00 00 00       	mov    $0x1,%eax
+ 916:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+0000091c <exit>:
+SYSCALL(exit)
+ 91c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 921:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000927 <wait>:
+SYSCALL(wait)
+ 927:	b8 03 00 00 00       	mov    $0x3,%eax
+ 92c:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000932 <pipe>:
+SYSCALL(pipe)
+ 932:	b8 04 00 00 00       	mov    $0x4,%eax
+ 937:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+0000093d <read>:
+SYSCALL(read)
+ 93d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 942:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000948 <write>:
+SYSCALL(write)
+ 948:	b8 10 00 00 00       	mov    $0x10,%eax
+ 94d:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000953 <close>:
+SYSCALL(close)
+ 953:	b8 15 00 00 00       	mov    $0x15,%eax
+ 958:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+0000095e <kill>:
+SYSCALL(kill)
+ 95e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 963:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000969 <exec>:
+SYSCALL(exec)
+ 969:	b8 07 00 00 00       	mov    $0x7,%eax
+ 96e:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000974 <open>:
+SYSCALL(open)
+ 974:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 979:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+0000097f <mknod>:
+SYSCALL(mknod)
+ 97f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 984:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+0000098a <unlink>:
+SYSCALL(unlink)
+ 98a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 98f:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000995 <fstat>:
+SYSCALL(fstat)
+ 995:	b8 08 00 00 00       	mov    $0x8,%eax
+ 99a:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+000009a0 <link>:
+SYSCALL(link)
+ 9a0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 9a5:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+000009ab <mkdir>:
+SYSCALL(mkdir)
+ 9ab:	b8 14 00 00 00       	mov    $0x14,%eax
+ 9b0:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+000009b6 <chdir>:
+SYSCALL(chdir)
+ 9b6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 9bb:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+000009c1 <dup>:
+SYSCALL(dup)
+ 9c1:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 9c6:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+000009cc <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 9cc:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 9d1:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+000009d7 <sbrk>:
+SYSCALL(sbrk)
+ 9d7:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 9dc:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+000009e2 <sleep>:
+SYSCALL(sleep)
+ 9e2:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 9e7:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+000009ed <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 9ed:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 9f2:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+000009f8 <swapread>:
+SYSCALL(swapread)
+ 9f8:	b8 16 00 00 00       	mov    $0x16,%eax
+ 9fd:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000a03 <swapwrite>:
+SYSCALL(swapwrite)
+ a03:	b8 17 00 00 00       	mov    $0x17,%eax
+ a08:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000a0e <swapstat>:
+SYSCALL(swapstat)
+ a0e:	b8 18 00 00 00       	mov    $0x18,%eax
+ a13:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000a19 <madvise>:
+SYSCALL(madvise)
+ a19:	b8 19 00 00 00       	mov    $0x19,%eax
+ a1e:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000a24 <mlock>:
+SYSCALL(mlock)
+ a24:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ a29:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000a2f <munlock>:
+SYSCALL(munlock)
+ a2f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ a34:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000a3a <membench>:
+SYSCALL(membench)
+ a3a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ a3f:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000a45 <nice>:
+SYSCALL(nice)
+ a45:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ a4a:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000a50 <setpriority>:
+SYSCALL(setpriority)
+ a50:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ a55:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000a5b <usleep>:
+SYSCALL(usleep)
+ a5b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ a60:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000a66 <cpustat>:
+SYSCALL(cpustat)
+ a66:	b8 20 00 00 00       	mov    $0x20,%eax
+ a6b:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000a71 <clone>:
+SYSCALL(clone)
+ a71:	b8 21 00 00 00       	mov    $0x21,%eax
+ a76:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000a7c <join>:
+SYSCALL(join)
+ a7c:	b8 22 00 00 00       	mov    $0x22,%eax
+ a81:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000a87 <futex_wait>:
+SYSCALL(futex_wait)
+ a87:	b8 23 00 00 00       	mov    $0x23,%eax
+ a8c:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000a92 <futex_wake>:
+SYSCALL(futex_wake)
+ a92:	b8 24 00 00 00       	mov    $0x24,%eax
+ a97:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000a9d <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ a9d:	b8 25 00 00 00       	mov    $0x25,%eax
+ aa2:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000aa8 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ aa8:	b8 26 00 00 00       	mov    $0x26,%eax
+ aad:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000ab3 <getcpu>:
+SYSCALL(getcpu)
+ ab3:	b8 27 00 00 00       	mov    $0x27,%eax
+ ab8:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000abe <migrations>:
+SYSCALL(migrations)
+ abe:	b8 28 00 00 00       	mov    $0x28,%eax
+ ac3:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000ac9 <ioring_enter>:
+SYSCALL(ioring_enter)
+ ac9:	b8 29 00 00 00       	mov    $0x29,%eax
+ ace:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000ad4 <lockstat>:
+SYSCALL(lockstat)
+ ad4:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ ad9:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000adf <lockprof>:
+SYSCALL(lockprof)
+ adf:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ ae4:	ff 25 ac 14 00 00    	jmp    *0x14ac
+
+00000aea <bcachestat>:
+SYSCALL(bcachestat)
+ aea:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ aef:	ff 25 ac 14 00 00    	jmp    *0x14ac
+ af5:	66 90                	xchg   %ax,%ax
+ af7:	66 90                	xchg   %ax,%ax
+ af9:	66 90                	xchg   %ax,%ax
+ afb:	66 90                	xchg   %ax,%ax
+ afd:	66 90                	xchg   %ax,%ax
+ aff:	90                   	nop
+
+00000b00 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ b00:	55                   	push   %ebp
+ b01:	89 e5                	mov    %esp,%ebp
+ b03:	57                   	push   %edi
+ b04:	56                   	push   %esi
+ b05:	53                   	push   %ebx
+ b06:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ b08:	89 d1                	mov    %edx,%ecx
+{
+ b0a:	83 ec 3c             	sub    $0x3c,%esp
+ b0d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ b10:	85 d2                	test   %edx,%edx
+ b12:	0f 89 80 00 00 00    	jns    b98 <printint+0x98>
+ b18:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ b1c:	74 7a                	je     b98 <printint+0x98>
+    x = -xx;
+ b1e:	f7 d9                	neg    %ecx
+    neg = 1;
+ b20:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ b25:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ b28:	31 f6                	xor    %esi,%esi
+ b2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ b30:	89 c8                	mov    %ecx,%eax
+ b32:	31 d2                	xor    %edx,%edx
+ b34:	89 f7                	mov    %esi,%edi
+ b36:	f7 f3                	div    %ebx
+ b38:	8d 76 01             	lea    0x1(%esi),%esi
+ b3b:	0f b6 92 f4 0f 00 00 	movzbl 0xff4(%edx),%edx
+ b42:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ b46:	89 ca                	mov    %ecx,%edx
+ b48:	89 c1                	mov    %eax,%ecx
+ b4a:	39 da                	cmp    %ebx,%edx
+ b4c:	73 e2                	jae    b30 <printint+0x30>
+  if(neg)
+ b4e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ b51:	85 c0                	test   %eax,%eax
+ b53:	74 07                	je     b5c <printint+0x5c>
+    buf[i++] = '-';
+ b55:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ b5a:	89 f7                	mov    %esi,%edi
+ b5c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ b5f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ b62:	01 df                	add    %ebx,%edi
+ b64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ b68:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ b6b:	83 ec 04             	sub    $0x4,%esp
+ b6e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ b71:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ b74:	6a 01                	push   $0x1
+ b76:	50                   	push   %eax
+ b77:	56                   	push   %esi
+ b78:	e8 cb fd ff ff       	call   948 <write>
+  while(--i >= 0)
+ b7d:	89 f8                	mov    %edi,%eax
+ b7f:	83 c4 10             	add    $0x10,%esp
+ b82:	83 ef 01             	sub    $0x1,%edi
+ b85:	39 d8                	cmp    %ebx,%eax
+ b87:	75 df                	jne    b68 <printint+0x68>
+}
+ b89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b8c:	5b                   	pop    %ebx
+ b8d:	5e                   	pop    %esi
+ b8e:	5f                   	pop    %edi
+ b8f:	5d                   	pop    %ebp
+ b90:	c3                   	ret
+ b91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ b98:	31 c0                	xor    %eax,%eax
+ b9a:	eb 89                	jmp    b25 <printint+0x25>
+ b9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ba0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ ba0:	55                   	push   %ebp
+ ba1:	89 e5                	mov    %esp,%ebp
+ ba3:	57                   	push   %edi
+ ba4:	56                   	push   %esi
+ ba5:	53                   	push   %ebx
+ ba6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ ba9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ bac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ baf:	0f b6 1e             	movzbl (%esi),%ebx
+ bb2:	83 c6 01             	add    $0x1,%esi
+ bb5:	84 db                	test   %bl,%bl
+ bb7:	74 67                	je     c20 <printf+0x80>
+ bb9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ bbc:	31 d2                	xor    %edx,%edx
+ bbe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ bc1:	eb 34                	jmp    bf7 <printf+0x57>
+ bc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ bc7:	90                   	nop
+ bc8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ bcb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ bd0:	83 f8 25             	cmp    $0x25,%eax
+ bd3:	74 18                	je     bed <printf+0x4d>
+  write(fd, &c, 1);
+ bd5:	83 ec 04             	sub    $0x4,%esp
+ bd8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ bdb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ bde:	6a 01                	push   $0x1
+ be0:	50                   	push   %eax
+ be1:	57                   	push   %edi
+ be2:	e8 61 fd ff ff       	call   948 <write>
+ be7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ bea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ bed:	0f b6 1e             	movzbl (%esi),%ebx
+ bf0:	83 c6 01             	add    $0x1,%esi
+ bf3:	84 db                	test   %bl,%bl
+ bf5:	74 29                	je     c20 <printf+0x80>
+    c = fmt[i] & 0xff;
+ bf7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ bfa:	85 d2                	test   %edx,%edx
+ bfc:	74 ca                	je     bc8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ bfe:	83 fa 25             	cmp    $0x25,%edx
+ c01:	75 ea                	jne    bed <printf+0x4d>
+      if(c == 'd'){
+ c03:	83 f8 25             	cmp    $0x25,%eax
+ c06:	0f 84 24 01 00 00    	je     d30 <printf+0x190>
+ c0c:	83 e8 63             	sub    $0x63,%eax
+ c0f:	83 f8 15             	cmp    $0x15,%eax
+ c12:	77 1c                	ja     c30 <printf+0x90>
+ c14:	ff 24 85 9c 0f 00 00 	jmp    *0xf9c(,%eax,4)
+ c1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c1f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ c20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c23:	5b                   	pop    %ebx
+ c24:	5e                   	pop    %esi
+ c25:	5f                   	pop    %edi
+ c26:	5d                   	pop    %ebp
+ c27:	c3                   	ret
+ c28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c2f:	90                   	nop
+  write(fd, &c, 1);
+ c30:	83 ec 04             	sub    $0x4,%esp
+ c33:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c36:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ c3a:	6a 01                	push   $0x1
+ c3c:	52                   	push   %edx
+ c3d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ c40:	57                   	push   %edi
+ c41:	e8 02 fd ff ff       	call   948 <write>
+ c46:	83 c4 0c             	add    $0xc,%esp
+ c49:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ c4c:	6a 01                	push   $0x1
+ c4e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ c51:	52                   	push   %edx
+ c52:	57                   	push   %edi
+ c53:	e8 f0 fc ff ff       	call   948 <write>
+        putc(fd, c);
+ c58:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c5b:	31 d2                	xor    %edx,%edx
+ c5d:	eb 8e                	jmp    bed <printf+0x4d>
+ c5f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ c60:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ c63:	83 ec 0c             	sub    $0xc,%esp
+ c66:	b9 10 00 00 00       	mov    $0x10,%ecx
+ c6b:	8b 13                	mov    (%ebx),%edx
+ c6d:	6a 00                	push   $0x0
+ c6f:	89 f8                	mov    %edi,%eax
+        ap++;
+ c71:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ c74:	e8 87 fe ff ff       	call   b00 <printint>
+        ap++;
+ c79:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ c7c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c7f:	31 d2                	xor    %edx,%edx
+ c81:	e9 67 ff ff ff       	jmp    bed <printf+0x4d>
+ c86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c8d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ c90:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ c93:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ c95:	83 c0 04             	add    $0x4,%eax
+ c98:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ c9b:	85 db                	test   %ebx,%ebx
+ c9d:	0f 84 9d 00 00 00    	je     d40 <printf+0x1a0>
+        while(*s != 0){
+ ca3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ ca6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ ca8:	84 c0                	test   %al,%al
+ caa:	0f 84 3d ff ff ff    	je     bed <printf+0x4d>
+ cb0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ cb3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ cb6:	89 de                	mov    %ebx,%esi
+ cb8:	89 d3                	mov    %edx,%ebx
+ cba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ cc0:	83 ec 04             	sub    $0x4,%esp
+ cc3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ cc6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ cc9:	6a 01                	push   $0x1
+ ccb:	53                   	push   %ebx
+ ccc:	57                   	push   %edi
+ ccd:	e8 76 fc ff ff       	call   948 <write>
+        while(*s != 0){
+ cd2:	0f b6 06             	movzbl (%esi),%eax
+ cd5:	83 c4 10             	add    $0x10,%esp
+ cd8:	84 c0                	test   %al,%al
+ cda:	75 e4                	jne    cc0 <printf+0x120>
+      state = 0;
+ cdc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ cdf:	31 d2                	xor    %edx,%edx
+ ce1:	e9 07 ff ff ff       	jmp    bed <printf+0x4d>
+ ce6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ced:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ cf0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ cf3:	83 ec 0c             	sub    $0xc,%esp
+ cf6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ cfb:	8b 13                	mov    (%ebx),%edx
+ cfd:	6a 01                	push   $0x1
+ cff:	e9 6b ff ff ff       	jmp    c6f <printf+0xcf>
+ d04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ d08:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ d0b:	83 ec 04             	sub    $0x4,%esp
+ d0e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ d11:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ d13:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ d16:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ d19:	6a 01                	push   $0x1
+ d1b:	52                   	push   %edx
+ d1c:	57                   	push   %edi
+ d1d:	e8 26 fc ff ff       	call   948 <write>
+        ap++;
+ d22:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ d25:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ d28:	31 d2                	xor    %edx,%edx
+ d2a:	e9 be fe ff ff       	jmp    bed <printf+0x4d>
+ d2f:	90                   	nop
+  write(fd, &c, 1);
+ d30:	83 ec 04             	sub    $0x4,%esp
+ d33:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ d36:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ d39:	6a 01                	push   $0x1
+ d3b:	e9 11 ff ff ff       	jmp    c51 <printf+0xb1>
+ d40:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ d45:	bb 93 0f 00 00       	mov    $0xf93,%ebx
+ d4a:	e9 61 ff ff ff       	jmp    cb0 <printf+0x110>
+ d4f:	90                   	nop
+
+00000d50 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ d50:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d51:	a1 c0 14 01 00       	mov    0x114c0,%eax
+{
+ d56:	89 e5                	mov    %esp,%ebp
+ d58:	57                   	push   %edi
+ d59:	56                   	push   %esi
+ d5a:	53                   	push   %ebx
+ d5b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ d5e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d68:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d6a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d6c:	39 ca                	cmp    %ecx,%edx
+ d6e:	73 30                	jae    da0 <free+0x50>
+ d70:	39 c1                	cmp    %eax,%ecx
+ d72:	72 04                	jb     d78 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d74:	39 c2                	cmp    %eax,%edx
+ d76:	72 f0                	jb     d68 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d78:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ d7b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ d7e:	39 f8                	cmp    %edi,%eax
+ d80:	74 2e                	je     db0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d82:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ d85:	8b 42 04             	mov    0x4(%edx),%eax
+ d88:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d8b:	39 f1                	cmp    %esi,%ecx
+ d8d:	74 38                	je     dc7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ d8f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ d91:	5b                   	pop    %ebx
+  freep = p;
+ d92:	89 15 c0 14 01 00    	mov    %edx,0x114c0
+}
+ d98:	5e                   	pop    %esi
+ d99:	5f                   	pop    %edi
+ d9a:	5d                   	pop    %ebp
+ d9b:	c3                   	ret
+ d9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ da0:	39 c1                	cmp    %eax,%ecx
+ da2:	72 d0                	jb     d74 <free+0x24>
+ da4:	eb c2                	jmp    d68 <free+0x18>
+ da6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ db0:	03 70 04             	add    0x4(%eax),%esi
+ db3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ db6:	8b 02                	mov    (%edx),%eax
+ db8:	8b 00                	mov    (%eax),%eax
+ dba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ dbd:	8b 42 04             	mov    0x4(%edx),%eax
+ dc0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ dc3:	39 f1                	cmp    %esi,%ecx
+ dc5:	75 c8                	jne    d8f <free+0x3f>
+    p->s.size += bp->s.size;
+ dc7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ dca:	89 15 c0 14 01 00    	mov    %edx,0x114c0
+    p->s.size += bp->s.size;
+ dd0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ dd3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ dd6:	89 0a                	mov    %ecx,(%edx)
+}
+ dd8:	5b                   	pop    %ebx
+ dd9:	5e                   	pop    %esi
+ dda:	5f                   	pop    %edi
+ ddb:	5d                   	pop    %ebp
+ ddc:	c3                   	ret
+ ddd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000de0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ de0:	55                   	push   %ebp
+ de1:	89 e5                	mov    %esp,%ebp
+ de3:	57                   	push   %edi
+ de4:	56                   	push   %esi
+ de5:	53                   	push   %ebx
+ de6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ de9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ dec:	8b 15 c0 14 01 00    	mov    0x114c0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ df2:	8d 78 07             	lea    0x7(%eax),%edi
+ df5:	c1 ef 03             	shr    $0x3,%edi
+ df8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ dfb:	85 d2                	test   %edx,%edx
+ dfd:	0f 84 8d 00 00 00    	je     e90 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e03:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ e05:	8b 48 04             	mov    0x4(%eax),%ecx
+ e08:	39 f9                	cmp    %edi,%ecx
+ e0a:	73 64                	jae    e70 <malloc+0x90>
+  if(nu < 4096)
+ e0c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ e11:	39 df                	cmp    %ebx,%edi
+ e13:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ e16:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ e1d:	eb 0a                	jmp    e29 <malloc+0x49>
+ e1f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e20:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ e22:	8b 48 04             	mov    0x4(%eax),%ecx
+ e25:	39 f9                	cmp    %edi,%ecx
+ e27:	73 47                	jae    e70 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ e29:	89 c2                	mov    %eax,%edx
+ e2b:	39 05 c0 14 01 00    	cmp    %eax,0x114c0
+ e31:	75 ed                	jne    e20 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ e33:	83 ec 0c             	sub    $0xc,%esp
+ e36:	56                   	push   %esi
+ e37:	e8 9b fb ff ff       	call   9d7 <sbrk>
+  if(p == (char*)-1)
+ e3c:	83 c4 10             	add    $0x10,%esp
+ e3f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ e42:	74 1c                	je     e60 <malloc+0x80>
+  hp->s.size = nu;
+ e44:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ e47:	83 ec 0c             	sub    $0xc,%esp
+ e4a:	83 c0 08             	add    $0x8,%eax
+ e4d:	50                   	push   %eax
+ e4e:	e8 fd fe ff ff       	call   d50 <free>
+  return freep;
+ e53:	8b 15 c0 14 01 00    	mov    0x114c0,%edx
+      if((p = morecore(nunits)) == 0)
+ e59:	83 c4 10             	add    $0x10,%esp
+ e5c:	85 d2                	test   %edx,%edx
+ e5e:	75 c0                	jne    e20 <malloc+0x40>
+        return 0;
+  }
+}
+ e60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ e63:	31 c0                	xor    %eax,%eax
+}
+ e65:	5b                   	pop    %ebx
+ e66:	5e                   	pop    %esi
+ e67:	5f                   	pop    %edi
+ e68:	5d                   	pop    %ebp
+ e69:	c3                   	ret
+ e6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ e70:	39 cf                	cmp    %ecx,%edi
+ e72:	74 4c                	je     ec0 <malloc+0xe0>
+        p->s.size -= nunits;
+ e74:	29 f9                	sub    %edi,%ecx
+ e76:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ e79:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ e7c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ e7f:	89 15 c0 14 01 00    	mov    %edx,0x114c0
+}
+ e85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ e88:	83 c0 08             	add    $0x8,%eax
+}
+ e8b:	5b                   	pop    %ebx
+ e8c:	5e                   	pop    %esi
+ e8d:	5f                   	pop    %edi
+ e8e:	5d                   	pop    %ebp
+ e8f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ e90:	c7 05 c0 14 01 00 c4 	movl   $0x114c4,0x114c0
+ e97:	14 01 00 
+    base.s.size = 0;
+ e9a:	b8 c4 14 01 00       	mov    $0x114c4,%eax
+    base.s.ptr = freep = prevp = &base;
+ e9f:	c7 05 c4 14 01 00 c4 	movl   $0x114c4,0x114c4
+ ea6:	14 01 00 
+    base.s.size = 0;
+ ea9:	c7 05 c8 14 01 00 00 	movl   $0x0,0x114c8
+ eb0:	00 00 00 
+    if(p->s.size >= nunits){
+ eb3:	e9 54 ff ff ff       	jmp    e0c <malloc+0x2c>
+ eb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ebf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ec0:	8b 08                	mov    (%eax),%ecx
+ ec2:	89 0a                	mov    %ecx,(%edx)
+ ec4:	eb b9                	jmp    e7f <malloc+0x9f>
@@ -0,0 +1,168 @@
+// SSE in user space: several processes compute a SIMD checksum
+// of their own data at once, keeping partial sums in %xmm
+// registers across preemptions, and check it against the same
+// checksum computed with plain integer code.  Also checks that
+// fork gives the child the parent's %xmm registers.
+// usage: simdtest [nproc [passes]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "x86.h"
+
+#define NWORD  (16*1024)         // 64 KB of data per process
+#define NPROCS 16
+
+uint buf[NWORD];
+
+// Four-lane Fletcher-style sums over passes passes of buf:
+// lane i adds up words i, i+4, ... in a[i], and a[i] after
+// each step in b[i].  out gets a[0..3] then b[0..3].
+void
+simdsum(uint *buf, int n, int passes, uint *out)
+{
+  asm volatile(
+    "pxor %%xmm0, %%xmm0\n"
+    "pxor %%xmm1, %%xmm1\n"
+    "1:\n"
+    "movl %0, %%esi\n"
+    "movl %1, %%ecx\n"
+    "2:\n"
+    "movdqu (%%esi), %%xmm2\n"
+    "paddd %%xmm2, %%xmm0\n"
+    "paddd %%xmm0, %%xmm1\n"
+    "addl $16, %%esi\n"
+    "subl $4, %%ecx\n"
+    "jnz 2b\n"
+    "decl %2\n"
+    "jnz 1b\n"
+    "movdqu %%xmm0, (%3)\n"
+    "movdqu %%xmm1, 16(%3)\n"
+    : "+r" (buf), "+r" (n), "+r" (passes)
+    : "r" (out)
+    : "esi", "ecx", "memory", "cc");
+}
+
+void
+scalarsum(uint *buf, int n, int passes, uint *out)
+{
+  int i, j;
+
+  for(j = 0; j < 8; j++)
+    out[j] = 0;
+  while(passes-- > 0){
+    for(i = 0; i < n; i += 4){
+      for(j = 0; j < 4; j++){
+        out[j] += buf[i+j];
+        out[4+j] += out[j];
+      }
+    }
+  }
+}
+
+// Run in a child: checksum buf both ways and report.
+int
+check(int id, int passes)
+{
+  uint seed, want[8], got[8];
+  uint64 t0, t1, t2;
+  int i;
+
+  seed = 12345 + id * 7919;
+  for(i = 0; i < NWORD; i++){
+    seed = seed * 1103515245 + 12345;
+    buf[i] = seed;
+  }
+  t0 = rdtsc();
+  simdsum(buf, NWORD, passes, got);
+  t1 = rdtsc();
+  scalarsum(buf, NWORD, passes, want);
+  t2 = rdtsc();
+  printf(1, "simdtest %d: sse %d Mcycles, scalar %d Mcycles\n", id,
+         (uint)((t1 - t0) >> 20), (uint)((t2 - t1) >> 20));
+  for(i = 0; i < 8; i++)
+    if(got[i] != want[i])
+      return -1;
+  return 0;
+}
+
+// The child of a fork must start with its parent's %xmm7.
+int
+forkcheck(void)
+{
+  uint v[4] = { 0xdeadbeef, 1, 2, 3 }, w[4];
+  int fds[2], pid;
+  char c;
+
+  if(pipe(fds) < 0)
+    return -1;
+  asm volatile("movdqu (%0), %%xmm7" : : "r" (v) : "memory");
+  if((pid = fork()) == 0){
+    asm volatile("movdqu %%xmm7, (%0)" : : "r" (w) : "memory");
+    c = w[0] == v[0] && w[3] == v[3];
+    write(fds[1], &c, 1);
+    exit();
+  }
+  c = 0;
+  if(pid < 0 || read(fds[0], &c, 1) != 1)
+    c = 0;
+  close(fds[0]);
+  close(fds[1]);
+  wait();
+  return c ? 0 : -1;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int nproc, passes, fds[2], i, bad;
+  uint edx;
+  char c;
+
+  getcpuid(1, 0, 0, 0, &edx);
+  if((edx & CPUID_SSE2) == 0){
+    printf(1, "simdtest: no SSE2\n");
+    exit();
+  }
+  nproc = 4;
+  passes = 200;
+  if(argc > 1)
+    nproc = atoi(argv[1]);
+  if(argc > 2)
+    passes = atoi(argv[2]);
+  if(nproc < 1 || nproc > NPROCS)
+    nproc = 4;
+  if(passes < 1)
+    passes = 1;
+
+  bad = 0;
+  if(forkcheck() < 0){
+    printf(1, "simdtest: fork lost the parent's registers\n");
+    bad = 1;
+  }
+
+  if(pipe(fds) < 0){
+    printf(1, "simdtest: pipe failed\n");
+    exit();
+  }
+  for(i = 0; i < nproc; i++){
+    if(fork() == 0){
+      close(fds[0]);
+      c = check(i, passes) == 0;
+      write(fds[1], &c, 1);
+      exit();
+    }
+  }
+  close(fds[1]);
+  for(i = 0; i < nproc; i++){
+    if(read(fds[0], &c, 1) != 1 || !c){
+      printf(1, "simdtest: checksum mismatch\n");
+      bad = 1;
+    }
+  }
+  for(i = 0; i < nproc; i++)
+    wait();
+  if(!bad)
+    printf(1, "simdtest ok\n");
+  exit();
+}
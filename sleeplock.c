@@ -1,4 +1,17 @@
 // Sleeping locks
+//
+// Adaptive: the lock word is taken with xchg, and a process
+// that finds the lock held spins for it as long as the holder
+// is running on another CPU, since inode and buffer locks are
+// mostly held for short stretches that end sooner than a
+// sleep and wakeup would.  Only if the holder is not running,
+// or for more than SLSPIN tries, does it sleep.
+//
+// A waiter counts itself in nwait under lk before its last
+// try at the lock word, and a releaser looks at nwait after
+// clearing the lock word.  Both use locked instructions, so
+// either the waiter gets the lock or the releaser sees it
+// waiting, and takes lk to wake it.
 
 #include "types.h"
 #include "defs.h"
@@ -6,9 +19,12 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
-#include "proc.h"
 #include "spinlock.h"
+#include "proc.h"
 #include "sleeplock.h"
+#include "lockstat.h"
+
+#define SLSPIN 20000
 
 void
 initsleeplock(struct sleeplock *lk, char *name)
@@ -16,40 +32,61 @@ initsleeplock(struct sleeplock *lk, char *name)
   initlock(&lk->lk, "sleep lock");
   lk->name = name;
   lk->locked = 0;
+  lk->owner = 0;
+  lk->nwait = 0;
+  lk->class = lockclass(name);
   lk->pid = 0;
 }
 
 void
 acquiresleep(struct sleeplock *lk)
 {
+  struct proc *p = myproc(), *o;
+  int n;
+
+  for(n = 0; n < SLSPIN; n++){
+    if(lk->locked == 0 && xchg(&lk->locked, 1) == 0){
+      if(n > 0)
+        sleeplockstat(lk->class, SL_SPIN);
+      goto locked;
+    }
+    if((o = lk->owner) != 0 && o->state != RUNNING)
+      break;
+    pause();
+  }
+
   acquire(&lk->lk);
-  while (lk->locked) {
+  lk->nwait++;
+  while(xchg(&lk->locked, 1) != 0){
+    sleeplockstat(lk->class, SL_SLEEP);
     sleep(lk, &lk->lk);
   }
-  lk->locked = 1;
-  lk->pid = myproc()->pid;
+  lk->nwait--;
   release(&lk->lk);
+
+locked:
+  lk->owner = p;
+  lk->pid = p->pid;
 }
 
 void
 releasesleep(struct sleeplock *lk)
 {
-  acquire(&lk->lk);
-  lk->locked = 0;
+  lk->owner = 0;
   lk->pid = 0;
-  wakeup(lk);
-  release(&lk->lk);
+  xchg(&lk->locked, 0);
+  if(lk->nwait){
+    acquire(&lk->lk);
+    wakeup(lk);
+    release(&lk->lk);
+    sleeplockstat(lk->class, SL_HANDOFF);
+  }
 }
 
 int
 holdingsleep(struct sleeplock *lk)
 {
-  int r;
-  
-  acquire(&lk->lk);
-  r = lk->locked && (lk->pid == myproc()->pid);
-  release(&lk->lk);
-  return r;
+  return lk->locked && lk->owner == myproc();
 }
 
 
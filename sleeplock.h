@@ -1,7 +1,10 @@
 // Long-term locks for processes
 struct sleeplock {
-  uint locked;       // Is the lock held?
-  struct spinlock lk; // spinlock protecting this sleep lock
+  volatile uint locked; // Is the lock held?
+  struct proc *volatile owner; // Process holding lock, 0 just after taking it
+  int nwait;         // Processes asleep on it, or about to be
+  struct spinlock lk; // spinlock protecting the sleep
+  int class;         // Statistics entry; see lockstat()
   
   // For debugging:
   char *name;        // Name of lock.
@@ -6,15 +6,119 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
-#include "proc.h"
 #include "spinlock.h"
+#include "proc.h"
+#include "lockstat.h"
+
+// Statistics are kept per lock name, so that, say, all the
+// proc locks count together, and per CPU, so that counting
+// needs no atomic instructions and no shared cache lines.
+// Entry 0 takes the names that do not fit.
+static char *lockname[NLOCKSTAT] = { "(other)" };
+static int nlockname = 1;
+static struct lockcount {
+  uint nacquire;
+  uint ncontend;
+  uint64 spin;
+  uint nsl[3];         // sleep lock events, by SL_*
+} lockcount[NCPU][NLOCKSTAT];
+
+// The lock profiler.  While it is on, acquisitions are also
+// charged, with their wait and hold times, to the lock name
+// and the PC acquire() was called from: in a small hash
+// table per CPU, which is where the lock is released too.
+// Pairs that find no room within NPROBE slots are dropped.
+#define NPROBE     8
+static struct profent {
+  uint pc;             // 0 if the slot is free
+  int class;
+  uint nacquire;
+  uint ncontend;
+  uint64 wait;
+  uint64 hold;
+} lockprof[NCPU][NLOCKPROF];
+static volatile int lockprofon;
+
+// The statistics entry for name, added if new.  Two CPUs
+// adding the same name at once may make two entries, which
+// lockstat() adds up.  Takes no locks: it runs before the
+// CPU is set up enough to take one.
+int
+lockclass(char *name)
+{
+  int i, n;
+
+  n = nlockname;
+  for(i = 1; i < n && i < NLOCKSTAT; i++)
+    if(lockname[i] && strncmp(lockname[i], name, sizeof(((struct lockstat*)0)->name)) == 0)
+      return i;
+  if((i = __sync_fetch_and_add(&nlockname, 1)) >= NLOCKSTAT)
+    return 0;
+  lockname[i] = name;
+  return i;
+}
 
 void
 initlock(struct spinlock *lk, char *name)
 {
   lk->name = name;
-  lk->locked = 0;
+  lk->next = 0;
+  lk->owner = 0;
   lk->cpu = 0;
+  lk->class = lockclass(name);
+}
+
+// The profile slot for lk and the PC it was acquired from,
+// on CPU c, or 0 if there is no room.
+static struct profent*
+profslot(struct cpu *c, struct spinlock *lk)
+{
+  struct profent *e;
+  uint h, i;
+
+  h = (lk->pcs[0] ^ lk->class) * 2654435761U;
+  for(i = 0; i < NPROBE; i++){
+    e = &lockprof[c - cpus][(h + i) % NLOCKPROF];
+    if(e->pc == lk->pcs[0] && e->class == lk->class)
+      return e;
+    if(e->pc == 0){
+      e->pc = lk->pcs[0];
+      e->class = lk->class;
+      return e;
+    }
+  }
+  return 0;
+}
+
+// Count an acquisition of lk, just made by this CPU after
+// waiting since t0, or at once if t0 is 0.
+static void
+charge(struct spinlock *lk, uint64 t0)
+{
+  struct lockcount *lc;
+  struct profent *e;
+  uint64 now;
+
+  now = 0;
+  lc = &lockcount[lk->cpu - cpus][lk->class];
+  lc->nacquire++;
+  if(t0){
+    now = rdtsc();
+    lc->ncontend++;
+    lc->spin += now - t0;
+  }
+  if(!lockprofon)
+    return;
+  if(now == 0)
+    now = rdtsc();
+  lk->held = now;
+  if((lk->prof = e = profslot(lk->cpu, lk)) != 0){
+    e->nacquire++;
+    if(t0){
+      e->ncontend++;
+      e->wait += now - t0;
+    }
+  }
 }
 
 // Acquire the lock.
@@ -24,13 +128,26 @@ initlock(struct spinlock *lk, char *name)
 void
 acquire(struct spinlock *lk)
 {
+  uint ticket;
+  uint64 t0;
+
   pushcli(); // disable interrupts to avoid deadlock.
   if(holding(lk))
     panic("acquire");
 
-  // The xchg is atomic.
-  while(xchg(&lk->locked, 1) != 0)
-    ;
+  // Take a ticket and wait for it to be served.  The fetch
+  // and add is atomic.  Interrupts are off while spinning,
+  // so answer TLB shootdowns here; the holder may be waiting
+  // for one.
+  ticket = __sync_fetch_and_add(&lk->next, 1);
+  t0 = 0;
+  if(lk->owner != ticket){
+    t0 = rdtsc();
+    while(lk->owner != ticket){
+      tlbpoll();
+      pause();
+    }
+  }
 
   // Tell the C compiler and the processor to not move loads or stores
   // past this point, to ensure that the critical section's memory
@@ -40,6 +157,30 @@ acquire(struct spinlock *lk)
   // Record info about lock acquisition for debugging.
   lk->cpu = mycpu();
   getcallerpcs(&lk, lk->pcs);
+  charge(lk, t0);
+}
+
+// Acquire the lock if it is free, without spinning.
+// Returns 1 if it was acquired.
+int
+tryacquire(struct spinlock *lk)
+{
+  uint ticket;
+
+  pushcli();
+  if(holding(lk))
+    panic("tryacquire");
+  ticket = lk->owner;
+  if(lk->next != ticket ||
+     __sync_val_compare_and_swap(&lk->next, ticket, ticket + 1) != ticket){
+    popcli();
+    return 0;
+  }
+  __sync_synchronize();
+  lk->cpu = mycpu();
+  getcallerpcs(&lk, lk->pcs);
+  charge(lk, 0);
+  return 1;
 }
 
 // Release the lock.
@@ -49,6 +190,10 @@ release(struct spinlock *lk)
   if(!holding(lk))
     panic("release");
 
+  if(lk->prof){
+    lk->prof->hold += rdtsc() - lk->held;
+    lk->prof = 0;
+  }
   lk->pcs[0] = 0;
   lk->cpu = 0;
 
@@ -59,14 +204,122 @@ release(struct spinlock *lk)
   // stores; __sync_synchronize() tells them both not to.
   __sync_synchronize();
 
-  // Release the lock, equivalent to lk->locked = 0.
-  // This code can't use a C assignment, since it might
-  // not be atomic. A real OS would use C atomics here.
-  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+  // Serve the next ticket.  Only the holder writes owner,
+  // so this need not be atomic.
+  lk->owner++;
+
+  popcli();
+}
+
+// Fill in up to n struct lockstat, one per lock name, summed
+// over CPUs.  Returns how many were filled in.
+int
+lockstat(struct lockstat *st, int n)
+{
+  struct lockcount *lc;
+  int i, j, m, k, c;
+
+  k = nlockname;
+  if(k > NLOCKSTAT)
+    k = NLOCKSTAT;
+  m = 0;
+  for(i = 0; i < k; i++){
+    if(lockname[i] == 0)
+      continue;
+    for(j = 0; j < m; j++)
+      if(strncmp(st[j].name, lockname[i], sizeof(st[j].name)) == 0)
+        break;
+    if(j == m){
+      if(m == n)
+        continue;
+      safestrcpy(st[m].name, lockname[i], sizeof(st[m].name));
+      st[m].nacquire = st[m].ncontend = 0;
+      st[m].spin = 0;
+      st[m].nspin = st[m].nsleep = st[m].nhandoff = 0;
+      m++;
+    }
+    for(c = 0; c < ncpu; c++){
+      lc = &lockcount[c][i];
+      st[j].nacquire += lc->nacquire;
+      st[j].ncontend += lc->ncontend;
+      st[j].spin += lc->spin;
+      st[j].nspin += lc->nsl[SL_SPIN];
+      st[j].nsleep += lc->nsl[SL_SLEEP];
+      st[j].nhandoff += lc->nsl[SL_HANDOFF];
+    }
+  }
+  return m;
+}
 
+// Count a sleep lock event (SL_*) against lock class class.
+void
+sleeplockstat(int class, int ev)
+{
+  pushcli();
+  lockcount[mycpu() - cpus][class].nsl[ev]++;
   popcli();
 }
 
+// Start (clearing what was there) or stop the lock profiler,
+// or fill in up to n struct lockprof from it, most time spent
+// waiting first.  Returns how many were filled in, or 0.
+int
+lockprofile(int cmd, struct lockprof *lp, int n)
+{
+  struct profent *e;
+  struct lockprof t;
+  int c, i, j, m;
+
+  switch(cmd){
+  case LOCKPROF_START:
+    lockprofon = 0;
+    memset(lockprof, 0, sizeof(lockprof));
+    lockprofon = 1;
+    return 0;
+  case LOCKPROF_STOP:
+    lockprofon = 0;
+    return 0;
+  case LOCKPROF_READ:
+    break;
+  default:
+    return -1;
+  }
+
+  m = 0;
+  for(c = 0; c < ncpu; c++){
+    for(e = lockprof[c]; e < &lockprof[c][NLOCKPROF]; e++){
+      if(e->pc == 0 || e->class < 0 || e->class >= NLOCKSTAT)
+        continue;
+      for(j = 0; j < m; j++)
+        if(lp[j].pc == e->pc &&
+           strncmp(lp[j].name, lockname[e->class], sizeof(lp[j].name)) == 0)
+          break;
+      if(j == m){
+        if(m == n)
+          continue;
+        safestrcpy(lp[m].name, lockname[e->class], sizeof(lp[m].name));
+        lp[m].pc = e->pc;
+        lp[m].nacquire = lp[m].ncontend = 0;
+        lp[m].wait = lp[m].hold = 0;
+        m++;
+      }
+      lp[j].nacquire += e->nacquire;
+      lp[j].ncontend += e->ncontend;
+      lp[j].wait += e->wait;
+      lp[j].hold += e->hold;
+    }
+  }
+
+  // Insertion sort, by wait time.
+  for(i = 1; i < m; i++){
+    t = lp[i];
+    for(j = i; j > 0 && lp[j-1].wait < t.wait; j--)
+      lp[j] = lp[j-1];
+    lp[j] = t;
+  }
+  return m;
+}
+
 // Record the current call stack in pcs[] by following the %ebp chain.
 void
 getcallerpcs(void *v, uint pcs[])
@@ -91,7 +344,7 @@ holding(struct spinlock *lock)
 {
   int r;
   pushcli();
-  r = lock->locked && lock->cpu == mycpu();
+  r = lock->owner != lock->next && lock->cpu == mycpu();
   popcli();
   return r;
 }
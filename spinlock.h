@@ -1,6 +1,11 @@
-// Mutual exclusion lock.
+// Mutual exclusion lock.  A ticket lock: CPUs get it in the
+// order they asked for it, and waiters only read the lock.
 struct spinlock {
-  uint locked;       // Is the lock held?
+  volatile uint next;  // Next ticket to hand out
+  volatile uint owner; // Ticket now served; == next if free
+  int class;           // Statistics entry; see lockstat()
+  struct profent *prof;// Lock profile slot to charge hold time to
+  uint64 held;         // TSC when acquired, while profiling
 
   // For debugging:
   char *name;        // Name of lock.
@@ -0,0 +1,1643 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+   7:	b8 30 00 00 00       	mov    $0x30,%eax
+{
+   c:	ff 71 fc             	push   -0x4(%ecx)
+   f:	55                   	push   %ebp
+  10:	89 e5                	mov    %esp,%ebp
+  12:	57                   	push   %edi
+  13:	56                   	push   %esi
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  memset(data, 'a', sizeof(data));
+  14:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+{
+  1a:	53                   	push   %ebx
+
+  for(i = 0; i < 4; i++)
+  1b:	31 db                	xor    %ebx,%ebx
+{
+  1d:	51                   	push   %ecx
+  1e:	81 ec 20 02 00 00    	sub    $0x220,%esp
+  char path[] = "stressfs0";
+  24:	66 89 85 e6 fd ff ff 	mov    %ax,-0x21a(%ebp)
+  2b:	c7 85 de fd ff ff 73 	movl   $0x65727473,-0x222(%ebp)
+  32:	74 72 65 
+  35:	c7 85 e2 fd ff ff 73 	movl   $0x73667373,-0x21e(%ebp)
+  3c:	73 66 73 
+  printf(1, "stressfs starting\n");
+  3f:	68 e8 0a 00 00       	push   $0xae8
+  44:	6a 01                	push   $0x1
+  46:	e8 75 07 00 00       	call   7c0 <printf>
+  memset(data, 'a', sizeof(data));
+  4b:	83 c4 0c             	add    $0xc,%esp
+  4e:	68 00 02 00 00       	push   $0x200
+  53:	6a 61                	push   $0x61
+  55:	56                   	push   %esi
+  56:	e8 85 01 00 00       	call   1e0 <memset>
+  5b:	83 c4 10             	add    $0x10,%esp
+    if(fork() > 0)
+  5e:	e8 ce 04 00 00       	call   531 <fork>
+  63:	85 c0                	test   %eax,%eax
+  65:	7f 08                	jg     6f <main+0x6f>
+  for(i = 0; i < 4; i++)
+  67:	83 c3 01             	add    $0x1,%ebx
+  6a:	83 fb 04             	cmp    $0x4,%ebx
+  6d:	75 ef                	jne    5e <main+0x5e>
+      break;
+
+  printf(1, "write %d\n", i);
+  6f:	83 ec 04             	sub    $0x4,%esp
+  72:	53                   	push   %ebx
+  73:	68 fb 0a 00 00       	push   $0xafb
+  78:	6a 01                	push   $0x1
+  7a:	e8 41 07 00 00       	call   7c0 <printf>
+
+  path[8] += i;
+  7f:	00 9d e6 fd ff ff    	add    %bl,-0x21a(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+  85:	5f                   	pop    %edi
+  86:	bb 14 00 00 00       	mov    $0x14,%ebx
+  8b:	58                   	pop    %eax
+  8c:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  92:	68 02 02 00 00       	push   $0x202
+  97:	50                   	push   %eax
+  98:	e8 f7 04 00 00       	call   594 <open>
+  9d:	83 c4 10             	add    $0x10,%esp
+  a0:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < 20; i++)
+  a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  a8:	83 ec 04             	sub    $0x4,%esp
+  ab:	68 00 02 00 00       	push   $0x200
+  b0:	56                   	push   %esi
+  b1:	57                   	push   %edi
+  b2:	e8 b1 04 00 00       	call   568 <write>
+  for(i = 0; i < 20; i++)
+  b7:	83 c4 10             	add    $0x10,%esp
+  ba:	83 eb 01             	sub    $0x1,%ebx
+  bd:	75 e9                	jne    a8 <main+0xa8>
+  close(fd);
+  bf:	83 ec 0c             	sub    $0xc,%esp
+  c2:	57                   	push   %edi
+  c3:	e8 ab 04 00 00       	call   573 <close>
+
+  printf(1, "read\n");
+  c8:	58                   	pop    %eax
+  c9:	5a                   	pop    %edx
+  ca:	68 05 0b 00 00       	push   $0xb05
+  cf:	6a 01                	push   $0x1
+  d1:	e8 ea 06 00 00       	call   7c0 <printf>
+
+  fd = open(path, O_RDONLY);
+  d6:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  dc:	59                   	pop    %ecx
+  dd:	5b                   	pop    %ebx
+  de:	6a 00                	push   $0x0
+  e0:	bb 14 00 00 00       	mov    $0x14,%ebx
+  e5:	50                   	push   %eax
+  e6:	e8 a9 04 00 00       	call   594 <open>
+  eb:	83 c4 10             	add    $0x10,%esp
+  ee:	89 c7                	mov    %eax,%edi
+  for (i = 0; i < 20; i++)
+    read(fd, data, sizeof(data));
+  f0:	83 ec 04             	sub    $0x4,%esp
+  f3:	68 00 02 00 00       	push   $0x200
+  f8:	56                   	push   %esi
+  f9:	57                   	push   %edi
+  fa:	e8 5e 04 00 00       	call   55d <read>
+  for (i = 0; i < 20; i++)
+  ff:	83 c4 10             	add    $0x10,%esp
+ 102:	83 eb 01             	sub    $0x1,%ebx
+ 105:	75 e9                	jne    f0 <main+0xf0>
+  close(fd);
+ 107:	83 ec 0c             	sub    $0xc,%esp
+ 10a:	57                   	push   %edi
+ 10b:	e8 63 04 00 00       	call   573 <close>
+
+  wait();
+ 110:	e8 32 04 00 00       	call   547 <wait>
+
+  exit();
+ 115:	e8 22 04 00 00       	call   53c <exit>
+ 11a:	66 90                	xchg   %ax,%ax
+ 11c:	66 90                	xchg   %ax,%ax
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 120:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 121:	31 c0                	xor    %eax,%eax
+{
+ 123:	89 e5                	mov    %esp,%ebp
+ 125:	53                   	push   %ebx
+ 126:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 129:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 130:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 134:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 137:	83 c0 01             	add    $0x1,%eax
+ 13a:	84 d2                	test   %dl,%dl
+ 13c:	75 f2                	jne    130 <strcpy+0x10>
+    ;
+  return os;
+}
+ 13e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 141:	89 c8                	mov    %ecx,%eax
+ 143:	c9                   	leave
+ 144:	c3                   	ret
+ 145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	53                   	push   %ebx
+ 154:	8b 55 08             	mov    0x8(%ebp),%edx
+ 157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 15a:	0f b6 02             	movzbl (%edx),%eax
+ 15d:	84 c0                	test   %al,%al
+ 15f:	75 17                	jne    178 <strcmp+0x28>
+ 161:	eb 3a                	jmp    19d <strcmp+0x4d>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 16c:	83 c2 01             	add    $0x1,%edx
+ 16f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 172:	84 c0                	test   %al,%al
+ 174:	74 1a                	je     190 <strcmp+0x40>
+    p++, q++;
+ 176:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 178:	0f b6 19             	movzbl (%ecx),%ebx
+ 17b:	38 c3                	cmp    %al,%bl
+ 17d:	74 e9                	je     168 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 17f:	29 d8                	sub    %ebx,%eax
+}
+ 181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 184:	c9                   	leave
+ 185:	c3                   	ret
+ 186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 190:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 194:	31 c0                	xor    %eax,%eax
+ 196:	29 d8                	sub    %ebx,%eax
+}
+ 198:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 19b:	c9                   	leave
+ 19c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 19d:	0f b6 19             	movzbl (%ecx),%ebx
+ 1a0:	31 c0                	xor    %eax,%eax
+ 1a2:	eb db                	jmp    17f <strcmp+0x2f>
+ 1a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1af:	90                   	nop
+
+000001b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1b9:	74 15                	je     1d0 <strlen+0x20>
+ 1bb:	31 c0                	xor    %eax,%eax
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1c0:	83 c0 01             	add    $0x1,%eax
+ 1c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1c7:	89 c1                	mov    %eax,%ecx
+ 1c9:	75 f5                	jne    1c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1cb:	89 c8                	mov    %ecx,%eax
+ 1cd:	5d                   	pop    %ebp
+ 1ce:	c3                   	ret
+ 1cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1d0:	31 c9                	xor    %ecx,%ecx
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	89 c8                	mov    %ecx,%eax
+ 1d5:	c3                   	ret
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ed:	89 d7                	mov    %edx,%edi
+ 1ef:	fc                   	cld
+ 1f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1f5:	89 d0                	mov    %edx,%eax
+ 1f7:	c9                   	leave
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+ 206:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 20a:	0f b6 10             	movzbl (%eax),%edx
+ 20d:	84 d2                	test   %dl,%dl
+ 20f:	75 12                	jne    223 <strchr+0x23>
+ 211:	eb 1d                	jmp    230 <strchr+0x30>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 21c:	83 c0 01             	add    $0x1,%eax
+ 21f:	84 d2                	test   %dl,%dl
+ 221:	74 0d                	je     230 <strchr+0x30>
+    if(*s == c)
+ 223:	38 d1                	cmp    %dl,%cl
+ 225:	75 f1                	jne    218 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 227:	5d                   	pop    %ebp
+ 228:	c3                   	ret
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 230:	31 c0                	xor    %eax,%eax
+}
+ 232:	5d                   	pop    %ebp
+ 233:	c3                   	ret
+ 234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+
+00000240 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 245:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 248:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 249:	31 db                	xor    %ebx,%ebx
+{
+ 24b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 24e:	eb 27                	jmp    277 <gets+0x37>
+    cc = read(0, &c, 1);
+ 250:	83 ec 04             	sub    $0x4,%esp
+ 253:	6a 01                	push   $0x1
+ 255:	56                   	push   %esi
+ 256:	6a 00                	push   $0x0
+ 258:	e8 00 03 00 00       	call   55d <read>
+    if(cc < 1)
+ 25d:	83 c4 10             	add    $0x10,%esp
+ 260:	85 c0                	test   %eax,%eax
+ 262:	7e 1d                	jle    281 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 264:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 268:	8b 55 08             	mov    0x8(%ebp),%edx
+ 26b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 26f:	3c 0a                	cmp    $0xa,%al
+ 271:	74 10                	je     283 <gets+0x43>
+ 273:	3c 0d                	cmp    $0xd,%al
+ 275:	74 0c                	je     283 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 277:	89 df                	mov    %ebx,%edi
+ 279:	83 c3 01             	add    $0x1,%ebx
+ 27c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 27f:	7c cf                	jl     250 <gets+0x10>
+ 281:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 283:	8b 45 08             	mov    0x8(%ebp),%eax
+ 286:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 28a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 28d:	5b                   	pop    %ebx
+ 28e:	5e                   	pop    %esi
+ 28f:	5f                   	pop    %edi
+ 290:	5d                   	pop    %ebp
+ 291:	c3                   	ret
+ 292:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	56                   	push   %esi
+ 2a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2a5:	83 ec 08             	sub    $0x8,%esp
+ 2a8:	6a 00                	push   $0x0
+ 2aa:	ff 75 08             	push   0x8(%ebp)
+ 2ad:	e8 e2 02 00 00       	call   594 <open>
+  if(fd < 0)
+ 2b2:	83 c4 10             	add    $0x10,%esp
+ 2b5:	85 c0                	test   %eax,%eax
+ 2b7:	78 27                	js     2e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2b9:	83 ec 08             	sub    $0x8,%esp
+ 2bc:	ff 75 0c             	push   0xc(%ebp)
+ 2bf:	89 c3                	mov    %eax,%ebx
+ 2c1:	50                   	push   %eax
+ 2c2:	e8 ee 02 00 00       	call   5b5 <fstat>
+  close(fd);
+ 2c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2cc:	e8 a2 02 00 00       	call   573 <close>
+  return r;
+ 2d1:	83 c4 10             	add    $0x10,%esp
+}
+ 2d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2d7:	89 f0                	mov    %esi,%eax
+ 2d9:	5b                   	pop    %ebx
+ 2da:	5e                   	pop    %esi
+ 2db:	5d                   	pop    %ebp
+ 2dc:	c3                   	ret
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2e5:	eb ed                	jmp    2d4 <stat+0x34>
+ 2e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ee:	66 90                	xchg   %ax,%ax
+
+000002f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	53                   	push   %ebx
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2f7:	0f be 02             	movsbl (%edx),%eax
+ 2fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 300:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 305:	77 1e                	ja     325 <atoi+0x35>
+ 307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 310:	83 c2 01             	add    $0x1,%edx
+ 313:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 316:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 31a:	0f be 02             	movsbl (%edx),%eax
+ 31d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 320:	80 fb 09             	cmp    $0x9,%bl
+ 323:	76 eb                	jbe    310 <atoi+0x20>
+  return n;
+}
+ 325:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 328:	89 c8                	mov    %ecx,%eax
+ 32a:	c9                   	leave
+ 32b:	c3                   	ret
+ 32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	56                   	push   %esi
+ 335:	8b 45 10             	mov    0x10(%ebp),%eax
+ 338:	8b 55 08             	mov    0x8(%ebp),%edx
+ 33b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 33e:	85 c0                	test   %eax,%eax
+ 340:	7e 13                	jle    355 <memmove+0x25>
+ 342:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 344:	89 d7                	mov    %edx,%edi
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 350:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 351:	39 f8                	cmp    %edi,%eax
+ 353:	75 fb                	jne    350 <memmove+0x20>
+  return vdst;
+}
+ 355:	5e                   	pop    %esi
+ 356:	89 d0                	mov    %edx,%eax
+ 358:	5f                   	pop    %edi
+ 359:	5d                   	pop    %ebp
+ 35a:	c3                   	ret
+ 35b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 35f:	90                   	nop
+
+00000360 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 360:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 365:	85 c0                	test   %eax,%eax
+ 367:	74 07                	je     370 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 369:	c3                   	ret
+ 36a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 370:	e9 77 02 00 00       	jmp    5ec <sysgetpid>
+ 375:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000380 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 380:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 385:	c3                   	ret
+ 386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000390 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 390:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 391:	31 d2                	xor    %edx,%edx
+ 393:	89 e5                	mov    %esp,%ebp
+ 395:	53                   	push   %ebx
+ 396:	83 ec 04             	sub    $0x4,%esp
+ 399:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 39c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 39f:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 3a2:	85 c9                	test   %ecx,%ecx
+ 3a4:	7e 08                	jle    3ae <cyclereport+0x1e>
+ 3a6:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 3a8:	89 d8                	mov    %ebx,%eax
+ 3aa:	f7 f1                	div    %ecx
+ 3ac:	89 c2                	mov    %eax,%edx
+ 3ae:	83 ec 08             	sub    $0x8,%esp
+ 3b1:	52                   	push   %edx
+ 3b2:	ff 75 0c             	push   0xc(%ebp)
+ 3b5:	51                   	push   %ecx
+ 3b6:	ff 75 08             	push   0x8(%ebp)
+ 3b9:	68 0b 0b 00 00       	push   $0xb0b
+ 3be:	6a 01                	push   $0x1
+ 3c0:	e8 fb 03 00 00       	call   7c0 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 3c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c8:	83 c4 20             	add    $0x20,%esp
+ 3cb:	c9                   	leave
+ 3cc:	c3                   	ret
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003d0 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 3d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3dc:	5d                   	pop    %ebp
+ 3dd:	c3                   	ret
+ 3de:	66 90                	xchg   %ax,%ax
+
+000003e0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 3e0:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 3e1:	31 c0                	xor    %eax,%eax
+ 3e3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 3e8:	89 e5                	mov    %esp,%ebp
+ 3ea:	56                   	push   %esi
+ 3eb:	53                   	push   %ebx
+ 3ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 3ef:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 3f3:	85 c0                	test   %eax,%eax
+ 3f5:	74 30                	je     427 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 3f7:	83 f8 02             	cmp    $0x2,%eax
+ 3fa:	74 0c                	je     408 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 3fc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 401:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 404:	85 c0                	test   %eax,%eax
+ 406:	74 1f                	je     427 <mutex_lock+0x47>
+ 408:	be 02 00 00 00       	mov    $0x2,%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 410:	83 ec 08             	sub    $0x8,%esp
+ 413:	6a 02                	push   $0x2
+ 415:	53                   	push   %ebx
+ 416:	e8 8c 02 00 00       	call   6a7 <futex_wait>
+ 41b:	89 f0                	mov    %esi,%eax
+ 41d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 420:	83 c4 10             	add    $0x10,%esp
+ 423:	85 c0                	test   %eax,%eax
+ 425:	75 e9                	jne    410 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 427:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 42a:	5b                   	pop    %ebx
+ 42b:	5e                   	pop    %esi
+ 42c:	5d                   	pop    %ebp
+ 42d:	c3                   	ret
+ 42e:	66 90                	xchg   %ax,%ax
+
+00000430 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	83 ec 08             	sub    $0x8,%esp
+ 436:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 439:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 43d:	75 09                	jne    448 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 43f:	c9                   	leave
+ 440:	c3                   	ret
+ 441:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 448:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 44b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 451:	6a 01                	push   $0x1
+ 453:	50                   	push   %eax
+ 454:	e8 59 02 00 00       	call   6b2 <futex_wake>
+ 459:	83 c4 10             	add    $0x10,%esp
+}
+ 45c:	c9                   	leave
+ 45d:	c3                   	ret
+ 45e:	66 90                	xchg   %ax,%ax
+
+00000460 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 463:	8b 45 08             	mov    0x8(%ebp),%eax
+ 466:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 46c:	5d                   	pop    %ebp
+ 46d:	c3                   	ret
+ 46e:	66 90                	xchg   %ax,%ax
+
+00000470 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	56                   	push   %esi
+ 475:	53                   	push   %ebx
+ 476:	83 ec 0c             	sub    $0xc,%esp
+ 479:	8b 75 08             	mov    0x8(%ebp),%esi
+ 47c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 47f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 481:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 485:	75 21                	jne    4a8 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 487:	83 ec 08             	sub    $0x8,%esp
+ 48a:	57                   	push   %edi
+ 48b:	56                   	push   %esi
+ 48c:	e8 16 02 00 00       	call   6a7 <futex_wait>
+  mutex_lock(m);
+ 491:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 494:	83 c4 10             	add    $0x10,%esp
+}
+ 497:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 49a:	5b                   	pop    %ebx
+ 49b:	5e                   	pop    %esi
+ 49c:	5f                   	pop    %edi
+ 49d:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 49e:	e9 3d ff ff ff       	jmp    3e0 <mutex_lock>
+ 4a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4a7:	90                   	nop
+    futex_wake(&m->v, 1);
+ 4a8:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 4ab:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 4b1:	6a 01                	push   $0x1
+ 4b3:	53                   	push   %ebx
+ 4b4:	e8 f9 01 00 00       	call   6b2 <futex_wake>
+ 4b9:	83 c4 10             	add    $0x10,%esp
+ 4bc:	eb c9                	jmp    487 <cond_wait+0x17>
+ 4be:	66 90                	xchg   %ax,%ax
+
+000004c0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	83 ec 10             	sub    $0x10,%esp
+ 4c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 4c9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 4cd:	6a 01                	push   $0x1
+ 4cf:	50                   	push   %eax
+ 4d0:	e8 dd 01 00 00       	call   6b2 <futex_wake>
+}
+ 4d5:	83 c4 10             	add    $0x10,%esp
+ 4d8:	c9                   	leave
+ 4d9:	c3                   	ret
+ 4da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004e0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	83 ec 10             	sub    $0x10,%esp
+ 4e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 4e9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 4ed:	68 ff ff ff 7f       	push   $0x7fffffff
+ 4f2:	50                   	push   %eax
+ 4f3:	e8 ba 01 00 00       	call   6b2 <futex_wake>
+}
+ 4f8:	83 c4 10             	add    $0x10,%esp
+ 4fb:	c9                   	leave
+ 4fc:	c3                   	ret
+
+000004fd <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 4fd:	50                   	push   %eax
+  pushl %ebx
+ 4fe:	53                   	push   %ebx
+  movl $1, %eax
+ 4ff:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 504:	0f a2                	cpuid
+  popl %ebx
+ 506:	5b                   	pop    %ebx
+  popl %eax
+ 507:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 508:	c7 05 80 0f 00 00 2e 	movl   $0x52e,0xf80
+ 50f:	05 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 512:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 518:	74 14                	je     52e <sysint>
+  movl $sysfast, syscallvec
+ 51a:	c7 05 80 0f 00 00 24 	movl   $0x524,0xf80
+ 521:	05 00 00 
+
+00000524 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 524:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 526:	ba 2d 05 00 00       	mov    $0x52d,%edx
+  sysenter
+ 52b:	0f 34                	sysenter
+1:
+  ret
+ 52d:	c3                   	ret
+
+0000052e <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 52e:	cd 40                	int    $0x40
+  ret
+ 530:	c3                   	ret
+
+00000531 <fork>:
+
+SYSCALL(fork)
+ 531:	b8 01 00 00 00       	mov    $0x1,%eax
+ 536:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+0000053c <exit>:
+SYSCALL(exit)
+ 53c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 541:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+00000547 <wait>:
+SYSCALL(wait)
+ 547:	b8 03 00 00 00       	mov    $0x3,%eax
+ 54c:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+00000552 <pipe>:
+SYSCALL(pipe)
+ 552:	b8 04 00 00 00       	mov    $0x4,%eax
+ 557:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+0000055d <read>:
+SYSCALL(read)
+ 55d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 562:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+00000568 <write>:
+SYSCALL(write)
+ 568:	b8 10 00 00 00       	mov    $0x10,%eax
+ 56d:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+00000573 <close>:
+SYSCALL(close)
+ 573:	b8 15 00 00 00       	mov    $0x15,%eax
+ 578:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+0000057e <kill>:
+SYSCALL(kill)
+ 57e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 583:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+00000589 <exec>:
+SYSCALL(exec)
+ 589:	b8 07 00 00 00       	mov    $0x7,%eax
+ 58e:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+00000594 <open>:
+SYSCALL(open)
+ 594:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 599:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+0000059f <mknod>:
+SYSCALL(mknod)
+ 59f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5a4:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+000005aa <unlink>:
+SYSCALL(unlink)
+ 5aa:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5af:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+000005b5 <fstat>:
+SYSCALL(fstat)
+ 5b5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5ba:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+000005c0 <link>:
+SYSCALL(link)
+ 5c0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5c5:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+000005cb <mkdir>:
+SYSCALL(mkdir)
+ 5cb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5d0:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+000005d6 <chdir>:
+SYSCALL(chdir)
+ 5d6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5db:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+000005e1 <dup>:
+SYSCALL(dup)
+ 5e1:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5e6:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+000005ec <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 5ec:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5f1:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+000005f7 <sbrk>:
+SYSCALL(sbrk)
+ 5f7:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5fc:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+00000602 <sleep>:
+SYSCALL(sleep)
+ 602:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 607:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+0000060d <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 60d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 612:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+00000618 <swapread>:
+SYSCALL(swapread)
+ 618:	b8 16 00 00 00       	mov    $0x16,%eax
+ 61d:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+00000623 <swapwrite>:
+SYSCALL(swapwrite)
+ 623:	b8 17 00 00 00       	mov    $0x17,%eax
+ 628:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+0000062e <swapstat>:
+SYSCALL(swapstat)
+ 62e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 633:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+00000639 <madvise>:
+SYSCALL(madvise)
+ 639:	b8 19 00 00 00       	mov    $0x19,%eax
+ 63e:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+00000644 <mlock>:
+SYSCALL(mlock)
+ 644:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 649:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+0000064f <munlock>:
+SYSCALL(munlock)
+ 64f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 654:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+0000065a <membench>:
+SYSCALL(membench)
+ 65a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 65f:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+00000665 <nice>:
+SYSCALL(nice)
+ 665:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 66a:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+00000670 <setpriority>:
+SYSCALL(setpriority)
+ 670:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 675:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+0000067b <usleep>:
+SYSCALL(usleep)
+ 67b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 680:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+00000686 <cpustat>:
+SYSCALL(cpustat)
+ 686:	b8 20 00 00 00       	mov    $0x20,%eax
+ 68b:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+00000691 <clone>:
+SYSCALL(clone)
+ 691:	b8 21 00 00 00       	mov    $0x21,%eax
+ 696:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+0000069c <join>:
+SYSCALL(join)
+ 69c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6a1:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+000006a7 <futex_wait>:
+SYSCALL(futex_wait)
+ 6a7:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6ac:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+000006b2 <futex_wake>:
+SYSCALL(futex_wake)
+ 6b2:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6b7:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+000006bd <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 6bd:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6c2:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+000006c8 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 6c8:	b8 26 00 00 00       	mov    $0x26,%eax
+ 6cd:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+000006d3 <getcpu>:
+SYSCALL(getcpu)
+ 6d3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 6d8:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+000006de <migrations>:
+SYSCALL(migrations)
+ 6de:	b8 28 00 00 00       	mov    $0x28,%eax
+ 6e3:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+000006e9 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 6e9:	b8 29 00 00 00       	mov    $0x29,%eax
+ 6ee:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+000006f4 <lockstat>:
+SYSCALL(lockstat)
+ 6f4:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 6f9:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+000006ff <lockprof>:
+SYSCALL(lockprof)
+ 6ff:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 704:	ff 25 80 0f 00 00    	jmp    *0xf80
+
+0000070a <bcachestat>:
+SYSCALL(bcachestat)
+ 70a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 70f:	ff 25 80 0f 00 00    	jmp    *0xf80
+ 715:	66 90                	xchg   %ax,%ax
+ 717:	66 90                	xchg   %ax,%ax
+ 719:	66 90                	xchg   %ax,%ax
+ 71b:	66 90                	xchg   %ax,%ax
+ 71d:	66 90                	xchg   %ax,%ax
+ 71f:	90                   	nop
+
+00000720 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 720:	55                   	push   %ebp
+ 721:	89 e5                	mov    %esp,%ebp
+ 723:	57                   	push   %edi
+ 724:	56                   	push   %esi
+ 725:	53                   	push   %ebx
+ 726:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 728:	89 d1                	mov    %edx,%ecx
+{
+ 72a:	83 ec 3c             	sub    $0x3c,%esp
+ 72d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 730:	85 d2                	test   %edx,%edx
+ 732:	0f 89 80 00 00 00    	jns    7b8 <printint+0x98>
+ 738:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 73c:	74 7a                	je     7b8 <printint+0x98>
+    x = -xx;
+ 73e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 740:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 745:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 748:	31 f6                	xor    %esi,%esi
+ 74a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 750:	89 c8                	mov    %ecx,%eax
+ 752:	31 d2                	xor    %edx,%edx
+ 754:	89 f7                	mov    %esi,%edi
+ 756:	f7 f3                	div    %ebx
+ 758:	8d 76 01             	lea    0x1(%esi),%esi
+ 75b:	0f b6 92 88 0b 00 00 	movzbl 0xb88(%edx),%edx
+ 762:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 766:	89 ca                	mov    %ecx,%edx
+ 768:	89 c1                	mov    %eax,%ecx
+ 76a:	39 da                	cmp    %ebx,%edx
+ 76c:	73 e2                	jae    750 <printint+0x30>
+  if(neg)
+ 76e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 771:	85 c0                	test   %eax,%eax
+ 773:	74 07                	je     77c <printint+0x5c>
+    buf[i++] = '-';
+ 775:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 77a:	89 f7                	mov    %esi,%edi
+ 77c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 77f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 782:	01 df                	add    %ebx,%edi
+ 784:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 788:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 78b:	83 ec 04             	sub    $0x4,%esp
+ 78e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 791:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 794:	6a 01                	push   $0x1
+ 796:	50                   	push   %eax
+ 797:	56                   	push   %esi
+ 798:	e8 cb fd ff ff       	call   568 <write>
+  while(--i >= 0)
+ 79d:	89 f8                	mov    %edi,%eax
+ 79f:	83 c4 10             	add    $0x10,%esp
+ 7a2:	83 ef 01             	sub    $0x1,%edi
+ 7a5:	39 d8                	cmp    %ebx,%eax
+ 7a7:	75 df                	jne    788 <printint+0x68>
+}
+ 7a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7ac:	5b                   	pop    %ebx
+ 7ad:	5e                   	pop    %esi
+ 7ae:	5f                   	pop    %edi
+ 7af:	5d                   	pop    %ebp
+ 7b0:	c3                   	ret
+ 7b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7b8:	31 c0                	xor    %eax,%eax
+ 7ba:	eb 89                	jmp    745 <printint+0x25>
+ 7bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7c0:	55                   	push   %ebp
+ 7c1:	89 e5                	mov    %esp,%ebp
+ 7c3:	57                   	push   %edi
+ 7c4:	56                   	push   %esi
+ 7c5:	53                   	push   %ebx
+ 7c6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7cf:	0f b6 1e             	movzbl (%esi),%ebx
+ 7d2:	83 c6 01             	add    $0x1,%esi
+ 7d5:	84 db                	test   %bl,%bl
+ 7d7:	74 67                	je     840 <printf+0x80>
+ 7d9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7dc:	31 d2                	xor    %edx,%edx
+ 7de:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 7e1:	eb 34                	jmp    817 <printf+0x57>
+ 7e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7e7:	90                   	nop
+ 7e8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 7eb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 7f0:	83 f8 25             	cmp    $0x25,%eax
+ 7f3:	74 18                	je     80d <printf+0x4d>
+  write(fd, &c, 1);
+ 7f5:	83 ec 04             	sub    $0x4,%esp
+ 7f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7fb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7fe:	6a 01                	push   $0x1
+ 800:	50                   	push   %eax
+ 801:	57                   	push   %edi
+ 802:	e8 61 fd ff ff       	call   568 <write>
+ 807:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 80a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 80d:	0f b6 1e             	movzbl (%esi),%ebx
+ 810:	83 c6 01             	add    $0x1,%esi
+ 813:	84 db                	test   %bl,%bl
+ 815:	74 29                	je     840 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 817:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 81a:	85 d2                	test   %edx,%edx
+ 81c:	74 ca                	je     7e8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 81e:	83 fa 25             	cmp    $0x25,%edx
+ 821:	75 ea                	jne    80d <printf+0x4d>
+      if(c == 'd'){
+ 823:	83 f8 25             	cmp    $0x25,%eax
+ 826:	0f 84 24 01 00 00    	je     950 <printf+0x190>
+ 82c:	83 e8 63             	sub    $0x63,%eax
+ 82f:	83 f8 15             	cmp    $0x15,%eax
+ 832:	77 1c                	ja     850 <printf+0x90>
+ 834:	ff 24 85 30 0b 00 00 	jmp    *0xb30(,%eax,4)
+ 83b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 83f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 840:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 843:	5b                   	pop    %ebx
+ 844:	5e                   	pop    %esi
+ 845:	5f                   	pop    %edi
+ 846:	5d                   	pop    %ebp
+ 847:	c3                   	ret
+ 848:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84f:	90                   	nop
+  write(fd, &c, 1);
+ 850:	83 ec 04             	sub    $0x4,%esp
+ 853:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 856:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 85a:	6a 01                	push   $0x1
+ 85c:	52                   	push   %edx
+ 85d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 860:	57                   	push   %edi
+ 861:	e8 02 fd ff ff       	call   568 <write>
+ 866:	83 c4 0c             	add    $0xc,%esp
+ 869:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 86c:	6a 01                	push   $0x1
+ 86e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 871:	52                   	push   %edx
+ 872:	57                   	push   %edi
+ 873:	e8 f0 fc ff ff       	call   568 <write>
+        putc(fd, c);
+ 878:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 87b:	31 d2                	xor    %edx,%edx
+ 87d:	eb 8e                	jmp    80d <printf+0x4d>
+ 87f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 880:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 883:	83 ec 0c             	sub    $0xc,%esp
+ 886:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 88b:	8b 13                	mov    (%ebx),%edx
+ 88d:	6a 00                	push   $0x0
+ 88f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 891:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 894:	e8 87 fe ff ff       	call   720 <printint>
+        ap++;
+ 899:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 89c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 89f:	31 d2                	xor    %edx,%edx
+ 8a1:	e9 67 ff ff ff       	jmp    80d <printf+0x4d>
+ 8a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8b0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8b3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8b5:	83 c0 04             	add    $0x4,%eax
+ 8b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8bb:	85 db                	test   %ebx,%ebx
+ 8bd:	0f 84 9d 00 00 00    	je     960 <printf+0x1a0>
+        while(*s != 0){
+ 8c3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8c6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8c8:	84 c0                	test   %al,%al
+ 8ca:	0f 84 3d ff ff ff    	je     80d <printf+0x4d>
+ 8d0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8d3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 8d6:	89 de                	mov    %ebx,%esi
+ 8d8:	89 d3                	mov    %edx,%ebx
+ 8da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 8e0:	83 ec 04             	sub    $0x4,%esp
+ 8e3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 8e6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 8e9:	6a 01                	push   $0x1
+ 8eb:	53                   	push   %ebx
+ 8ec:	57                   	push   %edi
+ 8ed:	e8 76 fc ff ff       	call   568 <write>
+        while(*s != 0){
+ 8f2:	0f b6 06             	movzbl (%esi),%eax
+ 8f5:	83 c4 10             	add    $0x10,%esp
+ 8f8:	84 c0                	test   %al,%al
+ 8fa:	75 e4                	jne    8e0 <printf+0x120>
+      state = 0;
+ 8fc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 8ff:	31 d2                	xor    %edx,%edx
+ 901:	e9 07 ff ff ff       	jmp    80d <printf+0x4d>
+ 906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 910:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 913:	83 ec 0c             	sub    $0xc,%esp
+ 916:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 91b:	8b 13                	mov    (%ebx),%edx
+ 91d:	6a 01                	push   $0x1
+ 91f:	e9 6b ff ff ff       	jmp    88f <printf+0xcf>
+ 924:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 928:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 92b:	83 ec 04             	sub    $0x4,%esp
+ 92e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 931:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 933:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 936:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 939:	6a 01                	push   $0x1
+ 93b:	52                   	push   %edx
+ 93c:	57                   	push   %edi
+ 93d:	e8 26 fc ff ff       	call   568 <write>
+        ap++;
+ 942:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 945:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 948:	31 d2                	xor    %edx,%edx
+ 94a:	e9 be fe ff ff       	jmp    80d <printf+0x4d>
+ 94f:	90                   	nop
+  write(fd, &c, 1);
+ 950:	83 ec 04             	sub    $0x4,%esp
+ 953:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 956:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 959:	6a 01                	push   $0x1
+ 95b:	e9 11 ff ff ff       	jmp    871 <printf+0xb1>
+ 960:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 965:	bb 26 0b 00 00       	mov    $0xb26,%ebx
+ 96a:	e9 61 ff ff ff       	jmp    8d0 <printf+0x110>
+ 96f:	90                   	nop
+
+00000970 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 970:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 971:	a1 84 0f 00 00       	mov    0xf84,%eax
+{
+ 976:	89 e5                	mov    %esp,%ebp
+ 978:	57                   	push   %edi
+ 979:	56                   	push   %esi
+ 97a:	53                   	push   %ebx
+ 97b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 97e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 981:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 988:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 98a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 98c:	39 ca                	cmp    %ecx,%edx
+ 98e:	73 30                	jae    9c0 <free+0x50>
+ 990:	39 c1                	cmp    %eax,%ecx
+ 992:	72 04                	jb     998 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 994:	39 c2                	cmp    %eax,%edx
+ 996:	72 f0                	jb     988 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 998:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 99b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 99e:	39 f8                	cmp    %edi,%eax
+ 9a0:	74 2e                	je     9d0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9a2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 9a5:	8b 42 04             	mov    0x4(%edx),%eax
+ 9a8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9ab:	39 f1                	cmp    %esi,%ecx
+ 9ad:	74 38                	je     9e7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 9af:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 9b1:	5b                   	pop    %ebx
+  freep = p;
+ 9b2:	89 15 84 0f 00 00    	mov    %edx,0xf84
+}
+ 9b8:	5e                   	pop    %esi
+ 9b9:	5f                   	pop    %edi
+ 9ba:	5d                   	pop    %ebp
+ 9bb:	c3                   	ret
+ 9bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9c0:	39 c1                	cmp    %eax,%ecx
+ 9c2:	72 d0                	jb     994 <free+0x24>
+ 9c4:	eb c2                	jmp    988 <free+0x18>
+ 9c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9cd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 9d0:	03 70 04             	add    0x4(%eax),%esi
+ 9d3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9d6:	8b 02                	mov    (%edx),%eax
+ 9d8:	8b 00                	mov    (%eax),%eax
+ 9da:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 9dd:	8b 42 04             	mov    0x4(%edx),%eax
+ 9e0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9e3:	39 f1                	cmp    %esi,%ecx
+ 9e5:	75 c8                	jne    9af <free+0x3f>
+    p->s.size += bp->s.size;
+ 9e7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 9ea:	89 15 84 0f 00 00    	mov    %edx,0xf84
+    p->s.size += bp->s.size;
+ 9f0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 9f3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 9f6:	89 0a                	mov    %ecx,(%edx)
+}
+ 9f8:	5b                   	pop    %ebx
+ 9f9:	5e                   	pop    %esi
+ 9fa:	5f                   	pop    %edi
+ 9fb:	5d                   	pop    %ebp
+ 9fc:	c3                   	ret
+ 9fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a00 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a00:	55                   	push   %ebp
+ a01:	89 e5                	mov    %esp,%ebp
+ a03:	57                   	push   %edi
+ a04:	56                   	push   %esi
+ a05:	53                   	push   %ebx
+ a06:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a09:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a0c:	8b 15 84 0f 00 00    	mov    0xf84,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a12:	8d 78 07             	lea    0x7(%eax),%edi
+ a15:	c1 ef 03             	shr    $0x3,%edi
+ a18:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a1b:	85 d2                	test   %edx,%edx
+ a1d:	0f 84 8d 00 00 00    	je     ab0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a23:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a25:	8b 48 04             	mov    0x4(%eax),%ecx
+ a28:	39 f9                	cmp    %edi,%ecx
+ a2a:	73 64                	jae    a90 <malloc+0x90>
+  if(nu < 4096)
+ a2c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a31:	39 df                	cmp    %ebx,%edi
+ a33:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a36:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a3d:	eb 0a                	jmp    a49 <malloc+0x49>
+ a3f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a40:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a42:	8b 48 04             	mov    0x4(%eax),%ecx
+ a45:	39 f9                	cmp    %edi,%ecx
+ a47:	73 47                	jae    a90 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a49:	89 c2                	mov    %eax,%edx
+ a4b:	39 05 84 0f 00 00    	cmp    %eax,0xf84
+ a51:	75 ed                	jne    a40 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a53:	83 ec 0c             	sub    $0xc,%esp
+ a56:	56                   	push   %esi
+ a57:	e8 9b fb ff ff       	call   5f7 <sbrk>
+  if(p == (char*)-1)
+ a5c:	83 c4 10             	add    $0x10,%esp
+ a5f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a62:	74 1c                	je     a80 <malloc+0x80>
+  hp->s.size = nu;
+ a64:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a67:	83 ec 0c             	sub    $0xc,%esp
+ a6a:	83 c0 08             	add    $0x8,%eax
+ a6d:	50                   	push   %eax
+ a6e:	e8 fd fe ff ff       	call   970 <free>
+  return freep;
+ a73:	8b 15 84 0f 00 00    	mov    0xf84,%edx
+      if((p = morecore(nunits)) == 0)
+ a79:	83 c4 10             	add    $0x10,%esp
+ a7c:	85 d2                	test   %edx,%edx
+ a7e:	75 c0                	jne    a40 <malloc+0x40>
+        return 0;
+  }
+}
+ a80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a83:	31 c0                	xor    %eax,%eax
+}
+ a85:	5b                   	pop    %ebx
+ a86:	5e                   	pop    %esi
+ a87:	5f                   	pop    %edi
+ a88:	5d                   	pop    %ebp
+ a89:	c3                   	ret
+ a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a90:	39 cf                	cmp    %ecx,%edi
+ a92:	74 4c                	je     ae0 <malloc+0xe0>
+        p->s.size -= nunits;
+ a94:	29 f9                	sub    %edi,%ecx
+ a96:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a99:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a9c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a9f:	89 15 84 0f 00 00    	mov    %edx,0xf84
+}
+ aa5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ aa8:	83 c0 08             	add    $0x8,%eax
+}
+ aab:	5b                   	pop    %ebx
+ aac:	5e                   	pop    %esi
+ aad:	5f                   	pop    %edi
+ aae:	5d                   	pop    %ebp
+ aaf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ ab0:	c7 05 84 0f 00 00 88 	movl   $0xf88,0xf84
+ ab7:	0f 00 00 
+    base.s.size = 0;
+ aba:	b8 88 0f 00 00       	mov    $0xf88,%eax
+    base.s.ptr = freep = prevp = &base;
+ abf:	c7 05 88 0f 00 00 88 	movl   $0xf88,0xf88
+ ac6:	0f 00 00 
+    base.s.size = 0;
+ ac9:	c7 05 8c 0f 00 00 00 	movl   $0x0,0xf8c
+ ad0:	00 00 00 
+    if(p->s.size >= nunits){
+ ad3:	e9 54 ff ff ff       	jmp    a2c <malloc+0x2c>
+ ad8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ adf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ae0:	8b 08                	mov    (%eax),%ecx
+ ae2:	89 0a                	mov    %ecx,(%edx)
+ ae4:	eb b9                	jmp    a9f <malloc+0x9f>
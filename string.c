@@ -1,14 +1,41 @@
 #include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
 #include "x86.h"
 
+// Set by stringinit() if the CPU has SSE2, whose movnti lets
+// copy_page() and clear_page() write around the cache.
+static int nontemporal;
+
+void
+stringinit(void)
+{
+  uint edx;
+
+  getcpuid(1, 0, 0, 0, &edx);
+  nontemporal = (edx & CPUID_SSE2) != 0;
+}
+
 void*
 memset(void *dst, int c, uint n)
 {
-  if ((int)dst%4 == 0 && n%4 == 0){
-    c &= 0xFF;
-    stosl(dst, (c<<24)|(c<<16)|(c<<8)|c, n/4);
-  } else
-    stosb(dst, c, n);
+  char *d;
+  uint k;
+
+  d = dst;
+  c &= 0xFF;
+  if(n >= 16){
+    // Byte-fill up to a word boundary, then a word at a time.
+    k = -(uint)d & 3;
+    stosb(d, c, k);
+    d += k;
+    n -= k;
+    stosl(d, (c<<24)|(c<<16)|(c<<8)|c, n/4);
+    d += n & ~3;
+    n &= 3;
+  }
+  stosb(d, c, n);
   return dst;
 }
 
@@ -41,9 +68,12 @@ memmove(void *dst, const void *src, uint n)
     d += n;
     while(n-- > 0)
       *--d = *--s;
-  } else
-    while(n-- > 0)
-      *d++ = *s++;
+  } else {
+    // Forward copies are safe a word at a time even when
+    // dst is just below src.
+    movsl(d, s, n/4);
+    movsb(d + (n & ~3), s + (n & ~3), n & 3);
+  }
 
   return dst;
 }
@@ -103,3 +133,146 @@ strlen(const char *s)
   return n;
 }
 
+static void
+copy_page_nt(void *dst, const void *src)
+{
+  uint *d;
+  const uint *s;
+  int i;
+
+  d = dst;
+  s = src;
+  for(i = 0; i < PGSIZE/4; i += 4){
+    asm volatile("movnti %1, %0" : "=m" (d[i]) : "r" (s[i]));
+    asm volatile("movnti %1, %0" : "=m" (d[i+1]) : "r" (s[i+1]));
+    asm volatile("movnti %1, %0" : "=m" (d[i+2]) : "r" (s[i+2]));
+    asm volatile("movnti %1, %0" : "=m" (d[i+3]) : "r" (s[i+3]));
+  }
+  asm volatile("sfence" : : : "memory");
+}
+
+static void
+clear_page_nt(void *dst)
+{
+  uint *d;
+  int i;
+
+  d = dst;
+  for(i = 0; i < PGSIZE/4; i += 4){
+    asm volatile("movnti %1, %0" : "=m" (d[i]) : "r" (0));
+    asm volatile("movnti %1, %0" : "=m" (d[i+1]) : "r" (0));
+    asm volatile("movnti %1, %0" : "=m" (d[i+2]) : "r" (0));
+    asm volatile("movnti %1, %0" : "=m" (d[i+3]) : "r" (0));
+  }
+  asm volatile("sfence" : : : "memory");
+}
+
+// Copy a whole, page-aligned page.  Meant for pages the caller
+// will not read back soon (fork copies, fresh heap pages),
+// so when it can the copy bypasses the cache instead of evicting
+// the caller's working set.
+void
+copy_page(void *dst, const void *src)
+{
+  if(nontemporal)
+    copy_page_nt(dst, src);
+  else
+    movsl(dst, src, PGSIZE/4);
+}
+
+void
+clear_page(void *dst)
+{
+  if(nontemporal)
+    clear_page_nt(dst);
+  else
+    stosl(dst, 0, PGSIZE/4);
+}
+
+//PAGEBREAK!
+// Microbenchmark for the routines above, run by the membench
+// system call.  Prints bytes per TSC cycle for each of them.
+
+#define BENCHBYTES (4*1024*1024)
+
+// The byte-at-a-time copy memmove() used to be.
+static void
+copy_bytes(char *d, const char *s, uint n)
+{
+  while(n-- > 0)
+    *d++ = *s++;
+}
+
+static void
+benchreport(char *what, uint n, uint64 cycles)
+{
+  uint x;
+
+  if(cycles == 0)
+    cycles = 1;
+  x = BENCHBYTES * 100U / (uint)cycles;
+  cprintf("%s %d: %d.%d%d bytes/cycle\n", what, n, x/100, x/10%10, x%10);
+}
+
+int
+membench(void)
+{
+  static uint sizes[] = { 64, 512, PGSIZE };
+  char *a, *b;
+  uint64 t;
+  int i, j, iters;
+
+  if((a = kalloc()) == 0)
+    return -1;
+  if((b = kalloc()) == 0){
+    kfree(a);
+    return -1;
+  }
+  memset(a, 0x5a, PGSIZE);
+
+  pushcli();
+  for(i = 0; i < NELEM(sizes); i++){
+    iters = BENCHBYTES / sizes[i];
+    t = rdtsc();
+    for(j = 0; j < iters; j++)
+      copy_bytes(b, a, sizes[i]);
+    benchreport("byte copy", sizes[i], rdtsc() - t);
+    t = rdtsc();
+    for(j = 0; j < iters; j++)
+      memmove(b, a, sizes[i]);
+    benchreport("memmove", sizes[i], rdtsc() - t);
+    t = rdtsc();
+    for(j = 0; j < iters; j++)
+      memset(b, j, sizes[i]);
+    benchreport("memset", sizes[i], rdtsc() - t);
+  }
+
+  iters = BENCHBYTES / PGSIZE;
+  t = rdtsc();
+  for(j = 0; j < iters; j++)
+    movsl(b, a, PGSIZE/4);
+  benchreport("copy_page rep movsl", PGSIZE, rdtsc() - t);
+  t = rdtsc();
+  for(j = 0; j < iters; j++)
+    stosl(b, 0, PGSIZE/4);
+  benchreport("clear_page rep stosl", PGSIZE, rdtsc() - t);
+  if(nontemporal){
+    t = rdtsc();
+    for(j = 0; j < iters; j++)
+      copy_page_nt(b, a);
+    benchreport("copy_page movnti", PGSIZE, rdtsc() - t);
+    t = rdtsc();
+    for(j = 0; j < iters; j++)
+      clear_page_nt(b);
+    benchreport("clear_page movnti", PGSIZE, rdtsc() - t);
+  } else
+    cprintf("no SSE2: copy_page and clear_page use rep movsl/stosl\n");
+  popcli();
+
+  copy_page(b, a);
+  if(memcmp(a, b, PGSIZE) != 0)
+    panic("membench: copy_page");
+  kfree(a);
+  kfree(b);
+  return 0;
+}
@@ -0,0 +1,1541 @@
+
+_swaptest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "syscall.h"
+#include "traps.h"
+#include "memlayout.h"
+
+
+int main () {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+	int a, b;
+
+    swapstat(&a, &b);
+   e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+int main () {
+  11:	83 ec 1c             	sub    $0x1c,%esp
+    swapstat(&a, &b);
+  14:	50                   	push   %eax
+  15:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  18:	50                   	push   %eax
+  19:	e8 20 05 00 00       	call   53e <swapstat>
+}
+  1e:	8b 4d fc             	mov    -0x4(%ebp),%ecx
+  21:	31 c0                	xor    %eax,%eax
+  23:	c9                   	leave
+  24:	8d 61 fc             	lea    -0x4(%ecx),%esp
+  27:	c3                   	ret
+  28:	66 90                	xchg   %ax,%ax
+  2a:	66 90                	xchg   %ax,%ax
+  2c:	66 90                	xchg   %ax,%ax
+  2e:	66 90                	xchg   %ax,%ax
+
+00000030 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  30:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  31:	31 c0                	xor    %eax,%eax
+{
+  33:	89 e5                	mov    %esp,%ebp
+  35:	53                   	push   %ebx
+  36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  40:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  44:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  47:	83 c0 01             	add    $0x1,%eax
+  4a:	84 d2                	test   %dl,%dl
+  4c:	75 f2                	jne    40 <strcpy+0x10>
+    ;
+  return os;
+}
+  4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  51:	89 c8                	mov    %ecx,%eax
+  53:	c9                   	leave
+  54:	c3                   	ret
+  55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000060 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	53                   	push   %ebx
+  64:	8b 55 08             	mov    0x8(%ebp),%edx
+  67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  6a:	0f b6 02             	movzbl (%edx),%eax
+  6d:	84 c0                	test   %al,%al
+  6f:	75 17                	jne    88 <strcmp+0x28>
+  71:	eb 3a                	jmp    ad <strcmp+0x4d>
+  73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  77:	90                   	nop
+  78:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  7c:	83 c2 01             	add    $0x1,%edx
+  7f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  82:	84 c0                	test   %al,%al
+  84:	74 1a                	je     a0 <strcmp+0x40>
+    p++, q++;
+  86:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  88:	0f b6 19             	movzbl (%ecx),%ebx
+  8b:	38 c3                	cmp    %al,%bl
+  8d:	74 e9                	je     78 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  8f:	29 d8                	sub    %ebx,%eax
+}
+  91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  94:	c9                   	leave
+  95:	c3                   	ret
+  96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  a4:	31 c0                	xor    %eax,%eax
+  a6:	29 d8                	sub    %ebx,%eax
+}
+  a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  ab:	c9                   	leave
+  ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ad:	0f b6 19             	movzbl (%ecx),%ebx
+  b0:	31 c0                	xor    %eax,%eax
+  b2:	eb db                	jmp    8f <strcmp+0x2f>
+  b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  bf:	90                   	nop
+
+000000c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  c6:	80 3a 00             	cmpb   $0x0,(%edx)
+  c9:	74 15                	je     e0 <strlen+0x20>
+  cb:	31 c0                	xor    %eax,%eax
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  d0:	83 c0 01             	add    $0x1,%eax
+  d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  d7:	89 c1                	mov    %eax,%ecx
+  d9:	75 f5                	jne    d0 <strlen+0x10>
+    ;
+  return n;
+}
+  db:	89 c8                	mov    %ecx,%eax
+  dd:	5d                   	pop    %ebp
+  de:	c3                   	ret
+  df:	90                   	nop
+  for(n = 0; s[n]; n++)
+  e0:	31 c9                	xor    %ecx,%ecx
+}
+  e2:	5d                   	pop    %ebp
+  e3:	89 c8                	mov    %ecx,%eax
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	57                   	push   %edi
+  f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fd:	89 d7                	mov    %edx,%edi
+  ff:	fc                   	cld
+ 100:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 102:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 105:	89 d0                	mov    %edx,%eax
+ 107:	c9                   	leave
+ 108:	c3                   	ret
+ 109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000110 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 45 08             	mov    0x8(%ebp),%eax
+ 116:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 11a:	0f b6 10             	movzbl (%eax),%edx
+ 11d:	84 d2                	test   %dl,%dl
+ 11f:	75 12                	jne    133 <strchr+0x23>
+ 121:	eb 1d                	jmp    140 <strchr+0x30>
+ 123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 127:	90                   	nop
+ 128:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 12c:	83 c0 01             	add    $0x1,%eax
+ 12f:	84 d2                	test   %dl,%dl
+ 131:	74 0d                	je     140 <strchr+0x30>
+    if(*s == c)
+ 133:	38 d1                	cmp    %dl,%cl
+ 135:	75 f1                	jne    128 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 137:	5d                   	pop    %ebp
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 140:	31 c0                	xor    %eax,%eax
+}
+ 142:	5d                   	pop    %ebp
+ 143:	c3                   	ret
+ 144:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 14f:	90                   	nop
+
+00000150 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	57                   	push   %edi
+ 154:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 155:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 158:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 159:	31 db                	xor    %ebx,%ebx
+{
+ 15b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 15e:	eb 27                	jmp    187 <gets+0x37>
+    cc = read(0, &c, 1);
+ 160:	83 ec 04             	sub    $0x4,%esp
+ 163:	6a 01                	push   $0x1
+ 165:	56                   	push   %esi
+ 166:	6a 00                	push   $0x0
+ 168:	e8 00 03 00 00       	call   46d <read>
+    if(cc < 1)
+ 16d:	83 c4 10             	add    $0x10,%esp
+ 170:	85 c0                	test   %eax,%eax
+ 172:	7e 1d                	jle    191 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 174:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 178:	8b 55 08             	mov    0x8(%ebp),%edx
+ 17b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 17f:	3c 0a                	cmp    $0xa,%al
+ 181:	74 10                	je     193 <gets+0x43>
+ 183:	3c 0d                	cmp    $0xd,%al
+ 185:	74 0c                	je     193 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 187:	89 df                	mov    %ebx,%edi
+ 189:	83 c3 01             	add    $0x1,%ebx
+ 18c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 18f:	7c cf                	jl     160 <gets+0x10>
+ 191:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 193:	8b 45 08             	mov    0x8(%ebp),%eax
+ 196:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 19a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 19d:	5b                   	pop    %ebx
+ 19e:	5e                   	pop    %esi
+ 19f:	5f                   	pop    %edi
+ 1a0:	5d                   	pop    %ebp
+ 1a1:	c3                   	ret
+ 1a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	56                   	push   %esi
+ 1b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1b5:	83 ec 08             	sub    $0x8,%esp
+ 1b8:	6a 00                	push   $0x0
+ 1ba:	ff 75 08             	push   0x8(%ebp)
+ 1bd:	e8 e2 02 00 00       	call   4a4 <open>
+  if(fd < 0)
+ 1c2:	83 c4 10             	add    $0x10,%esp
+ 1c5:	85 c0                	test   %eax,%eax
+ 1c7:	78 27                	js     1f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1c9:	83 ec 08             	sub    $0x8,%esp
+ 1cc:	ff 75 0c             	push   0xc(%ebp)
+ 1cf:	89 c3                	mov    %eax,%ebx
+ 1d1:	50                   	push   %eax
+ 1d2:	e8 ee 02 00 00       	call   4c5 <fstat>
+  close(fd);
+ 1d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1dc:	e8 a2 02 00 00       	call   483 <close>
+  return r;
+ 1e1:	83 c4 10             	add    $0x10,%esp
+}
+ 1e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1e7:	89 f0                	mov    %esi,%eax
+ 1e9:	5b                   	pop    %ebx
+ 1ea:	5e                   	pop    %esi
+ 1eb:	5d                   	pop    %ebp
+ 1ec:	c3                   	ret
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 1f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1f5:	eb ed                	jmp    1e4 <stat+0x34>
+ 1f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fe:	66 90                	xchg   %ax,%ax
+
+00000200 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	53                   	push   %ebx
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 207:	0f be 02             	movsbl (%edx),%eax
+ 20a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 20d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 210:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 215:	77 1e                	ja     235 <atoi+0x35>
+ 217:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 220:	83 c2 01             	add    $0x1,%edx
+ 223:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 226:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 22a:	0f be 02             	movsbl (%edx),%eax
+ 22d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 230:	80 fb 09             	cmp    $0x9,%bl
+ 233:	76 eb                	jbe    220 <atoi+0x20>
+  return n;
+}
+ 235:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 238:	89 c8                	mov    %ecx,%eax
+ 23a:	c9                   	leave
+ 23b:	c3                   	ret
+ 23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+ 245:	8b 45 10             	mov    0x10(%ebp),%eax
+ 248:	8b 55 08             	mov    0x8(%ebp),%edx
+ 24b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 24e:	85 c0                	test   %eax,%eax
+ 250:	7e 13                	jle    265 <memmove+0x25>
+ 252:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 254:	89 d7                	mov    %edx,%edi
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 260:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 261:	39 f8                	cmp    %edi,%eax
+ 263:	75 fb                	jne    260 <memmove+0x20>
+  return vdst;
+}
+ 265:	5e                   	pop    %esi
+ 266:	89 d0                	mov    %edx,%eax
+ 268:	5f                   	pop    %edi
+ 269:	5d                   	pop    %ebp
+ 26a:	c3                   	ret
+ 26b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+
+00000270 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 270:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 275:	85 c0                	test   %eax,%eax
+ 277:	74 07                	je     280 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 279:	c3                   	ret
+ 27a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 280:	e9 77 02 00 00       	jmp    4fc <sysgetpid>
+ 285:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 290:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 295:	c3                   	ret
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002a0 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 2a0:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 2a1:	31 d2                	xor    %edx,%edx
+ 2a3:	89 e5                	mov    %esp,%ebp
+ 2a5:	53                   	push   %ebx
+ 2a6:	83 ec 04             	sub    $0x4,%esp
+ 2a9:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 2ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 2af:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 2b2:	85 c9                	test   %ecx,%ecx
+ 2b4:	7e 08                	jle    2be <cyclereport+0x1e>
+ 2b6:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 2b8:	89 d8                	mov    %ebx,%eax
+ 2ba:	f7 f1                	div    %ecx
+ 2bc:	89 c2                	mov    %eax,%edx
+ 2be:	83 ec 08             	sub    $0x8,%esp
+ 2c1:	52                   	push   %edx
+ 2c2:	ff 75 0c             	push   0xc(%ebp)
+ 2c5:	51                   	push   %ecx
+ 2c6:	ff 75 08             	push   0x8(%ebp)
+ 2c9:	68 f8 09 00 00       	push   $0x9f8
+ 2ce:	6a 01                	push   $0x1
+ 2d0:	e8 fb 03 00 00       	call   6d0 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 2d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2d8:	83 c4 20             	add    $0x20,%esp
+ 2db:	c9                   	leave
+ 2dc:	c3                   	ret
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002e0 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 2ec:	5d                   	pop    %ebp
+ 2ed:	c3                   	ret
+ 2ee:	66 90                	xchg   %ax,%ax
+
+000002f0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 2f0:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 2f1:	31 c0                	xor    %eax,%eax
+ 2f3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 2f8:	89 e5                	mov    %esp,%ebp
+ 2fa:	56                   	push   %esi
+ 2fb:	53                   	push   %ebx
+ 2fc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 2ff:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 303:	85 c0                	test   %eax,%eax
+ 305:	74 30                	je     337 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 307:	83 f8 02             	cmp    $0x2,%eax
+ 30a:	74 0c                	je     318 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 30c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 311:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 314:	85 c0                	test   %eax,%eax
+ 316:	74 1f                	je     337 <mutex_lock+0x47>
+ 318:	be 02 00 00 00       	mov    $0x2,%esi
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 320:	83 ec 08             	sub    $0x8,%esp
+ 323:	6a 02                	push   $0x2
+ 325:	53                   	push   %ebx
+ 326:	e8 8c 02 00 00       	call   5b7 <futex_wait>
+ 32b:	89 f0                	mov    %esi,%eax
+ 32d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 330:	83 c4 10             	add    $0x10,%esp
+ 333:	85 c0                	test   %eax,%eax
+ 335:	75 e9                	jne    320 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 337:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 33a:	5b                   	pop    %ebx
+ 33b:	5e                   	pop    %esi
+ 33c:	5d                   	pop    %ebp
+ 33d:	c3                   	ret
+ 33e:	66 90                	xchg   %ax,%ax
+
+00000340 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	83 ec 08             	sub    $0x8,%esp
+ 346:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 349:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 34d:	75 09                	jne    358 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 34f:	c9                   	leave
+ 350:	c3                   	ret
+ 351:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 358:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 35b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 361:	6a 01                	push   $0x1
+ 363:	50                   	push   %eax
+ 364:	e8 59 02 00 00       	call   5c2 <futex_wake>
+ 369:	83 c4 10             	add    $0x10,%esp
+}
+ 36c:	c9                   	leave
+ 36d:	c3                   	ret
+ 36e:	66 90                	xchg   %ax,%ax
+
+00000370 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 373:	8b 45 08             	mov    0x8(%ebp),%eax
+ 376:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 37c:	5d                   	pop    %ebp
+ 37d:	c3                   	ret
+ 37e:	66 90                	xchg   %ax,%ax
+
+00000380 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	57                   	push   %edi
+ 384:	56                   	push   %esi
+ 385:	53                   	push   %ebx
+ 386:	83 ec 0c             	sub    $0xc,%esp
+ 389:	8b 75 08             	mov    0x8(%ebp),%esi
+ 38c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 38f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 391:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 395:	75 21                	jne    3b8 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 397:	83 ec 08             	sub    $0x8,%esp
+ 39a:	57                   	push   %edi
+ 39b:	56                   	push   %esi
+ 39c:	e8 16 02 00 00       	call   5b7 <futex_wait>
+  mutex_lock(m);
+ 3a1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 3a4:	83 c4 10             	add    $0x10,%esp
+}
+ 3a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3aa:	5b                   	pop    %ebx
+ 3ab:	5e                   	pop    %esi
+ 3ac:	5f                   	pop    %edi
+ 3ad:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 3ae:	e9 3d ff ff ff       	jmp    2f0 <mutex_lock>
+ 3b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3b7:	90                   	nop
+    futex_wake(&m->v, 1);
+ 3b8:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 3bb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 3c1:	6a 01                	push   $0x1
+ 3c3:	53                   	push   %ebx
+ 3c4:	e8 f9 01 00 00       	call   5c2 <futex_wake>
+ 3c9:	83 c4 10             	add    $0x10,%esp
+ 3cc:	eb c9                	jmp    397 <cond_wait+0x17>
+ 3ce:	66 90                	xchg   %ax,%ax
+
+000003d0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	83 ec 10             	sub    $0x10,%esp
+ 3d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 3d9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 3dd:	6a 01                	push   $0x1
+ 3df:	50                   	push   %eax
+ 3e0:	e8 dd 01 00 00       	call   5c2 <futex_wake>
+}
+ 3e5:	83 c4 10             	add    $0x10,%esp
+ 3e8:	c9                   	leave
+ 3e9:	c3                   	ret
+ 3ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003f0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	83 ec 10             	sub    $0x10,%esp
+ 3f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 3f9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 3fd:	68 ff ff ff 7f       	push   $0x7fffffff
+ 402:	50                   	push   %eax
+ 403:	e8 ba 01 00 00       	call   5c2 <futex_wake>
+}
+ 408:	83 c4 10             	add    $0x10,%esp
+ 40b:	c9                   	leave
+ 40c:	c3                   	ret
+
+0000040d <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 40d:	50                   	push   %eax
+  pushl %ebx
+ 40e:	53                   	push   %ebx
+  movl $1, %eax
+ 40f:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 414:	0f a2                	cpuid
+  popl %ebx
+ 416:	5b                   	pop    %ebx
+  popl %eax
+ 417:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 418:	c7 05 64 0e 00 00 3e 	movl   $0x43e,0xe64
+ 41f:	04 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 422:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 428:	74 14                	je     43e <sysint>
+  movl $sysfast, syscallvec
+ 42a:	c7 05 64 0e 00 00 34 	movl   $0x434,0xe64
+ 431:	04 00 00 
+
+00000434 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 434:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 436:	ba 3d 04 00 00       	mov    $0x43d,%edx
+  sysenter
+ 43b:	0f 34                	sysenter
+1:
+  ret
+ 43d:	c3                   	ret
+
+0000043e <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 43e:	cd 40                	int    $0x40
+  ret
+ 440:	c3                   	ret
+
+00000441 <fork>:
+
+SYSCALL(fork)
+ 441:	b8 01 00 00 00       	mov    $0x1,%eax
+ 446:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+0000044c <exit>:
+SYSCALL(exit)
+ 44c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 451:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+00000457 <wait>:
+SYSCALL(wait)
+ 457:	b8 03 00 00 00       	mov    $0x3,%eax
+ 45c:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+00000462 <pipe>:
+SYSCALL(pipe)
+ 462:	b8 04 00 00 00       	mov    $0x4,%eax
+ 467:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+0000046d <read>:
+SYSCALL(read)
+ 46d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 472:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+00000478 <write>:
+SYSCALL(write)
+ 478:	b8 10 00 00 00       	mov    $0x10,%eax
+ 47d:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+00000483 <close>:
+SYSCALL(close)
+ 483:	b8 15 00 00 00       	mov    $0x15,%eax
+ 488:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+0000048e <kill>:
+SYSCALL(kill)
+ 48e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 493:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+00000499 <exec>:
+SYSCALL(exec)
+ 499:	b8 07 00 00 00       	mov    $0x7,%eax
+ 49e:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+000004a4 <open>:
+SYSCALL(open)
+ 4a4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4a9:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+000004af <mknod>:
+SYSCALL(mknod)
+ 4af:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4b4:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+000004ba <unlink>:
+SYSCALL(unlink)
+ 4ba:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4bf:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+000004c5 <fstat>:
+SYSCALL(fstat)
+ 4c5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4ca:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+000004d0 <link>:
+SYSCALL(link)
+ 4d0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4d5:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+000004db <mkdir>:
+SYSCALL(mkdir)
+ 4db:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4e0:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+000004e6 <chdir>:
+SYSCALL(chdir)
+ 4e6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4eb:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+000004f1 <dup>:
+SYSCALL(dup)
+ 4f1:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4f6:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+000004fc <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 4fc:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 501:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+00000507 <sbrk>:
+SYSCALL(sbrk)
+ 507:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 50c:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+00000512 <sleep>:
+SYSCALL(sleep)
+ 512:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 517:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+0000051d <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 51d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 522:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+00000528 <swapread>:
+SYSCALL(swapread)
+ 528:	b8 16 00 00 00       	mov    $0x16,%eax
+ 52d:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+00000533 <swapwrite>:
+SYSCALL(swapwrite)
+ 533:	b8 17 00 00 00       	mov    $0x17,%eax
+ 538:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+0000053e <swapstat>:
+SYSCALL(swapstat)
+ 53e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 543:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+00000549 <madvise>:
+SYSCALL(madvise)
+ 549:	b8 19 00 00 00       	mov    $0x19,%eax
+ 54e:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+00000554 <mlock>:
+SYSCALL(mlock)
+ 554:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 559:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+0000055f <munlock>:
+SYSCALL(munlock)
+ 55f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 564:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+0000056a <membench>:
+SYSCALL(membench)
+ 56a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 56f:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+00000575 <nice>:
+SYSCALL(nice)
+ 575:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 57a:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+00000580 <setpriority>:
+SYSCALL(setpriority)
+ 580:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 585:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+0000058b <usleep>:
+SYSCALL(usleep)
+ 58b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 590:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+00000596 <cpustat>:
+SYSCALL(cpustat)
+ 596:	b8 20 00 00 00       	mov    $0x20,%eax
+ 59b:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+000005a1 <clone>:
+SYSCALL(clone)
+ 5a1:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5a6:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+000005ac <join>:
+SYSCALL(join)
+ 5ac:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5b1:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+000005b7 <futex_wait>:
+SYSCALL(futex_wait)
+ 5b7:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5bc:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+000005c2 <futex_wake>:
+SYSCALL(futex_wake)
+ 5c2:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5c7:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+000005cd <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 5cd:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5d2:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+000005d8 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 5d8:	b8 26 00 00 00       	mov    $0x26,%eax
+ 5dd:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+000005e3 <getcpu>:
+SYSCALL(getcpu)
+ 5e3:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5e8:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+000005ee <migrations>:
+SYSCALL(migrations)
+ 5ee:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5f3:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+000005f9 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 5f9:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5fe:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+00000604 <lockstat>:
+SYSCALL(lockstat)
+ 604:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 609:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+0000060f <lockprof>:
+SYSCALL(lockprof)
+ 60f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 614:	ff 25 64 0e 00 00    	jmp    *0xe64
+
+0000061a <bcachestat>:
+SYSCALL(bcachestat)
+ 61a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 61f:	ff 25 64 0e 00 00    	jmp    *0xe64
+ 625:	66 90                	xchg   %ax,%ax
+ 627:	66 90                	xchg   %ax,%ax
+ 629:	66 90                	xchg   %ax,%ax
+ 62b:	66 90                	xchg   %ax,%ax
+ 62d:	66 90                	xchg   %ax,%ax
+ 62f:	90                   	nop
+
+00000630 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	57                   	push   %edi
+ 634:	56                   	push   %esi
+ 635:	53                   	push   %ebx
+ 636:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 638:	89 d1                	mov    %edx,%ecx
+{
+ 63a:	83 ec 3c             	sub    $0x3c,%esp
+ 63d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 640:	85 d2                	test   %edx,%edx
+ 642:	0f 89 80 00 00 00    	jns    6c8 <printint+0x98>
+ 648:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 64c:	74 7a                	je     6c8 <printint+0x98>
+    x = -xx;
+ 64e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 650:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 655:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 658:	31 f6                	xor    %esi,%esi
+ 65a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 660:	89 c8                	mov    %ecx,%eax
+ 662:	31 d2                	xor    %edx,%edx
+ 664:	89 f7                	mov    %esi,%edi
+ 666:	f7 f3                	div    %ebx
+ 668:	8d 76 01             	lea    0x1(%esi),%esi
+ 66b:	0f b6 92 74 0a 00 00 	movzbl 0xa74(%edx),%edx
+ 672:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 676:	89 ca                	mov    %ecx,%edx
+ 678:	89 c1                	mov    %eax,%ecx
+ 67a:	39 da                	cmp    %ebx,%edx
+ 67c:	73 e2                	jae    660 <printint+0x30>
+  if(neg)
+ 67e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 681:	85 c0                	test   %eax,%eax
+ 683:	74 07                	je     68c <printint+0x5c>
+    buf[i++] = '-';
+ 685:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 68a:	89 f7                	mov    %esi,%edi
+ 68c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 68f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 692:	01 df                	add    %ebx,%edi
+ 694:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 698:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 69b:	83 ec 04             	sub    $0x4,%esp
+ 69e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 6a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 6a4:	6a 01                	push   $0x1
+ 6a6:	50                   	push   %eax
+ 6a7:	56                   	push   %esi
+ 6a8:	e8 cb fd ff ff       	call   478 <write>
+  while(--i >= 0)
+ 6ad:	89 f8                	mov    %edi,%eax
+ 6af:	83 c4 10             	add    $0x10,%esp
+ 6b2:	83 ef 01             	sub    $0x1,%edi
+ 6b5:	39 d8                	cmp    %ebx,%eax
+ 6b7:	75 df                	jne    698 <printint+0x68>
+}
+ 6b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6bc:	5b                   	pop    %ebx
+ 6bd:	5e                   	pop    %esi
+ 6be:	5f                   	pop    %edi
+ 6bf:	5d                   	pop    %ebp
+ 6c0:	c3                   	ret
+ 6c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6c8:	31 c0                	xor    %eax,%eax
+ 6ca:	eb 89                	jmp    655 <printint+0x25>
+ 6cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	57                   	push   %edi
+ 6d4:	56                   	push   %esi
+ 6d5:	53                   	push   %ebx
+ 6d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 6dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 6df:	0f b6 1e             	movzbl (%esi),%ebx
+ 6e2:	83 c6 01             	add    $0x1,%esi
+ 6e5:	84 db                	test   %bl,%bl
+ 6e7:	74 67                	je     750 <printf+0x80>
+ 6e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 6ec:	31 d2                	xor    %edx,%edx
+ 6ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 6f1:	eb 34                	jmp    727 <printf+0x57>
+ 6f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6f7:	90                   	nop
+ 6f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 6fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 700:	83 f8 25             	cmp    $0x25,%eax
+ 703:	74 18                	je     71d <printf+0x4d>
+  write(fd, &c, 1);
+ 705:	83 ec 04             	sub    $0x4,%esp
+ 708:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 70b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 70e:	6a 01                	push   $0x1
+ 710:	50                   	push   %eax
+ 711:	57                   	push   %edi
+ 712:	e8 61 fd ff ff       	call   478 <write>
+ 717:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 71a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 71d:	0f b6 1e             	movzbl (%esi),%ebx
+ 720:	83 c6 01             	add    $0x1,%esi
+ 723:	84 db                	test   %bl,%bl
+ 725:	74 29                	je     750 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 727:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 72a:	85 d2                	test   %edx,%edx
+ 72c:	74 ca                	je     6f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 72e:	83 fa 25             	cmp    $0x25,%edx
+ 731:	75 ea                	jne    71d <printf+0x4d>
+      if(c == 'd'){
+ 733:	83 f8 25             	cmp    $0x25,%eax
+ 736:	0f 84 24 01 00 00    	je     860 <printf+0x190>
+ 73c:	83 e8 63             	sub    $0x63,%eax
+ 73f:	83 f8 15             	cmp    $0x15,%eax
+ 742:	77 1c                	ja     760 <printf+0x90>
+ 744:	ff 24 85 1c 0a 00 00 	jmp    *0xa1c(,%eax,4)
+ 74b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 74f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 750:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 753:	5b                   	pop    %ebx
+ 754:	5e                   	pop    %esi
+ 755:	5f                   	pop    %edi
+ 756:	5d                   	pop    %ebp
+ 757:	c3                   	ret
+ 758:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 75f:	90                   	nop
+  write(fd, &c, 1);
+ 760:	83 ec 04             	sub    $0x4,%esp
+ 763:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 766:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 76a:	6a 01                	push   $0x1
+ 76c:	52                   	push   %edx
+ 76d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 770:	57                   	push   %edi
+ 771:	e8 02 fd ff ff       	call   478 <write>
+ 776:	83 c4 0c             	add    $0xc,%esp
+ 779:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 77c:	6a 01                	push   $0x1
+ 77e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 781:	52                   	push   %edx
+ 782:	57                   	push   %edi
+ 783:	e8 f0 fc ff ff       	call   478 <write>
+        putc(fd, c);
+ 788:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 78b:	31 d2                	xor    %edx,%edx
+ 78d:	eb 8e                	jmp    71d <printf+0x4d>
+ 78f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 790:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 793:	83 ec 0c             	sub    $0xc,%esp
+ 796:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 79b:	8b 13                	mov    (%ebx),%edx
+ 79d:	6a 00                	push   $0x0
+ 79f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 7a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 7a4:	e8 87 fe ff ff       	call   630 <printint>
+        ap++;
+ 7a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7af:	31 d2                	xor    %edx,%edx
+ 7b1:	e9 67 ff ff ff       	jmp    71d <printf+0x4d>
+ 7b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7c5:	83 c0 04             	add    $0x4,%eax
+ 7c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7cb:	85 db                	test   %ebx,%ebx
+ 7cd:	0f 84 9d 00 00 00    	je     870 <printf+0x1a0>
+        while(*s != 0){
+ 7d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 7d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 7d8:	84 c0                	test   %al,%al
+ 7da:	0f 84 3d ff ff ff    	je     71d <printf+0x4d>
+ 7e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 7e6:	89 de                	mov    %ebx,%esi
+ 7e8:	89 d3                	mov    %edx,%ebx
+ 7ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 7f0:	83 ec 04             	sub    $0x4,%esp
+ 7f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 7f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7f9:	6a 01                	push   $0x1
+ 7fb:	53                   	push   %ebx
+ 7fc:	57                   	push   %edi
+ 7fd:	e8 76 fc ff ff       	call   478 <write>
+        while(*s != 0){
+ 802:	0f b6 06             	movzbl (%esi),%eax
+ 805:	83 c4 10             	add    $0x10,%esp
+ 808:	84 c0                	test   %al,%al
+ 80a:	75 e4                	jne    7f0 <printf+0x120>
+      state = 0;
+ 80c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 80f:	31 d2                	xor    %edx,%edx
+ 811:	e9 07 ff ff ff       	jmp    71d <printf+0x4d>
+ 816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 81d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 820:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 823:	83 ec 0c             	sub    $0xc,%esp
+ 826:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 82b:	8b 13                	mov    (%ebx),%edx
+ 82d:	6a 01                	push   $0x1
+ 82f:	e9 6b ff ff ff       	jmp    79f <printf+0xcf>
+ 834:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 838:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 83b:	83 ec 04             	sub    $0x4,%esp
+ 83e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 841:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 843:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 846:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 849:	6a 01                	push   $0x1
+ 84b:	52                   	push   %edx
+ 84c:	57                   	push   %edi
+ 84d:	e8 26 fc ff ff       	call   478 <write>
+        ap++;
+ 852:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 855:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 858:	31 d2                	xor    %edx,%edx
+ 85a:	e9 be fe ff ff       	jmp    71d <printf+0x4d>
+ 85f:	90                   	nop
+  write(fd, &c, 1);
+ 860:	83 ec 04             	sub    $0x4,%esp
+ 863:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 866:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 869:	6a 01                	push   $0x1
+ 86b:	e9 11 ff ff ff       	jmp    781 <printf+0xb1>
+ 870:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 875:	bb 13 0a 00 00       	mov    $0xa13,%ebx
+ 87a:	e9 61 ff ff ff       	jmp    7e0 <printf+0x110>
+ 87f:	90                   	nop
+
+00000880 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 880:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 881:	a1 68 0e 00 00       	mov    0xe68,%eax
+{
+ 886:	89 e5                	mov    %esp,%ebp
+ 888:	57                   	push   %edi
+ 889:	56                   	push   %esi
+ 88a:	53                   	push   %ebx
+ 88b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 88e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 891:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 898:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 89a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 89c:	39 ca                	cmp    %ecx,%edx
+ 89e:	73 30                	jae    8d0 <free+0x50>
+ 8a0:	39 c1                	cmp    %eax,%ecx
+ 8a2:	72 04                	jb     8a8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8a4:	39 c2                	cmp    %eax,%edx
+ 8a6:	72 f0                	jb     898 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8a8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 8ab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 8ae:	39 f8                	cmp    %edi,%eax
+ 8b0:	74 2e                	je     8e0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8b2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8b5:	8b 42 04             	mov    0x4(%edx),%eax
+ 8b8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8bb:	39 f1                	cmp    %esi,%ecx
+ 8bd:	74 38                	je     8f7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8bf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8c1:	5b                   	pop    %ebx
+  freep = p;
+ 8c2:	89 15 68 0e 00 00    	mov    %edx,0xe68
+}
+ 8c8:	5e                   	pop    %esi
+ 8c9:	5f                   	pop    %edi
+ 8ca:	5d                   	pop    %ebp
+ 8cb:	c3                   	ret
+ 8cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8d0:	39 c1                	cmp    %eax,%ecx
+ 8d2:	72 d0                	jb     8a4 <free+0x24>
+ 8d4:	eb c2                	jmp    898 <free+0x18>
+ 8d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 8e0:	03 70 04             	add    0x4(%eax),%esi
+ 8e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8e6:	8b 02                	mov    (%edx),%eax
+ 8e8:	8b 00                	mov    (%eax),%eax
+ 8ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 8ed:	8b 42 04             	mov    0x4(%edx),%eax
+ 8f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8f3:	39 f1                	cmp    %esi,%ecx
+ 8f5:	75 c8                	jne    8bf <free+0x3f>
+    p->s.size += bp->s.size;
+ 8f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 8fa:	89 15 68 0e 00 00    	mov    %edx,0xe68
+    p->s.size += bp->s.size;
+ 900:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 903:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 906:	89 0a                	mov    %ecx,(%edx)
+}
+ 908:	5b                   	pop    %ebx
+ 909:	5e                   	pop    %esi
+ 90a:	5f                   	pop    %edi
+ 90b:	5d                   	pop    %ebp
+ 90c:	c3                   	ret
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000910 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 910:	55                   	push   %ebp
+ 911:	89 e5                	mov    %esp,%ebp
+ 913:	57                   	push   %edi
+ 914:	56                   	push   %esi
+ 915:	53                   	push   %ebx
+ 916:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 919:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 91c:	8b 15 68 0e 00 00    	mov    0xe68,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 922:	8d 78 07             	lea    0x7(%eax),%edi
+ 925:	c1 ef 03             	shr    $0x3,%edi
+ 928:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 92b:	85 d2                	test   %edx,%edx
+ 92d:	0f 84 8d 00 00 00    	je     9c0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 933:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 935:	8b 48 04             	mov    0x4(%eax),%ecx
+ 938:	39 f9                	cmp    %edi,%ecx
+ 93a:	73 64                	jae    9a0 <malloc+0x90>
+  if(nu < 4096)
+ 93c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 941:	39 df                	cmp    %ebx,%edi
+ 943:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 946:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 94d:	eb 0a                	jmp    959 <malloc+0x49>
+ 94f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 950:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 952:	8b 48 04             	mov    0x4(%eax),%ecx
+ 955:	39 f9                	cmp    %edi,%ecx
+ 957:	73 47                	jae    9a0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 959:	89 c2                	mov    %eax,%edx
+ 95b:	39 05 68 0e 00 00    	cmp    %eax,0xe68
+ 961:	75 ed                	jne    950 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 963:	83 ec 0c             	sub    $0xc,%esp
+ 966:	56                   	push   %esi
+ 967:	e8 9b fb ff ff       	call   507 <sbrk>
+  if(p == (char*)-1)
+ 96c:	83 c4 10             	add    $0x10,%esp
+ 96f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 972:	74 1c                	je     990 <malloc+0x80>
+  hp->s.size = nu;
+ 974:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 977:	83 ec 0c             	sub    $0xc,%esp
+ 97a:	83 c0 08             	add    $0x8,%eax
+ 97d:	50                   	push   %eax
+ 97e:	e8 fd fe ff ff       	call   880 <free>
+  return freep;
+ 983:	8b 15 68 0e 00 00    	mov    0xe68,%edx
+      if((p = morecore(nunits)) == 0)
+ 989:	83 c4 10             	add    $0x10,%esp
+ 98c:	85 d2                	test   %edx,%edx
+ 98e:	75 c0                	jne    950 <malloc+0x40>
+        return 0;
+  }
+}
+ 990:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 993:	31 c0                	xor    %eax,%eax
+}
+ 995:	5b                   	pop    %ebx
+ 996:	5e                   	pop    %esi
+ 997:	5f                   	pop    %edi
+ 998:	5d                   	pop    %ebp
+ 999:	c3                   	ret
+ 99a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 9a0:	39 cf                	cmp    %ecx,%edi
+ 9a2:	74 4c                	je     9f0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 9a4:	29 f9                	sub    %edi,%ecx
+ 9a6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 9a9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 9ac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 9af:	89 15 68 0e 00 00    	mov    %edx,0xe68
+}
+ 9b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 9b8:	83 c0 08             	add    $0x8,%eax
+}
+ 9bb:	5b                   	pop    %ebx
+ 9bc:	5e                   	pop    %esi
+ 9bd:	5f                   	pop    %edi
+ 9be:	5d                   	pop    %ebp
+ 9bf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 9c0:	c7 05 68 0e 00 00 6c 	movl   $0xe6c,0xe68
+ 9c7:	0e 00 00 
+    base.s.size = 0;
+ 9ca:	b8 6c 0e 00 00       	mov    $0xe6c,%eax
+    base.s.ptr = freep = prevp = &base;
+ 9cf:	c7 05 6c 0e 00 00 6c 	movl   $0xe6c,0xe6c
+ 9d6:	0e 00 00 
+    base.s.size = 0;
+ 9d9:	c7 05 70 0e 00 00 00 	movl   $0x0,0xe70
+ 9e0:	00 00 00 
+    if(p->s.size >= nunits){
+ 9e3:	e9 54 ff ff ff       	jmp    93c <malloc+0x2c>
+ 9e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 9f0:	8b 08                	mov    (%eax),%ecx
+ 9f2:	89 0a                	mov    %ecx,(%edx)
+ 9f4:	eb b9                	jmp    9af <malloc+0x9f>
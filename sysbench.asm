@@ -0,0 +1,1713 @@
+
+_sysbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return pid;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  uint64 t;
+  int i, n;
+
+  n = 100000;
+  if(argc > 1)
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  17:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1)
+  1a:	0f 8f 43 01 00 00    	jg     163 <main+0x163>
+
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+  20:	0f 31                	rdtsc
+  22:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  n = 100000;
+  25:	bf a0 86 01 00       	mov    $0x186a0,%edi
+  2a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    n = atoi(argv[1]);
+  if(n < 1)
+    n = 1;
+
+  t = rdtsc();
+  for(i = 0; i < n; i++)
+  2d:	31 f6                	xor    %esi,%esi
+  2f:	90                   	nop
+    sysgetpid();
+  30:	e8 37 06 00 00       	call   66c <sysgetpid>
+  for(i = 0; i < n; i++)
+  35:	89 f3                	mov    %esi,%ebx
+  37:	83 c6 01             	add    $0x1,%esi
+  3a:	39 f7                	cmp    %esi,%edi
+  3c:	75 f2                	jne    30 <main+0x30>
+  3e:	0f 31                	rdtsc
+  cyclereport("getpid", "calls", rdtsc() - t, n);
+  40:	83 ec 0c             	sub    $0xc,%esp
+  43:	56                   	push   %esi
+  44:	2b 45 e0             	sub    -0x20(%ebp),%eax
+  47:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+  4a:	52                   	push   %edx
+  4b:	50                   	push   %eax
+  4c:	68 68 0b 00 00       	push   $0xb68
+  51:	68 6e 0b 00 00       	push   $0xb6e
+  56:	e8 b5 03 00 00       	call   410 <cyclereport>
+  5b:	0f 31                	rdtsc
+  5d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  60:	83 c4 20             	add    $0x20,%esp
+  asm volatile("int %1" : "=a" (pid) : "i" (T_SYSCALL), "a" (SYS_getpid) : "memory");
+  63:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  68:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+
+  t = rdtsc();
+  for(i = 0; i < n; i++)
+  6b:	31 d2                	xor    %edx,%edx
+  6d:	8d 76 00             	lea    0x0(%esi),%esi
+  asm volatile("int %1" : "=a" (pid) : "i" (T_SYSCALL), "a" (SYS_getpid) : "memory");
+  70:	89 c8                	mov    %ecx,%eax
+  72:	cd 40                	int    $0x40
+  for(i = 0; i < n; i++)
+  74:	89 d0                	mov    %edx,%eax
+  76:	83 c2 01             	add    $0x1,%edx
+  79:	39 c3                	cmp    %eax,%ebx
+  7b:	75 f3                	jne    70 <main+0x70>
+  7d:	0f 31                	rdtsc
+    intgetpid();
+  cyclereport("getpid, int $T_SYSCALL", "calls", rdtsc() - t, n);
+  7f:	83 ec 0c             	sub    $0xc,%esp
+  82:	56                   	push   %esi
+  83:	2b 45 e0             	sub    -0x20(%ebp),%eax
+  86:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+  89:	52                   	push   %edx
+  8a:	50                   	push   %eax
+  8b:	68 68 0b 00 00       	push   $0xb68
+  90:	68 75 0b 00 00       	push   $0xb75
+  95:	e8 76 03 00 00       	call   410 <cyclereport>
+  9a:	0f 31                	rdtsc
+  9c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  9f:	83 c4 20             	add    $0x20,%esp
+
+  t = rdtsc();
+  for(i = 0; i < n; i++)
+  a2:	31 ff                	xor    %edi,%edi
+  a4:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ae:	66 90                	xchg   %ax,%ax
+    sysuptime();
+  b0:	e8 d8 05 00 00       	call   68d <sysuptime>
+  for(i = 0; i < n; i++)
+  b5:	89 f8                	mov    %edi,%eax
+  b7:	83 c7 01             	add    $0x1,%edi
+  ba:	39 c3                	cmp    %eax,%ebx
+  bc:	75 f2                	jne    b0 <main+0xb0>
+  be:	0f 31                	rdtsc
+  cyclereport("uptime", "calls", rdtsc() - t, n);
+  c0:	83 ec 0c             	sub    $0xc,%esp
+  c3:	56                   	push   %esi
+  c4:	2b 45 e0             	sub    -0x20(%ebp),%eax
+  c7:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+  ca:	52                   	push   %edx
+  cb:	50                   	push   %eax
+  cc:	68 68 0b 00 00       	push   $0xb68
+  d1:	68 8c 0b 00 00       	push   $0xb8c
+  d6:	e8 35 03 00 00       	call   410 <cyclereport>
+  db:	0f 31                	rdtsc
+  dd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  e0:	83 c4 20             	add    $0x20,%esp
+
+  t = rdtsc();
+  for(i = 0; i < n; i++)
+  e3:	31 ff                	xor    %edi,%edi
+  e5:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ef:	90                   	nop
+    getpid();
+  f0:	e8 eb 02 00 00       	call   3e0 <getpid>
+  for(i = 0; i < n; i++)
+  f5:	89 f8                	mov    %edi,%eax
+  f7:	83 c7 01             	add    $0x1,%edi
+  fa:	39 c3                	cmp    %eax,%ebx
+  fc:	75 f2                	jne    f0 <main+0xf0>
+  fe:	0f 31                	rdtsc
+  cyclereport("getpid, info page", "calls", rdtsc() - t, n);
+ 100:	83 ec 0c             	sub    $0xc,%esp
+ 103:	56                   	push   %esi
+ 104:	2b 45 e0             	sub    -0x20(%ebp),%eax
+ 107:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+ 10a:	52                   	push   %edx
+ 10b:	50                   	push   %eax
+ 10c:	68 68 0b 00 00       	push   $0xb68
+ 111:	68 93 0b 00 00       	push   $0xb93
+ 116:	e8 f5 02 00 00       	call   410 <cyclereport>
+ 11b:	0f 31                	rdtsc
+ 11d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 120:	83 c4 20             	add    $0x20,%esp
+
+  t = rdtsc();
+  for(i = 0; i < n; i++)
+ 123:	31 ff                	xor    %edi,%edi
+ 125:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 128:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12f:	90                   	nop
+    uptime();
+ 130:	e8 cb 02 00 00       	call   400 <uptime>
+  for(i = 0; i < n; i++)
+ 135:	89 f8                	mov    %edi,%eax
+ 137:	83 c7 01             	add    $0x1,%edi
+ 13a:	39 c3                	cmp    %eax,%ebx
+ 13c:	75 f2                	jne    130 <main+0x130>
+ 13e:	0f 31                	rdtsc
+  cyclereport("uptime, info page", "calls", rdtsc() - t, n);
+ 140:	83 ec 0c             	sub    $0xc,%esp
+ 143:	56                   	push   %esi
+ 144:	2b 45 e0             	sub    -0x20(%ebp),%eax
+ 147:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+ 14a:	52                   	push   %edx
+ 14b:	50                   	push   %eax
+ 14c:	68 68 0b 00 00       	push   $0xb68
+ 151:	68 a5 0b 00 00       	push   $0xba5
+ 156:	e8 b5 02 00 00       	call   410 <cyclereport>
+  exit();
+ 15b:	83 c4 20             	add    $0x20,%esp
+ 15e:	e8 59 04 00 00       	call   5bc <exit>
+    n = atoi(argv[1]);
+ 163:	83 ec 0c             	sub    $0xc,%esp
+ 166:	ff 70 04             	push   0x4(%eax)
+ 169:	e8 02 02 00 00       	call   370 <atoi>
+  if(n < 1)
+ 16e:	ba 01 00 00 00       	mov    $0x1,%edx
+ 173:	85 c0                	test   %eax,%eax
+ 175:	0f 4f d0             	cmovg  %eax,%edx
+ 178:	89 d7                	mov    %edx,%edi
+ 17a:	0f 31                	rdtsc
+ 17c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 17f:	83 c4 10             	add    $0x10,%esp
+ 182:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  for(i = 0; i < n; i++)
+ 185:	e9 a3 fe ff ff       	jmp    2d <main+0x2d>
+ 18a:	66 90                	xchg   %ax,%ax
+ 18c:	66 90                	xchg   %ax,%ax
+ 18e:	66 90                	xchg   %ax,%ax
+
+00000190 <intgetpid>:
+  asm volatile("int %1" : "=a" (pid) : "i" (T_SYSCALL), "a" (SYS_getpid) : "memory");
+ 190:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 195:	cd 40                	int    $0x40
+}
+ 197:	c3                   	ret
+ 198:	66 90                	xchg   %ax,%ax
+ 19a:	66 90                	xchg   %ax,%ax
+ 19c:	66 90                	xchg   %ax,%ax
+ 19e:	66 90                	xchg   %ax,%ax
+
+000001a0 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1a1:	31 c0                	xor    %eax,%eax
+{
+ 1a3:	89 e5                	mov    %esp,%ebp
+ 1a5:	53                   	push   %ebx
+ 1a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1b7:	83 c0 01             	add    $0x1,%eax
+ 1ba:	84 d2                	test   %dl,%dl
+ 1bc:	75 f2                	jne    1b0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1c1:	89 c8                	mov    %ecx,%eax
+ 1c3:	c9                   	leave
+ 1c4:	c3                   	ret
+ 1c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	53                   	push   %ebx
+ 1d4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1da:	0f b6 02             	movzbl (%edx),%eax
+ 1dd:	84 c0                	test   %al,%al
+ 1df:	75 17                	jne    1f8 <strcmp+0x28>
+ 1e1:	eb 3a                	jmp    21d <strcmp+0x4d>
+ 1e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1e7:	90                   	nop
+ 1e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1ec:	83 c2 01             	add    $0x1,%edx
+ 1ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1f2:	84 c0                	test   %al,%al
+ 1f4:	74 1a                	je     210 <strcmp+0x40>
+    p++, q++;
+ 1f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1f8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1fb:	38 c3                	cmp    %al,%bl
+ 1fd:	74 e9                	je     1e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1ff:	29 d8                	sub    %ebx,%eax
+}
+ 201:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 204:	c9                   	leave
+ 205:	c3                   	ret
+ 206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 210:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 214:	31 c0                	xor    %eax,%eax
+ 216:	29 d8                	sub    %ebx,%eax
+}
+ 218:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 21b:	c9                   	leave
+ 21c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 21d:	0f b6 19             	movzbl (%ecx),%ebx
+ 220:	31 c0                	xor    %eax,%eax
+ 222:	eb db                	jmp    1ff <strcmp+0x2f>
+ 224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 22f:	90                   	nop
+
+00000230 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 236:	80 3a 00             	cmpb   $0x0,(%edx)
+ 239:	74 15                	je     250 <strlen+0x20>
+ 23b:	31 c0                	xor    %eax,%eax
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+ 240:	83 c0 01             	add    $0x1,%eax
+ 243:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 247:	89 c1                	mov    %eax,%ecx
+ 249:	75 f5                	jne    240 <strlen+0x10>
+    ;
+  return n;
+}
+ 24b:	89 c8                	mov    %ecx,%eax
+ 24d:	5d                   	pop    %ebp
+ 24e:	c3                   	ret
+ 24f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 250:	31 c9                	xor    %ecx,%ecx
+}
+ 252:	5d                   	pop    %ebp
+ 253:	89 c8                	mov    %ecx,%eax
+ 255:	c3                   	ret
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000260 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	57                   	push   %edi
+ 264:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("cld; rep stosb" :
+ 267:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 26a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 26d:	89 d7                	mov    %edx,%edi
+ 26f:	fc                   	cld
+ 270:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 272:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 275:	89 d0                	mov    %edx,%eax
+ 277:	c9                   	leave
+ 278:	c3                   	ret
+ 279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	8b 45 08             	mov    0x8(%ebp),%eax
+ 286:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 28a:	0f b6 10             	movzbl (%eax),%edx
+ 28d:	84 d2                	test   %dl,%dl
+ 28f:	75 12                	jne    2a3 <strchr+0x23>
+ 291:	eb 1d                	jmp    2b0 <strchr+0x30>
+ 293:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 297:	90                   	nop
+ 298:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 29c:	83 c0 01             	add    $0x1,%eax
+ 29f:	84 d2                	test   %dl,%dl
+ 2a1:	74 0d                	je     2b0 <strchr+0x30>
+    if(*s == c)
+ 2a3:	38 d1                	cmp    %dl,%cl
+ 2a5:	75 f1                	jne    298 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2a7:	5d                   	pop    %ebp
+ 2a8:	c3                   	ret
+ 2a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2b0:	31 c0                	xor    %eax,%eax
+}
+ 2b2:	5d                   	pop    %ebp
+ 2b3:	c3                   	ret
+ 2b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	57                   	push   %edi
+ 2c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2c9:	31 db                	xor    %ebx,%ebx
+{
+ 2cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2ce:	eb 27                	jmp    2f7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2d0:	83 ec 04             	sub    $0x4,%esp
+ 2d3:	6a 01                	push   $0x1
+ 2d5:	56                   	push   %esi
+ 2d6:	6a 00                	push   $0x0
+ 2d8:	e8 00 03 00 00       	call   5dd <read>
+    if(cc < 1)
+ 2dd:	83 c4 10             	add    $0x10,%esp
+ 2e0:	85 c0                	test   %eax,%eax
+ 2e2:	7e 1d                	jle    301 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2ef:	3c 0a                	cmp    $0xa,%al
+ 2f1:	74 10                	je     303 <gets+0x43>
+ 2f3:	3c 0d                	cmp    $0xd,%al
+ 2f5:	74 0c                	je     303 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2f7:	89 df                	mov    %ebx,%edi
+ 2f9:	83 c3 01             	add    $0x1,%ebx
+ 2fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2ff:	7c cf                	jl     2d0 <gets+0x10>
+ 301:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 303:	8b 45 08             	mov    0x8(%ebp),%eax
+ 306:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 30a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 30d:	5b                   	pop    %ebx
+ 30e:	5e                   	pop    %esi
+ 30f:	5f                   	pop    %edi
+ 310:	5d                   	pop    %ebp
+ 311:	c3                   	ret
+ 312:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	56                   	push   %esi
+ 324:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 325:	83 ec 08             	sub    $0x8,%esp
+ 328:	6a 00                	push   $0x0
+ 32a:	ff 75 08             	push   0x8(%ebp)
+ 32d:	e8 e2 02 00 00       	call   614 <open>
+  if(fd < 0)
+ 332:	83 c4 10             	add    $0x10,%esp
+ 335:	85 c0                	test   %eax,%eax
+ 337:	78 27                	js     360 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 339:	83 ec 08             	sub    $0x8,%esp
+ 33c:	ff 75 0c             	push   0xc(%ebp)
+ 33f:	89 c3                	mov    %eax,%ebx
+ 341:	50                   	push   %eax
+ 342:	e8 ee 02 00 00       	call   635 <fstat>
+  close(fd);
+ 347:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 34a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 34c:	e8 a2 02 00 00       	call   5f3 <close>
+  return r;
+ 351:	83 c4 10             	add    $0x10,%esp
+}
+ 354:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 357:	89 f0                	mov    %esi,%eax
+ 359:	5b                   	pop    %ebx
+ 35a:	5e                   	pop    %esi
+ 35b:	5d                   	pop    %ebp
+ 35c:	c3                   	ret
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 360:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 365:	eb ed                	jmp    354 <stat+0x34>
+ 367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36e:	66 90                	xchg   %ax,%ax
+
+00000370 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	53                   	push   %ebx
+ 374:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 377:	0f be 02             	movsbl (%edx),%eax
+ 37a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 37d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 380:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 385:	77 1e                	ja     3a5 <atoi+0x35>
+ 387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 390:	83 c2 01             	add    $0x1,%edx
+ 393:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 396:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 39a:	0f be 02             	movsbl (%edx),%eax
+ 39d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3a0:	80 fb 09             	cmp    $0x9,%bl
+ 3a3:	76 eb                	jbe    390 <atoi+0x20>
+  return n;
+}
+ 3a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3a8:	89 c8                	mov    %ecx,%eax
+ 3aa:	c9                   	leave
+ 3ab:	c3                   	ret
+ 3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	57                   	push   %edi
+ 3b4:	56                   	push   %esi
+ 3b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3be:	85 c0                	test   %eax,%eax
+ 3c0:	7e 13                	jle    3d5 <memmove+0x25>
+ 3c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3c4:	89 d7                	mov    %edx,%edi
+ 3c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3d1:	39 f8                	cmp    %edi,%eax
+ 3d3:	75 fb                	jne    3d0 <memmove+0x20>
+  return vdst;
+}
+ 3d5:	5e                   	pop    %esi
+ 3d6:	89 d0                	mov    %edx,%eax
+ 3d8:	5f                   	pop    %edi
+ 3d9:	5d                   	pop    %ebp
+ 3da:	c3                   	ret
+ 3db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3df:	90                   	nop
+
+000003e0 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 3e0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 3e5:	85 c0                	test   %eax,%eax
+ 3e7:	74 07                	je     3f0 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 3e9:	c3                   	ret
+ 3ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 3f0:	e9 77 02 00 00       	jmp    66c <sysgetpid>
+ 3f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 400:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 405:	c3                   	ret
+ 406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000410 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 410:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 411:	31 d2                	xor    %edx,%edx
+ 413:	89 e5                	mov    %esp,%ebp
+ 415:	53                   	push   %ebx
+ 416:	83 ec 04             	sub    $0x4,%esp
+ 419:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 41c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 41f:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 422:	85 c9                	test   %ecx,%ecx
+ 424:	7e 08                	jle    42e <cyclereport+0x1e>
+ 426:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 428:	89 d8                	mov    %ebx,%eax
+ 42a:	f7 f1                	div    %ecx
+ 42c:	89 c2                	mov    %eax,%edx
+ 42e:	83 ec 08             	sub    $0x8,%esp
+ 431:	52                   	push   %edx
+ 432:	ff 75 0c             	push   0xc(%ebp)
+ 435:	51                   	push   %ecx
+ 436:	ff 75 08             	push   0x8(%ebp)
+ 439:	68 b7 0b 00 00       	push   $0xbb7
+ 43e:	6a 01                	push   $0x1
+ 440:	e8 fb 03 00 00       	call   840 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 445:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 448:	83 c4 20             	add    $0x20,%esp
+ 44b:	c9                   	leave
+ 44c:	c3                   	ret
+ 44d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000450 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 453:	8b 45 08             	mov    0x8(%ebp),%eax
+ 456:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 45c:	5d                   	pop    %ebp
+ 45d:	c3                   	ret
+ 45e:	66 90                	xchg   %ax,%ax
+
+00000460 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 460:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 461:	31 c0                	xor    %eax,%eax
+ 463:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 468:	89 e5                	mov    %esp,%ebp
+ 46a:	56                   	push   %esi
+ 46b:	53                   	push   %ebx
+ 46c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 46f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 473:	85 c0                	test   %eax,%eax
+ 475:	74 30                	je     4a7 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 477:	83 f8 02             	cmp    $0x2,%eax
+ 47a:	74 0c                	je     488 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 47c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 481:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 484:	85 c0                	test   %eax,%eax
+ 486:	74 1f                	je     4a7 <mutex_lock+0x47>
+ 488:	be 02 00 00 00       	mov    $0x2,%esi
+ 48d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 490:	83 ec 08             	sub    $0x8,%esp
+ 493:	6a 02                	push   $0x2
+ 495:	53                   	push   %ebx
+ 496:	e8 8c 02 00 00       	call   727 <futex_wait>
+ 49b:	89 f0                	mov    %esi,%eax
+ 49d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 4a0:	83 c4 10             	add    $0x10,%esp
+ 4a3:	85 c0                	test   %eax,%eax
+ 4a5:	75 e9                	jne    490 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 4a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4aa:	5b                   	pop    %ebx
+ 4ab:	5e                   	pop    %esi
+ 4ac:	5d                   	pop    %ebp
+ 4ad:	c3                   	ret
+ 4ae:	66 90                	xchg   %ax,%ax
+
+000004b0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	83 ec 08             	sub    $0x8,%esp
+ 4b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 4b9:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 4bd:	75 09                	jne    4c8 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 4bf:	c9                   	leave
+ 4c0:	c3                   	ret
+ 4c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 4c8:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 4cb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 4d1:	6a 01                	push   $0x1
+ 4d3:	50                   	push   %eax
+ 4d4:	e8 59 02 00 00       	call   732 <futex_wake>
+ 4d9:	83 c4 10             	add    $0x10,%esp
+}
+ 4dc:	c9                   	leave
+ 4dd:	c3                   	ret
+ 4de:	66 90                	xchg   %ax,%ax
+
+000004e0 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 4e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4e6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 4ec:	5d                   	pop    %ebp
+ 4ed:	c3                   	ret
+ 4ee:	66 90                	xchg   %ax,%ax
+
+000004f0 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	57                   	push   %edi
+ 4f4:	56                   	push   %esi
+ 4f5:	53                   	push   %ebx
+ 4f6:	83 ec 0c             	sub    $0xc,%esp
+ 4f9:	8b 75 08             	mov    0x8(%ebp),%esi
+ 4fc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 4ff:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 501:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 505:	75 21                	jne    528 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 507:	83 ec 08             	sub    $0x8,%esp
+ 50a:	57                   	push   %edi
+ 50b:	56                   	push   %esi
+ 50c:	e8 16 02 00 00       	call   727 <futex_wait>
+  mutex_lock(m);
+ 511:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 514:	83 c4 10             	add    $0x10,%esp
+}
+ 517:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 51a:	5b                   	pop    %ebx
+ 51b:	5e                   	pop    %esi
+ 51c:	5f                   	pop    %edi
+ 51d:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 51e:	e9 3d ff ff ff       	jmp    460 <mutex_lock>
+ 523:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 527:	90                   	nop
+    futex_wake(&m->v, 1);
+ 528:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 52b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 531:	6a 01                	push   $0x1
+ 533:	53                   	push   %ebx
+ 534:	e8 f9 01 00 00       	call   732 <futex_wake>
+ 539:	83 c4 10             	add    $0x10,%esp
+ 53c:	eb c9                	jmp    507 <cond_wait+0x17>
+ 53e:	66 90                	xchg   %ax,%ax
+
+00000540 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	83 ec 10             	sub    $0x10,%esp
+ 546:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 549:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 54d:	6a 01                	push   $0x1
+ 54f:	50                   	push   %eax
+ 550:	e8 dd 01 00 00       	call   732 <futex_wake>
+}
+ 555:	83 c4 10             	add    $0x10,%esp
+ 558:	c9                   	leave
+ 559:	c3                   	ret
+ 55a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000560 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	83 ec 10             	sub    $0x10,%esp
+ 566:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 569:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 56d:	68 ff ff ff 7f       	push   $0x7fffffff
+ 572:	50                   	push   %eax
+ 573:	e8 ba 01 00 00       	call   732 <futex_wake>
+}
+ 578:	83 c4 10             	add    $0x10,%esp
+ 57b:	c9                   	leave
+ 57c:	c3                   	ret
+
+0000057d <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 57d:	50                   	push   %eax
+  pushl %ebx
+ 57e:	53                   	push   %ebx
+  movl $1, %eax
+ 57f:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 584:	0f a2                	cpuid
+  popl %ebx
+ 586:	5b                   	pop    %ebx
+  popl %eax
+ 587:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 588:	c7 05 3c 10 00 00 ae 	movl   $0x5ae,0x103c
+ 58f:	05 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 592:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 598:	74 14                	je     5ae <sysint>
+  movl $sysfast, syscallvec
+ 59a:	c7 05 3c 10 00 00 a4 	movl   $0x5a4,0x103c
+ 5a1:	05 00 00 
+
+000005a4 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 5a4:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 5a6:	ba ad 05 00 00       	mov    $0x5ad,%edx
+  sysenter
+ 5ab:	0f 34                	sysenter
+1:
+  ret
+ 5ad:	c3                   	ret
+
+000005ae <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 5ae:	cd 40                	int    $0x40
+  ret
+ 5b0:	c3                   	ret
+
+000005b1 <fork>:
+
+SYSCALL(fork)
+ 5b1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5b6:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+000005bc <exit>:
+SYSCALL(exit)
+ 5bc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5c1:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+000005c7 <wait>:
+SYSCALL(wait)
+ 5c7:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5cc:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+000005d2 <pipe>:
+SYSCALL(pipe)
+ 5d2:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5d7:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+000005dd <read>:
+SYSCALL(read)
+ 5dd:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5e2:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+000005e8 <write>:
+SYSCALL(write)
+ 5e8:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5ed:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+000005f3 <close>:
+SYSCALL(close)
+ 5f3:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5f8:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+000005fe <kill>:
+SYSCALL(kill)
+ 5fe:	b8 06 00 00 00       	mov    $0x6,%eax
+ 603:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+00000609 <exec>:
+SYSCALL(exec)
+ 609:	b8 07 00 00 00       	mov    $0x7,%eax
+ 60e:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+00000614 <open>:
+SYSCALL(open)
+ 614:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 619:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+0000061f <mknod>:
+SYSCALL(mknod)
+ 61f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 624:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+0000062a <unlink>:
+SYSCALL(unlink)
+ 62a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 62f:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+00000635 <fstat>:
+SYSCALL(fstat)
+ 635:	b8 08 00 00 00       	mov    $0x8,%eax
+ 63a:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+00000640 <link>:
+SYSCALL(link)
+ 640:	b8 13 00 00 00       	mov    $0x13,%eax
+ 645:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+0000064b <mkdir>:
+SYSCALL(mkdir)
+ 64b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 650:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+00000656 <chdir>:
+SYSCALL(chdir)
+ 656:	b8 09 00 00 00       	mov    $0x9,%eax
+ 65b:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+00000661 <dup>:
+SYSCALL(dup)
+ 661:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 666:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+0000066c <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 66c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 671:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+00000677 <sbrk>:
+SYSCALL(sbrk)
+ 677:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 67c:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+00000682 <sleep>:
+SYSCALL(sleep)
+ 682:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 687:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+0000068d <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 68d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 692:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+00000698 <swapread>:
+SYSCALL(swapread)
+ 698:	b8 16 00 00 00       	mov    $0x16,%eax
+ 69d:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+000006a3 <swapwrite>:
+SYSCALL(swapwrite)
+ 6a3:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6a8:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+000006ae <swapstat>:
+SYSCALL(swapstat)
+ 6ae:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6b3:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+000006b9 <madvise>:
+SYSCALL(madvise)
+ 6b9:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6be:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+000006c4 <mlock>:
+SYSCALL(mlock)
+ 6c4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6c9:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+000006cf <munlock>:
+SYSCALL(munlock)
+ 6cf:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6d4:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+000006da <membench>:
+SYSCALL(membench)
+ 6da:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6df:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+000006e5 <nice>:
+SYSCALL(nice)
+ 6e5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6ea:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+000006f0 <setpriority>:
+SYSCALL(setpriority)
+ 6f0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6f5:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+000006fb <usleep>:
+SYSCALL(usleep)
+ 6fb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 700:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+00000706 <cpustat>:
+SYSCALL(cpustat)
+ 706:	b8 20 00 00 00       	mov    $0x20,%eax
+ 70b:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+00000711 <clone>:
+SYSCALL(clone)
+ 711:	b8 21 00 00 00       	mov    $0x21,%eax
+ 716:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+0000071c <join>:
+SYSCALL(join)
+ 71c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 721:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+00000727 <futex_wait>:
+SYSCALL(futex_wait)
+ 727:	b8 23 00 00 00       	mov    $0x23,%eax
+ 72c:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+00000732 <futex_wake>:
+SYSCALL(futex_wake)
+ 732:	b8 24 00 00 00       	mov    $0x24,%eax
+ 737:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+0000073d <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 73d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 742:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+00000748 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 748:	b8 26 00 00 00       	mov    $0x26,%eax
+ 74d:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+00000753 <getcpu>:
+SYSCALL(getcpu)
+ 753:	b8 27 00 00 00       	mov    $0x27,%eax
+ 758:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+0000075e <migrations>:
+SYSCALL(migrations)
+ 75e:	b8 28 00 00 00       	mov    $0x28,%eax
+ 763:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+00000769 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 769:	b8 29 00 00 00       	mov    $0x29,%eax
+ 76e:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+00000774 <lockstat>:
+SYSCALL(lockstat)
+ 774:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 779:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+0000077f <lockprof>:
+SYSCALL(lockprof)
+ 77f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 784:	ff 25 3c 10 00 00    	jmp    *0x103c
+
+0000078a <bcachestat>:
+SYSCALL(bcachestat)
+ 78a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 78f:	ff 25 3c 10 00 00    	jmp    *0x103c
+ 795:	66 90                	xchg   %ax,%ax
+ 797:	66 90                	xchg   %ax,%ax
+ 799:	66 90                	xchg   %ax,%ax
+ 79b:	66 90                	xchg   %ax,%ax
+ 79d:	66 90                	xchg   %ax,%ax
+ 79f:	90                   	nop
+
+000007a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7a0:	55                   	push   %ebp
+ 7a1:	89 e5                	mov    %esp,%ebp
+ 7a3:	57                   	push   %edi
+ 7a4:	56                   	push   %esi
+ 7a5:	53                   	push   %ebx
+ 7a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 7a8:	89 d1                	mov    %edx,%ecx
+{
+ 7aa:	83 ec 3c             	sub    $0x3c,%esp
+ 7ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 7b0:	85 d2                	test   %edx,%edx
+ 7b2:	0f 89 80 00 00 00    	jns    838 <printint+0x98>
+ 7b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 7bc:	74 7a                	je     838 <printint+0x98>
+    x = -xx;
+ 7be:	f7 d9                	neg    %ecx
+    neg = 1;
+ 7c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 7c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 7c8:	31 f6                	xor    %esi,%esi
+ 7ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 7d0:	89 c8                	mov    %ecx,%eax
+ 7d2:	31 d2                	xor    %edx,%edx
+ 7d4:	89 f7                	mov    %esi,%edi
+ 7d6:	f7 f3                	div    %ebx
+ 7d8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7db:	0f b6 92 34 0c 00 00 	movzbl 0xc34(%edx),%edx
+ 7e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7e6:	89 ca                	mov    %ecx,%edx
+ 7e8:	89 c1                	mov    %eax,%ecx
+ 7ea:	39 da                	cmp    %ebx,%edx
+ 7ec:	73 e2                	jae    7d0 <printint+0x30>
+  if(neg)
+ 7ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7f1:	85 c0                	test   %eax,%eax
+ 7f3:	74 07                	je     7fc <printint+0x5c>
+    buf[i++] = '-';
+ 7f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7fa:	89 f7                	mov    %esi,%edi
+ 7fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 802:	01 df                	add    %ebx,%edi
+ 804:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 808:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 80b:	83 ec 04             	sub    $0x4,%esp
+ 80e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 811:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 814:	6a 01                	push   $0x1
+ 816:	50                   	push   %eax
+ 817:	56                   	push   %esi
+ 818:	e8 cb fd ff ff       	call   5e8 <write>
+  while(--i >= 0)
+ 81d:	89 f8                	mov    %edi,%eax
+ 81f:	83 c4 10             	add    $0x10,%esp
+ 822:	83 ef 01             	sub    $0x1,%edi
+ 825:	39 d8                	cmp    %ebx,%eax
+ 827:	75 df                	jne    808 <printint+0x68>
+}
+ 829:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 82c:	5b                   	pop    %ebx
+ 82d:	5e                   	pop    %esi
+ 82e:	5f                   	pop    %edi
+ 82f:	5d                   	pop    %ebp
+ 830:	c3                   	ret
+ 831:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 838:	31 c0                	xor    %eax,%eax
+ 83a:	eb 89                	jmp    7c5 <printint+0x25>
+ 83c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000840 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 840:	55                   	push   %ebp
+ 841:	89 e5                	mov    %esp,%ebp
+ 843:	57                   	push   %edi
+ 844:	56                   	push   %esi
+ 845:	53                   	push   %ebx
+ 846:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 849:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 84c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 84f:	0f b6 1e             	movzbl (%esi),%ebx
+ 852:	83 c6 01             	add    $0x1,%esi
+ 855:	84 db                	test   %bl,%bl
+ 857:	74 67                	je     8c0 <printf+0x80>
+ 859:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 85c:	31 d2                	xor    %edx,%edx
+ 85e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 861:	eb 34                	jmp    897 <printf+0x57>
+ 863:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 867:	90                   	nop
+ 868:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 86b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 870:	83 f8 25             	cmp    $0x25,%eax
+ 873:	74 18                	je     88d <printf+0x4d>
+  write(fd, &c, 1);
+ 875:	83 ec 04             	sub    $0x4,%esp
+ 878:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 87b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 87e:	6a 01                	push   $0x1
+ 880:	50                   	push   %eax
+ 881:	57                   	push   %edi
+ 882:	e8 61 fd ff ff       	call   5e8 <write>
+ 887:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 88a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 88d:	0f b6 1e             	movzbl (%esi),%ebx
+ 890:	83 c6 01             	add    $0x1,%esi
+ 893:	84 db                	test   %bl,%bl
+ 895:	74 29                	je     8c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 897:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 89a:	85 d2                	test   %edx,%edx
+ 89c:	74 ca                	je     868 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 89e:	83 fa 25             	cmp    $0x25,%edx
+ 8a1:	75 ea                	jne    88d <printf+0x4d>
+      if(c == 'd'){
+ 8a3:	83 f8 25             	cmp    $0x25,%eax
+ 8a6:	0f 84 24 01 00 00    	je     9d0 <printf+0x190>
+ 8ac:	83 e8 63             	sub    $0x63,%eax
+ 8af:	83 f8 15             	cmp    $0x15,%eax
+ 8b2:	77 1c                	ja     8d0 <printf+0x90>
+ 8b4:	ff 24 85 dc 0b 00 00 	jmp    *0xbdc(,%eax,4)
+ 8bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 8c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8c3:	5b                   	pop    %ebx
+ 8c4:	5e                   	pop    %esi
+ 8c5:	5f                   	pop    %edi
+ 8c6:	5d                   	pop    %ebp
+ 8c7:	c3                   	ret
+ 8c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8cf:	90                   	nop
+  write(fd, &c, 1);
+ 8d0:	83 ec 04             	sub    $0x4,%esp
+ 8d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 8da:	6a 01                	push   $0x1
+ 8dc:	52                   	push   %edx
+ 8dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 8e0:	57                   	push   %edi
+ 8e1:	e8 02 fd ff ff       	call   5e8 <write>
+ 8e6:	83 c4 0c             	add    $0xc,%esp
+ 8e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8ec:	6a 01                	push   $0x1
+ 8ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8f1:	52                   	push   %edx
+ 8f2:	57                   	push   %edi
+ 8f3:	e8 f0 fc ff ff       	call   5e8 <write>
+        putc(fd, c);
+ 8f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8fb:	31 d2                	xor    %edx,%edx
+ 8fd:	eb 8e                	jmp    88d <printf+0x4d>
+ 8ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 900:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 903:	83 ec 0c             	sub    $0xc,%esp
+ 906:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 90b:	8b 13                	mov    (%ebx),%edx
+ 90d:	6a 00                	push   $0x0
+ 90f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 911:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 914:	e8 87 fe ff ff       	call   7a0 <printint>
+        ap++;
+ 919:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 91c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 91f:	31 d2                	xor    %edx,%edx
+ 921:	e9 67 ff ff ff       	jmp    88d <printf+0x4d>
+ 926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 92d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 930:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 933:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 935:	83 c0 04             	add    $0x4,%eax
+ 938:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 93b:	85 db                	test   %ebx,%ebx
+ 93d:	0f 84 9d 00 00 00    	je     9e0 <printf+0x1a0>
+        while(*s != 0){
+ 943:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 946:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 948:	84 c0                	test   %al,%al
+ 94a:	0f 84 3d ff ff ff    	je     88d <printf+0x4d>
+ 950:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 953:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 956:	89 de                	mov    %ebx,%esi
+ 958:	89 d3                	mov    %edx,%ebx
+ 95a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 960:	83 ec 04             	sub    $0x4,%esp
+ 963:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 966:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 969:	6a 01                	push   $0x1
+ 96b:	53                   	push   %ebx
+ 96c:	57                   	push   %edi
+ 96d:	e8 76 fc ff ff       	call   5e8 <write>
+        while(*s != 0){
+ 972:	0f b6 06             	movzbl (%esi),%eax
+ 975:	83 c4 10             	add    $0x10,%esp
+ 978:	84 c0                	test   %al,%al
+ 97a:	75 e4                	jne    960 <printf+0x120>
+      state = 0;
+ 97c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 97f:	31 d2                	xor    %edx,%edx
+ 981:	e9 07 ff ff ff       	jmp    88d <printf+0x4d>
+ 986:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 990:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 993:	83 ec 0c             	sub    $0xc,%esp
+ 996:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 99b:	8b 13                	mov    (%ebx),%edx
+ 99d:	6a 01                	push   $0x1
+ 99f:	e9 6b ff ff ff       	jmp    90f <printf+0xcf>
+ 9a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 9a8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 9ab:	83 ec 04             	sub    $0x4,%esp
+ 9ae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 9b1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 9b3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 9b6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 9b9:	6a 01                	push   $0x1
+ 9bb:	52                   	push   %edx
+ 9bc:	57                   	push   %edi
+ 9bd:	e8 26 fc ff ff       	call   5e8 <write>
+        ap++;
+ 9c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9c5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9c8:	31 d2                	xor    %edx,%edx
+ 9ca:	e9 be fe ff ff       	jmp    88d <printf+0x4d>
+ 9cf:	90                   	nop
+  write(fd, &c, 1);
+ 9d0:	83 ec 04             	sub    $0x4,%esp
+ 9d3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9d6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9d9:	6a 01                	push   $0x1
+ 9db:	e9 11 ff ff ff       	jmp    8f1 <printf+0xb1>
+ 9e0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 9e5:	bb d2 0b 00 00       	mov    $0xbd2,%ebx
+ 9ea:	e9 61 ff ff ff       	jmp    950 <printf+0x110>
+ 9ef:	90                   	nop
+
+000009f0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9f0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9f1:	a1 40 10 00 00       	mov    0x1040,%eax
+{
+ 9f6:	89 e5                	mov    %esp,%ebp
+ 9f8:	57                   	push   %edi
+ 9f9:	56                   	push   %esi
+ 9fa:	53                   	push   %ebx
+ 9fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 9fe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a08:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a0a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a0c:	39 ca                	cmp    %ecx,%edx
+ a0e:	73 30                	jae    a40 <free+0x50>
+ a10:	39 c1                	cmp    %eax,%ecx
+ a12:	72 04                	jb     a18 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a14:	39 c2                	cmp    %eax,%edx
+ a16:	72 f0                	jb     a08 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a18:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a1b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a1e:	39 f8                	cmp    %edi,%eax
+ a20:	74 2e                	je     a50 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a22:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a25:	8b 42 04             	mov    0x4(%edx),%eax
+ a28:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a2b:	39 f1                	cmp    %esi,%ecx
+ a2d:	74 38                	je     a67 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a2f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a31:	5b                   	pop    %ebx
+  freep = p;
+ a32:	89 15 40 10 00 00    	mov    %edx,0x1040
+}
+ a38:	5e                   	pop    %esi
+ a39:	5f                   	pop    %edi
+ a3a:	5d                   	pop    %ebp
+ a3b:	c3                   	ret
+ a3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a40:	39 c1                	cmp    %eax,%ecx
+ a42:	72 d0                	jb     a14 <free+0x24>
+ a44:	eb c2                	jmp    a08 <free+0x18>
+ a46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a4d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a50:	03 70 04             	add    0x4(%eax),%esi
+ a53:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a56:	8b 02                	mov    (%edx),%eax
+ a58:	8b 00                	mov    (%eax),%eax
+ a5a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a5d:	8b 42 04             	mov    0x4(%edx),%eax
+ a60:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a63:	39 f1                	cmp    %esi,%ecx
+ a65:	75 c8                	jne    a2f <free+0x3f>
+    p->s.size += bp->s.size;
+ a67:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a6a:	89 15 40 10 00 00    	mov    %edx,0x1040
+    p->s.size += bp->s.size;
+ a70:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a73:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a76:	89 0a                	mov    %ecx,(%edx)
+}
+ a78:	5b                   	pop    %ebx
+ a79:	5e                   	pop    %esi
+ a7a:	5f                   	pop    %edi
+ a7b:	5d                   	pop    %ebp
+ a7c:	c3                   	ret
+ a7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a80 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a80:	55                   	push   %ebp
+ a81:	89 e5                	mov    %esp,%ebp
+ a83:	57                   	push   %edi
+ a84:	56                   	push   %esi
+ a85:	53                   	push   %ebx
+ a86:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a89:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a8c:	8b 15 40 10 00 00    	mov    0x1040,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a92:	8d 78 07             	lea    0x7(%eax),%edi
+ a95:	c1 ef 03             	shr    $0x3,%edi
+ a98:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a9b:	85 d2                	test   %edx,%edx
+ a9d:	0f 84 8d 00 00 00    	je     b30 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ aa3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ aa5:	8b 48 04             	mov    0x4(%eax),%ecx
+ aa8:	39 f9                	cmp    %edi,%ecx
+ aaa:	73 64                	jae    b10 <malloc+0x90>
+  if(nu < 4096)
+ aac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ ab1:	39 df                	cmp    %ebx,%edi
+ ab3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ ab6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ abd:	eb 0a                	jmp    ac9 <malloc+0x49>
+ abf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ac0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ac2:	8b 48 04             	mov    0x4(%eax),%ecx
+ ac5:	39 f9                	cmp    %edi,%ecx
+ ac7:	73 47                	jae    b10 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ ac9:	89 c2                	mov    %eax,%edx
+ acb:	39 05 40 10 00 00    	cmp    %eax,0x1040
+ ad1:	75 ed                	jne    ac0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ad3:	83 ec 0c             	sub    $0xc,%esp
+ ad6:	56                   	push   %esi
+ ad7:	e8 9b fb ff ff       	call   677 <sbrk>
+  if(p == (char*)-1)
+ adc:	83 c4 10             	add    $0x10,%esp
+ adf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ae2:	74 1c                	je     b00 <malloc+0x80>
+  hp->s.size = nu;
+ ae4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ ae7:	83 ec 0c             	sub    $0xc,%esp
+ aea:	83 c0 08             	add    $0x8,%eax
+ aed:	50                   	push   %eax
+ aee:	e8 fd fe ff ff       	call   9f0 <free>
+  return freep;
+ af3:	8b 15 40 10 00 00    	mov    0x1040,%edx
+      if((p = morecore(nunits)) == 0)
+ af9:	83 c4 10             	add    $0x10,%esp
+ afc:	85 d2                	test   %edx,%edx
+ afe:	75 c0                	jne    ac0 <malloc+0x40>
+        return 0;
+  }
+}
+ b00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b03:	31 c0                	xor    %eax,%eax
+}
+ b05:	5b                   	pop    %ebx
+ b06:	5e                   	pop    %esi
+ b07:	5f                   	pop    %edi
+ b08:	5d                   	pop    %ebp
+ b09:	c3                   	ret
+ b0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b10:	39 cf                	cmp    %ecx,%edi
+ b12:	74 4c                	je     b60 <malloc+0xe0>
+        p->s.size -= nunits;
+ b14:	29 f9                	sub    %edi,%ecx
+ b16:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ b19:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ b1c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ b1f:	89 15 40 10 00 00    	mov    %edx,0x1040
+}
+ b25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b28:	83 c0 08             	add    $0x8,%eax
+}
+ b2b:	5b                   	pop    %ebx
+ b2c:	5e                   	pop    %esi
+ b2d:	5f                   	pop    %edi
+ b2e:	5d                   	pop    %ebp
+ b2f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b30:	c7 05 40 10 00 00 44 	movl   $0x1044,0x1040
+ b37:	10 00 00 
+    base.s.size = 0;
+ b3a:	b8 44 10 00 00       	mov    $0x1044,%eax
+    base.s.ptr = freep = prevp = &base;
+ b3f:	c7 05 44 10 00 00 44 	movl   $0x1044,0x1044
+ b46:	10 00 00 
+    base.s.size = 0;
+ b49:	c7 05 48 10 00 00 00 	movl   $0x0,0x1048
+ b50:	00 00 00 
+    if(p->s.size >= nunits){
+ b53:	e9 54 ff ff ff       	jmp    aac <malloc+0x2c>
+ b58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b5f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b60:	8b 08                	mov    (%eax),%ecx
+ b62:	89 0a                	mov    %ecx,(%edx)
+ b64:	eb b9                	jmp    b1f <malloc+0x9f>
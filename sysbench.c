@@ -0,0 +1,62 @@
+// System call overhead: cycles per call of getpid(), which
+// does nothing but myproc() on the way in and out, and of
+// uptime(), which also takes spinlocks.  getpid() is also
+// timed through int $T_SYSCALL, which is what usys.S uses
+// when the CPU has no sysenter.  ulib's getpid() and uptime()
+// read the info pages instead, and are timed for comparison.
+// usage: sysbench [calls]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "x86.h"
+#include "syscall.h"
+#include "traps.h"
+
+int
+intgetpid(void)
+{
+  int pid;
+
+  asm volatile("int %1" : "=a" (pid) : "i" (T_SYSCALL), "a" (SYS_getpid) : "memory");
+  return pid;
+}
+
+int
+main(int argc, char *argv[])
+{
+  uint64 t;
+  int i, n;
+
+  n = 100000;
+  if(argc > 1)
+    n = atoi(argv[1]);
+  if(n < 1)
+    n = 1;
+
+  t = rdtsc();
+  for(i = 0; i < n; i++)
+    sysgetpid();
+  cyclereport("getpid", "calls", rdtsc() - t, n);
+
+  t = rdtsc();
+  for(i = 0; i < n; i++)
+    intgetpid();
+  cyclereport("getpid, int $T_SYSCALL", "calls", rdtsc() - t, n);
+
+  t = rdtsc();
+  for(i = 0; i < n; i++)
+    sysuptime();
+  cyclereport("uptime", "calls", rdtsc() - t, n);
+
+  t = rdtsc();
+  for(i = 0; i < n; i++)
+    getpid();
+  cyclereport("getpid, info page", "calls", rdtsc() - t, n);
+
+  t = rdtsc();
+  for(i = 0; i < n; i++)
+    uptime();
+  cyclereport("uptime, info page", "calls", rdtsc() - t, n);
+  exit();
+}
@@ -3,6 +3,7 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 #include "syscall.h"
@@ -13,13 +14,53 @@
 // library system call function. The saved user %esp points
 // to a saved program counter, and then the first argument.
 
+// Keep the pages of [addr, addr+size) in memory, and mapped, until
+// the system call returns: pipes and the console copy to and from
+// them while holding a spinlock, where a fault can't sleep, and
+// another thread may try to sbrk() them away (see revokeuvm()).
+// Pages this call has already pinned are not pinned again.
+static int
+pinarg(uint addr, uint size)
+{
+  struct proc *curproc = myproc();
+  struct pinned *pp;
+  uint a, last;
+
+  if(size == 0)
+    return 0;
+  a = PGROUNDDOWN(addr);
+  last = PGROUNDUP(addr + size);
+  for(pp = curproc->pins; pp < curproc->pins + curproc->npins; pp++)
+    if(pp->addr <= a && last <= pp->addr + pp->len)
+      return 0;
+  if(curproc->npins == NPINARG || pinuvm(curproc->pgdir, a, last - a) < 0)
+    return -1;
+  pp->addr = a;
+  pp->len = last - a;
+  curproc->npins++;
+  return 0;
+}
+
+// Unpin what the current system call pinned, all but the first n.
+void
+unpinargs(int n)
+{
+  struct proc *curproc = myproc();
+  struct pinned *pp;
+
+  while(curproc->npins > n){
+    pp = &curproc->pins[--curproc->npins];
+    unpinuvm(curproc->pgdir, pp->addr, pp->len);
+  }
+}
+
 // Fetch the int at addr from the current process.
 int
 fetchint(uint addr, int *ip)
 {
   struct proc *curproc = myproc();
 
-  if(addr >= curproc->sz || addr+4 > curproc->sz)
+  if(addr >= curproc->sz || addr+4 > curproc->sz || pinarg(addr, 4) < 0)
     return -1;
   *ip = *(int*)(addr);
   return 0;
@@ -37,10 +78,17 @@ fetchstr(uint addr, char **pp)
   if(addr >= curproc->sz)
     return -1;
   *pp = (char*)addr;
-  ep = (char*)curproc->sz;
-  for(s = *pp; s < ep; s++){
-    if(*s == 0)
-      return s - *pp;
+  for(s = *pp; (uint)s < curproc->sz; ){
+    // A page at a time, pinning it before looking at it.
+    ep = (char*)PGROUNDUP((uint)s + 1);
+    if((uint)ep > curproc->sz)
+      ep = (char*)curproc->sz;
+    if(pinarg((uint)s, ep - s) < 0)
+      return -1;
+    for(; s < ep; s++){
+      if(*s == 0)
+        return s - *pp;
+    }
   }
   return -1;
 }
@@ -59,13 +107,25 @@ int
 argptr(int n, char **pp, int size)
 {
   int i;
-  struct proc *curproc = myproc();
  
   if(argint(n, &i) < 0)
     return -1;
-  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+  return fetchptr(i, pp, size);
+}
+
+// Check that the size bytes at addr lie within the user
+// address space, pin them for the rest of the system call,
+// and point *pp at them.
+int
+fetchptr(uint addr, char **pp, int size)
+{
+  struct proc *curproc = myproc();
+
+  if(size < 0 || addr >= curproc->sz || addr+size > curproc->sz)
     return -1;
-  *pp = (char*)i;
+  if(pinarg(addr, size) < 0)
+    return -1;
+  *pp = (char*)addr;
   return 0;
 }
 
@@ -106,6 +166,26 @@ extern int sys_uptime(void);
 extern int sys_swapread(void);
 extern int sys_swapwrite(void);
 extern int sys_swapstat(void);
+extern int sys_madvise(void);
+extern int sys_mlock(void);
+extern int sys_munlock(void);
+extern int sys_membench(void);
+extern int sys_nice(void);
+extern int sys_setpriority(void);
+extern int sys_usleep(void);
+extern int sys_cpustat(void);
+extern int sys_clone(void);
+extern int sys_join(void);
+extern int sys_futex_wait(void);
+extern int sys_futex_wake(void);
+extern int sys_sched_setaffinity(void);
+extern int sys_sched_getaffinity(void);
+extern int sys_getcpu(void);
+extern int sys_migrations(void);
+extern int sys_ioring_enter(void);
+extern int sys_lockstat(void);
+extern int sys_lockprof(void);
+extern int sys_bcachestat(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -132,6 +212,26 @@ static int (*syscalls[])(void) = {
 [SYS_swapread]	sys_swapread,
 [SYS_swapwrite] sys_swapwrite,
 [SYS_swapstat] sys_swapstat,
+[SYS_madvise] sys_madvise,
+[SYS_mlock]   sys_mlock,
+[SYS_munlock] sys_munlock,
+[SYS_membench] sys_membench,
+[SYS_nice]    sys_nice,
+[SYS_setpriority] sys_setpriority,
+[SYS_usleep]  sys_usleep,
+[SYS_cpustat] sys_cpustat,
+[SYS_clone]   sys_clone,
+[SYS_join]    sys_join,
+[SYS_futex_wait] sys_futex_wait,
+[SYS_futex_wake] sys_futex_wake,
+[SYS_sched_setaffinity] sys_sched_setaffinity,
+[SYS_sched_getaffinity] sys_sched_getaffinity,
+[SYS_getcpu]  sys_getcpu,
+[SYS_migrations] sys_migrations,
+[SYS_ioring_enter] sys_ioring_enter,
+[SYS_lockstat] sys_lockstat,
+[SYS_lockprof] sys_lockprof,
+[SYS_bcachestat] sys_bcachestat,
 };
 
 void
@@ -143,6 +243,7 @@ syscall(void)
   num = curproc->tf->eax;
   if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
     curproc->tf->eax = syscalls[num]();
+    unpinargs(0);
   } else {
     cprintf("%d %s: unknown sys call %d\n",
             curproc->pid, curproc->name, num);
@@ -25,3 +25,23 @@
 #define SYS_swapread	22
 #define SYS_swapwrite	23
 #define SYS_swapstat	24
+#define SYS_madvise	25
+#define SYS_mlock	26
+#define SYS_munlock	27
+#define SYS_membench	28
+#define SYS_nice	29
+#define SYS_setpriority	30
+#define SYS_usleep	31
+#define SYS_cpustat	32
+#define SYS_clone	33
+#define SYS_join	34
+#define SYS_futex_wait	35
+#define SYS_futex_wake	36
+#define SYS_sched_setaffinity	37
+#define SYS_sched_getaffinity	38
+#define SYS_getcpu	39
+#define SYS_migrations	40
+#define SYS_ioring_enter	41
+#define SYS_lockstat	42
+#define SYS_lockprof	43
+#define SYS_bcachestat	44
@@ -9,29 +9,46 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "fs.h"
-#include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
+#include "ioring.h"
+
+// Return a reference to the file open as fd, or 0.
+// The file table may be shared with other threads,
+// which can close fd while the caller is using it.
+static struct file*
+fdget(int fd)
+{
+  struct fdtable *t = myproc()->fdt;
+  struct file *f;
+
+  if(fd < 0 || fd >= NOFILE)
+    return 0;
+  acquire(&t->lock);
+  if((f = t->ofile[fd]) != 0)
+    filedup(f);
+  release(&t->lock);
+  return f;
+}
 
 // Fetch the nth word-sized system call argument as a file descriptor
-// and return both the descriptor and the corresponding struct file.
+// and return the corresponding struct file, with a reference that
+// the caller must fileclose().
 static int
-argfd(int n, int *pfd, struct file **pf)
+argfd(int n, struct file **pf)
 {
   int fd;
   struct file *f;
 
   if(argint(n, &fd) < 0)
     return -1;
-  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+  if((f = fdget(fd)) == 0)
     return -1;
-  if(pfd)
-    *pfd = fd;
-  if(pf)
-    *pf = f;
+  *pf = f;
   return 0;
 }
 
@@ -41,28 +58,49 @@ static int
 fdalloc(struct file *f)
 {
   int fd;
-  struct proc *curproc = myproc();
+  struct fdtable *t = myproc()->fdt;
 
+  acquire(&t->lock);
   for(fd = 0; fd < NOFILE; fd++){
-    if(curproc->ofile[fd] == 0){
-      curproc->ofile[fd] = f;
+    if(t->ofile[fd] == 0){
+      t->ofile[fd] = f;
+      release(&t->lock);
       return fd;
     }
   }
+  release(&t->lock);
   return -1;
 }
 
+// Take fd out of the file table, returning the file
+// it was open as, whose reference passes to the caller.
+static struct file*
+fdremove(int fd)
+{
+  struct fdtable *t = myproc()->fdt;
+  struct file *f;
+
+  if(fd < 0 || fd >= NOFILE)
+    return 0;
+  acquire(&t->lock);
+  if((f = t->ofile[fd]) != 0)
+    t->ofile[fd] = 0;
+  release(&t->lock);
+  return f;
+}
+
 int
 sys_dup(void)
 {
   struct file *f;
   int fd;
 
-  if(argfd(0, 0, &f) < 0)
+  if(argfd(0, &f) < 0)
     return -1;
-  if((fd=fdalloc(f)) < 0)
+  if((fd=fdalloc(f)) < 0){
+    fileclose(f);
     return -1;
-  filedup(f);
+  }
   return fd;
 }
 
@@ -70,24 +108,32 @@ int
 sys_read(void)
 {
   struct file *f;
-  int n;
+  int n, r;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argfd(0, &f) < 0)
     return -1;
-  return fileread(f, p, n);
+  r = -1;
+  if(argint(2, &n) >= 0 && argptr(1, &p, n) >= 0)
+    r = fileread(f, p, n);
+  fileclose(f);
+  return r;
 }
 
 int
 sys_write(void)
 {
   struct file *f;
-  int n;
+  int n, r;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argfd(0, &f) < 0)
     return -1;
-  return filewrite(f, p, n);
+  r = -1;
+  if(argint(2, &n) >= 0 && argptr(1, &p, n) >= 0)
+    r = filewrite(f, p, n);
+  fileclose(f);
+  return r;
 }
 
 int
@@ -96,9 +142,8 @@ sys_close(void)
   int fd;
   struct file *f;
 
-  if(argfd(0, &fd, &f) < 0)
+  if(argint(0, &fd) < 0 || (f = fdremove(fd)) == 0)
     return -1;
-  myproc()->ofile[fd] = 0;
   fileclose(f);
   return 0;
 }
@@ -108,10 +153,15 @@ sys_fstat(void)
 {
   struct file *f;
   struct stat *st;
+  int r;
 
-  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+  if(argfd(0, &f) < 0)
     return -1;
-  return filestat(f, st);
+  r = -1;
+  if(argptr(1, (void*)&st, sizeof(*st)) >= 0)
+    r = filestat(f, st);
+  fileclose(f);
+  return r;
 }
 
 // Create the path new as a link to the same inode as old.
@@ -282,17 +332,14 @@ create(char *path, short type, short major, short minor)
   return ip;
 }
 
-int
-sys_open(void)
+// Open path for sys_open() and IORING_OPEN.
+static int
+openpath(char *path, int omode)
 {
-  char *path;
-  int fd, omode;
+  int fd;
   struct file *f;
   struct inode *ip;
 
-  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
-    return -1;
-
   begin_op();
 
   if(omode & O_CREATE){
@@ -332,6 +379,17 @@ sys_open(void)
   return fd;
 }
 
+int
+sys_open(void)
+{
+  char *path;
+  int omode;
+
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+    return -1;
+  return openpath(path, omode);
+}
+
 int
 sys_mkdir(void)
 {
@@ -372,8 +430,8 @@ int
 sys_chdir(void)
 {
   char *path;
-  struct inode *ip;
-  struct proc *curproc = myproc();
+  struct inode *ip, *old;
+  struct fdtable *t = myproc()->fdt;
   
   begin_op();
   if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
@@ -387,9 +445,12 @@ sys_chdir(void)
     return -1;
   }
   iunlock(ip);
-  iput(curproc->cwd);
+  acquire(&t->lock);
+  old = t->cwd;
+  t->cwd = ip;
+  release(&t->lock);
+  iput(old);
   end_op();
-  curproc->cwd = ip;
   return 0;
 }
 
@@ -433,7 +494,7 @@ sys_pipe(void)
   fd0 = -1;
   if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
     if(fd0 >= 0)
-      myproc()->ofile[fd0] = 0;
+      fdremove(fd0);
     fileclose(rf);
     fileclose(wf);
     return -1;
@@ -484,3 +545,75 @@ int sys_swapstat(void)
 	*nr_write = nr_sectors_write;
 	return 0;
 }
+
+// Do one ioring operation, and return what its system call
+// would have.
+static int
+ioringop(struct iosqe *e)
+{
+  struct file *f;
+  char *p;
+  int r;
+
+  switch(e->op){
+  case IORING_OPEN:
+    if(fetchstr(e->addr, &p) < 0)
+      return -1;
+    return openpath(p, e->n);
+  case IORING_CLOSE:
+    if((f = fdremove(e->fd)) == 0)
+      return -1;
+    fileclose(f);
+    return 0;
+  }
+  if((f = fdget(e->fd)) == 0)
+    return -1;
+  r = -1;
+  switch(e->op){
+  case IORING_READ:
+    if(fetchptr(e->addr, &p, e->n) >= 0)
+      r = fileread(f, p, e->n);
+    break;
+  case IORING_WRITE:
+    if(fetchptr(e->addr, &p, e->n) >= 0)
+      r = filewrite(f, p, e->n);
+    break;
+  case IORING_FSTAT:
+    if(fetchptr(e->addr, &p, sizeof(struct stat)) >= 0)
+      r = filestat(f, (struct stat*)p);
+    break;
+  }
+  fileclose(f);
+  return r;
+}
+
+// Carry out the operations queued on an ioring, in order,
+// until there are none left or no room for completions.
+// Each entry is copied before use, since the process may
+// change the ring under us.  Returns how many were done.
+int
+sys_ioring_enter(void)
+{
+  struct ioring *r;
+  struct iosqe e;
+  struct iocqe *c;
+  uint head;
+  int n, npins;
+
+  if(argptr(0, (void*)&r, sizeof(*r)) < 0)
+    return -1;
+  npins = myproc()->npins;
+  for(n = 0; !myproc()->killed; n++){
+    head = r->sqhead;
+    if(head == r->sqtail || r->cqtail - r->cqhead >= IORING_SIZE)
+      break;
+    e = r->sq[head % IORING_SIZE];
+    r->sqhead = head + 1;
+    c = &r->cq[r->cqtail % IORING_SIZE];
+    c->data = e.data;
+    c->res = ioringop(&e);
+    unpinargs(npins);  // but keep the ring pinned
+    r->cqtail++;
+  }
+  return n;
+}
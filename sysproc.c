@@ -5,7 +5,12 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
+#include "mman.h"
+#include "cpustat.h"
+#include "lockstat.h"
+#include "bcachestat.h"
 
 int
 sys_fork(void)
@@ -50,8 +55,7 @@ sys_sbrk(void)
 
   if(argint(0, &n) < 0)
     return -1;
-  addr = myproc()->sz;
-  if(growproc(n) < 0)
+  if((addr = growproc(n)) < 0)
     return -1;
   return addr;
 }
@@ -60,21 +64,12 @@ int
 sys_sleep(void)
 {
   int n;
-  uint ticks0;
 
   if(argint(0, &n) < 0)
     return -1;
-  acquire(&tickslock);
-  ticks0 = ticks;
-  while(ticks - ticks0 < n){
-    if(myproc()->killed){
-      release(&tickslock);
-      return -1;
-    }
-    sleep(&ticks, &tickslock);
-  }
-  release(&tickslock);
-  return 0;
+  if(n <= 0)
+    return 0;
+  return jsleep(n * TICKJIFFIES);
 }
 
 // return how many clock tick interrupts have occurred
@@ -84,8 +79,271 @@ sys_uptime(void)
 {
   uint xticks;
 
+  timerupdate();
   acquire(&tickslock);
   xticks = ticks;
   release(&tickslock);
   return xticks;
 }
+
+// Give the kernel a hint about how a range of memory will be used.
+int
+sys_madvise(void)
+{
+  int addr, len, advice;
+  struct proc *curproc = myproc();
+
+  if(argint(0, &addr) < 0 || argint(1, &len) < 0 || argint(2, &advice) < 0)
+    return -1;
+  if((uint)addr % PGSIZE != 0 || len < 0 || (uint)addr + len < (uint)addr ||
+     (uint)addr + len > curproc->sz)
+    return -1;
+  if(advice < MADV_NORMAL || advice > MADV_DONTNEED)
+    return -1;
+  return madvise(curproc->pgdir, addr, len, advice);
+}
+
+// Pin a range of memory so that it is never swapped out.
+int
+sys_mlock(void)
+{
+  int addr, len;
+  struct proc *curproc = myproc();
+
+  if(argint(0, &addr) < 0 || argint(1, &len) < 0)
+    return -1;
+  if(len < 0 || (uint)addr + len < (uint)addr ||
+     (uint)addr + len > curproc->sz)
+    return -1;
+  return mlock(curproc->pgdir, curproc->sz, addr, len);
+}
+
+int
+sys_munlock(void)
+{
+  int addr, len;
+  struct proc *curproc = myproc();
+
+  if(argint(0, &addr) < 0 || argint(1, &len) < 0)
+    return -1;
+  if(len < 0 || (uint)addr + len < (uint)addr ||
+     (uint)addr + len > curproc->sz)
+    return -1;
+  return munlock(curproc->pgdir, addr, len);
+}
+
+// Time the kernel's memory copy and clear routines.
+int
+sys_membench(void)
+{
+  return membench();
+}
+
+// Lower (or raise) the priority of this process by inc levels.
+// Returns the new nice level.
+int
+sys_nice(void)
+{
+  int inc, n;
+  struct proc *curproc = myproc();
+
+  if(argint(0, &inc) < 0)
+    return -1;
+  n = curproc->nice + inc;
+  if(n < 0)
+    n = 0;
+  if(n >= NPRIO)
+    n = NPRIO-1;
+  if(setpriority(curproc->pid, n) < 0)
+    return -1;
+  return n;
+}
+
+int
+sys_setpriority(void)
+{
+  int pid, nice;
+
+  if(argint(0, &pid) < 0 || argint(1, &nice) < 0)
+    return -1;
+  return setpriority(pid, nice);
+}
+
+// Sleep for a number of microseconds.
+int
+sys_usleep(void)
+{
+  int us;
+
+  if(argint(0, &us) < 0 || us < 0)
+    return -1;
+  return usleep(us);
+}
+
+// Start a thread running fn(arg1, arg2) on the given stack page.
+int
+sys_clone(void)
+{
+  int fn, arg1, arg2, stack;
+
+  if(argint(0, &fn) < 0 || argint(1, &arg1) < 0 ||
+     argint(2, &arg2) < 0 || argint(3, &stack) < 0)
+    return -1;
+  return clone((void(*)(void*, void*))fn, (void*)arg1, (void*)arg2,
+               (void*)stack);
+}
+
+// Wait for a thread; store the stack it was given at *stack.
+int
+sys_join(void)
+{
+  void **stack;
+
+  if(argptr(0, (void*)&stack, sizeof(*stack)) < 0)
+    return -1;
+  return join(stack);
+}
+
+// Sleep while the word at addr holds val.
+int
+sys_futex_wait(void)
+{
+  int addr, val;
+
+  if(argint(0, &addr) < 0 || argint(1, &val) < 0)
+    return -1;
+  return futexwait(addr, val);
+}
+
+// Wake up to n processes sleeping on the word at addr.
+int
+sys_futex_wake(void)
+{
+  int addr, n;
+
+  if(argint(0, &addr) < 0 || argint(1, &n) < 0)
+    return -1;
+  return futexwake(addr, n);
+}
+
+// Restrict a process (0: the caller) to the CPUs in a mask.
+int
+sys_sched_setaffinity(void)
+{
+  int pid, mask;
+
+  if(argint(0, &pid) < 0 || argint(1, &mask) < 0)
+    return -1;
+  return setaffinity(pid, mask);
+}
+
+// The mask of CPUs a process (0: the caller) may run on.
+int
+sys_sched_getaffinity(void)
+{
+  int pid;
+  uint n;
+
+  if(argint(0, &pid) < 0)
+    return -1;
+  return getaffinity(pid, &n);
+}
+
+// The CPU the caller is running on; it may move at any time.
+int
+sys_getcpu(void)
+{
+  return cpuid();
+}
+
+// How many times a process (0: the caller) has changed CPUs.
+int
+sys_migrations(void)
+{
+  int pid;
+  uint n;
+
+  if(argint(0, &pid) < 0)
+    return -1;
+  if(getaffinity(pid, &n) < 0)
+    return -1;
+  return n;
+}
+
+// Fill in up to n struct cpustat; return the number of CPUs.
+int
+sys_cpustat(void)
+{
+  struct cpustat *st;
+  struct cpu *c;
+  uint64 now;
+  int n, i;
+
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  // No more than there are, so that n*sizeof cannot wrap.
+  if(n > ncpu)
+    n = ncpu;
+  if(argptr(0, (void*)&st, n*sizeof(*st)) < 0)
+    return -1;
+  now = rdtsc();
+  for(i = 0; i < n; i++){
+    c = &cpus[i];
+    st[i].idle = c->idlecycles;
+    st[i].busy = now - c->starttsc - c->idlecycles;
+    st[i].nipi = c->nipi;
+    st[i].nsteal = c->nsteal;
+    st[i].ntimer = c->ntimer;
+    st[i].nfpu = c->nfpu;
+  }
+  return ncpu;
+}
+
+// Fill in up to n struct lockstat; return how many.
+int
+sys_lockstat(void)
+{
+  struct lockstat *st;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  // No more than there can be, so that n*sizeof cannot wrap.
+  if(n > NLOCKSTAT)
+    n = NLOCKSTAT;
+  if(argptr(0, (void*)&st, n*sizeof(*st)) < 0)
+    return -1;
+  return lockstat(st, n);
+}
+
+// Control the lock profiler, or read up to n struct lockprof
+// from it; see lockprofile().
+int
+sys_lockprof(void)
+{
+  struct lockprof *lp;
+  int cmd, n;
+
+  if(argint(0, &cmd) < 0 || argint(2, &n) < 0 || n < 0)
+    return -1;
+  if(cmd != LOCKPROF_READ)
+    return lockprofile(cmd, 0, 0);
+  // No more than there can be, so that n*sizeof cannot wrap.
+  if(n > NCPU*NLOCKPROF)
+    n = NCPU*NLOCKPROF;
+  if(argptr(1, (void*)&lp, n*sizeof(*lp)) < 0)
+    return -1;
+  return lockprofile(cmd, lp, n);
+}
+
+// Fill in a struct bcachestat.
+int
+sys_bcachestat(void)
+{
+  struct bcachestat *st;
+
+  if(argptr(0, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  bcachestat(st);
+  return 0;
+}
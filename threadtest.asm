@@ -0,0 +1,2295 @@
+
+_threadtest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    fail("stale TLB entry after madvise");
+}
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 04             	sub    $0x4,%esp
+  sharing();
+      11:	e8 fa 01 00 00       	call   210 <sharing>
+  growing();
+      16:	e8 f5 02 00 00       	call   310 <growing>
+  files();
+      1b:	e8 e0 03 00 00       	call   400 <files>
+  shrinking();
+      20:	e8 db 04 00 00       	call   500 <shrinking>
+  shootdown();
+      25:	e8 a6 06 00 00       	call   6d0 <shootdown>
+  printf(1, "threadtest ok\n");
+      2a:	83 ec 08             	sub    $0x8,%esp
+      2d:	68 c7 12 00 00       	push   $0x12c7
+      32:	6a 01                	push   $0x1
+      34:	e8 77 0e 00 00       	call   eb0 <printf>
+  exit();
+      39:	e8 ee 0b 00 00       	call   c2c <exit>
+      3e:	66 90                	xchg   %ax,%ax
+
+00000040 <grow>:
+{
+      40:	55                   	push   %ebp
+      41:	89 e5                	mov    %esp,%ebp
+      43:	83 ec 14             	sub    $0x14,%esp
+  p = sbrk(PGSIZE);
+      46:	68 00 10 00 00       	push   $0x1000
+      4b:	e8 97 0c 00 00       	call   ce7 <sbrk>
+  p[0] = 'x';
+      50:	c6 00 78             	movb   $0x78,(%eax)
+  grown = p;
+      53:	a3 68 19 00 00       	mov    %eax,0x1968
+  exit();
+      58:	e8 cf 0b 00 00       	call   c2c <exit>
+      5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000060 <incr>:
+{
+      60:	55                   	push   %ebp
+      61:	89 e5                	mov    %esp,%ebp
+      63:	83 ec 08             	sub    $0x8,%esp
+      66:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(i = 0; i < n; i++)
+      69:	85 d2                	test   %edx,%edx
+      6b:	7e 12                	jle    7f <incr+0x1f>
+      6d:	31 c0                	xor    %eax,%eax
+      6f:	90                   	nop
+    __sync_fetch_and_add(&counter, 1);
+      70:	f0 83 05 74 19 00 00 	lock addl $0x1,0x1974
+      77:	01 
+  for(i = 0; i < n; i++)
+      78:	83 c0 01             	add    $0x1,%eax
+      7b:	39 c2                	cmp    %eax,%edx
+      7d:	75 f1                	jne    70 <incr+0x10>
+  exit();
+      7f:	e8 a8 0b 00 00       	call   c2c <exit>
+      84:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      8f:	90                   	nop
+
+00000090 <opener>:
+{
+      90:	55                   	push   %ebp
+      91:	89 e5                	mov    %esp,%ebp
+      93:	83 ec 10             	sub    $0x10,%esp
+  openfd = open("threadtest", O_RDONLY);
+      96:	6a 00                	push   $0x0
+      98:	68 d8 11 00 00       	push   $0x11d8
+      9d:	e8 e2 0b 00 00       	call   c84 <open>
+      a2:	a3 60 19 00 00       	mov    %eax,0x1960
+  exit();
+      a7:	e8 80 0b 00 00       	call   c2c <exit>
+      ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000b0 <reader>:
+{
+      b0:	55                   	push   %ebp
+      b1:	89 e5                	mov    %esp,%ebp
+      b3:	83 ec 0c             	sub    $0xc,%esp
+  ready = 1;
+      b6:	c7 05 70 19 00 00 01 	movl   $0x1,0x1970
+      bd:	00 00 00 
+  nread = read(pfd[0], (char*)a, 1);
+      c0:	6a 01                	push   $0x1
+      c2:	ff 75 08             	push   0x8(%ebp)
+      c5:	ff 35 54 19 00 00    	push   0x1954
+      cb:	e8 7d 0b 00 00       	call   c4d <read>
+      d0:	a3 5c 19 00 00       	mov    %eax,0x195c
+  exit();
+      d5:	e8 52 0b 00 00       	call   c2c <exit>
+      da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000000e0 <watch>:
+{
+      e0:	55                   	push   %ebp
+      e1:	89 e5                	mov    %esp,%ebp
+      e3:	53                   	push   %ebx
+      e4:	83 ec 04             	sub    $0x4,%esp
+  ready = 1;
+      e7:	c7 05 70 19 00 00 01 	movl   $0x1,0x1970
+      ee:	00 00 00 
+  start = uptime();
+      f1:	e8 7a 09 00 00       	call   a70 <uptime>
+      f6:	89 c3                	mov    %eax,%ebx
+  while(*shared != 0){
+      f8:	eb 12                	jmp    10c <watch+0x2c>
+      fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(uptime() - start > 100){
+     100:	e8 6b 09 00 00       	call   a70 <uptime>
+     105:	29 d8                	sub    %ebx,%eax
+     107:	83 f8 64             	cmp    $0x64,%eax
+     10a:	7f 10                	jg     11c <watch+0x3c>
+  while(*shared != 0){
+     10c:	a1 64 19 00 00       	mov    0x1964,%eax
+     111:	8b 00                	mov    (%eax),%eax
+     113:	85 c0                	test   %eax,%eax
+     115:	75 e9                	jne    100 <watch+0x20>
+  exit();
+     117:	e8 10 0b 00 00       	call   c2c <exit>
+      stale = 1;
+     11c:	c7 05 6c 19 00 00 01 	movl   $0x1,0x196c
+     123:	00 00 00 
+      break;
+     126:	eb ef                	jmp    117 <watch+0x37>
+     128:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     12f:	90                   	nop
+
+00000130 <fail>:
+{
+     130:	55                   	push   %ebp
+     131:	89 e5                	mov    %esp,%ebp
+     133:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "threadtest: %s\n", msg);
+     136:	ff 75 08             	push   0x8(%ebp)
+     139:	68 e3 11 00 00       	push   $0x11e3
+     13e:	6a 01                	push   $0x1
+     140:	e8 6b 0d 00 00       	call   eb0 <printf>
+  exit();
+     145:	e8 e2 0a 00 00       	call   c2c <exit>
+     14a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000150 <stackalloc>:
+{
+     150:	55                   	push   %ebp
+     151:	89 e5                	mov    %esp,%ebp
+     153:	83 ec 14             	sub    $0x14,%esp
+  p = (uint)sbrk(2*PGSIZE);
+     156:	68 00 20 00 00       	push   $0x2000
+     15b:	e8 87 0b 00 00       	call   ce7 <sbrk>
+  if(p == 0xffffffff)
+     160:	83 c4 10             	add    $0x10,%esp
+     163:	83 f8 ff             	cmp    $0xffffffff,%eax
+     166:	74 0c                	je     174 <stackalloc+0x24>
+}
+     168:	c9                   	leave
+  return (void*)((p + PGSIZE-1) & ~(PGSIZE-1));
+     169:	05 ff 0f 00 00       	add    $0xfff,%eax
+     16e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+}
+     173:	c3                   	ret
+    fail("sbrk");
+     174:	83 ec 0c             	sub    $0xc,%esp
+     177:	68 f3 11 00 00       	push   $0x11f3
+     17c:	e8 af ff ff ff       	call   130 <fail>
+     181:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     188:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     18f:	90                   	nop
+
+00000190 <joinall>:
+{
+     190:	55                   	push   %ebp
+     191:	89 e5                	mov    %esp,%ebp
+     193:	57                   	push   %edi
+     194:	56                   	push   %esi
+     195:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+     198:	53                   	push   %ebx
+     199:	83 ec 1c             	sub    $0x1c,%esp
+     19c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; i < n; i++)
+     19f:	85 ff                	test   %edi,%edi
+     1a1:	7e 2c                	jle    1cf <joinall+0x3f>
+     1a3:	31 db                	xor    %ebx,%ebx
+     1a5:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+     1a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1af:	90                   	nop
+    if(join(&stack) < 0 || (uint)stack % PGSIZE != 0)
+     1b0:	83 ec 0c             	sub    $0xc,%esp
+     1b3:	56                   	push   %esi
+     1b4:	e8 d3 0b 00 00       	call   d8c <join>
+     1b9:	83 c4 10             	add    $0x10,%esp
+     1bc:	85 c0                	test   %eax,%eax
+     1be:	78 28                	js     1e8 <joinall+0x58>
+     1c0:	66 f7 45 e4 ff 0f    	testw  $0xfff,-0x1c(%ebp)
+     1c6:	75 20                	jne    1e8 <joinall+0x58>
+  for(i = 0; i < n; i++)
+     1c8:	83 c3 01             	add    $0x1,%ebx
+     1cb:	39 df                	cmp    %ebx,%edi
+     1cd:	75 e1                	jne    1b0 <joinall+0x20>
+  if(join(&stack) != -1)
+     1cf:	83 ec 0c             	sub    $0xc,%esp
+     1d2:	56                   	push   %esi
+     1d3:	e8 b4 0b 00 00       	call   d8c <join>
+     1d8:	83 c4 10             	add    $0x10,%esp
+     1db:	83 f8 ff             	cmp    $0xffffffff,%eax
+     1de:	75 15                	jne    1f5 <joinall+0x65>
+}
+     1e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     1e3:	5b                   	pop    %ebx
+     1e4:	5e                   	pop    %esi
+     1e5:	5f                   	pop    %edi
+     1e6:	5d                   	pop    %ebp
+     1e7:	c3                   	ret
+      fail("join");
+     1e8:	83 ec 0c             	sub    $0xc,%esp
+     1eb:	68 f8 11 00 00       	push   $0x11f8
+     1f0:	e8 3b ff ff ff       	call   130 <fail>
+    fail("join with no threads left");
+     1f5:	83 ec 0c             	sub    $0xc,%esp
+     1f8:	68 fd 11 00 00       	push   $0x11fd
+     1fd:	e8 2e ff ff ff       	call   130 <fail>
+     202:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     209:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000210 <sharing>:
+{
+     210:	55                   	push   %ebp
+     211:	89 e5                	mov    %esp,%ebp
+     213:	56                   	push   %esi
+     214:	53                   	push   %ebx
+  counter = 0;
+     215:	bb 04 00 00 00       	mov    $0x4,%ebx
+{
+     21a:	83 ec 10             	sub    $0x10,%esp
+  counter = 0;
+     21d:	c7 05 74 19 00 00 00 	movl   $0x0,0x1974
+     224:	00 00 00 
+  p = (uint)sbrk(2*PGSIZE);
+     227:	83 ec 0c             	sub    $0xc,%esp
+     22a:	68 00 20 00 00       	push   $0x2000
+     22f:	e8 b3 0a 00 00       	call   ce7 <sbrk>
+  if(p == 0xffffffff)
+     234:	83 c4 10             	add    $0x10,%esp
+     237:	83 f8 ff             	cmp    $0xffffffff,%eax
+     23a:	0f 84 95 00 00 00    	je     2d5 <sharing+0xc5>
+  return (void*)((p + PGSIZE-1) & ~(PGSIZE-1));
+     240:	05 ff 0f 00 00       	add    $0xfff,%eax
+     245:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    if(clone(incr, (void*)NINCR, 0, stackalloc()) < 0)
+     24a:	50                   	push   %eax
+     24b:	6a 00                	push   $0x0
+     24d:	68 a0 86 01 00       	push   $0x186a0
+     252:	68 60 00 00 00       	push   $0x60
+     257:	e8 25 0b 00 00       	call   d81 <clone>
+     25c:	83 c4 10             	add    $0x10,%esp
+     25f:	85 c0                	test   %eax,%eax
+     261:	78 65                	js     2c8 <sharing+0xb8>
+  for(i = 0; i < NTHREAD; i++)
+     263:	83 eb 01             	sub    $0x1,%ebx
+     266:	75 bf                	jne    227 <sharing+0x17>
+     268:	bb 04 00 00 00       	mov    $0x4,%ebx
+     26d:	8d 75 f4             	lea    -0xc(%ebp),%esi
+    if(join(&stack) < 0 || (uint)stack % PGSIZE != 0)
+     270:	83 ec 0c             	sub    $0xc,%esp
+     273:	56                   	push   %esi
+     274:	e8 13 0b 00 00       	call   d8c <join>
+     279:	83 c4 10             	add    $0x10,%esp
+     27c:	85 c0                	test   %eax,%eax
+     27e:	78 3b                	js     2bb <sharing+0xab>
+     280:	66 f7 45 f4 ff 0f    	testw  $0xfff,-0xc(%ebp)
+     286:	75 33                	jne    2bb <sharing+0xab>
+  for(i = 0; i < n; i++)
+     288:	83 eb 01             	sub    $0x1,%ebx
+     28b:	75 e3                	jne    270 <sharing+0x60>
+  if(join(&stack) != -1)
+     28d:	83 ec 0c             	sub    $0xc,%esp
+     290:	56                   	push   %esi
+     291:	e8 f6 0a 00 00       	call   d8c <join>
+     296:	83 c4 10             	add    $0x10,%esp
+     299:	83 f8 ff             	cmp    $0xffffffff,%eax
+     29c:	75 5e                	jne    2fc <sharing+0xec>
+  if(counter != NTHREAD*NINCR)
+     29e:	a1 74 19 00 00       	mov    0x1974,%eax
+     2a3:	3d 80 1a 06 00       	cmp    $0x61a80,%eax
+     2a8:	75 45                	jne    2ef <sharing+0xdf>
+  if(wait() != -1)
+     2aa:	e8 88 09 00 00       	call   c37 <wait>
+     2af:	83 f8 ff             	cmp    $0xffffffff,%eax
+     2b2:	75 2e                	jne    2e2 <sharing+0xd2>
+}
+     2b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     2b7:	5b                   	pop    %ebx
+     2b8:	5e                   	pop    %esi
+     2b9:	5d                   	pop    %ebp
+     2ba:	c3                   	ret
+      fail("join");
+     2bb:	83 ec 0c             	sub    $0xc,%esp
+     2be:	68 f8 11 00 00       	push   $0x11f8
+     2c3:	e8 68 fe ff ff       	call   130 <fail>
+      fail("clone");
+     2c8:	83 ec 0c             	sub    $0xc,%esp
+     2cb:	68 17 12 00 00       	push   $0x1217
+     2d0:	e8 5b fe ff ff       	call   130 <fail>
+    fail("sbrk");
+     2d5:	83 ec 0c             	sub    $0xc,%esp
+     2d8:	68 f3 11 00 00       	push   $0x11f3
+     2dd:	e8 4e fe ff ff       	call   130 <fail>
+    fail("wait reaped a thread");
+     2e2:	83 ec 0c             	sub    $0xc,%esp
+     2e5:	68 2d 12 00 00       	push   $0x122d
+     2ea:	e8 41 fe ff ff       	call   130 <fail>
+    fail("lost increments");
+     2ef:	83 ec 0c             	sub    $0xc,%esp
+     2f2:	68 1d 12 00 00       	push   $0x121d
+     2f7:	e8 34 fe ff ff       	call   130 <fail>
+    fail("join with no threads left");
+     2fc:	83 ec 0c             	sub    $0xc,%esp
+     2ff:	68 fd 11 00 00       	push   $0x11fd
+     304:	e8 27 fe ff ff       	call   130 <fail>
+     309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <growing>:
+{
+     310:	55                   	push   %ebp
+     311:	89 e5                	mov    %esp,%ebp
+     313:	53                   	push   %ebx
+     314:	83 ec 20             	sub    $0x20,%esp
+  grown = 0;
+     317:	c7 05 68 19 00 00 00 	movl   $0x0,0x1968
+     31e:	00 00 00 
+  p = (uint)sbrk(2*PGSIZE);
+     321:	68 00 20 00 00       	push   $0x2000
+     326:	e8 bc 09 00 00       	call   ce7 <sbrk>
+  if(p == 0xffffffff)
+     32b:	83 c4 10             	add    $0x10,%esp
+     32e:	83 f8 ff             	cmp    $0xffffffff,%eax
+     331:	0f 84 94 00 00 00    	je     3cb <growing+0xbb>
+  return (void*)((p + PGSIZE-1) & ~(PGSIZE-1));
+     337:	05 ff 0f 00 00       	add    $0xfff,%eax
+     33c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  if(clone(grow, 0, 0, stackalloc()) < 0)
+     341:	50                   	push   %eax
+     342:	6a 00                	push   $0x0
+     344:	6a 00                	push   $0x0
+     346:	68 40 00 00 00       	push   $0x40
+     34b:	e8 31 0a 00 00       	call   d81 <clone>
+     350:	83 c4 10             	add    $0x10,%esp
+     353:	85 c0                	test   %eax,%eax
+     355:	78 67                	js     3be <growing+0xae>
+    if(join(&stack) < 0 || (uint)stack % PGSIZE != 0)
+     357:	83 ec 0c             	sub    $0xc,%esp
+     35a:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+     35d:	53                   	push   %ebx
+     35e:	e8 29 0a 00 00       	call   d8c <join>
+     363:	83 c4 10             	add    $0x10,%esp
+     366:	85 c0                	test   %eax,%eax
+     368:	78 47                	js     3b1 <growing+0xa1>
+     36a:	66 f7 45 f4 ff 0f    	testw  $0xfff,-0xc(%ebp)
+     370:	75 3f                	jne    3b1 <growing+0xa1>
+  if(join(&stack) != -1)
+     372:	83 ec 0c             	sub    $0xc,%esp
+     375:	53                   	push   %ebx
+     376:	e8 11 0a 00 00       	call   d8c <join>
+     37b:	83 c4 10             	add    $0x10,%esp
+     37e:	83 f8 ff             	cmp    $0xffffffff,%eax
+     381:	75 62                	jne    3e5 <growing+0xd5>
+  brk = sbrk(0);
+     383:	83 ec 0c             	sub    $0xc,%esp
+     386:	6a 00                	push   $0x0
+     388:	e8 5a 09 00 00       	call   ce7 <sbrk>
+  if(grown == 0 || grown[0] != 'x' || brk < grown + PGSIZE)
+     38d:	8b 15 68 19 00 00    	mov    0x1968,%edx
+     393:	83 c4 10             	add    $0x10,%esp
+     396:	85 d2                	test   %edx,%edx
+     398:	74 3e                	je     3d8 <growing+0xc8>
+     39a:	0f b6 0a             	movzbl (%edx),%ecx
+     39d:	80 f9 78             	cmp    $0x78,%cl
+     3a0:	75 36                	jne    3d8 <growing+0xc8>
+     3a2:	81 c2 00 10 00 00    	add    $0x1000,%edx
+     3a8:	39 d0                	cmp    %edx,%eax
+     3aa:	72 2c                	jb     3d8 <growing+0xc8>
+}
+     3ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3af:	c9                   	leave
+     3b0:	c3                   	ret
+      fail("join");
+     3b1:	83 ec 0c             	sub    $0xc,%esp
+     3b4:	68 f8 11 00 00       	push   $0x11f8
+     3b9:	e8 72 fd ff ff       	call   130 <fail>
+    fail("clone");
+     3be:	83 ec 0c             	sub    $0xc,%esp
+     3c1:	68 17 12 00 00       	push   $0x1217
+     3c6:	e8 65 fd ff ff       	call   130 <fail>
+    fail("sbrk");
+     3cb:	83 ec 0c             	sub    $0xc,%esp
+     3ce:	68 f3 11 00 00       	push   $0x11f3
+     3d3:	e8 58 fd ff ff       	call   130 <fail>
+    fail("sbrk in a thread not seen");
+     3d8:	83 ec 0c             	sub    $0xc,%esp
+     3db:	68 42 12 00 00       	push   $0x1242
+     3e0:	e8 4b fd ff ff       	call   130 <fail>
+    fail("join with no threads left");
+     3e5:	83 ec 0c             	sub    $0xc,%esp
+     3e8:	68 fd 11 00 00       	push   $0x11fd
+     3ed:	e8 3e fd ff ff       	call   130 <fail>
+     3f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <files>:
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	53                   	push   %ebx
+     404:	83 ec 30             	sub    $0x30,%esp
+  openfd = -1;
+     407:	c7 05 60 19 00 00 ff 	movl   $0xffffffff,0x1960
+     40e:	ff ff ff 
+  p = (uint)sbrk(2*PGSIZE);
+     411:	68 00 20 00 00       	push   $0x2000
+     416:	e8 cc 08 00 00       	call   ce7 <sbrk>
+  if(p == 0xffffffff)
+     41b:	83 c4 10             	add    $0x10,%esp
+     41e:	83 f8 ff             	cmp    $0xffffffff,%eax
+     421:	0f 84 9f 00 00 00    	je     4c6 <files+0xc6>
+  return (void*)((p + PGSIZE-1) & ~(PGSIZE-1));
+     427:	05 ff 0f 00 00       	add    $0xfff,%eax
+     42c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  if(clone(opener, 0, 0, stackalloc()) < 0)
+     431:	50                   	push   %eax
+     432:	6a 00                	push   $0x0
+     434:	6a 00                	push   $0x0
+     436:	68 90 00 00 00       	push   $0x90
+     43b:	e8 41 09 00 00       	call   d81 <clone>
+     440:	83 c4 10             	add    $0x10,%esp
+     443:	85 c0                	test   %eax,%eax
+     445:	78 72                	js     4b9 <files+0xb9>
+    if(join(&stack) < 0 || (uint)stack % PGSIZE != 0)
+     447:	83 ec 0c             	sub    $0xc,%esp
+     44a:	8d 5d e4             	lea    -0x1c(%ebp),%ebx
+     44d:	53                   	push   %ebx
+     44e:	e8 39 09 00 00       	call   d8c <join>
+     453:	83 c4 10             	add    $0x10,%esp
+     456:	85 c0                	test   %eax,%eax
+     458:	78 52                	js     4ac <files+0xac>
+     45a:	66 f7 45 e4 ff 0f    	testw  $0xfff,-0x1c(%ebp)
+     460:	75 4a                	jne    4ac <files+0xac>
+  if(join(&stack) != -1)
+     462:	83 ec 0c             	sub    $0xc,%esp
+     465:	53                   	push   %ebx
+     466:	e8 21 09 00 00       	call   d8c <join>
+     46b:	83 c4 10             	add    $0x10,%esp
+     46e:	83 f8 ff             	cmp    $0xffffffff,%eax
+     471:	75 7a                	jne    4ed <files+0xed>
+  if(openfd < 0)
+     473:	a1 60 19 00 00       	mov    0x1960,%eax
+     478:	85 c0                	test   %eax,%eax
+     47a:	78 64                	js     4e0 <files+0xe0>
+  if(fstat(openfd, &st) < 0 || close(openfd) < 0)
+     47c:	a1 60 19 00 00       	mov    0x1960,%eax
+     481:	83 ec 08             	sub    $0x8,%esp
+     484:	53                   	push   %ebx
+     485:	50                   	push   %eax
+     486:	e8 1a 08 00 00       	call   ca5 <fstat>
+     48b:	83 c4 10             	add    $0x10,%esp
+     48e:	85 c0                	test   %eax,%eax
+     490:	78 41                	js     4d3 <files+0xd3>
+     492:	a1 60 19 00 00       	mov    0x1960,%eax
+     497:	83 ec 0c             	sub    $0xc,%esp
+     49a:	50                   	push   %eax
+     49b:	e8 c3 07 00 00       	call   c63 <close>
+     4a0:	83 c4 10             	add    $0x10,%esp
+     4a3:	85 c0                	test   %eax,%eax
+     4a5:	78 2c                	js     4d3 <files+0xd3>
+}
+     4a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4aa:	c9                   	leave
+     4ab:	c3                   	ret
+      fail("join");
+     4ac:	83 ec 0c             	sub    $0xc,%esp
+     4af:	68 f8 11 00 00       	push   $0x11f8
+     4b4:	e8 77 fc ff ff       	call   130 <fail>
+    fail("clone");
+     4b9:	83 ec 0c             	sub    $0xc,%esp
+     4bc:	68 17 12 00 00       	push   $0x1217
+     4c1:	e8 6a fc ff ff       	call   130 <fail>
+    fail("sbrk");
+     4c6:	83 ec 0c             	sub    $0xc,%esp
+     4c9:	68 f3 11 00 00       	push   $0x11f3
+     4ce:	e8 5d fc ff ff       	call   130 <fail>
+    fail("file opened in a thread not seen");
+     4d3:	83 ec 0c             	sub    $0xc,%esp
+     4d6:	68 d8 12 00 00       	push   $0x12d8
+     4db:	e8 50 fc ff ff       	call   130 <fail>
+    fail("open in a thread");
+     4e0:	83 ec 0c             	sub    $0xc,%esp
+     4e3:	68 5c 12 00 00       	push   $0x125c
+     4e8:	e8 43 fc ff ff       	call   130 <fail>
+    fail("join with no threads left");
+     4ed:	83 ec 0c             	sub    $0xc,%esp
+     4f0:	68 fd 11 00 00       	push   $0x11fd
+     4f5:	e8 36 fc ff ff       	call   130 <fail>
+     4fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000500 <shrinking>:
+{
+     500:	55                   	push   %ebp
+     501:	89 e5                	mov    %esp,%ebp
+     503:	56                   	push   %esi
+     504:	53                   	push   %ebx
+     505:	83 ec 1c             	sub    $0x1c,%esp
+  if(pipe(pfd) < 0)
+     508:	68 54 19 00 00       	push   $0x1954
+     50d:	e8 30 07 00 00       	call   c42 <pipe>
+     512:	83 c4 10             	add    $0x10,%esp
+     515:	85 c0                	test   %eax,%eax
+     517:	0f 88 74 01 00 00    	js     691 <shrinking+0x191>
+  p = (uint)sbrk(2*PGSIZE);
+     51d:	83 ec 0c             	sub    $0xc,%esp
+     520:	68 00 20 00 00       	push   $0x2000
+     525:	e8 bd 07 00 00       	call   ce7 <sbrk>
+  if(p == 0xffffffff)
+     52a:	83 c4 10             	add    $0x10,%esp
+  p = (uint)sbrk(2*PGSIZE);
+     52d:	89 c3                	mov    %eax,%ebx
+  if(p == 0xffffffff)
+     52f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     532:	0f 84 4c 01 00 00    	je     684 <shrinking+0x184>
+  buf = sbrk(PGSIZE) + PGSIZE - 1;
+     538:	83 ec 0c             	sub    $0xc,%esp
+  return (void*)((p + PGSIZE-1) & ~(PGSIZE-1));
+     53b:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+  buf = sbrk(PGSIZE) + PGSIZE - 1;
+     541:	68 00 10 00 00       	push   $0x1000
+  return (void*)((p + PGSIZE-1) & ~(PGSIZE-1));
+     546:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  buf = sbrk(PGSIZE) + PGSIZE - 1;
+     54c:	e8 96 07 00 00       	call   ce7 <sbrk>
+  ready = 0;
+     551:	c7 05 70 19 00 00 00 	movl   $0x0,0x1970
+     558:	00 00 00 
+  buf = sbrk(PGSIZE) + PGSIZE - 1;
+     55b:	89 c6                	mov    %eax,%esi
+     55d:	8d 80 ff 0f 00 00    	lea    0xfff(%eax),%eax
+  if(clone(reader, buf, 0, stack) < 0)
+     563:	53                   	push   %ebx
+     564:	6a 00                	push   $0x0
+     566:	50                   	push   %eax
+     567:	68 b0 00 00 00       	push   $0xb0
+     56c:	e8 10 08 00 00       	call   d81 <clone>
+     571:	83 c4 20             	add    $0x20,%esp
+     574:	85 c0                	test   %eax,%eax
+     576:	0f 88 fb 00 00 00    	js     677 <shrinking+0x177>
+     57c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while(!ready)
+     580:	a1 70 19 00 00       	mov    0x1970,%eax
+     585:	85 c0                	test   %eax,%eax
+     587:	74 f7                	je     580 <shrinking+0x80>
+  sleep(1);
+     589:	83 ec 0c             	sub    $0xc,%esp
+     58c:	6a 01                	push   $0x1
+     58e:	e8 5f 07 00 00       	call   cf2 <sleep>
+  if(sbrk(-PGSIZE) != (char*)-1)
+     593:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+     59a:	e8 48 07 00 00       	call   ce7 <sbrk>
+     59f:	83 c4 10             	add    $0x10,%esp
+     5a2:	83 f8 ff             	cmp    $0xffffffff,%eax
+     5a5:	0f 85 bf 00 00 00    	jne    66a <shrinking+0x16a>
+  if(write(pfd[1], "x", 1) != 1)
+     5ab:	83 ec 04             	sub    $0x4,%esp
+     5ae:	6a 01                	push   $0x1
+     5b0:	68 8d 12 00 00       	push   $0x128d
+     5b5:	ff 35 58 19 00 00    	push   0x1958
+     5bb:	e8 98 06 00 00       	call   c58 <write>
+     5c0:	83 c4 10             	add    $0x10,%esp
+     5c3:	83 f8 01             	cmp    $0x1,%eax
+     5c6:	0f 85 91 00 00 00    	jne    65d <shrinking+0x15d>
+    if(join(&stack) < 0 || (uint)stack % PGSIZE != 0)
+     5cc:	83 ec 0c             	sub    $0xc,%esp
+     5cf:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+     5d2:	53                   	push   %ebx
+     5d3:	e8 b4 07 00 00       	call   d8c <join>
+     5d8:	83 c4 10             	add    $0x10,%esp
+     5db:	85 c0                	test   %eax,%eax
+     5dd:	78 71                	js     650 <shrinking+0x150>
+     5df:	66 f7 45 f4 ff 0f    	testw  $0xfff,-0xc(%ebp)
+     5e5:	75 69                	jne    650 <shrinking+0x150>
+  if(join(&stack) != -1)
+     5e7:	83 ec 0c             	sub    $0xc,%esp
+     5ea:	53                   	push   %ebx
+     5eb:	e8 9c 07 00 00       	call   d8c <join>
+     5f0:	83 c4 10             	add    $0x10,%esp
+     5f3:	83 f8 ff             	cmp    $0xffffffff,%eax
+     5f6:	0f 85 bc 00 00 00    	jne    6b8 <shrinking+0x1b8>
+  if(nread != 1 || *buf != 'x')
+     5fc:	a1 5c 19 00 00       	mov    0x195c,%eax
+     601:	83 f8 01             	cmp    $0x1,%eax
+     604:	0f 85 a1 00 00 00    	jne    6ab <shrinking+0x1ab>
+     60a:	80 be ff 0f 00 00 78 	cmpb   $0x78,0xfff(%esi)
+     611:	0f 85 94 00 00 00    	jne    6ab <shrinking+0x1ab>
+  if(sbrk(-PGSIZE) == (char*)-1)
+     617:	83 ec 0c             	sub    $0xc,%esp
+     61a:	68 00 f0 ff ff       	push   $0xfffff000
+     61f:	e8 c3 06 00 00       	call   ce7 <sbrk>
+     624:	83 c4 10             	add    $0x10,%esp
+     627:	83 f8 ff             	cmp    $0xffffffff,%eax
+     62a:	74 72                	je     69e <shrinking+0x19e>
+  close(pfd[0]);
+     62c:	83 ec 0c             	sub    $0xc,%esp
+     62f:	ff 35 54 19 00 00    	push   0x1954
+     635:	e8 29 06 00 00       	call   c63 <close>
+  close(pfd[1]);
+     63a:	58                   	pop    %eax
+     63b:	ff 35 58 19 00 00    	push   0x1958
+     641:	e8 1d 06 00 00       	call   c63 <close>
+}
+     646:	83 c4 10             	add    $0x10,%esp
+     649:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     64c:	5b                   	pop    %ebx
+     64d:	5e                   	pop    %esi
+     64e:	5d                   	pop    %ebp
+     64f:	c3                   	ret
+      fail("join");
+     650:	83 ec 0c             	sub    $0xc,%esp
+     653:	68 f8 11 00 00       	push   $0x11f8
+     658:	e8 d3 fa ff ff       	call   130 <fail>
+    fail("write");
+     65d:	83 ec 0c             	sub    $0xc,%esp
+     660:	68 8f 12 00 00       	push   $0x128f
+     665:	e8 c6 fa ff ff       	call   130 <fail>
+    fail("sbrk freed a buffer in use");
+     66a:	83 ec 0c             	sub    $0xc,%esp
+     66d:	68 72 12 00 00       	push   $0x1272
+     672:	e8 b9 fa ff ff       	call   130 <fail>
+    fail("clone");
+     677:	83 ec 0c             	sub    $0xc,%esp
+     67a:	68 17 12 00 00       	push   $0x1217
+     67f:	e8 ac fa ff ff       	call   130 <fail>
+    fail("sbrk");
+     684:	83 ec 0c             	sub    $0xc,%esp
+     687:	68 f3 11 00 00       	push   $0x11f3
+     68c:	e8 9f fa ff ff       	call   130 <fail>
+    fail("pipe");
+     691:	83 ec 0c             	sub    $0xc,%esp
+     694:	68 6d 12 00 00       	push   $0x126d
+     699:	e8 92 fa ff ff       	call   130 <fail>
+    fail("sbrk after the read");
+     69e:	83 ec 0c             	sub    $0xc,%esp
+     6a1:	68 95 12 00 00       	push   $0x1295
+     6a6:	e8 85 fa ff ff       	call   130 <fail>
+    fail("read into a buffer sbrk tried to free");
+     6ab:	83 ec 0c             	sub    $0xc,%esp
+     6ae:	68 fc 12 00 00       	push   $0x12fc
+     6b3:	e8 78 fa ff ff       	call   130 <fail>
+    fail("join with no threads left");
+     6b8:	83 ec 0c             	sub    $0xc,%esp
+     6bb:	68 fd 11 00 00       	push   $0x11fd
+     6c0:	e8 6b fa ff ff       	call   130 <fail>
+     6c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006d0 <shootdown>:
+{
+     6d0:	55                   	push   %ebp
+     6d1:	89 e5                	mov    %esp,%ebp
+     6d3:	53                   	push   %ebx
+     6d4:	83 ec 20             	sub    $0x20,%esp
+  p = (uint)sbrk(2*PGSIZE);
+     6d7:	68 00 20 00 00       	push   $0x2000
+     6dc:	e8 06 06 00 00       	call   ce7 <sbrk>
+  if(p == 0xffffffff)
+     6e1:	83 c4 10             	add    $0x10,%esp
+     6e4:	83 f8 ff             	cmp    $0xffffffff,%eax
+     6e7:	0f 84 fb 00 00 00    	je     7e8 <shootdown+0x118>
+  return (void*)((p + PGSIZE-1) & ~(PGSIZE-1));
+     6ed:	05 ff 0f 00 00       	add    $0xfff,%eax
+  p = (uint)sbrk(2*PGSIZE);
+     6f2:	83 ec 0c             	sub    $0xc,%esp
+  return (void*)((p + PGSIZE-1) & ~(PGSIZE-1));
+     6f5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  shared = (int*)stackalloc();
+     6fa:	a3 64 19 00 00       	mov    %eax,0x1964
+  *shared = 1;
+     6ff:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  ready = stale = 0;
+     705:	c7 05 6c 19 00 00 00 	movl   $0x0,0x196c
+     70c:	00 00 00 
+     70f:	c7 05 70 19 00 00 00 	movl   $0x0,0x1970
+     716:	00 00 00 
+  p = (uint)sbrk(2*PGSIZE);
+     719:	68 00 20 00 00       	push   $0x2000
+     71e:	e8 c4 05 00 00       	call   ce7 <sbrk>
+  if(p == 0xffffffff)
+     723:	83 c4 10             	add    $0x10,%esp
+     726:	83 f8 ff             	cmp    $0xffffffff,%eax
+     729:	0f 84 b9 00 00 00    	je     7e8 <shootdown+0x118>
+  return (void*)((p + PGSIZE-1) & ~(PGSIZE-1));
+     72f:	05 ff 0f 00 00       	add    $0xfff,%eax
+     734:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  if(clone(watch, 0, 0, stackalloc()) < 0)
+     739:	50                   	push   %eax
+     73a:	6a 00                	push   $0x0
+     73c:	6a 00                	push   $0x0
+     73e:	68 e0 00 00 00       	push   $0xe0
+     743:	e8 39 06 00 00       	call   d81 <clone>
+     748:	83 c4 10             	add    $0x10,%esp
+     74b:	85 c0                	test   %eax,%eax
+     74d:	0f 88 88 00 00 00    	js     7db <shootdown+0x10b>
+     753:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     757:	90                   	nop
+  while(!ready)
+     758:	a1 70 19 00 00       	mov    0x1970,%eax
+     75d:	85 c0                	test   %eax,%eax
+     75f:	74 f7                	je     758 <shootdown+0x88>
+  sleep(1);
+     761:	83 ec 0c             	sub    $0xc,%esp
+     764:	6a 01                	push   $0x1
+     766:	e8 87 05 00 00       	call   cf2 <sleep>
+  if(madvise((void*)shared, PGSIZE, MADV_DONTNEED) < 0)
+     76b:	83 c4 0c             	add    $0xc,%esp
+     76e:	6a 04                	push   $0x4
+     770:	68 00 10 00 00       	push   $0x1000
+     775:	ff 35 64 19 00 00    	push   0x1964
+     77b:	e8 a9 05 00 00       	call   d29 <madvise>
+     780:	83 c4 10             	add    $0x10,%esp
+     783:	85 c0                	test   %eax,%eax
+     785:	78 47                	js     7ce <shootdown+0xfe>
+    if(join(&stack) < 0 || (uint)stack % PGSIZE != 0)
+     787:	83 ec 0c             	sub    $0xc,%esp
+     78a:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+     78d:	53                   	push   %ebx
+     78e:	e8 f9 05 00 00       	call   d8c <join>
+     793:	83 c4 10             	add    $0x10,%esp
+     796:	85 c0                	test   %eax,%eax
+     798:	78 27                	js     7c1 <shootdown+0xf1>
+     79a:	66 f7 45 f4 ff 0f    	testw  $0xfff,-0xc(%ebp)
+     7a0:	75 1f                	jne    7c1 <shootdown+0xf1>
+  if(join(&stack) != -1)
+     7a2:	83 ec 0c             	sub    $0xc,%esp
+     7a5:	53                   	push   %ebx
+     7a6:	e8 e1 05 00 00       	call   d8c <join>
+     7ab:	83 c4 10             	add    $0x10,%esp
+     7ae:	83 f8 ff             	cmp    $0xffffffff,%eax
+     7b1:	75 4f                	jne    802 <shootdown+0x132>
+  if(stale)
+     7b3:	a1 6c 19 00 00       	mov    0x196c,%eax
+     7b8:	85 c0                	test   %eax,%eax
+     7ba:	75 39                	jne    7f5 <shootdown+0x125>
+}
+     7bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7bf:	c9                   	leave
+     7c0:	c3                   	ret
+      fail("join");
+     7c1:	83 ec 0c             	sub    $0xc,%esp
+     7c4:	68 f8 11 00 00       	push   $0x11f8
+     7c9:	e8 62 f9 ff ff       	call   130 <fail>
+    fail("madvise");
+     7ce:	83 ec 0c             	sub    $0xc,%esp
+     7d1:	68 bf 12 00 00       	push   $0x12bf
+     7d6:	e8 55 f9 ff ff       	call   130 <fail>
+    fail("clone");
+     7db:	83 ec 0c             	sub    $0xc,%esp
+     7de:	68 17 12 00 00       	push   $0x1217
+     7e3:	e8 48 f9 ff ff       	call   130 <fail>
+    fail("sbrk");
+     7e8:	83 ec 0c             	sub    $0xc,%esp
+     7eb:	68 f3 11 00 00       	push   $0x11f3
+     7f0:	e8 3b f9 ff ff       	call   130 <fail>
+    fail("stale TLB entry after madvise");
+     7f5:	83 ec 0c             	sub    $0xc,%esp
+     7f8:	68 a9 12 00 00       	push   $0x12a9
+     7fd:	e8 2e f9 ff ff       	call   130 <fail>
+    fail("join with no threads left");
+     802:	83 ec 0c             	sub    $0xc,%esp
+     805:	68 fd 11 00 00       	push   $0x11fd
+     80a:	e8 21 f9 ff ff       	call   130 <fail>
+     80f:	90                   	nop
+
+00000810 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     810:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     811:	31 c0                	xor    %eax,%eax
+{
+     813:	89 e5                	mov    %esp,%ebp
+     815:	53                   	push   %ebx
+     816:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     819:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     81c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     820:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     824:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     827:	83 c0 01             	add    $0x1,%eax
+     82a:	84 d2                	test   %dl,%dl
+     82c:	75 f2                	jne    820 <strcpy+0x10>
+    ;
+  return os;
+}
+     82e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     831:	89 c8                	mov    %ecx,%eax
+     833:	c9                   	leave
+     834:	c3                   	ret
+     835:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     83c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000840 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     840:	55                   	push   %ebp
+     841:	89 e5                	mov    %esp,%ebp
+     843:	53                   	push   %ebx
+     844:	8b 55 08             	mov    0x8(%ebp),%edx
+     847:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     84a:	0f b6 02             	movzbl (%edx),%eax
+     84d:	84 c0                	test   %al,%al
+     84f:	75 17                	jne    868 <strcmp+0x28>
+     851:	eb 3a                	jmp    88d <strcmp+0x4d>
+     853:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     857:	90                   	nop
+     858:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     85c:	83 c2 01             	add    $0x1,%edx
+     85f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     862:	84 c0                	test   %al,%al
+     864:	74 1a                	je     880 <strcmp+0x40>
+    p++, q++;
+     866:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     868:	0f b6 19             	movzbl (%ecx),%ebx
+     86b:	38 c3                	cmp    %al,%bl
+     86d:	74 e9                	je     858 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     86f:	29 d8                	sub    %ebx,%eax
+}
+     871:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     874:	c9                   	leave
+     875:	c3                   	ret
+     876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     87d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     880:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     884:	31 c0                	xor    %eax,%eax
+     886:	29 d8                	sub    %ebx,%eax
+}
+     888:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     88b:	c9                   	leave
+     88c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     88d:	0f b6 19             	movzbl (%ecx),%ebx
+     890:	31 c0                	xor    %eax,%eax
+     892:	eb db                	jmp    86f <strcmp+0x2f>
+     894:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     89b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     89f:	90                   	nop
+
+000008a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     8a0:	55                   	push   %ebp
+     8a1:	89 e5                	mov    %esp,%ebp
+     8a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     8a6:	80 3a 00             	cmpb   $0x0,(%edx)
+     8a9:	74 15                	je     8c0 <strlen+0x20>
+     8ab:	31 c0                	xor    %eax,%eax
+     8ad:	8d 76 00             	lea    0x0(%esi),%esi
+     8b0:	83 c0 01             	add    $0x1,%eax
+     8b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     8b7:	89 c1                	mov    %eax,%ecx
+     8b9:	75 f5                	jne    8b0 <strlen+0x10>
+    ;
+  return n;
+}
+     8bb:	89 c8                	mov    %ecx,%eax
+     8bd:	5d                   	pop    %ebp
+     8be:	c3                   	ret
+     8bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+     8c0:	31 c9                	xor    %ecx,%ecx
+}
+     8c2:	5d                   	pop    %ebp
+     8c3:	89 c8                	mov    %ecx,%eax
+     8c5:	c3                   	ret
+     8c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     8d0:	55                   	push   %ebp
+     8d1:	89 e5                	mov    %esp,%ebp
+     8d3:	57                   	push   %edi
+     8d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     8d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     8da:	8b 45 0c             	mov    0xc(%ebp),%eax
+     8dd:	89 d7                	mov    %edx,%edi
+     8df:	fc                   	cld
+     8e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     8e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     8e5:	89 d0                	mov    %edx,%eax
+     8e7:	c9                   	leave
+     8e8:	c3                   	ret
+     8e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000008f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     8f0:	55                   	push   %ebp
+     8f1:	89 e5                	mov    %esp,%ebp
+     8f3:	8b 45 08             	mov    0x8(%ebp),%eax
+     8f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     8fa:	0f b6 10             	movzbl (%eax),%edx
+     8fd:	84 d2                	test   %dl,%dl
+     8ff:	75 12                	jne    913 <strchr+0x23>
+     901:	eb 1d                	jmp    920 <strchr+0x30>
+     903:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     907:	90                   	nop
+     908:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     90c:	83 c0 01             	add    $0x1,%eax
+     90f:	84 d2                	test   %dl,%dl
+     911:	74 0d                	je     920 <strchr+0x30>
+    if(*s == c)
+     913:	38 d1                	cmp    %dl,%cl
+     915:	75 f1                	jne    908 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     917:	5d                   	pop    %ebp
+     918:	c3                   	ret
+     919:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     920:	31 c0                	xor    %eax,%eax
+}
+     922:	5d                   	pop    %ebp
+     923:	c3                   	ret
+     924:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     92b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     92f:	90                   	nop
+
+00000930 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     930:	55                   	push   %ebp
+     931:	89 e5                	mov    %esp,%ebp
+     933:	57                   	push   %edi
+     934:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     935:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     938:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     939:	31 db                	xor    %ebx,%ebx
+{
+     93b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     93e:	eb 27                	jmp    967 <gets+0x37>
+    cc = read(0, &c, 1);
+     940:	83 ec 04             	sub    $0x4,%esp
+     943:	6a 01                	push   $0x1
+     945:	56                   	push   %esi
+     946:	6a 00                	push   $0x0
+     948:	e8 00 03 00 00       	call   c4d <read>
+    if(cc < 1)
+     94d:	83 c4 10             	add    $0x10,%esp
+     950:	85 c0                	test   %eax,%eax
+     952:	7e 1d                	jle    971 <gets+0x41>
+      break;
+    buf[i++] = c;
+     954:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     958:	8b 55 08             	mov    0x8(%ebp),%edx
+     95b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     95f:	3c 0a                	cmp    $0xa,%al
+     961:	74 10                	je     973 <gets+0x43>
+     963:	3c 0d                	cmp    $0xd,%al
+     965:	74 0c                	je     973 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     967:	89 df                	mov    %ebx,%edi
+     969:	83 c3 01             	add    $0x1,%ebx
+     96c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     96f:	7c cf                	jl     940 <gets+0x10>
+     971:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     973:	8b 45 08             	mov    0x8(%ebp),%eax
+     976:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     97a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     97d:	5b                   	pop    %ebx
+     97e:	5e                   	pop    %esi
+     97f:	5f                   	pop    %edi
+     980:	5d                   	pop    %ebp
+     981:	c3                   	ret
+     982:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     989:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000990 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     990:	55                   	push   %ebp
+     991:	89 e5                	mov    %esp,%ebp
+     993:	56                   	push   %esi
+     994:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     995:	83 ec 08             	sub    $0x8,%esp
+     998:	6a 00                	push   $0x0
+     99a:	ff 75 08             	push   0x8(%ebp)
+     99d:	e8 e2 02 00 00       	call   c84 <open>
+  if(fd < 0)
+     9a2:	83 c4 10             	add    $0x10,%esp
+     9a5:	85 c0                	test   %eax,%eax
+     9a7:	78 27                	js     9d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     9a9:	83 ec 08             	sub    $0x8,%esp
+     9ac:	ff 75 0c             	push   0xc(%ebp)
+     9af:	89 c3                	mov    %eax,%ebx
+     9b1:	50                   	push   %eax
+     9b2:	e8 ee 02 00 00       	call   ca5 <fstat>
+  close(fd);
+     9b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     9ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+     9bc:	e8 a2 02 00 00       	call   c63 <close>
+  return r;
+     9c1:	83 c4 10             	add    $0x10,%esp
+}
+     9c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     9c7:	89 f0                	mov    %esi,%eax
+     9c9:	5b                   	pop    %ebx
+     9ca:	5e                   	pop    %esi
+     9cb:	5d                   	pop    %ebp
+     9cc:	c3                   	ret
+     9cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     9d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     9d5:	eb ed                	jmp    9c4 <stat+0x34>
+     9d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9de:	66 90                	xchg   %ax,%ax
+
+000009e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     9e0:	55                   	push   %ebp
+     9e1:	89 e5                	mov    %esp,%ebp
+     9e3:	53                   	push   %ebx
+     9e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     9e7:	0f be 02             	movsbl (%edx),%eax
+     9ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     9ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     9f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     9f5:	77 1e                	ja     a15 <atoi+0x35>
+     9f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     a00:	83 c2 01             	add    $0x1,%edx
+     a03:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     a06:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     a0a:	0f be 02             	movsbl (%edx),%eax
+     a0d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     a10:	80 fb 09             	cmp    $0x9,%bl
+     a13:	76 eb                	jbe    a00 <atoi+0x20>
+  return n;
+}
+     a15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a18:	89 c8                	mov    %ecx,%eax
+     a1a:	c9                   	leave
+     a1b:	c3                   	ret
+     a1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a20 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     a20:	55                   	push   %ebp
+     a21:	89 e5                	mov    %esp,%ebp
+     a23:	57                   	push   %edi
+     a24:	56                   	push   %esi
+     a25:	8b 45 10             	mov    0x10(%ebp),%eax
+     a28:	8b 55 08             	mov    0x8(%ebp),%edx
+     a2b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     a2e:	85 c0                	test   %eax,%eax
+     a30:	7e 13                	jle    a45 <memmove+0x25>
+     a32:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     a34:	89 d7                	mov    %edx,%edi
+     a36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a3d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     a40:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     a41:	39 f8                	cmp    %edi,%eax
+     a43:	75 fb                	jne    a40 <memmove+0x20>
+  return vdst;
+}
+     a45:	5e                   	pop    %esi
+     a46:	89 d0                	mov    %edx,%eax
+     a48:	5f                   	pop    %edi
+     a49:	5d                   	pop    %ebp
+     a4a:	c3                   	ret
+     a4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a4f:	90                   	nop
+
+00000a50 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+     a50:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+     a55:	85 c0                	test   %eax,%eax
+     a57:	74 07                	je     a60 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+     a59:	c3                   	ret
+     a5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+     a60:	e9 77 02 00 00       	jmp    cdc <sysgetpid>
+     a65:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a70 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+     a70:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+     a75:	c3                   	ret
+     a76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a80 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+     a80:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+     a81:	31 d2                	xor    %edx,%edx
+     a83:	89 e5                	mov    %esp,%ebp
+     a85:	53                   	push   %ebx
+     a86:	83 ec 04             	sub    $0x4,%esp
+     a89:	8b 4d 18             	mov    0x18(%ebp),%ecx
+     a8c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     a8f:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+     a92:	85 c9                	test   %ecx,%ecx
+     a94:	7e 08                	jle    a9e <cyclereport+0x1e>
+     a96:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+     a98:	89 d8                	mov    %ebx,%eax
+     a9a:	f7 f1                	div    %ecx
+     a9c:	89 c2                	mov    %eax,%edx
+     a9e:	83 ec 08             	sub    $0x8,%esp
+     aa1:	52                   	push   %edx
+     aa2:	ff 75 0c             	push   0xc(%ebp)
+     aa5:	51                   	push   %ecx
+     aa6:	ff 75 08             	push   0x8(%ebp)
+     aa9:	68 22 13 00 00       	push   $0x1322
+     aae:	6a 01                	push   $0x1
+     ab0:	e8 fb 03 00 00       	call   eb0 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+     ab5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ab8:	83 c4 20             	add    $0x20,%esp
+     abb:	c9                   	leave
+     abc:	c3                   	ret
+     abd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ac0 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+     ac0:	55                   	push   %ebp
+     ac1:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+     ac3:	8b 45 08             	mov    0x8(%ebp),%eax
+     ac6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     acc:	5d                   	pop    %ebp
+     acd:	c3                   	ret
+     ace:	66 90                	xchg   %ax,%ax
+
+00000ad0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     ad0:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+     ad1:	31 c0                	xor    %eax,%eax
+     ad3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+     ad8:	89 e5                	mov    %esp,%ebp
+     ada:	56                   	push   %esi
+     adb:	53                   	push   %ebx
+     adc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+     adf:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     ae3:	85 c0                	test   %eax,%eax
+     ae5:	74 30                	je     b17 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+     ae7:	83 f8 02             	cmp    $0x2,%eax
+     aea:	74 0c                	je     af8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+     aec:	b8 02 00 00 00       	mov    $0x2,%eax
+     af1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+     af4:	85 c0                	test   %eax,%eax
+     af6:	74 1f                	je     b17 <mutex_lock+0x47>
+     af8:	be 02 00 00 00       	mov    $0x2,%esi
+     afd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+     b00:	83 ec 08             	sub    $0x8,%esp
+     b03:	6a 02                	push   $0x2
+     b05:	53                   	push   %ebx
+     b06:	e8 8c 02 00 00       	call   d97 <futex_wait>
+     b0b:	89 f0                	mov    %esi,%eax
+     b0d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     b10:	83 c4 10             	add    $0x10,%esp
+     b13:	85 c0                	test   %eax,%eax
+     b15:	75 e9                	jne    b00 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+     b17:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b1a:	5b                   	pop    %ebx
+     b1b:	5e                   	pop    %esi
+     b1c:	5d                   	pop    %ebp
+     b1d:	c3                   	ret
+     b1e:	66 90                	xchg   %ax,%ax
+
+00000b20 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     b20:	55                   	push   %ebp
+     b21:	89 e5                	mov    %esp,%ebp
+     b23:	83 ec 08             	sub    $0x8,%esp
+     b26:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+     b29:	f0 83 28 01          	lock subl $0x1,(%eax)
+     b2d:	75 09                	jne    b38 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+     b2f:	c9                   	leave
+     b30:	c3                   	ret
+     b31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+     b38:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+     b3b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+     b41:	6a 01                	push   $0x1
+     b43:	50                   	push   %eax
+     b44:	e8 59 02 00 00       	call   da2 <futex_wake>
+     b49:	83 c4 10             	add    $0x10,%esp
+}
+     b4c:	c9                   	leave
+     b4d:	c3                   	ret
+     b4e:	66 90                	xchg   %ax,%ax
+
+00000b50 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+     b50:	55                   	push   %ebp
+     b51:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     b53:	8b 45 08             	mov    0x8(%ebp),%eax
+     b56:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     b5c:	5d                   	pop    %ebp
+     b5d:	c3                   	ret
+     b5e:	66 90                	xchg   %ax,%ax
+
+00000b60 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	57                   	push   %edi
+     b64:	56                   	push   %esi
+     b65:	53                   	push   %ebx
+     b66:	83 ec 0c             	sub    $0xc,%esp
+     b69:	8b 75 08             	mov    0x8(%ebp),%esi
+     b6c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+     b6f:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+     b71:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+     b75:	75 21                	jne    b98 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+     b77:	83 ec 08             	sub    $0x8,%esp
+     b7a:	57                   	push   %edi
+     b7b:	56                   	push   %esi
+     b7c:	e8 16 02 00 00       	call   d97 <futex_wait>
+  mutex_lock(m);
+     b81:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     b84:	83 c4 10             	add    $0x10,%esp
+}
+     b87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b8a:	5b                   	pop    %ebx
+     b8b:	5e                   	pop    %esi
+     b8c:	5f                   	pop    %edi
+     b8d:	5d                   	pop    %ebp
+  mutex_lock(m);
+     b8e:	e9 3d ff ff ff       	jmp    ad0 <mutex_lock>
+     b93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b97:	90                   	nop
+    futex_wake(&m->v, 1);
+     b98:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+     b9b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+     ba1:	6a 01                	push   $0x1
+     ba3:	53                   	push   %ebx
+     ba4:	e8 f9 01 00 00       	call   da2 <futex_wake>
+     ba9:	83 c4 10             	add    $0x10,%esp
+     bac:	eb c9                	jmp    b77 <cond_wait+0x17>
+     bae:	66 90                	xchg   %ax,%ax
+
+00000bb0 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+     bb0:	55                   	push   %ebp
+     bb1:	89 e5                	mov    %esp,%ebp
+     bb3:	83 ec 10             	sub    $0x10,%esp
+     bb6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     bb9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+     bbd:	6a 01                	push   $0x1
+     bbf:	50                   	push   %eax
+     bc0:	e8 dd 01 00 00       	call   da2 <futex_wake>
+}
+     bc5:	83 c4 10             	add    $0x10,%esp
+     bc8:	c9                   	leave
+     bc9:	c3                   	ret
+     bca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000bd0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     bd0:	55                   	push   %ebp
+     bd1:	89 e5                	mov    %esp,%ebp
+     bd3:	83 ec 10             	sub    $0x10,%esp
+     bd6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     bd9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+     bdd:	68 ff ff ff 7f       	push   $0x7fffffff
+     be2:	50                   	push   %eax
+     be3:	e8 ba 01 00 00       	call   da2 <futex_wake>
+}
+     be8:	83 c4 10             	add    $0x10,%esp
+     beb:	c9                   	leave
+     bec:	c3                   	ret
+
+00000bed <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+     bed:	50                   	push   %eax
+  pushl %ebx
+     bee:	53                   	push   %ebx
+  movl $1, %eax
+     bef:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+     bf4:	0f a2                	cpuid
+  popl %ebx
+     bf6:	5b                   	pop    %ebx
+  popl %eax
+     bf7:	58                   	pop    %eax
+  movl $sysint, syscallvec
+     bf8:	c7 05 50 19 00 00 1e 	movl   $0xc1e,0x1950
+     bff:	0c 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+     c02:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+     c08:	74 14                	je     c1e <sysint>
+  movl $sysfast, syscallvec
+     c0a:	c7 05 50 19 00 00 14 	movl   $0xc14,0x1950
+     c11:	0c 00 00 
+
+00000c14 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+     c14:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+     c16:	ba 1d 0c 00 00       	mov    $0xc1d,%edx
+  sysenter
+     c1b:	0f 34                	sysenter
+1:
+  ret
+     c1d:	c3                   	ret
+
+00000c1e <sysint>:
+
+sysint:
+  int $T_SYSCALL
+     c1e:	cd 40                	int    $0x40
+  ret
+     c20:	c3                   	ret
+
+00000c21 <fork>:
+
+SYSCALL(fork)
+     c21:	b8 01 00 00 00       	mov    $0x1,%eax
+     c26:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000c2c <exit>:
+SYSCALL(exit)
+     c2c:	b8 02 00 00 00       	mov    $0x2,%eax
+     c31:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000c37 <wait>:
+SYSCALL(wait)
+     c37:	b8 03 00 00 00       	mov    $0x3,%eax
+     c3c:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000c42 <pipe>:
+SYSCALL(pipe)
+     c42:	b8 04 00 00 00       	mov    $0x4,%eax
+     c47:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000c4d <read>:
+SYSCALL(read)
+     c4d:	b8 05 00 00 00       	mov    $0x5,%eax
+     c52:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000c58 <write>:
+SYSCALL(write)
+     c58:	b8 10 00 00 00       	mov    $0x10,%eax
+     c5d:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000c63 <close>:
+SYSCALL(close)
+     c63:	b8 15 00 00 00       	mov    $0x15,%eax
+     c68:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000c6e <kill>:
+SYSCALL(kill)
+     c6e:	b8 06 00 00 00       	mov    $0x6,%eax
+     c73:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000c79 <exec>:
+SYSCALL(exec)
+     c79:	b8 07 00 00 00       	mov    $0x7,%eax
+     c7e:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000c84 <open>:
+SYSCALL(open)
+     c84:	b8 0f 00 00 00       	mov    $0xf,%eax
+     c89:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000c8f <mknod>:
+SYSCALL(mknod)
+     c8f:	b8 11 00 00 00       	mov    $0x11,%eax
+     c94:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000c9a <unlink>:
+SYSCALL(unlink)
+     c9a:	b8 12 00 00 00       	mov    $0x12,%eax
+     c9f:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000ca5 <fstat>:
+SYSCALL(fstat)
+     ca5:	b8 08 00 00 00       	mov    $0x8,%eax
+     caa:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000cb0 <link>:
+SYSCALL(link)
+     cb0:	b8 13 00 00 00       	mov    $0x13,%eax
+     cb5:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000cbb <mkdir>:
+SYSCALL(mkdir)
+     cbb:	b8 14 00 00 00       	mov    $0x14,%eax
+     cc0:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000cc6 <chdir>:
+SYSCALL(chdir)
+     cc6:	b8 09 00 00 00       	mov    $0x9,%eax
+     ccb:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000cd1 <dup>:
+SYSCALL(dup)
+     cd1:	b8 0a 00 00 00       	mov    $0xa,%eax
+     cd6:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000cdc <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+     cdc:	b8 0b 00 00 00       	mov    $0xb,%eax
+     ce1:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000ce7 <sbrk>:
+SYSCALL(sbrk)
+     ce7:	b8 0c 00 00 00       	mov    $0xc,%eax
+     cec:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000cf2 <sleep>:
+SYSCALL(sleep)
+     cf2:	b8 0d 00 00 00       	mov    $0xd,%eax
+     cf7:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000cfd <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+     cfd:	b8 0e 00 00 00       	mov    $0xe,%eax
+     d02:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000d08 <swapread>:
+SYSCALL(swapread)
+     d08:	b8 16 00 00 00       	mov    $0x16,%eax
+     d0d:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000d13 <swapwrite>:
+SYSCALL(swapwrite)
+     d13:	b8 17 00 00 00       	mov    $0x17,%eax
+     d18:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000d1e <swapstat>:
+SYSCALL(swapstat)
+     d1e:	b8 18 00 00 00       	mov    $0x18,%eax
+     d23:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000d29 <madvise>:
+SYSCALL(madvise)
+     d29:	b8 19 00 00 00       	mov    $0x19,%eax
+     d2e:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000d34 <mlock>:
+SYSCALL(mlock)
+     d34:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     d39:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000d3f <munlock>:
+SYSCALL(munlock)
+     d3f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     d44:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000d4a <membench>:
+SYSCALL(membench)
+     d4a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     d4f:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000d55 <nice>:
+SYSCALL(nice)
+     d55:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     d5a:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000d60 <setpriority>:
+SYSCALL(setpriority)
+     d60:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     d65:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000d6b <usleep>:
+SYSCALL(usleep)
+     d6b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     d70:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000d76 <cpustat>:
+SYSCALL(cpustat)
+     d76:	b8 20 00 00 00       	mov    $0x20,%eax
+     d7b:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000d81 <clone>:
+SYSCALL(clone)
+     d81:	b8 21 00 00 00       	mov    $0x21,%eax
+     d86:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000d8c <join>:
+SYSCALL(join)
+     d8c:	b8 22 00 00 00       	mov    $0x22,%eax
+     d91:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000d97 <futex_wait>:
+SYSCALL(futex_wait)
+     d97:	b8 23 00 00 00       	mov    $0x23,%eax
+     d9c:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000da2 <futex_wake>:
+SYSCALL(futex_wake)
+     da2:	b8 24 00 00 00       	mov    $0x24,%eax
+     da7:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000dad <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+     dad:	b8 25 00 00 00       	mov    $0x25,%eax
+     db2:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000db8 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+     db8:	b8 26 00 00 00       	mov    $0x26,%eax
+     dbd:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000dc3 <getcpu>:
+SYSCALL(getcpu)
+     dc3:	b8 27 00 00 00       	mov    $0x27,%eax
+     dc8:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000dce <migrations>:
+SYSCALL(migrations)
+     dce:	b8 28 00 00 00       	mov    $0x28,%eax
+     dd3:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000dd9 <ioring_enter>:
+SYSCALL(ioring_enter)
+     dd9:	b8 29 00 00 00       	mov    $0x29,%eax
+     dde:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000de4 <lockstat>:
+SYSCALL(lockstat)
+     de4:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     de9:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000def <lockprof>:
+SYSCALL(lockprof)
+     def:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     df4:	ff 25 50 19 00 00    	jmp    *0x1950
+
+00000dfa <bcachestat>:
+SYSCALL(bcachestat)
+     dfa:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     dff:	ff 25 50 19 00 00    	jmp    *0x1950
+     e05:	66 90                	xchg   %ax,%ax
+     e07:	66 90                	xchg   %ax,%ax
+     e09:	66 90                	xchg   %ax,%ax
+     e0b:	66 90                	xchg   %ax,%ax
+     e0d:	66 90                	xchg   %ax,%ax
+     e0f:	90                   	nop
+
+00000e10 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     e10:	55                   	push   %ebp
+     e11:	89 e5                	mov    %esp,%ebp
+     e13:	57                   	push   %edi
+     e14:	56                   	push   %esi
+     e15:	53                   	push   %ebx
+     e16:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     e18:	89 d1                	mov    %edx,%ecx
+{
+     e1a:	83 ec 3c             	sub    $0x3c,%esp
+     e1d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     e20:	85 d2                	test   %edx,%edx
+     e22:	0f 89 80 00 00 00    	jns    ea8 <printint+0x98>
+     e28:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     e2c:	74 7a                	je     ea8 <printint+0x98>
+    x = -xx;
+     e2e:	f7 d9                	neg    %ecx
+    neg = 1;
+     e30:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     e35:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     e38:	31 f6                	xor    %esi,%esi
+     e3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     e40:	89 c8                	mov    %ecx,%eax
+     e42:	31 d2                	xor    %edx,%edx
+     e44:	89 f7                	mov    %esi,%edi
+     e46:	f7 f3                	div    %ebx
+     e48:	8d 76 01             	lea    0x1(%esi),%esi
+     e4b:	0f b6 92 9c 13 00 00 	movzbl 0x139c(%edx),%edx
+     e52:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     e56:	89 ca                	mov    %ecx,%edx
+     e58:	89 c1                	mov    %eax,%ecx
+     e5a:	39 da                	cmp    %ebx,%edx
+     e5c:	73 e2                	jae    e40 <printint+0x30>
+  if(neg)
+     e5e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     e61:	85 c0                	test   %eax,%eax
+     e63:	74 07                	je     e6c <printint+0x5c>
+    buf[i++] = '-';
+     e65:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     e6a:	89 f7                	mov    %esi,%edi
+     e6c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     e6f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     e72:	01 df                	add    %ebx,%edi
+     e74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     e78:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     e7b:	83 ec 04             	sub    $0x4,%esp
+     e7e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     e81:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     e84:	6a 01                	push   $0x1
+     e86:	50                   	push   %eax
+     e87:	56                   	push   %esi
+     e88:	e8 cb fd ff ff       	call   c58 <write>
+  while(--i >= 0)
+     e8d:	89 f8                	mov    %edi,%eax
+     e8f:	83 c4 10             	add    $0x10,%esp
+     e92:	83 ef 01             	sub    $0x1,%edi
+     e95:	39 d8                	cmp    %ebx,%eax
+     e97:	75 df                	jne    e78 <printint+0x68>
+}
+     e99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e9c:	5b                   	pop    %ebx
+     e9d:	5e                   	pop    %esi
+     e9e:	5f                   	pop    %edi
+     e9f:	5d                   	pop    %ebp
+     ea0:	c3                   	ret
+     ea1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     ea8:	31 c0                	xor    %eax,%eax
+     eaa:	eb 89                	jmp    e35 <printint+0x25>
+     eac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000eb0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     eb0:	55                   	push   %ebp
+     eb1:	89 e5                	mov    %esp,%ebp
+     eb3:	57                   	push   %edi
+     eb4:	56                   	push   %esi
+     eb5:	53                   	push   %ebx
+     eb6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     eb9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     ebc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     ebf:	0f b6 1e             	movzbl (%esi),%ebx
+     ec2:	83 c6 01             	add    $0x1,%esi
+     ec5:	84 db                	test   %bl,%bl
+     ec7:	74 67                	je     f30 <printf+0x80>
+     ec9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     ecc:	31 d2                	xor    %edx,%edx
+     ece:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     ed1:	eb 34                	jmp    f07 <printf+0x57>
+     ed3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ed7:	90                   	nop
+     ed8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     edb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     ee0:	83 f8 25             	cmp    $0x25,%eax
+     ee3:	74 18                	je     efd <printf+0x4d>
+  write(fd, &c, 1);
+     ee5:	83 ec 04             	sub    $0x4,%esp
+     ee8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     eeb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     eee:	6a 01                	push   $0x1
+     ef0:	50                   	push   %eax
+     ef1:	57                   	push   %edi
+     ef2:	e8 61 fd ff ff       	call   c58 <write>
+     ef7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     efa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     efd:	0f b6 1e             	movzbl (%esi),%ebx
+     f00:	83 c6 01             	add    $0x1,%esi
+     f03:	84 db                	test   %bl,%bl
+     f05:	74 29                	je     f30 <printf+0x80>
+    c = fmt[i] & 0xff;
+     f07:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     f0a:	85 d2                	test   %edx,%edx
+     f0c:	74 ca                	je     ed8 <printf+0x28>
+      }
+    } else if(state == '%'){
+     f0e:	83 fa 25             	cmp    $0x25,%edx
+     f11:	75 ea                	jne    efd <printf+0x4d>
+      if(c == 'd'){
+     f13:	83 f8 25             	cmp    $0x25,%eax
+     f16:	0f 84 24 01 00 00    	je     1040 <printf+0x190>
+     f1c:	83 e8 63             	sub    $0x63,%eax
+     f1f:	83 f8 15             	cmp    $0x15,%eax
+     f22:	77 1c                	ja     f40 <printf+0x90>
+     f24:	ff 24 85 44 13 00 00 	jmp    *0x1344(,%eax,4)
+     f2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f2f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     f30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f33:	5b                   	pop    %ebx
+     f34:	5e                   	pop    %esi
+     f35:	5f                   	pop    %edi
+     f36:	5d                   	pop    %ebp
+     f37:	c3                   	ret
+     f38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f3f:	90                   	nop
+  write(fd, &c, 1);
+     f40:	83 ec 04             	sub    $0x4,%esp
+     f43:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     f46:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     f4a:	6a 01                	push   $0x1
+     f4c:	52                   	push   %edx
+     f4d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     f50:	57                   	push   %edi
+     f51:	e8 02 fd ff ff       	call   c58 <write>
+     f56:	83 c4 0c             	add    $0xc,%esp
+     f59:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     f5c:	6a 01                	push   $0x1
+     f5e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     f61:	52                   	push   %edx
+     f62:	57                   	push   %edi
+     f63:	e8 f0 fc ff ff       	call   c58 <write>
+        putc(fd, c);
+     f68:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     f6b:	31 d2                	xor    %edx,%edx
+     f6d:	eb 8e                	jmp    efd <printf+0x4d>
+     f6f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     f70:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     f73:	83 ec 0c             	sub    $0xc,%esp
+     f76:	b9 10 00 00 00       	mov    $0x10,%ecx
+     f7b:	8b 13                	mov    (%ebx),%edx
+     f7d:	6a 00                	push   $0x0
+     f7f:	89 f8                	mov    %edi,%eax
+        ap++;
+     f81:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     f84:	e8 87 fe ff ff       	call   e10 <printint>
+        ap++;
+     f89:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     f8c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     f8f:	31 d2                	xor    %edx,%edx
+     f91:	e9 67 ff ff ff       	jmp    efd <printf+0x4d>
+     f96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f9d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     fa0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     fa3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     fa5:	83 c0 04             	add    $0x4,%eax
+     fa8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     fab:	85 db                	test   %ebx,%ebx
+     fad:	0f 84 9d 00 00 00    	je     1050 <printf+0x1a0>
+        while(*s != 0){
+     fb3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     fb6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     fb8:	84 c0                	test   %al,%al
+     fba:	0f 84 3d ff ff ff    	je     efd <printf+0x4d>
+     fc0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     fc3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     fc6:	89 de                	mov    %ebx,%esi
+     fc8:	89 d3                	mov    %edx,%ebx
+     fca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     fd0:	83 ec 04             	sub    $0x4,%esp
+     fd3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     fd6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     fd9:	6a 01                	push   $0x1
+     fdb:	53                   	push   %ebx
+     fdc:	57                   	push   %edi
+     fdd:	e8 76 fc ff ff       	call   c58 <write>
+        while(*s != 0){
+     fe2:	0f b6 06             	movzbl (%esi),%eax
+     fe5:	83 c4 10             	add    $0x10,%esp
+     fe8:	84 c0                	test   %al,%al
+     fea:	75 e4                	jne    fd0 <printf+0x120>
+      state = 0;
+     fec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     fef:	31 d2                	xor    %edx,%edx
+     ff1:	e9 07 ff ff ff       	jmp    efd <printf+0x4d>
+     ff6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ffd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1000:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1003:	83 ec 0c             	sub    $0xc,%esp
+    1006:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    100b:	8b 13                	mov    (%ebx),%edx
+    100d:	6a 01                	push   $0x1
+    100f:	e9 6b ff ff ff       	jmp    f7f <printf+0xcf>
+    1014:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1018:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    101b:	83 ec 04             	sub    $0x4,%esp
+    101e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1021:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1023:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1026:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1029:	6a 01                	push   $0x1
+    102b:	52                   	push   %edx
+    102c:	57                   	push   %edi
+    102d:	e8 26 fc ff ff       	call   c58 <write>
+        ap++;
+    1032:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1035:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1038:	31 d2                	xor    %edx,%edx
+    103a:	e9 be fe ff ff       	jmp    efd <printf+0x4d>
+    103f:	90                   	nop
+  write(fd, &c, 1);
+    1040:	83 ec 04             	sub    $0x4,%esp
+    1043:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1046:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1049:	6a 01                	push   $0x1
+    104b:	e9 11 ff ff ff       	jmp    f61 <printf+0xb1>
+    1050:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1055:	bb 3d 13 00 00       	mov    $0x133d,%ebx
+    105a:	e9 61 ff ff ff       	jmp    fc0 <printf+0x110>
+    105f:	90                   	nop
+
+00001060 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1060:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1061:	a1 78 19 00 00       	mov    0x1978,%eax
+{
+    1066:	89 e5                	mov    %esp,%ebp
+    1068:	57                   	push   %edi
+    1069:	56                   	push   %esi
+    106a:	53                   	push   %ebx
+    106b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    106e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1071:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1078:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    107a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    107c:	39 ca                	cmp    %ecx,%edx
+    107e:	73 30                	jae    10b0 <free+0x50>
+    1080:	39 c1                	cmp    %eax,%ecx
+    1082:	72 04                	jb     1088 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1084:	39 c2                	cmp    %eax,%edx
+    1086:	72 f0                	jb     1078 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1088:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    108b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    108e:	39 f8                	cmp    %edi,%eax
+    1090:	74 2e                	je     10c0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1092:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1095:	8b 42 04             	mov    0x4(%edx),%eax
+    1098:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    109b:	39 f1                	cmp    %esi,%ecx
+    109d:	74 38                	je     10d7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    109f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    10a1:	5b                   	pop    %ebx
+  freep = p;
+    10a2:	89 15 78 19 00 00    	mov    %edx,0x1978
+}
+    10a8:	5e                   	pop    %esi
+    10a9:	5f                   	pop    %edi
+    10aa:	5d                   	pop    %ebp
+    10ab:	c3                   	ret
+    10ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    10b0:	39 c1                	cmp    %eax,%ecx
+    10b2:	72 d0                	jb     1084 <free+0x24>
+    10b4:	eb c2                	jmp    1078 <free+0x18>
+    10b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10bd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    10c0:	03 70 04             	add    0x4(%eax),%esi
+    10c3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    10c6:	8b 02                	mov    (%edx),%eax
+    10c8:	8b 00                	mov    (%eax),%eax
+    10ca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    10cd:	8b 42 04             	mov    0x4(%edx),%eax
+    10d0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    10d3:	39 f1                	cmp    %esi,%ecx
+    10d5:	75 c8                	jne    109f <free+0x3f>
+    p->s.size += bp->s.size;
+    10d7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    10da:	89 15 78 19 00 00    	mov    %edx,0x1978
+    p->s.size += bp->s.size;
+    10e0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    10e3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    10e6:	89 0a                	mov    %ecx,(%edx)
+}
+    10e8:	5b                   	pop    %ebx
+    10e9:	5e                   	pop    %esi
+    10ea:	5f                   	pop    %edi
+    10eb:	5d                   	pop    %ebp
+    10ec:	c3                   	ret
+    10ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000010f0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    10f0:	55                   	push   %ebp
+    10f1:	89 e5                	mov    %esp,%ebp
+    10f3:	57                   	push   %edi
+    10f4:	56                   	push   %esi
+    10f5:	53                   	push   %ebx
+    10f6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    10f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    10fc:	8b 15 78 19 00 00    	mov    0x1978,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1102:	8d 78 07             	lea    0x7(%eax),%edi
+    1105:	c1 ef 03             	shr    $0x3,%edi
+    1108:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    110b:	85 d2                	test   %edx,%edx
+    110d:	0f 84 8d 00 00 00    	je     11a0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1113:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1115:	8b 48 04             	mov    0x4(%eax),%ecx
+    1118:	39 f9                	cmp    %edi,%ecx
+    111a:	73 64                	jae    1180 <malloc+0x90>
+  if(nu < 4096)
+    111c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1121:	39 df                	cmp    %ebx,%edi
+    1123:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1126:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    112d:	eb 0a                	jmp    1139 <malloc+0x49>
+    112f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1130:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1132:	8b 48 04             	mov    0x4(%eax),%ecx
+    1135:	39 f9                	cmp    %edi,%ecx
+    1137:	73 47                	jae    1180 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1139:	89 c2                	mov    %eax,%edx
+    113b:	39 05 78 19 00 00    	cmp    %eax,0x1978
+    1141:	75 ed                	jne    1130 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1143:	83 ec 0c             	sub    $0xc,%esp
+    1146:	56                   	push   %esi
+    1147:	e8 9b fb ff ff       	call   ce7 <sbrk>
+  if(p == (char*)-1)
+    114c:	83 c4 10             	add    $0x10,%esp
+    114f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1152:	74 1c                	je     1170 <malloc+0x80>
+  hp->s.size = nu;
+    1154:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1157:	83 ec 0c             	sub    $0xc,%esp
+    115a:	83 c0 08             	add    $0x8,%eax
+    115d:	50                   	push   %eax
+    115e:	e8 fd fe ff ff       	call   1060 <free>
+  return freep;
+    1163:	8b 15 78 19 00 00    	mov    0x1978,%edx
+      if((p = morecore(nunits)) == 0)
+    1169:	83 c4 10             	add    $0x10,%esp
+    116c:	85 d2                	test   %edx,%edx
+    116e:	75 c0                	jne    1130 <malloc+0x40>
+        return 0;
+  }
+}
+    1170:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1173:	31 c0                	xor    %eax,%eax
+}
+    1175:	5b                   	pop    %ebx
+    1176:	5e                   	pop    %esi
+    1177:	5f                   	pop    %edi
+    1178:	5d                   	pop    %ebp
+    1179:	c3                   	ret
+    117a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1180:	39 cf                	cmp    %ecx,%edi
+    1182:	74 4c                	je     11d0 <malloc+0xe0>
+        p->s.size -= nunits;
+    1184:	29 f9                	sub    %edi,%ecx
+    1186:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1189:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    118c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    118f:	89 15 78 19 00 00    	mov    %edx,0x1978
+}
+    1195:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1198:	83 c0 08             	add    $0x8,%eax
+}
+    119b:	5b                   	pop    %ebx
+    119c:	5e                   	pop    %esi
+    119d:	5f                   	pop    %edi
+    119e:	5d                   	pop    %ebp
+    119f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    11a0:	c7 05 78 19 00 00 7c 	movl   $0x197c,0x1978
+    11a7:	19 00 00 
+    base.s.size = 0;
+    11aa:	b8 7c 19 00 00       	mov    $0x197c,%eax
+    base.s.ptr = freep = prevp = &base;
+    11af:	c7 05 7c 19 00 00 7c 	movl   $0x197c,0x197c
+    11b6:	19 00 00 
+    base.s.size = 0;
+    11b9:	c7 05 80 19 00 00 00 	movl   $0x0,0x1980
+    11c0:	00 00 00 
+    if(p->s.size >= nunits){
+    11c3:	e9 54 ff ff ff       	jmp    111c <malloc+0x2c>
+    11c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11cf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    11d0:	8b 08                	mov    (%eax),%ecx
+    11d2:	89 0a                	mov    %ecx,(%edx)
+    11d4:	eb b9                	jmp    118f <malloc+0x9f>
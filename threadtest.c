@@ -0,0 +1,215 @@
+// Test clone() and join(): threads share memory, sbrk() and
+// open files, and see pages another thread unmaps go away at once.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "mman.h"
+
+#define PGSIZE   4096
+#define NTHREAD  4
+#define NINCR    100000
+
+volatile int counter;
+volatile int ready;
+volatile int stale;
+volatile char *grown;
+volatile int *shared;
+volatile int openfd;
+volatile int nread;
+int pfd[2];
+
+void
+fail(char *msg)
+{
+  printf(1, "threadtest: %s\n", msg);
+  exit();
+}
+
+// A page-aligned stack page, which join() hands back.
+void*
+stackalloc(void)
+{
+  uint p;
+
+  p = (uint)sbrk(2*PGSIZE);
+  if(p == 0xffffffff)
+    fail("sbrk");
+  return (void*)((p + PGSIZE-1) & ~(PGSIZE-1));
+}
+
+void
+joinall(int n)
+{
+  void *stack;
+  int i;
+
+  for(i = 0; i < n; i++)
+    if(join(&stack) < 0 || (uint)stack % PGSIZE != 0)
+      fail("join");
+  if(join(&stack) != -1)
+    fail("join with no threads left");
+}
+
+void
+incr(void *a, void *b)
+{
+  int i, n;
+
+  n = (int)a;
+  for(i = 0; i < n; i++)
+    __sync_fetch_and_add(&counter, 1);
+  exit();
+}
+
+// All threads update the same memory.
+void
+sharing(void)
+{
+  int i;
+
+  counter = 0;
+  for(i = 0; i < NTHREAD; i++)
+    if(clone(incr, (void*)NINCR, 0, stackalloc()) < 0)
+      fail("clone");
+  joinall(NTHREAD);
+  if(counter != NTHREAD*NINCR)
+    fail("lost increments");
+  if(wait() != -1)
+    fail("wait reaped a thread");
+}
+
+void
+grow(void *a, void *b)
+{
+  char *p;
+
+  p = sbrk(PGSIZE);
+  p[0] = 'x';
+  grown = p;
+  exit();
+}
+
+// Memory one thread allocates is there for the others.
+void
+growing(void)
+{
+  char *brk;
+
+  grown = 0;
+  if(clone(grow, 0, 0, stackalloc()) < 0)
+    fail("clone");
+  joinall(1);
+  brk = sbrk(0);
+  if(grown == 0 || grown[0] != 'x' || brk < grown + PGSIZE)
+    fail("sbrk in a thread not seen");
+}
+
+void
+opener(void *a, void *b)
+{
+  openfd = open("threadtest", O_RDONLY);
+  exit();
+}
+
+// A file one thread opens stays open for the others.
+void
+files(void)
+{
+  struct stat st;
+
+  openfd = -1;
+  if(clone(opener, 0, 0, stackalloc()) < 0)
+    fail("clone");
+  joinall(1);
+  if(openfd < 0)
+    fail("open in a thread");
+  if(fstat(openfd, &st) < 0 || close(openfd) < 0)
+    fail("file opened in a thread not seen");
+}
+
+void
+reader(void *a, void *b)
+{
+  ready = 1;
+  nread = read(pfd[0], (char*)a, 1);
+  exit();
+}
+
+// Memory that a system call blocked in one thread is using
+// cannot be sbrk()ed away by another.
+void
+shrinking(void)
+{
+  char *stack, *buf;
+
+  if(pipe(pfd) < 0)
+    fail("pipe");
+  stack = stackalloc();
+  buf = sbrk(PGSIZE) + PGSIZE - 1;
+  ready = 0;
+  if(clone(reader, buf, 0, stack) < 0)
+    fail("clone");
+  while(!ready)
+    ;
+  sleep(1);
+  if(sbrk(-PGSIZE) != (char*)-1)
+    fail("sbrk freed a buffer in use");
+  if(write(pfd[1], "x", 1) != 1)
+    fail("write");
+  joinall(1);
+  if(nread != 1 || *buf != 'x')
+    fail("read into a buffer sbrk tried to free");
+  if(sbrk(-PGSIZE) == (char*)-1)
+    fail("sbrk after the read");
+  close(pfd[0]);
+  close(pfd[1]);
+}
+
+void
+watch(void *a, void *b)
+{
+  int start;
+
+  ready = 1;
+  start = uptime();
+  while(*shared != 0){
+    if(uptime() - start > 100){
+      stale = 1;
+      break;
+    }
+  }
+  exit();
+}
+
+// A thread spinning on a page sees it dropped by another CPU.
+void
+shootdown(void)
+{
+  shared = (int*)stackalloc();
+  *shared = 1;
+  ready = stale = 0;
+  if(clone(watch, 0, 0, stackalloc()) < 0)
+    fail("clone");
+  while(!ready)
+    ;
+  sleep(1);
+  if(madvise((void*)shared, PGSIZE, MADV_DONTNEED) < 0)
+    fail("madvise");
+  joinall(1);
+  if(stale)
+    fail("stale TLB entry after madvise");
+}
+
+int
+main(void)
+{
+  sharing();
+  growing();
+  files();
+  shrinking();
+  shootdown();
+  printf(1, "threadtest ok\n");
+  exit();
+}
@@ -0,0 +1,350 @@
+// Timekeeping and kernel timers.
+//
+// Time is kept by the TSC, counted in 1 ms jiffies; ticks is
+// jiffies/TICKJIFFIES.  The local APIC timer is one-shot: each
+// CPU programs it for its next event only (timerarm), so an
+// idle CPU takes no timer interrupts at all, a busy one takes
+// one per quantum or per tick, and CPU 0 also wakes for the
+// next expiring kernel timer.  Every timer interrupt brings
+// jiffies up to date and runs the timers that have expired.
+//
+// Pending timers live on a hierarchical timing wheel, as in
+// Varghese & Lauck's scheme 6: the first level has a slot per
+// jiffy for the next 256 jiffies, and each of the three levels
+// above it has 64 slots covering 64 times the span of a slot
+// below.  Adding or deleting a timer is O(1), and a timer is
+// moved down a level at most three times before it fires,
+// so a tick only touches timers that are about to expire.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "timer.h"
+#include "traps.h"
+#include "info.h"
+
+// 8253/8254 programmable interval timer, channel 2, used
+// only to calibrate the TSC and the local APIC timer.
+#define IO_PIT      0x40
+#define PIT_HZ      1193182
+#define PIT_CH2     (IO_PIT+2)
+#define PIT_CTL     (IO_PIT+3)
+#define IO_PORTB    0x61        // channel 2 gate and output
+#define CALMS       10          // calibrate over this many ms
+
+#define TV1BITS     8
+#define TVNBITS     6
+#define TV1SIZE     (1<<TV1BITS)
+#define TVNSIZE     (1<<TVNBITS)
+#define TVNLEVELS   3
+#define MAXTIMEOUT  ((1U<<(TV1BITS+TVNLEVELS*TVNBITS)) - 1)
+#define MAXIDLE     1000        // longest timer interrupt gap, jiffies
+
+uint jiffies;                   // jiffynow() as of the last update
+uint tscperus = 1000;           // TSC cycles per microsecond
+static uint64 boottsc;          // TSC at jiffy 0
+struct sysinfo *sysinfo;        // Read by user space; see info.h
+
+struct {
+  struct spinlock lock;
+  uint next;                    // first jiffy not yet processed
+  struct timer *tv1[TV1SIZE];
+  struct timer *tvn[TVNLEVELS][TVNSIZE];
+} wheel;
+
+// Measure the TSC and the local APIC timer against CALMS
+// milliseconds of PIT channel 2, arm the APIC timer for the
+// first jiffy, and publish the results in the info page.
+// Interrupts must be off.
+void
+timerinit(void)
+{
+  uint64 t0, t1;
+  uint c0, c1, n;
+
+  initlock(&wheel.lock, "timer");
+
+  // Gate channel 2 on with the speaker off, and count down
+  // once in mode 0; the output goes high at zero.
+  n = PIT_HZ / 1000 * CALMS;
+  outb(IO_PORTB, (inb(IO_PORTB) & ~0x02) | 0x01);
+  outb(PIT_CTL, 0xB0);
+  lapictimer(0xFFFFFFFF);
+  outb(PIT_CH2, n & 0xFF);
+  outb(PIT_CH2, n >> 8);
+  t0 = rdtsc();
+  c0 = lapiccount();
+  while((inb(IO_PORTB) & 0x20) == 0)
+    ;
+  t1 = rdtsc();
+  c1 = lapiccount();
+
+  if(c0 - c1 >= CALMS*1000)
+    lapicjiffy = (c0 - c1) / CALMS;
+  if((uint)(t1 - t0) >= CALMS*1000)
+    tscperus = (uint)(t1 - t0) / (CALMS*1000);
+  boottsc = rdtsc();
+  lapictimer(lapicjiffy);
+  cprintf("timer: %d MHz TSC, %d APIC counts/ms\n", tscperus, lapicjiffy);
+
+  if((sysinfo = (struct sysinfo*)kalloc()) == 0)
+    panic("timerinit: info page");
+  memset(sysinfo, 0, PGSIZE);
+  sysinfo->tscperus = tscperus;
+  sysinfo->tickjiffies = TICKJIFFIES;
+  sysinfo->boottsc = boottsc;
+}
+
+// Put t on the wheel slot for its expiry time.
+// Caller holds wheel.lock.
+static void
+enqueue(struct timer *t)
+{
+  uint d;
+  int i;
+
+  d = t->expires - wheel.next;
+  if((int)d < 0){
+    // Already due; fires at the next jiffy processed.
+    t->slot = &wheel.tv1[wheel.next & (TV1SIZE-1)];
+  } else if(d < TV1SIZE){
+    t->slot = &wheel.tv1[t->expires & (TV1SIZE-1)];
+  } else {
+    if(d > MAXTIMEOUT){
+      d = MAXTIMEOUT;
+      t->expires = wheel.next + d;
+    }
+    for(i = 0; d >= (1U << (TV1BITS + (i+1)*TVNBITS)); i++)
+      ;
+    t->slot = &wheel.tvn[i][(t->expires >> (TV1BITS + i*TVNBITS)) & (TVNSIZE-1)];
+  }
+  t->next = *t->slot;
+  *t->slot = t;
+}
+
+// Move the timers of slot j at level i down the wheel.
+// Returns j, which is 0 when the level above is due too.
+static int
+cascade(int i, int j)
+{
+  struct timer *t, *next;
+
+  t = wheel.tvn[i][j];
+  wheel.tvn[i][j] = 0;
+  for(; t; t = next){
+    next = t->next;
+    enqueue(t);
+  }
+  return j;
+}
+
+// Jiffies since timerinit(), read from the TSC.
+uint
+jiffynow(void)
+{
+  return udiv64(rdtsc() - boottsc, tscperus * 1000);
+}
+
+// Earliest jiffy at which a timer may be due.  Reads the
+// wheel without the lock; see timerarm() for why that is safe.
+static uint
+nexttimer(void)
+{
+  uint next;
+  int i, j;
+
+  next = wheel.next;
+  for(i = 0; i < TV1SIZE; i++)
+    if(wheel.tv1[(next + i) & (TV1SIZE-1)])
+      return next + i;
+  // Nothing in the first level: wake up for the next
+  // cascade if any timer is further out.
+  for(i = 0; i < TVNLEVELS; i++)
+    for(j = 0; j < TVNSIZE; j++)
+      if(wheel.tvn[i][j])
+        return (next | (TV1SIZE-1)) + 1;
+  return next + MAXIDLE;
+}
+
+// Program this CPU's one-shot timer for its next event:
+// the scheduler's (see schednext) and, on CPU 0, the next
+// kernel timer.  Interrupts must be off.
+//
+// CPU 0 publishes its deadline before looking at the wheel a
+// second time, and addtimer() looks at the deadline after its
+// timer is on the wheel, so either CPU 0 sees the new timer or
+// the adder sees a deadline too late for it and pokes CPU 0.
+void
+timerarm(void)
+{
+  struct cpu *c;
+  uint now, next, d;
+  int n;
+
+  c = mycpu();
+  now = jiffynow();
+  next = now + MAXIDLE;
+  if((n = schednext(now)) >= 0)
+    next = now + n;
+  if(c == &cpus[0]){
+    do {
+      d = nexttimer();
+      if((int)(d - next) < 0)
+        next = d;
+      c->deadline = next;
+      __sync_synchronize();
+    } while((int)(nexttimer() - next) < 0);
+  } else if(n < 0){
+    // Idle, and the wheel is CPU 0's: no interrupts at all.
+    lapictimer(0);
+    return;
+  }
+  d = next - now;
+  if((int)d < 1)
+    d = 1;
+  if(d > 0xFFFFFFFF / lapicjiffy)
+    d = 0xFFFFFFFF / lapicjiffy;
+  lapictimer(d * lapicjiffy);
+}
+
+// If t is due before the interrupt CPU 0 has armed,
+// make CPU 0 arm again.
+static void
+poke(struct timer *t)
+{
+  __sync_synchronize();
+  if((int)(t->expires - cpus[0].deadline) >= 0)
+    return;
+  pushcli();
+  if(mycpu() == &cpus[0])
+    timerarm();
+  else
+    lapicipi(cpus[0].apicid, T_IRQ0 + IRQ_RESCHED);
+  popcli();
+}
+
+// Arm t to call t->fn(t) in n jiffies.
+void
+addtimer(struct timer *t, uint n)
+{
+  acquire(&wheel.lock);
+  if(t->slot)
+    panic("addtimer");
+  t->expires = jiffynow() + n;
+  enqueue(t);
+  release(&wheel.lock);
+  poke(t);
+}
+
+// Disarm t if it is pending.  Caller holds wheel.lock.
+static void
+deltimer1(struct timer *t)
+{
+  struct timer **pp;
+
+  if(t->slot == 0)
+    return;
+  for(pp = t->slot; *pp != t; pp = &(*pp)->next)
+    ;
+  *pp = t->next;
+  t->slot = 0;
+}
+
+// Disarm t; it will not fire after this returns.
+void
+deltimer(struct timer *t)
+{
+  acquire(&wheel.lock);
+  deltimer1(t);
+  release(&wheel.lock);
+}
+
+// Run the timers that expired up to and including jiffies.
+static void
+runtimers(void)
+{
+  struct timer *t;
+  int i, j;
+
+  acquire(&wheel.lock);
+  while((int)(jiffies - wheel.next) >= 0){
+    j = wheel.next & (TV1SIZE-1);
+    if(j == 0){
+      for(i = 0; i < TVNLEVELS; i++)
+        if(cascade(i, (wheel.next >> (TV1BITS + i*TVNBITS)) & (TVNSIZE-1)) != 0)
+          break;
+    }
+    while((t = wheel.tv1[j]) != 0){
+      wheel.tv1[j] = t->next;
+      t->slot = 0;
+      t->fn(t);
+    }
+    wheel.next++;
+  }
+  release(&wheel.lock);
+}
+
+// Bring jiffies and ticks up to date and run the timers
+// that have expired.  Called on every timer interrupt and
+// by idle CPUs.
+void
+timerupdate(void)
+{
+  uint now;
+
+  now = jiffynow();
+  acquire(&tickslock);
+  if((int)(now - jiffies) > 0){
+    jiffies = now;
+    ticks = now / TICKJIFFIES;
+    sysinfo->jiffies = jiffies;
+    sysinfo->ticks = ticks;
+  }
+  release(&tickslock);
+  runtimers();
+}
+
+static void
+timerwake(struct timer *t)
+{
+  wakeup(t);
+}
+
+// Sleep for n jiffies.  Returns -1 if killed first.
+int
+jsleep(uint n)
+{
+  struct timer t;
+
+  t.fn = timerwake;
+  t.slot = 0;
+  addtimer(&t, n);
+  acquire(&wheel.lock);
+  while(t.slot){
+    if(myproc()->killed){
+      deltimer1(&t);
+      release(&wheel.lock);
+      return -1;
+    }
+    sleep(&t, &wheel.lock);
+  }
+  release(&wheel.lock);
+  return 0;
+}
+
+// Sleep for us microseconds, on the wheel.  It goes no finer
+// than a jiffy, so this rounds up to whole ones: anything from
+// 1 to 1000 us sleeps 1 ms.  usleep(0) just gives up the CPU.
+int
+usleep(uint us)
+{
+  if(us == 0){
+    yield();
+    return 0;
+  }
+  return jsleep((us + 999) / 1000);
+}
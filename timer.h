@@ -0,0 +1,9 @@
+// Kernel timer: calls fn(arg) from the timer interrupt once
+// jiffies reaches expires.  See timer.c.
+struct timer {
+  uint expires;                // jiffies at which to fire
+  void (*fn)(struct timer*);   // called with the wheel locked
+  void *arg;
+  struct timer *next;          // in the wheel slot
+  struct timer **slot;         // slot it is on, 0 if not pending
+};
@@ -0,0 +1,1787 @@
+
+_timertest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int t;
+
+  t = uptime();
+   f:	e8 cc 04 00 00       	call   4e0 <uptime>
+  sleep(10);
+  14:	83 ec 0c             	sub    $0xc,%esp
+  17:	6a 0a                	push   $0xa
+  t = uptime();
+  19:	89 c3                	mov    %eax,%ebx
+  sleep(10);
+  1b:	e8 42 07 00 00       	call   762 <sleep>
+  if(uptime() - t < 10)
+  20:	e8 bb 04 00 00       	call   4e0 <uptime>
+  25:	83 c4 10             	add    $0x10,%esp
+  28:	29 d8                	sub    %ebx,%eax
+  2a:	83 f8 09             	cmp    $0x9,%eax
+  2d:	7f 0d                	jg     3c <main+0x3c>
+    fail("sleep(10) returned early");
+  2f:	83 ec 0c             	sub    $0xc,%esp
+  32:	68 98 0c 00 00       	push   $0xc98
+  37:	e8 44 00 00 00       	call   80 <fail>
+  if(usleep(100) < 0)
+  3c:	83 ec 0c             	sub    $0xc,%esp
+  3f:	6a 64                	push   $0x64
+  41:	e8 95 07 00 00       	call   7db <usleep>
+  46:	83 c4 10             	add    $0x10,%esp
+  49:	85 c0                	test   %eax,%eax
+  4b:	78 1d                	js     6a <main+0x6a>
+    fail("usleep(100)");
+
+  order();
+  4d:	e8 4e 00 00 00       	call   a0 <order>
+  accuracy();
+  52:	e8 59 01 00 00       	call   1b0 <accuracy>
+  printf(1, "timertest ok\n");
+  57:	50                   	push   %eax
+  58:	50                   	push   %eax
+  59:	68 bd 0c 00 00       	push   $0xcbd
+  5e:	6a 01                	push   $0x1
+  60:	e8 bb 08 00 00       	call   920 <printf>
+  exit();
+  65:	e8 32 06 00 00       	call   69c <exit>
+    fail("usleep(100)");
+  6a:	83 ec 0c             	sub    $0xc,%esp
+  6d:	68 b1 0c 00 00       	push   $0xcb1
+  72:	e8 09 00 00 00       	call   80 <fail>
+  77:	66 90                	xchg   %ax,%ax
+  79:	66 90                	xchg   %ax,%ax
+  7b:	66 90                	xchg   %ax,%ax
+  7d:	66 90                	xchg   %ax,%ax
+  7f:	90                   	nop
+
+00000080 <fail>:
+{
+  80:	55                   	push   %ebp
+  81:	89 e5                	mov    %esp,%ebp
+  83:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "timertest: %s\n", msg);
+  86:	ff 75 08             	push   0x8(%ebp)
+  89:	68 48 0c 00 00       	push   $0xc48
+  8e:	6a 01                	push   $0x1
+  90:	e8 8b 08 00 00       	call   920 <printf>
+  exit();
+  95:	e8 02 06 00 00       	call   69c <exit>
+  9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000000a0 <order>:
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	56                   	push   %esi
+  a4:	53                   	push   %ebx
+  if(pipe(fds) < 0)
+  a5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+{
+  a8:	83 ec 1c             	sub    $0x1c,%esp
+  if(pipe(fds) < 0)
+  ab:	50                   	push   %eax
+  ac:	e8 01 06 00 00       	call   6b2 <pipe>
+  b1:	83 c4 10             	add    $0x10,%esp
+  b4:	85 c0                	test   %eax,%eax
+  b6:	0f 88 d8 00 00 00    	js     194 <order+0xf4>
+  for(i = 0; i < NORDER; i++){
+  bc:	31 db                	xor    %ebx,%ebx
+  be:	66 90                	xchg   %ax,%ax
+    if(fork() == 0){
+  c0:	e8 cc 05 00 00       	call   691 <fork>
+  c5:	85 c0                	test   %eax,%eax
+  c7:	74 78                	je     141 <order+0xa1>
+  for(i = 0; i < NORDER; i++){
+  c9:	83 c3 01             	add    $0x1,%ebx
+  cc:	83 fb 08             	cmp    $0x8,%ebx
+  cf:	75 ef                	jne    c0 <order+0x20>
+  close(fds[1]);
+  d1:	83 ec 0c             	sub    $0xc,%esp
+  d4:	ff 75 f4             	push   -0xc(%ebp)
+  for(i = NORDER-1; i >= 0; i--){
+  d7:	bb 07 00 00 00       	mov    $0x7,%ebx
+  dc:	8d 75 ef             	lea    -0x11(%ebp),%esi
+  close(fds[1]);
+  df:	e8 ef 05 00 00       	call   6d3 <close>
+  e4:	83 c4 10             	add    $0x10,%esp
+  e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ee:	66 90                	xchg   %ax,%ax
+    if(read(fds[0], &c, 1) != 1)
+  f0:	83 ec 04             	sub    $0x4,%esp
+  f3:	6a 01                	push   $0x1
+  f5:	56                   	push   %esi
+  f6:	ff 75 f0             	push   -0x10(%ebp)
+  f9:	e8 bf 05 00 00       	call   6bd <read>
+  fe:	83 c4 10             	add    $0x10,%esp
+ 101:	83 f8 01             	cmp    $0x1,%eax
+ 104:	0f 85 7d 00 00 00    	jne    187 <order+0xe7>
+    if(c != i)
+ 10a:	0f be 45 ef          	movsbl -0x11(%ebp),%eax
+ 10e:	39 d8                	cmp    %ebx,%eax
+ 110:	75 68                	jne    17a <order+0xda>
+  for(i = NORDER-1; i >= 0; i--){
+ 112:	83 eb 01             	sub    $0x1,%ebx
+ 115:	73 d9                	jae    f0 <order+0x50>
+  close(fds[0]);
+ 117:	83 ec 0c             	sub    $0xc,%esp
+ 11a:	ff 75 f0             	push   -0x10(%ebp)
+ 11d:	bb 08 00 00 00       	mov    $0x8,%ebx
+ 122:	e8 ac 05 00 00       	call   6d3 <close>
+ 127:	83 c4 10             	add    $0x10,%esp
+ 12a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+ 130:	e8 72 05 00 00       	call   6a7 <wait>
+  for(i = 0; i < NORDER; i++)
+ 135:	83 eb 01             	sub    $0x1,%ebx
+ 138:	75 f6                	jne    130 <order+0x90>
+}
+ 13a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 13d:	5b                   	pop    %ebx
+ 13e:	5e                   	pop    %esi
+ 13f:	5d                   	pop    %ebp
+ 140:	c3                   	ret
+      close(fds[0]);
+ 141:	83 ec 0c             	sub    $0xc,%esp
+ 144:	ff 75 f0             	push   -0x10(%ebp)
+ 147:	e8 87 05 00 00       	call   6d3 <close>
+      usleep((NORDER - i) * 5000);
+ 14c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 151:	29 d8                	sub    %ebx,%eax
+ 153:	69 c0 88 13 00 00    	imul   $0x1388,%eax,%eax
+ 159:	89 04 24             	mov    %eax,(%esp)
+ 15c:	e8 7a 06 00 00       	call   7db <usleep>
+      write(fds[1], &c, 1);
+ 161:	83 c4 0c             	add    $0xc,%esp
+ 164:	8d 45 ef             	lea    -0x11(%ebp),%eax
+      c = i;
+ 167:	88 5d ef             	mov    %bl,-0x11(%ebp)
+      write(fds[1], &c, 1);
+ 16a:	6a 01                	push   $0x1
+ 16c:	50                   	push   %eax
+ 16d:	ff 75 f4             	push   -0xc(%ebp)
+ 170:	e8 53 05 00 00       	call   6c8 <write>
+      exit();
+ 175:	e8 22 05 00 00       	call   69c <exit>
+      fail("sleepers woke out of order");
+ 17a:	83 ec 0c             	sub    $0xc,%esp
+ 17d:	68 67 0c 00 00       	push   $0xc67
+ 182:	e8 f9 fe ff ff       	call   80 <fail>
+      fail("short read");
+ 187:	83 ec 0c             	sub    $0xc,%esp
+ 18a:	68 5c 0c 00 00       	push   $0xc5c
+ 18f:	e8 ec fe ff ff       	call   80 <fail>
+    fail("pipe");
+ 194:	83 ec 0c             	sub    $0xc,%esp
+ 197:	68 57 0c 00 00       	push   $0xc57
+ 19c:	e8 df fe ff ff       	call   80 <fail>
+ 1a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1af:	90                   	nop
+
+000001b0 <accuracy>:
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	57                   	push   %edi
+ 1b4:	56                   	push   %esi
+ 1b5:	8d b5 68 ff ff ff    	lea    -0x98(%ebp),%esi
+ 1bb:	8d 7d e8             	lea    -0x18(%ebp),%edi
+ 1be:	53                   	push   %ebx
+ 1bf:	89 f3                	mov    %esi,%ebx
+ 1c1:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+ 1c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ce:	66 90                	xchg   %ax,%ax
+    if((pids[i] = fork()) == 0){
+ 1d0:	e8 bc 04 00 00       	call   691 <fork>
+ 1d5:	89 03                	mov    %eax,(%ebx)
+ 1d7:	85 c0                	test   %eax,%eax
+ 1d9:	74 7e                	je     259 <accuracy+0xa9>
+  for(i = 0; i < NIDLE; i++){
+ 1db:	83 c3 04             	add    $0x4,%ebx
+ 1de:	39 fb                	cmp    %edi,%ebx
+ 1e0:	75 ee                	jne    1d0 <accuracy+0x20>
+  t = uptime();
+ 1e2:	e8 f9 02 00 00       	call   4e0 <uptime>
+ 1e7:	bb c8 00 00 00       	mov    $0xc8,%ebx
+ 1ec:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+  for(i = 0; i < 200; i++)
+ 1f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    usleep(1000);
+ 1f8:	83 ec 0c             	sub    $0xc,%esp
+ 1fb:	68 e8 03 00 00       	push   $0x3e8
+ 200:	e8 d6 05 00 00       	call   7db <usleep>
+  for(i = 0; i < 200; i++)
+ 205:	83 c4 10             	add    $0x10,%esp
+ 208:	83 eb 01             	sub    $0x1,%ebx
+ 20b:	75 eb                	jne    1f8 <accuracy+0x48>
+  t = uptime() - t;
+ 20d:	e8 ce 02 00 00       	call   4e0 <uptime>
+ 212:	8b 95 64 ff ff ff    	mov    -0x9c(%ebp),%edx
+  printf(1, "timertest: 200 x usleep(1000) took %d ticks\n", t);
+ 218:	83 ec 04             	sub    $0x4,%esp
+  t = uptime() - t;
+ 21b:	29 d0                	sub    %edx,%eax
+  printf(1, "timertest: 200 x usleep(1000) took %d ticks\n", t);
+ 21d:	50                   	push   %eax
+  t = uptime() - t;
+ 21e:	89 c3                	mov    %eax,%ebx
+  printf(1, "timertest: 200 x usleep(1000) took %d ticks\n", t);
+ 220:	68 cc 0c 00 00       	push   $0xccc
+ 225:	6a 01                	push   $0x1
+ 227:	e8 f4 06 00 00       	call   920 <printf>
+  if(t < 19)
+ 22c:	83 c4 10             	add    $0x10,%esp
+ 22f:	83 fb 12             	cmp    $0x12,%ebx
+ 232:	7e 37                	jle    26b <accuracy+0xbb>
+ 234:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    kill(pids[i]);
+ 238:	83 ec 0c             	sub    $0xc,%esp
+ 23b:	ff 36                	push   (%esi)
+  for(i = 0; i < NIDLE; i++){
+ 23d:	83 c6 04             	add    $0x4,%esi
+    kill(pids[i]);
+ 240:	e8 99 04 00 00       	call   6de <kill>
+    wait();
+ 245:	e8 5d 04 00 00       	call   6a7 <wait>
+  for(i = 0; i < NIDLE; i++){
+ 24a:	83 c4 10             	add    $0x10,%esp
+ 24d:	39 fe                	cmp    %edi,%esi
+ 24f:	75 e7                	jne    238 <accuracy+0x88>
+}
+ 251:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 254:	5b                   	pop    %ebx
+ 255:	5e                   	pop    %esi
+ 256:	5f                   	pop    %edi
+ 257:	5d                   	pop    %ebp
+ 258:	c3                   	ret
+      sleep(100000);
+ 259:	83 ec 0c             	sub    $0xc,%esp
+ 25c:	68 a0 86 01 00       	push   $0x186a0
+ 261:	e8 fc 04 00 00       	call   762 <sleep>
+      exit();
+ 266:	e8 31 04 00 00       	call   69c <exit>
+    fail("usleep returned early");
+ 26b:	83 ec 0c             	sub    $0xc,%esp
+ 26e:	68 82 0c 00 00       	push   $0xc82
+ 273:	e8 08 fe ff ff       	call   80 <fail>
+ 278:	66 90                	xchg   %ax,%ax
+ 27a:	66 90                	xchg   %ax,%ax
+ 27c:	66 90                	xchg   %ax,%ax
+ 27e:	66 90                	xchg   %ax,%ax
+
+00000280 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 280:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 281:	31 c0                	xor    %eax,%eax
+{
+ 283:	89 e5                	mov    %esp,%ebp
+ 285:	53                   	push   %ebx
+ 286:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 289:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 290:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 294:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 297:	83 c0 01             	add    $0x1,%eax
+ 29a:	84 d2                	test   %dl,%dl
+ 29c:	75 f2                	jne    290 <strcpy+0x10>
+    ;
+  return os;
+}
+ 29e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2a1:	89 c8                	mov    %ecx,%eax
+ 2a3:	c9                   	leave
+ 2a4:	c3                   	ret
+ 2a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	53                   	push   %ebx
+ 2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2ba:	0f b6 02             	movzbl (%edx),%eax
+ 2bd:	84 c0                	test   %al,%al
+ 2bf:	75 17                	jne    2d8 <strcmp+0x28>
+ 2c1:	eb 3a                	jmp    2fd <strcmp+0x4d>
+ 2c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c7:	90                   	nop
+ 2c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2cc:	83 c2 01             	add    $0x1,%edx
+ 2cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2d2:	84 c0                	test   %al,%al
+ 2d4:	74 1a                	je     2f0 <strcmp+0x40>
+    p++, q++;
+ 2d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2d8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2db:	38 c3                	cmp    %al,%bl
+ 2dd:	74 e9                	je     2c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2df:	29 d8                	sub    %ebx,%eax
+}
+ 2e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2e4:	c9                   	leave
+ 2e5:	c3                   	ret
+ 2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2f4:	31 c0                	xor    %eax,%eax
+ 2f6:	29 d8                	sub    %ebx,%eax
+}
+ 2f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2fb:	c9                   	leave
+ 2fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 300:	31 c0                	xor    %eax,%eax
+ 302:	eb db                	jmp    2df <strcmp+0x2f>
+ 304:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 30f:	90                   	nop
+
+00000310 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 316:	80 3a 00             	cmpb   $0x0,(%edx)
+ 319:	74 15                	je     330 <strlen+0x20>
+ 31b:	31 c0                	xor    %eax,%eax
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+ 320:	83 c0 01             	add    $0x1,%eax
+ 323:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 327:	89 c1                	mov    %eax,%ecx
+ 329:	75 f5                	jne    320 <strlen+0x10>
+    ;
+  return n;
+}
+ 32b:	89 c8                	mov    %ecx,%eax
+ 32d:	5d                   	pop    %ebp
+ 32e:	c3                   	ret
+ 32f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 330:	31 c9                	xor    %ecx,%ecx
+}
+ 332:	5d                   	pop    %ebp
+ 333:	89 c8                	mov    %ecx,%eax
+ 335:	c3                   	ret
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 347:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 34a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 34d:	89 d7                	mov    %edx,%edi
+ 34f:	fc                   	cld
+ 350:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 352:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 355:	89 d0                	mov    %edx,%eax
+ 357:	c9                   	leave
+ 358:	c3                   	ret
+ 359:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000360 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	8b 45 08             	mov    0x8(%ebp),%eax
+ 366:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 36a:	0f b6 10             	movzbl (%eax),%edx
+ 36d:	84 d2                	test   %dl,%dl
+ 36f:	75 12                	jne    383 <strchr+0x23>
+ 371:	eb 1d                	jmp    390 <strchr+0x30>
+ 373:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 377:	90                   	nop
+ 378:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 37c:	83 c0 01             	add    $0x1,%eax
+ 37f:	84 d2                	test   %dl,%dl
+ 381:	74 0d                	je     390 <strchr+0x30>
+    if(*s == c)
+ 383:	38 d1                	cmp    %dl,%cl
+ 385:	75 f1                	jne    378 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 387:	5d                   	pop    %ebp
+ 388:	c3                   	ret
+ 389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 390:	31 c0                	xor    %eax,%eax
+}
+ 392:	5d                   	pop    %ebp
+ 393:	c3                   	ret
+ 394:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 39f:	90                   	nop
+
+000003a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	57                   	push   %edi
+ 3a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3a9:	31 db                	xor    %ebx,%ebx
+{
+ 3ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3ae:	eb 27                	jmp    3d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 3b0:	83 ec 04             	sub    $0x4,%esp
+ 3b3:	6a 01                	push   $0x1
+ 3b5:	56                   	push   %esi
+ 3b6:	6a 00                	push   $0x0
+ 3b8:	e8 00 03 00 00       	call   6bd <read>
+    if(cc < 1)
+ 3bd:	83 c4 10             	add    $0x10,%esp
+ 3c0:	85 c0                	test   %eax,%eax
+ 3c2:	7e 1d                	jle    3e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 3c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 3cf:	3c 0a                	cmp    $0xa,%al
+ 3d1:	74 10                	je     3e3 <gets+0x43>
+ 3d3:	3c 0d                	cmp    $0xd,%al
+ 3d5:	74 0c                	je     3e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3d7:	89 df                	mov    %ebx,%edi
+ 3d9:	83 c3 01             	add    $0x1,%ebx
+ 3dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3df:	7c cf                	jl     3b0 <gets+0x10>
+ 3e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 3e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 3ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3ed:	5b                   	pop    %ebx
+ 3ee:	5e                   	pop    %esi
+ 3ef:	5f                   	pop    %edi
+ 3f0:	5d                   	pop    %ebp
+ 3f1:	c3                   	ret
+ 3f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	56                   	push   %esi
+ 404:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 405:	83 ec 08             	sub    $0x8,%esp
+ 408:	6a 00                	push   $0x0
+ 40a:	ff 75 08             	push   0x8(%ebp)
+ 40d:	e8 e2 02 00 00       	call   6f4 <open>
+  if(fd < 0)
+ 412:	83 c4 10             	add    $0x10,%esp
+ 415:	85 c0                	test   %eax,%eax
+ 417:	78 27                	js     440 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 419:	83 ec 08             	sub    $0x8,%esp
+ 41c:	ff 75 0c             	push   0xc(%ebp)
+ 41f:	89 c3                	mov    %eax,%ebx
+ 421:	50                   	push   %eax
+ 422:	e8 ee 02 00 00       	call   715 <fstat>
+  close(fd);
+ 427:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 42a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 42c:	e8 a2 02 00 00       	call   6d3 <close>
+  return r;
+ 431:	83 c4 10             	add    $0x10,%esp
+}
+ 434:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 437:	89 f0                	mov    %esi,%eax
+ 439:	5b                   	pop    %ebx
+ 43a:	5e                   	pop    %esi
+ 43b:	5d                   	pop    %ebp
+ 43c:	c3                   	ret
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 440:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 445:	eb ed                	jmp    434 <stat+0x34>
+ 447:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44e:	66 90                	xchg   %ax,%ax
+
+00000450 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	53                   	push   %ebx
+ 454:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 457:	0f be 02             	movsbl (%edx),%eax
+ 45a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 45d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 460:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 465:	77 1e                	ja     485 <atoi+0x35>
+ 467:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 470:	83 c2 01             	add    $0x1,%edx
+ 473:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 476:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 47a:	0f be 02             	movsbl (%edx),%eax
+ 47d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 480:	80 fb 09             	cmp    $0x9,%bl
+ 483:	76 eb                	jbe    470 <atoi+0x20>
+  return n;
+}
+ 485:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 488:	89 c8                	mov    %ecx,%eax
+ 48a:	c9                   	leave
+ 48b:	c3                   	ret
+ 48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+ 495:	8b 45 10             	mov    0x10(%ebp),%eax
+ 498:	8b 55 08             	mov    0x8(%ebp),%edx
+ 49b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 49e:	85 c0                	test   %eax,%eax
+ 4a0:	7e 13                	jle    4b5 <memmove+0x25>
+ 4a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4a4:	89 d7                	mov    %edx,%edi
+ 4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4b1:	39 f8                	cmp    %edi,%eax
+ 4b3:	75 fb                	jne    4b0 <memmove+0x20>
+  return vdst;
+}
+ 4b5:	5e                   	pop    %esi
+ 4b6:	89 d0                	mov    %edx,%eax
+ 4b8:	5f                   	pop    %edi
+ 4b9:	5d                   	pop    %ebp
+ 4ba:	c3                   	ret
+ 4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4bf:	90                   	nop
+
+000004c0 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 4c0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 4c5:	85 c0                	test   %eax,%eax
+ 4c7:	74 07                	je     4d0 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 4c9:	c3                   	ret
+ 4ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 4d0:	e9 77 02 00 00       	jmp    74c <sysgetpid>
+ 4d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004e0 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 4e0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 4e5:	c3                   	ret
+ 4e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004f0 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 4f0:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 4f1:	31 d2                	xor    %edx,%edx
+ 4f3:	89 e5                	mov    %esp,%ebp
+ 4f5:	53                   	push   %ebx
+ 4f6:	83 ec 04             	sub    $0x4,%esp
+ 4f9:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 4fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 4ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 502:	85 c9                	test   %ecx,%ecx
+ 504:	7e 08                	jle    50e <cyclereport+0x1e>
+ 506:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 508:	89 d8                	mov    %ebx,%eax
+ 50a:	f7 f1                	div    %ecx
+ 50c:	89 c2                	mov    %eax,%edx
+ 50e:	83 ec 08             	sub    $0x8,%esp
+ 511:	52                   	push   %edx
+ 512:	ff 75 0c             	push   0xc(%ebp)
+ 515:	51                   	push   %ecx
+ 516:	ff 75 08             	push   0x8(%ebp)
+ 519:	68 f9 0c 00 00       	push   $0xcf9
+ 51e:	6a 01                	push   $0x1
+ 520:	e8 fb 03 00 00       	call   920 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 525:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 528:	83 c4 20             	add    $0x20,%esp
+ 52b:	c9                   	leave
+ 52c:	c3                   	ret
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000530 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 533:	8b 45 08             	mov    0x8(%ebp),%eax
+ 536:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 53c:	5d                   	pop    %ebp
+ 53d:	c3                   	ret
+ 53e:	66 90                	xchg   %ax,%ax
+
+00000540 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 540:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 541:	31 c0                	xor    %eax,%eax
+ 543:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 548:	89 e5                	mov    %esp,%ebp
+ 54a:	56                   	push   %esi
+ 54b:	53                   	push   %ebx
+ 54c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 54f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 553:	85 c0                	test   %eax,%eax
+ 555:	74 30                	je     587 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 557:	83 f8 02             	cmp    $0x2,%eax
+ 55a:	74 0c                	je     568 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 55c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 561:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 564:	85 c0                	test   %eax,%eax
+ 566:	74 1f                	je     587 <mutex_lock+0x47>
+ 568:	be 02 00 00 00       	mov    $0x2,%esi
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 570:	83 ec 08             	sub    $0x8,%esp
+ 573:	6a 02                	push   $0x2
+ 575:	53                   	push   %ebx
+ 576:	e8 8c 02 00 00       	call   807 <futex_wait>
+ 57b:	89 f0                	mov    %esi,%eax
+ 57d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 580:	83 c4 10             	add    $0x10,%esp
+ 583:	85 c0                	test   %eax,%eax
+ 585:	75 e9                	jne    570 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 587:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 58a:	5b                   	pop    %ebx
+ 58b:	5e                   	pop    %esi
+ 58c:	5d                   	pop    %ebp
+ 58d:	c3                   	ret
+ 58e:	66 90                	xchg   %ax,%ax
+
+00000590 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	83 ec 08             	sub    $0x8,%esp
+ 596:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 599:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 59d:	75 09                	jne    5a8 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 59f:	c9                   	leave
+ 5a0:	c3                   	ret
+ 5a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 5a8:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 5ab:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 5b1:	6a 01                	push   $0x1
+ 5b3:	50                   	push   %eax
+ 5b4:	e8 59 02 00 00       	call   812 <futex_wake>
+ 5b9:	83 c4 10             	add    $0x10,%esp
+}
+ 5bc:	c9                   	leave
+ 5bd:	c3                   	ret
+ 5be:	66 90                	xchg   %ax,%ax
+
+000005c0 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 5c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 5cc:	5d                   	pop    %ebp
+ 5cd:	c3                   	ret
+ 5ce:	66 90                	xchg   %ax,%ax
+
+000005d0 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	57                   	push   %edi
+ 5d4:	56                   	push   %esi
+ 5d5:	53                   	push   %ebx
+ 5d6:	83 ec 0c             	sub    $0xc,%esp
+ 5d9:	8b 75 08             	mov    0x8(%ebp),%esi
+ 5dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 5df:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 5e1:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 5e5:	75 21                	jne    608 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 5e7:	83 ec 08             	sub    $0x8,%esp
+ 5ea:	57                   	push   %edi
+ 5eb:	56                   	push   %esi
+ 5ec:	e8 16 02 00 00       	call   807 <futex_wait>
+  mutex_lock(m);
+ 5f1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 5f4:	83 c4 10             	add    $0x10,%esp
+}
+ 5f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5fa:	5b                   	pop    %ebx
+ 5fb:	5e                   	pop    %esi
+ 5fc:	5f                   	pop    %edi
+ 5fd:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 5fe:	e9 3d ff ff ff       	jmp    540 <mutex_lock>
+ 603:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 607:	90                   	nop
+    futex_wake(&m->v, 1);
+ 608:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 60b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 611:	6a 01                	push   $0x1
+ 613:	53                   	push   %ebx
+ 614:	e8 f9 01 00 00       	call   812 <futex_wake>
+ 619:	83 c4 10             	add    $0x10,%esp
+ 61c:	eb c9                	jmp    5e7 <cond_wait+0x17>
+ 61e:	66 90                	xchg   %ax,%ax
+
+00000620 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	83 ec 10             	sub    $0x10,%esp
+ 626:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 629:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 62d:	6a 01                	push   $0x1
+ 62f:	50                   	push   %eax
+ 630:	e8 dd 01 00 00       	call   812 <futex_wake>
+}
+ 635:	83 c4 10             	add    $0x10,%esp
+ 638:	c9                   	leave
+ 639:	c3                   	ret
+ 63a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000640 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	83 ec 10             	sub    $0x10,%esp
+ 646:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 649:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 64d:	68 ff ff ff 7f       	push   $0x7fffffff
+ 652:	50                   	push   %eax
+ 653:	e8 ba 01 00 00       	call   812 <futex_wake>
+}
+ 658:	83 c4 10             	add    $0x10,%esp
+ 65b:	c9                   	leave
+ 65c:	c3                   	ret
+
+0000065d <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 65d:	50                   	push   %eax
+  pushl %ebx
+ 65e:	53                   	push   %ebx
+  movl $1, %eax
+ 65f:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 664:	0f a2                	cpuid
+  popl %ebx
+ 666:	5b                   	pop    %ebx
+  popl %eax
+ 667:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 668:	c7 05 d8 11 00 00 8e 	movl   $0x68e,0x11d8
+ 66f:	06 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 672:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 678:	74 14                	je     68e <sysint>
+  movl $sysfast, syscallvec
+ 67a:	c7 05 d8 11 00 00 84 	movl   $0x684,0x11d8
+ 681:	06 00 00 
+
+00000684 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 684:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 686:	ba 8d 06 00 00       	mov    $0x68d,%edx
+  sysenter
+ 68b:	0f 34                	sysenter
+1:
+  ret
+ 68d:	c3                   	ret
+
+0000068e <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 68e:	cd 40                	int    $0x40
+  ret
+ 690:	c3                   	ret
+
+00000691 <fork>:
+
+SYSCALL(fork)
+ 691:	b8 01 00 00 00       	mov    $0x1,%eax
+ 696:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+0000069c <exit>:
+SYSCALL(exit)
+ 69c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6a1:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+000006a7 <wait>:
+SYSCALL(wait)
+ 6a7:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6ac:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+000006b2 <pipe>:
+SYSCALL(pipe)
+ 6b2:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6b7:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+000006bd <read>:
+SYSCALL(read)
+ 6bd:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6c2:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+000006c8 <write>:
+SYSCALL(write)
+ 6c8:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6cd:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+000006d3 <close>:
+SYSCALL(close)
+ 6d3:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6d8:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+000006de <kill>:
+SYSCALL(kill)
+ 6de:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6e3:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+000006e9 <exec>:
+SYSCALL(exec)
+ 6e9:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6ee:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+000006f4 <open>:
+SYSCALL(open)
+ 6f4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6f9:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+000006ff <mknod>:
+SYSCALL(mknod)
+ 6ff:	b8 11 00 00 00       	mov    $0x11,%eax
+ 704:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+0000070a <unlink>:
+SYSCALL(unlink)
+ 70a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 70f:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+00000715 <fstat>:
+SYSCALL(fstat)
+ 715:	b8 08 00 00 00       	mov    $0x8,%eax
+ 71a:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+00000720 <link>:
+SYSCALL(link)
+ 720:	b8 13 00 00 00       	mov    $0x13,%eax
+ 725:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+0000072b <mkdir>:
+SYSCALL(mkdir)
+ 72b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 730:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+00000736 <chdir>:
+SYSCALL(chdir)
+ 736:	b8 09 00 00 00       	mov    $0x9,%eax
+ 73b:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+00000741 <dup>:
+SYSCALL(dup)
+ 741:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 746:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+0000074c <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 74c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 751:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+00000757 <sbrk>:
+SYSCALL(sbrk)
+ 757:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 75c:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+00000762 <sleep>:
+SYSCALL(sleep)
+ 762:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 767:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+0000076d <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 76d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 772:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+00000778 <swapread>:
+SYSCALL(swapread)
+ 778:	b8 16 00 00 00       	mov    $0x16,%eax
+ 77d:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+00000783 <swapwrite>:
+SYSCALL(swapwrite)
+ 783:	b8 17 00 00 00       	mov    $0x17,%eax
+ 788:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+0000078e <swapstat>:
+SYSCALL(swapstat)
+ 78e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 793:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+00000799 <madvise>:
+SYSCALL(madvise)
+ 799:	b8 19 00 00 00       	mov    $0x19,%eax
+ 79e:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+000007a4 <mlock>:
+SYSCALL(mlock)
+ 7a4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7a9:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+000007af <munlock>:
+SYSCALL(munlock)
+ 7af:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7b4:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+000007ba <membench>:
+SYSCALL(membench)
+ 7ba:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7bf:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+000007c5 <nice>:
+SYSCALL(nice)
+ 7c5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 7ca:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+000007d0 <setpriority>:
+SYSCALL(setpriority)
+ 7d0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 7d5:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+000007db <usleep>:
+SYSCALL(usleep)
+ 7db:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 7e0:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+000007e6 <cpustat>:
+SYSCALL(cpustat)
+ 7e6:	b8 20 00 00 00       	mov    $0x20,%eax
+ 7eb:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+000007f1 <clone>:
+SYSCALL(clone)
+ 7f1:	b8 21 00 00 00       	mov    $0x21,%eax
+ 7f6:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+000007fc <join>:
+SYSCALL(join)
+ 7fc:	b8 22 00 00 00       	mov    $0x22,%eax
+ 801:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+00000807 <futex_wait>:
+SYSCALL(futex_wait)
+ 807:	b8 23 00 00 00       	mov    $0x23,%eax
+ 80c:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+00000812 <futex_wake>:
+SYSCALL(futex_wake)
+ 812:	b8 24 00 00 00       	mov    $0x24,%eax
+ 817:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+0000081d <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 81d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 822:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+00000828 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 828:	b8 26 00 00 00       	mov    $0x26,%eax
+ 82d:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+00000833 <getcpu>:
+SYSCALL(getcpu)
+ 833:	b8 27 00 00 00       	mov    $0x27,%eax
+ 838:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+0000083e <migrations>:
+SYSCALL(migrations)
+ 83e:	b8 28 00 00 00       	mov    $0x28,%eax
+ 843:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+00000849 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 849:	b8 29 00 00 00       	mov    $0x29,%eax
+ 84e:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+00000854 <lockstat>:
+SYSCALL(lockstat)
+ 854:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 859:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+0000085f <lockprof>:
+SYSCALL(lockprof)
+ 85f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 864:	ff 25 d8 11 00 00    	jmp    *0x11d8
+
+0000086a <bcachestat>:
+SYSCALL(bcachestat)
+ 86a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 86f:	ff 25 d8 11 00 00    	jmp    *0x11d8
+ 875:	66 90                	xchg   %ax,%ax
+ 877:	66 90                	xchg   %ax,%ax
+ 879:	66 90                	xchg   %ax,%ax
+ 87b:	66 90                	xchg   %ax,%ax
+ 87d:	66 90                	xchg   %ax,%ax
+ 87f:	90                   	nop
+
+00000880 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 880:	55                   	push   %ebp
+ 881:	89 e5                	mov    %esp,%ebp
+ 883:	57                   	push   %edi
+ 884:	56                   	push   %esi
+ 885:	53                   	push   %ebx
+ 886:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 888:	89 d1                	mov    %edx,%ecx
+{
+ 88a:	83 ec 3c             	sub    $0x3c,%esp
+ 88d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 890:	85 d2                	test   %edx,%edx
+ 892:	0f 89 80 00 00 00    	jns    918 <printint+0x98>
+ 898:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 89c:	74 7a                	je     918 <printint+0x98>
+    x = -xx;
+ 89e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 8a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 8a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 8a8:	31 f6                	xor    %esi,%esi
+ 8aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 8b0:	89 c8                	mov    %ecx,%eax
+ 8b2:	31 d2                	xor    %edx,%edx
+ 8b4:	89 f7                	mov    %esi,%edi
+ 8b6:	f7 f3                	div    %ebx
+ 8b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 8bb:	0f b6 92 74 0d 00 00 	movzbl 0xd74(%edx),%edx
+ 8c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 8c6:	89 ca                	mov    %ecx,%edx
+ 8c8:	89 c1                	mov    %eax,%ecx
+ 8ca:	39 da                	cmp    %ebx,%edx
+ 8cc:	73 e2                	jae    8b0 <printint+0x30>
+  if(neg)
+ 8ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 8d1:	85 c0                	test   %eax,%eax
+ 8d3:	74 07                	je     8dc <printint+0x5c>
+    buf[i++] = '-';
+ 8d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 8da:	89 f7                	mov    %esi,%edi
+ 8dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 8df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 8e2:	01 df                	add    %ebx,%edi
+ 8e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 8e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 8eb:	83 ec 04             	sub    $0x4,%esp
+ 8ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 8f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 8f4:	6a 01                	push   $0x1
+ 8f6:	50                   	push   %eax
+ 8f7:	56                   	push   %esi
+ 8f8:	e8 cb fd ff ff       	call   6c8 <write>
+  while(--i >= 0)
+ 8fd:	89 f8                	mov    %edi,%eax
+ 8ff:	83 c4 10             	add    $0x10,%esp
+ 902:	83 ef 01             	sub    $0x1,%edi
+ 905:	39 d8                	cmp    %ebx,%eax
+ 907:	75 df                	jne    8e8 <printint+0x68>
+}
+ 909:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 90c:	5b                   	pop    %ebx
+ 90d:	5e                   	pop    %esi
+ 90e:	5f                   	pop    %edi
+ 90f:	5d                   	pop    %ebp
+ 910:	c3                   	ret
+ 911:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 918:	31 c0                	xor    %eax,%eax
+ 91a:	eb 89                	jmp    8a5 <printint+0x25>
+ 91c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000920 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 920:	55                   	push   %ebp
+ 921:	89 e5                	mov    %esp,%ebp
+ 923:	57                   	push   %edi
+ 924:	56                   	push   %esi
+ 925:	53                   	push   %ebx
+ 926:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 929:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 92c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 92f:	0f b6 1e             	movzbl (%esi),%ebx
+ 932:	83 c6 01             	add    $0x1,%esi
+ 935:	84 db                	test   %bl,%bl
+ 937:	74 67                	je     9a0 <printf+0x80>
+ 939:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 93c:	31 d2                	xor    %edx,%edx
+ 93e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 941:	eb 34                	jmp    977 <printf+0x57>
+ 943:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 947:	90                   	nop
+ 948:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 94b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 950:	83 f8 25             	cmp    $0x25,%eax
+ 953:	74 18                	je     96d <printf+0x4d>
+  write(fd, &c, 1);
+ 955:	83 ec 04             	sub    $0x4,%esp
+ 958:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 95b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 95e:	6a 01                	push   $0x1
+ 960:	50                   	push   %eax
+ 961:	57                   	push   %edi
+ 962:	e8 61 fd ff ff       	call   6c8 <write>
+ 967:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 96a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 96d:	0f b6 1e             	movzbl (%esi),%ebx
+ 970:	83 c6 01             	add    $0x1,%esi
+ 973:	84 db                	test   %bl,%bl
+ 975:	74 29                	je     9a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 977:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 97a:	85 d2                	test   %edx,%edx
+ 97c:	74 ca                	je     948 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 97e:	83 fa 25             	cmp    $0x25,%edx
+ 981:	75 ea                	jne    96d <printf+0x4d>
+      if(c == 'd'){
+ 983:	83 f8 25             	cmp    $0x25,%eax
+ 986:	0f 84 24 01 00 00    	je     ab0 <printf+0x190>
+ 98c:	83 e8 63             	sub    $0x63,%eax
+ 98f:	83 f8 15             	cmp    $0x15,%eax
+ 992:	77 1c                	ja     9b0 <printf+0x90>
+ 994:	ff 24 85 1c 0d 00 00 	jmp    *0xd1c(,%eax,4)
+ 99b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 99f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 9a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9a3:	5b                   	pop    %ebx
+ 9a4:	5e                   	pop    %esi
+ 9a5:	5f                   	pop    %edi
+ 9a6:	5d                   	pop    %ebp
+ 9a7:	c3                   	ret
+ 9a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9af:	90                   	nop
+  write(fd, &c, 1);
+ 9b0:	83 ec 04             	sub    $0x4,%esp
+ 9b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 9ba:	6a 01                	push   $0x1
+ 9bc:	52                   	push   %edx
+ 9bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 9c0:	57                   	push   %edi
+ 9c1:	e8 02 fd ff ff       	call   6c8 <write>
+ 9c6:	83 c4 0c             	add    $0xc,%esp
+ 9c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9cc:	6a 01                	push   $0x1
+ 9ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 9d1:	52                   	push   %edx
+ 9d2:	57                   	push   %edi
+ 9d3:	e8 f0 fc ff ff       	call   6c8 <write>
+        putc(fd, c);
+ 9d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9db:	31 d2                	xor    %edx,%edx
+ 9dd:	eb 8e                	jmp    96d <printf+0x4d>
+ 9df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 9e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9e3:	83 ec 0c             	sub    $0xc,%esp
+ 9e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 9eb:	8b 13                	mov    (%ebx),%edx
+ 9ed:	6a 00                	push   $0x0
+ 9ef:	89 f8                	mov    %edi,%eax
+        ap++;
+ 9f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 9f4:	e8 87 fe ff ff       	call   880 <printint>
+        ap++;
+ 9f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9ff:	31 d2                	xor    %edx,%edx
+ a01:	e9 67 ff ff ff       	jmp    96d <printf+0x4d>
+ a06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a10:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a13:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a15:	83 c0 04             	add    $0x4,%eax
+ a18:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a1b:	85 db                	test   %ebx,%ebx
+ a1d:	0f 84 9d 00 00 00    	je     ac0 <printf+0x1a0>
+        while(*s != 0){
+ a23:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a26:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a28:	84 c0                	test   %al,%al
+ a2a:	0f 84 3d ff ff ff    	je     96d <printf+0x4d>
+ a30:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a33:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a36:	89 de                	mov    %ebx,%esi
+ a38:	89 d3                	mov    %edx,%ebx
+ a3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a40:	83 ec 04             	sub    $0x4,%esp
+ a43:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a46:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a49:	6a 01                	push   $0x1
+ a4b:	53                   	push   %ebx
+ a4c:	57                   	push   %edi
+ a4d:	e8 76 fc ff ff       	call   6c8 <write>
+        while(*s != 0){
+ a52:	0f b6 06             	movzbl (%esi),%eax
+ a55:	83 c4 10             	add    $0x10,%esp
+ a58:	84 c0                	test   %al,%al
+ a5a:	75 e4                	jne    a40 <printf+0x120>
+      state = 0;
+ a5c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ a5f:	31 d2                	xor    %edx,%edx
+ a61:	e9 07 ff ff ff       	jmp    96d <printf+0x4d>
+ a66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a6d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a70:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a73:	83 ec 0c             	sub    $0xc,%esp
+ a76:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a7b:	8b 13                	mov    (%ebx),%edx
+ a7d:	6a 01                	push   $0x1
+ a7f:	e9 6b ff ff ff       	jmp    9ef <printf+0xcf>
+ a84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a88:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a8b:	83 ec 04             	sub    $0x4,%esp
+ a8e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a91:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a93:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a96:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a99:	6a 01                	push   $0x1
+ a9b:	52                   	push   %edx
+ a9c:	57                   	push   %edi
+ a9d:	e8 26 fc ff ff       	call   6c8 <write>
+        ap++;
+ aa2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ aa5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ aa8:	31 d2                	xor    %edx,%edx
+ aaa:	e9 be fe ff ff       	jmp    96d <printf+0x4d>
+ aaf:	90                   	nop
+  write(fd, &c, 1);
+ ab0:	83 ec 04             	sub    $0x4,%esp
+ ab3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ ab6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ab9:	6a 01                	push   $0x1
+ abb:	e9 11 ff ff ff       	jmp    9d1 <printf+0xb1>
+ ac0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ ac5:	bb 14 0d 00 00       	mov    $0xd14,%ebx
+ aca:	e9 61 ff ff ff       	jmp    a30 <printf+0x110>
+ acf:	90                   	nop
+
+00000ad0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ ad0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ad1:	a1 dc 11 00 00       	mov    0x11dc,%eax
+{
+ ad6:	89 e5                	mov    %esp,%ebp
+ ad8:	57                   	push   %edi
+ ad9:	56                   	push   %esi
+ ada:	53                   	push   %ebx
+ adb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ ade:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ae1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ae8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ aea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ aec:	39 ca                	cmp    %ecx,%edx
+ aee:	73 30                	jae    b20 <free+0x50>
+ af0:	39 c1                	cmp    %eax,%ecx
+ af2:	72 04                	jb     af8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ af4:	39 c2                	cmp    %eax,%edx
+ af6:	72 f0                	jb     ae8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ af8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ afb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ afe:	39 f8                	cmp    %edi,%eax
+ b00:	74 2e                	je     b30 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b02:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ b05:	8b 42 04             	mov    0x4(%edx),%eax
+ b08:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b0b:	39 f1                	cmp    %esi,%ecx
+ b0d:	74 38                	je     b47 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b0f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b11:	5b                   	pop    %ebx
+  freep = p;
+ b12:	89 15 dc 11 00 00    	mov    %edx,0x11dc
+}
+ b18:	5e                   	pop    %esi
+ b19:	5f                   	pop    %edi
+ b1a:	5d                   	pop    %ebp
+ b1b:	c3                   	ret
+ b1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b20:	39 c1                	cmp    %eax,%ecx
+ b22:	72 d0                	jb     af4 <free+0x24>
+ b24:	eb c2                	jmp    ae8 <free+0x18>
+ b26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b2d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ b30:	03 70 04             	add    0x4(%eax),%esi
+ b33:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b36:	8b 02                	mov    (%edx),%eax
+ b38:	8b 00                	mov    (%eax),%eax
+ b3a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ b3d:	8b 42 04             	mov    0x4(%edx),%eax
+ b40:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b43:	39 f1                	cmp    %esi,%ecx
+ b45:	75 c8                	jne    b0f <free+0x3f>
+    p->s.size += bp->s.size;
+ b47:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ b4a:	89 15 dc 11 00 00    	mov    %edx,0x11dc
+    p->s.size += bp->s.size;
+ b50:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ b53:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ b56:	89 0a                	mov    %ecx,(%edx)
+}
+ b58:	5b                   	pop    %ebx
+ b59:	5e                   	pop    %esi
+ b5a:	5f                   	pop    %edi
+ b5b:	5d                   	pop    %ebp
+ b5c:	c3                   	ret
+ b5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b60 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ b60:	55                   	push   %ebp
+ b61:	89 e5                	mov    %esp,%ebp
+ b63:	57                   	push   %edi
+ b64:	56                   	push   %esi
+ b65:	53                   	push   %ebx
+ b66:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b69:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ b6c:	8b 15 dc 11 00 00    	mov    0x11dc,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b72:	8d 78 07             	lea    0x7(%eax),%edi
+ b75:	c1 ef 03             	shr    $0x3,%edi
+ b78:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ b7b:	85 d2                	test   %edx,%edx
+ b7d:	0f 84 8d 00 00 00    	je     c10 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b83:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b85:	8b 48 04             	mov    0x4(%eax),%ecx
+ b88:	39 f9                	cmp    %edi,%ecx
+ b8a:	73 64                	jae    bf0 <malloc+0x90>
+  if(nu < 4096)
+ b8c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b91:	39 df                	cmp    %ebx,%edi
+ b93:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b96:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b9d:	eb 0a                	jmp    ba9 <malloc+0x49>
+ b9f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ba0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ba2:	8b 48 04             	mov    0x4(%eax),%ecx
+ ba5:	39 f9                	cmp    %edi,%ecx
+ ba7:	73 47                	jae    bf0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ ba9:	89 c2                	mov    %eax,%edx
+ bab:	39 05 dc 11 00 00    	cmp    %eax,0x11dc
+ bb1:	75 ed                	jne    ba0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ bb3:	83 ec 0c             	sub    $0xc,%esp
+ bb6:	56                   	push   %esi
+ bb7:	e8 9b fb ff ff       	call   757 <sbrk>
+  if(p == (char*)-1)
+ bbc:	83 c4 10             	add    $0x10,%esp
+ bbf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ bc2:	74 1c                	je     be0 <malloc+0x80>
+  hp->s.size = nu;
+ bc4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ bc7:	83 ec 0c             	sub    $0xc,%esp
+ bca:	83 c0 08             	add    $0x8,%eax
+ bcd:	50                   	push   %eax
+ bce:	e8 fd fe ff ff       	call   ad0 <free>
+  return freep;
+ bd3:	8b 15 dc 11 00 00    	mov    0x11dc,%edx
+      if((p = morecore(nunits)) == 0)
+ bd9:	83 c4 10             	add    $0x10,%esp
+ bdc:	85 d2                	test   %edx,%edx
+ bde:	75 c0                	jne    ba0 <malloc+0x40>
+        return 0;
+  }
+}
+ be0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ be3:	31 c0                	xor    %eax,%eax
+}
+ be5:	5b                   	pop    %ebx
+ be6:	5e                   	pop    %esi
+ be7:	5f                   	pop    %edi
+ be8:	5d                   	pop    %ebp
+ be9:	c3                   	ret
+ bea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ bf0:	39 cf                	cmp    %ecx,%edi
+ bf2:	74 4c                	je     c40 <malloc+0xe0>
+        p->s.size -= nunits;
+ bf4:	29 f9                	sub    %edi,%ecx
+ bf6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ bf9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ bfc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ bff:	89 15 dc 11 00 00    	mov    %edx,0x11dc
+}
+ c05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ c08:	83 c0 08             	add    $0x8,%eax
+}
+ c0b:	5b                   	pop    %ebx
+ c0c:	5e                   	pop    %esi
+ c0d:	5f                   	pop    %edi
+ c0e:	5d                   	pop    %ebp
+ c0f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ c10:	c7 05 dc 11 00 00 e0 	movl   $0x11e0,0x11dc
+ c17:	11 00 00 
+    base.s.size = 0;
+ c1a:	b8 e0 11 00 00       	mov    $0x11e0,%eax
+    base.s.ptr = freep = prevp = &base;
+ c1f:	c7 05 e0 11 00 00 e0 	movl   $0x11e0,0x11e0
+ c26:	11 00 00 
+    base.s.size = 0;
+ c29:	c7 05 e4 11 00 00 00 	movl   $0x0,0x11e4
+ c30:	00 00 00 
+    if(p->s.size >= nunits){
+ c33:	e9 54 ff ff ff       	jmp    b8c <malloc+0x2c>
+ c38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c3f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ c40:	8b 08                	mov    (%eax),%ecx
+ c42:	89 0a                	mov    %ecx,(%edx)
+ c44:	eb b9                	jmp    bff <malloc+0x9f>
@@ -0,0 +1,88 @@
+// Test sleep() and usleep() on the timer wheel.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define NORDER  8
+#define NIDLE  32
+
+void
+fail(char *msg)
+{
+  printf(1, "timertest: %s\n", msg);
+  exit();
+}
+
+// Children with shorter sleeps must wake first.
+void
+order(void)
+{
+  int fds[2], i;
+  char c;
+
+  if(pipe(fds) < 0)
+    fail("pipe");
+  for(i = 0; i < NORDER; i++){
+    if(fork() == 0){
+      close(fds[0]);
+      usleep((NORDER - i) * 5000);
+      c = i;
+      write(fds[1], &c, 1);
+      exit();
+    }
+  }
+  close(fds[1]);
+  for(i = NORDER-1; i >= 0; i--){
+    if(read(fds[0], &c, 1) != 1)
+      fail("short read");
+    if(c != i)
+      fail("sleepers woke out of order");
+  }
+  close(fds[0]);
+  for(i = 0; i < NORDER; i++)
+    wait();
+}
+
+// Many long sleepers must not slow down short sleeps.
+void
+accuracy(void)
+{
+  int pids[NIDLE], i, t;
+
+  for(i = 0; i < NIDLE; i++){
+    if((pids[i] = fork()) == 0){
+      sleep(100000);
+      exit();
+    }
+  }
+  t = uptime();
+  for(i = 0; i < 200; i++)
+    usleep(1000);
+  t = uptime() - t;
+  printf(1, "timertest: 200 x usleep(1000) took %d ticks\n", t);
+  if(t < 19)
+    fail("usleep returned early");
+  for(i = 0; i < NIDLE; i++){
+    kill(pids[i]);
+    wait();
+  }
+}
+
+int
+main(void)
+{
+  int t;
+
+  t = uptime();
+  sleep(10);
+  if(uptime() - t < 10)
+    fail("sleep(10) returned early");
+  if(usleep(100) < 0)
+    fail("usleep(100)");
+
+  order();
+  accuracy();
+  printf(1, "timertest ok\n");
+  exit();
+}
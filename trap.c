@@ -3,10 +3,10 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 #include "traps.h"
-#include "spinlock.h"
 
 // Interrupt descriptor table (shared by all CPUs).
 struct gatedesc idt[256];
@@ -14,26 +14,17 @@ extern uint vectors[];  // in vectors.S: array of 256 entry pointers
 struct spinlock tickslock;
 uint ticks;
 
-extern struct page pages[];
-
-// Function prototypes for functions used in trap.c
-pte_t *walkpgdir(pde_t *pgdir, const void *va, int alloc);
-char *kalloc(void);
-void swapread(char *ptr, int blkno);
-int SET_in(pte_t *pte);
-void add_to_lru_list(struct page *new_page);
-void reclaim(void);
-void swap_in_page(struct page *page);
-
-
 void
 tvinit(void)
 {
+  extern void debugentry(void);
   int i;
 
   for(i = 0; i < 256; i++)
     SETGATE(idt[i], 0, SEG_KCODE<<3, vectors[i], 0);
   SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+  // Catches traps at sysentry; see trapasm.S.
+  SETGATE(idt[T_DEBUG], 0, SEG_KCODE<<3, debugentry, 0);
 
   initlock(&tickslock, "time");
 }
@@ -60,43 +51,13 @@ trap(struct trapframe *tf)
 
   switch(tf->trapno){
   case T_IRQ0 + IRQ_TIMER:
-    if(cpuid() == 0){
-      acquire(&tickslock);
-      ticks++;
-      wakeup(&ticks);
-      release(&tickslock);
-    }
+    // One-shot: catch up on time, then arm for the next event.
+    mycpu()->ntimer++;
+    timerupdate();
+    timerarm();
     lapiceoi();
     break;
   
-  case T_PGFLT: { //  Ʈ Ʈ ȣ
-    uint addr = rcr2(); //   ּҸ cr2 Ϳ 
-    struct proc *p = myproc(); //    μ 
-    
-    pte_t *pte = walkpgdir(p->pgdir, (void*)addr, 0); //  丮  ּҿ شϴ PTE 
-    if (!pte) { // PTE ã   
-      panic("trap: PTE not found"); // д ߻
-    }
-
-    if (*pte & PTE_P) { // PTE_P Ʈ   (̹  ޸𸮿 ִ )
-      panic("trap: Page fault but PTE_P is set"); // д ߻
-    }
-
-    if (*pte & PTE_SWAP) { // PTE_SWAP Ʈ   ( ƿ  )
-      //swapin ڵ!
-      struct page *page = &pages[V2P((char*)addr) / PGSIZE];
-      swap_in_page(page); // swap_in_page Լ ȣ
-
-      //swapin ڵ
-      } else {
-      panic("trap: Unexpected page fault"); // ġ   Ʈ  д ߻
-    }
-    break;
-  }
-
-
-
-
   case T_IRQ0 + IRQ_IDE:
     ideintr();
     lapiceoi();
@@ -112,6 +73,17 @@ trap(struct trapframe *tf)
     uartintr();
     lapiceoi();
     break;
+  case T_IRQ0 + IRQ_RESCHED:
+    // Wakes the CPU out of hlt (see idle()), or asks it
+    // to rearm its timer for a new kernel timer.
+    mycpu()->nipi++;
+    timerarm();
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_TLB:
+    tlbpoll();
+    lapiceoi();
+    break;
   case T_IRQ0 + 7:
   case T_IRQ0 + IRQ_SPURIOUS:
     cprintf("cpu%d: spurious interrupt at %x:%x\n",
@@ -119,8 +91,24 @@ trap(struct trapframe *tf)
     lapiceoi();
     break;
 
+  case T_DEVICE:
+    // First FPU or SSE instruction since being switched in.
+    if(myproc() && (tf->cs&3) == DPL_USER && fputrap() == 0)
+      break;
+    goto bad;
+
+  case T_PGFLT:
+    // A swapped-out user page; anything else is a real fault.
+    // Bringing it in sleeps, which the kernel must not do while
+    // holding a spinlock: it should have pinned the page first.
+    if(myproc() && ((tf->cs&3) == DPL_USER || mycpu()->ncli == 0) &&
+       swap_fault(myproc()->pgdir, rcr2()) == 0)
+      break;
+    // fall through
+
   //PAGEBREAK: 13
   default:
+  bad:
     if(myproc() == 0 || (tf->cs&3) == 0){
       // In kernel, it must be our mistake.
       cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
@@ -141,10 +129,11 @@ trap(struct trapframe *tf)
   if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
     exit();
 
-  // Force process to give up CPU on clock tick.
+  // Force process to give up CPU when its quantum is used up
+  // or a higher-priority process is waiting (see schedtick).
   // If interrupts were on while locks held, would need to check nlock.
   if(myproc() && myproc()->state == RUNNING &&
-     tf->trapno == T_IRQ0+IRQ_TIMER)
+     tf->trapno == T_IRQ0+IRQ_TIMER && schedtick())
     yield();
 
   // Check if the process has been killed since we yielded
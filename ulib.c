@@ -3,6 +3,7 @@
 #include "fcntl.h"
 #include "user.h"
 #include "x86.h"
+#include "info.h"
 
 char*
 strcpy(char *s, const char *t)
@@ -104,3 +105,96 @@ memmove(void *vdst, const void *vsrc, int n)
     *dst++ = *src++;
   return vdst;
 }
+
+// getpid() and uptime() read the kernel's info pages rather
+// than make a system call; see info.h.
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+    return pid;
+  return sysgetpid();
+}
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+}
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+         n > 0 ? udiv64(t, n) : 0);
+}
+
+// Mutex on a futex, after Drepper's "Futexes Are Tricky":
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+  m->v = 0;
+}
+
+void
+mutex_lock(struct mutex *m)
+{
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+    return;
+  if(c != 2)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+    futex_wait(&m->v, 2);
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+
+void
+mutex_unlock(struct mutex *m)
+{
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  int seq;
+
+  seq = c->seq;
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+  mutex_lock(m);
+}
+
+void
+cond_signal(struct cond *c)
+{
+  __sync_fetch_and_add(&c->seq, 1);
+  futex_wake(&c->seq, 1);
+}
+
+void
+cond_broadcast(struct cond *c)
+{
+  __sync_fetch_and_add(&c->seq, 1);
+  futex_wake(&c->seq, 0x7fffffff);
+}
@@ -1,5 +1,18 @@
 struct stat;
 struct rtcdate;
+struct bcachestat;
+struct cpustat;
+struct ioring;
+struct lockprof;
+struct lockstat;
+
+// ulib.c locks; see mutex_lock() and cond_wait().
+struct mutex {
+  volatile int v;
+};
+struct cond {
+  volatile int seq;
+};
 
 // system calls
 int fork(void);
@@ -19,13 +32,33 @@ int link(const char*, const char*);
 int mkdir(const char*);
 int chdir(const char*);
 int dup(int);
-int getpid(void);
+int sysgetpid(void);
 char* sbrk(int);
 int sleep(int);
-int uptime(void);
+int sysuptime(void);
 void swapread(const char*, int);
 void swapwrite(const char*, int);
 void swapstat(int*, int*);
+int madvise(void*, uint, int);
+int mlock(void*, uint);
+int munlock(void*, uint);
+int membench(void);
+int nice(int);
+int setpriority(int, int);
+int usleep(uint);
+int cpustat(struct cpustat*, int);
+int clone(void(*)(void*, void*), void*, void*, void*);
+int join(void**);
+int futex_wait(volatile int*, int);
+int futex_wake(volatile int*, int);
+int sched_setaffinity(int, uint);
+int sched_getaffinity(int);
+int getcpu(void);
+int migrations(int);
+int ioring_enter(struct ioring*);
+int lockstat(struct lockstat*, int);
+int lockprof(int, struct lockprof*, int);
+int bcachestat(struct bcachestat*);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -40,3 +73,13 @@ void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
 int atoi(const char*);
+int getpid(void);
+int uptime(void);
+void cyclereport(char*, char*, uint64, int);
+void mutex_init(struct mutex*);
+void mutex_lock(struct mutex*);
+void mutex_unlock(struct mutex*);
+void cond_init(struct cond*);
+void cond_wait(struct cond*, struct mutex*);
+void cond_signal(struct cond*);
+void cond_broadcast(struct cond*);
@@ -4,8 +4,11 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "elf.h"
+#include "traps.h"
+#include "info.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
@@ -15,18 +18,44 @@ pde_t *kpgdir;  // for use in scheduler()
 void
 seginit(void)
 {
+  extern void sysentry(void);
   struct cpu *c;
+  uint edx;
 
   // Map "logical" addresses to virtual addresses using identity map.
   // Cannot share a CODE descriptor for both kernel and user
   // because it would have to have DPL_USR, but the CPU forbids
   // an interrupt from CPL=0 to DPL=3.
-  c = &cpus[cpuid()];
+  // mycpu() does not work until %gs is loaded, so look
+  // this CPU up by its APIC ID.
+  for(c = cpus; c < cpus+ncpu && c->apicid != lapicid(); c++)
+    ;
+  if(c == cpus+ncpu)
+    panic("seginit: unknown apicid");
   c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
   c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
   c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
   c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+
+  // Per-CPU data segment: %gs:0 is c->self, so that mycpu()
+  // and myproc() are a single load.  trapasm.S reloads %gs
+  // on every entry from user space.
+  c->self = c;
+  c->gdt[SEG_KCPU] = SEG(STA_W, c, sizeof(*c) - 1, 0);
   lgdt(c->gdt, sizeof(c->gdt));
+  loadgs(SEG_KCPU << 3);
+
+  // Fast system calls; see sysentry in trapasm.S.  sysenter
+  // takes %ss from the segment after SEG_KCODE, and sysexit
+  // %cs and %ss from the two after that: SEG_KDATA, SEG_UCODE
+  // and SEG_UDATA.  %esp starts at c->ts.esp0, which holds
+  // the top of the running process's kernel stack.
+  getcpuid(1, 0, 0, 0, &edx);
+  if(edx & CPUID_SEP){
+    wrmsr(MSR_SYSENTER_CS, SEG_KCODE << 3);
+    wrmsr(MSR_SYSENTER_ESP, (uint)&c->ts.esp0);
+    wrmsr(MSR_SYSENTER_EIP, (uint)sysentry);
+  }
 }
 
 // Return the address of the PTE in page table pgdir
@@ -174,6 +203,53 @@ switchuvm(struct proc *p)
   popcli();
 }
 
+// Make the other CPUs running in pgdir flush their TLBs, after
+// some of its pages have been unmapped, and wait until they have.
+// Threads share a pgdir, so this can be any number of CPUs.
+// The caller must hold no spinlocks: a CPU waiting with interrupts
+// off for one of them might never take the IPI.  (acquire() does
+// poll for it, with tlbpoll(), but other busy-waits don't.)  So
+// unmap under the lock, and shoot down after releasing it.
+// A CPU that loads pgdir after the check below does not need
+// a flush, since loading %cr3 flushes the TLB.
+void
+tlbshootdown(pde_t *pgdir)
+{
+  struct cpu *c, *self;
+  struct proc *p;
+
+  pushcli();
+  if(mycpu()->ncli != 1)
+    panic("tlbshootdown locks");
+  self = mycpu();
+  __sync_synchronize();
+  for(c = cpus; c < cpus+ncpu; c++){
+    p = c->proc;
+    if(c == self || p == 0 || p->pgdir != pgdir)
+      continue;
+    c->tlbflush = 1;
+    lapicipi(c->apicid, T_IRQ0 + IRQ_TLB);
+  }
+  for(c = cpus; c < cpus+ncpu; c++)
+    while(c->tlbflush)
+      tlbpoll();
+  popcli();
+}
+
+// Flush this CPU's TLB if tlbshootdown() asked it to.
+// Interrupts must be off.
+void
+tlbpoll(void)
+{
+  struct cpu *c;
+
+  c = mycpu();
+  if(c->tlbflush){
+    lcr3(rcr3());
+    c->tlbflush = 0;
+  }
+}
+
 // Load the initcode into address 0 of pgdir.
 // sz must be less than a page.
 void
@@ -221,7 +297,7 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
   char *mem;
   uint a;
 
-  if(newsz >= KERNBASE)
+  if(newsz > SYSINFO)
     return 0;
   if(newsz < oldsz)
     return oldsz;
@@ -234,44 +310,74 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
       deallocuvm(pgdir, newsz, oldsz);
       return 0;
     }
-    memset(mem, 0, PGSIZE);
+    clear_page(mem);
     if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
       cprintf("allocuvm out of memory (2)\n");
       deallocuvm(pgdir, newsz, oldsz);
       kfree(mem);
       return 0;
     }
+    // Pages of an image that is still being built (exec) are
+    // written through kernel pointers, so they only become
+    // reclaimable once exec() commits; see lru_addvm().
+    if(myproc() && pgdir == myproc()->pgdir)
+      lru_add(pgdir, (char*)a, mem);
   }
   return newsz;
 }
 
+#define NDEALLOC 32
+
+// Free the n pages in v, just unmapped from pgdir, once every
+// TLB that may still map them has been flushed.
+static void
+freebatch(pde_t *pgdir, char **v, int n)
+{
+  int i;
+
+  if(n == 0)
+    return;
+  tlbshootdown(pgdir);
+  pushcli();
+  if(rcr3() == V2P(pgdir))
+    lcr3(V2P(pgdir));
+  popcli();
+  for(i = 0; i < n; i++)
+    kfree(v[i]);
+}
+
 // Deallocate user pages to bring the process size from oldsz to
 // newsz.  oldsz and newsz need not be page-aligned, nor does newsz
 // need to be less than oldsz.  oldsz can be larger than the actual
 // process size.  Returns the new process size.
+//
+// Other threads may be running in pgdir, so pages are unmapped
+// a batch at a time, and only freed once no TLB can reach them.
 int
 deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 {
   pte_t *pte;
-  uint a, pa;
+  uint a;
+  char *v[NDEALLOC];
+  int n;
 
   if(newsz >= oldsz)
     return oldsz;
 
+  n = 0;
   a = PGROUNDUP(newsz);
   for(; a  < oldsz; a += PGSIZE){
     pte = walkpgdir(pgdir, (char*)a, 0);
     if(!pte)
       a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
-    else if((*pte & PTE_P) != 0){
-      pa = PTE_ADDR(*pte);
-      if(pa == 0)
-        panic("kfree");
-      char *v = P2V(pa);
-      kfree(v);
-      *pte = 0;
+    else if(*pte & (PTE_P|PTE_SWAP)){
+      if((v[n] = unmap_user_page(pte)) != 0 && ++n == NDEALLOC){
+        freebatch(pgdir, v, n);
+        n = 0;
+      }
     }
   }
+  freebatch(pgdir, v, n);
   return newsz;
 }
 
@@ -281,9 +387,13 @@ void
 freevm(pde_t *pgdir)
 {
   uint i;
+  pte_t *pte;
 
   if(pgdir == 0)
     panic("freevm: no pgdir");
+  // The system info page is shared; the procinfo page is ours.
+  if((pte = walkpgdir(pgdir, (char*)SYSINFO, 0)) != 0)
+    *pte = 0;
   deallocuvm(pgdir, KERNBASE, 0);
   for(i = 0; i < NPDENTRIES; i++){
     if(pgdir[i] & PTE_P){
@@ -294,6 +404,38 @@ freevm(pde_t *pgdir)
   kfree((char*)pgdir);
 }
 
+// Map the info pages into pgdir, read-only, with pid in its
+// procinfo.  Returns -1 if out of memory; freevm() then frees
+// whatever was mapped.
+int
+mapinfo(pde_t *pgdir, int pid)
+{
+  struct procinfo *pi;
+
+  if(mappages(pgdir, (char*)SYSINFO, PGSIZE, V2P(sysinfo), PTE_U) < 0)
+    return -1;
+  if((pi = (struct procinfo*)kalloc()) == 0)
+    return -1;
+  memset(pi, 0, PGSIZE);
+  pi->pid = pid;
+  if(mappages(pgdir, (char*)PROCINFO, PGSIZE, V2P(pi), PTE_U) < 0){
+    kfree((char*)pi);
+    return -1;
+  }
+  return 0;
+}
+
+// Set the pid getpid() finds in pgdir's procinfo page.
+void
+setinfopid(pde_t *pgdir, int pid)
+{
+  pte_t *pte;
+
+  if((pte = walkpgdir(pgdir, (char*)PROCINFO, 0)) == 0 || !(*pte & PTE_P))
+    panic("setinfopid");
+  ((struct procinfo*)P2V(PTE_ADDR(*pte)))->pid = pid;
+}
+
 // Clear PTE_U on a page. Used to create an inaccessible
 // page beneath the user stack.
 void
@@ -309,65 +451,35 @@ clearpteu(pde_t *pgdir, char *uva)
 
 // Given a parent process's page table, create a copy
 // of it for a child.
-
-
-
-void swap_in_page(struct page *page);
-// copyuvm
-
 pde_t*
 copyuvm(pde_t *pgdir, uint sz)
 {
-  pde_t *d; //   丮 
-  pte_t *pte; //  ̺ Ʈ 
-  uint pa, i, flags; //  ּ, ε, ÷ 
-  char *mem; // ο  ޸  
-
-  if((d = setupkvm()) == 0) // ο Ŀ  ̺ 
-    return 0; //   0 ȯ
-  
-  for(i = 0; i < sz; i += PGSIZE){ //  ޸ ũ⸸ŭ   ݺ
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0) //  ̺ Ʈ 
-      panic("copyuvm: pte should exist"); // PTE   д
-
-    if(*pte & PTE_SWAP) { //  ҵ 
-      struct page temp_page;
-      temp_page.pgdir = pgdir;
-      temp_page.vaddr = (char *)i;
-
-      swap_in_page(&temp_page); //  ٽ ޸𸮷 ε
-      pte = walkpgdir(pgdir, (void *) i, 0); // ٽ PTE 
-
-      if(!pte || !(*pte & PTE_P)) //    ʴ 
-        panic("copyuvm: failed to swap in"); // д
-    }
-
-    if(!(*pte & PTE_P)) //   ʴ 
-      panic("copyuvm: page not present"); // д
-
-    pa = PTE_ADDR(*pte); //  ּ 
-    flags = PTE_FLAGS(*pte); // PTE ÷ 
-
-    if((mem = kalloc()) == 0) // ο  ޸  Ҵ
-      goto bad; //   bad ̵
-
-    memmove(mem, (char*)P2V(pa), PGSIZE); // Ҵ  ޸ 
+  pde_t *d;
+  uint i, flags;
+  char *mem;
 
-    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0) { //   丮 
-      kfree(mem); //   Ҵ ޸ 
-      goto bad; // bad ̵
+  if((d = setupkvm()) == 0)
+    return 0;
+  for(i = 0; i < sz; i += PGSIZE){
+    if((mem = kalloc()) == 0)
+      goto bad;
+    // kalloc() may have swapped the parent's page out,
+    // so look at its PTE only now.
+    flags = copy_user_page(pgdir, (char*)i, mem);
+    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0) {
+      kfree(mem);
+      goto bad;
     }
+    if(flags & PTE_U)
+      lru_add(d, (char*)i, mem);
   }
-  return d; //   ο  丮 ȯ
+  return d;
 
 bad:
-  freevm(d); //   Ҵ  丮 
-  return 0; // 0 ȯ
+  freevm(d);
+  return 0;
 }
 
-
-
-
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char*
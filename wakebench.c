@@ -0,0 +1,65 @@
+// Timer wakeup latency and timer interrupt load.
+// Times usleep() of several lengths against the TSC, and
+// counts the timer interrupts each CPU takes while the
+// system sits idle for a second.
+// usage: wakebench [iterations]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "x86.h"
+#include "param.h"
+#include "cpustat.h"
+
+struct cpustat st0[NCPU], st1[NCPU];
+uint lens[] = { 1000, 2000, 5000, 10000, 20000 };
+
+int
+main(int argc, char *argv[])
+{
+  uint t, perus, want, sum, max, late;
+  int i, j, n, iters;
+
+  iters = 20;
+  if(argc > 1)
+    iters = atoi(argv[1]);
+  if(iters < 1)
+    iters = 1;
+
+  // Calibrate the TSC over 200 ms, starting on a tick.
+  t = uptime();
+  while(uptime() == t)
+    ;
+  t = rdtsc();
+  sleep(20);
+  perus = ((uint)rdtsc() - t) / 200000;
+  if(perus == 0)
+    perus = 1;
+
+  for(i = 0; i < sizeof(lens)/sizeof(lens[0]); i++){
+    sum = max = 0;
+    want = lens[i] * perus;
+    for(j = 0; j < iters; j++){
+      t = rdtsc();
+      usleep(lens[i]);
+      t = rdtsc() - t;
+      late = t > want ? (t - want) / perus : 0;
+      sum += late;
+      if(late > max)
+        max = late;
+    }
+    printf(1, "usleep(%d): late by mean %d us, max %d us\n",
+           lens[i], sum / iters, max);
+  }
+
+  if((n = cpustat(st0, NCPU)) < 0){
+    printf(2, "wakebench: cpustat failed\n");
+    exit();
+  }
+  sleep(100);
+  cpustat(st1, NCPU);
+  for(i = 0; i < n; i++)
+    printf(1, "cpu%d: %d timer irqs in 1s idle\n",
+           i, st1[i].ntimer - st0[i].ntimer);
+  exit();
+}
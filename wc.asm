@@ -0,0 +1,1702 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 28                	jg     51 <main+0x51>
+  29:	eb 54                	jmp    7f <main+0x7f>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit();
+    }
+    wc(fd, argv[i]);
+  30:	83 ec 08             	sub    $0x8,%esp
+  33:	ff 33                	push   (%ebx)
+  for(i = 1; i < argc; i++){
+  35:	83 c6 01             	add    $0x1,%esi
+  38:	83 c3 04             	add    $0x4,%ebx
+    wc(fd, argv[i]);
+  3b:	50                   	push   %eax
+  3c:	e8 5f 00 00 00       	call   a0 <wc>
+    close(fd);
+  41:	89 3c 24             	mov    %edi,(%esp)
+  44:	e8 8a 05 00 00       	call   5d3 <close>
+  for(i = 1; i < argc; i++){
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4f:	74 29                	je     7a <main+0x7a>
+    if((fd = open(argv[i], 0)) < 0){
+  51:	83 ec 08             	sub    $0x8,%esp
+  54:	6a 00                	push   $0x0
+  56:	ff 33                	push   (%ebx)
+  58:	e8 97 05 00 00       	call   5f4 <open>
+  5d:	83 c4 10             	add    $0x10,%esp
+  60:	89 c7                	mov    %eax,%edi
+  62:	85 c0                	test   %eax,%eax
+  64:	79 ca                	jns    30 <main+0x30>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+  66:	50                   	push   %eax
+  67:	ff 33                	push   (%ebx)
+  69:	68 6b 0b 00 00       	push   $0xb6b
+  6e:	6a 01                	push   $0x1
+  70:	e8 ab 07 00 00       	call   820 <printf>
+      exit();
+  75:	e8 22 05 00 00       	call   59c <exit>
+  }
+  exit();
+  7a:	e8 1d 05 00 00       	call   59c <exit>
+    wc(0, "");
+  7f:	52                   	push   %edx
+  80:	52                   	push   %edx
+  81:	68 99 0b 00 00       	push   $0xb99
+  86:	6a 00                	push   $0x0
+  88:	e8 13 00 00 00       	call   a0 <wc>
+    exit();
+  8d:	e8 0a 05 00 00       	call   59c <exit>
+  92:	66 90                	xchg   %ax,%ax
+  94:	66 90                	xchg   %ax,%ax
+  96:	66 90                	xchg   %ax,%ax
+  98:	66 90                	xchg   %ax,%ax
+  9a:	66 90                	xchg   %ax,%ax
+  9c:	66 90                	xchg   %ax,%ax
+  9e:	66 90                	xchg   %ax,%ax
+
+000000a0 <wc>:
+{
+  a0:	55                   	push   %ebp
+  l = w = c = 0;
+  a1:	31 d2                	xor    %edx,%edx
+{
+  a3:	89 e5                	mov    %esp,%ebp
+  a5:	57                   	push   %edi
+  a6:	56                   	push   %esi
+  inword = 0;
+  a7:	31 f6                	xor    %esi,%esi
+{
+  a9:	53                   	push   %ebx
+  l = w = c = 0;
+  aa:	31 db                	xor    %ebx,%ebx
+{
+  ac:	83 ec 1c             	sub    $0x1c,%esp
+  l = w = c = 0;
+  af:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  b6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  c0:	83 ec 04             	sub    $0x4,%esp
+  c3:	68 00 02 00 00       	push   $0x200
+  c8:	68 40 10 00 00       	push   $0x1040
+  cd:	ff 75 08             	push   0x8(%ebp)
+  d0:	e8 e8 04 00 00       	call   5bd <read>
+  d5:	83 c4 10             	add    $0x10,%esp
+  d8:	89 c1                	mov    %eax,%ecx
+  da:	85 c0                	test   %eax,%eax
+  dc:	7e 62                	jle    140 <wc+0xa0>
+    for(i=0; i<n; i++){
+  de:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  e1:	31 ff                	xor    %edi,%edi
+  e3:	eb 0d                	jmp    f2 <wc+0x52>
+  e5:	8d 76 00             	lea    0x0(%esi),%esi
+        inword = 0;
+  e8:	31 f6                	xor    %esi,%esi
+    for(i=0; i<n; i++){
+  ea:	83 c7 01             	add    $0x1,%edi
+  ed:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  f0:	74 3e                	je     130 <wc+0x90>
+      if(buf[i] == '\n')
+  f2:	0f be 87 40 10 00 00 	movsbl 0x1040(%edi),%eax
+        l++;
+  f9:	31 c9                	xor    %ecx,%ecx
+  fb:	3c 0a                	cmp    $0xa,%al
+  fd:	0f 94 c1             	sete   %cl
+      if(strchr(" \r\t\n\v", buf[i]))
+ 100:	83 ec 08             	sub    $0x8,%esp
+ 103:	50                   	push   %eax
+        l++;
+ 104:	01 cb                	add    %ecx,%ebx
+      if(strchr(" \r\t\n\v", buf[i]))
+ 106:	68 48 0b 00 00       	push   $0xb48
+ 10b:	e8 50 01 00 00       	call   260 <strchr>
+ 110:	83 c4 10             	add    $0x10,%esp
+ 113:	85 c0                	test   %eax,%eax
+ 115:	75 d1                	jne    e8 <wc+0x48>
+      else if(!inword){
+ 117:	85 f6                	test   %esi,%esi
+ 119:	75 cf                	jne    ea <wc+0x4a>
+        w++;
+ 11b:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+        inword = 1;
+ 11f:	be 01 00 00 00       	mov    $0x1,%esi
+    for(i=0; i<n; i++){
+ 124:	83 c7 01             	add    $0x1,%edi
+ 127:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 12a:	75 c6                	jne    f2 <wc+0x52>
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      c++;
+ 130:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 133:	01 4d dc             	add    %ecx,-0x24(%ebp)
+ 136:	eb 88                	jmp    c0 <wc+0x20>
+ 138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13f:	90                   	nop
+  if(n < 0){
+ 140:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 143:	75 22                	jne    167 <wc+0xc7>
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+ 145:	83 ec 08             	sub    $0x8,%esp
+ 148:	ff 75 0c             	push   0xc(%ebp)
+ 14b:	52                   	push   %edx
+ 14c:	ff 75 e0             	push   -0x20(%ebp)
+ 14f:	53                   	push   %ebx
+ 150:	68 5e 0b 00 00       	push   $0xb5e
+ 155:	6a 01                	push   $0x1
+ 157:	e8 c4 06 00 00       	call   820 <printf>
+}
+ 15c:	83 c4 20             	add    $0x20,%esp
+ 15f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 162:	5b                   	pop    %ebx
+ 163:	5e                   	pop    %esi
+ 164:	5f                   	pop    %edi
+ 165:	5d                   	pop    %ebp
+ 166:	c3                   	ret
+    printf(1, "wc: read error\n");
+ 167:	50                   	push   %eax
+ 168:	50                   	push   %eax
+ 169:	68 4e 0b 00 00       	push   $0xb4e
+ 16e:	6a 01                	push   $0x1
+ 170:	e8 ab 06 00 00       	call   820 <printf>
+    exit();
+ 175:	e8 22 04 00 00       	call   59c <exit>
+ 17a:	66 90                	xchg   %ax,%ax
+ 17c:	66 90                	xchg   %ax,%ax
+ 17e:	66 90                	xchg   %ax,%ax
+
+00000180 <strcpy>:
+#include "x86.h"
+#include "info.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 180:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 181:	31 c0                	xor    %eax,%eax
+{
+ 183:	89 e5                	mov    %esp,%ebp
+ 185:	53                   	push   %ebx
+ 186:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 189:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 18c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 190:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 194:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 197:	83 c0 01             	add    $0x1,%eax
+ 19a:	84 d2                	test   %dl,%dl
+ 19c:	75 f2                	jne    190 <strcpy+0x10>
+    ;
+  return os;
+}
+ 19e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1a1:	89 c8                	mov    %ecx,%eax
+ 1a3:	c9                   	leave
+ 1a4:	c3                   	ret
+ 1a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	53                   	push   %ebx
+ 1b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1ba:	0f b6 02             	movzbl (%edx),%eax
+ 1bd:	84 c0                	test   %al,%al
+ 1bf:	75 17                	jne    1d8 <strcmp+0x28>
+ 1c1:	eb 3a                	jmp    1fd <strcmp+0x4d>
+ 1c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1c7:	90                   	nop
+ 1c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1cc:	83 c2 01             	add    $0x1,%edx
+ 1cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1d2:	84 c0                	test   %al,%al
+ 1d4:	74 1a                	je     1f0 <strcmp+0x40>
+    p++, q++;
+ 1d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1d8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1db:	38 c3                	cmp    %al,%bl
+ 1dd:	74 e9                	je     1c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1df:	29 d8                	sub    %ebx,%eax
+}
+ 1e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1e4:	c9                   	leave
+ 1e5:	c3                   	ret
+ 1e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1f4:	31 c0                	xor    %eax,%eax
+ 1f6:	29 d8                	sub    %ebx,%eax
+}
+ 1f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1fb:	c9                   	leave
+ 1fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 200:	31 c0                	xor    %eax,%eax
+ 202:	eb db                	jmp    1df <strcmp+0x2f>
+ 204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 20f:	90                   	nop
+
+00000210 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 216:	80 3a 00             	cmpb   $0x0,(%edx)
+ 219:	74 15                	je     230 <strlen+0x20>
+ 21b:	31 c0                	xor    %eax,%eax
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+ 220:	83 c0 01             	add    $0x1,%eax
+ 223:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 227:	89 c1                	mov    %eax,%ecx
+ 229:	75 f5                	jne    220 <strlen+0x10>
+    ;
+  return n;
+}
+ 22b:	89 c8                	mov    %ecx,%eax
+ 22d:	5d                   	pop    %ebp
+ 22e:	c3                   	ret
+ 22f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 230:	31 c9                	xor    %ecx,%ecx
+}
+ 232:	5d                   	pop    %ebp
+ 233:	89 c8                	mov    %ecx,%eax
+ 235:	c3                   	ret
+ 236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000240 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 247:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 24a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 24d:	89 d7                	mov    %edx,%edi
+ 24f:	fc                   	cld
+ 250:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 252:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 255:	89 d0                	mov    %edx,%eax
+ 257:	c9                   	leave
+ 258:	c3                   	ret
+ 259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	8b 45 08             	mov    0x8(%ebp),%eax
+ 266:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 26a:	0f b6 10             	movzbl (%eax),%edx
+ 26d:	84 d2                	test   %dl,%dl
+ 26f:	75 12                	jne    283 <strchr+0x23>
+ 271:	eb 1d                	jmp    290 <strchr+0x30>
+ 273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 277:	90                   	nop
+ 278:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 27c:	83 c0 01             	add    $0x1,%eax
+ 27f:	84 d2                	test   %dl,%dl
+ 281:	74 0d                	je     290 <strchr+0x30>
+    if(*s == c)
+ 283:	38 d1                	cmp    %dl,%cl
+ 285:	75 f1                	jne    278 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 287:	5d                   	pop    %ebp
+ 288:	c3                   	ret
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 290:	31 c0                	xor    %eax,%eax
+}
+ 292:	5d                   	pop    %ebp
+ 293:	c3                   	ret
+ 294:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+
+000002a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	57                   	push   %edi
+ 2a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2a9:	31 db                	xor    %ebx,%ebx
+{
+ 2ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2ae:	eb 27                	jmp    2d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2b0:	83 ec 04             	sub    $0x4,%esp
+ 2b3:	6a 01                	push   $0x1
+ 2b5:	56                   	push   %esi
+ 2b6:	6a 00                	push   $0x0
+ 2b8:	e8 00 03 00 00       	call   5bd <read>
+    if(cc < 1)
+ 2bd:	83 c4 10             	add    $0x10,%esp
+ 2c0:	85 c0                	test   %eax,%eax
+ 2c2:	7e 1d                	jle    2e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2cf:	3c 0a                	cmp    $0xa,%al
+ 2d1:	74 10                	je     2e3 <gets+0x43>
+ 2d3:	3c 0d                	cmp    $0xd,%al
+ 2d5:	74 0c                	je     2e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2d7:	89 df                	mov    %ebx,%edi
+ 2d9:	83 c3 01             	add    $0x1,%ebx
+ 2dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2df:	7c cf                	jl     2b0 <gets+0x10>
+ 2e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2ed:	5b                   	pop    %ebx
+ 2ee:	5e                   	pop    %esi
+ 2ef:	5f                   	pop    %edi
+ 2f0:	5d                   	pop    %ebp
+ 2f1:	c3                   	ret
+ 2f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	56                   	push   %esi
+ 304:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 305:	83 ec 08             	sub    $0x8,%esp
+ 308:	6a 00                	push   $0x0
+ 30a:	ff 75 08             	push   0x8(%ebp)
+ 30d:	e8 e2 02 00 00       	call   5f4 <open>
+  if(fd < 0)
+ 312:	83 c4 10             	add    $0x10,%esp
+ 315:	85 c0                	test   %eax,%eax
+ 317:	78 27                	js     340 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 319:	83 ec 08             	sub    $0x8,%esp
+ 31c:	ff 75 0c             	push   0xc(%ebp)
+ 31f:	89 c3                	mov    %eax,%ebx
+ 321:	50                   	push   %eax
+ 322:	e8 ee 02 00 00       	call   615 <fstat>
+  close(fd);
+ 327:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 32a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 32c:	e8 a2 02 00 00       	call   5d3 <close>
+  return r;
+ 331:	83 c4 10             	add    $0x10,%esp
+}
+ 334:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 337:	89 f0                	mov    %esi,%eax
+ 339:	5b                   	pop    %ebx
+ 33a:	5e                   	pop    %esi
+ 33b:	5d                   	pop    %ebp
+ 33c:	c3                   	ret
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 340:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 345:	eb ed                	jmp    334 <stat+0x34>
+ 347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34e:	66 90                	xchg   %ax,%ax
+
+00000350 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	53                   	push   %ebx
+ 354:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 357:	0f be 02             	movsbl (%edx),%eax
+ 35a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 35d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 360:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 365:	77 1e                	ja     385 <atoi+0x35>
+ 367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 370:	83 c2 01             	add    $0x1,%edx
+ 373:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 376:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 37a:	0f be 02             	movsbl (%edx),%eax
+ 37d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 380:	80 fb 09             	cmp    $0x9,%bl
+ 383:	76 eb                	jbe    370 <atoi+0x20>
+  return n;
+}
+ 385:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 388:	89 c8                	mov    %ecx,%eax
+ 38a:	c9                   	leave
+ 38b:	c3                   	ret
+ 38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	56                   	push   %esi
+ 395:	8b 45 10             	mov    0x10(%ebp),%eax
+ 398:	8b 55 08             	mov    0x8(%ebp),%edx
+ 39b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 39e:	85 c0                	test   %eax,%eax
+ 3a0:	7e 13                	jle    3b5 <memmove+0x25>
+ 3a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3a4:	89 d7                	mov    %edx,%edi
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3b1:	39 f8                	cmp    %edi,%eax
+ 3b3:	75 fb                	jne    3b0 <memmove+0x20>
+  return vdst;
+}
+ 3b5:	5e                   	pop    %esi
+ 3b6:	89 d0                	mov    %edx,%eax
+ 3b8:	5f                   	pop    %edi
+ 3b9:	5d                   	pop    %ebp
+ 3ba:	c3                   	ret
+ 3bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3bf:	90                   	nop
+
+000003c0 <getpid>:
+int
+getpid(void)
+{
+  int pid;
+
+  if((pid = ((struct procinfo*)PROCINFO)->pid) != 0)
+ 3c0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 3c5:	85 c0                	test   %eax,%eax
+ 3c7:	74 07                	je     3d0 <getpid+0x10>
+    return pid;
+  return sysgetpid();
+}
+ 3c9:	c3                   	ret
+ 3ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return sysgetpid();
+ 3d0:	e9 77 02 00 00       	jmp    64c <sysgetpid>
+ 3d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct sysinfo*)SYSINFO)->ticks;
+ 3e0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 3e5:	c3                   	ret
+ 3e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003f0 <cyclereport>:
+
+// For the benchmarks: print that n units (say, "calls") of
+// what took t TSC cycles in all, and how many each.
+void
+cyclereport(char *what, char *units, uint64 t, int n)
+{
+ 3f0:	55                   	push   %ebp
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+ 3f1:	31 d2                	xor    %edx,%edx
+ 3f3:	89 e5                	mov    %esp,%ebp
+ 3f5:	53                   	push   %ebx
+ 3f6:	83 ec 04             	sub    $0x4,%esp
+ 3f9:	8b 4d 18             	mov    0x18(%ebp),%ecx
+ 3fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 3ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  printf(1, "%s: %d %s, %d cycles each\n", what, n, units,
+ 402:	85 c9                	test   %ecx,%ecx
+ 404:	7e 08                	jle    40e <cyclereport+0x1e>
+ 406:	f7 f1                	div    %ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 408:	89 d8                	mov    %ebx,%eax
+ 40a:	f7 f1                	div    %ecx
+ 40c:	89 c2                	mov    %eax,%edx
+ 40e:	83 ec 08             	sub    $0x8,%esp
+ 411:	52                   	push   %edx
+ 412:	ff 75 0c             	push   0xc(%ebp)
+ 415:	51                   	push   %ecx
+ 416:	ff 75 08             	push   0x8(%ebp)
+ 419:	68 7f 0b 00 00       	push   $0xb7f
+ 41e:	6a 01                	push   $0x1
+ 420:	e8 fb 03 00 00       	call   820 <printf>
+         n > 0 ? udiv64(t, n) : 0);
+}
+ 425:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 428:	83 c4 20             	add    $0x20,%esp
+ 42b:	c9                   	leave
+ 42c:	c3                   	ret
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000430 <mutex_init>:
+// v is 0 when unlocked, 1 when locked, and 2 when locked
+// with possible waiters, so that an uncontended lock and
+// unlock make no system calls.
+void
+mutex_init(struct mutex *m)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+  m->v = 0;
+ 433:	8b 45 08             	mov    0x8(%ebp),%eax
+ 436:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 43c:	5d                   	pop    %ebp
+ 43d:	c3                   	ret
+ 43e:	66 90                	xchg   %ax,%ax
+
+00000440 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 440:	55                   	push   %ebp
+  int c;
+
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 441:	31 c0                	xor    %eax,%eax
+ 443:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 448:	89 e5                	mov    %esp,%ebp
+ 44a:	56                   	push   %esi
+ 44b:	53                   	push   %ebx
+ 44c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((c = __sync_val_compare_and_swap(&m->v, 0, 1)) == 0)
+ 44f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 453:	85 c0                	test   %eax,%eax
+ 455:	74 30                	je     487 <mutex_lock+0x47>
+    return;
+  if(c != 2)
+ 457:	83 f8 02             	cmp    $0x2,%eax
+ 45a:	74 0c                	je     468 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 45c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 461:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg((volatile uint*)&m->v, 2);
+  while(c != 0){
+ 464:	85 c0                	test   %eax,%eax
+ 466:	74 1f                	je     487 <mutex_lock+0x47>
+ 468:	be 02 00 00 00       	mov    $0x2,%esi
+ 46d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->v, 2);
+ 470:	83 ec 08             	sub    $0x8,%esp
+ 473:	6a 02                	push   $0x2
+ 475:	53                   	push   %ebx
+ 476:	e8 8c 02 00 00       	call   707 <futex_wait>
+ 47b:	89 f0                	mov    %esi,%eax
+ 47d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 480:	83 c4 10             	add    $0x10,%esp
+ 483:	85 c0                	test   %eax,%eax
+ 485:	75 e9                	jne    470 <mutex_lock+0x30>
+    c = xchg((volatile uint*)&m->v, 2);
+  }
+}
+ 487:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 48a:	5b                   	pop    %ebx
+ 48b:	5e                   	pop    %esi
+ 48c:	5d                   	pop    %ebp
+ 48d:	c3                   	ret
+ 48e:	66 90                	xchg   %ax,%ax
+
+00000490 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	83 ec 08             	sub    $0x8,%esp
+ 496:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 499:	f0 83 28 01          	lock subl $0x1,(%eax)
+ 49d:	75 09                	jne    4a8 <mutex_unlock+0x18>
+    m->v = 0;
+    futex_wake(&m->v, 1);
+  }
+}
+ 49f:	c9                   	leave
+ 4a0:	c3                   	ret
+ 4a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex_wake(&m->v, 1);
+ 4a8:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 4ab:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->v, 1);
+ 4b1:	6a 01                	push   $0x1
+ 4b3:	50                   	push   %eax
+ 4b4:	e8 59 02 00 00       	call   712 <futex_wake>
+ 4b9:	83 c4 10             	add    $0x10,%esp
+}
+ 4bc:	c9                   	leave
+ 4bd:	c3                   	ret
+ 4be:	66 90                	xchg   %ax,%ax
+
+000004c0 <cond_init>:
+
+// Condition variable: waiters sleep until seq moves on.
+void
+cond_init(struct cond *c)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 4c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 4cc:	5d                   	pop    %ebp
+ 4cd:	c3                   	ret
+ 4ce:	66 90                	xchg   %ax,%ax
+
+000004d0 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	57                   	push   %edi
+ 4d4:	56                   	push   %esi
+ 4d5:	53                   	push   %ebx
+ 4d6:	83 ec 0c             	sub    $0xc,%esp
+ 4d9:	8b 75 08             	mov    0x8(%ebp),%esi
+ 4dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int seq;
+
+  seq = c->seq;
+ 4df:	8b 3e                	mov    (%esi),%edi
+  if(__sync_fetch_and_sub(&m->v, 1) != 1){
+ 4e1:	f0 83 2b 01          	lock subl $0x1,(%ebx)
+ 4e5:	75 21                	jne    508 <cond_wait+0x38>
+  mutex_unlock(m);
+  futex_wait(&c->seq, seq);
+ 4e7:	83 ec 08             	sub    $0x8,%esp
+ 4ea:	57                   	push   %edi
+ 4eb:	56                   	push   %esi
+ 4ec:	e8 16 02 00 00       	call   707 <futex_wait>
+  mutex_lock(m);
+ 4f1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 4f4:	83 c4 10             	add    $0x10,%esp
+}
+ 4f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4fa:	5b                   	pop    %ebx
+ 4fb:	5e                   	pop    %esi
+ 4fc:	5f                   	pop    %edi
+ 4fd:	5d                   	pop    %ebp
+  mutex_lock(m);
+ 4fe:	e9 3d ff ff ff       	jmp    440 <mutex_lock>
+ 503:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 507:	90                   	nop
+    futex_wake(&m->v, 1);
+ 508:	83 ec 08             	sub    $0x8,%esp
+    m->v = 0;
+ 50b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    futex_wake(&m->v, 1);
+ 511:	6a 01                	push   $0x1
+ 513:	53                   	push   %ebx
+ 514:	e8 f9 01 00 00       	call   712 <futex_wake>
+ 519:	83 c4 10             	add    $0x10,%esp
+ 51c:	eb c9                	jmp    4e7 <cond_wait+0x17>
+ 51e:	66 90                	xchg   %ax,%ax
+
+00000520 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	83 ec 10             	sub    $0x10,%esp
+ 526:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 529:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+ 52d:	6a 01                	push   $0x1
+ 52f:	50                   	push   %eax
+ 530:	e8 dd 01 00 00       	call   712 <futex_wake>
+}
+ 535:	83 c4 10             	add    $0x10,%esp
+ 538:	c9                   	leave
+ 539:	c3                   	ret
+ 53a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000540 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	83 ec 10             	sub    $0x10,%esp
+ 546:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 549:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 0x7fffffff);
+ 54d:	68 ff ff ff 7f       	push   $0x7fffffff
+ 552:	50                   	push   %eax
+ 553:	e8 ba 01 00 00       	call   712 <futex_wake>
+}
+ 558:	83 c4 10             	add    $0x10,%esp
+ 55b:	c9                   	leave
+ 55c:	c3                   	ret
+
+0000055d <sysprobe>:
+syscallvec:
+  .long sysprobe
+
+.text
+sysprobe:
+  pushl %eax
+ 55d:	50                   	push   %eax
+  pushl %ebx
+ 55e:	53                   	push   %ebx
+  movl $1, %eax
+ 55f:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+ 564:	0f a2                	cpuid
+  popl %ebx
+ 566:	5b                   	pop    %ebx
+  popl %eax
+ 567:	58                   	pop    %eax
+  movl $sysint, syscallvec
+ 568:	c7 05 24 10 00 00 8e 	movl   $0x58e,0x1024
+ 56f:	05 00 00 
+  testl $(1<<11), %edx   # CPUID_SEP
+ 572:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz sysint
+ 578:	74 14                	je     58e <sysint>
+  movl $sysfast, syscallvec
+ 57a:	c7 05 24 10 00 00 84 	movl   $0x584,0x1024
+ 581:	05 00 00 
+
+00000584 <sysfast>:
+  # fall through
+
+sysfast:
+  movl %esp, %ecx
+ 584:	89 e1                	mov    %esp,%ecx
+  movl $1f, %edx
+ 586:	ba 8d 05 00 00       	mov    $0x58d,%edx
+  sysenter
+ 58b:	0f 34                	sysenter
+1:
+  ret
+ 58d:	c3                   	ret
+
+0000058e <sysint>:
+
+sysint:
+  int $T_SYSCALL
+ 58e:	cd 40                	int    $0x40
+  ret
+ 590:	c3                   	ret
+
+00000591 <fork>:
+
+SYSCALL(fork)
+ 591:	b8 01 00 00 00       	mov    $0x1,%eax
+ 596:	ff 25 24 10 00 00    	jmp    *0x1024
+
+0000059c <exit>:
+SYSCALL(exit)
+ 59c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5a1:	ff 25 24 10 00 00    	jmp    *0x1024
+
+000005a7 <wait>:
+SYSCALL(wait)
+ 5a7:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5ac:	ff 25 24 10 00 00    	jmp    *0x1024
+
+000005b2 <pipe>:
+SYSCALL(pipe)
+ 5b2:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5b7:	ff 25 24 10 00 00    	jmp    *0x1024
+
+000005bd <read>:
+SYSCALL(read)
+ 5bd:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5c2:	ff 25 24 10 00 00    	jmp    *0x1024
+
+000005c8 <write>:
+SYSCALL(write)
+ 5c8:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5cd:	ff 25 24 10 00 00    	jmp    *0x1024
+
+000005d3 <close>:
+SYSCALL(close)
+ 5d3:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5d8:	ff 25 24 10 00 00    	jmp    *0x1024
+
+000005de <kill>:
+SYSCALL(kill)
+ 5de:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5e3:	ff 25 24 10 00 00    	jmp    *0x1024
+
+000005e9 <exec>:
+SYSCALL(exec)
+ 5e9:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5ee:	ff 25 24 10 00 00    	jmp    *0x1024
+
+000005f4 <open>:
+SYSCALL(open)
+ 5f4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5f9:	ff 25 24 10 00 00    	jmp    *0x1024
+
+000005ff <mknod>:
+SYSCALL(mknod)
+ 5ff:	b8 11 00 00 00       	mov    $0x11,%eax
+ 604:	ff 25 24 10 00 00    	jmp    *0x1024
+
+0000060a <unlink>:
+SYSCALL(unlink)
+ 60a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 60f:	ff 25 24 10 00 00    	jmp    *0x1024
+
+00000615 <fstat>:
+SYSCALL(fstat)
+ 615:	b8 08 00 00 00       	mov    $0x8,%eax
+ 61a:	ff 25 24 10 00 00    	jmp    *0x1024
+
+00000620 <link>:
+SYSCALL(link)
+ 620:	b8 13 00 00 00       	mov    $0x13,%eax
+ 625:	ff 25 24 10 00 00    	jmp    *0x1024
+
+0000062b <mkdir>:
+SYSCALL(mkdir)
+ 62b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 630:	ff 25 24 10 00 00    	jmp    *0x1024
+
+00000636 <chdir>:
+SYSCALL(chdir)
+ 636:	b8 09 00 00 00       	mov    $0x9,%eax
+ 63b:	ff 25 24 10 00 00    	jmp    *0x1024
+
+00000641 <dup>:
+SYSCALL(dup)
+ 641:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 646:	ff 25 24 10 00 00    	jmp    *0x1024
+
+0000064c <sysgetpid>:
+SYSCALLAS(sysgetpid, getpid)
+ 64c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 651:	ff 25 24 10 00 00    	jmp    *0x1024
+
+00000657 <sbrk>:
+SYSCALL(sbrk)
+ 657:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 65c:	ff 25 24 10 00 00    	jmp    *0x1024
+
+00000662 <sleep>:
+SYSCALL(sleep)
+ 662:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 667:	ff 25 24 10 00 00    	jmp    *0x1024
+
+0000066d <sysuptime>:
+SYSCALLAS(sysuptime, uptime)
+ 66d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 672:	ff 25 24 10 00 00    	jmp    *0x1024
+
+00000678 <swapread>:
+SYSCALL(swapread)
+ 678:	b8 16 00 00 00       	mov    $0x16,%eax
+ 67d:	ff 25 24 10 00 00    	jmp    *0x1024
+
+00000683 <swapwrite>:
+SYSCALL(swapwrite)
+ 683:	b8 17 00 00 00       	mov    $0x17,%eax
+ 688:	ff 25 24 10 00 00    	jmp    *0x1024
+
+0000068e <swapstat>:
+SYSCALL(swapstat)
+ 68e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 693:	ff 25 24 10 00 00    	jmp    *0x1024
+
+00000699 <madvise>:
+SYSCALL(madvise)
+ 699:	b8 19 00 00 00       	mov    $0x19,%eax
+ 69e:	ff 25 24 10 00 00    	jmp    *0x1024
+
+000006a4 <mlock>:
+SYSCALL(mlock)
+ 6a4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6a9:	ff 25 24 10 00 00    	jmp    *0x1024
+
+000006af <munlock>:
+SYSCALL(munlock)
+ 6af:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6b4:	ff 25 24 10 00 00    	jmp    *0x1024
+
+000006ba <membench>:
+SYSCALL(membench)
+ 6ba:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6bf:	ff 25 24 10 00 00    	jmp    *0x1024
+
+000006c5 <nice>:
+SYSCALL(nice)
+ 6c5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6ca:	ff 25 24 10 00 00    	jmp    *0x1024
+
+000006d0 <setpriority>:
+SYSCALL(setpriority)
+ 6d0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6d5:	ff 25 24 10 00 00    	jmp    *0x1024
+
+000006db <usleep>:
+SYSCALL(usleep)
+ 6db:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6e0:	ff 25 24 10 00 00    	jmp    *0x1024
+
+000006e6 <cpustat>:
+SYSCALL(cpustat)
+ 6e6:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6eb:	ff 25 24 10 00 00    	jmp    *0x1024
+
+000006f1 <clone>:
+SYSCALL(clone)
+ 6f1:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6f6:	ff 25 24 10 00 00    	jmp    *0x1024
+
+000006fc <join>:
+SYSCALL(join)
+ 6fc:	b8 22 00 00 00       	mov    $0x22,%eax
+ 701:	ff 25 24 10 00 00    	jmp    *0x1024
+
+00000707 <futex_wait>:
+SYSCALL(futex_wait)
+ 707:	b8 23 00 00 00       	mov    $0x23,%eax
+ 70c:	ff 25 24 10 00 00    	jmp    *0x1024
+
+00000712 <futex_wake>:
+SYSCALL(futex_wake)
+ 712:	b8 24 00 00 00       	mov    $0x24,%eax
+ 717:	ff 25 24 10 00 00    	jmp    *0x1024
+
+0000071d <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 71d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 722:	ff 25 24 10 00 00    	jmp    *0x1024
+
+00000728 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 728:	b8 26 00 00 00       	mov    $0x26,%eax
+ 72d:	ff 25 24 10 00 00    	jmp    *0x1024
+
+00000733 <getcpu>:
+SYSCALL(getcpu)
+ 733:	b8 27 00 00 00       	mov    $0x27,%eax
+ 738:	ff 25 24 10 00 00    	jmp    *0x1024
+
+0000073e <migrations>:
+SYSCALL(migrations)
+ 73e:	b8 28 00 00 00       	mov    $0x28,%eax
+ 743:	ff 25 24 10 00 00    	jmp    *0x1024
+
+00000749 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 749:	b8 29 00 00 00       	mov    $0x29,%eax
+ 74e:	ff 25 24 10 00 00    	jmp    *0x1024
+
+00000754 <lockstat>:
+SYSCALL(lockstat)
+ 754:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 759:	ff 25 24 10 00 00    	jmp    *0x1024
+
+0000075f <lockprof>:
+SYSCALL(lockprof)
+ 75f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 764:	ff 25 24 10 00 00    	jmp    *0x1024
+
+0000076a <bcachestat>:
+SYSCALL(bcachestat)
+ 76a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 76f:	ff 25 24 10 00 00    	jmp    *0x1024
+ 775:	66 90                	xchg   %ax,%ax
+ 777:	66 90                	xchg   %ax,%ax
+ 779:	66 90                	xchg   %ax,%ax
+ 77b:	66 90                	xchg   %ax,%ax
+ 77d:	66 90                	xchg   %ax,%ax
+ 77f:	90                   	nop
+
+00000780 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 780:	55                   	push   %ebp
+ 781:	89 e5                	mov    %esp,%ebp
+ 783:	57                   	push   %edi
+ 784:	56                   	push   %esi
+ 785:	53                   	push   %ebx
+ 786:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 788:	89 d1                	mov    %edx,%ecx
+{
+ 78a:	83 ec 3c             	sub    $0x3c,%esp
+ 78d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 790:	85 d2                	test   %edx,%edx
+ 792:	0f 89 80 00 00 00    	jns    818 <printint+0x98>
+ 798:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 79c:	74 7a                	je     818 <printint+0x98>
+    x = -xx;
+ 79e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 7a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 7a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 7a8:	31 f6                	xor    %esi,%esi
+ 7aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 7b0:	89 c8                	mov    %ecx,%eax
+ 7b2:	31 d2                	xor    %edx,%edx
+ 7b4:	89 f7                	mov    %esi,%edi
+ 7b6:	f7 f3                	div    %ebx
+ 7b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7bb:	0f b6 92 fc 0b 00 00 	movzbl 0xbfc(%edx),%edx
+ 7c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7c6:	89 ca                	mov    %ecx,%edx
+ 7c8:	89 c1                	mov    %eax,%ecx
+ 7ca:	39 da                	cmp    %ebx,%edx
+ 7cc:	73 e2                	jae    7b0 <printint+0x30>
+  if(neg)
+ 7ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7d1:	85 c0                	test   %eax,%eax
+ 7d3:	74 07                	je     7dc <printint+0x5c>
+    buf[i++] = '-';
+ 7d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7da:	89 f7                	mov    %esi,%edi
+ 7dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 7e2:	01 df                	add    %ebx,%edi
+ 7e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 7e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 7eb:	83 ec 04             	sub    $0x4,%esp
+ 7ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 7f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 7f4:	6a 01                	push   $0x1
+ 7f6:	50                   	push   %eax
+ 7f7:	56                   	push   %esi
+ 7f8:	e8 cb fd ff ff       	call   5c8 <write>
+  while(--i >= 0)
+ 7fd:	89 f8                	mov    %edi,%eax
+ 7ff:	83 c4 10             	add    $0x10,%esp
+ 802:	83 ef 01             	sub    $0x1,%edi
+ 805:	39 d8                	cmp    %ebx,%eax
+ 807:	75 df                	jne    7e8 <printint+0x68>
+}
+ 809:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 80c:	5b                   	pop    %ebx
+ 80d:	5e                   	pop    %esi
+ 80e:	5f                   	pop    %edi
+ 80f:	5d                   	pop    %ebp
+ 810:	c3                   	ret
+ 811:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 818:	31 c0                	xor    %eax,%eax
+ 81a:	eb 89                	jmp    7a5 <printint+0x25>
+ 81c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000820 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 820:	55                   	push   %ebp
+ 821:	89 e5                	mov    %esp,%ebp
+ 823:	57                   	push   %edi
+ 824:	56                   	push   %esi
+ 825:	53                   	push   %ebx
+ 826:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 829:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 82c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 82f:	0f b6 1e             	movzbl (%esi),%ebx
+ 832:	83 c6 01             	add    $0x1,%esi
+ 835:	84 db                	test   %bl,%bl
+ 837:	74 67                	je     8a0 <printf+0x80>
+ 839:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 83c:	31 d2                	xor    %edx,%edx
+ 83e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 841:	eb 34                	jmp    877 <printf+0x57>
+ 843:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 847:	90                   	nop
+ 848:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 84b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 850:	83 f8 25             	cmp    $0x25,%eax
+ 853:	74 18                	je     86d <printf+0x4d>
+  write(fd, &c, 1);
+ 855:	83 ec 04             	sub    $0x4,%esp
+ 858:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 85b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 85e:	6a 01                	push   $0x1
+ 860:	50                   	push   %eax
+ 861:	57                   	push   %edi
+ 862:	e8 61 fd ff ff       	call   5c8 <write>
+ 867:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 86a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 86d:	0f b6 1e             	movzbl (%esi),%ebx
+ 870:	83 c6 01             	add    $0x1,%esi
+ 873:	84 db                	test   %bl,%bl
+ 875:	74 29                	je     8a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 877:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 87a:	85 d2                	test   %edx,%edx
+ 87c:	74 ca                	je     848 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 87e:	83 fa 25             	cmp    $0x25,%edx
+ 881:	75 ea                	jne    86d <printf+0x4d>
+      if(c == 'd'){
+ 883:	83 f8 25             	cmp    $0x25,%eax
+ 886:	0f 84 24 01 00 00    	je     9b0 <printf+0x190>
+ 88c:	83 e8 63             	sub    $0x63,%eax
+ 88f:	83 f8 15             	cmp    $0x15,%eax
+ 892:	77 1c                	ja     8b0 <printf+0x90>
+ 894:	ff 24 85 a4 0b 00 00 	jmp    *0xba4(,%eax,4)
+ 89b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 89f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 8a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8a3:	5b                   	pop    %ebx
+ 8a4:	5e                   	pop    %esi
+ 8a5:	5f                   	pop    %edi
+ 8a6:	5d                   	pop    %ebp
+ 8a7:	c3                   	ret
+ 8a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8af:	90                   	nop
+  write(fd, &c, 1);
+ 8b0:	83 ec 04             	sub    $0x4,%esp
+ 8b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 8ba:	6a 01                	push   $0x1
+ 8bc:	52                   	push   %edx
+ 8bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 8c0:	57                   	push   %edi
+ 8c1:	e8 02 fd ff ff       	call   5c8 <write>
+ 8c6:	83 c4 0c             	add    $0xc,%esp
+ 8c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8cc:	6a 01                	push   $0x1
+ 8ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8d1:	52                   	push   %edx
+ 8d2:	57                   	push   %edi
+ 8d3:	e8 f0 fc ff ff       	call   5c8 <write>
+        putc(fd, c);
+ 8d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8db:	31 d2                	xor    %edx,%edx
+ 8dd:	eb 8e                	jmp    86d <printf+0x4d>
+ 8df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 8e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8e3:	83 ec 0c             	sub    $0xc,%esp
+ 8e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8eb:	8b 13                	mov    (%ebx),%edx
+ 8ed:	6a 00                	push   $0x0
+ 8ef:	89 f8                	mov    %edi,%eax
+        ap++;
+ 8f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 8f4:	e8 87 fe ff ff       	call   780 <printint>
+        ap++;
+ 8f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8ff:	31 d2                	xor    %edx,%edx
+ 901:	e9 67 ff ff ff       	jmp    86d <printf+0x4d>
+ 906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 910:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 913:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 915:	83 c0 04             	add    $0x4,%eax
+ 918:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 91b:	85 db                	test   %ebx,%ebx
+ 91d:	0f 84 9d 00 00 00    	je     9c0 <printf+0x1a0>
+        while(*s != 0){
+ 923:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 926:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 928:	84 c0                	test   %al,%al
+ 92a:	0f 84 3d ff ff ff    	je     86d <printf+0x4d>
+ 930:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 933:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 936:	89 de                	mov    %ebx,%esi
+ 938:	89 d3                	mov    %edx,%ebx
+ 93a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 940:	83 ec 04             	sub    $0x4,%esp
+ 943:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 946:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 949:	6a 01                	push   $0x1
+ 94b:	53                   	push   %ebx
+ 94c:	57                   	push   %edi
+ 94d:	e8 76 fc ff ff       	call   5c8 <write>
+        while(*s != 0){
+ 952:	0f b6 06             	movzbl (%esi),%eax
+ 955:	83 c4 10             	add    $0x10,%esp
+ 958:	84 c0                	test   %al,%al
+ 95a:	75 e4                	jne    940 <printf+0x120>
+      state = 0;
+ 95c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 95f:	31 d2                	xor    %edx,%edx
+ 961:	e9 07 ff ff ff       	jmp    86d <printf+0x4d>
+ 966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 970:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 973:	83 ec 0c             	sub    $0xc,%esp
+ 976:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 97b:	8b 13                	mov    (%ebx),%edx
+ 97d:	6a 01                	push   $0x1
+ 97f:	e9 6b ff ff ff       	jmp    8ef <printf+0xcf>
+ 984:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 988:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 98b:	83 ec 04             	sub    $0x4,%esp
+ 98e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 991:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 993:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 996:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 999:	6a 01                	push   $0x1
+ 99b:	52                   	push   %edx
+ 99c:	57                   	push   %edi
+ 99d:	e8 26 fc ff ff       	call   5c8 <write>
+        ap++;
+ 9a2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9a5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9a8:	31 d2                	xor    %edx,%edx
+ 9aa:	e9 be fe ff ff       	jmp    86d <printf+0x4d>
+ 9af:	90                   	nop
+  write(fd, &c, 1);
+ 9b0:	83 ec 04             	sub    $0x4,%esp
+ 9b3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9b6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9b9:	6a 01                	push   $0x1
+ 9bb:	e9 11 ff ff ff       	jmp    8d1 <printf+0xb1>
+ 9c0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 9c5:	bb 9a 0b 00 00       	mov    $0xb9a,%ebx
+ 9ca:	e9 61 ff ff ff       	jmp    930 <printf+0x110>
+ 9cf:	90                   	nop
+
+000009d0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9d0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9d1:	a1 40 12 00 00       	mov    0x1240,%eax
+{
+ 9d6:	89 e5                	mov    %esp,%ebp
+ 9d8:	57                   	push   %edi
+ 9d9:	56                   	push   %esi
+ 9da:	53                   	push   %ebx
+ 9db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 9de:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9e8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9ea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9ec:	39 ca                	cmp    %ecx,%edx
+ 9ee:	73 30                	jae    a20 <free+0x50>
+ 9f0:	39 c1                	cmp    %eax,%ecx
+ 9f2:	72 04                	jb     9f8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9f4:	39 c2                	cmp    %eax,%edx
+ 9f6:	72 f0                	jb     9e8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9f8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 9fb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 9fe:	39 f8                	cmp    %edi,%eax
+ a00:	74 2e                	je     a30 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a02:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a05:	8b 42 04             	mov    0x4(%edx),%eax
+ a08:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a0b:	39 f1                	cmp    %esi,%ecx
+ a0d:	74 38                	je     a47 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a0f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a11:	5b                   	pop    %ebx
+  freep = p;
+ a12:	89 15 40 12 00 00    	mov    %edx,0x1240
+}
+ a18:	5e                   	pop    %esi
+ a19:	5f                   	pop    %edi
+ a1a:	5d                   	pop    %ebp
+ a1b:	c3                   	ret
+ a1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a20:	39 c1                	cmp    %eax,%ecx
+ a22:	72 d0                	jb     9f4 <free+0x24>
+ a24:	eb c2                	jmp    9e8 <free+0x18>
+ a26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a30:	03 70 04             	add    0x4(%eax),%esi
+ a33:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a36:	8b 02                	mov    (%edx),%eax
+ a38:	8b 00                	mov    (%eax),%eax
+ a3a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a3d:	8b 42 04             	mov    0x4(%edx),%eax
+ a40:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a43:	39 f1                	cmp    %esi,%ecx
+ a45:	75 c8                	jne    a0f <free+0x3f>
+    p->s.size += bp->s.size;
+ a47:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a4a:	89 15 40 12 00 00    	mov    %edx,0x1240
+    p->s.size += bp->s.size;
+ a50:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a53:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a56:	89 0a                	mov    %ecx,(%edx)
+}
+ a58:	5b                   	pop    %ebx
+ a59:	5e                   	pop    %esi
+ a5a:	5f                   	pop    %edi
+ a5b:	5d                   	pop    %ebp
+ a5c:	c3                   	ret
+ a5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a60 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a60:	55                   	push   %ebp
+ a61:	89 e5                	mov    %esp,%ebp
+ a63:	57                   	push   %edi
+ a64:	56                   	push   %esi
+ a65:	53                   	push   %ebx
+ a66:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a69:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a6c:	8b 15 40 12 00 00    	mov    0x1240,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a72:	8d 78 07             	lea    0x7(%eax),%edi
+ a75:	c1 ef 03             	shr    $0x3,%edi
+ a78:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a7b:	85 d2                	test   %edx,%edx
+ a7d:	0f 84 8d 00 00 00    	je     b10 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a83:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a85:	8b 48 04             	mov    0x4(%eax),%ecx
+ a88:	39 f9                	cmp    %edi,%ecx
+ a8a:	73 64                	jae    af0 <malloc+0x90>
+  if(nu < 4096)
+ a8c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a91:	39 df                	cmp    %ebx,%edi
+ a93:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a96:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a9d:	eb 0a                	jmp    aa9 <malloc+0x49>
+ a9f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ aa0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ aa2:	8b 48 04             	mov    0x4(%eax),%ecx
+ aa5:	39 f9                	cmp    %edi,%ecx
+ aa7:	73 47                	jae    af0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ aa9:	89 c2                	mov    %eax,%edx
+ aab:	39 05 40 12 00 00    	cmp    %eax,0x1240
+ ab1:	75 ed                	jne    aa0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ab3:	83 ec 0c             	sub    $0xc,%esp
+ ab6:	56                   	push   %esi
+ ab7:	e8 9b fb ff ff       	call   657 <sbrk>
+  if(p == (char*)-1)
+ abc:	83 c4 10             	add    $0x10,%esp
+ abf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ac2:	74 1c                	je     ae0 <malloc+0x80>
+  hp->s.size = nu;
+ ac4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ ac7:	83 ec 0c             	sub    $0xc,%esp
+ aca:	83 c0 08             	add    $0x8,%eax
+ acd:	50                   	push   %eax
+ ace:	e8 fd fe ff ff       	call   9d0 <free>
+  return freep;
+ ad3:	8b 15 40 12 00 00    	mov    0x1240,%edx
+      if((p = morecore(nunits)) == 0)
+ ad9:	83 c4 10             	add    $0x10,%esp
+ adc:	85 d2                	test   %edx,%edx
+ ade:	75 c0                	jne    aa0 <malloc+0x40>
+        return 0;
+  }
+}
+ ae0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ ae3:	31 c0                	xor    %eax,%eax
+}
+ ae5:	5b                   	pop    %ebx
+ ae6:	5e                   	pop    %esi
+ ae7:	5f                   	pop    %edi
+ ae8:	5d                   	pop    %ebp
+ ae9:	c3                   	ret
+ aea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ af0:	39 cf                	cmp    %ecx,%edi
+ af2:	74 4c                	je     b40 <malloc+0xe0>
+        p->s.size -= nunits;
+ af4:	29 f9                	sub    %edi,%ecx
+ af6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ af9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ afc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ aff:	89 15 40 12 00 00    	mov    %edx,0x1240
+}
+ b05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b08:	83 c0 08             	add    $0x8,%eax
+}
+ b0b:	5b                   	pop    %ebx
+ b0c:	5e                   	pop    %esi
+ b0d:	5f                   	pop    %edi
+ b0e:	5d                   	pop    %ebp
+ b0f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b10:	c7 05 40 12 00 00 44 	movl   $0x1244,0x1240
+ b17:	12 00 00 
+    base.s.size = 0;
+ b1a:	b8 44 12 00 00       	mov    $0x1244,%eax
+    base.s.ptr = freep = prevp = &base;
+ b1f:	c7 05 44 12 00 00 44 	movl   $0x1244,0x1244
+ b26:	12 00 00 
+    base.s.size = 0;
+ b29:	c7 05 48 12 00 00 00 	movl   $0x0,0x1248
+ b30:	00 00 00 
+    if(p->s.size >= nunits){
+ b33:	e9 54 ff ff ff       	jmp    a8c <malloc+0x2c>
+ b38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b3f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b40:	8b 08                	mov    (%eax),%ecx
+ b42:	89 0a                	mov    %ecx,(%edx)
+ b44:	eb b9                	jmp    aff <malloc+0x9f>
@@ -57,6 +57,24 @@ stosl(void *addr, int data, int cnt)
                "memory", "cc");
 }
 
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+               "=D" (dst), "=S" (src), "=c" (cnt) :
+               "0" (dst), "1" (src), "2" (cnt) :
+               "memory", "cc");
+}
+
 struct segdesc;
 
 static inline void
@@ -130,6 +148,84 @@ xchg(volatile uint *addr, uint newval)
   return result;
 }
 
+// Spin-wait hint: lets a hyperthread sibling run, and avoids
+// a pipeline flush when the awaited store arrives.
+static inline void
+pause(void)
+{
+  asm volatile("pause");
+}
+
+static inline uint
+rcr0(void)
+{
+  uint val;
+  asm volatile("movl %%cr0,%0" : "=r" (val));
+  return val;
+}
+
+static inline void
+lcr0(uint val)
+{
+  asm volatile("movl %0,%%cr0" : : "r" (val));
+}
+
+static inline uint
+rcr4(void)
+{
+  uint val;
+  asm volatile("movl %%cr4,%0" : "=r" (val));
+  return val;
+}
+
+static inline void
+lcr4(uint val)
+{
+  asm volatile("movl %0,%%cr4" : : "r" (val));
+}
+
+static inline void
+clts(void)
+{
+  asm volatile("clts");
+}
+
+// area must be 512 bytes, 16-byte aligned.
+static inline void
+fxsave(void *area)
+{
+  asm volatile("fxsave (%0)" : : "r" (area) : "memory");
+}
+
+static inline void
+fxrstor(void *area)
+{
+  asm volatile("fxrstor (%0)" : : "r" (area) : "memory");
+}
+
+static inline void
+fninit(void)
+{
+  asm volatile("fninit");
+}
+
+static inline void
+ldmxcsr(uint val)
+{
+  asm volatile("ldmxcsr %0" : : "m" (val));
+}
+
+// Model-specific registers for sysenter
+#define MSR_SYSENTER_CS   0x174
+#define MSR_SYSENTER_ESP  0x175
+#define MSR_SYSENTER_EIP  0x176
+
+static inline void
+wrmsr(uint msr, uint64 val)
+{
+  asm volatile("wrmsr" : : "c" (msr), "a" ((uint)val), "d" ((uint)(val >> 32)));
+}
+
 static inline uint
 rcr2(void)
 {
@@ -144,6 +240,64 @@ lcr3(uint val)
   asm volatile("movl %0,%%cr3" : : "r" (val));
 }
 
+static inline uint
+rcr3(void)
+{
+  uint val;
+  asm volatile("movl %%cr3,%0" : "=r" (val));
+  return val;
+}
+
+static inline void
+invlpg(void *addr)
+{
+  asm volatile("invlpg (%0)" : : "r" (addr) : "memory");
+}
+
+// getcpuid(1) feature bits in %edx
+#define CPUID_SEP       (1<<11)         // sysenter and sysexit
+#define CPUID_FXSR      (1<<24)         // fxsave and fxrstor
+#define CPUID_SSE       (1<<25)         // SSE
+#define CPUID_SSE2      (1<<26)         // SSE2, including movnti
+
+static inline void
+getcpuid(uint info, uint *eaxp, uint *ebxp, uint *ecxp, uint *edxp)
+{
+  uint eax, ebx, ecx, edx;
+
+  asm volatile("cpuid" :
+               "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx) :
+               "a" (info), "c" (0));
+  if(eaxp)
+    *eaxp = eax;
+  if(ebxp)
+    *ebxp = ebx;
+  if(ecxp)
+    *ecxp = ecx;
+  if(edxp)
+    *edxp = edx;
+}
+
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+  return tsc;
+}
+
+// The low 32 bits of n / d; the kernel has no libgcc
+// to do 64-bit division for it.
+static inline uint
+udiv64(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32) % d), "rm" (d));
+  return q;
+}
+
 //PAGEBREAK: 36
 // Layout of the trap frame built on the stack by the
 // hardware and by trapasm.S, and passed to trap().